@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief ARM Cortex-M sampling of the interrupted context for perf
+ */
+
+#include <zephyr/kernel.h>
+#include <cmsis_core.h>
+
+size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size)
+{
+	const z_arch_esf_t *esf;
+
+	if (size < 2U) {
+		return 0;
+	}
+
+	/* Threads run on PSP, so an interrupted thread has its context
+	 * stacked there. If the timer interrupt is not the only active
+	 * exception it preempted another ISR, whose frame is on MSP.
+	 */
+	if ((SCB->ICSR & SCB_ICSR_RETTOBASE_Msk) == 0U) {
+		return 0;
+	}
+
+	esf = (const z_arch_esf_t *)__get_PSP();
+
+	buf[0] = esf->basic.pc;
+	buf[1] = esf->basic.lr;
+
+	return 2;
+}
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
 #include <zephyr/device.h>
 #include <zephyr/init.h>
 #include <zephyr/kernel.h>
@@ -204,6 +205,13 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 	static struct z_arm_mpu_partition
 			dynamic_regions[_MAX_DYNAMIC_MPU_REGIONS_NUM];
 
+	/* Dynamic regions currently programmed in the MPU. The count starts
+	 * out of range, so that the first configuration is always programmed.
+	 */
+	static struct z_arm_mpu_partition
+			programmed_regions[_MAX_DYNAMIC_MPU_REGIONS_NUM];
+	static uint8_t programmed_num = UINT8_MAX;
+
 	uint8_t region_num = 0U;
 
 #if defined(CONFIG_USERSPACE)
@@ -311,6 +319,19 @@ void z_arm_configure_dynamic_mpu_regions(struct k_thread *thread)
 	region_num++;
 #endif /* CONFIG_MPU_STACK_GUARD */
 
+	/* Nothing to do if the regions are programmed already, e.g. when
+	 * switching back to the thread that ran last.
+	 */
+	if ((region_num == programmed_num) &&
+	    (memcmp(dynamic_regions, programmed_regions,
+		    region_num * sizeof(dynamic_regions[0])) == 0)) {
+		return;
+	}
+
+	memcpy(programmed_regions, dynamic_regions,
+	       region_num * sizeof(dynamic_regions[0]));
+	programmed_num = region_num;
+
 	/* Configure the dynamic MPU regions */
 #ifdef CONFIG_AARCH32_ARMV8_R
 	arm_core_mpu_disable();
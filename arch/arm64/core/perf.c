@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief ARM64 sampling of the interrupted context for perf
+ */
+
+#include <zephyr/kernel.h>
+
+size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size)
+{
+	const z_arch_esf_t *esf;
+
+	if (size < 2U) {
+		return 0;
+	}
+
+	/* A nested interrupt preempted another ISR, not a thread */
+	if (_current_cpu->nested != 1U) {
+		return 0;
+	}
+
+	/* _isr_wrapper saves the stack pointer of the interrupted thread,
+	 * which points to its exception stack frame, on top of the IRQ stack.
+	 */
+	esf = *(const z_arch_esf_t **)(_current_cpu->irq_stack - 16);
+
+	buf[0] = esf->elr;
+	buf[1] = esf->lr;
+
+	return 2;
+}
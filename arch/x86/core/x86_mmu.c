@@ -893,6 +893,11 @@ static inline bool atomic_pte_cas(pentry_t *target, pentry_t old_value,
  */
 #define OPTION_FLUSH		BIT(1)
 
+/* Beyond this many pages, flushing the whole TLB once is cheaper than
+ * flushing each page of the range.
+ */
+#define FLUSH_ALL_PAGES		32
+
 /* Indicates that each PTE's permission bits should be restored to their
  * original state when the memory was mapped. All other bits in the PTE are
  * preserved.
@@ -1160,6 +1165,9 @@ __pinned_func
 static int range_map(void *virt, uintptr_t phys, size_t size,
 		     pentry_t entry_flags, pentry_t mask, uint32_t options)
 {
+	bool flush = (options & OPTION_FLUSH) != 0U;
+	bool flush_all = flush &&
+			 (size > (FLUSH_ALL_PAGES * CONFIG_MMU_PAGE_SIZE));
 	int ret = 0, ret2;
 
 	LOG_DBG("%s: %p -> %p (%zu) flags " PRI_ENTRY " mask "
@@ -1189,6 +1197,10 @@ static int range_map(void *virt, uintptr_t phys, size_t size,
 	 *
 	 * Any new mappings need to be applied to all page tables.
 	 */
+	if (flush_all) {
+		options &= ~OPTION_FLUSH;
+	}
+
 #if defined(CONFIG_USERSPACE) && !defined(CONFIG_X86_COMMON_PAGE_TABLE)
 	sys_snode_t *node;
 
@@ -1213,9 +1225,14 @@ static int range_map(void *virt, uintptr_t phys, size_t size,
 		ret = ret2;
 	}
 
+	if (flush_all) {
+		/* No mapping is global, reloading CR3 flushes all of them */
+		z_x86_cr3_set(z_x86_cr3_get());
+	}
+
 out:
 #ifdef CONFIG_SMP
-	if ((options & OPTION_FLUSH) != 0U) {
+	if (flush) {
 		tlb_shootdown();
 	}
 #endif /* CONFIG_SMP */
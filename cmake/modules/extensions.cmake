@@ -680,6 +680,46 @@ function(generate_inc_file_for_target
   generate_inc_file_for_gen_target(${target} ${source_file} ${generated_file} ${generated_target_name} ${ARGN})
 endfunction()
 
+# Generate a read-only image file system (rofs) from 'source_dir' and
+# convert it to 'generated_file', to be included in a constant array
+# mounted with type FS_ROFS, see include/zephyr/fs/rofs.h.
+#
+# Optional arguments:
+#   ALIGN <n>: alignment in bytes of the file contents in the image.
+#
+# Example:
+#   generate_rofs_image_for_target(app assets
+#     ${ZEPHYR_BINARY_DIR}/include/generated/assets.rofs.inc ALIGN 16)
+function(generate_rofs_image_for_target
+    target          # The cmake target that depends on the generated file
+    source_dir      # The directory to generate the image from
+    generated_file  # The generated file
+    )
+  cmake_parse_arguments(ROFS "" "ALIGN" "" ${ARGN})
+  if(NOT DEFINED ROFS_ALIGN)
+    set(ROFS_ALIGN 4)
+  endif()
+
+  get_filename_component(source_dir ${source_dir} ABSOLUTE)
+  file(GLOB_RECURSE source_files CONFIGURE_DEPENDS LIST_DIRECTORIES true
+    ${source_dir}/*
+  )
+  set(image_file ${generated_file}.bin)
+
+  add_custom_command(
+    OUTPUT ${image_file}
+    COMMAND
+    ${PYTHON_EXECUTABLE}
+    ${ZEPHYR_BASE}/scripts/build/gen_rofs_image.py
+    --input-dir ${source_dir}
+    --output ${image_file}
+    --align ${ROFS_ALIGN}
+    DEPENDS ${source_files} ${ZEPHYR_BASE}/scripts/build/gen_rofs_image.py
+    )
+
+  generate_inc_file_for_target(${target} ${image_file} ${generated_file})
+endfunction()
+
 # 1.4. board_*
 #
 # This section is for extensions related to Zephyr board handling.
@@ -1327,9 +1367,12 @@ endmacro()
 # - NOCOPY: this flag indicates that the file data does not need to be copied
 #   at boot time (For example, for flash XIP).
 # - PHDR [program_header]: add program header. Used on Xtensa platforms.
+# - FILTER [regex]: only relocate the sections whose name matches the Python
+#   regular expression, for example "^.text.k_sem_" to only relocate the
+#   functions starting with k_sem_. The expression must not contain ":" or "|".
 function(zephyr_code_relocate)
   set(options NOCOPY)
-  set(single_args LIBRARY LOCATION PHDR)
+  set(single_args LIBRARY LOCATION PHDR FILTER)
   set(multi_args FILES)
   cmake_parse_arguments(CODE_REL "${options}" "${single_args}"
     "${multi_args}" ${ARGN})
@@ -1395,6 +1438,9 @@ function(zephyr_code_relocate)
   if(CODE_REL_PHDR)
     set(CODE_REL_LOCATION "${CODE_REL_LOCATION}\ :${CODE_REL_PHDR}")
   endif()
+  if(CODE_REL_FILTER MATCHES "[:|]")
+    message(FATAL_ERROR "zephyr_code_relocate() FILTER must not contain ':' or '|'")
+  endif()
   # We use the "|" character to separate code relocation directives instead
   # of using CMake lists. This way, the ";" character can be reserved for
   # generator expression file lists.
@@ -1402,7 +1448,7 @@ function(zephyr_code_relocate)
     PROPERTY COMPILE_DEFINITIONS)
   set_property(TARGET code_data_relocation_target
     PROPERTY COMPILE_DEFINITIONS
-    "${code_rel_str}|${CODE_REL_LOCATION}:${copy_flag}:${file_list}")
+    "${code_rel_str}|${CODE_REL_LOCATION}:${copy_flag}:${CODE_REL_FILTER}:${file_list}")
 endfunction()
 
 # Usage:
@@ -13,6 +13,7 @@
 #include <zephyr/drivers/can.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/math_extras.h>
 
 LOG_MODULE_REGISTER(can_loopback, CONFIG_CAN_LOG_LEVEL);
 
@@ -28,8 +29,13 @@ struct can_loopback_filter {
 	struct can_filter filter;
 };
 
+#define FILTER_MAP_WORDS DIV_ROUND_UP(CONFIG_CAN_MAX_FILTER, 32)
+
 struct can_loopback_data {
 	struct can_loopback_filter filters[CONFIG_CAN_MAX_FILTER];
+	/* Filters in use by ID type, frames are only matched against these */
+	uint32_t std_filter_map[FILTER_MAP_WORDS];
+	uint32_t ext_filter_map[FILTER_MAP_WORDS];
 	struct k_mutex mtx;
 	struct k_msgq tx_msgq;
 	char msgq_buffer[CONFIG_CAN_LOOPBACK_TX_MSGQ_SIZE * sizeof(struct can_loopback_frame)];
@@ -58,12 +64,18 @@ static void receive_frame(const struct device *dev,
 	filter->rx_cb(dev, &frame_tmp, filter->cb_arg);
 }
 
+static inline uint32_t *get_filter_map(struct can_loopback_data *data, bool ide)
+{
+	return ide ? data->ext_filter_map : data->std_filter_map;
+}
+
 static void tx_thread(void *arg1, void *arg2, void *arg3)
 {
 	const struct device *dev = arg1;
 	struct can_loopback_data *data = dev->data;
 	struct can_loopback_frame frame;
 	struct can_loopback_filter *filter;
+	uint32_t *filter_map;
 	int ret;
 
 	ARG_UNUSED(arg2);
@@ -83,11 +95,22 @@ static void tx_thread(void *arg1, void *arg2, void *arg3)
 
 		k_mutex_lock(&data->mtx, K_FOREVER);
 
-		for (int i = 0; i < CONFIG_CAN_MAX_FILTER; i++) {
-			filter = &data->filters[i];
-			if (filter->rx_cb != NULL &&
-			    can_frame_matches_filter(&frame.frame, &filter->filter)) {
-				receive_frame(dev, &frame.frame, filter);
+		filter_map = get_filter_map(data, (frame.frame.flags & CAN_FRAME_IDE) != 0);
+
+		for (int word = 0; word < FILTER_MAP_WORDS; word++) {
+			uint32_t pending = filter_map[word];
+
+			while (pending != 0U) {
+				int i = word * 32 + u32_count_trailing_zeros(pending);
+
+				pending &= pending - 1U;
+				filter = &data->filters[i];
+
+				/* Callbacks may have removed the filter */
+				if (filter->rx_cb != NULL &&
+				    can_frame_matches_filter(&frame.frame, &filter->filter)) {
+					receive_frame(dev, &frame.frame, filter);
+				}
 			}
 		}
 
@@ -200,6 +223,8 @@ static int can_loopback_add_rx_filter(const struct device *dev, can_rx_callback_
 	loopback_filter->rx_cb = cb;
 	loopback_filter->cb_arg = cb_arg;
 	loopback_filter->filter = *filter;
+	get_filter_map(data, (filter->flags & CAN_FILTER_IDE) != 0)[filter_id / 32] |=
+		BIT(filter_id % 32);
 	k_mutex_unlock(&data->mtx);
 
 	LOG_DBG("Filter added. ID: %d", filter_id);
@@ -219,6 +244,8 @@ static void can_loopback_remove_rx_filter(const struct device *dev, int filter_i
 	LOG_DBG("Remove filter ID: %d", filter_id);
 	k_mutex_lock(&data->mtx, K_FOREVER);
 	data->filters[filter_id].rx_cb = NULL;
+	data->std_filter_map[filter_id / 32] &= ~BIT(filter_id % 32);
+	data->ext_filter_map[filter_id / 32] &= ~BIT(filter_id % 32);
 	k_mutex_unlock(&data->mtx);
 }
 
@@ -439,6 +466,9 @@ static int can_loopback_init(const struct device *dev)
 		data->filters[i].rx_cb = NULL;
 	}
 
+	memset(data->std_filter_map, 0, sizeof(data->std_filter_map));
+	memset(data->ext_filter_map, 0, sizeof(data->ext_filter_map));
+
 	k_msgq_init(&data->tx_msgq, data->msgq_buffer, sizeof(struct can_loopback_frame),
 		    CONFIG_CAN_LOOPBACK_TX_MSGQ_SIZE);
 
@@ -19,10 +19,17 @@ struct ili9xxx_data {
 	uint8_t bytes_per_pixel;
 	enum display_pixel_format pixel_format;
 	enum display_orientation orientation;
+	/* Held for each access to the bus, until the end of an asynchronous write */
+	struct k_sem lock;
+#ifdef CONFIG_SPI_ASYNC
+	const struct device *dev;
+	display_write_cb_t write_cb;
+	void *write_user_data;
+#endif
 };
 
-int ili9xxx_transmit(const struct device *dev, uint8_t cmd, const void *tx_data,
-		     size_t tx_len)
+static int ili9xxx_transmit_unlocked(const struct device *dev, uint8_t cmd,
+				     const void *tx_data, size_t tx_len)
 {
 	const struct ili9xxx_config *config = dev->config;
 
@@ -55,6 +62,19 @@ int ili9xxx_transmit(const struct device *dev, uint8_t cmd, const void *tx_data,
 	return 0;
 }
 
+int ili9xxx_transmit(const struct device *dev, uint8_t cmd, const void *tx_data,
+		     size_t tx_len)
+{
+	struct ili9xxx_data *data = dev->data;
+	int r;
+
+	k_sem_take(&data->lock, K_FOREVER);
+	r = ili9xxx_transmit_unlocked(dev, cmd, tx_data, tx_len);
+	k_sem_give(&data->lock);
+
+	return r;
+}
+
 static int ili9xxx_exit_sleep(const struct device *dev)
 {
 	int r;
@@ -93,14 +113,14 @@ static int ili9xxx_set_mem_area(const struct device *dev, const uint16_t x,
 
 	spi_data[0] = sys_cpu_to_be16(x);
 	spi_data[1] = sys_cpu_to_be16(x + w - 1U);
-	r = ili9xxx_transmit(dev, ILI9XXX_CASET, &spi_data[0], 4U);
+	r = ili9xxx_transmit_unlocked(dev, ILI9XXX_CASET, &spi_data[0], 4U);
 	if (r < 0) {
 		return r;
 	}
 
 	spi_data[0] = sys_cpu_to_be16(y);
 	spi_data[1] = sys_cpu_to_be16(y + h - 1U);
-	r = ili9xxx_transmit(dev, ILI9XXX_PASET, &spi_data[0], 4U);
+	r = ili9xxx_transmit_unlocked(dev, ILI9XXX_PASET, &spi_data[0], 4U);
 	if (r < 0) {
 		return r;
 	}
@@ -108,10 +128,10 @@ static int ili9xxx_set_mem_area(const struct device *dev, const uint16_t x,
 	return 0;
 }
 
-static int ili9xxx_write(const struct device *dev, const uint16_t x,
-			 const uint16_t y,
-			 const struct display_buffer_descriptor *desc,
-			 const void *buf)
+static int ili9xxx_write_unlocked(const struct device *dev, const uint16_t x,
+				  const uint16_t y,
+				  const struct display_buffer_descriptor *desc,
+				  const void *buf)
 {
 	const struct ili9xxx_config *config = dev->config;
 	struct ili9xxx_data *data = dev->data;
@@ -144,8 +164,8 @@ static int ili9xxx_write(const struct device *dev, const uint16_t x,
 		nbr_of_writes = 1U;
 	}
 
-	r = ili9xxx_transmit(dev, ILI9XXX_RAMWR, write_data_start,
-			     desc->width * data->bytes_per_pixel * write_h);
+	r = ili9xxx_transmit_unlocked(dev, ILI9XXX_RAMWR, write_data_start,
+				      desc->width * data->bytes_per_pixel * write_h);
 	if (r < 0) {
 		return r;
 	}
@@ -169,6 +189,91 @@ static int ili9xxx_write(const struct device *dev, const uint16_t x,
 	return 0;
 }
 
+static int ili9xxx_write(const struct device *dev, const uint16_t x,
+			 const uint16_t y,
+			 const struct display_buffer_descriptor *desc,
+			 const void *buf)
+{
+	struct ili9xxx_data *data = dev->data;
+	int r;
+
+	k_sem_take(&data->lock, K_FOREVER);
+	r = ili9xxx_write_unlocked(dev, x, y, desc, buf);
+	k_sem_give(&data->lock);
+
+	return r;
+}
+
+#ifdef CONFIG_SPI_ASYNC
+static void ili9xxx_write_done(const struct device *spi_dev, int result,
+			       void *user_data)
+{
+	struct ili9xxx_data *data = user_data;
+	display_write_cb_t cb = data->write_cb;
+
+	k_sem_give(&data->lock);
+
+	cb(data->dev, result, data->write_user_data);
+}
+
+static int ili9xxx_write_async(const struct device *dev, const uint16_t x,
+			       const uint16_t y,
+			       const struct display_buffer_descriptor *desc,
+			       const void *buf, display_write_cb_t cb,
+			       void *user_data)
+{
+	const struct ili9xxx_config *config = dev->config;
+	struct ili9xxx_data *data = dev->data;
+	const struct spi_driver_api *spi_api = config->spi.bus->api;
+	struct spi_buf tx_buf = {
+		.buf = (void *)buf,
+		.len = desc->width * data->bytes_per_pixel * desc->height,
+	};
+	struct spi_buf_set tx_bufs = { .buffers = &tx_buf, .count = 1U };
+	int r;
+
+	k_sem_take(&data->lock, K_FOREVER);
+
+	if (desc->pitch > desc->width || spi_api->transceive_async == NULL) {
+		/* Rows aren't contiguous or the SPI driver is synchronous only */
+		r = ili9xxx_write_unlocked(dev, x, y, desc, buf);
+		k_sem_give(&data->lock);
+		if (r == 0) {
+			cb(dev, 0, user_data);
+		}
+
+		return r;
+	}
+
+	r = ili9xxx_set_mem_area(dev, x, y, desc->width, desc->height);
+	if (r < 0) {
+		goto out;
+	}
+
+	r = ili9xxx_transmit_unlocked(dev, ILI9XXX_RAMWR, NULL, 0);
+	if (r < 0) {
+		goto out;
+	}
+
+	data->dev = dev;
+	data->write_cb = cb;
+	data->write_user_data = user_data;
+
+	gpio_pin_set_dt(&config->cmd_data, ILI9XXX_DATA);
+
+	/* The lock is released once the pixel data is sent */
+	r = spi_transceive_cb(config->spi.bus, &config->spi.config, &tx_bufs,
+			      NULL, ili9xxx_write_done, data);
+
+out:
+	if (r < 0) {
+		k_sem_give(&data->lock);
+	}
+
+	return r;
+}
+#endif /* CONFIG_SPI_ASYNC */
+
 static int ili9xxx_read(const struct device *dev, const uint16_t x,
 			const uint16_t y,
 			const struct display_buffer_descriptor *desc, void *buf)
@@ -361,8 +466,11 @@ static int ili9xxx_init(const struct device *dev)
 {
 	const struct ili9xxx_config *config = dev->config;
 
+	struct ili9xxx_data *data = dev->data;
 	int r;
 
+	k_sem_init(&data->lock, 1, 1);
+
 	if (!spi_is_ready_dt(&config->spi)) {
 		LOG_ERR("SPI device is not ready");
 		return -ENODEV;
@@ -430,6 +538,9 @@ static const struct display_driver_api ili9xxx_api = {
 	.get_capabilities = ili9xxx_get_capabilities,
 	.set_pixel_format = ili9xxx_set_pixel_format,
 	.set_orientation = ili9xxx_set_orientation,
+#ifdef CONFIG_SPI_ASYNC
+	.write_async = ili9xxx_write_async,
+#endif
 };
 
 #ifdef CONFIG_ILI9340
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/cache.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/dma.h>
+#include <zephyr/drivers/dma/dma_memcpy.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
+
+LOG_MODULE_REGISTER(dma_memcpy, CONFIG_DMA_LOG_LEVEL);
+
+struct dma_memcpy_copy {
+	uint32_t channel;
+	/* Start of the destination, for the cache invalidation */
+	uint8_t *dst_start;
+	size_t len;
+	/* Part not given to the DMA yet */
+	uint8_t *dst;
+	const uint8_t *src;
+	size_t remaining;
+	dma_memcpy_callback_t cb;
+	void *user_data;
+	struct dma_config cfg;
+	struct dma_block_config blocks[CONFIG_DMA_MEMCPY_MAX_BLOCKS];
+};
+
+static const struct device *const dma_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_dma_memcpy));
+
+static struct dma_memcpy_copy copies[CONFIG_DMA_MEMCPY_MAX_COPIES];
+static ATOMIC_DEFINE(copies_busy, CONFIG_DMA_MEMCPY_MAX_COPIES);
+
+/* Number of blocks the controller takes at once, 0 until queried */
+static uint32_t max_blocks;
+
+static struct dma_memcpy_copy *copy_get(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(copies); i++) {
+		if (!atomic_test_and_set_bit(copies_busy, i)) {
+			return &copies[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void copy_put(struct dma_memcpy_copy *copy)
+{
+	atomic_clear_bit(copies_busy, copy - copies);
+}
+
+static uint32_t copy_max_blocks(void)
+{
+	uint32_t value;
+
+	if (max_blocks == 0) {
+		if (dma_get_attribute(dma_dev, DMA_ATTR_MAX_BLOCK_COUNT, &value) != 0 ||
+		    value == 0) {
+			value = 1;
+		}
+
+		max_blocks = MIN(value, CONFIG_DMA_MEMCPY_MAX_BLOCKS);
+	}
+
+	return max_blocks;
+}
+
+/* Give the DMA the next chain of blocks of the copy */
+static int copy_start(struct dma_memcpy_copy *copy)
+{
+	uint32_t width = copy->cfg.source_data_size;
+	size_t block_max = ROUND_DOWN(CONFIG_DMA_MEMCPY_MAX_BLOCK_SIZE, width);
+	uint32_t count = 0;
+	int err;
+
+	while (copy->remaining > 0 && count < copy_max_blocks()) {
+		struct dma_block_config *block = &copy->blocks[count];
+		size_t chunk = MIN(copy->remaining, block_max);
+
+		*block = (struct dma_block_config){
+			.source_address = (uintptr_t)copy->src,
+			.dest_address = (uintptr_t)copy->dst,
+			.block_size = chunk,
+		};
+
+		if (count > 0) {
+			copy->blocks[count - 1].next_block = block;
+		}
+
+		copy->src += chunk;
+		copy->dst += chunk;
+		copy->remaining -= chunk;
+		count++;
+	}
+
+	copy->cfg.block_count = count;
+	copy->cfg.head_block = &copy->blocks[0];
+
+	err = dma_config(dma_dev, copy->channel, &copy->cfg);
+	if (err != 0) {
+		return err;
+	}
+
+	return dma_start(dma_dev, copy->channel);
+}
+
+static void copy_done(struct dma_memcpy_copy *copy, int status)
+{
+	dma_memcpy_callback_t cb = copy->cb;
+	void *user_data = copy->user_data;
+
+	(void)sys_cache_data_invd_range(copy->dst_start, copy->len);
+
+	dma_release_channel(dma_dev, copy->channel);
+	copy_put(copy);
+
+	if (cb != NULL) {
+		cb(user_data, status);
+	}
+}
+
+static void dma_memcpy_dma_callback(const struct device *dev, void *user_data, uint32_t channel,
+				    int status)
+{
+	struct dma_memcpy_copy *copy = user_data;
+
+	if (status < 0) {
+		LOG_ERR("Copy failed on channel %u (%d)", channel, status);
+		copy_done(copy, status);
+		return;
+	}
+
+	if (copy->remaining > 0) {
+		/* Longer than a chain of blocks, continue with the next one */
+		status = copy_start(copy);
+		if (status == 0) {
+			return;
+		}
+	}
+
+	copy_done(copy, status);
+}
+
+static int cpu_copy(void *dst, const void *src, size_t len, dma_memcpy_callback_t cb,
+		    void *user_data)
+{
+	memcpy(dst, src, len);
+
+	if (cb != NULL) {
+		cb(user_data, 0);
+	}
+
+	return 0;
+}
+
+int dma_memcpy_async(void *dst, const void *src, size_t len, dma_memcpy_callback_t cb,
+		     void *user_data)
+{
+	struct dma_memcpy_copy *copy;
+	uintptr_t align = (uintptr_t)dst | (uintptr_t)src | len;
+	int channel;
+	int err;
+
+	if (len < CONFIG_DMA_MEMCPY_THRESHOLD || !device_is_ready(dma_dev)) {
+		return cpu_copy(dst, src, len, cb, user_data);
+	}
+
+	copy = copy_get();
+	if (copy == NULL) {
+		return cpu_copy(dst, src, len, cb, user_data);
+	}
+
+	channel = dma_request_channel(dma_dev, NULL);
+	if (channel < 0) {
+		copy_put(copy);
+		return cpu_copy(dst, src, len, cb, user_data);
+	}
+
+	copy->channel = channel;
+	copy->dst_start = dst;
+	copy->len = len;
+	copy->dst = dst;
+	copy->src = src;
+	copy->remaining = len;
+	copy->cb = cb;
+	copy->user_data = user_data;
+
+	copy->cfg = (struct dma_config){
+		.channel_direction = MEMORY_TO_MEMORY,
+		.error_callback_en = 1,
+		.user_data = copy,
+		.dma_callback = dma_memcpy_dma_callback,
+	};
+
+	/* Widest transfer allowed by the alignment of both buffers and the length */
+	if ((align & 0x3) == 0) {
+		copy->cfg.source_data_size = 4;
+	} else if ((align & 0x1) == 0) {
+		copy->cfg.source_data_size = 2;
+	} else {
+		copy->cfg.source_data_size = 1;
+	}
+	copy->cfg.dest_data_size = copy->cfg.source_data_size;
+	copy->cfg.source_burst_length = copy->cfg.source_data_size;
+	copy->cfg.dest_burst_length = copy->cfg.source_data_size;
+
+	(void)sys_cache_data_flush_range((void *)src, len);
+	/* Dirty lines of the destination must not be written back over the copy */
+	(void)sys_cache_data_flush_and_invd_range(dst, len);
+
+	err = copy_start(copy);
+	if (err != 0) {
+		LOG_WRN("Failed to start copy on channel %d (%d)", channel, err);
+		dma_release_channel(dma_dev, channel);
+		copy_put(copy);
+		return cpu_copy(dst, src, len, cb, user_data);
+	}
+
+	return 0;
+}
+
+struct dma_memcpy_sync {
+	struct k_sem sem;
+	int status;
+};
+
+static void dma_memcpy_sync_callback(void *user_data, int status)
+{
+	struct dma_memcpy_sync *sync = user_data;
+
+	sync->status = status;
+	k_sem_give(&sync->sem);
+}
+
+int dma_memcpy(void *dst, const void *src, size_t len)
+{
+	struct dma_memcpy_sync sync;
+	int err;
+
+	__ASSERT(!k_is_in_isr(), "Blocking copy from an interrupt");
+
+	k_sem_init(&sync.sem, 0, 1);
+
+	err = dma_memcpy_async(dst, src, len, dma_memcpy_sync_callback, &sync);
+	if (err != 0) {
+		return err;
+	}
+
+	(void)k_sem_take(&sync.sem, K_FOREVER);
+
+	return sync.status;
+}
@@ -80,6 +80,12 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 
 #define ETH_DMA_TX_TIMEOUT_MS	20U  /* transmit timeout in milliseconds */
 
+#if defined(CONFIG_SOC_SERIES_STM32H7X) || defined(CONFIG_SOC_SERIES_STM32H5X)
+#define ETH_STM32_DMA_IT_RX	ETH_DMACIER_RIE
+#else
+#define ETH_STM32_DMA_IT_RX	ETH_DMAIER_RIE
+#endif /* CONFIG_SOC_SERIES_STM32H7X || CONFIG_SOC_SERIES_STM32H5X */
+
 #if defined(CONFIG_ETH_STM32_HAL_USE_DTCM_FOR_DMA_BUFFER) && \
 	    DT_NODE_HAS_STATUS(DT_CHOSEN(zephyr_dtcm), okay)
 #define __eth_stm32_desc __dtcm_noinit_section
@@ -97,7 +103,9 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME);
 
 static ETH_DMADescTypeDef dma_rx_desc_tab[ETH_RXBUFNB] __eth_stm32_desc;
 static ETH_DMADescTypeDef dma_tx_desc_tab[ETH_TXBUFNB] __eth_stm32_desc;
+#if !defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
 static uint8_t dma_rx_buffer[ETH_RXBUFNB][ETH_STM32_RX_BUF_SIZE] __eth_stm32_buf;
+#endif /* !CONFIG_ETH_STM32_HAL_RX_ZERO_COPY */
 static uint8_t dma_tx_buffer[ETH_TXBUFNB][ETH_STM32_TX_BUF_SIZE] __eth_stm32_buf;
 
 #if defined(CONFIG_ETH_STM32_MULTICAST_FILTER)
@@ -120,11 +128,13 @@ static struct in_addr multicast_ipv4_joined_addrs[NET_IF_MAX_IPV4_MADDR] = {0};
 
 BUILD_ASSERT(ETH_STM32_RX_BUF_SIZE % 4 == 0, "Rx buffer size must be a multiple of 4");
 
+#if !defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
 struct eth_stm32_rx_buffer_header {
 	struct eth_stm32_rx_buffer_header *next;
 	uint16_t size;
 	bool used;
 };
+#endif /* !CONFIG_ETH_STM32_HAL_RX_ZERO_COPY */
 
 struct eth_stm32_tx_buffer_header {
 	ETH_BufferTypeDef tx_buff;
@@ -136,9 +146,92 @@ struct eth_stm32_tx_context {
 	uint16_t first_tx_buffer_index;
 };
 
-static struct eth_stm32_rx_buffer_header dma_rx_buffer_header[ETH_RXBUFNB];
 static struct eth_stm32_tx_buffer_header dma_tx_buffer_header[ETH_TXBUFNB];
 
+/* Pointer to an array of ETH_STM32_RX_BUF_SIZE uint8_t's */
+typedef uint8_t (*RxBufferPtr)[ETH_STM32_RX_BUF_SIZE];
+
+#if defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
+
+BUILD_ASSERT(CONFIG_ETH_STM32_HAL_RX_BUF_COUNT > ETH_RXBUFNB,
+	     "RX buffers are needed beyond the ones owned by the RX descriptors");
+
+static void rx_buf_destroy(struct net_buf *buf);
+
+/* The DMA writes the frames straight into these buffers */
+NET_BUF_POOL_FIXED_DEFINE_IN_SECTION(rx_buf_pool, CONFIG_ETH_STM32_HAL_RX_BUF_COUNT,
+				     ETH_STM32_RX_BUF_SIZE, CONFIG_NET_PKT_BUF_USER_DATA_SIZE,
+				     rx_buf_destroy, __eth_stm32_buf);
+
+/* Buffers given to the RX descriptors, by index in the pool */
+static struct net_buf *rx_bufs[CONFIG_ETH_STM32_HAL_RX_BUF_COUNT];
+
+/* Set while an RX descriptor is left without a buffer */
+static atomic_t rx_buf_starved;
+
+static void rx_buf_destroy(struct net_buf *buf)
+{
+	const struct device *dev = DEVICE_DT_INST_GET(0);
+	struct eth_stm32_hal_dev_data *dev_data = dev->data;
+
+	net_buf_destroy(buf);
+
+	/* Let the RX thread give the buffer to the descriptor missing one */
+	if (atomic_clear(&rx_buf_starved)) {
+		k_sem_give(&dev_data->rx_int_sem);
+	}
+}
+
+void HAL_ETH_RxAllocateCallback(uint8_t **buf)
+{
+	struct net_buf *rx_buf;
+
+	/* Set before trying, so that a buffer released meanwhile isn't missed */
+	atomic_set(&rx_buf_starved, 1);
+
+	rx_buf = net_buf_alloc(&rx_buf_pool, K_NO_WAIT);
+	if (rx_buf == NULL) {
+		*buf = NULL;
+		return;
+	}
+
+	atomic_clear(&rx_buf_starved);
+
+	rx_bufs[net_buf_id(rx_buf)] = rx_buf;
+	*buf = rx_buf->data;
+}
+
+/* called by HAL_ETH_ReadData() */
+void HAL_ETH_RxLinkCallback(void **pStart, void **pEnd, uint8_t *buff, uint16_t Length)
+{
+	/* buff points to the begin of one of the pool buffers,
+	 * so we can compute the index of the given buffer
+	 */
+	size_t index = (RxBufferPtr)buff - &net_buf_data_rx_buf_pool[0];
+	struct net_buf *rx_buf;
+
+	__ASSERT_NO_MSG(index < CONFIG_ETH_STM32_HAL_RX_BUF_COUNT);
+
+	rx_buf = rx_bufs[index];
+	rx_bufs[index] = NULL;
+	net_buf_add(rx_buf, Length);
+
+	if (!*pStart) {
+		/* first buffer of the frame, head of the fragment chain */
+		*pStart = rx_buf;
+		*pEnd = rx_buf;
+	} else {
+		__ASSERT_NO_MSG(*pEnd != NULL);
+		/* not the first buffer, append to the chain */
+		net_buf_frag_insert(*pEnd, rx_buf);
+		*pEnd = rx_buf;
+	}
+}
+
+#else
+
+static struct eth_stm32_rx_buffer_header dma_rx_buffer_header[ETH_RXBUFNB];
+
 void HAL_ETH_RxAllocateCallback(uint8_t **buf)
 {
 	for (size_t i = 0; i < ETH_RXBUFNB; ++i) {
@@ -153,9 +246,6 @@ void HAL_ETH_RxAllocateCallback(uint8_t **buf)
 	*buf = NULL;
 }
 
-/* Pointer to an array of ETH_STM32_RX_BUF_SIZE uint8_t's */
-typedef uint8_t (*RxBufferPtr)[ETH_STM32_RX_BUF_SIZE];
-
 /* called by HAL_ETH_ReadData() */
 void HAL_ETH_RxLinkCallback(void **pStart, void **pEnd, uint8_t *buff, uint16_t Length)
 {
@@ -181,6 +271,8 @@ void HAL_ETH_RxLinkCallback(void **pStart, void **pEnd, uint8_t *buff, uint16_t
 	}
 }
 
+#endif /* CONFIG_ETH_STM32_HAL_RX_ZERO_COPY */
+
 /* Called by HAL_ETH_ReleaseTxPacket */
 void HAL_ETH_TxFreeCallback(uint32_t *buff)
 {
@@ -630,10 +722,14 @@ static struct net_pkt *eth_rx(const struct device *dev, uint16_t *vlan_tag)
 	struct eth_stm32_hal_dev_data *dev_data;
 	ETH_HandleTypeDef *heth;
 	struct net_pkt *pkt;
+#if !defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
 	size_t total_len = 0;
+#endif /* !CONFIG_ETH_STM32_HAL_RX_ZERO_COPY */
 #if defined(CONFIG_ETH_STM32_HAL_API_V2)
 	void *appbuf = NULL;
+#if !defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
 	struct eth_stm32_rx_buffer_header *rx_header;
+#endif /* !CONFIG_ETH_STM32_HAL_RX_ZERO_COPY */
 #else
 #if !defined(CONFIG_SOC_SERIES_STM32H7X) && !defined(CONFIG_SOC_SERIES_STM32H5X)
 	__IO ETH_DMADescTypeDef *dma_rx_desc;
@@ -665,11 +761,13 @@ static struct net_pkt *eth_rx(const struct device *dev, uint16_t *vlan_tag)
 		return NULL;
 	}
 
+#if !defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
 	/* computing total length */
 	for (rx_header = (struct eth_stm32_rx_buffer_header *)appbuf;
 			rx_header; rx_header = rx_header->next) {
 		total_len += rx_header->size;
 	}
+#endif /* !CONFIG_ETH_STM32_HAL_RX_ZERO_COPY */
 #elif defined(CONFIG_SOC_SERIES_STM32H7X) || defined(CONFIG_SOC_SERIES_STM32H5X)
 	if (HAL_ETH_IsRxDataAvailable(heth) != true) {
 		/* no frame available */
@@ -756,6 +854,18 @@ static struct net_pkt *eth_rx(const struct device *dev, uint16_t *vlan_tag)
 #endif /* CONFIG_SOC_SERIES_STM32H7X || CONFIG_SOC_SERIES_STM32H5X */
 #endif /* CONFIG_PTP_CLOCK_STM32_HAL */
 
+#if defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
+	pkt = net_pkt_rx_alloc_on_iface(get_iface(dev_data, *vlan_tag), K_MSEC(100));
+	if (!pkt) {
+		LOG_ERR("Failed to obtain RX packet");
+		/* Drop the frame, its buffers go back to the pool */
+		net_buf_unref(appbuf);
+		goto release_desc;
+	}
+
+	/* The frame was received in the pool buffers, hand them over as is */
+	net_pkt_append_buffer(pkt, appbuf);
+#else
 	pkt = net_pkt_rx_alloc_with_buffer(get_iface(dev_data, *vlan_tag),
 					   total_len, AF_UNSPEC, 0, K_MSEC(100));
 	if (!pkt) {
@@ -784,9 +894,12 @@ static struct net_pkt *eth_rx(const struct device *dev, uint16_t *vlan_tag)
 		goto release_desc;
 	}
 #endif /* CONFIG_ETH_STM32_HAL_API_V2 */
+#endif /* CONFIG_ETH_STM32_HAL_RX_ZERO_COPY */
 
 release_desc:
-#if defined(CONFIG_ETH_STM32_HAL_API_V2)
+#if defined(CONFIG_ETH_STM32_HAL_RX_ZERO_COPY)
+	/* The descriptors get new buffers on the next HAL_ETH_ReadData() */
+#elif defined(CONFIG_ETH_STM32_HAL_API_V2)
 	for (rx_header = (struct eth_stm32_rx_buffer_header *)appbuf;
 			rx_header; rx_header = rx_header->next) {
 		rx_header->used = false;
@@ -910,6 +1023,12 @@ static void rx_thread(void *arg1, void *unused1, void *unused2)
 					net_pkt_unref(pkt);
 				}
 			}
+#if defined(CONFIG_ETH_STM32_HAL_RX_POLL)
+			/* All pending frames processed, a frame received
+			 * meanwhile raises the interrupt as soon as unmasked.
+			 */
+			__HAL_ETH_DMA_ENABLE_IT(&dev_data->heth, ETH_STM32_DMA_IT_RX);
+#endif /* CONFIG_ETH_STM32_HAL_RX_POLL */
 		} else if (res == -EAGAIN) {
 			/* semaphore timeout period expired, check link status */
 			hal_ret = read_eth_phy_register(&dev_data->heth,
@@ -1102,6 +1221,11 @@ void HAL_ETH_RxCpltCallback(ETH_HandleTypeDef *heth_handle)
 
 	__ASSERT_NO_MSG(dev_data != NULL);
 
+#if defined(CONFIG_ETH_STM32_HAL_RX_POLL)
+	/* Masked until the RX thread has processed all pending frames */
+	__HAL_ETH_DMA_DISABLE_IT(heth_handle, ETH_STM32_DMA_IT_RX);
+#endif /* CONFIG_ETH_STM32_HAL_RX_POLL */
+
 	k_sem_give(&dev_data->rx_int_sem);
 }
 
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/flash.h>
+
+static K_FIFO_DEFINE(flash_async_fifo);
+
+int flash_async_submit(const struct device *dev, struct flash_async_op *op)
+{
+	if ((op->type != FLASH_ASYNC_READ) && (op->type != FLASH_ASYNC_WRITE) &&
+	    (op->type != FLASH_ASYNC_ERASE)) {
+		return -EINVAL;
+	}
+
+	if (!device_is_ready(dev)) {
+		return -ENODEV;
+	}
+
+	op->dev = dev;
+	k_fifo_put(&flash_async_fifo, op);
+
+	return 0;
+}
+
+static int flash_async_execute(struct flash_async_op *op)
+{
+	switch (op->type) {
+	case FLASH_ASYNC_READ:
+		return flash_read(op->dev, op->offset, op->data, op->len);
+	case FLASH_ASYNC_WRITE:
+		return flash_write(op->dev, op->offset, op->data, op->len);
+	case FLASH_ASYNC_ERASE:
+		return flash_erase(op->dev, op->offset, op->len);
+	default:
+		return -EINVAL;
+	}
+}
+
+static void flash_async_thread(void *p1, void *p2, void *p3)
+{
+	struct flash_async_op *op;
+	struct k_poll_signal *signal;
+	flash_async_cb_t cb;
+	int rc;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		op = k_fifo_get(&flash_async_fifo, K_FOREVER);
+
+		rc = flash_async_execute(op);
+
+		/* The operation may be reused as soon as it is reported */
+		cb = op->cb;
+		signal = op->signal;
+
+		if (cb != NULL) {
+			cb(op->dev, op, rc);
+		}
+
+		if (signal != NULL) {
+			k_poll_signal_raise(signal, rc);
+		}
+	}
+}
+
+K_THREAD_DEFINE(flash_async_tid, CONFIG_FLASH_ASYNC_THREAD_STACK_SIZE,
+		flash_async_thread, NULL, NULL, NULL,
+		CONFIG_FLASH_ASYNC_THREAD_PRIORITY, 0, 0);
@@ -296,6 +296,11 @@ static inline void delay_until_exit_dpd_ok(const struct device *const dev)
  */
 #define NOR_ACCESS_32BIT_ADDR BIT(2)
 
+/* Indicates that the address is followed by eight dummy clocks, sent as
+ * one byte.
+ */
+#define NOR_ACCESS_DUMMY BIT(3)
+
 /* Indicates that an access command is performing a write.  If not
  * provided access is a read.
  */
@@ -321,7 +326,7 @@ static int spi_nor_access(const struct device *const dev,
 	struct spi_nor_data *const driver_data = dev->data;
 	bool is_addressed = (access & NOR_ACCESS_ADDRESSED) != 0U;
 	bool is_write = (access & NOR_ACCESS_WRITE) != 0U;
-	uint8_t buf[5] = { 0 };
+	uint8_t buf[6] = { 0 };
 	struct spi_buf spi_buf[2] = {
 		{
 			.buf = buf,
@@ -354,6 +359,10 @@ static int spi_nor_access(const struct device *const dev,
 			memcpy(&buf[1], &addr32.u8[1], 3);
 			spi_buf[0].len += 3;
 		}
+
+		if ((access & NOR_ACCESS_DUMMY) != 0U) {
+			spi_buf[0].len += 1;
+		}
 	};
 
 	const struct spi_buf_set tx_set = {
@@ -696,7 +705,14 @@ static int spi_nor_read(const struct device *dev, off_t addr, void *dest,
 
 	acquire_device(dev);
 
-	ret = spi_nor_cmd_addr_read(dev, SPI_NOR_CMD_READ, addr, dest, size);
+	if (IS_ENABLED(CONFIG_SPI_NOR_FAST_READ)) {
+		ret = spi_nor_access(dev, SPI_NOR_CMD_READ_FAST,
+				     NOR_ACCESS_ADDRESSED | NOR_ACCESS_DUMMY,
+				     addr, dest, size);
+	} else {
+		ret = spi_nor_cmd_addr_read(dev, SPI_NOR_CMD_READ, addr, dest,
+					    size);
+	}
 
 	release_device(dev);
 	return ret;
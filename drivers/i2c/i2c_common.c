@@ -14,6 +14,8 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(i2c);
 
+PROFILING_PROBE_DEFINE(i2c_transfer);
+
 #if defined(CONFIG_I2C_CALLBACK) && defined(CONFIG_POLL)
 void z_i2c_transfer_signal_cb(const struct device *dev,
 	int result,
@@ -17,6 +17,7 @@
 #include <errno.h>
 #include <zephyr/drivers/i2c.h>
 #include <zephyr/drivers/pinctrl.h>
+#include <zephyr/rtio/rtio.h>
 #include "i2c_ll_stm32.h"
 
 #ifdef CONFIG_I2C_STM32_BUS_RECOVERY
@@ -164,6 +165,10 @@ static int i2c_stm32_transfer(const struct device *dev, struct i2c_msg *msg,
 		return ret;
 	}
 
+#ifdef CONFIG_I2C_STM32_RTIO
+	return i2c_stm32_transfer_rtio(dev, msg, num_msgs, slave);
+#endif
+
 	/* Send out messages */
 	k_sem_take(&data->bus_mutex, K_FOREVER);
 
@@ -202,6 +207,149 @@ static int i2c_stm32_transfer(const struct device *dev, struct i2c_msg *msg,
 	return ret;
 }
 
+#ifdef CONFIG_I2C_STM32_RTIO
+static void i2c_stm32_iodev_start(const struct device *dev)
+{
+	struct i2c_stm32_data *data = dev->data;
+	const struct i2c_dt_spec *dt_spec = data->txn_head->sqe.iodev->data;
+	struct rtio_iodev_sqe *next = rtio_txn_next(data->txn_curr);
+	struct i2c_msg msg, next_msg;
+	int ret;
+
+	ret = i2c_rtio_sqe_msg(data->txn_curr, &msg);
+	if (ret == 0 && next != NULL) {
+		ret = i2c_rtio_sqe_msg(next, &next_msg);
+	}
+
+	if (ret == 0) {
+		/* Send start condition for the first message */
+		if (data->txn_curr == data->txn_head) {
+			msg.flags |= I2C_MSG_RESTART;
+		}
+
+		/* Same checks as i2c_stm32_transfer() */
+		if (next != NULL && (msg.flags & I2C_MSG_STOP)) {
+			ret = -EINVAL;
+		} else if (next != NULL && OPERATION(&msg) != OPERATION(&next_msg) &&
+			   !(next_msg.flags & I2C_MSG_RESTART)) {
+			ret = -EINVAL;
+		}
+	}
+
+	if (ret != 0) {
+		i2c_stm32_iodev_msg_done(dev, ret);
+		return;
+	}
+
+	stm32_i2c_rtio_msg_start(dev, &msg, (next != NULL) ? &next_msg.flags : NULL,
+				 dt_spec->addr);
+}
+
+static void i2c_stm32_iodev_next(const struct device *dev, bool completion)
+{
+	struct i2c_stm32_data *data = dev->data;
+	struct rtio_iodev_sqe *txn;
+	struct rtio_mpsc_node *next;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&data->lock);
+
+	if (!completion && data->txn_curr != NULL) {
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+
+	next = rtio_mpsc_pop(&data->iodev.iodev_sq);
+	txn = (next != NULL) ? CONTAINER_OF(next, struct rtio_iodev_sqe, q) : NULL;
+
+	data->txn_head = txn;
+	data->txn_curr = txn;
+
+	k_spin_unlock(&data->lock, key);
+
+	if (txn != NULL) {
+		i2c_stm32_iodev_start(dev);
+	}
+}
+
+/* Called from the interrupt when a message of the transaction is done */
+void i2c_stm32_iodev_msg_done(const struct device *dev, int status)
+{
+	struct i2c_stm32_data *data = dev->data;
+	struct rtio_iodev_sqe *txn_head = data->txn_head;
+
+	if (status == 0 && (data->txn_curr->sqe.flags & RTIO_SQE_TRANSACTION)) {
+		data->txn_curr = rtio_txn_next(data->txn_curr);
+		i2c_stm32_iodev_start(dev);
+		return;
+	}
+
+	/* Transactions of other devices on the bus follow without a gap */
+	i2c_stm32_iodev_next(dev, true);
+
+	if (status == 0) {
+		rtio_iodev_sqe_ok(txn_head, 0);
+	} else {
+		rtio_iodev_sqe_err(txn_head, status);
+	}
+}
+
+static void i2c_stm32_iodev_submit(const struct device *dev,
+				   struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct i2c_stm32_data *data = dev->data;
+
+	rtio_mpsc_push(&data->iodev.iodev_sq, &iodev_sqe->q);
+	i2c_stm32_iodev_next(dev, false);
+}
+
+static int i2c_stm32_transfer_rtio(const struct device *dev, struct i2c_msg *msg,
+				   uint8_t num_msgs, uint16_t slave)
+{
+	struct i2c_stm32_data *data = dev->data;
+	struct rtio_cqe *cqe;
+	int ret = 0;
+
+	k_sem_take(&data->bus_mutex, K_FOREVER);
+
+	data->dt_spec.addr = slave;
+
+	if (i2c_rtio_copy(data->r, &data->iodev, msg, num_msgs) == NULL) {
+		LOG_ERR("Not enough submission queue entries");
+		k_sem_give(&data->bus_mutex);
+		return -ENOMEM;
+	}
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME
+	(void)pm_device_runtime_get(dev);
+#else
+	pm_device_busy_set(dev);
+#endif
+
+	/* Submit request and wait */
+	rtio_submit(data->r, num_msgs);
+
+	for (uint8_t i = 0; i < num_msgs; i++) {
+		cqe = rtio_cqe_consume(data->r);
+		if (cqe->result < 0 && ret == 0) {
+			ret = cqe->result;
+		}
+
+		rtio_cqe_release(data->r, cqe);
+	}
+
+#ifdef CONFIG_PM_DEVICE_RUNTIME
+	(void)pm_device_runtime_put(dev);
+#else
+	pm_device_busy_clear(dev);
+#endif
+
+	k_sem_give(&data->bus_mutex);
+
+	return ret;
+}
+#endif /* CONFIG_I2C_STM32_RTIO */
+
 #if CONFIG_I2C_STM32_BUS_RECOVERY
 static void i2c_stm32_bitbang_set_scl(void *io_context, int state)
 {
@@ -298,6 +446,9 @@ static const struct i2c_driver_api api_funcs = {
 	.target_register = i2c_stm32_target_register,
 	.target_unregister = i2c_stm32_target_unregister,
 #endif
+#ifdef CONFIG_I2C_STM32_RTIO
+	.iodev_submit = i2c_stm32_iodev_submit,
+#endif
 };
 
 #ifdef CONFIG_PM_DEVICE
@@ -374,6 +525,13 @@ static int i2c_stm32_init(const struct device *dev)
 	 */
 	k_sem_init(&data->bus_mutex, 1, 1);
 
+#ifdef CONFIG_I2C_STM32_RTIO
+	data->dt_spec.bus = dev;
+	data->iodev.api = &i2c_iodev_api;
+	data->iodev.data = &data->dt_spec;
+	rtio_mpsc_init(&data->iodev.iodev_sq);
+#endif
+
 	if (!device_is_ready(clk)) {
 		LOG_ERR("clock control device not ready");
 		return -ENODEV;
@@ -531,7 +689,15 @@ static const struct i2c_stm32_config i2c_stm32_cfg_##index = {		\
 	USE_TIMINGS(index)						\
 };									\
 									\
-static struct i2c_stm32_data i2c_stm32_dev_data_##index;		\
+IF_ENABLED(CONFIG_I2C_STM32_RTIO,					\
+	(RTIO_DEFINE(i2c_stm32_rtio_##index,				\
+		     CONFIG_I2C_STM32_RTIO_SQ_SIZE,			\
+		     CONFIG_I2C_STM32_RTIO_SQ_SIZE);))			\
+									\
+static struct i2c_stm32_data i2c_stm32_dev_data_##index = {		\
+	IF_ENABLED(CONFIG_I2C_STM32_RTIO,				\
+		(.r = &i2c_stm32_rtio_##index,))			\
+};									\
 									\
 PM_DEVICE_DT_INST_DEFINE(index, i2c_stm32_pm_action);			\
 									\
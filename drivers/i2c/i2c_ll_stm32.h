@@ -79,6 +79,23 @@ struct i2c_stm32_data {
 	bool slave_attached;
 #endif
 	bool is_configured;
+#ifdef CONFIG_I2C_STM32_RTIO
+	struct k_spinlock lock;
+	struct rtio *r; /* context for blocking calls */
+	struct rtio_iodev iodev;
+	struct rtio_iodev_sqe *txn_head;
+	struct rtio_iodev_sqe *txn_curr;
+	struct i2c_dt_spec dt_spec;
+	/* Submission in progress, transferred in chunks from the interrupt */
+	struct {
+		struct i2c_msg msg;
+		struct i2c_msg chunk;
+		uint8_t next_flags;
+		uint8_t combine_flags;
+		bool has_next;
+		uint16_t addr;
+	} rtio_msg;
+#endif
 };
 
 int32_t stm32_i2c_transaction(const struct device *dev,
@@ -88,6 +105,12 @@ int32_t stm32_i2c_configure_timing(const struct device *dev, uint32_t clk);
 int i2c_stm32_runtime_configure(const struct device *dev, uint32_t config);
 int i2c_stm32_get_config(const struct device *dev, uint32_t *config);
 
+#ifdef CONFIG_I2C_STM32_RTIO
+void stm32_i2c_rtio_msg_start(const struct device *dev, const struct i2c_msg *msg,
+			      const uint8_t *next_msg_flags, uint16_t periph);
+void i2c_stm32_iodev_msg_done(const struct device *dev, int status);
+#endif
+
 void stm32_i2c_event_isr(void *arg);
 void stm32_i2c_error_isr(void *arg);
 #ifdef CONFIG_I2C_STM32_COMBINED_INTERRUPT
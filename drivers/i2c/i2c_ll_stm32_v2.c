@@ -29,6 +29,8 @@ LOG_MODULE_REGISTER(i2c_ll_stm32_v2);
 
 #define STM32_I2C_TRANSFER_TIMEOUT_MSEC  500
 
+#define STM32_I2C_MAX_CHUNK_SIZE 255U
+
 static inline void msg_init(const struct device *dev, struct i2c_msg *msg,
 			    uint8_t *next_msg_flags, uint16_t slave,
 			    uint32_t transfer)
@@ -95,10 +97,95 @@ static void stm32_i2c_enable_transfer_interrupts(const struct device *dev)
 	LL_I2C_EnableIT_ERR(i2c);
 }
 
+#ifdef CONFIG_I2C_STM32_RTIO
+static void stm32_i2c_rtio_chunk_start(const struct device *dev)
+{
+	const struct i2c_stm32_config *cfg = dev->config;
+	struct i2c_stm32_data *data = dev->data;
+	I2C_TypeDef *i2c = cfg->i2c;
+	struct i2c_msg *msg = &data->rtio_msg.msg;
+	struct i2c_msg *chunk = &data->rtio_msg.chunk;
+	uint8_t *flagsp;
+
+	/* Same chunking as stm32_i2c_transaction() */
+	*chunk = *msg;
+	if (msg->len > STM32_I2C_MAX_CHUNK_SIZE) {
+		chunk->len = STM32_I2C_MAX_CHUNK_SIZE;
+		chunk->flags &= ~I2C_MSG_STOP;
+		flagsp = &data->rtio_msg.combine_flags;
+	} else {
+		flagsp = data->rtio_msg.has_next ? &data->rtio_msg.next_flags : NULL;
+	}
+	msg->buf += chunk->len;
+	msg->len -= chunk->len;
+
+	data->current.len = chunk->len;
+	data->current.buf = chunk->buf;
+	data->current.is_write = !(chunk->flags & I2C_MSG_READ);
+	data->current.is_arlo = 0U;
+	data->current.is_err = 0U;
+	data->current.is_nack = 0U;
+	data->current.msg = chunk;
+
+	msg_init(dev, chunk, flagsp, data->rtio_msg.addr,
+		 data->current.is_write ? LL_I2C_REQUEST_WRITE : LL_I2C_REQUEST_READ);
+
+	stm32_i2c_enable_transfer_interrupts(dev);
+	if (data->current.is_write) {
+		LL_I2C_EnableIT_TX(i2c);
+	} else {
+		LL_I2C_EnableIT_RX(i2c);
+	}
+}
+
+/* Start a message of a RTIO submission, completes from the interrupt */
+void stm32_i2c_rtio_msg_start(const struct device *dev, const struct i2c_msg *msg,
+			      const uint8_t *next_msg_flags, uint16_t periph)
+{
+	struct i2c_stm32_data *data = dev->data;
+
+	data->rtio_msg.msg = *msg;
+	data->rtio_msg.combine_flags = msg->flags & ~(I2C_MSG_STOP | I2C_MSG_RESTART);
+	data->rtio_msg.has_next = (next_msg_flags != NULL);
+	data->rtio_msg.next_flags = (next_msg_flags != NULL) ? *next_msg_flags : 0;
+	data->rtio_msg.addr = periph;
+
+	stm32_i2c_rtio_chunk_start(dev);
+}
+#endif /* CONFIG_I2C_STM32_RTIO */
+
+static void stm32_i2c_msg_done(const struct device *dev)
+{
+	struct i2c_stm32_data *data = dev->data;
+
+#ifdef CONFIG_I2C_STM32_RTIO
+	int status = 0;
+
+	if (data->current.is_nack || data->current.is_err ||
+	    data->current.is_arlo) {
+		LOG_DBG("%s: NACK %d ERR %d ARLO %d", __func__,
+			data->current.is_nack, data->current.is_err,
+			data->current.is_arlo);
+		status = -EIO;
+	}
+
+	if (status == 0 && data->rtio_msg.msg.len > 0U) {
+		stm32_i2c_rtio_chunk_start(dev);
+		return;
+	}
+
+	i2c_stm32_iodev_msg_done(dev, status);
+#else
+	k_sem_give(&data->device_sync_sem);
+#endif
+}
+
 static void stm32_i2c_master_mode_end(const struct device *dev)
 {
 	const struct i2c_stm32_config *cfg = dev->config;
+#if defined(CONFIG_I2C_TARGET)
 	struct i2c_stm32_data *data = dev->data;
+#endif
 	I2C_TypeDef *i2c = cfg->i2c;
 
 	stm32_i2c_disable_transfer_interrupts(dev);
@@ -115,7 +202,7 @@ static void stm32_i2c_master_mode_end(const struct device *dev)
 #else
 	LL_I2C_Disable(i2c);
 #endif
-	k_sem_give(&data->device_sync_sem);
+	stm32_i2c_msg_done(dev);
 }
 
 #if defined(CONFIG_I2C_TARGET)
@@ -393,7 +480,7 @@ static void stm32_i2c_event(const struct device *dev)
 			LL_I2C_GenerateStopCondition(i2c);
 		} else {
 			stm32_i2c_disable_transfer_interrupts(dev);
-			k_sem_give(&data->device_sync_sem);
+			stm32_i2c_msg_done(dev);
 		}
 	}
 
@@ -790,7 +877,7 @@ int stm32_i2c_transaction(const struct device *dev,
 	 * which will make the combination of all chunks to look like one big
 	 * transaction on the wire.
 	 */
-	const uint32_t i2c_stm32_maxchunk = 255U;
+	const uint32_t i2c_stm32_maxchunk = STM32_I2C_MAX_CHUNK_SIZE;
 	const uint8_t saved_flags = msg.flags;
 	uint8_t combine_flags =
 		saved_flags & ~(I2C_MSG_STOP | I2C_MSG_RESTART);
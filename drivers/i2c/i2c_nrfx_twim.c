@@ -7,6 +7,7 @@
 
 #include <zephyr/drivers/i2c.h>
 #include <zephyr/dt-bindings/i2c/i2c.h>
+#include <zephyr/rtio/rtio.h>
 #include <zephyr/pm/device.h>
 #include <zephyr/pm/device_runtime.h>
 #include <zephyr/drivers/pinctrl.h>
@@ -30,6 +31,18 @@ struct i2c_nrfx_twim_data {
 	struct k_sem completion_sync;
 	volatile nrfx_err_t res;
 	uint8_t *msg_buf;
+#ifdef CONFIG_I2C_RTIO
+	const struct device *dev;
+	struct k_spinlock lock;
+	struct rtio *r; /* context for blocking calls */
+	struct rtio_iodev iodev;
+	struct rtio_iodev_sqe *txn_head;
+	struct rtio_iodev_sqe *txn_curr;
+	/* Last submission merged into the transfer in progress */
+	struct rtio_iodev_sqe *txn_last;
+	uint16_t msg_buf_used;
+	struct i2c_dt_spec dt_spec;
+#endif
 };
 
 struct i2c_nrfx_twim_config {
@@ -43,6 +56,7 @@ struct i2c_nrfx_twim_config {
 
 static int i2c_nrfx_twim_recover_bus(const struct device *dev);
 
+#ifndef CONFIG_I2C_RTIO
 static int i2c_nrfx_twim_transfer(const struct device *dev,
 				  struct i2c_msg *msgs,
 				  uint8_t num_msgs, uint16_t addr)
@@ -204,6 +218,225 @@ static int i2c_nrfx_twim_transfer(const struct device *dev,
 
 	return ret;
 }
+#else
+static void i2c_nrfx_twim_iodev_complete(const struct device *dev, int error);
+
+static void i2c_nrfx_twim_iodev_start(const struct device *dev)
+{
+	struct i2c_nrfx_twim_data *dev_data = dev->data;
+	const struct i2c_nrfx_twim_config *dev_config = dev->config;
+	const struct i2c_dt_spec *dt_spec = dev_data->txn_head->sqe.iodev->data;
+	struct rtio_iodev_sqe *txn = dev_data->txn_curr;
+	struct rtio_iodev_sqe *next;
+	struct i2c_msg msg, next_msg;
+	uint16_t msg_buf_used = 0;
+	nrfx_twim_xfer_desc_t cur_xfer = {
+		.address = dt_spec->addr
+	};
+	nrfx_err_t res;
+	int error;
+
+	error = i2c_rtio_sqe_msg(txn, &msg);
+
+	/* Submissions are merged into one transfer in the internal driver
+	 * buffer under the same conditions as the messages of a blocking
+	 * call, see i2c_nrfx_twim_transfer().
+	 */
+	while (error == 0) {
+		if (msg.flags & I2C_MSG_ADDR_10_BITS) {
+			error = -ENOTSUP;
+			break;
+		}
+
+		next = rtio_txn_next(txn);
+
+		bool dma_accessible = nrf_dma_accessible_check(&dev_config->twim, msg.buf);
+		bool concat_next = (next != NULL)
+				&& !(msg.flags & I2C_MSG_STOP)
+				&& (i2c_rtio_sqe_msg(next, &next_msg) == 0)
+				&& !(next_msg.flags & I2C_MSG_RESTART)
+				&& ((msg.flags & I2C_MSG_READ)
+				    == (next_msg.flags & I2C_MSG_READ));
+
+		if (concat_next || (msg_buf_used != 0) || !dma_accessible) {
+			if ((msg_buf_used + msg.len) > dev_config->msg_buf_size) {
+				LOG_ERR("Need to use the internal driver "
+					"buffer but its size is insufficient "
+					"(%u + %u > %u).",
+					msg_buf_used, msg.len,
+					dev_config->msg_buf_size);
+				error = -ENOSPC;
+				break;
+			}
+			if (!(msg.flags & I2C_MSG_READ)) {
+				memcpy(dev_data->msg_buf + msg_buf_used,
+				       msg.buf, msg.len);
+			}
+			msg_buf_used += msg.len;
+		}
+
+		if (!concat_next) {
+			break;
+		}
+
+		txn = next;
+		msg = next_msg;
+	}
+
+	dev_data->txn_last = txn;
+	dev_data->msg_buf_used = msg_buf_used;
+
+	if (error != 0) {
+		i2c_nrfx_twim_iodev_complete(dev, error);
+		return;
+	}
+
+	if (msg_buf_used == 0) {
+		cur_xfer.p_primary_buf = msg.buf;
+		cur_xfer.primary_length = msg.len;
+	} else {
+		cur_xfer.p_primary_buf = dev_data->msg_buf;
+		cur_xfer.primary_length = msg_buf_used;
+	}
+	cur_xfer.type = (msg.flags & I2C_MSG_READ) ?
+		NRFX_TWIM_XFER_RX : NRFX_TWIM_XFER_TX;
+
+	if (cur_xfer.primary_length > dev_config->max_transfer_size) {
+		LOG_ERR("Trying to transfer more than the maximum size "
+			"for this device: %d > %d",
+			cur_xfer.primary_length,
+			dev_config->max_transfer_size);
+		i2c_nrfx_twim_iodev_complete(dev, -ENOSPC);
+		return;
+	}
+
+	/* Completes from the event handler, without any thread */
+	res = nrfx_twim_xfer(&dev_config->twim, &cur_xfer,
+			     (msg.flags & I2C_MSG_STOP) ?
+			      0 : NRFX_TWIM_FLAG_TX_NO_STOP);
+	if (res != NRFX_SUCCESS) {
+		i2c_nrfx_twim_iodev_complete(dev, (res == NRFX_ERROR_BUSY) ?
+						  -EBUSY : -EIO);
+	}
+}
+
+static void i2c_nrfx_twim_iodev_next(const struct device *dev, bool completion)
+{
+	struct i2c_nrfx_twim_data *dev_data = dev->data;
+	struct rtio_iodev_sqe *txn;
+	struct rtio_mpsc_node *next;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&dev_data->lock);
+
+	if (!completion && dev_data->txn_curr != NULL) {
+		k_spin_unlock(&dev_data->lock, key);
+		return;
+	}
+
+	next = rtio_mpsc_pop(&dev_data->iodev.iodev_sq);
+	txn = (next != NULL) ? CONTAINER_OF(next, struct rtio_iodev_sqe, q) : NULL;
+
+	dev_data->txn_head = txn;
+	dev_data->txn_curr = txn;
+
+	k_spin_unlock(&dev_data->lock, key);
+
+	if (txn != NULL) {
+		i2c_nrfx_twim_iodev_start(dev);
+	}
+}
+
+static void i2c_nrfx_twim_iodev_complete(const struct device *dev, int error)
+{
+	struct i2c_nrfx_twim_data *dev_data = dev->data;
+	struct rtio_iodev_sqe *txn_head = dev_data->txn_head;
+	struct rtio_iodev_sqe *txn_last = dev_data->txn_last;
+
+	/* Content of the internal driver buffer goes back to the submissions
+	 * merged into the read.
+	 */
+	if (error == 0 && dev_data->msg_buf_used != 0 &&
+	    txn_last->sqe.op == RTIO_OP_RX) {
+		struct rtio_iodev_sqe *txn = dev_data->txn_curr;
+		uint16_t offset = 0;
+		struct i2c_msg msg;
+
+		while (true) {
+			(void)i2c_rtio_sqe_msg(txn, &msg);
+			memcpy(msg.buf, dev_data->msg_buf + offset, msg.len);
+			offset += msg.len;
+			if (txn == txn_last) {
+				break;
+			}
+			txn = rtio_txn_next(txn);
+		}
+	}
+
+	if (error == 0 && (txn_last->sqe.flags & RTIO_SQE_TRANSACTION)) {
+		dev_data->txn_curr = rtio_txn_next(txn_last);
+		i2c_nrfx_twim_iodev_start(dev);
+		return;
+	}
+
+	/* Transactions of other devices on the bus follow without a gap */
+	i2c_nrfx_twim_iodev_next(dev, true);
+
+	if (error == 0) {
+		rtio_iodev_sqe_ok(txn_head, 0);
+	} else {
+		rtio_iodev_sqe_err(txn_head, error);
+	}
+}
+
+static void i2c_nrfx_twim_iodev_submit(const struct device *dev,
+				       struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct i2c_nrfx_twim_data *dev_data = dev->data;
+
+	rtio_mpsc_push(&dev_data->iodev.iodev_sq, &iodev_sqe->q);
+	i2c_nrfx_twim_iodev_next(dev, false);
+}
+
+static int i2c_nrfx_twim_transfer(const struct device *dev,
+				  struct i2c_msg *msgs,
+				  uint8_t num_msgs, uint16_t addr)
+{
+	struct i2c_nrfx_twim_data *dev_data = dev->data;
+	struct rtio_cqe *cqe;
+	int ret = 0;
+
+	k_sem_take(&dev_data->transfer_sync, K_FOREVER);
+
+	dev_data->dt_spec.addr = addr;
+
+	if (i2c_rtio_copy(dev_data->r, &dev_data->iodev, msgs, num_msgs) == NULL) {
+		LOG_ERR("Not enough submission queue entries");
+		k_sem_give(&dev_data->transfer_sync);
+		return -ENOMEM;
+	}
+
+	(void)pm_device_runtime_get(dev);
+
+	/* Submit request and wait */
+	rtio_submit(dev_data->r, num_msgs);
+
+	for (uint8_t i = 0; i < num_msgs; i++) {
+		cqe = rtio_cqe_consume(dev_data->r);
+		if (cqe->result < 0 && ret == 0) {
+			ret = cqe->result;
+		}
+
+		rtio_cqe_release(dev_data->r, cqe);
+	}
+
+	(void)pm_device_runtime_put(dev);
+
+	k_sem_give(&dev_data->transfer_sync);
+
+	return ret;
+}
+#endif /* CONFIG_I2C_RTIO */
 
 static void event_handler(nrfx_twim_evt_t const *p_event, void *p_context)
 {
@@ -224,7 +457,12 @@ static void event_handler(nrfx_twim_evt_t const *p_event, void *p_context)
 		break;
 	}
 
+#ifdef CONFIG_I2C_RTIO
+	i2c_nrfx_twim_iodev_complete(dev_data->dev,
+				     (dev_data->res == NRFX_SUCCESS) ? 0 : -EIO);
+#else
 	k_sem_give(&dev_data->completion_sync);
+#endif
 }
 
 static int i2c_nrfx_twim_configure(const struct device *dev,
@@ -292,6 +530,9 @@ static const struct i2c_driver_api i2c_nrfx_twim_driver_api = {
 	.configure   = i2c_nrfx_twim_configure,
 	.transfer    = i2c_nrfx_twim_transfer,
 	.recover_bus = i2c_nrfx_twim_recover_bus,
+#ifdef CONFIG_I2C_RTIO
+	.iodev_submit = i2c_nrfx_twim_iodev_submit,
+#endif
 };
 
 #ifdef CONFIG_PM_DEVICE
@@ -350,6 +591,14 @@ static int i2c_nrfx_twim_init(const struct device *dev)
 		return -EIO;
 	}
 
+#ifdef CONFIG_I2C_RTIO
+	dev_data->dev = dev;
+	dev_data->dt_spec.bus = dev;
+	dev_data->iodev.api = &i2c_iodev_api;
+	dev_data->iodev.data = &dev_data->dt_spec;
+	rtio_mpsc_init(&dev_data->iodev.iodev_sq);
+#endif
+
 #ifdef CONFIG_PM_DEVICE_RUNTIME
 	pm_device_init_suspended(dev);
 	pm_device_runtime_enable(dev);
@@ -400,6 +649,10 @@ static int i2c_nrfx_twim_init(const struct device *dev)
 	IF_ENABLED(USES_MSG_BUF(idx),					       \
 		(static uint8_t twim_##idx##_msg_buf[MSG_BUF_SIZE(idx)]	       \
 		 I2C_MEMORY_SECTION(idx);))				       \
+	IF_ENABLED(CONFIG_I2C_RTIO,					       \
+		(RTIO_DEFINE(twim_##idx##_rtio,				       \
+			     CONFIG_I2C_NRFX_TWIM_RTIO_SQ_SIZE,		       \
+			     CONFIG_I2C_NRFX_TWIM_RTIO_SQ_SIZE);))	       \
 	static struct i2c_nrfx_twim_data twim_##idx##_data = {		       \
 		.transfer_sync = Z_SEM_INITIALIZER(			       \
 			twim_##idx##_data.transfer_sync, 1, 1),		       \
@@ -407,6 +660,8 @@ static int i2c_nrfx_twim_init(const struct device *dev)
 			twim_##idx##_data.completion_sync, 0, 1),	       \
 		IF_ENABLED(USES_MSG_BUF(idx),				       \
 			(.msg_buf = twim_##idx##_msg_buf,))		       \
+		IF_ENABLED(CONFIG_I2C_RTIO,				       \
+			(.r = &twim_##idx##_rtio,))			       \
 	};								       \
 	PINCTRL_DT_DEFINE(I2C(idx));					       \
 	static const struct i2c_nrfx_twim_config twim_##idx##z_config = {      \
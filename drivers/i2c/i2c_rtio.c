@@ -6,7 +6,6 @@
 
 #include <zephyr/rtio/rtio.h>
 #include <zephyr/drivers/i2c.h>
-#include <zephyr/rtio/rtio_spsc.h>
 #include <zephyr/sys/__assert.h>
 
 const struct rtio_iodev_api i2c_iodev_api = {
@@ -26,7 +25,7 @@ struct rtio_sqe *i2c_rtio_copy(struct rtio *r,
 		sqe = rtio_sqe_acquire(r);
 
 		if (sqe == NULL) {
-			rtio_spsc_drop_all(r->sq);
+			rtio_sqe_drop_all(r);
 			return NULL;
 		}
 
@@ -47,3 +46,51 @@ struct rtio_sqe *i2c_rtio_copy(struct rtio *r,
 
 	return sqe;
 }
+
+int i2c_rtio_sqe_msg(struct rtio_iodev_sqe *iodev_sqe, struct i2c_msg *msg)
+{
+	struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	uint8_t *buf;
+	uint32_t len;
+	int rc;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		len = sqe->buf_len;
+		if ((sqe->flags & RTIO_SQE_MEMPOOL_BUFFER) && sqe->buf == NULL) {
+			len = rtio_mempool_block_size(iodev_sqe->r);
+		}
+		rc = rtio_sqe_rx_buf(iodev_sqe, len, len, &buf, &len);
+		if (rc != 0) {
+			return rc;
+		}
+		msg->buf = buf;
+		msg->len = len;
+		msg->flags = I2C_MSG_READ;
+		break;
+	case RTIO_OP_TX:
+		msg->buf = sqe->buf;
+		msg->len = sqe->buf_len;
+		msg->flags = I2C_MSG_WRITE;
+		break;
+	case RTIO_OP_TINY_TX:
+		msg->buf = sqe->tiny_buf;
+		msg->len = sqe->tiny_buf_len;
+		msg->flags = I2C_MSG_WRITE;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	if ((sqe->iodev_flags & RTIO_IODEV_I2C_STOP) || !(sqe->flags & RTIO_SQE_TRANSACTION)) {
+		msg->flags |= I2C_MSG_STOP;
+	}
+	if (sqe->iodev_flags & RTIO_IODEV_I2C_RESTART) {
+		msg->flags |= I2C_MSG_RESTART;
+	}
+	if (sqe->iodev_flags & RTIO_IODEV_I2C_10_BITS) {
+		msg->flags |= I2C_MSG_ADDR_10_BITS;
+	}
+
+	return 0;
+}
@@ -231,7 +231,7 @@ static void i2c_sam_twihs_next(const struct device *dev, bool completion)
 	}
 
 	data->iodev_sqe = CONTAINER_OF(next, struct rtio_iodev_sqe, q);
-	data->sqe = data->iodev_sqe->sqe;
+	data->sqe = &data->iodev_sqe->sqe;
 	k_spin_unlock(&data->lock, key);
 
 	i2c_sam_twihs_start(dev);
@@ -254,7 +254,10 @@ static void i2c_sam_twihs_complete(const struct device *dev, int status)
 	}
 
 	if (dev_data->sqe->flags & RTIO_SQE_TRANSACTION) {
-		dev_data->sqe = rtio_spsc_next(iodev_sqe->r->sq, dev_data->sqe);
+		struct rtio_iodev_sqe *txn_curr =
+			CONTAINER_OF(dev_data->sqe, struct rtio_iodev_sqe, sqe);
+
+		dev_data->sqe = &rtio_txn_next(txn_curr)->sqe;
 		i2c_sam_twihs_start(dev);
 	} else {
 		rtio_iodev_sqe_ok(iodev_sqe, status);
@@ -112,12 +112,25 @@ static void sensor_submit_fallback(const struct device *dev, struct rtio_iodev_s
 {
 	const struct sensor_read_config *cfg = iodev_sqe->sqe.iodev->data;
 	const enum sensor_channel *const channels = cfg->channels;
-	const int num_output_samples = compute_num_samples(channels, cfg->count);
-	uint32_t min_buf_len = compute_min_buf_len(num_output_samples);
-	uint64_t timestamp_ns = k_ticks_to_ns_floor64(k_uptime_ticks());
-	int rc = sensor_sample_fetch(dev);
+	int num_output_samples;
+	uint32_t min_buf_len;
+	uint64_t timestamp_ns;
 	uint8_t *buf;
 	uint32_t buf_len;
+	int rc;
+
+	if (cfg->is_streaming) {
+		/* Streaming needs driver support, don't let the multishot resubmit itself */
+		LOG_WRN("Streaming is not supported by %s", dev->name);
+		iodev_sqe->sqe.flags &= ~RTIO_SQE_MULTISHOT;
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return;
+	}
+
+	num_output_samples = compute_num_samples(channels, cfg->count);
+	min_buf_len = compute_min_buf_len(num_output_samples);
+	timestamp_ns = k_ticks_to_ns_floor64(k_uptime_ticks());
+	rc = sensor_sample_fetch(dev);
 
 	/* Check that the fetch succeeded */
 	if (rc != 0) {
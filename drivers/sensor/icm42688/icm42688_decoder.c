@@ -8,6 +8,7 @@
 #include "icm42688_reg.h"
 #include "icm42688.h"
 #include <errno.h>
+#include <zephyr/drivers/sensor_convert.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(ICM42688_DECODER, CONFIG_SENSOR_LOG_LEVEL);
@@ -317,17 +318,190 @@ static int icm42688_one_shot_decode(const uint8_t *buffer, enum sensor_channel c
 	}
 }
 
+/* Sample period in ns, indexed by the accel/gyro ODR register value */
+static const uint32_t icm42688_odr_period_ns[] = {
+	[ICM42688_ACCEL_ODR_32000] = 31250,
+	[ICM42688_ACCEL_ODR_16000] = 62500,
+	[ICM42688_ACCEL_ODR_8000] = 125000,
+	[ICM42688_ACCEL_ODR_4000] = 250000,
+	[ICM42688_ACCEL_ODR_2000] = 500000,
+	[ICM42688_ACCEL_ODR_1000] = 1000000,
+	[ICM42688_ACCEL_ODR_200] = 5000000,
+	[ICM42688_ACCEL_ODR_100] = 10000000,
+	[ICM42688_ACCEL_ODR_50] = 20000000,
+	[ICM42688_ACCEL_ODR_25] = 40000000,
+	[ICM42688_ACCEL_ODR_12_5] = 80000000,
+	[ICM42688_ACCEL_ODR_6_25] = 160000000,
+	[ICM42688_ACCEL_ODR_3_125] = 320000000,
+	[ICM42688_ACCEL_ODR_1_5625] = 640000000,
+	[ICM42688_ACCEL_ODR_500] = 2000000,
+};
+
+BUILD_ASSERT((int)ICM42688_GYRO_ODR_500 == (int)ICM42688_ACCEL_ODR_500);
+
+/* Full scale of the FIFO samples in millionths of the channel unit */
+static int64_t icm42688_fifo_full_scale_micro(enum sensor_channel channel,
+					      const struct icm42688_decoder_header *header)
+{
+	switch (channel) {
+	case SENSOR_CHAN_ACCEL_XYZ:
+		/* 16g >> accel_fs, in um/s^2 */
+		return (int64_t)(16 >> header->accel_fs) * SENSOR_G;
+	case SENSOR_CHAN_GYRO_XYZ:
+		/* 2000dps >> gyro_fs, in urad/s */
+		return (INT64_C(2000000) >> header->gyro_fs) * SENSOR_PI / 180 / 1000;
+	default:
+		return 0;
+	}
+}
+
+static inline bool icm42688_fifo_packet_valid(const uint8_t *packet, uint8_t header_bit)
+{
+	return !(packet[0] & FIFO_HEADER_EMPTY) && (packet[0] & header_bit);
+}
+
+static int icm42688_fifo_decode(const uint8_t *buffer, enum sensor_channel channel,
+				size_t channel_idx, uint32_t *fit, uint16_t max_count,
+				void *data_out)
+{
+	const struct icm42688_fifo_data *edata = (const struct icm42688_fifo_data *)buffer;
+	const uint8_t *packets = buffer + sizeof(struct icm42688_fifo_data);
+	const uint32_t packet_count = edata->fifo_count / ICM42688_FIFO_PACKET_SIZE;
+	uint32_t period_ns;
+	uint64_t first_ns;
+	uint8_t header_bit;
+	size_t data_offset;
+	struct sensor_convert_cfg conv = {0};
+	int8_t shift;
+	int count = 0;
+	int rc;
+
+	if (channel_idx != 0) {
+		return -EINVAL;
+	}
+
+	switch (channel) {
+	case SENSOR_CHAN_ACCEL_X:
+	case SENSOR_CHAN_ACCEL_Y:
+	case SENSOR_CHAN_ACCEL_Z:
+	case SENSOR_CHAN_ACCEL_XYZ:
+		channel = SENSOR_CHAN_ACCEL_XYZ;
+		header_bit = FIFO_HEADER_ACCEL;
+		data_offset = 1;
+		break;
+	case SENSOR_CHAN_GYRO_X:
+	case SENSOR_CHAN_GYRO_Y:
+	case SENSOR_CHAN_GYRO_Z:
+	case SENSOR_CHAN_GYRO_XYZ:
+		channel = SENSOR_CHAN_GYRO_XYZ;
+		header_bit = FIFO_HEADER_GYRO;
+		data_offset = 7;
+		break;
+	case SENSOR_CHAN_DIE_TEMP:
+		header_bit = FIFO_HEADER_ACCEL | FIFO_HEADER_GYRO;
+		data_offset = 13;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	rc = icm42688_get_shift(channel, edata->header.accel_fs, edata->header.gyro_fs, &shift);
+	if (rc != 0) {
+		return rc;
+	}
+	if (channel != SENSOR_CHAN_DIE_TEMP) {
+		/* Computed once so that each sample only takes a multiplication */
+		rc = sensor_convert_cfg_init(
+			&conv, icm42688_fifo_full_scale_micro(channel, &edata->header), 0, shift);
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	period_ns = icm42688_odr_period_ns[channel == SENSOR_CHAN_GYRO_XYZ ? edata->gyro_odr
+									    : edata->accel_odr];
+	/* The header timestamp is the one of the last packet */
+	first_ns = edata->header.timestamp -
+		   (uint64_t)period_ns * (packet_count > 0 ? packet_count - 1 : 0);
+
+	/* fit is the index of the next packet to decode */
+	for (; *fit < packet_count && count < max_count; (*fit)++) {
+		const uint8_t *packet = &packets[*fit * ICM42688_FIFO_PACKET_SIZE];
+		uint32_t delta_ns;
+
+		if (!icm42688_fifo_packet_valid(packet, header_bit)) {
+			continue;
+		}
+
+		if (channel == SENSOR_CHAN_DIE_TEMP) {
+			struct sensor_q31_data *out = data_out;
+			int8_t raw = (int8_t)packet[data_offset];
+
+			if (count == 0) {
+				out->header.base_timestamp_ns = first_ns + (uint64_t)period_ns * *fit;
+				out->shift = shift;
+			}
+			delta_ns = first_ns + (uint64_t)period_ns * *fit -
+				   out->header.base_timestamp_ns;
+			/* T = raw / 2.07 + 25 */
+			out->readings[count].timestamp_delta = delta_ns;
+			out->readings[count].temperature =
+				(q31_t)(((int64_t)raw * 100 * (INT64_C(1) << (31 - shift))) / 207 +
+					(INT64_C(25) << (31 - shift)));
+		} else {
+			struct sensor_three_axis_data *out = data_out;
+			int16_t raw[3];
+
+			for (int i = 0; i < 3; i++) {
+				raw[i] = sys_get_be16(&packet[data_offset + i * 2]);
+			}
+			/* A sensor turned off reports an invalid sample */
+			if (raw[0] == FIFO_SAMPLE_INVALID) {
+				continue;
+			}
+
+			if (count == 0) {
+				out->header.base_timestamp_ns = first_ns + (uint64_t)period_ns * *fit;
+				out->shift = shift;
+			}
+			delta_ns = first_ns + (uint64_t)period_ns * *fit -
+				   out->header.base_timestamp_ns;
+			out->readings[count].timestamp_delta = delta_ns;
+			for (int i = 0; i < 3; i++) {
+				out->readings[count].values[i] = sensor_convert_int16_q31(raw[i], &conv);
+			}
+		}
+		count++;
+	}
+
+	if (count > 0) {
+		((struct sensor_data_header *)data_out)->reading_count = count;
+	}
+
+	return count;
+}
+
 static int icm42688_decoder_decode(const uint8_t *buffer, enum sensor_channel channel,
 				   size_t channel_idx, uint32_t *fit,
 				   uint16_t max_count, void *data_out)
 {
+	const struct icm42688_decoder_header *header =
+		(const struct icm42688_decoder_header *)buffer;
+
+	if (header->is_fifo) {
+		return icm42688_fifo_decode(buffer, channel, channel_idx, fit, max_count,
+					    data_out);
+	}
+
 	return icm42688_one_shot_decode(buffer, channel, channel_idx, fit, max_count, data_out);
 }
 
 static int icm42688_decoder_get_frame_count(const uint8_t *buffer, enum sensor_channel channel,
 					    size_t channel_idx, uint16_t *frame_count)
 {
-	ARG_UNUSED(buffer);
+	const struct icm42688_decoder_header *header =
+		(const struct icm42688_decoder_header *)buffer;
+
 	if (channel_idx != 0) {
 		return -ENOTSUP;
 	}
@@ -341,7 +515,14 @@ static int icm42688_decoder_get_frame_count(const uint8_t *buffer, enum sensor_c
 	case SENSOR_CHAN_GYRO_Z:
 	case SENSOR_CHAN_GYRO_XYZ:
 	case SENSOR_CHAN_DIE_TEMP:
-		*frame_count = 1;
+		if (header->is_fifo) {
+			const struct icm42688_fifo_data *edata =
+				(const struct icm42688_fifo_data *)buffer;
+
+			*frame_count = edata->fifo_count / ICM42688_FIFO_PACKET_SIZE;
+		} else {
+			*frame_count = 1;
+		}
 		return 0;
 	default:
 		return -ENOTSUP;
@@ -372,10 +553,29 @@ static int icm42688_decoder_get_size_info(enum sensor_channel channel, size_t *b
 	}
 }
 
+static bool icm42688_decoder_has_trigger(const uint8_t *buffer, enum sensor_trigger_type trigger)
+{
+	const struct icm42688_fifo_data *edata = (const struct icm42688_fifo_data *)buffer;
+
+	if (!edata->header.is_fifo) {
+		return false;
+	}
+
+	switch (trigger) {
+	case SENSOR_TRIG_FIFO_WATERMARK:
+		return FIELD_GET(BIT_INT_STATUS_FIFO_THS, edata->int_status);
+	case SENSOR_TRIG_FIFO_FULL:
+		return FIELD_GET(BIT_INT_STATUS_FIFO_FULL, edata->int_status);
+	default:
+		return false;
+	}
+}
+
 SENSOR_DECODER_API_DT_DEFINE() = {
 	.get_frame_count = icm42688_decoder_get_frame_count,
 	.get_size_info = icm42688_decoder_get_size_info,
 	.decode = icm42688_decoder_decode,
+	.has_trigger = icm42688_decoder_has_trigger,
 };
 
 int icm42688_get_decoder(const struct device *dev, const struct sensor_decoder_api **decoder)
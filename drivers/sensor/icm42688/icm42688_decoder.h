@@ -27,6 +27,18 @@ struct icm42688_encoded_data {
 	int16_t readings[7];
 };
 
+/* Size of a FIFO packet with accel, gyro, temperature and timestamp (packet 3) */
+#define ICM42688_FIFO_PACKET_SIZE 16
+
+struct icm42688_fifo_data {
+	struct icm42688_decoder_header header;
+	uint8_t int_status;
+	uint8_t gyro_odr: 4;
+	uint8_t accel_odr: 4;
+	/* Number of bytes of FIFO packets following the header */
+	uint16_t fifo_count;
+} __attribute__((__packed__));
+
 int icm42688_encode(const struct device *dev, const enum sensor_channel *const channels,
 		    const size_t num_channels, uint8_t *buf);
 
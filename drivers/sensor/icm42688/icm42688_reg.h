@@ -276,6 +276,13 @@
 #define BIT_INT_TDEASSERT_DISABLE BIT(5)
 #define BIT_INT_ASYNC_RESET	  BIT(4)
 
+/* FIFO packet header */
+#define FIFO_HEADER_EMPTY  BIT(7)
+#define FIFO_HEADER_ACCEL  BIT(6)
+#define FIFO_HEADER_GYRO   BIT(5)
+#define FIFO_HEADER_20     BIT(4)
+#define FIFO_SAMPLE_INVALID INT16_MIN
+
 /* misc. defines */
 #define WHO_AM_I_ICM42688     0x47
 #define MIN_ACCEL_SENS_SHIFT  11
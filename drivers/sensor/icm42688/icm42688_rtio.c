@@ -8,6 +8,7 @@
 #include "icm42688.h"
 #include "icm42688_decoder.h"
 #include "icm42688_reg.h"
+#include "icm42688_rtio.h"
 #include "icm42688_spi.h"
 
 #include <zephyr/logging/log.h>
@@ -53,6 +54,16 @@ int icm42688_submit(const struct device *dev, struct rtio_iodev_sqe *iodev_sqe)
 	uint32_t buf_len;
 	struct icm42688_encoded_data *edata;
 
+	if (cfg->is_streaming) {
+#ifdef CONFIG_ICM42688_STREAM
+		return icm42688_submit_stream(dev, iodev_sqe);
+#else
+		iodev_sqe->sqe.flags &= ~RTIO_SQE_MULTISHOT;
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+		return -ENOTSUP;
+#endif
+	}
+
 	/* Get the buffer for the frame, it may be allocated dynamically by the rtio context */
 	rc = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, min_buf_len, &buf, &buf_len);
 	if (rc != 0) {
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/rtio/rtio.h>
+#include "icm42688.h"
+#include "icm42688_decoder.h"
+#include "icm42688_reg.h"
+#include "icm42688_rtio.h"
+#include "icm42688_spi.h"
+#include "icm42688_trigger.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(ICM42688_RTIO, CONFIG_SENSOR_LOG_LEVEL);
+
+BUILD_ASSERT(CONFIG_ICM42688_STREAM_FIFO_WATERMARK % ICM42688_FIFO_PACKET_SIZE == 0,
+	     "The FIFO watermark must be a multiple of the FIFO packet size");
+
+static const struct sensor_stream_trigger *
+icm42688_stream_trigger(const struct sensor_read_config *read_cfg, uint8_t int_status)
+{
+	for (size_t i = 0; i < read_cfg->count; i++) {
+		const struct sensor_stream_trigger *trig = &read_cfg->triggers[i];
+
+		if ((trig->trigger == SENSOR_TRIG_FIFO_WATERMARK &&
+		     FIELD_GET(BIT_INT_STATUS_FIFO_THS, int_status)) ||
+		    (trig->trigger == SENSOR_TRIG_FIFO_FULL &&
+		     FIELD_GET(BIT_INT_STATUS_FIFO_FULL, int_status))) {
+			return trig;
+		}
+	}
+
+	return NULL;
+}
+
+static int icm42688_fifo_flush(const struct device *dev)
+{
+	const struct icm42688_dev_cfg *cfg = dev->config;
+
+	return icm42688_spi_single_write(&cfg->spi, REG_SIGNAL_PATH_RESET,
+					 FIELD_PREP(BIT_FIFO_FLUSH, 1));
+}
+
+static int icm42688_fifo_disable(const struct device *dev)
+{
+	struct icm42688_dev_data *data = dev->data;
+	struct icm42688_cfg new_config = data->cfg;
+
+	new_config.fifo_en = false;
+
+	return icm42688_safely_configure(dev, &new_config);
+}
+
+int icm42688_submit_stream(const struct device *sensor, struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *read_cfg = iodev_sqe->sqe.iodev->data;
+	struct icm42688_dev_data *data = sensor->data;
+	struct icm42688_cfg new_config;
+	int rc = 0;
+
+	for (size_t i = 0; i < read_cfg->count; i++) {
+		if (read_cfg->triggers[i].trigger != SENSOR_TRIG_FIFO_WATERMARK &&
+		    read_cfg->triggers[i].trigger != SENSOR_TRIG_FIFO_FULL) {
+			LOG_ERR("Unsupported stream trigger %d", read_cfg->triggers[i].trigger);
+			/* Resubmitting would fail the same way, end the stream here */
+			iodev_sqe->sqe.flags &= ~RTIO_SQE_MULTISHOT;
+			rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+			return -ENOTSUP;
+		}
+	}
+
+	icm42688_lock(sensor);
+
+	if (!data->cfg.fifo_en) {
+		new_config = data->cfg;
+		new_config.fifo_en = true;
+		new_config.fifo_wm = CONFIG_ICM42688_STREAM_FIFO_WATERMARK;
+		rc = icm42688_safely_configure(sensor, &new_config);
+	}
+
+	if (rc == 0) {
+		data->streaming_sqe = iodev_sqe;
+	}
+
+	icm42688_unlock(sensor);
+
+	if (rc != 0) {
+		LOG_ERR("Failed to enable the FIFO");
+		iodev_sqe->sqe.flags &= ~RTIO_SQE_MULTISHOT;
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+	}
+
+	return rc;
+}
+
+/*
+ * Called with the device locked from the trigger thread or work item when INT1 fires while the
+ * FIFO is enabled. The whole FIFO content is moved into one buffer of the RTIO context with a
+ * single bus transfer so the decoder can convert the batch at once.
+ */
+void icm42688_fifo_event(const struct device *dev)
+{
+	struct icm42688_dev_data *data = dev->data;
+	const struct icm42688_dev_cfg *cfg = dev->config;
+	struct rtio_iodev_sqe *iodev_sqe = data->streaming_sqe;
+	const struct sensor_read_config *read_cfg;
+	const struct sensor_stream_trigger *trig;
+	struct icm42688_fifo_data *hdr;
+	uint8_t int_status;
+	uint8_t fifo_count_buf[2];
+	uint16_t fifo_count;
+	uint64_t timestamp;
+	uint32_t min_buf_len;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int rc;
+
+	rc = icm42688_spi_read(&cfg->spi, REG_INT_STATUS, &int_status, 1);
+	if (rc != 0) {
+		LOG_ERR("Failed to read INT_STATUS");
+		return;
+	}
+
+	if (iodev_sqe == NULL) {
+		/* Nobody is consuming the stream anymore */
+		icm42688_fifo_disable(dev);
+		return;
+	}
+
+	if (FIELD_GET(RTIO_SQE_CANCELED, iodev_sqe->sqe.flags)) {
+		data->streaming_sqe = NULL;
+		icm42688_fifo_disable(dev);
+		/* Let the executor release the canceled submission */
+		rtio_iodev_sqe_ok(iodev_sqe, 0);
+		return;
+	}
+
+	read_cfg = iodev_sqe->sqe.iodev->data;
+	trig = icm42688_stream_trigger(read_cfg, int_status);
+	if (trig == NULL) {
+		return;
+	}
+
+	rc = icm42688_spi_read(&cfg->spi, REG_FIFO_COUNTH, fifo_count_buf, 2);
+	if (rc != 0) {
+		LOG_ERR("Failed to read FIFO_COUNT");
+		return;
+	}
+
+	/* The last packet counted was sampled less than one ODR period ago */
+	timestamp = k_ticks_to_ns_floor64(k_uptime_ticks());
+
+	/* Only consume whole packets, a partial one is read on the next interrupt */
+	fifo_count = sys_get_be16(fifo_count_buf);
+	fifo_count -= fifo_count % ICM42688_FIFO_PACKET_SIZE;
+
+	if (trig->opt == SENSOR_STREAM_DATA_DROP) {
+		icm42688_fifo_flush(dev);
+		fifo_count = 0;
+	} else if (trig->opt == SENSOR_STREAM_DATA_NOP) {
+		fifo_count = 0;
+	}
+
+	/* At least one packet is needed when there is data, the rest is read if it fits */
+	min_buf_len = sizeof(struct icm42688_fifo_data) +
+		      MIN(fifo_count, ICM42688_FIFO_PACKET_SIZE);
+
+	data->streaming_sqe = NULL;
+
+	rc = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, sizeof(struct icm42688_fifo_data) + fifo_count,
+			     &buf, &buf_len);
+	if (rc != 0) {
+		/* Samples can't be kept in the FIFO without overflowing, drop them */
+		LOG_WRN("Failed to get a buffer of %u bytes, dropping %u FIFO bytes", min_buf_len,
+			fifo_count);
+		icm42688_fifo_flush(dev);
+		rtio_iodev_sqe_err(iodev_sqe, rc);
+		return;
+	}
+
+	fifo_count = MIN(fifo_count, buf_len - sizeof(struct icm42688_fifo_data));
+	fifo_count -= fifo_count % ICM42688_FIFO_PACKET_SIZE;
+
+	hdr = (struct icm42688_fifo_data *)buf;
+	hdr->header.is_fifo = true;
+	hdr->header.accel_fs = data->cfg.accel_fs;
+	hdr->header.gyro_fs = data->cfg.gyro_fs;
+	hdr->header.timestamp = timestamp;
+	hdr->int_status = int_status;
+	hdr->accel_odr = data->cfg.accel_odr;
+	hdr->gyro_odr = data->cfg.gyro_odr;
+	hdr->fifo_count = fifo_count;
+
+	if (fifo_count > 0) {
+		rc = icm42688_spi_read(&cfg->spi, REG_FIFO_DATA,
+				       buf + sizeof(struct icm42688_fifo_data), fifo_count);
+		if (rc != 0) {
+			LOG_ERR("Failed to read %u FIFO bytes", fifo_count);
+			rtio_iodev_sqe_err(iodev_sqe, rc);
+			return;
+		}
+	}
+
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
@@ -12,6 +12,7 @@
 
 #include "icm42688.h"
 #include "icm42688_reg.h"
+#include "icm42688_rtio.h"
 #include "icm42688_spi.h"
 #include "icm42688_trigger.h"
 
@@ -39,6 +40,14 @@ static void icm42688_thread_cb(const struct device *dev)
 
 	icm42688_lock(dev);
 
+#ifdef CONFIG_ICM42688_STREAM
+	if (data->cfg.fifo_en) {
+		icm42688_fifo_event(dev);
+		icm42688_unlock(dev);
+		return;
+	}
+#endif
+
 	if (data->data_ready_handler != NULL) {
 		data->data_ready_handler(dev, data->data_ready_trigger);
 	}
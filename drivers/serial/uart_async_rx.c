@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/drivers/serial/uart_async_rx.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/__assert.h>
+
+LOG_MODULE_REGISTER(uart_async_rx, CONFIG_UART_LOG_LEVEL);
+
+static inline uint8_t next_idx(struct uart_async_rx *rx, uint8_t idx)
+{
+	return (idx + 1 == rx->buf_cnt) ? 0 : idx + 1;
+}
+
+static inline uint8_t *buf_addr(struct uart_async_rx *rx, uint8_t idx)
+{
+	return &rx->buffer[idx * rx->buf_len];
+}
+
+static inline uint8_t buf_idx(struct uart_async_rx *rx, const uint8_t *buf)
+{
+	size_t idx = (buf - rx->buffer) / rx->buf_len;
+
+	__ASSERT_NO_MSG(buf >= rx->buffer && idx < rx->buf_cnt);
+
+	return idx;
+}
+
+/* Take the next buffer of the ring for the driver, must be called locked */
+static uint8_t *buf_take(struct uart_async_rx *rx)
+{
+	uint8_t idx = rx->drv_buf_idx;
+
+	if (rx->free_buf_cnt == 0) {
+		return NULL;
+	}
+
+	rx->free_buf_cnt--;
+	rx->drv_buf_idx = next_idx(rx, idx);
+	rx->bufs[idx].wr_len = 0;
+	rx->bufs[idx].completed = false;
+
+	return buf_addr(rx, idx);
+}
+
+/* Restart reception if it stopped while enabled and a buffer is free */
+static int rx_restart(struct uart_async_rx *rx)
+{
+	k_spinlock_key_t key = k_spin_lock(&rx->lock);
+	uint8_t *buf;
+	int err;
+
+	if (!rx->enabled || !rx->stopped) {
+		k_spin_unlock(&rx->lock, key);
+		return 0;
+	}
+
+	buf = buf_take(rx);
+	if (buf == NULL) {
+		k_spin_unlock(&rx->lock, key);
+		return 0;
+	}
+
+	rx->stopped = false;
+	k_spin_unlock(&rx->lock, key);
+
+	err = uart_rx_enable(rx->dev, buf, rx->buf_len, rx->timeout);
+	if (err < 0) {
+		LOG_ERR("Failed to restart reception (%d)", err);
+
+		/* The empty buffer goes back to the consumer */
+		key = k_spin_lock(&rx->lock);
+		rx->bufs[buf_idx(rx, buf)].completed = true;
+		rx->stopped = true;
+		k_spin_unlock(&rx->lock, key);
+	}
+
+	return err;
+}
+
+int uart_async_rx_enable(struct uart_async_rx *rx, const struct device *dev, int32_t timeout)
+{
+	k_spinlock_key_t key = k_spin_lock(&rx->lock);
+
+	if (rx->enabled) {
+		k_spin_unlock(&rx->lock, key);
+		return -EBUSY;
+	}
+
+	/* Start over on an empty ring if nothing is left from a previous run */
+	if (rx->dev == NULL || rx->free_buf_cnt == rx->buf_cnt) {
+		rx->drv_buf_idx = 0;
+		rx->rd_buf_idx = 0;
+		rx->rd_idx = 0;
+		rx->free_buf_cnt = rx->buf_cnt;
+	}
+
+	rx->dev = dev;
+	rx->timeout = timeout;
+	rx->enabled = true;
+	rx->stopped = true;
+	k_spin_unlock(&rx->lock, key);
+
+	return rx_restart(rx);
+}
+
+int uart_async_rx_disable(struct uart_async_rx *rx)
+{
+	k_spinlock_key_t key = k_spin_lock(&rx->lock);
+	bool running = rx->enabled && !rx->stopped;
+
+	rx->enabled = false;
+	k_spin_unlock(&rx->lock, key);
+
+	if (!running) {
+		return 0;
+	}
+
+	return uart_rx_disable(rx->dev);
+}
+
+void uart_async_rx_on_event(struct uart_async_rx *rx, const struct uart_event *evt)
+{
+	k_spinlock_key_t key;
+	uint8_t *buf;
+
+	switch (evt->type) {
+	case UART_RX_BUF_REQUEST:
+		key = k_spin_lock(&rx->lock);
+		buf = buf_take(rx);
+		k_spin_unlock(&rx->lock, key);
+
+		if (buf != NULL) {
+			(void)uart_rx_buf_rsp(rx->dev, buf, rx->buf_len);
+		} else {
+			LOG_DBG("No free buffer, reception stops when the current one is full");
+		}
+		break;
+	case UART_RX_RDY:
+		key = k_spin_lock(&rx->lock);
+		rx->bufs[buf_idx(rx, evt->data.rx.buf)].wr_len =
+			evt->data.rx.offset + evt->data.rx.len;
+		k_spin_unlock(&rx->lock, key);
+		break;
+	case UART_RX_BUF_RELEASED:
+		key = k_spin_lock(&rx->lock);
+		rx->bufs[buf_idx(rx, evt->data.rx_buf.buf)].completed = true;
+		k_spin_unlock(&rx->lock, key);
+		break;
+	case UART_RX_DISABLED:
+		key = k_spin_lock(&rx->lock);
+
+		/* Every buffer is given back once reception is disabled */
+		for (uint8_t i = 0, idx = rx->rd_buf_idx; i < rx->buf_cnt - rx->free_buf_cnt;
+		     i++, idx = next_idx(rx, idx)) {
+			rx->bufs[idx].completed = true;
+		}
+
+		rx->stopped = true;
+		k_spin_unlock(&rx->lock, key);
+
+		(void)rx_restart(rx);
+		break;
+	default:
+		break;
+	}
+}
+
+size_t uart_async_rx_data_peek(struct uart_async_rx *rx, uint8_t **data)
+{
+	k_spinlock_key_t key = k_spin_lock(&rx->lock);
+	struct uart_async_rx_buf *buf;
+	size_t len = 0;
+	bool freed = false;
+
+	while (rx->free_buf_cnt < rx->buf_cnt) {
+		buf = &rx->bufs[rx->rd_buf_idx];
+
+		if (buf->wr_len > rx->rd_idx) {
+			*data = buf_addr(rx, rx->rd_buf_idx) + rx->rd_idx;
+			len = buf->wr_len - rx->rd_idx;
+			break;
+		}
+
+		if (!buf->completed) {
+			break;
+		}
+
+		/* Fully read buffer released by the driver */
+		rx->rd_buf_idx = next_idx(rx, rx->rd_buf_idx);
+		rx->rd_idx = 0;
+		rx->free_buf_cnt++;
+		freed = true;
+	}
+
+	k_spin_unlock(&rx->lock, key);
+
+	if (freed) {
+		(void)rx_restart(rx);
+	}
+
+	return len;
+}
+
+int uart_async_rx_data_release(struct uart_async_rx *rx, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&rx->lock);
+	struct uart_async_rx_buf *buf = &rx->bufs[rx->rd_buf_idx];
+	bool freed = false;
+
+	__ASSERT(rx->rd_idx + len <= buf->wr_len, "Releasing more than received");
+
+	rx->rd_idx += len;
+
+	if (buf->completed && rx->rd_idx == buf->wr_len) {
+		rx->rd_buf_idx = next_idx(rx, rx->rd_buf_idx);
+		rx->rd_idx = 0;
+		rx->free_buf_cnt++;
+		freed = true;
+	}
+
+	k_spin_unlock(&rx->lock, key);
+
+	return freed ? rx_restart(rx) : 0;
+}
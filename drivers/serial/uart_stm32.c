@@ -1437,9 +1437,6 @@ static void uart_stm32_dma_replace_buffer(const struct device *dev)
 	dma_start(data->dma_rx.dma_dev, data->dma_rx.dma_channel);
 
 	LL_USART_ClearFlag_IDLE(config->usart);
-
-	/* Request next buffer */
-	async_evt_rx_buf_request(data);
 }
 
 void uart_stm32_dma_rx_cb(const struct device *dma_dev, void *user_data,
@@ -1458,17 +1455,34 @@ void uart_stm32_dma_rx_cb(const struct device *dma_dev, void *user_data,
 	/* true since this functions occurs when buffer if full */
 	data->dma_rx.counter = data->dma_rx.buffer_length;
 
-	async_evt_rx_rdy(data);
-
 	if (data->rx_next_buffer != NULL) {
-		async_evt_rx_buf_release(data);
+		struct uart_event rdy_evt = {
+			.type = UART_RX_RDY,
+			.data.rx.buf = data->dma_rx.buffer,
+			.data.rx.len = data->dma_rx.counter - data->dma_rx.offset,
+			.data.rx.offset = data->dma_rx.offset
+		};
+		struct uart_event rel_evt = {
+			.type = UART_RX_BUF_RELEASED,
+			.data.rx_buf.buf = data->dma_rx.buffer,
+		};
 
-		/* replace the buffer when the current
-		 * is full and not the same as the next
-		 * one.
+		/* Reload the DMA with the next buffer before running the
+		 * user callbacks, otherwise bytes arriving while they run
+		 * are lost.
 		 */
 		uart_stm32_dma_replace_buffer(uart_dev);
+
+		if (rdy_evt.data.rx.len > 0) {
+			async_user_callback(data, &rdy_evt);
+		}
+		async_user_callback(data, &rel_evt);
+
+		/* Request next buffer */
+		async_evt_rx_buf_request(data);
 	} else {
+		async_evt_rx_rdy(data);
+
 		/* Buffer full without valid next buffer,
 		 * an UART_RX_DISABLED event must be generated,
 		 * but uart_stm32_async_rx_disable() cannot be
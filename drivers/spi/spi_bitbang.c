@@ -27,6 +27,43 @@ struct spi_bitbang_config {
 	struct gpio_dt_spec miso_gpio;
 };
 
+/*
+ * Pin resolved to its port mask and active level once per transfer, so that
+ * every bit only costs a raw port access.
+ */
+struct spi_bitbang_pin {
+	const struct device *port;
+	gpio_port_pins_t mask;
+	bool inverted;
+};
+
+static void spi_bitbang_pin_init(struct spi_bitbang_pin *pin,
+				 const struct gpio_dt_spec *spec)
+{
+	pin->port = spec->port;
+	pin->mask = BIT(spec->pin);
+	pin->inverted = (spec->dt_flags & GPIO_ACTIVE_LOW) != 0;
+}
+
+static inline void spi_bitbang_pin_set(const struct spi_bitbang_pin *pin,
+				       int value)
+{
+	if ((value != 0) != pin->inverted) {
+		gpio_port_set_bits_raw(pin->port, pin->mask);
+	} else {
+		gpio_port_clear_bits_raw(pin->port, pin->mask);
+	}
+}
+
+static inline int spi_bitbang_pin_get(const struct spi_bitbang_pin *pin)
+{
+	gpio_port_value_t value = 0;
+
+	(void)gpio_port_get_raw(pin->port, &value);
+
+	return ((value & pin->mask) != 0) != pin->inverted;
+}
+
 static int spi_bitbang_configure(const struct spi_bitbang_config *info,
 			    struct spi_bitbang_data *data,
 			    const struct spi_config *config)
@@ -78,6 +115,9 @@ static int spi_bitbang_transceive(const struct device *dev,
 	const struct gpio_dt_spec *miso = NULL;
 	const struct gpio_dt_spec *mosi = NULL;
 	gpio_flags_t mosi_flags = GPIO_OUTPUT_INACTIVE;
+	struct spi_bitbang_pin clk_pin;
+	struct spi_bitbang_pin mosi_pin = {0};
+	struct spi_bitbang_pin miso_pin = {0};
 
 	rc = spi_bitbang_configure(info, data, spi_cfg);
 	if (rc < 0) {
@@ -135,8 +175,16 @@ static int spi_bitbang_transceive(const struct device *dev,
 		loop = true;
 	}
 
+	spi_bitbang_pin_init(&clk_pin, &info->clk_gpio);
+	if (mosi) {
+		spi_bitbang_pin_init(&mosi_pin, mosi);
+	}
+	if (miso) {
+		spi_bitbang_pin_init(&miso_pin, miso);
+	}
+
 	/* set the initial clock state before CS */
-	gpio_pin_set_dt(&info->clk_gpio, clock_state);
+	spi_bitbang_pin_set(&clk_pin, clock_state);
 
 	spi_context_cs_control(ctx, true);
 
@@ -172,25 +220,25 @@ static int spi_bitbang_transceive(const struct device *dev,
 
 			/* setup data out first thing */
 			if (mosi) {
-				gpio_pin_set_dt(mosi, d);
+				spi_bitbang_pin_set(&mosi_pin, d);
 			}
 
 			k_busy_wait(wait_us);
 
 			/* first clock edge */
-			gpio_pin_set_dt(&info->clk_gpio, !clock_state);
+			spi_bitbang_pin_set(&clk_pin, !clock_state);
 
 			if (!loop && do_read && !cpha) {
-				b = gpio_pin_get_dt(miso);
+				b = spi_bitbang_pin_get(&miso_pin);
 			}
 
 			k_busy_wait(wait_us);
 
 			/* second clock edge */
-			gpio_pin_set_dt(&info->clk_gpio, clock_state);
+			spi_bitbang_pin_set(&clk_pin, clock_state);
 
 			if (!loop && do_read && cpha) {
-				b = gpio_pin_get_dt(miso);
+				b = spi_bitbang_pin_get(&miso_pin);
 			}
 
 			if (loop) {
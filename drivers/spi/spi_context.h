@@ -453,6 +453,80 @@ static inline size_t spi_context_total_rx_len(struct spi_context *ctx)
 	return total_len;
 }
 
+#ifdef CONFIG_SPI_RTIO
+/* Buffers describing a single RTIO submission to the context */
+struct spi_context_rtio_bufs {
+	struct spi_buf tx_buf;
+	struct spi_buf rx_buf;
+	struct spi_buf_set tx;
+	struct spi_buf_set rx;
+};
+
+/*
+ * Set up the context buffers from a RTIO submission, so that drivers can
+ * execute it with their context based transfer code. The buffers must be
+ * kept until the submission completes. A read using the mempool of the RTIO
+ * context gets one block of the pool.
+ */
+static inline int spi_context_rtio_buffers_setup(struct spi_context *ctx,
+						 struct spi_context_rtio_bufs *bufs,
+						 struct rtio_iodev_sqe *iodev_sqe,
+						 uint8_t dfs)
+{
+	struct rtio_sqe *sqe = &iodev_sqe->sqe;
+	const struct spi_buf_set *tx = NULL;
+	const struct spi_buf_set *rx = NULL;
+	uint8_t *buf;
+	uint32_t len;
+	int rc;
+
+	bufs->tx.buffers = &bufs->tx_buf;
+	bufs->tx.count = 1;
+	bufs->rx.buffers = &bufs->rx_buf;
+	bufs->rx.count = 1;
+
+	switch (sqe->op) {
+	case RTIO_OP_RX:
+		len = sqe->buf_len;
+		if ((sqe->flags & RTIO_SQE_MEMPOOL_BUFFER) && sqe->buf == NULL) {
+			len = rtio_mempool_block_size(iodev_sqe->r);
+		}
+		rc = rtio_sqe_rx_buf(iodev_sqe, len, len, &buf, &len);
+		if (rc != 0) {
+			return rc;
+		}
+		bufs->rx_buf.buf = buf;
+		bufs->rx_buf.len = len;
+		rx = &bufs->rx;
+		break;
+	case RTIO_OP_TX:
+		bufs->tx_buf.buf = sqe->buf;
+		bufs->tx_buf.len = sqe->buf_len;
+		tx = &bufs->tx;
+		break;
+	case RTIO_OP_TINY_TX:
+		bufs->tx_buf.buf = sqe->tiny_buf;
+		bufs->tx_buf.len = sqe->tiny_buf_len;
+		tx = &bufs->tx;
+		break;
+	case RTIO_OP_TXRX:
+		bufs->tx_buf.buf = sqe->tx_buf;
+		bufs->tx_buf.len = sqe->txrx_buf_len;
+		bufs->rx_buf.buf = sqe->rx_buf;
+		bufs->rx_buf.len = sqe->txrx_buf_len;
+		tx = &bufs->tx;
+		rx = &bufs->rx;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	spi_context_buffers_setup(ctx, tx, rx, dfs);
+
+	return 0;
+}
+#endif /* CONFIG_SPI_RTIO */
+
 #ifdef __cplusplus
 }
 #endif
@@ -15,6 +15,7 @@ LOG_MODULE_REGISTER(spi_ll_stm32);
 #include <soc.h>
 #include <stm32_ll_spi.h>
 #include <errno.h>
+#include <string.h>
 #include <zephyr/drivers/spi.h>
 #include <zephyr/drivers/pinctrl.h>
 #include <zephyr/toolchain.h>
@@ -428,19 +429,26 @@ static void spi_stm32_cs_control(const struct device *dev, bool on)
 #endif
 }
 
+#ifdef CONFIG_SPI_RTIO
+static void spi_stm32_iodev_complete(const struct device *dev, int status);
+#endif
+
 static void spi_stm32_complete(const struct device *dev, int status)
 {
 	const struct spi_stm32_config *cfg = dev->config;
 	SPI_TypeDef *spi = cfg->spi;
-#ifdef CONFIG_SPI_STM32_INTERRUPT
-	struct spi_stm32_data *data = dev->data;
+	struct spi_stm32_data *data __attribute__((unused)) = dev->data;
 
+#ifdef CONFIG_SPI_STM32_INTERRUPT
 	ll_func_disable_int_tx_empty(spi);
 	ll_func_disable_int_rx_not_empty(spi);
 	ll_func_disable_int_errors(spi);
 #endif
 
+#ifndef CONFIG_SPI_RTIO
+	/* With RTIO, this is turned off at the end of the transaction */
 	spi_stm32_cs_control(dev, false);
+#endif
 
 #if DT_HAS_COMPAT_STATUS_OKAY(st_stm32_spi_fifo)
 	/* Flush RX buffer */
@@ -461,7 +469,9 @@ static void spi_stm32_complete(const struct device *dev, int status)
 
 	ll_func_disable_spi(spi);
 
-#ifdef CONFIG_SPI_STM32_INTERRUPT
+#ifdef CONFIG_SPI_RTIO
+	spi_stm32_iodev_complete(dev, status);
+#elif defined(CONFIG_SPI_STM32_INTERRUPT)
 	spi_context_complete(&data->ctx, dev, status);
 #endif
 }
@@ -509,6 +519,14 @@ static int spi_stm32_configure(const struct device *dev,
 	uint32_t clock;
 	int br;
 
+#ifdef CONFIG_SPI_RTIO
+	/* The configuration of blocking calls is copied in place */
+	if (config == &data->dt_spec.config && data->dt_spec_changed) {
+		data->dt_spec_changed = false;
+		data->ctx.config = NULL;
+	}
+#endif
+
 	if (spi_context_configured(&data->ctx, config)) {
 		/* Nothing to do */
 		return 0;
@@ -645,6 +663,180 @@ static int spi_stm32_release(const struct device *dev,
 	return 0;
 }
 
+#ifdef CONFIG_SPI_RTIO
+static void spi_stm32_iodev_start(const struct device *dev)
+{
+	const struct spi_stm32_config *cfg = dev->config;
+	struct spi_stm32_data *data = dev->data;
+	SPI_TypeDef *spi = cfg->spi;
+	uint8_t dfs;
+	int ret;
+
+	dfs = (SPI_WORD_SIZE_GET(data->ctx.config->operation) == 8) ? 1 : 2;
+	ret = spi_context_rtio_buffers_setup(&data->ctx, &data->rtio_bufs,
+					     data->txn_curr, dfs);
+	if (ret != 0) {
+		spi_stm32_iodev_complete(dev, ret);
+		return;
+	}
+
+#if DT_HAS_COMPAT_STATUS_OKAY(st_stm32_spi_fifo)
+	/* Flush RX buffer */
+	while (ll_func_rx_is_not_empty(spi)) {
+		(void) LL_SPI_ReceiveData8(spi);
+	}
+#endif
+
+	LL_SPI_Enable(spi);
+
+#if CONFIG_SOC_SERIES_STM32H7X
+	/*
+	 * Add a small delay after enabling to prevent transfer stalling at high
+	 * system clock frequency (see errata sheet ES0392).
+	 */
+	k_busy_wait(WAIT_1US);
+#endif
+
+#ifdef CONFIG_SPI_STM32_INTERRUPT
+	/* Completes from the SPI interrupt, without any thread */
+	ll_func_enable_int_errors(spi);
+
+	if (data->ctx.rx_len > 0) {
+		ll_func_enable_int_rx_not_empty(spi);
+	}
+
+	ll_func_enable_int_tx_empty(spi);
+#else
+	do {
+		ret = spi_stm32_shift_frames(spi, data);
+	} while (!ret && spi_stm32_transfer_ongoing(data));
+
+	spi_stm32_complete(dev, ret);
+#endif
+}
+
+static void spi_stm32_iodev_next(const struct device *dev, bool completion)
+{
+	struct spi_stm32_data *data = dev->data;
+	const struct spi_dt_spec *dt_spec;
+	struct rtio_iodev_sqe *txn;
+	struct rtio_mpsc_node *next;
+	k_spinlock_key_t key;
+	int ret;
+
+	do {
+		key = k_spin_lock(&data->lock);
+
+		if (!completion && data->txn_curr != NULL) {
+			k_spin_unlock(&data->lock, key);
+			return;
+		}
+
+		next = rtio_mpsc_pop(&data->iodev.iodev_sq);
+		txn = (next != NULL) ?
+		      CONTAINER_OF(next, struct rtio_iodev_sqe, q) : NULL;
+
+		data->txn_head = txn;
+		data->txn_curr = txn;
+
+		k_spin_unlock(&data->lock, key);
+
+		if (txn == NULL) {
+			return;
+		}
+
+		dt_spec = txn->sqe.iodev->data;
+		ret = spi_stm32_configure(dev, &dt_spec->config);
+		if (ret != 0) {
+			rtio_iodev_sqe_err(txn, ret);
+			completion = true;
+		}
+	} while (ret != 0);
+
+	/* This is turned off at the end of the transaction */
+	spi_stm32_cs_control(dev, true);
+	spi_stm32_iodev_start(dev);
+}
+
+static void spi_stm32_iodev_complete(const struct device *dev, int status)
+{
+	struct spi_stm32_data *data = dev->data;
+	struct rtio_iodev_sqe *txn_head = data->txn_head;
+
+	if (status == 0 && (data->txn_curr->sqe.flags & RTIO_SQE_TRANSACTION)) {
+		/* Keep the chip selected for the whole transaction */
+		data->txn_curr = rtio_txn_next(data->txn_curr);
+		spi_stm32_iodev_start(dev);
+		return;
+	}
+
+	spi_stm32_cs_control(dev, false);
+	spi_stm32_iodev_next(dev, true);
+
+	if (status == 0) {
+		rtio_iodev_sqe_ok(txn_head, 0);
+	} else {
+		rtio_iodev_sqe_err(txn_head, status);
+	}
+}
+
+static void spi_stm32_iodev_submit(const struct device *dev,
+				   struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct spi_stm32_data *data = dev->data;
+
+	rtio_mpsc_push(&data->iodev.iodev_sq, &iodev_sqe->q);
+	spi_stm32_iodev_next(dev, false);
+}
+
+static int transceive_rtio(const struct device *dev,
+			   const struct spi_config *config,
+			   const struct spi_buf_set *tx_bufs,
+			   const struct spi_buf_set *rx_bufs)
+{
+	struct spi_stm32_data *data = dev->data;
+	struct spi_dt_spec *dt_spec = &data->dt_spec;
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	int err = 0;
+	int ret;
+
+	if (!tx_bufs && !rx_bufs) {
+		return 0;
+	}
+
+	spi_context_lock(&data->ctx, false, NULL, NULL, config);
+
+	if (memcmp(&dt_spec->config, config, sizeof(*config)) != 0) {
+		dt_spec->config = *config;
+		data->dt_spec_changed = true;
+	}
+
+	ret = spi_rtio_copy(data->r, &data->iodev, tx_bufs, rx_bufs, &sqe);
+	if (ret < 0) {
+		err = ret;
+		goto end;
+	}
+
+	/* Submit request and wait */
+	rtio_submit(data->r, ret);
+
+	while (ret > 0) {
+		cqe = rtio_cqe_consume(data->r);
+		if (cqe->result < 0) {
+			err = cqe->result;
+		}
+
+		rtio_cqe_release(data->r, cqe);
+		ret--;
+	}
+
+end:
+	spi_context_release(&data->ctx, err);
+
+	return err;
+}
+#else
 static int transceive(const struct device *dev,
 		      const struct spi_config *config,
 		      const struct spi_buf_set *tx_bufs,
@@ -732,6 +924,7 @@ end:
 
 	return ret;
 }
+#endif /* CONFIG_SPI_RTIO */
 
 #ifdef CONFIG_SPI_STM32_DMA
 
@@ -957,7 +1150,11 @@ static int spi_stm32_transceive(const struct device *dev,
 				      false, NULL, NULL);
 	}
 #endif /* CONFIG_SPI_STM32_DMA */
+#ifdef CONFIG_SPI_RTIO
+	return transceive_rtio(dev, config, tx_bufs, rx_bufs);
+#else
 	return transceive(dev, config, tx_bufs, rx_bufs, false, NULL, NULL);
+#endif
 }
 
 #ifdef CONFIG_SPI_ASYNC
@@ -968,7 +1165,12 @@ static int spi_stm32_transceive_async(const struct device *dev,
 				      spi_callback_t cb,
 				      void *userdata)
 {
+#ifdef CONFIG_SPI_RTIO
+	/* Asynchronous requests are submitted through RTIO instead */
+	return -ENOTSUP;
+#else
 	return transceive(dev, config, tx_bufs, rx_bufs, true, cb, userdata);
+#endif
 }
 #endif /* CONFIG_SPI_ASYNC */
 
@@ -976,6 +1178,9 @@ static const struct spi_driver_api api_funcs = {
 	.transceive = spi_stm32_transceive,
 #ifdef CONFIG_SPI_ASYNC
 	.transceive_async = spi_stm32_transceive_async,
+#endif
+#ifdef CONFIG_SPI_RTIO
+	.iodev_submit = spi_stm32_iodev_submit,
 #endif
 	.release = spi_stm32_release,
 };
@@ -1055,6 +1260,13 @@ static int spi_stm32_init(const struct device *dev)
 		return err;
 	}
 
+#ifdef CONFIG_SPI_RTIO
+	data->dt_spec.bus = dev;
+	data->iodev.api = &spi_iodev_api;
+	data->iodev.data = &data->dt_spec;
+	rtio_mpsc_init(&data->iodev.iodev_sq);
+#endif
+
 	spi_context_unlock_unconditionally(&data->ctx);
 
 	return 0;
@@ -1128,6 +1340,17 @@ static void spi_stm32_irq_config_func_##id(const struct device *dev)		\
 #define STM32_SPI_USE_SUBGHZSPI_NSS_CONFIG(id)
 #endif
 
+#ifdef CONFIG_SPI_RTIO
+#define STM32_SPI_RTIO_DEFINE(id)					\
+	RTIO_DEFINE(spi_stm32_rtio_##id, CONFIG_SPI_STM32_RTIO_SQ_SIZE,	\
+		    CONFIG_SPI_STM32_RTIO_SQ_SIZE);
+#define STM32_SPI_RTIO_INIT(id)						\
+	.r = &spi_stm32_rtio_##id,
+#else
+#define STM32_SPI_RTIO_DEFINE(id)
+#define STM32_SPI_RTIO_INIT(id)
+#endif
+
 
 
 #define STM32_SPI_INIT(id)						\
@@ -1135,6 +1358,8 @@ STM32_SPI_IRQ_HANDLER_DECL(id);						\
 									\
 PINCTRL_DT_INST_DEFINE(id);						\
 									\
+STM32_SPI_RTIO_DEFINE(id)						\
+									\
 static const struct stm32_pclken pclken_##id[] =			\
 					       STM32_DT_INST_CLOCKS(id);\
 									\
@@ -1153,6 +1378,7 @@ static struct spi_stm32_data spi_stm32_dev_data_##id = {		\
 	SPI_DMA_CHANNEL(id, rx, RX, PERIPHERAL, MEMORY)			\
 	SPI_DMA_CHANNEL(id, tx, TX, MEMORY, PERIPHERAL)			\
 	SPI_DMA_STATUS_SEM(id)						\
+	STM32_SPI_RTIO_INIT(id)						\
 	SPI_CONTEXT_CS_GPIOS_INITIALIZE(DT_DRV_INST(id), ctx)		\
 };									\
 									\
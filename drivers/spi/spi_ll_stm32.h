@@ -63,6 +63,16 @@ struct spi_stm32_data {
 	struct stream dma_rx;
 	struct stream dma_tx;
 #endif /* CONFIG_SPI_STM32_DMA */
+#ifdef CONFIG_SPI_RTIO
+	struct k_spinlock lock;
+	struct rtio *r; /* context for blocking calls */
+	struct rtio_iodev iodev;
+	struct rtio_iodev_sqe *txn_head;
+	struct rtio_iodev_sqe *txn_curr;
+	struct spi_context_rtio_bufs rtio_bufs;
+	struct spi_dt_spec dt_spec;
+	bool dt_spec_changed;
+#endif /* CONFIG_SPI_RTIO */
 };
 
 #ifdef CONFIG_SPI_STM32_DMA
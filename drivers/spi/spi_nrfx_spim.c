@@ -48,6 +48,16 @@ struct spi_nrfx_data {
 	uint8_t ppi_ch;
 	uint8_t gpiote_ch;
 #endif
+#ifdef CONFIG_SPI_RTIO
+	struct k_spinlock lock;
+	struct rtio *r; /* context for blocking calls */
+	struct rtio_iodev iodev;
+	struct rtio_iodev_sqe *txn_head;
+	struct rtio_iodev_sqe *txn_curr;
+	struct spi_context_rtio_bufs rtio_bufs;
+	struct spi_dt_spec dt_spec;
+	bool dt_spec_changed;
+#endif
 };
 
 struct spi_nrfx_config {
@@ -64,6 +74,9 @@ struct spi_nrfx_config {
 };
 
 static void event_handler(const nrfx_spim_evt_t *p_event, void *p_context);
+#ifdef CONFIG_SPI_RTIO
+static void spi_nrfx_iodev_complete(const struct device *dev, int error);
+#endif
 
 static inline uint32_t get_nrf_spim_frequency(uint32_t frequency)
 {
@@ -126,6 +139,14 @@ static int configure(const struct device *dev,
 	nrfx_spim_config_t config;
 	nrfx_err_t result;
 
+#ifdef CONFIG_SPI_RTIO
+	/* The configuration of blocking calls is copied in place */
+	if (spi_cfg == &dev_data->dt_spec.config && dev_data->dt_spec_changed) {
+		dev_data->dt_spec_changed = false;
+		ctx->config = NULL;
+	}
+#endif
+
 	if (dev_data->initialized && spi_context_configured(ctx, spi_cfg)) {
 		/* Already configured. No need to do it again. */
 		return 0;
@@ -289,6 +310,13 @@ static void finish_transaction(const struct device *dev, int error)
 	struct spi_nrfx_data *dev_data = dev->data;
 	struct spi_context *ctx = &dev_data->ctx;
 
+#ifdef CONFIG_SPI_RTIO
+	if (dev_data->txn_curr != NULL) {
+		spi_nrfx_iodev_complete(dev, error);
+		return;
+	}
+#endif
+
 	spi_context_cs_control(ctx, false);
 
 	LOG_DBG("Transaction finished with status %d", error);
@@ -380,6 +408,150 @@ static void event_handler(const nrfx_spim_evt_t *p_event, void *p_context)
 	}
 }
 
+#ifdef CONFIG_SPI_RTIO
+static void spi_nrfx_iodev_start(const struct device *dev)
+{
+	struct spi_nrfx_data *dev_data = dev->data;
+	int error;
+
+	error = spi_context_rtio_buffers_setup(&dev_data->ctx,
+					       &dev_data->rtio_bufs,
+					       dev_data->txn_curr, 1);
+	if (error != 0) {
+		spi_nrfx_iodev_complete(dev, error);
+		return;
+	}
+
+	/* Completes from the EasyDMA END event, without any thread */
+	transfer_next_chunk(dev);
+}
+
+static void spi_nrfx_iodev_next(const struct device *dev, bool completion)
+{
+	struct spi_nrfx_data *dev_data = dev->data;
+	const struct spi_nrfx_config *dev_config = dev->config;
+	const struct spi_dt_spec *dt_spec;
+	struct rtio_iodev_sqe *txn;
+	struct rtio_mpsc_node *next;
+	k_spinlock_key_t key;
+	int error;
+
+	do {
+		key = k_spin_lock(&dev_data->lock);
+
+		if (!completion && dev_data->txn_curr != NULL) {
+			k_spin_unlock(&dev_data->lock, key);
+			return;
+		}
+
+		next = rtio_mpsc_pop(&dev_data->iodev.iodev_sq);
+		txn = (next != NULL) ?
+		      CONTAINER_OF(next, struct rtio_iodev_sqe, q) : NULL;
+
+		dev_data->txn_head = txn;
+		dev_data->txn_curr = txn;
+		dev_data->busy = (txn != NULL);
+
+		k_spin_unlock(&dev_data->lock, key);
+
+		if (txn == NULL) {
+			return;
+		}
+
+		dt_spec = txn->sqe.iodev->data;
+		error = configure(dev, &dt_spec->config);
+		if (error != 0) {
+			rtio_iodev_sqe_err(txn, error);
+			completion = true;
+		}
+	} while (error != 0);
+
+	if (dev_config->wake_pin != WAKE_PIN_NOT_USED) {
+		if (spi_nrfx_wake_request(dev_config->wake_pin) == -ETIMEDOUT) {
+			LOG_WRN("Waiting for WAKE acknowledgment timed out");
+		}
+	}
+
+	spi_context_cs_control(&dev_data->ctx, true);
+	spi_nrfx_iodev_start(dev);
+}
+
+static void spi_nrfx_iodev_complete(const struct device *dev, int error)
+{
+	struct spi_nrfx_data *dev_data = dev->data;
+	struct rtio_iodev_sqe *txn_head = dev_data->txn_head;
+
+	if (error == 0 && (dev_data->txn_curr->sqe.flags & RTIO_SQE_TRANSACTION)) {
+		/* Keep the chip selected for the whole transaction */
+		dev_data->txn_curr = rtio_txn_next(dev_data->txn_curr);
+		spi_nrfx_iodev_start(dev);
+		return;
+	}
+
+	spi_context_cs_control(&dev_data->ctx, false);
+	spi_nrfx_iodev_next(dev, true);
+
+	if (error == 0) {
+		rtio_iodev_sqe_ok(txn_head, 0);
+	} else {
+		rtio_iodev_sqe_err(txn_head, error);
+	}
+}
+
+static void spi_nrfx_iodev_submit(const struct device *dev,
+				  struct rtio_iodev_sqe *iodev_sqe)
+{
+	struct spi_nrfx_data *dev_data = dev->data;
+
+	rtio_mpsc_push(&dev_data->iodev.iodev_sq, &iodev_sqe->q);
+	spi_nrfx_iodev_next(dev, false);
+}
+
+static int transceive_rtio(const struct device *dev,
+			   const struct spi_config *spi_cfg,
+			   const struct spi_buf_set *tx_bufs,
+			   const struct spi_buf_set *rx_bufs)
+{
+	struct spi_nrfx_data *dev_data = dev->data;
+	struct spi_dt_spec *dt_spec = &dev_data->dt_spec;
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	int error = 0;
+	int ret;
+
+	spi_context_lock(&dev_data->ctx, false, NULL, NULL, spi_cfg);
+
+	if (memcmp(&dt_spec->config, spi_cfg, sizeof(*spi_cfg)) != 0) {
+		dt_spec->config = *spi_cfg;
+		dev_data->dt_spec_changed = true;
+	}
+
+	ret = spi_rtio_copy(dev_data->r, &dev_data->iodev, tx_bufs, rx_bufs,
+			    &sqe);
+	if (ret < 0) {
+		error = ret;
+		goto out;
+	}
+
+	/* Submit request and wait */
+	rtio_submit(dev_data->r, ret);
+
+	while (ret > 0) {
+		cqe = rtio_cqe_consume(dev_data->r);
+		if (cqe->result < 0) {
+			error = cqe->result;
+		}
+
+		rtio_cqe_release(dev_data->r, cqe);
+		ret--;
+	}
+
+out:
+	spi_context_release(&dev_data->ctx, error);
+
+	return error;
+}
+#else
 static int transceive(const struct device *dev,
 		      const struct spi_config *spi_cfg,
 		      const struct spi_buf_set *tx_bufs,
@@ -446,13 +618,18 @@ static int transceive(const struct device *dev,
 
 	return error;
 }
+#endif /* CONFIG_SPI_RTIO */
 
 static int spi_nrfx_transceive(const struct device *dev,
 			       const struct spi_config *spi_cfg,
 			       const struct spi_buf_set *tx_bufs,
 			       const struct spi_buf_set *rx_bufs)
 {
+#ifdef CONFIG_SPI_RTIO
+	return transceive_rtio(dev, spi_cfg, tx_bufs, rx_bufs);
+#else
 	return transceive(dev, spi_cfg, tx_bufs, rx_bufs, false, NULL, NULL);
+#endif
 }
 
 #ifdef CONFIG_SPI_ASYNC
@@ -463,7 +640,12 @@ static int spi_nrfx_transceive_async(const struct device *dev,
 				     spi_callback_t cb,
 				     void *userdata)
 {
+#ifdef CONFIG_SPI_RTIO
+	/* Asynchronous requests are submitted through RTIO instead */
+	return -ENOTSUP;
+#else
 	return transceive(dev, spi_cfg, tx_bufs, rx_bufs, true, cb, userdata);
+#endif
 }
 #endif /* CONFIG_SPI_ASYNC */
 
@@ -489,6 +671,9 @@ static const struct spi_driver_api spi_nrfx_driver_api = {
 	.transceive = spi_nrfx_transceive,
 #ifdef CONFIG_SPI_ASYNC
 	.transceive_async = spi_nrfx_transceive_async,
+#endif
+#ifdef CONFIG_SPI_RTIO
+	.iodev_submit = spi_nrfx_iodev_submit,
 #endif
 	.release = spi_nrfx_release,
 };
@@ -565,6 +750,13 @@ static int spi_nrfx_init(const struct device *dev)
 		return err;
 	}
 
+#ifdef CONFIG_SPI_RTIO
+	dev_data->dt_spec.bus = dev;
+	dev_data->iodev.api = &spi_iodev_api;
+	dev_data->iodev.data = &dev_data->dt_spec;
+	rtio_mpsc_init(&dev_data->iodev.iodev_sq);
+#endif
+
 	spi_context_unlock_unconditionally(&dev_data->ctx);
 
 #ifdef CONFIG_SOC_NRF52832_ALLOW_SPIM_DESPITE_PAN_58
@@ -602,12 +794,17 @@ static int spi_nrfx_init(const struct device *dev)
 		(static uint8_t spim_##idx##_buffer			       \
 			[CONFIG_SPI_NRFX_RAM_BUFFER_SIZE]		       \
 			SPIM_MEMORY_SECTION(idx);))			       \
+	IF_ENABLED(CONFIG_SPI_RTIO,					       \
+		(RTIO_DEFINE(spi_##idx##_rtio, CONFIG_SPI_NRFX_RTIO_SQ_SIZE,   \
+			     CONFIG_SPI_NRFX_RTIO_SQ_SIZE);))		       \
 	static struct spi_nrfx_data spi_##idx##_data = {		       \
 		SPI_CONTEXT_INIT_LOCK(spi_##idx##_data, ctx),		       \
 		SPI_CONTEXT_INIT_SYNC(spi_##idx##_data, ctx),		       \
 		SPI_CONTEXT_CS_GPIOS_INITIALIZE(SPIM(idx), ctx)		       \
 		IF_ENABLED(SPI_BUFFER_IN_RAM,				       \
 			(.buffer = spim_##idx##_buffer,))		       \
+		IF_ENABLED(CONFIG_SPI_RTIO,				       \
+			(.r = &spi_##idx##_rtio,))			       \
 		.dev  = DEVICE_DT_GET(SPIM(idx)),			       \
 		.busy = false,						       \
 	};								       \
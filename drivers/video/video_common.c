@@ -7,10 +7,22 @@
 
 #include <zephyr/drivers/video.h>
 
+#if defined(CONFIG_VIDEO_BUFFER_USE_SHARED_MULTI_HEAP)
+#include <zephyr/multi_heap/shared_multi_heap.h>
+
+#define VIDEO_COMMON_HEAP_ALLOC(align, size, timeout) \
+	shared_multi_heap_aligned_alloc(CONFIG_VIDEO_BUFFER_SMH_ATTRIBUTE, align, size)
+#define VIDEO_COMMON_FREE(block) shared_multi_heap_free(block)
+#else
 K_HEAP_DEFINE(video_buffer_pool,
 	      CONFIG_VIDEO_BUFFER_POOL_SZ_MAX *
 	      CONFIG_VIDEO_BUFFER_POOL_NUM_MAX);
 
+#define VIDEO_COMMON_HEAP_ALLOC(align, size, timeout) \
+	k_heap_aligned_alloc(&video_buffer_pool, align, size, timeout)
+#define VIDEO_COMMON_FREE(block) k_heap_free(&video_buffer_pool, block)
+#endif
+
 static struct video_buffer video_buf[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
 
 struct mem_block {
@@ -19,7 +31,7 @@ struct mem_block {
 
 static struct mem_block video_block[CONFIG_VIDEO_BUFFER_POOL_NUM_MAX];
 
-struct video_buffer *video_buffer_alloc(size_t size)
+struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align)
 {
 	struct video_buffer *vbuf = NULL;
 	struct mem_block *block;
@@ -39,7 +51,7 @@ struct video_buffer *video_buffer_alloc(size_t size)
 	}
 
 	/* Alloc buffer memory */
-	block->data = k_heap_alloc(&video_buffer_pool, size, K_FOREVER);
+	block->data = VIDEO_COMMON_HEAP_ALLOC(align, size, K_FOREVER);
 	if (block->data == NULL) {
 		return NULL;
 	}
@@ -51,6 +63,11 @@ struct video_buffer *video_buffer_alloc(size_t size)
 	return vbuf;
 }
 
+struct video_buffer *video_buffer_alloc(size_t size)
+{
+	return video_buffer_aligned_alloc(size, CONFIG_VIDEO_BUFFER_POOL_ALIGN);
+}
+
 void video_buffer_release(struct video_buffer *vbuf)
 {
 	struct mem_block *block = NULL;
@@ -66,6 +83,6 @@ void video_buffer_release(struct video_buffer *vbuf)
 
 	vbuf->buffer = NULL;
 	if (block) {
-		k_heap_free(&video_buffer_pool, block->data);
+		VIDEO_COMMON_FREE(block->data);
 	}
 }
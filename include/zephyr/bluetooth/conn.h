@@ -501,6 +501,33 @@ enum bt_conn_auth_keypress {
  */
 int bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info);
 
+/** @brief Connection TX statistics.
+ *
+ *  The latency of a packet is the time from when it is queued for the
+ *  connection until its last fragment is handed to the controller.
+ */
+struct bt_conn_tx_stats {
+	/** Number of ACL packets handed to the controller */
+	uint32_t packets;
+	/** Highest latency of a packet, in microseconds */
+	uint32_t latency_max_us;
+	/** Sum of the latencies of all the packets, in microseconds */
+	uint64_t latency_total_us;
+};
+
+/** @brief Get connection TX statistics.
+ *
+ *  @kconfig{CONFIG_BT_CONN_TX_STATS} must be enabled to use this API.
+ *
+ *  @param conn Connection object.
+ *  @param stats Statistics object to fill.
+ *  @param reset Reset the statistics of the connection after reading them.
+ *
+ *  @return Zero on success or (negative) error code on failure.
+ */
+int bt_conn_tx_stats_get(struct bt_conn *conn, struct bt_conn_tx_stats *stats,
+			 bool reset);
+
 /** @brief Get connection info for the remote device.
  *
  *  @param conn Connection object.
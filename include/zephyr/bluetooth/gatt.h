@@ -1059,6 +1059,30 @@ struct bt_gatt_notify_params {
 int bt_gatt_notify_cb(struct bt_conn *conn,
 		      struct bt_gatt_notify_params *params);
 
+/** @brief Notify attribute value change to a set of connections.
+ *
+ *  This function works in the same way as @ref bt_gatt_notify_cb but sends
+ *  the notification to each of the given connections that is subscribed to
+ *  it. The attribute, its handle and its CCC descriptor are only looked up
+ *  once for all the connections, which makes this cheaper than calling
+ *  @ref bt_gatt_notify_cb for each connection when the same value is sent
+ *  to many peers.
+ *
+ *  Connections that are not connected or not subscribed are skipped.
+ *  The callback, if set, is called once for each connection the
+ *  notification was queued for.
+ *
+ *  @param conns Array of connection objects.
+ *  @param num_conns Number of elements in @p conns.
+ *  @param params Notification parameters.
+ *
+ *  @return Number of connections the notification was queued for, or a
+ *          negative value if it could not be queued for any of them.
+ *  @retval -ENOENT The attribute or its CCC descriptor was not found.
+ */
+int bt_gatt_notify_conns(struct bt_conn *conns[], size_t num_conns,
+			 struct bt_gatt_notify_params *params);
+
 /** @brief Send multiple notifications in a single PDU.
  *
  *  The GATT Server will send a single ATT_MULTIPLE_HANDLE_VALUE_NTF PDU
@@ -47,6 +47,28 @@ struct bt_mesh_statistic {
 	uint32_t tx_friend_planned;
 	/** Counter of frames that succeeded to send over friend bearer. */
 	uint32_t tx_friend_succeeded;
+	/** Counter of frames to relay dropped for lack of advertising buffers. */
+	uint32_t tx_adv_relay_dropped;
+	/** Counter of local frames dropped for lack of advertising buffers. */
+	uint32_t tx_local_dropped;
+	/** Counter of friend frames dropped for lack of advertising buffers. */
+	uint32_t tx_friend_dropped;
+	/** Frames to relay currently waiting for an advertiser. */
+	uint32_t tx_adv_relay_queued;
+	/** Local frames currently waiting for an advertiser. */
+	uint32_t tx_local_queued;
+	/** Friend frames currently waiting for an advertiser. */
+	uint32_t tx_friend_queued;
+	/** Highest number of frames to relay waiting for an advertiser. */
+	uint32_t tx_adv_relay_queued_max;
+	/** Highest number of local frames waiting for an advertiser. */
+	uint32_t tx_local_queued_max;
+	/** Highest number of friend frames waiting for an advertiser. */
+	uint32_t tx_friend_queued_max;
+	/** Network PDUs deobfuscated and decrypted with a key matching their NID. */
+	uint32_t rx_decrypt_attempts;
+	/** Decryption attempts which failed authentication. */
+	uint32_t rx_decrypt_failed;
 };
 
 /** @brief Get mesh frame handling statistic.
@@ -136,6 +136,9 @@ struct coredump_cmd_copy_arg {
 #define	COREDUMP_MEM_HDR_ID		'M'
 #define COREDUMP_MEM_HDR_VER		1
 
+/* Memory block with run-length encoded content */
+#define COREDUMP_MEM_HDR_VER_RLE	2
+
 /* Target code */
 enum coredump_tgt_code {
 	COREDUMP_TGT_UNKNOWN = 0,
@@ -265,6 +268,44 @@ int coredump_cmd(enum coredump_cmd_id query_id, void *arg)
 
 #endif /* CONFIG_DEBUG_COREDUMP */
 
+#if defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS) || defined(__DOXYGEN__)
+
+#include <zephyr/sys/iterable_sections.h>
+
+/** @brief Memory region marked for dumping */
+struct coredump_memory_region {
+	/** Start address of the region */
+	const void *start;
+	/** Size of the region in bytes */
+	size_t size;
+};
+
+/**
+ * @brief Mark a memory region to be included in the core dump.
+ *
+ * Marked regions are dumped when only threads and kernel objects are
+ * (@kconfig{CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS}), for example to
+ * add the state of an application module. With other memory dump choices
+ * the macro does nothing.
+ *
+ * @param _name Name of the marking, must be a valid C identifier.
+ * @param _start Start address of the region.
+ * @param _size Size of the region in bytes.
+ */
+#define COREDUMP_MEMORY_REGION_DEFINE(_name, _start, _size)                    \
+	static const STRUCT_SECTION_ITERABLE(coredump_memory_region,           \
+					     _coredump_region_##_name) = {     \
+		.start = (_start),                                             \
+		.size = (_size),                                               \
+	}
+
+#else
+
+#define COREDUMP_MEMORY_REGION_DEFINE(_name, _start, _size)                    \
+	extern int _coredump_region_unused_##_name
+
+#endif /* CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS */
+
 /**
  * @fn void coredump(unsigned int reason, const z_arch_esf_t *esf, struct k_thread *thread);
  * @brief Perform coredump.
@@ -65,6 +65,15 @@ void thread_analyzer_run(thread_analyzer_cb cb);
  */
 void thread_analyzer_print(void);
 
+/** @brief Print the peak stack usage of threads.
+ *
+ *  This function prints the highest stack usage of every named thread seen
+ *  by the thread analyzer, including in previous boots, in a form that
+ *  scripts/footprint/thread_stack_profile.py reads.
+ *  Requires CONFIG_THREAD_ANALYZER_PEAK.
+ */
+void thread_analyzer_peak_print(void);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -17,6 +17,14 @@
 
 #include <zephyr/storage/stream_flash.h>
 
+#if defined(CONFIG_IMG_STREAM_HASH)
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_TC)
+#include <tinycrypt/sha256.h>
+#else
+#include <mbedtls/sha256.h>
+#endif
+#endif
+
 /**
  * @brief Abstraction layer to write firmware images to flash
  *
@@ -31,8 +39,22 @@ extern "C" {
 
 struct flash_img_context {
 	uint8_t buf[CONFIG_IMG_BLOCK_BUF_SIZE];
+#if defined(CONFIG_IMG_STREAM_PIPELINE)
+	uint8_t buf2[CONFIG_IMG_BLOCK_BUF_SIZE];
+#endif
 	const struct flash_area *flash_area;
 	struct stream_flash_ctx stream;
+#if defined(CONFIG_IMG_STREAM_HASH)
+#if defined(CONFIG_FLASH_AREA_CHECK_INTEGRITY_TC)
+	struct tc_sha256_state_struct sha;
+#else
+	mbedtls_sha256_context sha;
+#endif
+	uint8_t digest[32];
+	size_t hashed;
+	uint8_t area_id;
+	bool hash_valid;
+#endif
 };
 
 /**
@@ -111,6 +133,98 @@ int flash_img_check(struct flash_img_context *ctx,
 		    const struct flash_img_check *fic,
 		    uint8_t area_id);
 
+#if defined(CONFIG_IMG_DELTA) || defined(__DOXYGEN__)
+
+/**
+ * @brief Context to reconstruct an image from a delta patch.
+ *
+ * The patch is a stream of little endian fields: a 32-bit magic
+ * (FLASH_IMG_DELTA_MAGIC), the 32-bit size of the reconstructed image,
+ * then operations made of an opcode byte and an unsigned LEB128 argument:
+ *
+ * - FLASH_IMG_DELTA_OP_COPY n: copy n bytes of the source image.
+ * - FLASH_IMG_DELTA_OP_ADD n, followed by n bytes: add (modulo 256) each
+ *   byte to the next byte of the source image.
+ * - FLASH_IMG_DELTA_OP_INSERT n, followed by n bytes: insert the bytes.
+ * - FLASH_IMG_DELTA_OP_SEEK n: move the source image position by n, a
+ *   zigzag encoded signed value.
+ *
+ * COPY and ADD advance the position in the source image, INSERT does not.
+ * This is the control, diff and extra blocks of bsdiff, with runs of zero
+ * diff bytes turned into COPY operations.
+ */
+struct flash_img_delta_context {
+	/** Writer of the reconstructed image */
+	struct flash_img_context img;
+	/** Flash area of the source image */
+	const struct flash_area *source;
+	/** Position in the source image */
+	size_t source_off;
+	/** Size of the reconstructed image */
+	size_t size;
+	/** Number of bytes of the reconstructed image already output */
+	size_t written;
+	/** Argument of the current operation, or bytes left of its data */
+	uint32_t arg;
+	/** Number of argument or header bits already decoded */
+	uint8_t shift;
+	/** Current operation */
+	uint8_t op;
+	/** Parser state */
+	uint8_t state;
+	/** Buffer for the source image data */
+	uint8_t buf[CONFIG_IMG_DELTA_BUF_SIZE];
+};
+
+/** Magic value of a delta patch, "DLT1" */
+#define FLASH_IMG_DELTA_MAGIC		0x31544c44
+/** Copy bytes of the source image */
+#define FLASH_IMG_DELTA_OP_COPY		0x01
+/** Add bytes to the ones of the source image */
+#define FLASH_IMG_DELTA_OP_ADD		0x02
+/** Insert bytes */
+#define FLASH_IMG_DELTA_OP_INSERT	0x03
+/** Move in the source image */
+#define FLASH_IMG_DELTA_OP_SEEK		0x04
+
+/**
+ * @brief Initialize context needed to write an image reconstructed from a
+ * delta patch.
+ *
+ * The function is enabled via CONFIG_IMG_DELTA Kconfig option.
+ *
+ * @param ctx            context to be initialized
+ * @param source_area_id flash area id of partition holding the source image,
+ *                       usually the one of the running image
+ * @param area_id        flash area id of partition where the image should be
+ *                       written
+ *
+ * @return  0 on success, negative errno code on fail
+ */
+int flash_img_delta_init_id(struct flash_img_delta_context *ctx,
+			    uint8_t source_area_id, uint8_t area_id);
+
+/**
+ * @brief Process delta patch data and write the reconstructed image.
+ *
+ * The patch can be passed in pieces of any size. The final call must set
+ * flush, once the whole patch has been passed, to write out the remaining
+ * data as flash_img_buffered_write() does.
+ *
+ * @param ctx context
+ * @param data patch data
+ * @param len number of bytes of patch data
+ * @param flush when true, the patch is complete
+ *
+ * @return  0 on success, -EINVAL if the patch is malformed, does not match
+ * the source image or is incomplete when flushed, other negative errno code
+ * on flash errors
+ */
+int flash_img_delta_write(struct flash_img_delta_context *ctx,
+			  const uint8_t *data, size_t len, bool flush);
+
+#endif /* CONFIG_IMG_DELTA */
+
 #ifdef __cplusplus
 }
 #endif
@@ -150,6 +150,28 @@ typedef int (*display_write_api)(const struct device *dev, const uint16_t x,
 				 const struct display_buffer_descriptor *desc,
 				 const void *buf);
 
+/**
+ * @typedef display_write_cb_t
+ * @brief Callback called when an asynchronous write completes
+ *
+ * @param dev Pointer to device structure
+ * @param result 0 on success else negative errno code
+ * @param user_data User data given to display_write_async()
+ */
+typedef void (*display_write_cb_t)(const struct device *dev, int result,
+				   void *user_data);
+
+/**
+ * @typedef display_write_async_api
+ * @brief Callback API for writing data to the display asynchronously
+ * See display_write_async() for argument description
+ */
+typedef int (*display_write_async_api)(const struct device *dev,
+				       const uint16_t x, const uint16_t y,
+				       const struct display_buffer_descriptor *desc,
+				       const void *buf, display_write_cb_t cb,
+				       void *user_data);
+
 /**
  * @typedef display_read_api
  * @brief Callback API for reading data from the display
@@ -225,6 +247,7 @@ struct display_driver_api {
 	display_get_capabilities_api get_capabilities;
 	display_set_pixel_format_api set_pixel_format;
 	display_set_orientation_api set_orientation;
+	display_write_async_api write_async;
 };
 
 /**
@@ -249,6 +272,51 @@ static inline int display_write(const struct device *dev, const uint16_t x,
 	return api->write(dev, x, y, desc, buf);
 }
 
+/**
+ * @brief Write data to display asynchronously
+ *
+ * Starts the write and returns, @p cb is called once the whole buffer was
+ * sent to the display, possibly from an interrupt. The buffer must not be
+ * modified until then, while the caller can already render the next frame
+ * in another buffer. Drivers without asynchronous support write the buffer
+ * before returning and call @p cb from the caller context.
+ *
+ * Only one asynchronous write can be in progress at a time, other calls to
+ * the display wait for it to complete.
+ *
+ * @param dev Pointer to device structure
+ * @param x x Coordinate of the upper left corner where to write the buffer
+ * @param y y Coordinate of the upper left corner where to write the buffer
+ * @param desc Pointer to a structure describing the buffer layout
+ * @param buf Pointer to buffer array
+ * @param cb Callback called when the write completes
+ * @param user_data User data given to @p cb
+ *
+ * @retval 0 on success else negative errno code, @p cb is not called on
+ * error.
+ */
+static inline int display_write_async(const struct device *dev,
+				      const uint16_t x, const uint16_t y,
+				      const struct display_buffer_descriptor *desc,
+				      const void *buf, display_write_cb_t cb,
+				      void *user_data)
+{
+	struct display_driver_api *api =
+		(struct display_driver_api *)dev->api;
+	int ret;
+
+	if (api->write_async != NULL) {
+		return api->write_async(dev, x, y, desc, buf, cb, user_data);
+	}
+
+	ret = api->write(dev, x, y, desc, buf);
+	if (ret == 0) {
+		cb(dev, 0, user_data);
+	}
+
+	return ret;
+}
+
 /**
  * @brief Read data from display
  *
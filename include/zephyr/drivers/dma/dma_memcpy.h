@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Memory copy offload to a DMA controller
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_MEMCPY_H_
+#define ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_MEMCPY_H_
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief DMA memory copy offload
+ * @defgroup dma_memcpy DMA memory copy offload
+ * @ingroup dma_interface
+ * @{
+ *
+ * Copies of at least @kconfig{CONFIG_DMA_MEMCPY_THRESHOLD} bytes are done by
+ * a memory-to-memory channel of the DMA controller selected by the
+ * @c zephyr,dma-memcpy chosen node, split into a chain of blocks. Smaller
+ * copies, and copies started while no channel is free, are done by the CPU,
+ * so a copy never fails for lack of DMA resources.
+ *
+ * The buffers must be reachable by the DMA controller. Data caches are
+ * maintained by the helper, the buffers should therefore be aligned on cache
+ * lines, and must not be accessed until the copy completes.
+ */
+
+/**
+ * @brief Callback called when a copy completes
+ *
+ * Called from the DMA interrupt for an offloaded copy, or from the caller
+ * context for a copy done by the CPU.
+ *
+ * @param user_data User data given to dma_memcpy_async()
+ * @param status 0 on success, negative errno value from the DMA otherwise
+ */
+typedef void (*dma_memcpy_callback_t)(void *user_data, int status);
+
+/**
+ * @brief Start copying memory
+ *
+ * @param dst Destination buffer
+ * @param src Source buffer, may not overlap @p dst
+ * @param len Number of bytes to copy
+ * @param cb Callback called when the copy completes, may be NULL
+ * @param user_data User data given to @p cb
+ *
+ * @retval 0 The copy started, or completed if done by the CPU
+ */
+int dma_memcpy_async(void *dst, const void *src, size_t len, dma_memcpy_callback_t cb,
+		     void *user_data);
+
+/**
+ * @brief Copy memory and wait for the copy to complete
+ *
+ * Must not be called from an interrupt.
+ *
+ * @param dst Destination buffer
+ * @param src Source buffer, may not overlap @p dst
+ * @param len Number of bytes to copy
+ *
+ * @retval 0 If successful
+ * @retval -errno Negative errno value from the DMA
+ */
+int dma_memcpy(void *dst, const void *src, size_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_MEMCPY_H_ */
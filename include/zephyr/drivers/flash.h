@@ -503,6 +503,79 @@ static inline int z_impl_flash_ex_op(const struct device *dev, uint16_t code,
 #endif /* CONFIG_FLASH_EX_OP_ENABLED */
 }
 
+#if defined(CONFIG_FLASH_ASYNC) || defined(__DOXYGEN__)
+/**
+ *  @brief Type of an asynchronous flash operation
+ */
+enum flash_async_op_type {
+	/** Read, see flash_read() */
+	FLASH_ASYNC_READ,
+	/** Write, see flash_write() */
+	FLASH_ASYNC_WRITE,
+	/** Erase, see flash_erase() */
+	FLASH_ASYNC_ERASE,
+};
+
+struct flash_async_op;
+struct k_poll_signal;
+
+/**
+ *  @brief Completion callback of an asynchronous flash operation
+ *
+ *  Called from the flash async worker thread once the operation is done, it
+ *  may submit new operations.
+ *
+ *  @param dev Flash device
+ *  @param op Completed operation, free to be reused
+ *  @param result Result of the operation, as returned by the blocking API
+ */
+typedef void (*flash_async_cb_t)(const struct device *dev,
+				 struct flash_async_op *op, int result);
+
+/**
+ *  @brief Asynchronous flash operation
+ *
+ *  The structure is owned by the flash async worker from its submission
+ *  with flash_async_submit() until its completion is reported, and must not
+ *  be modified in between. The data buffer must stay valid for that time.
+ */
+struct flash_async_op {
+	/** Reserved for the flash async queue */
+	void *fifo_reserved;
+	/** Flash device, set by flash_async_submit() */
+	const struct device *dev;
+	/** Operation type */
+	enum flash_async_op_type type;
+	/** Offset in the flash device */
+	off_t offset;
+	/** Buffer to read to or write from, unused for erase */
+	void *data;
+	/** Number of bytes to read, write or erase */
+	size_t len;
+	/** Optional completion callback */
+	flash_async_cb_t cb;
+	/** Optional signal raised with the result on completion */
+	struct k_poll_signal *signal;
+};
+
+/**
+ *  @brief Submit an asynchronous flash operation
+ *
+ *  Operations are executed in submission order by a dedicated worker thread
+ *  with the blocking flash API, so that the submitting thread can continue
+ *  while the flash is being programmed or erased. Completion is reported
+ *  through the callback and/or the poll signal of the operation.
+ *
+ *  @param dev Flash device
+ *  @param op Operation to execute
+ *
+ *  @retval 0 if the operation was queued.
+ *  @retval -EINVAL if the operation type is invalid.
+ *  @retval -ENODEV if the device is not ready.
+ */
+int flash_async_submit(const struct device *dev, struct flash_async_op *op);
+#endif /* CONFIG_FLASH_ASYNC */
+
 #ifdef __cplusplus
 }
 #endif
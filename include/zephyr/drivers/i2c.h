@@ -26,6 +26,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/sys/slist.h>
 #include <zephyr/rtio/rtio.h>
+#include <zephyr/profiling/region.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -760,6 +761,10 @@ __syscall int i2c_transfer(const struct device *dev,
 			   struct i2c_msg *msgs, uint8_t num_msgs,
 			   uint16_t addr);
 
+/** @cond INTERNAL_HIDDEN */
+PROFILING_PROBE_DECLARE(i2c_transfer);
+/** @endcond */
+
 static inline int z_impl_i2c_transfer(const struct device *dev,
 				      struct i2c_msg *msgs, uint8_t num_msgs,
 				      uint16_t addr)
@@ -767,8 +772,12 @@ static inline int z_impl_i2c_transfer(const struct device *dev,
 	const struct i2c_driver_api *api =
 		(const struct i2c_driver_api *)dev->api;
 
+	PROFILING_PROBE_START(i2c_transfer);
+
 	int res =  api->transfer(dev, msgs, num_msgs, addr);
 
+	PROFILING_PROBE_END(i2c_transfer);
+
 	i2c_xfer_stats(dev, msgs, num_msgs);
 
 	if (IS_ENABLED(CONFIG_I2C_DUMP_MESSAGES)) {
@@ -972,7 +981,7 @@ static inline int i2c_transfer_signal(const struct device *dev,
  */
 static inline void i2c_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
 {
-	const struct i2c_dt_spec *dt_spec = iodev_sqe->sqe->iodev->data;
+	const struct i2c_dt_spec *dt_spec = iodev_sqe->sqe.iodev->data;
 	const struct device *dev = dt_spec->bus;
 	const struct i2c_driver_api *api = (const struct i2c_driver_api *)dev->api;
 
@@ -1011,6 +1020,23 @@ struct rtio_sqe *i2c_rtio_copy(struct rtio *r,
 			       const struct i2c_msg *msgs,
 			       uint8_t num_msgs);
 
+/**
+ * @brief Describe a RTIO submission as an i2c_msg
+ *
+ * Lets drivers execute RTIO requests with their message based transfer code.
+ * The I2C flags of the message are taken from the iodev flags of the
+ * submission, a stop condition is added at the end of a transaction. A read
+ * using the mempool of the RTIO context gets one block of the pool.
+ *
+ * @param iodev_sqe Submission to describe
+ * @param msg Message to fill
+ *
+ * @retval 0 On success
+ * @retval -ENOMEM No buffer could be allocated for a mempool read
+ * @retval -EINVAL The operation can't be done by an I2C controller
+ */
+int i2c_rtio_sqe_msg(struct rtio_iodev_sqe *iodev_sqe, struct i2c_msg *msg);
+
 #endif /* CONFIG_I2C_RTIO */
 
 /**
@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Bulk conversion of raw sensor samples for sensor decoders
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_SENSOR_CONVERT_H_
+#define ZEPHYR_INCLUDE_DRIVERS_SENSOR_CONVERT_H_
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/dsp/types.h>
+#include <zephyr/sys/util.h>
+
+#ifdef CONFIG_DSP
+#include <zephyr/dsp/dsp.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sensor raw sample conversion
+ * @defgroup sensor_convert Sensor raw sample conversion
+ * @ingroup sensor_interface
+ * @{
+ *
+ * Decoders usually get signed 16 bit samples spanning the full scale of the sensor. These
+ * helpers convert whole frames of such samples to the q31 values of the decoded data, with the
+ * unit conversion and the per-axis calibration folded into a multiplier computed once per
+ * buffer. When @kconfig{CONFIG_DSP} is enabled the bulk conversion uses the zdsp backend, e.g.
+ * CMSIS-DSP, otherwise a plain C loop without any division.
+ */
+
+/** @brief Conversion of a raw channel to q31 */
+struct sensor_convert_cfg {
+	/** Fractional multiplier of the raw sample, in Q1.31 */
+	q31_t scale;
+	/** Left shift applied after the multiplication */
+	int8_t scale_shift;
+	/** Offset added to the result, in the output q31 format */
+	q31_t offset;
+};
+
+/**
+ * @brief Initialize a conversion of raw samples
+ *
+ * A raw sample of INT16_MAX + 1 converts to @p full_scale_micro, offset by @p offset_micro.
+ * Both are in millionths of the output unit, e.g. um/s^2 for an accelerometer. A calibration
+ * gain is applied by multiplying @p full_scale_micro by it.
+ *
+ * @param[out] cfg The conversion to initialize
+ * @param[in] full_scale_micro Full scale of the raw samples in millionths of the output unit
+ * @param[in] offset_micro Offset added after the scaling in millionths of the output unit
+ * @param[in] shift The shift of the output q31 values
+ * @return 0 on success
+ * @return -ERANGE if the full scale doesn't fit in the output format
+ */
+static inline int sensor_convert_cfg_init(struct sensor_convert_cfg *cfg, int64_t full_scale_micro,
+					  int64_t offset_micro, int8_t shift)
+{
+	int64_t scale;
+	int64_t offset;
+	int8_t scale_shift = 0;
+
+	if (shift < -31 || shift > 31) {
+		return -ERANGE;
+	}
+
+	/* Full scale divided by 2^shift, in Q1.31 */
+	if (shift >= 0) {
+		scale = full_scale_micro * (INT64_C(1) << (31 - shift)) / INT64_C(1000000);
+		offset = offset_micro * (INT64_C(1) << (31 - shift)) / INT64_C(1000000);
+	} else {
+		scale = full_scale_micro * (INT64_C(1) << 31) / INT64_C(1000000) * (1 << -shift);
+		offset = offset_micro * (INT64_C(1) << 31) / INT64_C(1000000) * (1 << -shift);
+	}
+
+	/* Keep the multiplier fractional, the difference is made up by the shift */
+	while (scale > INT32_MAX || scale < INT32_MIN) {
+		scale /= 2;
+		scale_shift++;
+	}
+
+	if (scale_shift > 15 || offset > INT32_MAX || offset < INT32_MIN) {
+		return -ERANGE;
+	}
+
+	cfg->scale = (q31_t)scale;
+	cfg->scale_shift = scale_shift;
+	cfg->offset = (q31_t)offset;
+
+	return 0;
+}
+
+/**
+ * @brief Convert a single raw sample
+ *
+ * @param[in] raw The raw sample
+ * @param[in] cfg The conversion to apply
+ * @return The converted sample, saturated
+ */
+static inline q31_t sensor_convert_int16_q31(int16_t raw, const struct sensor_convert_cfg *cfg)
+{
+	/* (raw << 16) * scale >> 31 << scale_shift */
+	int64_t value = ((int64_t)raw * cfg->scale) >> (15 - cfg->scale_shift);
+
+	value += cfg->offset;
+
+	return (q31_t)CLAMP(value, INT32_MIN, INT32_MAX);
+}
+
+/**
+ * @brief Convert a block of raw samples of the same channel
+ *
+ * @param[in] src The raw samples
+ * @param[out] dst The converted samples, may not overlap @p src
+ * @param[in] count Number of samples
+ * @param[in] cfg The conversion to apply
+ */
+static inline void sensor_convert_int16_to_q31(const int16_t *src, q31_t *dst, size_t count,
+					       const struct sensor_convert_cfg *cfg)
+{
+#ifdef CONFIG_DSP
+	for (size_t i = 0; i < count; i++) {
+		dst[i] = (q31_t)src[i] << 16;
+	}
+
+	zdsp_scale_q31(dst, cfg->scale, cfg->scale_shift, dst, count);
+	if (cfg->offset != 0) {
+		zdsp_offset_q31(dst, cfg->offset, dst, count);
+	}
+#else
+	for (size_t i = 0; i < count; i++) {
+		dst[i] = sensor_convert_int16_q31(src[i], cfg);
+	}
+#endif
+}
+
+/**
+ * @brief Convert a block of interleaved X, Y, Z raw samples
+ *
+ * @param[in] src The raw samples, X, Y and Z of each reading in a row
+ * @param[out] dst The converted samples in the same order, may not overlap @p src
+ * @param[in] count Number of readings, i.e. a third of the number of samples
+ * @param[in] cfg The conversion of each axis, for a per-axis calibration
+ */
+static inline void sensor_convert_three_axis_int16_to_q31(const int16_t *src, q31_t *dst,
+							  size_t count,
+							  const struct sensor_convert_cfg cfg[3])
+{
+	if (cfg[0].scale == cfg[1].scale && cfg[0].scale == cfg[2].scale &&
+	    cfg[0].scale_shift == cfg[1].scale_shift && cfg[0].scale_shift == cfg[2].scale_shift &&
+	    cfg[0].offset == cfg[1].offset && cfg[0].offset == cfg[2].offset) {
+		sensor_convert_int16_to_q31(src, dst, count * 3, &cfg[0]);
+		return;
+	}
+
+	for (size_t i = 0; i < count * 3; i += 3) {
+		dst[i] = sensor_convert_int16_q31(src[i], &cfg[0]);
+		dst[i + 1] = sensor_convert_int16_q31(src[i + 1], &cfg[1]);
+		dst[i + 2] = sensor_convert_int16_q31(src[i + 2], &cfg[2]);
+	}
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_SENSOR_CONVERT_H_ */
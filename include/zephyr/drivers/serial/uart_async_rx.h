@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Continuous reception helper for the asynchronous UART API
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_SERIAL_UART_ASYNC_RX_H_
+#define ZEPHYR_INCLUDE_DRIVERS_SERIAL_UART_ASYNC_RX_H_
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief UART asynchronous RX helper
+ * @defgroup uart_async_rx UART asynchronous RX helper
+ * @ingroup uart_interface
+ * @{
+ *
+ * The helper owns a ring of equally sized buffers and answers the
+ * #UART_RX_BUF_REQUEST events of the driver straight from the UART callback,
+ * so the driver always has a next buffer to switch to and reception doesn't
+ * stop at buffer boundaries. The consumer reads received data in place with
+ * uart_async_rx_data_peek() and gives it back with
+ * uart_async_rx_data_release(), without copying it. If the consumer falls
+ * behind and all the buffers are full, reception stops and is restarted as
+ * soon as a buffer is released.
+ */
+
+/** @cond INTERNAL_HIDDEN */
+struct uart_async_rx_buf {
+	/* Number of bytes written by the driver */
+	size_t wr_len;
+	/* Buffer was released by the driver */
+	bool completed;
+};
+/** @endcond */
+
+/** @brief Asynchronous RX helper instance, see UART_ASYNC_RX_DEFINE() */
+struct uart_async_rx {
+	/** @cond INTERNAL_HIDDEN */
+	uint8_t *buffer;
+	struct uart_async_rx_buf *bufs;
+	size_t buf_len;
+	uint8_t buf_cnt;
+
+	struct k_spinlock lock;
+	const struct device *dev;
+	int32_t timeout;
+	uint8_t drv_buf_idx;
+	uint8_t rd_buf_idx;
+	uint8_t free_buf_cnt;
+	size_t rd_idx;
+	bool enabled;
+	bool stopped;
+	/** @endcond */
+};
+
+/**
+ * @brief Define an asynchronous RX helper instance
+ *
+ * The reception stays continuous as long as the consumer keeps at least one
+ * buffer free, each buffer should hold the data received during the worst
+ * case latency of the UART callback.
+ *
+ * @param _name Name of the instance
+ * @param _buf_cnt Number of buffers, at least 2
+ * @param _buf_len Size of each buffer in bytes
+ */
+#define UART_ASYNC_RX_DEFINE(_name, _buf_cnt, _buf_len)				\
+	BUILD_ASSERT((_buf_cnt) >= 2 && (_buf_cnt) <= UINT8_MAX,		\
+		     "Invalid number of buffers");				\
+	static uint8_t _name##_buffer[(_buf_cnt) * (_buf_len)] __aligned(4);	\
+	static struct uart_async_rx_buf _name##_bufs[_buf_cnt];			\
+	static struct uart_async_rx _name = {					\
+		.buffer = _name##_buffer,					\
+		.bufs = _name##_bufs,						\
+		.buf_len = (_buf_len),						\
+		.buf_cnt = (_buf_cnt),						\
+	}
+
+/**
+ * @brief Start continuous reception
+ *
+ * The UART callback must be set before and must forward the events to
+ * uart_async_rx_on_event().
+ *
+ * @param rx Helper instance
+ * @param dev UART device
+ * @param timeout Inactivity period after which received data is reported, in
+ *		  microseconds, see uart_rx_enable()
+ *
+ * @retval 0 If successful
+ * @retval -EBUSY If reception is already enabled
+ * @retval -errno Other negative errno value from uart_rx_enable()
+ */
+int uart_async_rx_enable(struct uart_async_rx *rx, const struct device *dev, int32_t timeout);
+
+/**
+ * @brief Stop continuous reception
+ *
+ * Data received so far can still be read.
+ *
+ * @param rx Helper instance
+ *
+ * @retval 0 If successful
+ * @retval -errno Negative errno value from uart_rx_disable()
+ */
+int uart_async_rx_disable(struct uart_async_rx *rx);
+
+/**
+ * @brief Handle a UART event
+ *
+ * Must be called from the UART callback for every event. The event can still
+ * be used by the application afterwards, e.g. to wake up the consumer on
+ * #UART_RX_RDY.
+ *
+ * @param rx Helper instance
+ * @param evt Event given to the UART callback
+ */
+void uart_async_rx_on_event(struct uart_async_rx *rx, const struct uart_event *evt);
+
+/**
+ * @brief Get received data without copying it
+ *
+ * The data stays valid until it is released. Data spanning two buffers is
+ * returned in two steps.
+ *
+ * @param rx Helper instance
+ * @param data Set to the oldest data not released yet
+ *
+ * @return Number of contiguous bytes at @p data, 0 if there is no data
+ */
+size_t uart_async_rx_data_peek(struct uart_async_rx *rx, uint8_t **data);
+
+/**
+ * @brief Release data returned by uart_async_rx_data_peek()
+ *
+ * Buffers fully released are given back to the driver. If reception was
+ * stopped because no buffer was free it is restarted.
+ *
+ * @param rx Helper instance
+ * @param len Number of bytes to release, at most the length returned by the
+ *	      last call to uart_async_rx_data_peek()
+ *
+ * @retval 0 If successful
+ * @retval -errno Negative errno value from uart_rx_enable() when restarting
+ */
+int uart_async_rx_data_release(struct uart_async_rx *rx, size_t len);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_SERIAL_UART_ASYNC_RX_H_ */
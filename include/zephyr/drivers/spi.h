@@ -27,6 +27,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/rtio/rtio.h>
+#include <zephyr/profiling/region.h>
 #include <zephyr/stats/stats.h>
 
 #ifdef __cplusplus
@@ -736,6 +737,10 @@ __syscall int spi_transceive(const struct device *dev,
 			     const struct spi_buf_set *tx_bufs,
 			     const struct spi_buf_set *rx_bufs);
 
+/** @cond INTERNAL_HIDDEN */
+PROFILING_PROBE_DECLARE(spi_transceive);
+/** @endcond */
+
 static inline int z_impl_spi_transceive(const struct device *dev,
 					const struct spi_config *config,
 					const struct spi_buf_set *tx_bufs,
@@ -745,7 +750,9 @@ static inline int z_impl_spi_transceive(const struct device *dev,
 		(const struct spi_driver_api *)dev->api;
 	int ret;
 
+	PROFILING_PROBE_START(spi_transceive);
 	ret = api->transceive(dev, config, tx_bufs, rx_bufs);
+	PROFILING_PROBE_END(spi_transceive);
 	spi_transceive_stats(dev, ret, tx_bufs, rx_bufs);
 
 	return ret;
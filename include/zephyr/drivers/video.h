@@ -558,9 +558,21 @@ static inline int video_set_signal(const struct device *dev,
 	return api->set_signal(dev, ep, signal);
 }
 
+/**
+ * @brief Allocate aligned video buffer.
+ *
+ * @param size Size of the video buffer (in bytes).
+ * @param align Alignment of the requested memory, must be a power of two.
+ *
+ * @retval pointer to allocated video buffer
+ */
+struct video_buffer *video_buffer_aligned_alloc(size_t size, size_t align);
+
 /**
  * @brief Allocate video buffer.
  *
+ * The buffer is aligned to CONFIG_VIDEO_BUFFER_POOL_ALIGN.
+ *
  * @param size Size of the video buffer.
  *
  * @retval pointer to allocated video buffer
@@ -110,6 +110,15 @@ struct fcb {
 	struct flash_sector *f_sectors;
 	/**< Array of sectors, must be contiguous */
 
+#ifdef CONFIG_FCB_ENTRY_INDEX
+	uint16_t *f_entry_cnt;
+	/**< Optional array of f_sector_cnt counters. When given, FCB keeps
+	 * the number of valid entries of each sector in it, so that
+	 * fcb_offset_last_n() skips whole sectors instead of walking all
+	 * entries. Its content is internal state.
+	 */
+#endif
+
 	/* Flash circular buffer internal state */
 	struct k_mutex f_mtx;
 	/**< Locking for accessing the FCB data, internal state */
@@ -59,6 +59,9 @@ enum {
 	/** Identifier for in-tree Ext2 file system. */
 	FS_EXT2,
 
+	/** Identifier for in-tree read-only image file system. */
+	FS_ROFS,
+
 	/** Base identifier for external file systems. */
 	FS_TYPE_EXTERNAL_BASE,
 };
@@ -83,6 +86,72 @@ enum {
  */
 #define FS_MOUNT_FLAG_USE_DISK_ACCESS BIT(3)
 
+#if defined(CONFIG_FILE_SYSTEM_CACHE) || defined(__DOXYGEN__)
+/**
+ * @brief File system page cache statistics
+ */
+struct fs_cache_stats {
+	/** Number of page lookups found in the cache */
+	uint32_t hits;
+	/** Number of page lookups that had to load or allocate a page */
+	uint32_t misses;
+	/** Number of dirty pages written back to the file system */
+	uint32_t writebacks;
+};
+
+/**
+ * @brief File system page cache page
+ */
+struct fs_cache_page {
+	/** File the page belongs to, NULL if the page is unused */
+	struct fs_file_t *zfp;
+	/** Index of the page in the file */
+	uint32_t index;
+	/** Value of the cache clock at the last access, for LRU eviction */
+	uint32_t lru;
+	/** Page content differs from the file system */
+	bool dirty;
+};
+
+/**
+ * @brief File system page cache
+ *
+ * Defined with FS_CACHE_DEFINE() and assigned to fs_mount_t.cache before
+ * mounting.
+ */
+struct fs_cache {
+	/** Lock protecting the pages */
+	struct k_mutex lock;
+	/** Page descriptors */
+	struct fs_cache_page *pages;
+	/** Page contents, CONFIG_FILE_SYSTEM_CACHE_PAGE_SIZE bytes each */
+	uint8_t *data;
+	/** Number of pages */
+	size_t page_count;
+	/** Clock incremented on each page access */
+	uint32_t clock;
+	/** Statistics */
+	struct fs_cache_stats stats;
+};
+
+/**
+ * @brief Define a file system page cache
+ *
+ * @param _name Name of the struct fs_cache variable
+ * @param _page_count Number of pages of CONFIG_FILE_SYSTEM_CACHE_PAGE_SIZE bytes
+ */
+#define FS_CACHE_DEFINE(_name, _page_count)					\
+	static uint8_t _name##_data[(_page_count) *				\
+				    CONFIG_FILE_SYSTEM_CACHE_PAGE_SIZE] __aligned(4);	\
+	static struct fs_cache_page _name##_pages[_page_count];		\
+	static struct fs_cache _name = {					\
+		.lock = Z_MUTEX_INITIALIZER(_name.lock),			\
+		.pages = _name##_pages,						\
+		.data = _name##_data,						\
+		.page_count = (_page_count),					\
+	}
+#endif /* CONFIG_FILE_SYSTEM_CACHE */
+
 /**
  * @brief File system mount info structure
  */
@@ -97,6 +166,10 @@ struct fs_mount_t {
 	void *fs_data;
 	/** Pointer to backend storage device */
 	void *storage_dev;
+#if defined(CONFIG_FILE_SYSTEM_CACHE) || defined(__DOXYGEN__)
+	/** Optional page cache for the files of the mount point */
+	struct fs_cache *cache;
+#endif
 	/* The following fields are filled by file system core */
 	/** Length of Mount point string */
 	size_t mountp_len;
@@ -452,6 +525,25 @@ int fs_truncate(struct fs_file_t *zfp, off_t length);
  */
 int fs_sync(struct fs_file_t *zfp);
 
+/**
+ * @brief Get the address of the content of an open file
+ *
+ * For file systems storing files contiguously in memory mapped storage, like
+ * the read-only image file system, returns the address of the content of the
+ * file so that it can be used without being copied. The address stays valid
+ * while the file system is mounted.
+ *
+ * @param zfp Pointer to the file object
+ * @param addr Pointer to receive the address of the content of the file
+ * @param size Pointer to receive the size of the file
+ *
+ * @retval 0 on success;
+ * @retval -EBADF when invoked on zfp that represents unopened/closed file;
+ * @retval -ENOTSUP when not supported by underlying file system driver;
+ * @retval <0 a negative errno code on error.
+ */
+int fs_mmap(struct fs_file_t *zfp, const void **addr, size_t *size);
+
 /**
  * @brief Directory create
  *
@@ -614,6 +706,19 @@ int fs_stat(const char *path, struct fs_dirent *entry);
  */
 int fs_statvfs(const char *path, struct fs_statvfs *stat);
 
+/**
+ * @brief Get the page cache statistics of a mount point
+ *
+ * @param path Path to any file or directory on the mounted file system
+ * @param stats Pointer to the structure to receive the statistics
+ *
+ * @retval 0 on success;
+ * @retval -EINVAL when a bad path or a NULL @p stats is given;
+ * @retval -ENOENT if no mount point is found for @p path;
+ * @retval -ENOTSUP if the mount point has no page cache.
+ */
+int fs_cache_stats_get(const char *path, struct fs_cache_stats *stats);
+
 /**
  * @brief Create fresh file system
  *
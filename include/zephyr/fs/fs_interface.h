@@ -67,6 +67,12 @@ struct fs_file_t {
 	const struct fs_mount_t *mp;
 	/** Open/create flags */
 	fs_mode_t flags;
+#if defined(CONFIG_FILE_SYSTEM_CACHE) || defined(__DOXYGEN__)
+	/** File position, maintained by the page cache of the mount point */
+	off_t cache_pos;
+	/** File size including cached data, maintained by the page cache */
+	off_t cache_size;
+#endif
 };
 
 /**
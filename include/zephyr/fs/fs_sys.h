@@ -91,6 +91,15 @@ struct fs_file_system_t {
 	 * @return 0 on success, negative errno code on fail.
 	 */
 	int (*close)(struct fs_file_t *filp);
+	/**
+	 * Gets the address of the content of a file in memory.
+	 *
+	 * @param filp File to map.
+	 * @param addr Address of the content of the file.
+	 * @param size Size of the file.
+	 * @return 0 on success, negative errno code on fail.
+	 */
+	int (*mmap)(struct fs_file_t *filp, const void **addr, size_t *size);
 	/** @} */
 
 	/**
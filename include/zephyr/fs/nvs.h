@@ -31,6 +31,20 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief Non-volatile Storage garbage collection statistics
+ */
+struct nvs_gc_stats {
+	/** Number of sectors garbage collected */
+	uint32_t gc_count;
+	/** Number of entries moved by garbage collection */
+	uint32_t moved_entries;
+	/** Number of data bytes moved by garbage collection */
+	uint32_t moved_bytes;
+	/** Longest time the file system was locked by a garbage collection, in cycles */
+	uint32_t max_cycles;
+};
+
 /**
  * @brief Non-volatile Storage File system structure
  */
@@ -60,6 +74,20 @@ struct nvs_fs {
 #if CONFIG_NVS_LOOKUP_CACHE
 	uint32_t lookup_cache[CONFIG_NVS_LOOKUP_CACHE_SIZE];
 #endif
+#if CONFIG_NVS_LOOKUP_CACHE_INDEX
+	/** ID owning each lookup cache entry */
+	uint16_t lookup_cache_ids[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+	/** Some IDs did not fit in the lookup cache */
+	bool lookup_cache_full;
+#endif
+#if CONFIG_NVS_GC_INCREMENTAL
+	/** Address of the next ATE of the oldest sector for nvs_gc_step() */
+	uint32_t gc_step_addr;
+#endif
+#if CONFIG_NVS_GC_STATS
+	/** Garbage collection statistics */
+	struct nvs_gc_stats gc_stats;
+#endif
 };
 
 /**
@@ -162,6 +190,34 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len, ui
  */
 ssize_t nvs_calc_free_space(struct nvs_fs *fs);
 
+/**
+ * @brief Do a bounded step of incremental garbage collection.
+ *
+ * Once the free space in the write sector drops below
+ * CONFIG_NVS_GC_INCREMENTAL_THRESHOLD percent, each call moves entries still in use out of the
+ * oldest sector, and the call that finds them all moved switches to the next sector. Calling it
+ * regularly from a low priority thread or work item keeps garbage collection out of nvs_write().
+ *
+ * @param fs Pointer to file system
+ * @param max_entries Maximum number of entries of the oldest sector to process
+ *
+ * @retval 1 Garbage collection progressed, more may be pending
+ * @retval 0 No garbage collection needed
+ * @retval -ENOTSUP The file system has less than 3 sectors
+ * @retval -ERRNO errno code if error
+ */
+int nvs_gc_step(struct nvs_fs *fs, size_t max_entries);
+
+/**
+ * @brief Get the garbage collection statistics since the file system was mounted.
+ *
+ * @param fs Pointer to file system
+ * @param stats Pointer to the statistics to fill
+ * @retval 0 Success
+ * @retval -ERRNO errno code if error
+ */
+int nvs_gc_stats_get(struct nvs_fs *fs, struct nvs_gc_stats *stats);
+
 /**
  * @}
  */
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_FS_ROFS_H_
+#define ZEPHYR_INCLUDE_FS_ROFS_H_
+
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Read-only image file system
+ * @defgroup rofs Read-only image file system
+ * @ingroup file_system_api
+ * @{
+ *
+ * A rofs image is built from a directory at build time with the
+ * generate_rofs_image_for_target() CMake function and linked in the
+ * application as a constant array. It is mounted with type @c FS_ROFS and
+ * the address of the image as the mount point @c fs_data. On XIP targets
+ * the image is read in place from flash, and fs_mmap() returns the address
+ * of the content of a file without any copy.
+ *
+ * All values are little endian and offsets are from the start of the image.
+ * The image starts with a header followed by the entry table, sorted by
+ * path, and by the paths and the file contents.
+ */
+
+/** Magic number of a rofs image, "ROFS" */
+#define ROFS_MAGIC 0x53464f52
+/** Version of the rofs image format */
+#define ROFS_VERSION 1
+/** Parent index of the entries of the root directory */
+#define ROFS_ROOT 0xffff
+
+/** @brief Header of a rofs image */
+struct rofs_header {
+	/** ROFS_MAGIC */
+	uint32_t magic;
+	/** ROFS_VERSION */
+	uint16_t version;
+	/** Number of entries following the header */
+	uint16_t entry_count;
+	/** Size of the image in bytes */
+	uint32_t image_size;
+	/** Alignment of the file contents in bytes */
+	uint32_t align;
+} __packed;
+
+/** @brief File or directory entry of a rofs image */
+struct rofs_entry {
+	/** Offset of the NUL terminated path, without leading '/' */
+	uint32_t name_offset;
+	/** Offset of the content of a file, 0 for a directory */
+	uint32_t data_offset;
+	/** Size of a file in bytes, 0 for a directory */
+	uint32_t size;
+	/** Entry type, FS_DIR_ENTRY_FILE or FS_DIR_ENTRY_DIR */
+	uint16_t type;
+	/** Index of the parent directory entry, ROFS_ROOT for the root */
+	uint16_t parent;
+} __packed;
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_FS_ROFS_H_ */
@@ -194,6 +194,55 @@ struct init_entry {
 			.dev = NULL,                                           \
 	}
 
+#if defined(CONFIG_INIT_TIME_REPORT) || defined(__DOXYGEN__)
+
+/** @brief Item of the boot time report. */
+struct sys_init_report_item {
+	/** Init entry, or NULL for a boot milestone. */
+	const struct init_entry *entry;
+	/** Name of the boot milestone. */
+	const char *milestone;
+	/**
+	 * Duration of the init function, or uptime when the milestone was
+	 * reached, in microseconds.
+	 */
+	uint32_t usec;
+};
+
+/**
+ * @brief Callback receiving the items of the boot time report.
+ *
+ * @param item Report item.
+ * @param user_data User data given to sys_init_report_foreach().
+ */
+typedef void (*sys_init_report_cb_t)(const struct sys_init_report_item *item,
+				     void *user_data);
+
+/**
+ * @brief Walk the boot time report.
+ *
+ * The boot milestones come first, in the order they were reached: the start
+ * of each init level, the call of main() and those recorded with
+ * sys_init_report_milestone(). The init functions follow, the longest first.
+ * Only available if @kconfig{CONFIG_INIT_TIME_REPORT} is enabled.
+ *
+ * @param cb Callback called for each item.
+ * @param user_data User data passed to @p cb.
+ */
+void sys_init_report_foreach(sys_init_report_cb_t cb, void *user_data);
+
+/**
+ * @brief Record a boot milestone.
+ *
+ * Only the first time a milestone is reached is recorded, and nothing is
+ * recorded once @kconfig{CONFIG_INIT_TIME_REPORT_MILESTONES} milestones are.
+ *
+ * @param name Name of the milestone, which must stay valid.
+ */
+void sys_init_report_milestone(const char *name);
+
+#endif /* CONFIG_INIT_TIME_REPORT */
+
 /** @} */
 
 #ifdef __cplusplus
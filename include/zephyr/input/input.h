@@ -115,6 +115,30 @@ static inline int input_report_abs(const struct device *dev,
  */
 bool input_queue_empty(void);
 
+/**
+ * @brief Input queue statistics.
+ */
+struct input_queue_stats {
+	/** Highest number of events in the queue at once. */
+	uint32_t max_used;
+	/** Number of events that could not be added to the queue. */
+	uint32_t dropped;
+};
+
+/**
+ * @brief Get the input queue statistics.
+ *
+ * Only available with @kconfig{CONFIG_INPUT_MODE_THREAD}, as events are not
+ * queued otherwise.
+ *
+ * @param stats Pointer to the structure to fill.
+ * @param reset Reset the statistics after reading them.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOTSUP If events are processed synchronously.
+ */
+int input_queue_stats_get(struct input_queue_stats *stats, bool reset);
+
 /**
  * @brief Input listener callback structure.
  */
@@ -1722,6 +1722,32 @@ static inline void *z_impl_k_timer_user_data_get(const struct k_timer *timer)
 	return timer->user_data;
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/**
+ * @brief Set the slack of a timer.
+ *
+ * The expiry of the timer is delayed to the next multiple of @a slack since
+ * boot, so that timers given the same slack expire together and the system
+ * wakes up once for all of them. Periodic timers stay aligned when their
+ * period is a multiple of the slack. The slack applies from the next call to
+ * k_timer_start() or the next period, and is cleared by k_timer_init().
+ *
+ * @param timer Address of timer.
+ * @param slack Largest delay accepted on the expiry, or K_NO_WAIT for none.
+ */
+__syscall void k_timer_slack_set(struct k_timer *timer, k_timeout_t slack);
+
+/**
+ * @internal
+ */
+static inline void z_impl_k_timer_slack_set(struct k_timer *timer,
+					    k_timeout_t slack)
+{
+	__ASSERT_NO_MSG(!K_TIMEOUT_EQ(slack, K_FOREVER));
+	timer->timeout.slack = (uint32_t)slack.ticks;
+}
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /** @} */
 
 /**
@@ -2218,6 +2244,8 @@ __syscall int k_futex_wake(struct k_futex *futex, bool wake_all);
 struct k_event {
 	_wait_q_t         wait_q;
 	uint32_t          events;
+	/* Events the waiting threads may wait for */
+	uint32_t          waiter_events;
 	struct k_spinlock lock;
 
 	SYS_PORT_TRACING_TRACKING_FIELD(k_event)
@@ -2891,6 +2919,7 @@ __syscall int k_stack_pop(struct k_stack *stack, stack_data_t *data,
 
 struct k_work;
 struct k_work_q;
+struct k_work_q_worker;
 struct k_work_queue_config;
 extern struct k_work_q k_sys_work_q;
 
@@ -2925,6 +2954,10 @@ struct k_mutex {
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	struct k_obj_core obj_core;
 #endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	struct k_wait_stats wait_stats;
+#endif
 };
 
 /**
@@ -3026,6 +3059,10 @@ struct k_condvar {
 #ifdef CONFIG_OBJ_CORE_CONDVAR
 	struct k_obj_core  obj_core;
 #endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_CONDVAR
+	struct k_wait_stats  wait_stats;
+#endif
 };
 
 #define Z_CONDVAR_INITIALIZER(obj)                                             \
@@ -3105,6 +3142,116 @@ __syscall int k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
  * @cond INTERNAL_HIDDEN
  */
 
+struct k_rwlock {
+	/* Number of readers, and writer state bits */
+	atomic_t state;
+
+	/* Thread holding the lock for writing */
+	struct k_thread *writer;
+
+	/* Priority of the writer before inheriting one */
+	int writer_orig_prio;
+
+	_wait_q_t read_wait_q;
+	_wait_q_t write_wait_q;
+};
+
+#define Z_RWLOCK_INITIALIZER(obj)                                              \
+	{                                                                      \
+		.state = ATOMIC_INIT(0),                                       \
+		.writer = NULL,                                                \
+		.read_wait_q = Z_WAIT_Q_INIT(&obj.read_wait_q),                \
+		.write_wait_q = Z_WAIT_Q_INIT(&obj.write_wait_q),              \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @defgroup rwlock_apis Reader-Writer Lock APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Initialize a reader-writer lock
+ *
+ * @param rwlock Address of the reader-writer lock.
+ */
+__syscall void k_rwlock_init(struct k_rwlock *rwlock);
+
+/**
+ * @brief Lock a reader-writer lock for reading
+ *
+ * Any number of threads may hold the lock for reading at the same time.
+ * Writers have precedence: a thread waiting to write keeps new readers out.
+ * Taking an uncontended lock for reading is a single atomic operation.
+ *
+ * The lock is not recursive for writing, a thread holding it for reading
+ * must not lock it for writing.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to lock the lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Lock locked for reading.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Lock a reader-writer lock for writing
+ *
+ * The writer owning the lock inherits the priority of the highest priority
+ * thread waiting to write, as for a mutex. Readers do not take part in
+ * priority inheritance.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ * @param timeout Waiting period to lock the lock,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Lock locked for writing.
+ * @retval -EBUSY Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EDEADLK The calling thread already holds the lock for writing.
+ */
+__syscall int k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout);
+
+/**
+ * @brief Unlock a reader-writer lock
+ *
+ * Releases the lock held by the calling thread, for writing or reading.
+ *
+ * @param rwlock Address of the reader-writer lock.
+ *
+ * @retval 0 Lock unlocked.
+ * @retval -EPERM The lock is not held.
+ */
+__syscall int k_rwlock_unlock(struct k_rwlock *rwlock);
+
+/**
+ * @brief Statically define and initialize a reader-writer lock.
+ *
+ * The lock can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_rwlock <name>; @endcode
+ *
+ * @param name Name of the reader-writer lock.
+ */
+#define K_RWLOCK_DEFINE(name)                                                  \
+	STRUCT_SECTION_ITERABLE(k_rwlock, name) =                              \
+		Z_RWLOCK_INITIALIZER(name)
+
+/**
+ * @}
+ */
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
 struct k_sem {
 	_wait_q_t wait_q;
 	unsigned int count;
@@ -3117,6 +3264,10 @@ struct k_sem {
 #ifdef CONFIG_OBJ_CORE_SEM
 	struct k_obj_core  obj_core;
 #endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	struct k_wait_stats  wait_stats;
+#endif
 };
 
 #define Z_SEM_INITIALIZER(obj, initial_count, count_limit) \
@@ -3466,6 +3617,46 @@ void k_work_queue_start(struct k_work_q *queue,
 			k_thread_stack_t *stack, size_t stack_size,
 			int prio, const struct k_work_queue_config *cfg);
 
+#if defined(CONFIG_WORKQUEUE_POOL) || defined(__DOXYGEN__)
+/** @brief Add a worker thread to a work queue.
+ *
+ * The worker processes the items submitted to @p queue alongside the thread
+ * started by k_work_queue_start(), so that a slow handler doesn't hold back
+ * the other items and items can be processed on several CPUs at once.  A
+ * given work item still never runs on two threads at the same time: an item
+ * submitted while it is running waits in the queue until the handler
+ * returns, and flush and cancellation complete once the running handler
+ * returns.
+ *
+ * Items of a queue with workers can be processed in parallel and in a
+ * different order than they were submitted, handlers that rely on the
+ * serialization of the queue must not be submitted to it.
+ *
+ * The worker runs forever; @p worker and @p stack must persist.
+ *
+ * @param queue pointer to a queue started with k_work_queue_start().
+ *
+ * @param worker pointer to the worker structure.
+ *
+ * @param stack pointer to the worker thread stack area.
+ *
+ * @param stack_size size of the the worker thread stack area, in bytes.
+ *
+ * @param prio initial thread priority
+ *
+ * @param cpu CPU the worker is pinned to, or -1 to let it run on any CPU.
+ *
+ * @retval 0 if the worker was started
+ * @retval -ENODEV if the queue is not started
+ * @retval -ENOTSUP if @p cpu is given without CONFIG_SCHED_CPU_MASK
+ * @retval -EINVAL if @p cpu is not a valid CPU
+ */
+int k_work_queue_add_worker(struct k_work_q *queue,
+			    struct k_work_q_worker *worker,
+			    k_thread_stack_t *stack, size_t stack_size,
+			    int prio, int cpu);
+#endif
+
 /** @brief Access the thread that animates a work queue.
  *
  * This is necessary to grant a work queue thread access to things the work
@@ -3533,6 +3724,24 @@ int k_work_queue_unplug(struct k_work_q *queue);
 void k_work_init_delayable(struct k_work_delayable *dwork,
 			   k_work_handler_t handler);
 
+#ifdef CONFIG_TIMEOUT_SLACK
+/**
+ * @brief Set the slack of a delayable work item.
+ *
+ * When the work item is scheduled, its delay is extended to the next multiple
+ * of @p slack since boot, so that work items and timers given the same slack
+ * are submitted together. The slack is cleared by k_work_init_delayable().
+ *
+ * @funcprops \isr_ok
+ *
+ * @param dwork pointer to the delayable work item.
+ * @param slack largest delay accepted on the submission, or K_NO_WAIT for
+ * none.
+ */
+void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+				k_timeout_t slack);
+#endif /* CONFIG_TIMEOUT_SLACK */
+
 /**
  * @brief Get the parent delayable work structure from a work pointer.
  *
@@ -3656,6 +3865,56 @@ int k_work_schedule_for_queue(struct k_work_q *queue,
 int k_work_schedule(struct k_work_delayable *dwork,
 				   k_timeout_t delay);
 
+#if defined(CONFIG_WORK_DELAYABLE_SLACK) || defined(__DOXYGEN__)
+/** @brief Submit an idle work item to a queue after a delay, with slack.
+ *
+ * Like k_work_schedule_for_queue(), but the work item may be submitted up to
+ * @p slack after @p delay expires.  All the work items scheduled with slack
+ * share a single kernel timeout, which expires at the earliest end of their
+ * slack windows and submits every work item whose delay has expired.  Work
+ * items with overlapping windows are therefore submitted together, which
+ * saves wake-ups and keeps the kernel timeout list short when many items
+ * don't need precise timing.
+ *
+ * Rescheduling or canceling the work item drops the slack.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue the queue on which the work item should be submitted after
+ * the delay.
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param delay the time to wait before submitting the work item.  If @c
+ * K_NO_WAIT this is equivalent to k_work_submit_to_queue().
+ *
+ * @param slack the additional time the submission may be deferred by.  If
+ * @c K_NO_WAIT this is equivalent to k_work_schedule_for_queue().
+ *
+ * @return as with k_work_schedule_for_queue().
+ */
+int k_work_schedule_for_queue_slack(struct k_work_q *queue,
+				    struct k_work_delayable *dwork,
+				    k_timeout_t delay, k_timeout_t slack);
+
+/** @brief Submit an idle work item to the system work queue after a
+ * delay, with slack.
+ *
+ * This is a thin wrapper around k_work_schedule_for_queue_slack(), with all
+ * the API characteristics of that function.
+ *
+ * @param dwork pointer to the delayable work item.
+ *
+ * @param delay the time to wait before submitting the work item.
+ *
+ * @param slack the additional time the submission may be deferred by.
+ *
+ * @return as with k_work_schedule_for_queue().
+ */
+int k_work_schedule_slack(struct k_work_delayable *dwork,
+			  k_timeout_t delay, k_timeout_t slack);
+#endif
+
 /** @brief Reschedule a work item to a queue after a delay.
  *
  * Unlike k_work_schedule_for_queue() this function can change the deadline of
@@ -3899,6 +4158,17 @@ struct k_work_delayable {
 
 	/* The queue to which the work should be submitted. */
 	struct k_work_q *queue;
+
+#ifdef CONFIG_WORK_DELAYABLE_SLACK
+	/* Node in the list of work sharing the slack timeout, used
+	 * instead of the timeout when scheduled with slack.
+	 */
+	sys_dnode_t slack_node;
+
+	/* Ticks before which and at which the work is submitted. */
+	k_ticks_t slack_start;
+	k_ticks_t slack_end;
+#endif
 };
 
 #define Z_WORK_DELAYABLE_INITIALIZER(work_handler) { \
@@ -3942,6 +4212,10 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Item being flushed, the flusher waits while it is running. */
+	struct k_work *target;
+#endif
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -4008,6 +4282,18 @@ struct k_work_queue_config {
 	bool no_yield;
 };
 
+/** @brief A structure holding an additional thread of a work queue.
+ *
+ * See k_work_queue_add_worker().
+ */
+struct k_work_q_worker {
+	/* The thread that animates the work. */
+	struct k_thread thread;
+
+	/* Node in the list of workers of the queue. */
+	sys_snode_t node;
+};
+
 /** @brief A structure used to hold work until it can be processed. */
 struct k_work_q {
 	/* The thread that animates the work. */
@@ -4028,6 +4314,14 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Additional threads animating the work. */
+	sys_slist_t workers;
+
+	/* Number of threads currently running a work item. */
+	uint16_t busy;
+#endif
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4052,12 +4346,24 @@ static inline bool k_work_delayable_is_pending(
 static inline k_ticks_t k_work_delayable_expires_get(
 	const struct k_work_delayable *dwork)
 {
+#ifdef CONFIG_WORK_DELAYABLE_SLACK
+	if (sys_dnode_is_linked(&dwork->slack_node)) {
+		return dwork->slack_end;
+	}
+#endif
+
 	return z_timeout_expires(&dwork->timeout);
 }
 
 static inline k_ticks_t k_work_delayable_remaining_get(
 	const struct k_work_delayable *dwork)
 {
+#ifdef CONFIG_WORK_DELAYABLE_SLACK
+	if (sys_dnode_is_linked(&dwork->slack_node)) {
+		return MAX(dwork->slack_end - k_uptime_ticks(), 0);
+	}
+#endif
+
 	return z_timeout_remaining(&dwork->timeout);
 }
 
@@ -4433,6 +4739,10 @@ struct k_msgq {
 #ifdef CONFIG_OBJ_CORE_MSGQ
 	struct k_obj_core  obj_core;
 #endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+	struct k_wait_stats  wait_stats;
+#endif
 };
 /**
  * @cond INTERNAL_HIDDEN
@@ -4685,6 +4995,140 @@ static inline uint32_t z_impl_k_msgq_num_used_get(struct k_msgq *msgq)
 
 /** @} */
 
+#if defined(CONFIG_SPSC_MSGQ) || defined(__DOXYGEN__)
+/**
+ * @defgroup spsc_msgq_apis Single-Producer Single-Consumer Message Queue APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief Single-producer single-consumer message queue structure
+ *
+ * A message queue with exactly one producer, which may be an ISR, and one
+ * consumer thread.  Messages are put and got without locking; the kernel
+ * scheduler is only involved when the consumer waits on an empty queue.
+ * This is a kernel-mode only object.
+ */
+struct k_spsc_msgq {
+	/** Wait queue of the consumer */
+	_wait_q_t wait_q;
+	/** Lock protecting the wait queue */
+	struct k_spinlock lock;
+	/** Message size */
+	size_t msg_size;
+	/** Maximal number of messages */
+	uint32_t max_msgs;
+	/** Start of message buffer */
+	char *buffer;
+	/** Number of messages got, only written by the consumer */
+	atomic_t head;
+	/** Number of messages put, only written by the producer */
+	atomic_t tail;
+	/** Non-zero while the consumer waits for a message */
+	atomic_t waiting;
+};
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+#define Z_SPSC_MSGQ_INITIALIZER(obj, q_buffer, q_msg_size, q_max_msgs) \
+	{ \
+	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.msg_size = q_msg_size, \
+	.max_msgs = q_max_msgs, \
+	.buffer = q_buffer, \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Statically define and initialize a single-producer single-consumer
+ * message queue.
+ *
+ * @param q_name Name of the message queue.
+ * @param q_msg_size Message size (in bytes).
+ * @param q_max_msgs Maximum number of messages that can be queued
+ *        (power of 2).
+ * @param q_align Alignment of the message queue's ring buffer (power of 2).
+ */
+#define K_SPSC_MSGQ_DEFINE(q_name, q_msg_size, q_max_msgs, q_align)	\
+	BUILD_ASSERT(IS_POWER_OF_TWO(q_max_msgs),			\
+		     "q_max_msgs must be a power of 2");		\
+	static char __noinit __aligned(q_align)				\
+		_k_spsc_msgq_buf_##q_name[(q_max_msgs) * (q_msg_size)];	\
+	struct k_spsc_msgq q_name =					\
+	       Z_SPSC_MSGQ_INITIALIZER(q_name, _k_spsc_msgq_buf_##q_name, \
+				       (q_msg_size), (q_max_msgs))
+
+/**
+ * @brief Initialize a single-producer single-consumer message queue.
+ *
+ * @param msgq Address of the message queue.
+ * @param buffer Pointer to ring buffer that holds queued messages.
+ * @param msg_size Message size (in bytes).
+ * @param max_msgs Maximum number of messages that can be queued (power of 2).
+ */
+void k_spsc_msgq_init(struct k_spsc_msgq *msgq, char *buffer, size_t msg_size,
+		      uint32_t max_msgs);
+
+/**
+ * @brief Send a message to a single-producer single-consumer message queue.
+ *
+ * Must only be called by the producer of the queue.  The message is copied
+ * without taking any lock; the consumer is woken only if it waits.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to the message.
+ *
+ * @retval 0 Message sent.
+ * @retval -ENOMSG Queue is full.
+ */
+int k_spsc_msgq_put(struct k_spsc_msgq *msgq, const void *data);
+
+/**
+ * @brief Receive a message from a single-producer single-consumer message
+ * queue.
+ *
+ * Must only be called by the consumer of the queue.
+ *
+ * @note @p timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold the received message.
+ * @param timeout Waiting period to receive the message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @retval 0 Message received.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_spsc_msgq_get(struct k_spsc_msgq *msgq, void *data, k_timeout_t timeout);
+
+/**
+ * @brief Get the number of messages in a single-producer single-consumer
+ * message queue.
+ *
+ * @param msgq Address of the message queue.
+ *
+ * @return Number of messages.
+ */
+static inline uint32_t k_spsc_msgq_num_used_get(struct k_spsc_msgq *msgq)
+{
+	return (uint32_t)atomic_get(&msgq->tail) - (uint32_t)atomic_get(&msgq->head);
+}
+
+/** @} */
+#endif /* CONFIG_SPSC_MSGQ */
+
 /**
  * @defgroup mailbox_apis Mailbox APIs
  * @ingroup kernel_apis
@@ -4856,6 +5300,7 @@ struct k_pipe {
 	size_t         bytes_used;      /**< # bytes used in buffer */
 	size_t         read_index;      /**< Where in buffer to read from */
 	size_t         write_index;     /**< Where in buffer to write */
+	size_t         put_claimed;     /**< # bytes claimed for writing */
 	struct k_spinlock lock;		/**< Synchronization lock */
 
 	struct {
@@ -4886,6 +5331,7 @@ struct k_pipe {
 	.bytes_used = 0,                                            \
 	.read_index = 0,                                            \
 	.write_index = 0,                                           \
+	.put_claimed = 0,                                           \
 	.lock = {},                                                 \
 	.wait_q = {                                                 \
 		.readers = Z_WAIT_Q_INIT(&obj.wait_q.readers),       \
@@ -5051,6 +5497,48 @@ __syscall void k_pipe_flush(struct k_pipe *pipe);
  */
 __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
 
+/**
+ * @brief Claim space in the pipe's buffer to write data in place.
+ *
+ * This routine gives the caller a contiguous region of the pipe's buffer
+ * in which to write data directly, instead of writing it from another
+ * buffer with k_pipe_put(). The data is only made available to readers
+ * by k_pipe_put_finish(), which must be called before claiming again.
+ *
+ * While space is claimed, k_pipe_put() and pended writers don't use the
+ * pipe's buffer.
+ *
+ * @note Only available to supervisor threads, the claimed region is in
+ * the pipe's buffer.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param data Set to the start of the claimed region.
+ * @param size Maximum number of bytes to claim.
+ *
+ * @return Number of bytes claimed, 0 if the buffer is full or space is
+ *	   already claimed.
+ */
+size_t k_pipe_put_claim(struct k_pipe *pipe, void **data, size_t size);
+
+/**
+ * @brief Write data claimed with k_pipe_put_claim() to a pipe.
+ *
+ * The first @a size bytes of the claimed region are added to the pipe and
+ * handed over to pended readers, if any; the rest of the region is given
+ * back.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes written in the claimed region.
+ *
+ * @retval 0 Data written.
+ * @retval -EINVAL @a size is larger than the claimed region.
+ */
+int k_pipe_put_finish(struct k_pipe *pipe, size_t size);
+
 /** @} */
 
 /**
@@ -5214,6 +5702,56 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem,
  */
 void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
 
+/**
+ * @brief Allocate multiple memory blocks from a memory slab.
+ *
+ * This routine allocates @a count memory blocks from a memory slab,
+ * taking the slab's lock only once rather than once per block.  The
+ * allocation is all or nothing: on failure no block is allocated.
+ *
+ * If fewer than @a count blocks are free and @a timeout allows
+ * waiting, the free blocks are taken and the caller then waits for
+ * the remaining ones one at a time, in the same way and in the same
+ * wait queue as k_mem_slab_alloc().  Blocks obtained that way are held
+ * while waiting and returned to the slab if the waiting period
+ * expires, so multiple threads concurrently waiting for more blocks
+ * than remain may all time out (or, with K_FOREVER, wait forever).
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ * @note When CONFIG_MULTITHREADING=n any @a timeout is treated as K_NO_WAIT.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param slab Address of the memory slab.
+ * @param mem Array of @a count block addresses, set on success.
+ * @param count Number of blocks to allocate.
+ * @param timeout Non-negative waiting period to wait for operation to complete.
+ *        Use K_NO_WAIT to return without waiting,
+ *        or K_FOREVER to wait as long as necessary.
+ *
+ * @retval 0 Memory allocated.
+ * @retval -ENOMEM Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL @a count is larger than the number of blocks in the slab.
+ */
+int k_mem_slab_alloc_n(struct k_mem_slab *slab, void **mem, uint32_t count,
+		       k_timeout_t timeout);
+
+/**
+ * @brief Free multiple memory blocks allocated from a memory slab.
+ *
+ * This routine releases @a count previously allocated memory blocks
+ * back to their memory slab under a single acquisition of the slab's
+ * lock.  As with k_mem_slab_free(), blocks are handed over to threads
+ * waiting in k_mem_slab_alloc() or k_mem_slab_alloc_n() first.
+ *
+ * @param slab Address of the memory slab.
+ * @param mem Array of @a count block addresses, as returned by
+ *        k_mem_slab_alloc() or k_mem_slab_alloc_n().
+ * @param count Number of blocks to free.
+ */
+void k_mem_slab_free_n(struct k_mem_slab *slab, void **mem, uint32_t count);
+
 /**
  * @brief Get the number of used blocks in a memory slab.
  *
@@ -5300,10 +5838,27 @@ int k_mem_slab_runtime_stats_reset_max(struct k_mem_slab *slab);
 
 /* kernel synchronized heap struct */
 
+#ifdef CONFIG_KERNEL_HEAP_CPU_CACHE
+/* Per-CPU magazines of free small blocks, one per size class */
+struct z_heap_cpu_cache {
+	struct k_spinlock lock;
+	uint8_t count[CONFIG_KERNEL_HEAP_CPU_CACHE_CLASSES];
+	void *blocks[CONFIG_KERNEL_HEAP_CPU_CACHE_CLASSES]
+		    [CONFIG_KERNEL_HEAP_CPU_CACHE_DEPTH];
+	/* Usable bytes of the blocks held in this cache */
+	size_t cached_bytes;
+};
+#endif
+
 struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_KERNEL_HEAP_CPU_CACHE
+	struct z_heap_cpu_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+	/* Allocators that may block, caching is bypassed while nonzero */
+	atomic_t cache_waiters;
+#endif
 };
 
 /**
@@ -5380,10 +5935,57 @@ void *k_heap_alloc(struct k_heap *h, size_t bytes,
  */
 void k_heap_free(struct k_heap *h, void *mem) __attribute_nonnull(1);
 
+#if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the runtime statistics of a k_heap
+ *
+ * Like sys_heap_runtime_stats_get() on the underlying sys_heap, but
+ * safe against concurrent use of the heap.  With
+ * CONFIG_KERNEL_HEAP_CPU_CACHE, blocks held in the per-CPU caches
+ * are reported as free rather than allocated.
+ *
+ * @param h Heap to query
+ * @param stats Pointer to struct to copy statistics into
+ * @return -EINVAL if null pointers, otherwise 0
+ */
+int k_heap_runtime_stats_get(struct k_heap *h, struct sys_memory_stats *stats);
+#endif
+
+/**
+ * @brief Return all blocks held in the per-CPU caches to the heap
+ *
+ * This is done automatically when an allocation cannot be satisfied,
+ * but may be useful before checking heap fragmentation or integrity.
+ * Does nothing without CONFIG_KERNEL_HEAP_CPU_CACHE.
+ *
+ * @param h Heap whose caches should be flushed
+ */
+void k_heap_cache_flush(struct k_heap *h);
+
 /* Hand-calculated minimum heap sizes needed to return a successful
  * 1-byte allocation.  See details in lib/os/heap.[ch]
  */
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* With TLSF, chunk 0 holds struct z_heap and one bucket of
+ * 4 + 4 * 2^SL_LOG2 bytes per size class of the heap.  It is followed by
+ * the chunk of the 1-byte allocation and by the footer of the end marker,
+ * all rounded to 8-byte chunk units.  A heap that small has 3 size
+ * classes with SL_LOG2 = 2, 2 with SL_LOG2 = 3 and 1 above, which
+ * lib/os/heap.c checks at build time.
+ */
+#define Z_HEAP_TLSF_CHUNK_HDR_SIZE \
+	((sizeof(void *) > 4 || IS_ENABLED(CONFIG_SYS_HEAP_BIG_ONLY)) ? 8 : 4)
+#define Z_HEAP_TLSF_HDR_SIZE (4 * sizeof(uint32_t) + \
+	(IS_ENABLED(CONFIG_SYS_HEAP_RUNTIME_STATS) ? 3 * sizeof(size_t) : 0))
+#define Z_HEAP_TLSF_MIN_BUCKETS(sl) ((sl) == 2 ? 3 : (sl) == 3 ? 2 : 1)
+#define Z_HEAP_TLSF_MIN_SIZE(sl)						\
+	(ROUND_UP(Z_HEAP_TLSF_HDR_SIZE +					\
+		  Z_HEAP_TLSF_MIN_BUCKETS(sl) * (4 + 4 * BIT(sl)), 8) +	\
+	 ROUND_UP(Z_HEAP_TLSF_CHUNK_HDR_SIZE + 1, 8) + Z_HEAP_TLSF_CHUNK_HDR_SIZE)
+#define Z_HEAP_MIN_SIZE Z_HEAP_TLSF_MIN_SIZE(CONFIG_SYS_HEAP_TLSF_SL_LOG2)
+#else
 #define Z_HEAP_MIN_SIZE (sizeof(void *) > 4 ? 56 : 44)
+#endif
 
 /**
  * @brief Define a static k_heap in the specified linker section
@@ -5656,6 +6258,11 @@ struct k_poll_event {
 	/** PRIVATE - DO NOT TOUCH */
 	struct z_poller *poller;
 
+#ifdef CONFIG_POLL_SET
+	/** PRIVATE - DO NOT TOUCH */
+	sys_dnode_t _set_node;
+#endif
+
 	/** optional user-specified tag, opaque, untouched by the API */
 	uint32_t tag:8;
 
@@ -5830,6 +6437,91 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+#if defined(CONFIG_POLL_SET) || defined(__DOXYGEN__)
+
+/**
+ * @brief Poll set
+ *
+ * Events added to a poll set stay registered with their objects until they
+ * are removed, and the objects queue them on the set when they become ready.
+ * Waiting on the set thus only costs the number of ready events, whatever
+ * the number of events in the set.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - ready events, linked by their set node */
+	sys_dlist_t ready;
+
+	/** PRIVATE - thread waiting on the set */
+	_wait_q_t wait_q;
+};
+
+/**
+ * @brief Initialize a poll set
+ *
+ * @param set The poll set to initialize.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add an event to a poll set
+ *
+ * The event, initialized with k_poll_event_init(), is registered with its
+ * object until it is removed from the set with k_poll_set_remove(). If the
+ * object is already available, the event is ready right away.
+ *
+ * As with k_poll(), threads pending on the object have precedence over the
+ * set, and so have threads polling on the object with k_poll().
+ *
+ * @param set The poll set.
+ * @param event The event to add, it must not be in use.
+ *
+ * @retval 0 The event was added.
+ * @retval -EBUSY The event is already registered.
+ */
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Remove an event from a poll set
+ *
+ * @param set The poll set.
+ * @param event The event to remove.
+ *
+ * @retval 0 The event was removed.
+ * @retval -EINVAL The event is not in the set.
+ */
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to be ready
+ *
+ * Returns the events of the set that became ready since they were last
+ * returned, oldest first. The state field of each returned event holds the
+ * K_POLL_STATE_xxx values signaled in that time, and does not need to be
+ * reset by the caller.
+ *
+ * An event is queued when its object becomes available, not while it stays
+ * available: the caller should consume the object until it is empty, e.g.
+ * with K_NO_WAIT calls, before waiting on the set again.
+ *
+ * Only one thread may wait on a given set at a time.
+ *
+ * @param set The poll set.
+ * @param events Array filled with the ready events.
+ * @param max_events Size of the @p events array.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of ready events stored in @p events, or -EAGAIN if none
+ *         was ready within the waiting period.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events,
+		    int max_events, k_timeout_t timeout);
+
+#endif /* CONFIG_POLL_SET */
+
 /** @} */
 
 /**
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_KERNEL_RCU_H_
+#define ZEPHYR_INCLUDE_KERNEL_RCU_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/barrier.h>
+#include <zephyr/sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup rcu_apis Read-Copy-Update APIs
+ * @ingroup kernel_apis
+ * @{
+ *
+ * Read-copy-update lets readers of a read-mostly structure reached through
+ * a pointer run without taking any lock. Updaters publish a new copy with
+ * K_RCU_ASSIGN_POINTER() and free the old one once every reader that may
+ * still use it is done, after k_rcu_synchronize() returns or from a
+ * callback given to k_rcu_call().
+ *
+ * Read-side sections must not block. They can be nested, and can be used
+ * in interrupts. These APIs are only available in supervisor mode.
+ */
+
+struct k_rcu_head;
+
+/**
+ * @brief Callback called once a grace period has elapsed
+ *
+ * @param head Head given to k_rcu_call(), usually embedded in the
+ *             structure to free.
+ */
+typedef void (*k_rcu_callback_t)(struct k_rcu_head *head);
+
+/**
+ * @brief Deferred callback head
+ */
+struct k_rcu_head {
+	/** @cond INTERNAL_HIDDEN */
+	sys_snode_t node;
+	k_rcu_callback_t func;
+	/** @endcond */
+};
+
+/**
+ * @brief Enter a read-side section
+ *
+ * The calling thread is not preempted until the matching
+ * k_rcu_read_unlock().
+ */
+static inline void k_rcu_read_lock(void)
+{
+	if (!k_is_in_isr()) {
+		k_sched_lock();
+	}
+}
+
+/**
+ * @brief Leave a read-side section
+ */
+static inline void k_rcu_read_unlock(void)
+{
+	if (!k_is_in_isr()) {
+		k_sched_unlock();
+	}
+}
+
+/**
+ * @brief Read a pointer published with K_RCU_ASSIGN_POINTER()
+ *
+ * Must be used within a read-side section, and the structure it points to
+ * must not be used after the section.
+ *
+ * @param p Pointer to read.
+ */
+#define K_RCU_DEREFERENCE(p) (*(volatile __typeof__(p) *)&(p))
+
+/**
+ * @brief Publish a pointer to readers
+ *
+ * The structure pointed to is fully written before the pointer is.
+ *
+ * @param p Pointer to set.
+ * @param v New value.
+ */
+#define K_RCU_ASSIGN_POINTER(p, v)                                             \
+	do {                                                                   \
+		barrier_dmem_fence_full();                                     \
+		*(volatile __typeof__(p) *)&(p) = (v);                         \
+	} while (false)
+
+/**
+ * @brief Wait for the read-side sections in progress to end
+ *
+ * Read-side sections started before the call have ended when it returns,
+ * the structures unpublished before it can thus be freed. Must be called
+ * from a thread, outside any read-side section.
+ */
+void k_rcu_synchronize(void);
+
+/**
+ * @brief Call a function once the read-side sections in progress have ended
+ *
+ * The function is called from the system work queue. Can be called from
+ * an interrupt.
+ *
+ * @param head Callback head, not to be used until the callback is called.
+ * @param func Function to call.
+ */
+void k_rcu_call(struct k_rcu_head *head, k_rcu_callback_t func);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_KERNEL_RCU_H_ */
@@ -30,4 +30,36 @@ struct k_cycle_stats {
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
+#if defined(CONFIG_OBJ_CORE_STATS_WAIT) || defined(__DOXYGEN__)
+/** Number of buckets of the wait time histogram */
+#define K_WAIT_STATS_BUCKETS                                              \
+	((CONFIG_OBJ_CORE_STATS_WAIT_RANGE -                              \
+	  CONFIG_OBJ_CORE_STATS_WAIT_PRECISION + 1) <<                    \
+	 CONFIG_OBJ_CORE_STATS_WAIT_PRECISION)
+
+/**
+ * Structure used to track the time threads wait on a kernel object,
+ * in microseconds. This is the raw object core statistics of the
+ * object types supporting it.
+ */
+struct k_wait_stats {
+	uint64_t  total;        /**< total wait time */
+	uint32_t  count;        /**< \# of waits */
+	uint32_t  max;          /**< longest wait */
+	uint32_t  histogram[K_WAIT_STATS_BUCKETS]; /**< log-linear histogram */
+};
+
+/**
+ * Wait time statistics reported by k_obj_core_stats_query(), in
+ * microseconds. Percentiles are upper bounds of histogram buckets.
+ */
+struct k_wait_stats_query {
+	uint32_t  count;        /**< \# of waits */
+	uint32_t  average;      /**< average wait time */
+	uint32_t  p50;          /**< median wait time */
+	uint32_t  p99;          /**< 99th percentile wait time */
+	uint32_t  max;          /**< longest wait */
+};
+#endif
+
 #endif
@@ -13,6 +13,7 @@
 
 #include <zephyr/kernel/stats.h>
 #include <zephyr/sys/arch_interface.h>
+#include <zephyr/sys/atomic.h>
 
 /**
  * @typedef k_thread_entry_t
@@ -184,6 +185,19 @@ struct _mem_domain_info {
 	struct k_mem_domain *mem_domain;
 };
 
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+struct k_object;
+
+struct _thread_obj_cache {
+	/** kernel object addresses */
+	const void *addr[CONFIG_USERSPACE_OBJ_CACHE_SIZE];
+	/** kernel object metadata found for them */
+	struct k_object *ko[CONFIG_USERSPACE_OBJ_CACHE_SIZE];
+	/** generation of the global cache state the entries belong to */
+	uint32_t gen;
+};
+#endif /* CONFIG_USERSPACE_OBJ_CACHE */
+
 #endif /* CONFIG_USERSPACE */
 
 #ifdef CONFIG_THREAD_USERSPACE_LOCAL_DATA
@@ -228,6 +242,18 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	/*
+	 * These fields are always zero for individual threads. For CPU
+	 * statistics they count the scheduler IPIs sent by and received
+	 * on the CPU. They are read from the per CPU atomic counters and
+	 * wrap around like them.
+	 */
+
+	atomic_val_t ipi_sent;
+	atomic_val_t ipi_received;
+#endif
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
@@ -315,6 +341,10 @@ struct k_thread {
 	k_thread_stack_t *stack_obj;
 	/** current syscall frame pointer */
 	void *syscall_frame;
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+	/** recently looked up kernel objects */
+	struct _thread_obj_cache obj_cache;
+#endif
 #endif /* CONFIG_USERSPACE */
 
 
@@ -146,13 +146,23 @@ struct _cpu {
 #endif
 #endif
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	/* Scheduler IPIs sent by / received on this CPU */
+	atomic_t ipi_sent;
+	atomic_t ipi_received;
+#endif
+
 #ifdef CONFIG_OBJ_CORE_SYSTEM
 	struct k_obj_core  obj_core;
 #endif
 
 	/* Per CPU architecture specifics */
 	struct _cpu_arch arch;
+#if defined(CONFIG_SMP) && (CONFIG_SMP_CPU_ALIGN > 0)
+} __aligned(CONFIG_SMP_CPU_ALIGN);
+#else
 };
+#endif
 
 typedef struct _cpu _cpu_t;
 
@@ -197,8 +207,11 @@ struct z_kernel {
 #endif
 
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
-	/* Need to signal an IPI at the next scheduling point */
-	bool pending_ipi;
+	/* Bitmask of CPUs to signal with an IPI at the next scheduling
+	 * point (any non-zero value means "all" without
+	 * CONFIG_ARCH_HAS_DIRECTED_IPIS)
+	 */
+	atomic_t pending_ipi;
 #endif
 };
 
@@ -252,14 +265,27 @@ struct _timeout;
 typedef void (*_timeout_func_t)(struct _timeout *t);
 
 struct _timeout {
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+	struct rbnode node;
+	/* FIFO order among equal deadlines, zero while not queued */
+	uint64_t order_key;
+#else
 	sys_dnode_t node;
+#endif
 	_timeout_func_t fn;
 #ifdef CONFIG_TIMEOUT_64BIT
-	/* Can't use k_ticks_t for header dependency reasons */
+	/* Can't use k_ticks_t for header dependency reasons.  With
+	 * CONFIG_TIMEOUT_QUEUE_SCALABLE this is the absolute expiry
+	 * tick rather than a delta from the previous timeout.
+	 */
 	int64_t dticks;
 #else
 	int32_t dticks;
 #endif
+#ifdef CONFIG_TIMEOUT_SLACK
+	/* Expiry is rounded up to a multiple of this many ticks */
+	uint32_t slack;
+#endif
 };
 
 typedef void (*k_thread_timeslice_fn_t)(struct k_thread *thread, void *data);
@@ -52,6 +52,9 @@ struct llext {
 	/** Lookup table of llext memory regions */
 	void *mem[LLEXT_MEM_COUNT];
 
+	/** Memory regions allocated on the llext heap, others are used in place */
+	bool mem_on_heap[LLEXT_MEM_COUNT];
+
 	/** Total size of the llext memory usage */
 	size_t mem_size;
 
@@ -100,6 +103,9 @@ void llext_unload(struct llext *ext);
 /**
  * @brief Find the address for an arbitrary symbol name.
  *
+ * The base table is sorted by name at link time and searched with a binary
+ * search, the symbol table of an extension is searched linearly.
+ *
  * @param[in] sym_table Symbol table to lookup symbol in, if NULL uses base table
  * @param[in] sym_name Symbol name to find
  *
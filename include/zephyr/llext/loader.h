@@ -75,6 +75,22 @@ struct llext_loader {
 	 */
 	int (*seek)(struct llext_loader *s, size_t pos);
 
+	/**
+	 * @brief Peek at an absolute location
+	 *
+	 * Return a pointer to the data at a given position, for loaders
+	 * whose data is addressable memory. Sections that are not
+	 * modified by the loader are then used in place rather than
+	 * copied. Optional, may be NULL.
+	 *
+	 * @param[in] ldr Loader
+	 * @param[in] pos Position in stream
+	 *
+	 * @retval pointer to the data at the given position
+	 * @retval NULL if the data is not directly accessible
+	 */
+	void *(*peek)(struct llext_loader *ldr, size_t pos);
+
 	/** @cond ignore */
 	elf_ehdr_t hdr;
 	elf_shdr_t sects[LLEXT_SECT_COUNT];
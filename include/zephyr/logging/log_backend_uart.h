@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_LOG_BACKEND_UART_H_
+#define ZEPHYR_LOG_BACKEND_UART_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief UART backend statistics. */
+struct log_backend_uart_stats {
+	/** Number of bytes output. */
+	uint32_t bytes;
+
+	/** Number of log messages reported as dropped. */
+	uint32_t dropped;
+
+	/** Number of times output waited for an asynchronous transfer. */
+	uint32_t tx_waits;
+
+	/** Total time spent waiting for asynchronous transfers, in microseconds. */
+	uint32_t tx_wait_us;
+};
+
+/**
+ * @brief Get UART backend statistics.
+ *
+ * Available if CONFIG_LOG_BACKEND_UART_STATS is enabled.
+ *
+ * @param stats Location where statistics are copied.
+ */
+void log_backend_uart_stats_get(struct log_backend_uart_stats *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_LOG_BACKEND_UART_H_ */
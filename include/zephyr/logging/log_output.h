@@ -87,6 +87,10 @@ struct log_output_control_block {
 	atomic_t offset;
 	void *ctx;
 	const char *hostname;
+#ifdef CONFIG_LOG_DICTIONARY_COMPACT
+	log_timestamp_t dict_timestamp;
+	uint8_t dict_seq;
+#endif
 };
 
 /** @brief Log_output instance structure. */
@@ -23,6 +23,7 @@ extern "C" {
 enum log_dict_output_msg_type {
 	MSG_NORMAL = 0,
 	MSG_DROPPED_MSG = 1,
+	MSG_NORMAL_COMPACT = 2,
 };
 
 /**
@@ -38,6 +39,26 @@ struct log_dict_output_normal_msg_hdr_t {
 	log_timestamp_t timestamp;
 } __packed;
 
+/**
+ * Output for one compact dictionary based log message,
+ * used if CONFIG_LOG_DICTIONARY_COMPACT is enabled.
+ *
+ * The fixed part is followed by LEB128 encoded fields: source ID,
+ * zigzag encoded timestamp difference to the previous message,
+ * package length and data length. Then come the 32-bit words of the
+ * package arguments section, each LEB128 encoded, the remaining
+ * package bytes and the hexdump data, both as is.
+ *
+ * The timestamp difference is relative to 0 when the sequence number
+ * wraps to 0, so that a reader joining a live stream can synchronize.
+ */
+struct log_dict_output_compact_msg_hdr_t {
+	uint8_t type;
+	uint8_t seq;
+	uint8_t domain:3;
+	uint8_t level:3;
+} __packed;
+
 /**
  * Output for one dictionary based log message about
  * dropped messages.
@@ -374,6 +374,24 @@ struct modbus_user_callbacks {
 
 	/** Floating Point Holding Register write callback */
 	int (*holding_reg_wr_fp)(uint16_t addr, float reg);
+
+	/**
+	 * Input Register block read callback. If set, it is used instead of
+	 * input_reg_rd to read all registers of a request at once.
+	 */
+	int (*input_regs_rd)(uint16_t addr, uint16_t *regs, uint16_t num_regs);
+
+	/**
+	 * Holding Register block read callback. If set, it is used instead
+	 * of holding_reg_rd to read all registers of a request at once.
+	 */
+	int (*holding_regs_rd)(uint16_t addr, uint16_t *regs, uint16_t num_regs);
+
+	/**
+	 * Holding Register block write callback. If set, it is used instead
+	 * of holding_reg_wr to write all registers of a FC16 request at once.
+	 */
+	int (*holding_regs_wr)(uint16_t addr, const uint16_t *regs, uint16_t num_regs);
 };
 
 /**
@@ -26,6 +26,7 @@ enum modem_pipe_event {
 	MODEM_PIPE_EVENT_OPENED = 0,
 	MODEM_PIPE_EVENT_RECEIVE_READY,
 	MODEM_PIPE_EVENT_CLOSED,
+	MODEM_PIPE_EVENT_TRANSMIT_IDLE,
 };
 
 /**
@@ -213,6 +214,17 @@ void modem_pipe_notify_closed(struct modem_pipe *pipe);
  */
 void modem_pipe_notify_receive_ready(struct modem_pipe *pipe);
 
+/**
+ * @brief Notify user of pipe that it can transmit again
+ *
+ * @param pipe Pipe instance
+ *
+ * @note Invoked from instance which initialized the pipe instance, once the
+ * data it accepted has been transmitted. A user which got 0 from
+ * modem_pipe_transmit() can wait for this event before trying again.
+ */
+void modem_pipe_notify_transmit_idle(struct modem_pipe *pipe);
+
 /**
  * @endcond
  */
@@ -1122,8 +1122,30 @@ extern const struct net_buf_data_cb net_buf_fixed_cb;
  * @param _destroy   Optional destroy callback when buffer is freed.
  */
 #define NET_BUF_POOL_FIXED_DEFINE(_name, _count, _data_size, _ud_size, _destroy) \
+	NET_BUF_POOL_FIXED_DEFINE_IN_SECTION(_name, _count, _data_size, _ud_size, \
+					     _destroy, __noinit)
+
+/**
+ *
+ * @brief Define a new pool for buffers based on fixed-size data, placed in
+ *        a specific memory section
+ *
+ * Same as NET_BUF_POOL_FIXED_DEFINE(), except that the data payload of the
+ * buffers is placed with @p _in_section, e.g. in a memory region a DMA
+ * controller can access. This lets a driver have the hardware write
+ * directly into the buffers it passes to the network stack.
+ *
+ * @param _name       Name of the pool variable.
+ * @param _count      Number of buffers in the pool.
+ * @param _data_size  Maximum data payload per buffer.
+ * @param _ud_size    User data space to reserve per buffer.
+ * @param _destroy    Optional destroy callback when buffer is freed.
+ * @param _in_section Section attribute of the data payload, e.g. __nocache.
+ */
+#define NET_BUF_POOL_FIXED_DEFINE_IN_SECTION(_name, _count, _data_size, _ud_size, \
+					     _destroy, _in_section)		  \
 	_NET_BUF_ARRAY_DEFINE(_name, _count, _ud_size);                        \
-	static uint8_t __noinit net_buf_data_##_name[_count][_data_size] __net_buf_align; \
+	static uint8_t _in_section net_buf_data_##_name[_count][_data_size] __net_buf_align; \
 	static const struct net_buf_pool_fixed net_buf_fixed_##_name = {       \
 		.data_size = _data_size,                                       \
 		.data_pool = (uint8_t *)net_buf_data_##_name,                  \
@@ -1288,6 +1310,38 @@ struct net_buf * __must_check net_buf_alloc_len(struct net_buf_pool *pool,
 						k_timeout_t timeout);
 #endif
 
+/**
+ * @brief Allocate a chain of fixed buffers from a pool.
+ *
+ * Allocate @p count buffers from a pool with fixed size data, linked
+ * together as fragments of the first one. Buffers never used before are
+ * all taken from the pool at once, which is cheaper than allocating the
+ * buffers one by one.
+ *
+ * @param pool Which pool to allocate the buffers from.
+ * @param count Number of buffers to allocate, must not be zero.
+ * @param timeout Affects the action taken should the pool be empty.
+ *        If K_NO_WAIT, then return immediately. If K_FOREVER, then
+ *        wait as long as necessary. Otherwise, wait until the specified
+ *        timeout, for all the buffers.
+ *
+ * @return First buffer of the chain or NULL if out of buffers, in which
+ *         case none is allocated.
+ */
+#if defined(CONFIG_NET_BUF_LOG)
+struct net_buf * __must_check net_buf_alloc_bulk_debug(struct net_buf_pool *pool,
+						       size_t count,
+						       k_timeout_t timeout,
+						       const char *func,
+						       int line);
+#define net_buf_alloc_bulk(_pool, _count, _timeout) \
+	net_buf_alloc_bulk_debug(_pool, _count, _timeout, __func__, __LINE__)
+#else
+struct net_buf * __must_check net_buf_alloc_bulk(struct net_buf_pool *pool,
+						 size_t count,
+						 k_timeout_t timeout);
+#endif
+
 /**
  * @brief Allocate a new buffer from a pool but with external data pointer.
  *
@@ -1417,7 +1471,9 @@ void net_buf_put(struct k_fifo *fifo, struct net_buf *buf);
 /**
  * @brief Decrements the reference count of a buffer.
  *
- * The buffer is put back into the pool if the reference count reaches zero.
+ * The buffer is put back into the pool if the reference count reaches zero,
+ * in which case the same is done for its fragments. Consecutive fragments
+ * from a pool without destroy callback are put back at once.
  *
  * @param buf A valid pointer on a buffer
  */
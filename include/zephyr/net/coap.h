@@ -238,6 +238,15 @@ typedef int (*coap_method_t)(struct coap_resource *resource,
 typedef void (*coap_notify_t)(struct coap_resource *resource,
 			      struct coap_observer *observer);
 
+/**
+ * @typedef coap_notify_send_t
+ * @brief Type of the callback sending to an observer a notification built
+ * once for all of them, see coap_resource_notify_packet().
+ */
+typedef int (*coap_notify_send_t)(struct coap_resource *resource,
+				  struct coap_observer *observer,
+				  const struct msghdr *msg, void *user_data);
+
 /**
  * @brief Description of CoAP resource.
  *
@@ -254,6 +263,20 @@ struct coap_resource {
 	int age;
 };
 
+/**
+ * @brief Index of an array of resources, see coap_resource_index_init().
+ */
+struct coap_resource_index {
+	/** Indexed array of resources */
+	struct coap_resource *resources;
+	/** Positions in the array, sorted by path */
+	uint16_t *order;
+	/** Number of resources without wildcard, which come first in order */
+	uint16_t num_exact;
+	/** Number of resources */
+	uint16_t num_resources;
+};
+
 /**
  * @brief Represents a remote device that is observing a local resource.
  */
@@ -590,6 +613,53 @@ int coap_handle_request(struct coap_packet *cpkt,
 			uint8_t opt_num,
 			struct sockaddr *addr, socklen_t addr_len);
 
+/**
+ * @brief Build an index of resources to find them with a binary search
+ *
+ * The resources are sorted by path in @p order, so that
+ * coap_handle_request_index() finds a resource in logarithmic time instead
+ * of comparing its path with the path of every resource. The paths of the
+ * resources must not change while the index is used.
+ *
+ * @param index Index to initialize
+ * @param resources Array of known resources, terminated by an entry
+ *                  without path
+ * @param order Array filled with the positions of the resources, must stay
+ *              valid as long as the index is used
+ * @param order_len Length of @p order, at least the number of resources
+ *
+ * @retval 0 in case of success.
+ * @retval -ENOMEM if @p order is too short.
+ */
+int coap_resource_index_init(struct coap_resource_index *index,
+			     struct coap_resource *resources,
+			     uint16_t *order, size_t order_len);
+
+/**
+ * @brief Same as coap_handle_request(), with resources found through an
+ * index built with coap_resource_index_init().
+ *
+ * Resources are matched exactly as coap_handle_request() does, including
+ * the precedence of the first matching resource of the array.
+ *
+ * @param cpkt Packet received
+ * @param index Index of the known resources
+ * @param options Parsed options from coap_packet_parse()
+ * @param opt_num Number of options
+ * @param addr Peer address
+ * @param addr_len Peer address length
+ *
+ * @retval 0 in case of success.
+ * @retval -ENOTSUP in case of invalid request code.
+ * @retval -EPERM in case resource handler is not implemented.
+ * @retval -ENOENT in case the resource is not found.
+ */
+int coap_handle_request_index(struct coap_packet *cpkt,
+			      const struct coap_resource_index *index,
+			      struct coap_option *options,
+			      uint8_t opt_num,
+			      struct sockaddr *addr, socklen_t addr_len);
+
 /**
  * Represents the size of each block that will be transferred using
  * block-wise transfers [RFC7959]:
@@ -1026,6 +1096,35 @@ void coap_replies_clear(struct coap_reply *replies, size_t len);
  */
 int coap_resource_notify(struct coap_resource *resource);
 
+/**
+ * @brief Send the same notification to every registered observer of a
+ * resource.
+ *
+ * Instead of building a notification for each observer as the @a notify
+ * callback does, @p cpkt is built once, without token, and sent as is to
+ * all observers: for each of them, @p send is called with a message made
+ * of a copy of the header, with the token length of the observer and a new
+ * message id from coap_next_id(), the token of the observer, and the rest
+ * of @p cpkt. The message is addressed to the observer and can be given
+ * directly to zsock_sendmsg().
+ *
+ * The Observe option of @p cpkt should hold the updated age of the
+ * resource, this function does not change it.
+ *
+ * @param resource Resource that was updated
+ * @param cpkt Notification, initialized with an empty token
+ * @param send Callback sending the notification to one observer
+ * @param user_data User data given to @p send
+ *
+ * @retval 0 in case of success.
+ * @retval -EINVAL if @p cpkt has a token.
+ * @return Negative value returned by @p send, which stops the
+ *         notification.
+ */
+int coap_resource_notify_packet(struct coap_resource *resource,
+				const struct coap_packet *cpkt,
+				coap_notify_send_t send, void *user_data);
+
 /**
  * @brief Returns if this request is enabling observing a resource.
  *
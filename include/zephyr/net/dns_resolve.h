@@ -352,6 +352,9 @@ int dns_resolve_cancel_with_name(struct dns_resolve_context *ctx,
  * We might send the query to multiple servers (if there are more than one
  * server configured), but we only use the result of the first received
  * response.
+ * If CONFIG_DNS_RESOLVER_CACHE is enabled and the name is found in the
+ * cache, the callback is called before this function returns and no
+ * query is sent.
  *
  * @param ctx DNS context
  * @param query What the caller wants to resolve.
@@ -446,6 +449,65 @@ static inline int dns_cancel_addr_info(uint16_t dns_id)
 	return dns_resolve_cancel(dns_resolve_get_default(), dns_id);
 }
 
+/**
+ * DNS resolver cache entry information, passed to dns_cache_foreach()
+ * callback.
+ */
+struct dns_cache_info {
+	/** Name that was resolved */
+	const char *query;
+	/** Resolved address, NULL for a negative entry */
+	const struct dns_addrinfo *info;
+	/** Seconds until the entry expires */
+	uint32_t ttl;
+	/** 0 for a resolved address, DNS_EAI_* error for a negative entry */
+	int status;
+	/** Type of the query */
+	enum dns_query_type query_type;
+};
+
+/**
+ * @typedef dns_cache_cb_t
+ * @brief Callback used while iterating over DNS resolver cache entries.
+ *
+ * @param entry Information about the cache entry.
+ * @param user_data A valid pointer to user data or NULL
+ */
+typedef void (*dns_cache_cb_t)(const struct dns_cache_info *entry,
+			       void *user_data);
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+/**
+ * @brief Go through all the entries in the DNS resolver cache.
+ *
+ * @details Expired entries are skipped. The cache is locked while the
+ * callback is called, so the callback must not call DNS resolver API.
+ *
+ * @param cb Callback to call for each valid entry.
+ * @param user_data User specified data.
+ *
+ * @return Number of entries that were passed to the callback.
+ */
+int dns_cache_foreach(dns_cache_cb_t cb, void *user_data);
+
+/**
+ * @brief Remove all the entries from the DNS resolver cache.
+ */
+void dns_cache_flush(void);
+#else
+static inline int dns_cache_foreach(dns_cache_cb_t cb, void *user_data)
+{
+	ARG_UNUSED(cb);
+	ARG_UNUSED(user_data);
+
+	return 0;
+}
+
+static inline void dns_cache_flush(void)
+{
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
 /**
  * @}
  */
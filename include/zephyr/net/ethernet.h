@@ -179,6 +179,12 @@ enum ethernet_hw_caps {
 
 	/** TXTIME supported */
 	ETHERNET_TXTIME			= BIT(19),
+
+	/** TCP segmentation offload supported, TCP packets larger than the
+	 * MTU are split by the device into segments carrying at most
+	 * net_pkt_gso_size() bytes of payload each.
+	 */
+	ETHERNET_HW_TSO			= BIT(20),
 };
 
 /** @cond INTERNAL_HIDDEN */
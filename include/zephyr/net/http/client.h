@@ -80,6 +80,27 @@ typedef int (*http_header_cb_t)(int sock,
 				struct http_request *req,
 				void *user_data);
 
+/**
+ * @typedef http_payload_stream_cb_t
+ * @brief Callback used to get the payload of the request in parts.
+ *
+ * Called repeatedly until it returns 0. The parts are sent with the chunked
+ * transfer encoding, unless the payload length is given in the request.
+ *
+ * @param req HTTP request information
+ * @param buf Buffer to write the next part of the payload to
+ * @param len Size of @p buf
+ * @param user_data User specified data specified in http_client_req()
+ *
+ * @return >0 amount of data written to @p buf,
+ *         0  at the end of the payload,
+ *         <0 if http_client_req() should return the error code to the
+ *            caller.
+ */
+typedef int (*http_payload_stream_cb_t)(struct http_request *req,
+					uint8_t *buf, size_t len,
+					void *user_data);
+
 /**
  * @typedef http_response_cb_t
  * @brief Callback used when data is received from the server.
@@ -194,6 +215,23 @@ struct http_response {
 	uint8_t cl_present : 1;
 	uint8_t body_found : 1;
 	uint8_t message_complete : 1;
+
+	/** The server allows the connection to be reused for another
+	 * request, valid once the response is complete.
+	 */
+	uint8_t keep_alive : 1;
+};
+
+/**
+ * Byte range of the resource to request, for example to resume a download.
+ * The server answers with the status 206 if it honours the range.
+ */
+struct http_range {
+	/** Offset of the first byte */
+	size_t start;
+
+	/** Number of bytes, 0 for all the bytes from the start */
+	size_t len;
 };
 
 /** HTTP client internal data that the application should not touch
@@ -286,6 +324,16 @@ struct http_request {
 	 */
 	size_t payload_len;
 
+	/** User supplied callback function to call to get the payload in
+	 * parts. This can be NULL, in which case payload_cb or payload is
+	 * used. If payload_len is 0 the payload is sent with the chunked
+	 * transfer encoding, so its length does not need to be known.
+	 */
+	http_payload_stream_cb_t payload_stream_cb;
+
+	/** Range of the resource to request, may be NULL */
+	const struct http_range *range;
+
 	/** User supplied callback function to call when optional headers need
 	 * to be sent. This can be NULL, in which case the optional_headers
 	 * field in http_request is used. The idea of this optional_headers
@@ -324,6 +372,35 @@ struct http_request {
 int http_client_req(int sock, struct http_request *req,
 		    int32_t timeout, void *user_data);
 
+/**
+ * @brief Do several HTTP requests at once on a connection.
+ *
+ * All the requests are sent before waiting for the first response, so the
+ * server can answer them back to back without waiting for a round trip
+ * between each. The responses are then given in order to the response
+ * callback of each request, as done by http_client_req(). Only requests
+ * without payload, such as GET or HEAD requests, can be pipelined.
+ *
+ * Data of a response received together with the end of the previous one is
+ * moved to the receive buffer of its request, which must be at least as
+ * large as the receive buffer of the previous request. The requests may
+ * share a receive buffer.
+ *
+ * If the connection is closed before all the responses are received, the
+ * response callback of the remaining requests is called with a null
+ * response.
+ *
+ * @param sock Socket id of the connection.
+ * @param reqs HTTP requests, in the order they are sent
+ * @param count Number of requests
+ * @param timeout Max timeout to wait for each response, in milliseconds.
+ * @param user_data User specified data that is passed to the callbacks.
+ *
+ * @return <0 if error, >=0 amount of data sent to the server
+ */
+int http_client_req_pipelined(int sock, struct http_request *reqs[],
+			      size_t count, int32_t timeout, void *user_data);
+
 #ifdef __cplusplus
 }
 #endif
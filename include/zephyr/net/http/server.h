@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief HTTP server API
+ *
+ * Serves the resources of the services defined with HTTP_SERVICE_DEFINE()
+ * and HTTP_RESOURCE_DEFINE() over HTTP/1.1.
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_HTTP_SERVER_H_
+#define ZEPHYR_INCLUDE_NET_HTTP_SERVER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/http/parser.h>
+#include <zephyr/net/http/service.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief HTTP server API
+ * @defgroup http_server HTTP server API
+ * @ingroup networking
+ * @{
+ *
+ * All services are served by a single thread polling the listening sockets
+ * and the connections of a fixed pool of
+ * @kconfig{CONFIG_HTTP_SERVER_MAX_CLIENTS} clients. Connections are kept
+ * alive between requests when the client allows it, and closed after
+ * @kconfig{CONFIG_HTTP_SERVER_CLIENT_INACTIVITY_TIMEOUT} seconds without
+ * traffic.
+ *
+ * The @p _detail given to HTTP_RESOURCE_DEFINE() points to a
+ * @ref http_resource_detail_static or a @ref http_resource_detail_dynamic.
+ * Static resources are sent straight from their data, which may reside in
+ * flash, without being copied. Dynamic resources are produced by callbacks
+ * and sent with the chunked transfer encoding.
+ */
+
+/** Type of an HTTP resource */
+enum http_resource_type {
+	/** Content known at build time, see @ref http_resource_detail_static */
+	HTTP_RESOURCE_TYPE_STATIC,
+	/** Content produced by callbacks, see @ref http_resource_detail_dynamic */
+	HTTP_RESOURCE_TYPE_DYNAMIC,
+};
+
+/** Detail common to all resources */
+struct http_resource_detail {
+	/** Methods allowed, bitmask of BIT(HTTP_GET), BIT(HTTP_POST)... */
+	uint32_t bitmask_of_supported_http_methods;
+	/** Type of the resource */
+	enum http_resource_type type;
+	/** Value of the Content-Encoding header, e.g. "gzip", or NULL */
+	const char *content_encoding;
+	/** Value of the Content-Type header, or NULL */
+	const char *content_type;
+};
+
+/** Resource with a fixed content */
+struct http_resource_detail_static {
+	/** Common detail, type is HTTP_RESOURCE_TYPE_STATIC */
+	struct http_resource_detail common;
+	/** Content, must stay valid as long as the server runs */
+	const void *static_data;
+	/** Length of the content */
+	size_t static_data_len;
+};
+
+struct http_client_ctx;
+
+/**
+ * @brief Callback given the body of a request to a dynamic resource
+ *
+ * Called as the body is received, possibly in several parts, and a last
+ * time with @p final set once the request is complete.
+ *
+ * @param client Client sending the request
+ * @param data Part of the body
+ * @param len Length of @p data, may be 0
+ * @param final True once the request is complete
+ * @param user_data User data of the resource
+ *
+ * @return 0 on success, negative errno value to reply with an error
+ */
+typedef int (*http_resource_request_cb_t)(struct http_client_ctx *client,
+					  const uint8_t *data, size_t len,
+					  bool final, void *user_data);
+
+/**
+ * @brief Callback producing the body of the response of a dynamic resource
+ *
+ * Called repeatedly until it returns 0, each call producing the next part
+ * of the body.
+ *
+ * @param client Client the response is sent to
+ * @param buf Buffer to write the next part of the body to
+ * @param len Size of @p buf
+ * @param user_data User data of the resource
+ *
+ * @return Number of bytes written to @p buf, 0 at the end of the body, or
+ *         negative errno value to abort the connection
+ */
+typedef int (*http_resource_response_cb_t)(struct http_client_ctx *client,
+					   uint8_t *buf, size_t len,
+					   void *user_data);
+
+/** Resource produced by callbacks */
+struct http_resource_detail_dynamic {
+	/** Common detail, type is HTTP_RESOURCE_TYPE_DYNAMIC */
+	struct http_resource_detail common;
+	/** Callback given the body of the request, may be NULL */
+	http_resource_request_cb_t request_cb;
+	/** Callback producing the body of the response */
+	http_resource_response_cb_t response_cb;
+	/** User data given to the callbacks */
+	void *user_data;
+};
+
+/** @cond INTERNAL_HIDDEN */
+
+enum http_client_state {
+	HTTP_CLIENT_FREE,
+	HTTP_CLIENT_RECV,
+	HTTP_CLIENT_SEND,
+};
+
+/** @endcond */
+
+/**
+ * @brief Connection of a client
+ *
+ * Owned by the server, the fields may be read by the callbacks of the
+ * resources but must not be modified.
+ */
+struct http_client_ctx {
+	/** Socket of the connection */
+	int fd;
+	/** Parser of the requests, gives e.g. the method of the request */
+	struct http_parser parser;
+	/** Service the client connected to */
+	const struct http_service_desc *service;
+	/** Resource requested, NULL if not found */
+	const struct http_resource_desc *resource;
+	/** Path of the request, NUL terminated */
+	char url[CONFIG_HTTP_SERVER_MAX_URL_LENGTH];
+
+	/** @cond INTERNAL_HIDDEN */
+	enum http_client_state state;
+	int64_t last_activity;
+	size_t url_len;
+	uint16_t status;
+	bool url_overflow;
+	bool keep_alive;
+	bool chunked;
+	bool send_body;
+	bool body_done;
+
+	/* Received bytes not parsed yet, pipelined requests wait here */
+	uint8_t rx[CONFIG_HTTP_SERVER_CLIENT_BUFFER_SIZE];
+	size_t rx_off;
+	size_t rx_len;
+
+	/* Response headers, or the current chunk of a dynamic resource */
+	uint8_t tx[CONFIG_HTTP_SERVER_RESPONSE_BUFFER_SIZE];
+	size_t tx_off;
+	size_t tx_len;
+
+	/* Static data left to send */
+	const uint8_t *data;
+	size_t data_len;
+	/** @endcond */
+};
+
+/**
+ * @brief Start the HTTP server
+ *
+ * Opens a listening socket for each service and starts the server thread.
+ *
+ * @retval 0 If successful
+ * @retval -EALREADY The server is already running
+ * @retval -ENOMEM More than @kconfig{CONFIG_HTTP_SERVER_MAX_SERVICES}
+ *         services are defined
+ * @retval -errno Negative errno value if a socket could not be set up
+ */
+int http_server_start(void);
+
+/**
+ * @brief Stop the HTTP server
+ *
+ * Closes all connections and listening sockets, and waits for the server
+ * thread to exit. Must not be called from a resource callback.
+ *
+ * @retval 0 If successful
+ * @retval -EALREADY The server is not running
+ */
+int http_server_stop(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_NET_HTTP_SERVER_H_ */
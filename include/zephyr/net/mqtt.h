@@ -468,6 +468,29 @@ struct mqtt_internal {
 
 	/** Internal. Remaining payload length to read. */
 	uint32_t remaining_payload;
+
+#if defined(CONFIG_MQTT_PUBLISH_QUEUE)
+	/** Internal. Bytes used in the publish queue buffer. */
+	uint32_t pub_queue_used;
+
+	/** Internal. Queued packets waiting to be sent. */
+	uint32_t pub_queue_pending;
+
+	/** Internal. Queued QoS 1 and 2 messages waiting for their
+	 *  acknowledgment.
+	 */
+	uint32_t pub_queue_inflight;
+
+	/** Internal. Wall clock value (in milliseconds) of the next
+	 *  retransmission of the publish queue.
+	 */
+	uint32_t pub_queue_retry_time;
+
+	/** Internal. Unacknowledged packets are sent again on the next
+	 *  connection.
+	 */
+	bool pub_queue_resend;
+#endif
 };
 
 /**
@@ -524,6 +547,17 @@ struct mqtt_client {
 	/** Size of transmit buffer. */
 	uint32_t tx_buf_size;
 
+#if defined(CONFIG_MQTT_PUBLISH_QUEUE)
+	/** Buffer holding the messages queued by mqtt_publish_queued() until
+	 *  they are sent, or acknowledged for QoS 1 and 2. Shall be aligned
+	 *  on 4 bytes. NULL disables the queue.
+	 */
+	uint8_t *pub_queue_buf;
+
+	/** Size of the publish queue buffer. */
+	uint32_t pub_queue_buf_size;
+#endif
+
 	/** Keepalive interval for this client in seconds.
 	 *  Default is CONFIG_MQTT_KEEPALIVE.
 	 */
@@ -607,6 +641,33 @@ int mqtt_connect(struct mqtt_client *client);
 int mqtt_publish(struct mqtt_client *client,
 		 const struct mqtt_publish_param *param);
 
+/**
+ * @brief API to queue a message for publishing.
+ *
+ * The message, payload included, is copied to the publish queue buffer of
+ * the client and sent later from @ref mqtt_input or @ref mqtt_live, along
+ * with the other queued messages, so that this function never waits for
+ * the transport. At most @kconfig{CONFIG_MQTT_PUBLISH_QUEUE_INFLIGHT} QoS 1
+ * and 2 messages are sent without being acknowledged. They stay queued
+ * until acknowledged, the PUBREL packet of QoS 2 messages being sent by the
+ * library, and are sent again with the DUP flag set after
+ * @kconfig{CONFIG_MQTT_PUBLISH_QUEUE_RETRY_TIMEOUT} milliseconds or after
+ * reconnecting. The usual @ref MQTT_EVT_PUBACK, @ref MQTT_EVT_PUBREC and
+ * @ref MQTT_EVT_PUBCOMP events are still notified.
+ *
+ * @param[in] client Client instance for which the procedure is requested.
+ *                   Shall not be NULL.
+ * @param[in] param Parameters to be used for the publish message.
+ *                  Shall not be NULL.
+ *
+ * @retval 0 If the message was queued.
+ * @retval -ENOMEM If the queue is full.
+ * @retval -EBUSY If a queued message uses the same message id.
+ * @return Other negative error code (errno.h) indicating reason of failure.
+ */
+int mqtt_publish_queued(struct mqtt_client *client,
+			const struct mqtt_publish_param *param);
+
 /**
  * @brief API used by client to send acknowledgment on receiving QoS1 publish
  *        message. Should be called on reception of @ref MQTT_EVT_PUBLISH with
@@ -725,6 +786,7 @@ int mqtt_abort(struct mqtt_client *client);
 /**
  * @brief This API should be called periodically for the client to be able
  *        to keep the connection alive by sending Ping Requests if need be.
+ *        It also sends the messages of the publish queue that are due.
  *
  * @param[in] client Client instance for which the procedure is requested.
  *                   Shall not be NULL.
@@ -746,7 +808,9 @@ int mqtt_live(struct mqtt_client *client);
  *
  * @return Time in milliseconds until next keep alive message is expected to
  *         be sent. Function will return -1 if keep alive messages are
- *         not enabled.
+ *         not enabled. With @kconfig{CONFIG_MQTT_PUBLISH_QUEUE}, the time
+ *         left until queued messages are due to be sent is taken into
+ *         account.
  */
 int mqtt_keepalive_time_left(const struct mqtt_client *client);
 
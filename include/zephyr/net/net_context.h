@@ -1009,6 +1009,40 @@ int net_context_sendmsg(struct net_context *context,
 			k_timeout_t timeout,
 			void *user_data);
 
+/**
+ * @brief Send a chain of network buffers without copying the data.
+ *
+ * @details This function sends the data held in @p buf, which is typically
+ * a chain of buffers created with net_buf_alloc_with_data() that wrap
+ * application memory. Only native UDP and TCP contexts are supported. The
+ * stack takes its own reference to the chain and keeps it until the data
+ * has been transmitted, or for TCP until it has been acknowledged by the
+ * peer. The caller keeps its reference whatever the result and drops it
+ * with net_buf_unref() once it no longer needs the chain; the buffers are
+ * then returned to their pool, whose destroy callback can be used as the
+ * completion notification for the wrapped memory. The buffers must not be
+ * modified while the stack holds them.
+ *
+ * If @p dst_addr is NULL, the address set by net_context_connect() is used.
+ *
+ * @param context The network context to use.
+ * @param buf The buffer chain to send.
+ * @param dst_addr Destination address, or NULL for a connected context.
+ * @param addrlen Length of the address.
+ * @param cb Caller-supplied callback function.
+ * @param timeout Currently this value is not used.
+ * @param user_data Caller-supplied user data.
+ *
+ * @return numbers of bytes sent on success, a negative errno otherwise
+ */
+int net_context_send_buf(struct net_context *context,
+			 struct net_buf *buf,
+			 const struct sockaddr *dst_addr,
+			 socklen_t addrlen,
+			 net_context_send_cb_t cb,
+			 k_timeout_t timeout,
+			 void *user_data);
+
 /**
  * @brief Receive network data from a peer specified by context.
  *
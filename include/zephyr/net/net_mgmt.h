@@ -142,9 +142,10 @@ struct net_mgmt_event_callback {
 #endif
 
 	/** A mask of network events on which the above handler should be
-	 * called in case those events come. Such mask can be modified
-	 * whenever necessary by the owner, and thus will affect the handler
-	 * being called or not.
+	 * called in case those events come. The command part of such mask
+	 * can be modified whenever necessary by the owner, and thus will
+	 * affect the handler being called or not. The layer and layer code
+	 * must not change while the callback is registered.
 	 */
 	union {
 		/** A mask of network events on which the above handler should
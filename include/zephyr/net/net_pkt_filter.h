@@ -34,6 +34,7 @@ extern "C" {
 /** @cond INTERNAL_HIDDEN */
 
 struct npf_test;
+struct npf_rule_table;
 
 typedef bool (npf_test_fn_t)(struct npf_test *test, struct net_pkt *pkt);
 
@@ -61,6 +62,12 @@ extern struct npf_rule npf_default_drop;
 struct npf_rule_list {
 	sys_slist_t rule_head;
 	struct k_spinlock lock;
+#if defined(CONFIG_NET_PKT_FILTER_DECISION_TABLE) || defined(__DOXYGEN__)
+	/** decision table compiled from the rules, used by the packet path */
+	struct npf_rule_table *table;
+	/** table being compiled on the next rule list change */
+	struct npf_rule_table *spare;
+#endif
 };
 
 /** @brief  rule list applied to outgoing packets */
@@ -77,6 +84,9 @@ extern struct npf_rule_list npf_ipv6_recv_rules;
 /**
  * @brief Insert a rule at the front of given rule list
  *
+ * With @kconfig{CONFIG_NET_PKT_FILTER_DECISION_TABLE}, this takes a mutex
+ * and must not be called from an ISR or with the scheduler locked.
+ *
  * @param rules the affected rule list
  * @param rule the rule to be inserted
  */
@@ -85,6 +95,9 @@ void npf_insert_rule(struct npf_rule_list *rules, struct npf_rule *rule);
 /**
  * @brief Append a rule at the end of given rule list
  *
+ * With @kconfig{CONFIG_NET_PKT_FILTER_DECISION_TABLE}, this takes a mutex
+ * and must not be called from an ISR or with the scheduler locked.
+ *
  * @param rules the affected rule list
  * @param rule the rule to be appended
  */
@@ -93,6 +106,9 @@ void npf_append_rule(struct npf_rule_list *rules, struct npf_rule *rule);
 /**
  * @brief Remove a rule from the given rule list
  *
+ * With @kconfig{CONFIG_NET_PKT_FILTER_DECISION_TABLE}, this takes a mutex
+ * and must not be called from an ISR or with the scheduler locked.
+ *
  * @param rules the affected rule list
  * @param rule the rule to be removed
  * @retval true if given rule was found in the rule list and removed
@@ -102,11 +118,27 @@ bool npf_remove_rule(struct npf_rule_list *rules, struct npf_rule *rule);
 /**
  * @brief Remove all rules from the given rule list
  *
+ * With @kconfig{CONFIG_NET_PKT_FILTER_DECISION_TABLE}, this takes a mutex
+ * and must not be called from an ISR or with the scheduler locked.
+ *
  * @param rules the affected rule list
  * @retval true if at least one rule was removed from the rule list
  */
 bool npf_remove_all_rules(struct npf_rule_list *rules);
 
+/**
+ * @brief Take changes to the conditions of the rules into account
+ *
+ * Rule lists may be compiled into decision tables when rules are added
+ * or removed, see @kconfig{CONFIG_NET_PKT_FILTER_DECISION_TABLE}. This
+ * must then be called after changing the data of a condition used by a
+ * rule of the list, e.g. an address in a match set. It takes a mutex
+ * then, and must not be called from an ISR or with the scheduler locked.
+ *
+ * @param rules the affected rule list
+ */
+void npf_update_rules(struct npf_rule_list *rules);
+
 /* convenience shortcuts */
 #define npf_insert_send_rule(rule) npf_insert_rule(&npf_send_rules, rule)
 #define npf_insert_recv_rule(rule) npf_insert_rule(&npf_recv_rules, rule)
@@ -191,6 +191,37 @@ struct net_stats_ipv6_nd {
 	net_stats_t sent;
 };
 
+/**
+ * @brief IPv6 route lookup statistics
+ */
+struct net_stats_ipv6_route {
+	/** Number of route lookups */
+	net_stats_t lookup;
+
+	/** Number of route lookups answered by the destination cache */
+	net_stats_t cache_hit;
+
+	/** Number of route lookups that did not find a route */
+	net_stats_t not_found;
+};
+
+/**
+ * @brief IP fragment reassembly statistics
+ */
+struct net_stats_ip_reassembly {
+	/** Number of received fragments */
+	net_stats_t fragments;
+
+	/** Number of packets reassembled from fragments */
+	net_stats_t reassembled;
+
+	/** Number of reassemblies that timed out */
+	net_stats_t timeout;
+
+	/** Number of reassemblies dropped because of errors or lack of room */
+	net_stats_t drop;
+};
+
 /**
  * @brief IPv6 multicast listener daemon statistics
  */
@@ -332,6 +363,21 @@ struct net_stats {
 	struct net_stats_ipv6_nd ipv6_nd;
 #endif
 
+#if defined(CONFIG_NET_STATISTICS_IPV6_ROUTE)
+	/** IPv6 route lookup statistics */
+	struct net_stats_ipv6_route ipv6_route;
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IPV4_REASSEMBLY)
+	/** IPv4 fragment reassembly statistics */
+	struct net_stats_ip_reassembly ipv4_reassembly;
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IPV6_REASSEMBLY)
+	/** IPv6 fragment reassembly statistics */
+	struct net_stats_ip_reassembly ipv6_reassembly;
+#endif
+
 #if defined(CONFIG_NET_STATISTICS_MLD)
 	/** IPv6 MLD statistics */
 	struct net_stats_ipv6_mld ipv6_mld;
@@ -519,6 +565,9 @@ enum net_request_stats_cmd {
 	NET_REQUEST_STATS_CMD_GET_PPP,
 	NET_REQUEST_STATS_CMD_GET_PM,
 	NET_REQUEST_STATS_CMD_GET_WIFI,
+	NET_REQUEST_STATS_CMD_GET_IPV6_ROUTE,
+	NET_REQUEST_STATS_CMD_GET_IPV4_REASSEMBLY,
+	NET_REQUEST_STATS_CMD_GET_IPV6_REASSEMBLY,
 };
 
 #define NET_REQUEST_STATS_GET_ALL				\
@@ -562,6 +611,27 @@ NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_STATS_GET_IPV6);
 NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_STATS_GET_IPV6_ND);
 #endif /* CONFIG_NET_STATISTICS_IPV6_ND */
 
+#if defined(CONFIG_NET_STATISTICS_IPV6_ROUTE)
+#define NET_REQUEST_STATS_GET_IPV6_ROUTE			\
+	(_NET_STATS_BASE | NET_REQUEST_STATS_CMD_GET_IPV6_ROUTE)
+
+NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_STATS_GET_IPV6_ROUTE);
+#endif /* CONFIG_NET_STATISTICS_IPV6_ROUTE */
+
+#if defined(CONFIG_NET_STATISTICS_IPV4_REASSEMBLY)
+#define NET_REQUEST_STATS_GET_IPV4_REASSEMBLY			\
+	(_NET_STATS_BASE | NET_REQUEST_STATS_CMD_GET_IPV4_REASSEMBLY)
+
+NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_STATS_GET_IPV4_REASSEMBLY);
+#endif /* CONFIG_NET_STATISTICS_IPV4_REASSEMBLY */
+
+#if defined(CONFIG_NET_STATISTICS_IPV6_REASSEMBLY)
+#define NET_REQUEST_STATS_GET_IPV6_REASSEMBLY			\
+	(_NET_STATS_BASE | NET_REQUEST_STATS_CMD_GET_IPV6_REASSEMBLY)
+
+NET_MGMT_DEFINE_REQUEST_HANDLER(NET_REQUEST_STATS_GET_IPV6_REASSEMBLY);
+#endif /* CONFIG_NET_STATISTICS_IPV6_REASSEMBLY */
+
 #if defined(CONFIG_NET_STATISTICS_ICMP)
 #define NET_REQUEST_STATS_GET_ICMP				\
 	(_NET_STATS_BASE | NET_REQUEST_STATS_CMD_GET_ICMP)
@@ -27,6 +27,7 @@
 #include <zephyr/net/net_ip.h>
 #include <zephyr/net/dns_resolve.h>
 #include <zephyr/net/socket_select.h>
+#include <zephyr/net/socket_epoll.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/sys/fdtable.h>
 #include <stdlib.h>
@@ -65,6 +66,8 @@ struct zsock_pollfd {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_recvmmsg: Do not block once the first message has been received */
+#define ZSOCK_MSG_WAITFORONE 0x10000
 
 /* Well-known values, e.g. from Linux man 2 shutdown:
  * "The constants SHUT_RD, SHUT_WR, SHUT_RDWR have the value 0, 1, 2,
@@ -160,6 +163,10 @@ struct zsock_pollfd {
 /** Socket option to control TLS session caching on a socket. Accepted values:
  *  - 0 - Disabled.
  *  - 1 - Enabled.
+ *  Clients resume cached sessions using session IDs, or RFC 5077 session
+ *  tickets if MBEDTLS_SSL_SESSION_TICKETS is enabled. Servers keep a
+ *  session cache if MBEDTLS_SSL_CACHE_C is enabled, and issue session
+ *  tickets if MBEDTLS_SSL_TICKET_C is enabled.
  */
 #define TLS_SESSION_CACHE 12
 /** Write-only socket option to purge session cache immediately.
@@ -200,8 +207,26 @@ struct zsock_pollfd {
  *  connection ID, otherwise will contain the length of the CID value.
  */
 #define TLS_DTLS_PEER_CID_VALUE 17
+/** Read-only socket option to get TLS/DTLS client handshake statistics.
+ *  The option accepts a pointer to a struct tls_handshake_stats. The
+ *  counters are not specific to the socket, they cover all the TLS/DTLS
+ *  client handshakes done since boot.
+ */
+#define TLS_HANDSHAKE_STATS 18
 /** @} */
 
+/** TLS/DTLS client handshake statistics, see TLS_HANDSHAKE_STATS. */
+struct tls_handshake_stats {
+	/** Number of full handshakes */
+	uint32_t full;
+	/** Total time spent in full handshakes, in milliseconds */
+	uint32_t full_time;
+	/** Number of handshakes resuming a cached session */
+	uint32_t resumed;
+	/** Total time spent in resumed handshakes, in milliseconds */
+	uint32_t resumed_time;
+};
+
 /* Valid values for TLS_PEER_VERIFY option */
 #define TLS_PEER_VERIFY_NONE 0     /**< Peer verification disabled. */
 #define TLS_PEER_VERIFY_OPTIONAL 1 /**< Peer verification optional. */
@@ -450,6 +475,72 @@ static inline ssize_t zsock_send(int sock, const void *buf, size_t len,
 __syscall ssize_t zsock_sendmsg(int sock, const struct msghdr *msg,
 				int flags);
 
+/** Message header for zsock_sendmmsg() and zsock_recvmmsg() */
+struct zsock_mmsghdr {
+	/** Message to send or buffers to receive into */
+	struct msghdr msg_hdr;
+	/** Number of bytes sent or received for this message */
+	unsigned int msg_len;
+};
+
+/**
+ * @brief Send multiple messages with a single call
+ *
+ * @details
+ * Send up to @p vlen messages, each one as with zsock_sendmsg(), taking the
+ * socket lock and crossing the system call boundary only once. The number
+ * of bytes sent is stored in the @c msg_len field of each message. At most
+ * :kconfig:option:`CONFIG_NET_SOCKETS_MMSG_MAX` messages are handled per
+ * call. An error that occurs after the first message has been sent is not
+ * reported, it will usually be returned by the next call.
+ * This function is also exposed as ``sendmmsg()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ *
+ * @param sock Socket descriptor.
+ * @param msgvec Array of messages.
+ * @param vlen Number of entries in @p msgvec.
+ * @param flags Send flags, applied to every message.
+ *
+ * @return Number of messages sent, -1 with errno set if none could be sent.
+ */
+__syscall int zsock_sendmmsg(int sock, struct zsock_mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
+struct net_buf;
+
+/**
+ * @brief Send a chain of network buffers without copying the data
+ *
+ * @details
+ * Send the data held in @p buf on a native UDP or TCP socket. The buffers
+ * typically wrap application memory, see net_buf_alloc_with_data(). The
+ * stack takes its own reference to the chain and holds it until the data
+ * has been transmitted, or for TCP until the peer has acknowledged it. The
+ * caller keeps its reference whatever the result and releases it with
+ * net_buf_unref() when done; the destroy callback of the buffer pool then
+ * signals that the wrapped memory is free again. The buffers must not be
+ * modified while the stack holds them.
+ *
+ * Blocking, timeout and @c ZSOCK_MSG_DONTWAIT handling are the same as for
+ * zsock_sendto(). A datagram must fit the interface MTU unless IP
+ * fragmentation is enabled, otherwise @c EMSGSIZE is returned.
+ *
+ * The buffers live in kernel memory, so this function is only available to
+ * supervisor threads and is not a system call.
+ * Available if :kconfig:option:`CONFIG_NET_SOCKETS_SEND_BUF` is enabled.
+ *
+ * @param sock Socket descriptor.
+ * @param buf Buffer chain to send.
+ * @param flags Send flags.
+ * @param dest_addr Destination address, or NULL for a connected socket.
+ * @param addrlen Length of @p dest_addr.
+ *
+ * @return Number of bytes queued on success, -1 with errno set on failure
+ *         (@c EOPNOTSUPP for sockets that cannot send buffers).
+ */
+ssize_t zsock_send_buf(int sock, struct net_buf *buf, int flags,
+		       const struct sockaddr *dest_addr, socklen_t addrlen);
+
 /**
  * @brief Receive data from an arbitrary network address
  *
@@ -484,6 +575,75 @@ static inline ssize_t zsock_recv(int sock, void *buf, size_t max_len,
 	return zsock_recvfrom(sock, buf, max_len, flags, NULL, NULL);
 }
 
+/**
+ * @brief Receive multiple messages with a single call
+ *
+ * @details
+ * Receive up to @p vlen messages. For datagram sockets each message holds
+ * one datagram, scattered over its @c msg_iov buffers, with the source
+ * address stored in @c msg_name when set and @c ZSOCK_MSG_TRUNC reported in
+ * @c msg_flags if the datagram did not fit. Other socket types only accept
+ * a single buffer per message. Ancillary data is not returned.
+ * The call blocks for the first message as zsock_recvfrom() does, there is
+ * no timeout argument, use @c SO_RCVTIMEO instead. With
+ * @c ZSOCK_MSG_WAITFORONE the remaining messages are only collected if they
+ * are already queued. At most
+ * :kconfig:option:`CONFIG_NET_SOCKETS_MMSG_MAX` messages are handled per
+ * call.
+ * This function is also exposed as ``recvmmsg()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ *
+ * @param sock Socket descriptor.
+ * @param msgvec Array of messages.
+ * @param vlen Number of entries in @p msgvec.
+ * @param flags Receive flags.
+ *
+ * @return Number of messages received, -1 with errno set if none was
+ *         received.
+ */
+__syscall int zsock_recvmmsg(int sock, struct zsock_mmsghdr *msgvec,
+			     unsigned int vlen, int flags);
+
+struct net_pkt;
+
+/**
+ * @brief Receive a datagram without copying its payload
+ *
+ * @details
+ * Dequeue the next datagram of a native @c SOCK_DGRAM socket and hand over
+ * the underlying network packet instead of copying its data. On success the
+ * packet cursor is positioned at the start of the payload, so it can be
+ * parsed in place with the net_pkt access API, and the caller owns the
+ * reference: it must be returned with zsock_release_pkt() once the payload
+ * is no longer needed. Holding packets starves the RX buffer pool, so they
+ * should be released promptly.
+ *
+ * Blocking, timeout and @c ZSOCK_MSG_DONTWAIT handling are the same as for
+ * zsock_recvfrom(). @c ZSOCK_MSG_PEEK is not supported.
+ *
+ * The packet lives in kernel memory, so this function is only available to
+ * supervisor threads and is not a system call.
+ * Available if :kconfig:option:`CONFIG_NET_SOCKETS_RECV_PKT` is enabled.
+ *
+ * @param sock Socket descriptor.
+ * @param pkt Set to the received packet on success, NULL otherwise.
+ * @param flags Receive flags.
+ * @param src_addr Optional buffer for the source address.
+ * @param addrlen Length of @p src_addr, updated to the actual address length.
+ *
+ * @return Payload length on success, -1 with errno set on failure
+ *         (@c EOPNOTSUPP for sockets that cannot loan packets).
+ */
+ssize_t zsock_recv_pkt(int sock, struct net_pkt **pkt, int flags,
+		       struct sockaddr *src_addr, socklen_t *addrlen);
+
+/**
+ * @brief Release a packet obtained with zsock_recv_pkt()
+ *
+ * @param pkt Packet to release, may be NULL.
+ */
+void zsock_release_pkt(struct net_pkt *pkt);
+
 /**
  * @brief Control blocking/non-blocking mode of a socket
  *
@@ -855,6 +1015,23 @@ static inline ssize_t sendmsg(int sock, const struct msghdr *message,
 	return zsock_sendmsg(sock, message, flags);
 }
 
+/** POSIX wrapper for @ref zsock_mmsghdr */
+#define mmsghdr zsock_mmsghdr
+
+/** POSIX wrapper for @ref zsock_sendmmsg */
+static inline int sendmmsg(int sock, struct mmsghdr *msgvec,
+			   unsigned int vlen, int flags)
+{
+	return zsock_sendmmsg(sock, msgvec, vlen, flags);
+}
+
+/** POSIX wrapper for @ref zsock_recvmmsg */
+static inline int recvmmsg(int sock, struct mmsghdr *msgvec,
+			   unsigned int vlen, int flags)
+{
+	return zsock_recvmmsg(sock, msgvec, vlen, flags);
+}
+
 /** POSIX wrapper for @ref zsock_recvfrom */
 static inline ssize_t recvfrom(int sock, void *buf, size_t max_len, int flags,
 			       struct sockaddr *src_addr, socklen_t *addrlen)
@@ -965,6 +1142,8 @@ static inline char *inet_ntop(sa_family_t family, const void *src, char *dst,
 #define MSG_DONTWAIT ZSOCK_MSG_DONTWAIT
 /** POSIX wrapper for @ref ZSOCK_MSG_WAITALL */
 #define MSG_WAITALL ZSOCK_MSG_WAITALL
+/** POSIX wrapper for @ref ZSOCK_MSG_WAITFORONE */
+#define MSG_WAITFORONE ZSOCK_MSG_WAITFORONE
 
 /** POSIX wrapper for @ref ZSOCK_SHUT_RD */
 #define SHUT_RD ZSOCK_SHUT_RD
@@ -1070,6 +1249,8 @@ struct ifreq {
 /* Socket options for IPPROTO_TCP level */
 /** sockopt: Disable TCP buffering (ignored, for compatibility) */
 #define TCP_NODELAY 1
+/** sockopt: Name of the congestion control algorithm of the connection */
+#define TCP_CONGESTION 13
 
 /* Socket options for IPPROTO_IP level */
 /** sockopt: Set or receive the Type-Of-Service value for an outgoing packet. */
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_
+#define ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_
+
+/**
+ * @brief BSD Sockets compatible API
+ * @defgroup bsd_sockets BSD Sockets compatible API
+ * @ingroup networking
+ * @{
+ */
+
+#include <zephyr/toolchain.h>
+#include <zephyr/net/socket_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** zsock_epoll_ctl: Add a descriptor to the interest list */
+#define ZSOCK_EPOLL_CTL_ADD 1
+/** zsock_epoll_ctl: Remove a descriptor from the interest list */
+#define ZSOCK_EPOLL_CTL_DEL 2
+/** zsock_epoll_ctl: Change the events or user data of a descriptor */
+#define ZSOCK_EPOLL_CTL_MOD 3
+
+/** zsock_epoll_event: Data available for reading */
+#define ZSOCK_EPOLLIN 0x001
+/** zsock_epoll_event: Priority data available for reading */
+#define ZSOCK_EPOLLPRI 0x002
+/** zsock_epoll_event: Writing will not block */
+#define ZSOCK_EPOLLOUT 0x004
+/** zsock_epoll_event: Error condition (output value only, always monitored) */
+#define ZSOCK_EPOLLERR 0x008
+/** zsock_epoll_event: Hang up (output value only, always monitored) */
+#define ZSOCK_EPOLLHUP 0x010
+/** zsock_epoll_event: Disable the descriptor after one event, until it is
+ *  re-enabled with @c ZSOCK_EPOLL_CTL_MOD
+ */
+#define ZSOCK_EPOLLONESHOT (1U << 30)
+
+/** User data returned along with the events of a descriptor */
+typedef union zsock_epoll_data {
+	void *ptr;
+	int fd;
+	uint32_t u32;
+	uint64_t u64;
+} zsock_epoll_data_t;
+
+/** Events of interest, or events reported, for a descriptor */
+struct zsock_epoll_event {
+	/** Bitmask of ZSOCK_EPOLL* events */
+	uint32_t events;
+	/** User data */
+	zsock_epoll_data_t data;
+};
+
+/**
+ * @brief Create an epoll instance
+ *
+ * @details
+ * Create an instance holding a persistent list of descriptors of interest.
+ * Readiness of these descriptors is signalled to the instance as it
+ * happens, so zsock_epoll_wait() only deals with descriptors that are
+ * ready, instead of scanning all of them as zsock_poll() does. Sockets of
+ * any type supported by zsock_poll(), including TLS sockets and socket
+ * pairs, and eventfd descriptors can be monitored.
+ * The instance is released with zsock_close().
+ * This function is also exposed as ``epoll_create()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ *
+ * @param size Ignored, but must be greater than zero.
+ *
+ * @return File descriptor of the instance, -1 with errno set on failure.
+ */
+__syscall int zsock_epoll_create(int size);
+
+/**
+ * @brief Add, modify or remove a descriptor of an epoll instance
+ *
+ * @details
+ * Only level-triggered operation is supported. Descriptors are removed
+ * from all instances when they are closed. Offloaded sockets cannot be
+ * monitored, they are rejected with @c EPERM.
+ * This function is also exposed as ``epoll_ctl()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ *
+ * @param epfd Epoll instance.
+ * @param op One of @c ZSOCK_EPOLL_CTL_ADD, @c ZSOCK_EPOLL_CTL_MOD or
+ *        @c ZSOCK_EPOLL_CTL_DEL.
+ * @param fd Descriptor to operate on.
+ * @param event Events of interest and user data, ignored for
+ *        @c ZSOCK_EPOLL_CTL_DEL.
+ *
+ * @return 0 on success, -1 with errno set on failure.
+ */
+__syscall int zsock_epoll_ctl(int epfd, int op, int fd,
+			      struct zsock_epoll_event *event);
+
+/**
+ * @brief Wait for events on the descriptors of an epoll instance
+ *
+ * @details
+ * This function is also exposed as ``epoll_wait()``
+ * if :kconfig:option:`CONFIG_NET_SOCKETS_POSIX_NAMES` is defined.
+ *
+ * @param epfd Epoll instance.
+ * @param events Array receiving the events of the ready descriptors.
+ * @param maxevents Number of entries in @p events, must be greater than zero.
+ * @param timeout Timeout in milliseconds, negative to wait forever.
+ *
+ * @return Number of ready descriptors stored in @p events, 0 on timeout,
+ *         -1 with errno set on failure.
+ */
+__syscall int zsock_epoll_wait(int epfd, struct zsock_epoll_event *events,
+			       int maxevents, int timeout);
+
+#ifdef CONFIG_NET_SOCKETS_POSIX_NAMES
+
+#define epoll_data zsock_epoll_data
+#define epoll_data_t zsock_epoll_data_t
+#define epoll_event zsock_epoll_event
+
+#define EPOLL_CTL_ADD ZSOCK_EPOLL_CTL_ADD
+#define EPOLL_CTL_DEL ZSOCK_EPOLL_CTL_DEL
+#define EPOLL_CTL_MOD ZSOCK_EPOLL_CTL_MOD
+
+#define EPOLLIN ZSOCK_EPOLLIN
+#define EPOLLPRI ZSOCK_EPOLLPRI
+#define EPOLLOUT ZSOCK_EPOLLOUT
+#define EPOLLERR ZSOCK_EPOLLERR
+#define EPOLLHUP ZSOCK_EPOLLHUP
+#define EPOLLONESHOT ZSOCK_EPOLLONESHOT
+
+static inline int epoll_create(int size)
+{
+	return zsock_epoll_create(size);
+}
+
+static inline int epoll_ctl(int epfd, int op, int fd,
+			    struct zsock_epoll_event *event)
+{
+	return zsock_epoll_ctl(epfd, op, fd, event);
+}
+
+static inline int epoll_wait(int epfd, struct zsock_epoll_event *events,
+			     int maxevents, int timeout)
+{
+	return zsock_epoll_wait(epfd, events, maxevents, timeout);
+}
+
+#endif /* CONFIG_NET_SOCKETS_POSIX_NAMES */
+
+#include <syscalls/socket_epoll.h>
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* ZEPHYR_INCLUDE_NET_SOCKET_EPOLL_H_ */
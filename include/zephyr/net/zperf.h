@@ -38,6 +38,7 @@ struct zperf_upload_params {
 		uint8_t tos;
 		int tcp_nodelay;
 		int priority;
+		bool zerocopy;
 	} options;
 };
 
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Code region instrumentation
+ */
+
+#ifndef ZEPHYR_INCLUDE_PROFILING_REGION_H_
+#define ZEPHYR_INCLUDE_PROFILING_REGION_H_
+
+#include <zephyr/types.h>
+
+#ifdef CONFIG_PROFILING_REGIONS
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/timing/timing.h>
+#ifdef CONFIG_PROFILING_REGION_STATS
+#include <zephyr/stats/stats.h>
+#endif
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Region instrumentation
+ * @defgroup profiling_region Region instrumentation
+ * @ingroup os_services
+ *
+ * Measures the cycles spent between PROFILING_REGION_START() and
+ * PROFILING_REGION_END() of a named region, using the timing functions.
+ * All macros compile to nothing without CONFIG_PROFILING_REGIONS.
+ *
+ * @{
+ */
+
+#if defined(CONFIG_PROFILING_REGIONS) || defined(__DOXYGEN__)
+
+/** @brief Execution statistics of a region, in cycles */
+struct profiling_region_data {
+	/** Sum of all measurements */
+	uint64_t total;
+	/** Number of measurements */
+	uint32_t count;
+	/** Shortest measurement */
+	uint32_t min;
+	/** Longest measurement */
+	uint32_t max;
+	/**
+	 * Bucket 0 counts measurements of 0 cycles, bucket n measurements
+	 * of 2^(n-1) to 2^n - 1 cycles. The last bucket also counts all
+	 * longer ones.
+	 */
+	uint32_t histogram[CONFIG_PROFILING_REGION_HISTOGRAM_BUCKETS];
+};
+
+/** @cond INTERNAL_HIDDEN */
+#ifdef CONFIG_PROFILING_REGION_STATS
+STATS_SECT_START(profiling_region)
+STATS_SECT_ENTRY32(count)
+STATS_SECT_ENTRY32(min)
+STATS_SECT_ENTRY32(max)
+STATS_SECT_ENTRY32(avg)
+STATS_SECT_END;
+#endif
+/** @endcond */
+
+/** @brief Instrumented region */
+struct profiling_region {
+	/** Name of the region */
+	const char *name;
+	/** @cond INTERNAL_HIDDEN */
+	struct profiling_region_data cpu[CONFIG_MP_MAX_NUM_CPUS];
+#ifdef CONFIG_PROFILING_REGION_STATS
+	STATS_SECT_DECL(profiling_region) stats;
+#endif
+	/** @endcond */
+};
+
+/**
+ * @brief Define a region.
+ *
+ * @param _name Name of the region, must be a valid C identifier.
+ */
+#define PROFILING_REGION_DEFINE(_name)                                         \
+	STRUCT_SECTION_ITERABLE(profiling_region, _profiling_region_##_name) = { \
+		.name = #_name,                                                \
+	}
+
+/**
+ * @brief Declare a region defined in another file.
+ *
+ * @param _name Name of the region.
+ */
+#define PROFILING_REGION_DECLARE(_name)                                        \
+	extern struct profiling_region _profiling_region_##_name
+
+/**
+ * @brief Mark the start of a region.
+ *
+ * Must be followed by PROFILING_REGION_END() in the same scope.
+ *
+ * @param _name Name of the region.
+ */
+#define PROFILING_REGION_START(_name)                                          \
+	timing_t _profiling_region_start_##_name = timing_counter_get()
+
+/**
+ * @brief Mark the end of a region and record its execution time.
+ *
+ * @param _name Name of the region.
+ */
+#define PROFILING_REGION_END(_name)                                            \
+	z_profiling_region_end(&_profiling_region_##_name,                     \
+			       &_profiling_region_start_##_name)
+
+/**
+ * @brief Record an execution of a region.
+ *
+ * The measurement is accounted to the calling CPU.
+ *
+ * @param region Region.
+ * @param cycles Execution time in cycles.
+ */
+void profiling_region_record(struct profiling_region *region, uint64_t cycles);
+
+/**
+ * @brief Get the statistics of a region.
+ *
+ * @param region Region.
+ * @param cpu CPU to get the statistics of, or -1 for all CPUs.
+ * @param data Statistics.
+ */
+void profiling_region_get(const struct profiling_region *region, int cpu,
+			  struct profiling_region_data *data);
+
+/**
+ * @brief Clear the statistics of a region.
+ *
+ * @param region Region.
+ */
+void profiling_region_reset(struct profiling_region *region);
+
+/** @cond INTERNAL_HIDDEN */
+static inline void z_profiling_region_end(struct profiling_region *region,
+					  timing_t *start)
+{
+	timing_t end = timing_counter_get();
+
+	profiling_region_record(region, timing_cycles_get(start, &end));
+}
+/** @endcond */
+
+#else
+
+#define PROFILING_REGION_DEFINE(_name)                                         \
+	extern int _profiling_region_unused_##_name
+#define PROFILING_REGION_DECLARE(_name)                                        \
+	extern int _profiling_region_unused_##_name
+#define PROFILING_REGION_START(_name)
+#define PROFILING_REGION_END(_name)
+
+#endif /* CONFIG_PROFILING_REGIONS */
+
+/**
+ * @brief Probes in kernel and driver hot paths
+ *
+ * Regions placed in code outside of the application, only measured with
+ * CONFIG_PROFILING_REGION_PROBES.
+ *
+ * @{
+ */
+#if defined(CONFIG_PROFILING_REGION_PROBES) || defined(__DOXYGEN__)
+/** @brief Define a probe, see PROFILING_REGION_DEFINE(). */
+#define PROFILING_PROBE_DEFINE(_name) PROFILING_REGION_DEFINE(_name)
+/** @brief Declare a probe, see PROFILING_REGION_DECLARE(). */
+#define PROFILING_PROBE_DECLARE(_name) PROFILING_REGION_DECLARE(_name)
+/** @brief Mark the start of a probe, see PROFILING_REGION_START(). */
+#define PROFILING_PROBE_START(_name) PROFILING_REGION_START(_name)
+/** @brief Mark the end of a probe, see PROFILING_REGION_END(). */
+#define PROFILING_PROBE_END(_name) PROFILING_REGION_END(_name)
+#else
+#define PROFILING_PROBE_DEFINE(_name)                                          \
+	extern int _profiling_region_unused_##_name
+#define PROFILING_PROBE_DECLARE(_name)                                         \
+	extern int _profiling_region_unused_##_name
+#define PROFILING_PROBE_START(_name)
+#define PROFILING_PROBE_END(_name)
+#endif
+/** @} */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_PROFILING_REGION_H_ */
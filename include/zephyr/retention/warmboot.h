@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Public API for warm boot interface
+ */
+
+#ifndef ZEPHYR_INCLUDE_RETENTION_WARMBOOT_
+#define ZEPHYR_INCLUDE_RETENTION_WARMBOOT_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/iterable_sections.h>
+#include <zephyr/types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Warm boot interface
+ * @defgroup warm_boot_interface Warm boot interface
+ * @ingroup retention_api
+ * @{
+ */
+
+/**
+ * @brief State of a module kept across warm boots.
+ *
+ * These are registered using WARMBOOT_STATE_DEFINE().
+ */
+struct warmboot_state {
+	/** Identifier of the state, unique in the application. */
+	uint16_t id;
+	/** Version of the layout of the data, a snapshot of another version is not restored. */
+	uint16_t version;
+	/** Size of the data. */
+	uint16_t size;
+	/** Data of the state. */
+	void *data;
+};
+
+/**
+ * @brief Define a state kept across warm boots.
+ *
+ * @param _name	Name of the state.
+ * @param _id	Identifier of the state, unique in the application.
+ * @param _version Version of the layout of the data.
+ * @param _data	Pointer to the data of the state.
+ * @param _size	Size of the data.
+ */
+#define WARMBOOT_STATE_DEFINE(_name, _id, _version, _data, _size)		\
+	const STRUCT_SECTION_ITERABLE(warmboot_state, warmboot_state_##_name) = {	\
+		.id = _id,							\
+		.version = _version,						\
+		.size = _size,							\
+		.data = _data,							\
+	}
+
+/**
+ * @brief		Saves a snapshot of all the states to the warm boot area.
+ *
+ * Should be called once the states are initialized and whenever they change,
+ * the snapshot is what a following warm boot restores.
+ *
+ * @retval 0		If successful.
+ * @retval -ENOSPC	If the states do not fit in the warm boot area.
+ * @retval -errno	Error code code.
+ */
+int warmboot_save(void);
+
+/**
+ * @brief		Restores a state from the snapshot in the warm boot area.
+ *
+ * The data of the state is only changed if a snapshot of the state, with the
+ * same version and size, is found.
+ *
+ * @param state		State to restore.
+ *
+ * @retval 1		If the state was restored.
+ * @retval 0		If there is no valid snapshot of the state (cold boot).
+ * @retval -ENOTSUP	If the warm boot area has neither prefix nor checksum.
+ * @retval -errno	Error code code.
+ */
+int warmboot_restore(const struct warmboot_state *state);
+
+/**
+ * @brief		Clears the snapshot in the warm boot area, the following
+ *			boot is a cold boot.
+ *
+ * @retval 0		If successful.
+ * @retval -errno	Error code code.
+ */
+int warmboot_clear(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_RETENTION_WARMBOOT_ */
@@ -276,6 +276,9 @@ struct rtio_sqe {
 			uint8_t *rx_buf;
 		};
 
+		/** OP_DELAY, relative or absolute (K_TIMEOUT_ABS_*) timeout */
+		k_timeout_t delay;
+
 	};
 };
 
@@ -338,6 +341,16 @@ struct rtio {
 	struct k_sem *consume_sem;
 #endif
 
+#ifdef CONFIG_RTIO_CONSUME_BATCH
+	/* A wait semaphore given once the completion count reaches
+	 * batch_target, to wake a batch consumer once per batch
+	 */
+	struct k_sem *batch_sem;
+
+	/* Completion count a batch consumer waits for, 0 if none */
+	atomic_t batch_target;
+#endif
+
 	/* Total number of completions */
 	atomic_t cq_count;
 
@@ -421,6 +434,9 @@ struct rtio_iodev_sqe {
 	struct rtio_mpsc_node q;
 	struct rtio_iodev_sqe *next;
 	struct rtio *r;
+#ifdef CONFIG_RTIO_OP_DELAY
+	struct _timeout delay_to;
+#endif
 };
 
 /**
@@ -470,6 +486,9 @@ struct rtio_iodev {
 /** An operation that transceives (reads and writes simultaneously) */
 #define RTIO_OP_TXRX (RTIO_OP_CALLBACK+1)
 
+/** An operation that completes once a timeout expires */
+#define RTIO_OP_DELAY (RTIO_OP_TXRX+1)
+
 
 /**
  * @brief Prepare a nop (no op) submission
@@ -614,6 +633,30 @@ static inline void rtio_sqe_prep_transceive(struct rtio_sqe *sqe,
 	sqe->userdata = userdata;
 }
 
+/**
+ * @brief Prepare a delay op submission
+ *
+ * The submission is handled by the executor and completes from the kernel
+ * timeout queue once the timeout expires, without any thread. Chained to
+ * the submissions that follow it, it schedules them at a given time when
+ * an absolute timeout (K_TIMEOUT_ABS_*) is used, or after a given delay
+ * such as the conversion time of a sensor between a trigger and a read.
+ *
+ * Requires CONFIG_RTIO_OP_DELAY, the submission fails with -EINVAL
+ * otherwise.
+ */
+static inline void rtio_sqe_prep_delay(struct rtio_sqe *sqe,
+				       k_timeout_t timeout,
+				       void *userdata)
+{
+	memset(sqe, 0, sizeof(struct rtio_sqe));
+	sqe->op = RTIO_OP_DELAY;
+	sqe->prio = 0;
+	sqe->iodev = NULL;
+	sqe->delay = timeout;
+	sqe->userdata = userdata;
+}
+
 static inline struct rtio_iodev_sqe *rtio_sqe_pool_alloc(struct rtio_sqe_pool *pool)
 {
 	struct rtio_mpsc_node *node = rtio_mpsc_pop(&pool->free_q);
@@ -768,10 +811,14 @@ static inline void rtio_block_pool_free(struct rtio *r, void *buf, uint32_t buf_
 		   (static K_SEM_DEFINE(_submit_sem_##name, 0, K_SEM_MAX_LIMIT)))                  \
 	IF_ENABLED(CONFIG_RTIO_CONSUME_SEM,                                                        \
 		   (static K_SEM_DEFINE(_consume_sem_##name, 0, K_SEM_MAX_LIMIT)))                 \
+	IF_ENABLED(CONFIG_RTIO_CONSUME_BATCH,                                                      \
+		   (static K_SEM_DEFINE(_batch_sem_##name, 0, 1)))                                 \
 	STRUCT_SECTION_ITERABLE(rtio, name) = {                                                    \
 		IF_ENABLED(CONFIG_RTIO_SUBMIT_SEM, (.submit_sem = &_submit_sem_##name,))           \
 		IF_ENABLED(CONFIG_RTIO_SUBMIT_SEM, (.submit_count = 0,))                           \
 		IF_ENABLED(CONFIG_RTIO_CONSUME_SEM, (.consume_sem = &_consume_sem_##name,))        \
+		IF_ENABLED(CONFIG_RTIO_CONSUME_BATCH, (.batch_sem = &_batch_sem_##name,))          \
+		IF_ENABLED(CONFIG_RTIO_CONSUME_BATCH, (.batch_target = ATOMIC_INIT(0),))           \
 		.cq_count = ATOMIC_INIT(0),                                                        \
 		.xcqcnt = ATOMIC_INIT(0),                                                          \
 		.sqe_pool = _sqe_pool,                                                             \
@@ -1005,6 +1052,118 @@ static inline void rtio_cqe_release(struct rtio *r, struct rtio_cqe *cqe)
 	rtio_cqe_pool_free(r->cqe_pool, cqe);
 }
 
+/** @cond ignore */
+static inline size_t z_rtio_cqe_consume_avail(struct rtio *r, struct rtio_cqe **cqes,
+					      size_t count, size_t max_count)
+{
+	struct rtio_cqe *cqe;
+
+	while (count < max_count) {
+		cqe = rtio_cqe_consume(r);
+		if (cqe == NULL) {
+			break;
+		}
+		cqes[count++] = cqe;
+	}
+
+	return count;
+}
+/** @endcond */
+
+/**
+ * @brief Busy poll for a batch of completion queue events
+ *
+ * Consumes up to @p max_count completion queue events, spinning without
+ * sleeping until at least @p min_count are consumed or the timeout expires.
+ * Meant for latency critical threads, which are then never woken up by
+ * completions. Each consumed event must be released with rtio_cqe_release().
+ *
+ * @param r RTIO context
+ * @param cqes Array receiving the consumed completion queue events
+ * @param min_count Number of events to wait for
+ * @param max_count Size of the array
+ * @param timeout Maximum time to poll for
+ *
+ * @retval count Number of consumed events (0 to max_count)
+ */
+static inline size_t rtio_cqe_poll_batch(struct rtio *r, struct rtio_cqe **cqes,
+					 size_t min_count, size_t max_count,
+					 k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	size_t count = 0;
+
+	min_count = MIN(min_count, max_count);
+
+	while (true) {
+		count = z_rtio_cqe_consume_avail(r, cqes, count, max_count);
+		if (count >= min_count || sys_timepoint_expired(end)) {
+			break;
+		}
+		Z_SPIN_DELAY(1);
+	}
+
+	return count;
+}
+
+/**
+ * @brief Wait for and consume a batch of completion queue events
+ *
+ * Consumes up to @p max_count completion queue events, waiting until at
+ * least @p min_count are consumed or the timeout expires. With
+ * CONFIG_RTIO_CONSUME_BATCH the calling thread sleeps and is woken up once
+ * for the whole batch instead of once per completion, it busy polls like
+ * rtio_cqe_poll_batch() otherwise. Only one thread may wait for a batch on
+ * a context at a time. Each consumed event must be released with
+ * rtio_cqe_release().
+ *
+ * @param r RTIO context
+ * @param cqes Array receiving the consumed completion queue events
+ * @param min_count Number of events to wait for
+ * @param max_count Size of the array
+ * @param timeout Maximum time to wait for
+ *
+ * @retval count Number of consumed events (0 to max_count)
+ */
+static inline size_t rtio_cqe_consume_batch(struct rtio *r, struct rtio_cqe **cqes,
+					    size_t min_count, size_t max_count,
+					    k_timeout_t timeout)
+{
+#ifdef CONFIG_RTIO_CONSUME_BATCH
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	atomic_val_t target;
+	size_t count = 0;
+
+	min_count = MIN(min_count, max_count);
+
+	while (true) {
+		/* Completions counted before consuming are either consumed or wake us */
+		target = atomic_get(&r->cq_count);
+		count = z_rtio_cqe_consume_avail(r, cqes, count, max_count);
+		if (count >= min_count || sys_timepoint_expired(end)) {
+			break;
+		}
+
+		target += min_count - count;
+		if (target == 0) {
+			/* 0 means no waiter, waking up early is harmless */
+			target = 1;
+		}
+
+		k_sem_reset(r->batch_sem);
+		atomic_set(&r->batch_target, target);
+		if (atomic_get(&r->cq_count) - target < 0) {
+			(void)k_sem_take(r->batch_sem, sys_timepoint_timeout(end));
+		}
+		atomic_set(&r->batch_target, 0);
+	}
+
+	return count;
+#else
+	return rtio_cqe_poll_batch(r, cqes, min_count, max_count, timeout);
+#endif
+}
+
 /**
  * @brief Compute the CQE flags from the rtio_iodev_sqe entry
  *
@@ -1149,7 +1308,17 @@ static inline void rtio_cqe_submit(struct rtio *r, int result, void *userdata, u
 		rtio_cqe_produce(r, cqe);
 	}
 
-	atomic_inc(&r->cq_count);
+	atomic_val_t cq_count = atomic_inc(&r->cq_count) + 1;
+#ifdef CONFIG_RTIO_CONSUME_BATCH
+	atomic_val_t target = atomic_get(&r->batch_target);
+
+	if (target != 0 && cq_count - target >= 0 &&
+	    atomic_cas(&r->batch_target, target, 0)) {
+		k_sem_give(r->batch_sem);
+	}
+#else
+	ARG_UNUSED(cq_count);
+#endif
 #ifdef CONFIG_RTIO_SUBMIT_SEM
 	if (r->submit_count > 0) {
 		r->submit_count--;
@@ -1262,6 +1431,10 @@ static inline void rtio_access_grant(struct rtio *r, struct k_thread *t)
 #ifdef CONFIG_RTIO_CONSUME_SEM
 	k_object_access_grant(r->consume_sem, t);
 #endif
+
+#ifdef CONFIG_RTIO_CONSUME_BATCH
+	k_object_access_grant(r->batch_sem, t);
+#endif
 }
 
 /**
@@ -326,6 +326,40 @@ int settings_save_one(const char *name, const void *value, size_t val_len);
  */
 int settings_delete(const char *name);
 
+/**
+ * Start a transaction of settings saves.
+ *
+ * Until the transaction is committed or aborted, the values saved with
+ * settings_save_one() or deleted with settings_delete() are buffered in RAM,
+ * a value saved again under the same name replacing the buffered one. They
+ * are then written to the storage back-end as a batch. Other threads using
+ * the settings are blocked until the transaction ends.
+ *
+ * @note A transaction batches writes, it is not atomic: a power loss while
+ * it is committed can leave only part of it persisted.
+ *
+ * @return 0 on success, -EBUSY if a transaction is already open, -ENOENT if
+ * there is no storage back-end.
+ */
+int settings_transaction_begin(void);
+
+/**
+ * Write the values buffered by the transaction to persisted storage and end
+ * it. Must be called from the thread that started the transaction.
+ *
+ * @return 0 on success, -EINVAL if no transaction is open, other non-zero
+ * value if a value could not be written.
+ */
+int settings_transaction_commit(void);
+
+/**
+ * Drop the values buffered by the transaction and end it. Must be called
+ * from the thread that started the transaction.
+ *
+ * @return 0 on success, -EINVAL if no transaction is open.
+ */
+int settings_transaction_abort(void);
+
 /**
  * Call commit for all settings handler. This should apply all
  * settings which has been set, but not applied yet.
@@ -19,6 +19,9 @@
 #include <zephyr/sys/atomic.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/time_units.h>
+#ifdef CONFIG_SPIN_LOCK_STATS
+#include <zephyr/sys/iterable_sections.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -35,6 +38,34 @@ struct z_spinlock_key {
 	int key;
 };
 
+#if defined(CONFIG_SPIN_LOCK_STATS) || defined(__DOXYGEN__)
+struct k_spinlock;
+
+/**
+ * @brief Spinlock statistics
+ *
+ * Statistics of a spinlock named with K_SPINLOCK_STATS_DEFINE(). All
+ * fields are updated by the CPU holding the lock.
+ */
+struct k_spinlock_stats {
+	/** Name of the lock */
+	const char *name;
+	/** Lock the statistics are gathered for */
+	struct k_spinlock *lock;
+	/** Number of acquisitions */
+	uint32_t acquired;
+	/** Number of acquisitions which had to spin */
+	uint32_t contended;
+	/** Total cycles spent spinning */
+	uint64_t spin_cycles;
+	/** Longest time the lock was held, in cycles */
+	uint32_t max_hold_cycles;
+	/** @cond INTERNAL_HIDDEN */
+	uint32_t hold_start;
+	/** @endcond */
+};
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
 /**
  * @brief Kernel Spin Lock
  *
@@ -59,8 +90,13 @@ struct k_spinlock {
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_SPIN_LOCK_STATS
+	/* Statistics, for locks named with K_SPINLOCK_STATS_DEFINE() */
+	struct k_spinlock_stats *stats;
+#endif
+
 #if defined(CONFIG_CPP) && !defined(CONFIG_SMP) && \
-	!defined(CONFIG_SPIN_VALIDATE)
+	!defined(CONFIG_SPIN_VALIDATE) && !defined(CONFIG_SPIN_LOCK_STATS)
 	/* If CONFIG_SMP and CONFIG_SPIN_VALIDATE are both not defined
 	 * the k_spinlock struct will have no members. The result
 	 * is that in C sizeof(k_spinlock) is 0 and in C++ it is 1.
@@ -129,6 +165,36 @@ static ALWAYS_INLINE void z_spinlock_validate_post(struct k_spinlock *l)
 #endif /* CONFIG_SPIN_VALIDATE */
 }
 
+#ifdef CONFIG_SPIN_LOCK_STATS
+static ALWAYS_INLINE void z_spinlock_stats_acquired(struct k_spinlock *l,
+						    uint32_t spin_cycles)
+{
+	struct k_spinlock_stats *stats = l->stats;
+
+	if (stats != NULL) {
+		stats->acquired++;
+		if (spin_cycles != 0U) {
+			stats->contended++;
+			stats->spin_cycles += spin_cycles;
+		}
+		stats->hold_start = sys_clock_cycle_get_32();
+	}
+}
+
+static ALWAYS_INLINE void z_spinlock_stats_release(struct k_spinlock *l)
+{
+	struct k_spinlock_stats *stats = l->stats;
+
+	if (stats != NULL) {
+		uint32_t hold = sys_clock_cycle_get_32() - stats->hold_start;
+
+		if (hold > stats->max_hold_cycles) {
+			stats->max_hold_cycles = hold;
+		}
+	}
+}
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
 /**
  * @brief Lock a spinlock
  *
@@ -169,12 +235,34 @@ static ALWAYS_INLINE k_spinlock_key_t k_spin_lock(struct k_spinlock *l)
 	k.key = arch_irq_lock();
 
 	z_spinlock_validate_pre(l);
-#ifdef CONFIG_SMP
+#if defined(CONFIG_SMP) && defined(CONFIG_SPIN_LOCK_STATS)
+	uint32_t spin_cycles = 0U;
+
+	if (unlikely(!atomic_cas(&l->locked, 0, 1))) {
+		/* Only contended acquisitions read the clock */
+		uint32_t spin_start = sys_clock_cycle_get_32();
+
+		do {
+			arch_spin_relax();
+		} while (!atomic_cas(&l->locked, 0, 1));
+
+		spin_cycles = sys_clock_cycle_get_32() - spin_start;
+		/* 0 marks an uncontended acquisition */
+		spin_cycles = (spin_cycles != 0U) ? spin_cycles : 1U;
+	}
+#elif defined(CONFIG_SMP)
 	while (!atomic_cas(&l->locked, 0, 1)) {
 		arch_spin_relax();
 	}
 #endif
 	z_spinlock_validate_post(l);
+#ifdef CONFIG_SPIN_LOCK_STATS
+#ifdef CONFIG_SMP
+	z_spinlock_stats_acquired(l, spin_cycles);
+#else
+	z_spinlock_stats_acquired(l, 0U);
+#endif
+#endif
 
 	return k;
 }
@@ -205,6 +293,9 @@ static ALWAYS_INLINE int k_spin_trylock(struct k_spinlock *l, k_spinlock_key_t *
 	}
 #endif
 	z_spinlock_validate_post(l);
+#ifdef CONFIG_SPIN_LOCK_STATS
+	z_spinlock_stats_acquired(l, 0U);
+#endif
 
 	k->key = key;
 
@@ -248,6 +339,10 @@ static ALWAYS_INLINE void k_spin_unlock(struct k_spinlock *l,
 #endif /* CONFIG_SPIN_LOCK_TIME_LIMIT */
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_SPIN_LOCK_STATS
+	z_spinlock_stats_release(l);
+#endif
+
 #ifdef CONFIG_SMP
 	/* Strictly we don't need atomic_clear() here (which is an
 	 * exchange operation that returns the old value).  We are always
@@ -286,6 +381,9 @@ static ALWAYS_INLINE void k_spin_release(struct k_spinlock *l)
 #ifdef CONFIG_SPIN_VALIDATE
 	__ASSERT(z_spin_unlock_valid(l), "Not my spinlock %p", l);
 #endif
+#ifdef CONFIG_SPIN_LOCK_STATS
+	z_spinlock_stats_release(l);
+#endif
 #ifdef CONFIG_SMP
 	atomic_clear(&l->locked);
 #endif
@@ -306,6 +404,38 @@ static ALWAYS_INLINE void z_spin_onexit(__maybe_unused k_spinlock_key_t *k)
  * INTERNAL_HIDDEN @endcond
  */
 
+/**
+ * @brief Name a spinlock to gather statistics for it
+ *
+ * With CONFIG_SPIN_LOCK_STATS, the acquisitions, contended acquisitions,
+ * cycles spent spinning and longest hold time of the lock are recorded
+ * from system initialization on, and reported by the "kernel spinlocks"
+ * shell command. Without it, this compiles to nothing.
+ *
+ * The lock of the system timer driver must not be named, the statistics
+ * read the cycle counter while holding the lock.
+ *
+ * @code{.c}
+ * static struct k_spinlock my_lock;
+ * K_SPINLOCK_STATS_DEFINE(my_lock, my_lock);
+ *
+ * K_SPINLOCK_STATS_DEFINE(my_slab, my_slab.lock);
+ * @endcode
+ *
+ * @param _name Name of the lock in the statistics, a C identifier.
+ * @param _lock Statically allocated lock, not a pointer.
+ */
+#if defined(CONFIG_SPIN_LOCK_STATS) || defined(__DOXYGEN__)
+#define K_SPINLOCK_STATS_DEFINE(_name, _lock)                                  \
+	STRUCT_SECTION_ITERABLE(k_spinlock_stats, _k_spinlock_stats_##_name) = { \
+		.name = #_name,                                                \
+		.lock = &(_lock),                                              \
+	}
+#else
+#define K_SPINLOCK_STATS_DEFINE(_name, _lock)                                  \
+	extern int _k_spinlock_stats_unused_##_name
+#endif
+
 /**
  * @brief Leaves a code block guarded with @ref K_SPINLOCK after releasing the
  * lock.
@@ -23,6 +23,9 @@
 
 #include <stdbool.h>
 #include <zephyr/drivers/flash.h>
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+#include <zephyr/kernel.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -63,6 +66,14 @@ struct stream_flash_ctx {
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	off_t last_erased_page_start_offset; /* Last erased offset */
 #endif
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	uint8_t *buf2; /* Second write buffer, NULL if pipelining is disabled */
+	size_t op_bytes; /* Number of bytes of the write in progress */
+	int op_result; /* Result of the operations in progress */
+	struct k_sem op_done; /* Given when the write in progress completes */
+	struct flash_async_op erase_op; /* Erase operation in progress */
+	struct flash_async_op write_op; /* Write operation in progress */
+#endif
 };
 
 /**
@@ -84,6 +95,28 @@ struct stream_flash_ctx {
 int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 		      uint8_t *buf, size_t buf_len, size_t offset, size_t size,
 		      stream_flash_callback_t cb);
+#if defined(CONFIG_STREAM_FLASH_PIPELINE) || defined(__DOXYGEN__)
+/**
+ * @brief Enable pipelined writes with a second write buffer.
+ *
+ * Once enabled, a full write buffer is erased and written to flash in the
+ * background with the asynchronous flash API, while the next data is
+ * collected in the other buffer. Errors of a background write are reported
+ * by the next call to stream_flash_buffered_write(), and a flush waits for
+ * all the data to be written. stream_flash_bytes_written() only accounts for
+ * completed writes.
+ *
+ * Must be called after stream_flash_init() and before any write.
+ *
+ * @param ctx context
+ * @param buf2 Second write buffer, of the length of the buffer given to
+ *             stream_flash_init()
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int stream_flash_pipeline_init(struct stream_flash_ctx *ctx, uint8_t *buf2);
+#endif
+
 /**
  * @brief Read number of bytes written to the flash.
  *
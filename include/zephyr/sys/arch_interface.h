@@ -495,6 +495,19 @@ static inline uint32_t arch_proc_id(void);
  */
 void arch_sched_ipi(void);
 
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+/**
+ * Send an interrupt to a set of CPUs
+ *
+ * This will invoke z_sched_ipi() on the CPUs whose bits are set in
+ * @a cpu_bitmap (bit N corresponding to the CPU with ID N).  The bit
+ * for the calling CPU, if set, is ignored.
+ *
+ * @param cpu_bitmap Bitmap of CPUs to interrupt
+ */
+void arch_sched_directed_ipi(uint32_t cpu_bitmap);
+#endif /* CONFIG_ARCH_HAS_DIRECTED_IPIS */
+
 #endif /* CONFIG_SMP */
 
 /**
@@ -1211,6 +1224,24 @@ bool arch_pcie_msi_vector_connect(msi_vector_t *vector,
 
 #endif /* CONFIG_PCIE_MSI_MULTI_VECTOR */
 
+#ifdef CONFIG_PROFILING_PERF
+/**
+ * @brief Sample the code interrupted by the current interrupt
+ *
+ * Called by the perf profiler from the system timer interrupt. Stores the
+ * program counter of the interrupted thread in @a buf[0], followed by as
+ * many return addresses of its call chain as the architecture can tell
+ * and @a buf can hold.
+ *
+ * @param buf Buffer for the sampled addresses
+ * @param size Number of addresses @a buf can hold
+ *
+ * @return Number of addresses stored, 0 if the interrupted code can not be
+ *         sampled, e.g. because another interrupt was running.
+ */
+size_t arch_perf_current_stack_trace(uintptr_t *buf, size_t size);
+#endif /* CONFIG_PROFILING_PERF */
+
 /**
  * @brief Perform architecture specific processing within spin loops
  *
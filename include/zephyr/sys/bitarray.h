@@ -186,6 +186,51 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 int sys_bitarray_free(sys_bitarray_t *bitarray, size_t num_bits,
 		      size_t offset);
 
+/**
+ * Allocate several regions of bits in a bit array
+ *
+ * This finds @p count contiguous regions of @p num_bits previously
+ * unallocated bits, marks them as allocated and returns the offsets to
+ * their start via @p offsets, in increasing order. This is faster than
+ * as many calls to sys_bitarray_alloc() as the bit array is only
+ * scanned once. Either all regions are allocated or none is.
+ *
+ * @param[in]  bitarray Bitarray struct
+ * @param[in]  num_bits Number of bits in each region
+ * @param[in]  count    Number of regions to allocate
+ * @param[out] offsets  Array of @p count offsets to the start of the
+ *                      allocated regions if successful
+ *
+ * @retval 0       Allocation successful
+ * @retval -EINVAL Invalid argument (e.g. allocating more bits than
+ *                 the bitarray has, trying to allocate 0 bits, etc.)
+ * @retval -ENOSPC Not enough contiguous regions big enough to
+ *                 accommodate the allocation
+ */
+int sys_bitarray_alloc_multi(sys_bitarray_t *bitarray, size_t num_bits,
+			     size_t count, size_t *offsets);
+
+/**
+ * Free several regions of bits in a bit array
+ *
+ * This marks @p count regions of @p num_bits bits, starting from each
+ * of the @p offsets, as no longer allocated. Either all regions are
+ * freed or none is.
+ *
+ * @param bitarray Bitarray struct
+ * @param num_bits Number of bits in each region
+ * @param count    Number of regions to free
+ * @param offsets  Array of @p count starting bit positions to free
+ *
+ * @retval 0       Free is successful
+ * @retval -EINVAL Invalid argument (e.g. try to free more bits than
+ *                 the bitarray has, trying to free 0 bits, etc.)
+ * @retval -EFAULT The bits in one of the regions are not all allocated,
+ *                 or a region is given twice.
+ */
+int sys_bitarray_free_multi(sys_bitarray_t *bitarray, size_t num_bits,
+			    size_t count, const size_t *offsets);
+
 /**
  * Test if bits in a region is all set.
  *
@@ -265,6 +265,21 @@ uint32_t crc32_c(uint32_t crc, const uint8_t *data,
  */
 uint8_t crc8_ccitt(uint8_t initial_value, const void *buf, size_t len);
 
+/**
+ * @brief Compute ROHC variant of CRC 8
+ *
+ * ROHC (Robust Header Compression) variant of CRC 8 is using reflected
+ * 0x07, and is the frame check sequence of 3GPP TS 27.010 (CMUX).
+ *
+ * @param initial_value Initial value for the CRC computation, 0xFF for
+ *        3GPP TS 27.010
+ * @param buf Input bytes for the computation
+ * @param len Length of the input in bytes
+ *
+ * @return The computed CRC8 value
+ */
+uint8_t crc8_rohc(uint8_t initial_value, const void *buf, size_t len);
+
 /**
  * @brief Compute the CRC-7 checksum of a buffer.
  *
@@ -74,6 +74,17 @@ int z_alloc_fd(void *obj, const struct fd_op_vtable *vtable);
  */
 void z_free_fd(int fd);
 
+/**
+ * @brief Remove file descriptor from all epoll instances.
+ *
+ * Must be called by the close paths before the object behind the
+ * descriptor is closed, so that no epoll registration outlives the object
+ * it watches. Provided if CONFIG_NET_SOCKETS_EPOLL is enabled.
+ *
+ * @param fd File descriptor being closed
+ */
+void z_epoll_fd_close(int fd);
+
 /**
  * @brief Get underlying object pointer from file descriptor.
  *
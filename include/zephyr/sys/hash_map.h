@@ -21,6 +21,7 @@
 #include <zephyr/sys/hash_map_api.h>
 #include <zephyr/sys/hash_map_cxx.h>
 #include <zephyr/sys/hash_map_oa_lp.h>
+#include <zephyr/sys/hash_map_oa_rh.h>
 #include <zephyr/sys/hash_map_sc.h>
 
 #ifdef __cplusplus
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_HRTIMER_H_
+#define ZEPHYR_INCLUDE_SYS_HRTIMER_H_
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/dlist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief High resolution timers
+ * @defgroup hrtimer High resolution timers
+ * @ingroup kernel_apis
+ *
+ * High resolution timers run on a counter device instead of the system
+ * clock, so their resolution is the one of the counter and not the tick.
+ * The timers of a queue share one alarm channel of the counter, which is
+ * always set to the earliest expiry.
+ *
+ * @{
+ */
+
+struct hrtimer;
+
+/**
+ * @brief High resolution timer expiry function.
+ *
+ * Called from the alarm interrupt of the counter. A timer may be started or
+ * stopped from its expiry function.
+ *
+ * @param timer Expired timer.
+ */
+typedef void (*hrtimer_expiry_t)(struct hrtimer *timer);
+
+/**
+ * @brief Queue of high resolution timers running on a counter channel.
+ */
+struct hrtimer_queue {
+	/** @cond INTERNAL_HIDDEN */
+	const struct device *counter;
+	sys_dlist_t timers;
+	struct k_spinlock lock;
+	/* Time of the queue, in counter ticks, at the last counter read. */
+	uint64_t ticks;
+	/* Counter value at the last counter read. */
+	uint32_t last_value;
+	uint32_t top_value;
+	uint8_t channel;
+	bool alarm_set;
+	/** @endcond */
+};
+
+/**
+ * @brief High resolution timer.
+ */
+struct hrtimer {
+	/** @cond INTERNAL_HIDDEN */
+	sys_dnode_t node;
+	struct hrtimer_queue *queue;
+	hrtimer_expiry_t expiry_fn;
+	uint64_t expiry;
+	uint32_t period;
+	/** @endcond */
+
+	/** User data, free for the owner of the timer. */
+	void *user_data;
+};
+
+/**
+ * @brief Initialize a queue of high resolution timers.
+ *
+ * The counter is started, and its alarm channel is used by the queue only.
+ * Only counters counting up are supported.
+ *
+ * @param queue Queue to initialize.
+ * @param counter Counter device.
+ * @param channel Alarm channel of the counter.
+ *
+ * @retval 0 On success.
+ * @retval -ENODEV If the counter is not ready.
+ * @retval -EINVAL If the counter has no such alarm channel.
+ * @retval -ENOTSUP If the counter counts down.
+ * @retval -errno Other negative errno, from counter_start().
+ */
+int hrtimer_queue_init(struct hrtimer_queue *queue, const struct device *counter,
+		       uint8_t channel);
+
+/**
+ * @brief Initialize a high resolution timer.
+ *
+ * @param timer Timer to initialize.
+ * @param queue Queue the timer runs on.
+ * @param expiry_fn Function called when the timer expires.
+ */
+void hrtimer_init(struct hrtimer *timer, struct hrtimer_queue *queue,
+		  hrtimer_expiry_t expiry_fn);
+
+/**
+ * @brief Start a high resolution timer.
+ *
+ * A running timer is restarted.
+ *
+ * @param timer Timer to start.
+ * @param delay_us Time before the first expiry, in microseconds.
+ * @param period_us Time between the following expiries, in microseconds, or
+ *                  0 for a one-shot timer. Periodic expiries do not drift,
+ *                  even if the expiry function runs late.
+ */
+void hrtimer_start(struct hrtimer *timer, uint32_t delay_us, uint32_t period_us);
+
+/**
+ * @brief Stop a high resolution timer.
+ *
+ * Stopping a timer that is not running has no effect.
+ *
+ * @param timer Timer to stop.
+ */
+void hrtimer_stop(struct hrtimer *timer);
+
+/**
+ * @brief Check if a high resolution timer is running.
+ *
+ * @param timer Timer to check.
+ *
+ * @return true if the timer is running, false otherwise.
+ */
+static inline bool hrtimer_is_running(const struct hrtimer *timer)
+{
+	return sys_dnode_is_linked(&timer->node);
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_HRTIMER_H_ */
@@ -128,6 +128,13 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+#if CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0
+	struct {
+		/** Number of pages read ahead of page faults */
+		unsigned long			pages;
+	} prefetch;
+#endif
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -571,6 +578,18 @@ __syscall void k_mem_paging_histogram_backing_store_page_in_get(
 __syscall void k_mem_paging_histogram_backing_store_page_out_get(
 	struct k_mem_paging_histogram_t *hist);
 
+/**
+ * Get the page fault timing histogram
+ *
+ * This populates the timing histogram struct being passed in
+ * as argument. Each entry is the time taken to service a page fault
+ * that needed a page-in, including eviction and prefetch.
+ *
+ * @param[in,out] hist Timing histogram struct to be filled.
+ */
+__syscall void k_mem_paging_histogram_page_fault_get(
+	struct k_mem_paging_histogram_t *hist);
+
 #include <syscalls/mem_manage.h>
 
 /** @} */
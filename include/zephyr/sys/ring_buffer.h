@@ -486,6 +486,144 @@ int ring_buf_item_put(struct ring_buf *buf, uint16_t type, uint8_t value,
 int ring_buf_item_get(struct ring_buf *buf, uint16_t *type, uint8_t *value,
 		      uint32_t *data, uint8_t *size32);
 
+/**
+ * @brief A structure to represent a lock-free multi-producer, multi-consumer
+ * ring buffer of fixed-size items.
+ *
+ * Each slot has a sequence number telling whether it is free or holds an
+ * item for the current lap of the buffer. Producers and consumers reserve
+ * slots by advancing their position with a compare-and-swap, fill or read
+ * them, then publish them by updating the slot sequence numbers, so any
+ * number of threads and ISRs can access the buffer without locking.
+ */
+struct ring_buf_mpmc {
+	/** @cond INTERNAL_HIDDEN */
+	uint8_t *buffer;
+	atomic_t *seq;
+	atomic_t put_pos;
+	atomic_t get_pos;
+	uint32_t item_size;
+	uint32_t mask;
+	/** @endcond */
+};
+
+/**
+ * @brief Define and initialize a multi-producer, multi-consumer ring buffer.
+ *
+ * The ring buffer can be accessed outside the module where it is defined
+ * using:
+ *
+ * @code extern struct ring_buf_mpmc <name>; @endcode
+ *
+ * @param name Name of the ring buffer.
+ * @param item_sz Size of an item (in bytes).
+ * @param item_cnt Number of items, must be a power of 2.
+ */
+#define RING_BUF_MPMC_DECLARE(name, item_sz, item_cnt) \
+	BUILD_ASSERT(IS_POWER_OF_TWO(item_cnt), \
+		"Number of items must be a power of 2"); \
+	static uint8_t __aligned(sizeof(void *)) \
+		_ring_buffer_data_##name[(item_sz) * (item_cnt)]; \
+	static atomic_t _ring_buffer_seq_##name[item_cnt]; \
+	struct ring_buf_mpmc name = { \
+		.buffer = _ring_buffer_data_##name, \
+		.seq = _ring_buffer_seq_##name, \
+		.item_size = (item_sz), \
+		.mask = (item_cnt) - 1, \
+	}
+
+/**
+ * @brief Initialize a multi-producer, multi-consumer ring buffer.
+ *
+ * This routine initializes a ring buffer, prior to its first use. It is only
+ * used for ring buffers not defined using RING_BUF_MPMC_DECLARE.
+ *
+ * @param buf Address of ring buffer.
+ * @param item_size Size of an item (in bytes).
+ * @param item_cnt Number of items, must be a power of 2.
+ * @param data Ring buffer data area (uint8_t data[item_size * item_cnt]).
+ * @param seq Ring buffer sequence numbers (atomic_t seq[item_cnt]).
+ */
+void ring_buf_mpmc_init(struct ring_buf_mpmc *buf, uint32_t item_size,
+			uint32_t item_cnt, uint8_t *data, atomic_t *seq);
+
+/**
+ * @brief Reserve a slot for writing an item to a ring buffer.
+ *
+ * The item is written in place, then made visible to consumers with
+ * @ref ring_buf_mpmc_put_finish. Other producers may reserve and publish
+ * following slots meanwhile, but consumers do not get past an unpublished
+ * item, so a slot must not be held for long.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] item Set to the address of the slot.
+ * @param[out] pos  Set to the position of the slot, to be given to
+ *		    @ref ring_buf_mpmc_put_finish.
+ *
+ * @retval 0 Slot was reserved.
+ * @retval -EMSGSIZE Ring buffer is full.
+ */
+int ring_buf_mpmc_put_claim(struct ring_buf_mpmc *buf, void **item, uint32_t *pos);
+
+/**
+ * @brief Publish an item written to a slot reserved for writing.
+ *
+ * @param buf Address of ring buffer.
+ * @param pos Position given by @ref ring_buf_mpmc_put_claim.
+ */
+void ring_buf_mpmc_put_finish(struct ring_buf_mpmc *buf, uint32_t pos);
+
+/**
+ * @brief Write (copy) items to a ring buffer.
+ *
+ * All slots are reserved at once, so the items are kept contiguous even
+ * if other producers write concurrently.
+ *
+ * @param buf Address of ring buffer.
+ * @param items Address of the items.
+ * @param cnt Number of items.
+ *
+ * @return Number of items written, which is lower than @a cnt if the
+ *	   ring buffer does not have enough free slots.
+ */
+uint32_t ring_buf_mpmc_put(struct ring_buf_mpmc *buf, const void *items, uint32_t cnt);
+
+/**
+ * @brief Reserve the oldest item of a ring buffer for reading.
+ *
+ * The item is read in place, then its slot is given back to producers with
+ * @ref ring_buf_mpmc_get_finish.
+ *
+ * @param[in]  buf  Address of ring buffer.
+ * @param[out] item Set to the address of the item.
+ * @param[out] pos  Set to the position of the item, to be given to
+ *		    @ref ring_buf_mpmc_get_finish.
+ *
+ * @retval 0 Item was reserved.
+ * @retval -EAGAIN Ring buffer is empty, or its oldest item is not
+ *	   published yet.
+ */
+int ring_buf_mpmc_get_claim(struct ring_buf_mpmc *buf, void **item, uint32_t *pos);
+
+/**
+ * @brief Free the slot of an item reserved for reading.
+ *
+ * @param buf Address of ring buffer.
+ * @param pos Position given by @ref ring_buf_mpmc_get_claim.
+ */
+void ring_buf_mpmc_get_finish(struct ring_buf_mpmc *buf, uint32_t pos);
+
+/**
+ * @brief Read (copy) items from a ring buffer.
+ *
+ * @param buf Address of ring buffer.
+ * @param items Area to store the items.
+ * @param cnt Maximum number of items to read.
+ *
+ * @return Number of items read.
+ */
+uint32_t ring_buf_mpmc_get(struct ring_buf_mpmc *buf, void *items, uint32_t cnt);
+
 /**
  * @}
  */
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @defgroup sorted_array_apis Sorted Pointer Array
+ * @ingroup datastructure_apis
+ *
+ * @brief Sorted array of element pointers
+ *
+ * This is an alternative to the @ref rbtree_apis for sets that are
+ * searched and iterated over much more often than they are modified,
+ * or that are small enough for moving a few pointers to be cheaper
+ * than rebalancing a tree.  Elements are kept as pointers in one
+ * contiguous caller-provided array, so that lookups are binary
+ * searches over consecutive memory rather than walks through nodes
+ * spread over the heap, and elements need no embedded node at all.
+ *
+ * Lookups are O(log2(N)).  Insertion and removal move the pointers
+ * after the affected slot and are O(N), except for removing the
+ * lowest-sorted element which is O(1): the array is kept in
+ * descending order so that the minimum is its last entry, as needed
+ * by priority queues.
+ *
+ * @{
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SORTED_ARRAY_H_
+#define ZEPHYR_INCLUDE_SYS_SORTED_ARRAY_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Sorted array comparison predicate
+ *
+ * Compares the two elements and returns true if "a" is strictly less
+ * than "b" according to the caller-defined sort criteria, as with
+ * @ref rb_lessthan_t.
+ */
+typedef bool (*sys_sorted_array_lessthan_t)(const void *a, const void *b);
+
+/**
+ * @brief Sorted array structure
+ */
+struct sys_sorted_array {
+	/** @cond INTERNAL_HIDDEN */
+	void **elems;
+	size_t size;
+	size_t capacity;
+	/** @endcond */
+	/** Comparison function for elements in the array */
+	sys_sorted_array_lessthan_t lessthan_fn;
+};
+
+/**
+ * @brief Statically define and initialize a sorted array
+ *
+ * @param name Name of the sorted array
+ * @param cap Maximum number of elements in the array
+ * @param lessthan Comparison function of type @ref sys_sorted_array_lessthan_t
+ */
+#define SYS_SORTED_ARRAY_DEFINE(name, cap, lessthan)			\
+	static void *_sorted_array_elems_##name[cap];			\
+	struct sys_sorted_array name = {				\
+		.elems = _sorted_array_elems_##name,			\
+		.capacity = (cap),					\
+		.lessthan_fn = (lessthan),				\
+	}
+
+/**
+ * @brief Initialize a sorted array
+ *
+ * @param array Sorted array to initialize
+ * @param elems Storage for @p capacity element pointers
+ * @param capacity Maximum number of elements in the array
+ * @param lessthan_fn Comparison function
+ */
+static inline void sys_sorted_array_init(struct sys_sorted_array *array, void **elems,
+					 size_t capacity,
+					 sys_sorted_array_lessthan_t lessthan_fn)
+{
+	array->elems = elems;
+	array->size = 0;
+	array->capacity = capacity;
+	array->lessthan_fn = lessthan_fn;
+}
+
+/**
+ * @brief Insert an element into the array
+ *
+ * An element equal to elements already in the array is sorted after
+ * them, as with rb_insert().
+ *
+ * @retval 0 on success
+ * @retval -ENOMEM if the array is full
+ */
+int sys_sorted_array_insert(struct sys_sorted_array *array, void *elem);
+
+/**
+ * @brief Remove an element from the array
+ *
+ * @return true if the element was found and removed
+ */
+bool sys_sorted_array_remove(struct sys_sorted_array *array, void *elem);
+
+/**
+ * @brief Returns true if the given element is part of the array
+ *
+ * As for rb_contains(), the element is compared with the lessthan
+ * callback to find where it would be, and then by pointer value.
+ */
+bool sys_sorted_array_contains(struct sys_sorted_array *array, void *elem);
+
+/**
+ * @brief Returns the number of elements in the array
+ */
+static inline size_t sys_sorted_array_size(const struct sys_sorted_array *array)
+{
+	return array->size;
+}
+
+/**
+ * @brief Returns the lowest-sorted element of the array, or NULL if empty
+ */
+static inline void *sys_sorted_array_get_min(struct sys_sorted_array *array)
+{
+	return (array->size != 0) ? array->elems[array->size - 1] : NULL;
+}
+
+/**
+ * @brief Returns the highest-sorted element of the array, or NULL if empty
+ */
+static inline void *sys_sorted_array_get_max(struct sys_sorted_array *array)
+{
+	return (array->size != 0) ? array->elems[0] : NULL;
+}
+
+/**
+ * @brief Removes and returns the lowest-sorted element, or NULL if empty
+ *
+ * Unlike other removals, this does not move any other element.
+ */
+static inline void *sys_sorted_array_remove_min(struct sys_sorted_array *array)
+{
+	return (array->size != 0) ? array->elems[--array->size] : NULL;
+}
+
+/**
+ * @brief Walk a sorted array in ascending order
+ *
+ * The loop is not safe against modifications to the array, except
+ * for removing the current element with sys_sorted_array_remove_min()
+ * or sys_sorted_array_remove(), which never moves the elements not
+ * visited yet.
+ *
+ * @param array A pointer to a struct sys_sorted_array to walk
+ * @param elem The symbol name of a local pointer variable to use as
+ *             the iterator, of the element type
+ */
+#define SYS_SORTED_ARRAY_FOR_EACH(array, elem)				\
+	for (size_t __i = (array)->size;				\
+	     (__i > 0) && ((elem) = (array)->elems[__i - 1], true);	\
+	     __i--)
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_SYS_SORTED_ARRAY_H_ */
@@ -44,6 +44,13 @@ extern "C" {
  * extreme values results in an effectively linear search of the
  * list), objectively fast (~hundred instructions) and and amenable to
  * locked operation.
+ *
+ * Alternatively, with CONFIG_SYS_HEAP_TLSF, each power-of-two bucket
+ * is subdivided linearly into several free lists indexed by a second
+ * level bitmap ("two-level segregated fit").  Allocation then never
+ * walks a list and always picks from the narrowest size range
+ * guaranteed to fit, for strictly constant time operation and lower
+ * fragmentation at the cost of a larger bucket array.
  */
 
 /* Note: the init_mem/bytes fields are for the static initializer to
@@ -78,6 +85,39 @@ struct z_heap_stress_result {
 int sys_heap_runtime_stats_get(struct sys_heap *heap,
 		struct sys_memory_stats *stats);
 
+/** Number of bins in sys_heap_fragmentation_stats::histogram */
+#define SYS_HEAP_FRAG_HISTOGRAM_BINS 32
+
+/** Free space fragmentation of a sys_heap */
+struct sys_heap_fragmentation_stats {
+	/** Usable bytes of the largest free chunk */
+	size_t largest_free_bytes;
+	/** Total number of free chunks */
+	uint32_t free_chunks;
+	/**
+	 * Free chunk count by size: bin i counts chunks of 2^i to
+	 * 2^(i+1) - 1 units of 8 bytes, chunk header included.
+	 */
+	uint32_t histogram[SYS_HEAP_FRAG_HISTOGRAM_BINS];
+};
+
+/**
+ * @brief Get the free space fragmentation of a sys_heap
+ *
+ * Complements sys_heap_runtime_stats_get(): the free byte count
+ * alone doesn't tell whether an allocation of a given size can
+ * succeed, the size of the largest free chunk does.  Unlike the
+ * other statistics, these are not tracked incrementally but computed
+ * by walking the free lists, so the cost is linear in the number of
+ * free chunks.
+ *
+ * @param heap Pointer to specified sys_heap
+ * @param stats Pointer to struct to copy statistics into
+ * @return -EINVAL if null pointers, otherwise 0
+ */
+int sys_heap_fragmentation_stats_get(struct sys_heap *heap,
+		struct sys_heap_fragmentation_stats *stats);
+
 /**
  * @brief Reset the maximum heap usage.
  *
@@ -22,6 +22,30 @@ extern "C" {
  * @{
  */
 
+#if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS) || defined(__DOXYGEN__)
+
+/**
+ * @brief Publishing statistics of a channel.
+ *
+ * The latency of a publication is the time spent in zbus_chan_pub() or zbus_chan_notify(), from
+ * the call until all the observers are notified, waiting for the channel included.
+ */
+struct zbus_chan_pub_stats {
+	/** Number of publications and notifications. */
+	uint32_t count;
+
+	/** Latency of the last publication, in ticks. */
+	k_ticks_t last_latency;
+
+	/** Highest latency of a publication, in ticks. */
+	k_ticks_t max_latency;
+
+	/** Sum of the latencies of all the publications, in ticks. */
+	k_ticks_t total_latency;
+};
+
+#endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
 /**
  * @brief Type used to represent a channel mutable data.
  *
@@ -49,6 +73,11 @@ struct zbus_channel_data {
 	 */
 	sys_slist_t observers;
 #endif /* CONFIG_ZBUS_RUNTIME_OBSERVERS */
+
+#if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS) || defined(__DOXYGEN__)
+	/** Publishing statistics, protected by the channel's mutex. */
+	struct zbus_chan_pub_stats pub_stats;
+#endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
 };
 
 /**
@@ -94,8 +123,33 @@ enum __packed zbus_observer_type {
 	ZBUS_OBSERVER_LISTENER_TYPE,
 	ZBUS_OBSERVER_SUBSCRIBER_TYPE,
 	ZBUS_OBSERVER_MSG_SUBSCRIBER_TYPE,
+	ZBUS_OBSERVER_ASYNC_LISTENER_TYPE,
 };
 
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER) || defined(__DOXYGEN__)
+
+/**
+ * @brief Type used to represent the state of an asynchronous listener.
+ *
+ * The notifications are queued to the message queue, and the callback is called for each of them
+ * from the work queue.
+ */
+struct zbus_async_listener {
+	/** Callback function, called from the work queue. */
+	void (*const callback)(const struct zbus_channel *chan);
+
+	/** Queue of the channels notified and not handled yet. */
+	struct k_msgq *const queue;
+
+	/** Work queue calling the callback, or NULL for the zbus work queue. */
+	struct k_work_q *const work_queue;
+
+	/** Work item submitted to the work queue on notifications. */
+	struct k_work work;
+};
+
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
+
 /**
  * @brief Type used to represent an observer.
  *
@@ -135,6 +189,13 @@ struct zbus_observer {
 		 */
 		struct k_fifo *const message_fifo;
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
+
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER) || defined(__DOXYGEN__)
+		/** Observer callback and queue. It turns the observer into an asynchronous listener.
+		 * It only exists if the @kconfig{CONFIG_ZBUS_ASYNC_LISTENER} is enabled.
+		 */
+		struct zbus_async_listener *const async_listener;
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
 	};
 };
 
@@ -419,6 +480,55 @@ struct zbus_channel_observation {
  * @param[in] _name The subscriber's name.
  */
 #define ZBUS_MSG_SUBSCRIBER_DEFINE(_name) ZBUS_MSG_SUBSCRIBER_DEFINE_WITH_ENABLE(_name, true)
+
+/** @cond INTERNAL_HIDDEN */
+void _zbus_async_listener_work_handler(struct k_work *work);
+/** @endcond */
+
+/**
+ * @brief Define and initialize an asynchronous listener.
+ *
+ * This macro defines an observer of asynchronous listener type. The notifications are queued and
+ * the callback is called for each of them from a work queue, instead of from the publisher's
+ * context. A notification waits for room in the queue until the publishing times out, then it is
+ * dropped and the publishing fails. As for subscribers, the callback must read the channel with
+ * zbus_chan_read(), and may see a message published after the one it is notified for.
+ *
+ * @param[in] _name The listener's name.
+ * @param[in] _cb The callback function.
+ * @param[in] _queue_size The notification queue's size.
+ * @param[in] _work_queue The work queue calling the callback, NULL for the zbus work queue. Work
+ * queues of different priorities give priorities to the listeners.
+ * @param[in] _enable The listener's initial state.
+ */
+#define ZBUS_ASYNC_LISTENER_DEFINE_WITH_ENABLE(_name, _cb, _queue_size, _work_queue, _enable)     \
+	K_MSGQ_DEFINE(_zbus_observer_queue_##_name, sizeof(const struct zbus_channel *),           \
+		      _queue_size, sizeof(const struct zbus_channel *));                           \
+	static struct zbus_async_listener _zbus_async_listener_##_name = {                         \
+		.callback = (_cb),                                                                 \
+		.queue = &_zbus_observer_queue_##_name,                                            \
+		.work_queue = (_work_queue),                                                       \
+		.work = Z_WORK_INITIALIZER(_zbus_async_listener_work_handler),                     \
+	};                                                                                         \
+	STRUCT_SECTION_ITERABLE(zbus_observer, _name) = {                                          \
+		ZBUS_OBSERVER_NAME_INIT(_name) /* Name field */                                    \
+			.type = ZBUS_OBSERVER_ASYNC_LISTENER_TYPE,                                 \
+		.enabled = _enable,                                                                \
+		.async_listener = &_zbus_async_listener_##_name,                                   \
+	}
+
+/**
+ * @brief Define and initialize an enabled asynchronous listener.
+ *
+ * This macro defines an observer of asynchronous listener type, whose callback is called from the
+ * zbus work queue. The listeners are defined in the enabled state with this macro.
+ *
+ * @param[in] _name The listener's name.
+ * @param[in] _cb The callback function.
+ * @param[in] _queue_size The notification queue's size.
+ */
+#define ZBUS_ASYNC_LISTENER_DEFINE(_name, _cb, _queue_size)                                        \
+	ZBUS_ASYNC_LISTENER_DEFINE_WITH_ENABLE(_name, _cb, _queue_size, NULL, true)
 /**
  *
  * @brief Publish to a channel
@@ -614,6 +724,42 @@ static inline void *zbus_chan_user_data(const struct zbus_channel *chan)
 	return chan->user_data;
 }
 
+#if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS) || defined(__DOXYGEN__)
+
+/**
+ * @brief Get the channel's publishing statistics.
+ *
+ * @param[in] chan The channel's reference.
+ * @param[out] stats The statistics.
+ * @param[in] timeout Waiting period to lock the channel,
+ *                    or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Statistics read.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_pub_stats_get(const struct zbus_channel *chan, struct zbus_chan_pub_stats *stats,
+			    k_timeout_t timeout);
+
+/**
+ * @brief Reset the channel's publishing statistics.
+ *
+ * @param[in] chan The channel's reference.
+ * @param[in] timeout Waiting period to lock the channel,
+ *                    or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Statistics reset.
+ * @retval -EBUSY The channel is busy.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_chan_pub_stats_reset(const struct zbus_channel *chan, k_timeout_t timeout);
+
+#endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
 #if defined(CONFIG_ZBUS_RUNTIME_OBSERVERS) || defined(__DOXYGEN__)
 
 /**
@@ -783,6 +929,8 @@ int zbus_sub_wait(const struct zbus_observer *sub, const struct zbus_channel **c
 
 #if defined(CONFIG_ZBUS_MSG_SUBSCRIBER) || defined(__DOXYGEN__)
 
+struct net_buf;
+
 /**
  * @brief Wait for a channel message.
  *
@@ -804,6 +952,29 @@ int zbus_sub_wait(const struct zbus_observer *sub, const struct zbus_channel **c
 int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel **chan, void *msg,
 		      k_timeout_t timeout);
 
+/**
+ * @brief Wait for a channel message, without copying it.
+ *
+ * This routine makes the subscriber wait for the new message in case of channel publication, like
+ * zbus_sub_wait_msg(), but gives the subscriber a reference to the buffer holding the message
+ * instead of a copy. With @kconfig{CONFIG_ZBUS_MSG_SUBSCRIBER_NET_BUF_DYNAMIC}, all the message
+ * subscribers of a channel share the same message data, so it must not be modified. The
+ * subscriber must release the buffer with net_buf_unref() once done with the message.
+ *
+ * @param[in] sub The subscriber's reference.
+ * @param[out] chan The notification channel's reference.
+ * @param[out] buf The buffer holding the published message, at buf->data.
+ * @param[in] timeout Waiting period for a notification arrival,
+ *                or one of the special values, K_NO_WAIT and K_FOREVER.
+ *
+ * @retval 0 Message received.
+ * @retval -ENOMSG Could not retrieve the net_buf from the subscriber FIFO.
+ * @retval -EFAULT A parameter is incorrect, or the function context is invalid (inside an ISR). The
+ * function only returns this value when the @kconfig{CONFIG_ZBUS_ASSERT_MOCK} is enabled.
+ */
+int zbus_sub_wait_msg_ref(const struct zbus_observer *sub, const struct zbus_channel **chan,
+			  struct net_buf **buf, k_timeout_t timeout);
+
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
 /**
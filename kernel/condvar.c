@@ -11,6 +11,7 @@
 #include <wait_q.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/init.h>
+#include <kernel_internal.h>
 
 #ifdef CONFIG_OBJ_CORE_CONDVAR
 static struct k_obj_type obj_type_condvar;
@@ -26,6 +27,9 @@ int z_impl_k_condvar_init(struct k_condvar *condvar)
 #ifdef CONFIG_OBJ_CORE_CONDVAR
 	k_obj_core_init_and_link(K_OBJ_CORE(condvar), &obj_type_condvar);
 #endif
+#ifdef CONFIG_OBJ_CORE_STATS_CONDVAR
+	z_wait_stats_register(K_OBJ_CORE(condvar), &condvar->wait_stats);
+#endif
 
 	SYS_PORT_TRACING_OBJ_INIT(k_condvar, condvar, 0);
 
@@ -117,7 +121,17 @@ int z_impl_k_condvar_wait(struct k_condvar *condvar, struct k_mutex *mutex,
 	key = k_spin_lock(&lock);
 	k_mutex_unlock(mutex);
 
+#ifdef CONFIG_OBJ_CORE_STATS_CONDVAR
+	uint32_t wait_start = k_cycle_get_32();
+#endif
+
 	ret = z_pend_curr(&lock, key, &condvar->wait_q, timeout);
+
+#ifdef CONFIG_OBJ_CORE_STATS_CONDVAR
+	/* Only the wait for the signal, relocking is up to the mutex */
+	z_wait_stats_record(K_OBJ_CORE(condvar), wait_start);
+#endif
+
 	k_mutex_lock(mutex, K_FOREVER);
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_condvar, wait, condvar, ret);
@@ -142,12 +156,19 @@ static int init_condvar_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_condvar, K_OBJ_TYPE_CONDVAR_ID,
 			offsetof(struct k_condvar, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_CONDVAR
+	k_obj_type_stats_init(&obj_type_condvar, &z_wait_stats_desc);
+#endif
 
 	/* Initialize and link statically defined condvars */
 
 	STRUCT_SECTION_FOREACH(k_condvar, condvar) {
 		k_obj_core_init_and_link(K_OBJ_CORE(condvar),
 					 &obj_type_condvar);
+#ifdef CONFIG_OBJ_CORE_STATS_CONDVAR
+		z_wait_stats_register(K_OBJ_CORE(condvar),
+				      &condvar->wait_stats);
+#endif
 	}
 
 	return 0;
@@ -12,6 +12,74 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/toolchain.h>
 
+#ifdef CONFIG_DEVICE_NAME_INDEX
+/* Static devices sorted by name, equal names in section order. Empty if
+ * there are more devices than it can hold.
+ */
+static const struct device *device_name_index[CONFIG_DEVICE_NAME_INDEX_SIZE];
+static size_t device_name_index_count;
+
+static void device_name_index_init(void)
+{
+	size_t count;
+
+	STRUCT_SECTION_COUNT(device, &count);
+	if (count > ARRAY_SIZE(device_name_index)) {
+		return;
+	}
+
+	/* Insertion sort, which is stable and runs only once at boot. */
+	for (size_t i = 0; i < count; i++) {
+		const struct device *dev;
+		size_t j = i;
+
+		STRUCT_SECTION_GET(device, i, &dev);
+
+		while ((j > 0) &&
+		       (strcmp(device_name_index[j - 1]->name, dev->name) > 0)) {
+			device_name_index[j] = device_name_index[j - 1];
+			j--;
+		}
+
+		device_name_index[j] = dev;
+	}
+
+	device_name_index_count = count;
+}
+
+static const struct device *device_name_index_find(const char *name)
+{
+	size_t lo = 0;
+	size_t hi = device_name_index_count;
+
+	/* Find the first device with this name... */
+	while (lo < hi) {
+		size_t mid = lo + ((hi - lo) / 2);
+
+		if (strcmp(device_name_index[mid]->name, name) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	/* ...and return the first ready one. */
+	for (; lo < device_name_index_count; lo++) {
+		const struct device *dev = device_name_index[lo];
+
+		if (strcmp(dev->name, name) != 0) {
+			break;
+		}
+
+		if (z_device_is_ready(dev)) {
+			return dev;
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_DEVICE_NAME_INDEX */
+
 /**
  * @brief Initialize state for all static devices.
  *
@@ -23,6 +91,10 @@ void z_device_state_init(void)
 	STRUCT_SECTION_FOREACH(device, dev) {
 		k_object_init(dev);
 	}
+
+#ifdef CONFIG_DEVICE_NAME_INDEX
+	device_name_index_init();
+#endif
 }
 
 const struct device *z_impl_device_get_binding(const char *name)
@@ -34,6 +106,12 @@ const struct device *z_impl_device_get_binding(const char *name)
 		return NULL;
 	}
 
+#ifdef CONFIG_DEVICE_NAME_INDEX
+	if (device_name_index_count > 0) {
+		return device_name_index_find(name);
+	}
+#endif
+
 	/* Split the search into two loops: in the common scenario, where
 	 * device names are stored in ROM (and are referenced by the user
 	 * with CONFIG_* macros), only cheap pointer comparisons will be
@@ -9,16 +9,16 @@
 #include <zephyr/kernel.h>
 #include <zephyr/kernel/thread_stack.h>
 #include <zephyr/logging/log.h>
-#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/sys/kobject.h>
 #include <zephyr/internal/syscall_handler.h>
 
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
 #if CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0
-#define BA_SIZE CONFIG_DYNAMIC_THREAD_POOL_SIZE
+#define POOL_SIZE CONFIG_DYNAMIC_THREAD_POOL_SIZE
 #else
-#define BA_SIZE 1
+#define POOL_SIZE 1
 #endif
 
 struct dyn_cb_data {
@@ -28,7 +28,15 @@ struct dyn_cb_data {
 
 static K_THREAD_STACK_ARRAY_DEFINE(dynamic_stack, CONFIG_DYNAMIC_THREAD_POOL_SIZE,
 				   CONFIG_DYNAMIC_THREAD_STACK_SIZE);
-SYS_BITARRAY_DEFINE_STATIC(dynamic_ba, BA_SIZE);
+
+/* Indexes of the freed pool stacks, the last freed one being reused first */
+static uint16_t dynamic_free[POOL_SIZE];
+static size_t dynamic_free_count;
+/* Pool stacks never allocated so far */
+static size_t dynamic_unused_offset;
+static struct k_spinlock dynamic_lock;
+/* Pool stacks currently allocated */
+static ATOMIC_DEFINE(dynamic_used, POOL_SIZE);
 
 static k_thread_stack_t *z_thread_stack_alloc_dyn(size_t align, size_t size)
 {
@@ -37,7 +45,7 @@ static k_thread_stack_t *z_thread_stack_alloc_dyn(size_t align, size_t size)
 
 static k_thread_stack_t *z_thread_stack_alloc_pool(size_t size)
 {
-	int rv;
+	k_spinlock_key_t key;
 	size_t offset;
 	k_thread_stack_t *stack;
 
@@ -47,14 +55,24 @@ static k_thread_stack_t *z_thread_stack_alloc_pool(size_t size)
 		return NULL;
 	}
 
-	rv = sys_bitarray_alloc(&dynamic_ba, 1, &offset);
-	if (rv < 0) {
+	key = k_spin_lock(&dynamic_lock);
+
+	if (dynamic_free_count > 0) {
+		offset = dynamic_free[--dynamic_free_count];
+	} else if (dynamic_unused_offset < CONFIG_DYNAMIC_THREAD_POOL_SIZE) {
+		offset = dynamic_unused_offset++;
+	} else {
+		k_spin_unlock(&dynamic_lock, key);
 		LOG_DBG("unable to allocate stack from pool");
 		return NULL;
 	}
 
+	k_spin_unlock(&dynamic_lock, key);
+
 	__ASSERT_NO_MSG(offset < CONFIG_DYNAMIC_THREAD_POOL_SIZE);
 
+	atomic_set_bit(dynamic_used, offset);
+
 	stack = (k_thread_stack_t *)&dynamic_stack[offset];
 
 	return stack;
@@ -141,11 +159,18 @@ int z_impl_k_thread_stack_free(k_thread_stack_t *stack)
 
 	if (CONFIG_DYNAMIC_THREAD_POOL_SIZE > 0) {
 		if (IS_ARRAY_ELEMENT(dynamic_stack, stack)) {
-			if (sys_bitarray_free(&dynamic_ba, 1, ARRAY_INDEX(dynamic_stack, stack))) {
+			size_t offset = ARRAY_INDEX(dynamic_stack, stack);
+			k_spinlock_key_t key;
+
+			if (!atomic_test_and_clear_bit(dynamic_used, offset)) {
 				LOG_ERR("stack %p is not allocated!", stack);
 				return -EINVAL;
 			}
 
+			key = k_spin_lock(&dynamic_lock);
+			dynamic_free[dynamic_free_count++] = offset;
+			k_spin_unlock(&dynamic_lock, key);
+
 			return 0;
 		}
 	}
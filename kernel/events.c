@@ -43,6 +43,7 @@
 struct event_walk_data {
 	struct k_thread  *head;
 	uint32_t events;
+	uint32_t waiter_events;
 };
 
 #ifdef CONFIG_OBJ_CORE_EVENT
@@ -52,6 +53,7 @@ static struct k_obj_type obj_type_event;
 void z_impl_k_event_init(struct k_event *event)
 {
 	event->events = 0;
+	event->waiter_events = 0;
 	event->lock = (struct k_spinlock) {};
 
 	SYS_PORT_TRACING_OBJ_INIT(k_event, event);
@@ -123,6 +125,8 @@ static int event_walk_op(struct k_thread *thread, void *data)
 		thread->next_event_link = event_data->head;
 		event_data->head = thread;
 		z_abort_timeout(&thread->base.timeout);
+	} else {
+		event_data->waiter_events |= thread->events;
 	}
 
 	return 0;
@@ -135,6 +139,7 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	struct k_thread  *thread;
 	struct event_walk_data data;
 	uint32_t previous_events;
+	uint32_t new_events;
 
 	data.head = NULL;
 	key = k_spin_lock(&event->lock);
@@ -143,6 +148,7 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 					events_mask);
 
 	previous_events = event->events & events_mask;
+	new_events = events & events_mask & ~event->events;
 	events = (event->events & ~events_mask) |
 		 (events & events_mask);
 	event->events = events;
@@ -155,9 +161,19 @@ static uint32_t k_event_post_internal(struct k_event *event, uint32_t events,
 	 * 1. Walk the waitq and create a linked list of threads to unpend.
 	 * 2. Unpend each of the threads in the linked list
 	 * 3. Ready each of the threads in the linked list
+	 *
+	 * The wait conditions of the waiting threads were not met by the
+	 * events before this post, and removing events can't meet them, so
+	 * the walk is only needed when some events that a thread may wait
+	 * for have just been added. The walk also refreshes the events that
+	 * the remaining threads wait for.
 	 */
 
-	z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
+	if ((new_events & event->waiter_events) != 0U) {
+		data.waiter_events = 0;
+		z_sched_waitq_walk(&event->wait_q, event_walk_op, &data);
+		event->waiter_events = data.waiter_events;
+	}
 
 	if (data.head != NULL) {
 		thread = data.head;
@@ -287,6 +303,7 @@ static uint32_t k_event_wait_internal(struct k_event *event, uint32_t events,
 
 	thread->events = events;
 	thread->event_options = options;
+	event->waiter_events |= events;
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_event, wait, event, events,
 					   options, timeout);
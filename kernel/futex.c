@@ -62,6 +62,24 @@ static inline int z_vrfy_k_futex_wake(struct k_futex *futex, bool wake_all)
 }
 #include <syscalls/k_futex_wake_mrsh.c>
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+/* Spin for a while, the futex holder may be about to change the value */
+static bool futex_spin(struct k_futex *futex, int expected)
+{
+	uint32_t start = k_cycle_get_32();
+
+	while ((k_cycle_get_32() - start) < CONFIG_ADAPTIVE_SPIN_CYCLES) {
+		if (atomic_get(&futex->val) != (atomic_val_t)expected) {
+			return true;
+		}
+
+		arch_spin_relax();
+	}
+
+	return false;
+}
+#endif
+
 int z_impl_k_futex_wait(struct k_futex *futex, int expected,
 			k_timeout_t timeout)
 {
@@ -78,6 +96,12 @@ int z_impl_k_futex_wait(struct k_futex *futex, int expected,
 		return -EAGAIN;
 	}
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+	if (!K_TIMEOUT_EQ(timeout, K_NO_WAIT) && futex_spin(futex, expected)) {
+		return -EAGAIN;
+	}
+#endif
+
 	key = k_spin_lock(&futex_data->lock);
 
 	ret = z_pend_curr(&futex_data->lock,
@@ -308,6 +308,29 @@ int z_kernel_stats_raw(struct k_obj_core *obj_core, void *stats);
 int z_kernel_stats_query(struct k_obj_core *obj_core, void *stats);
 #endif
 
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+/* Statistics descriptor shared by object types using struct k_wait_stats */
+extern struct k_obj_core_stats_desc z_wait_stats_desc;
+
+/**
+ * Clear the wait time statistics of an object and register them with its
+ * object core.
+ *
+ * @param obj_core Object core of the kernel object.
+ * @param stats Wait time statistics of the kernel object.
+ */
+void z_wait_stats_register(struct k_obj_core *obj_core,
+			   struct k_wait_stats *stats);
+
+/**
+ * Account a wait on a kernel object, from the thread which waited.
+ *
+ * @param obj_core Object core of the kernel object.
+ * @param start Value of k_cycle_get_32() when the thread started waiting.
+ */
+void z_wait_stats_record(struct k_obj_core *obj_core, uint32_t start);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
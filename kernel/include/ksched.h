@@ -38,6 +38,9 @@ BUILD_ASSERT(K_LOWEST_APPLICATION_THREAD_PRIO
 #define Z_ASSERT_VALID_PRIO(prio, entry_point) __ASSERT((prio) == -1, "")
 #endif
 
+/* Bitmask of all CPUs, for use with arch_sched_directed_ipi() */
+#define IPI_ALL_CPUS_MASK BIT_MASK(CONFIG_MP_MAX_NUM_CPUS)
+
 void z_sched_init(void);
 void z_move_thread_to_end_of_prio_q(struct k_thread *thread);
 int z_is_thread_time_slicing(struct k_thread *thread);
@@ -125,6 +128,22 @@ static inline bool z_is_thread_ready(struct k_thread *thread)
 		 z_is_thread_timeout_active(thread));
 }
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+/* Only a hint, the thread may start or stop running at any time */
+static inline bool z_is_thread_running(struct k_thread *thread)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (_kernel.cpus[i].current == thread) {
+			return true;
+		}
+	}
+
+	return false;
+}
+#endif
+
 static inline bool z_has_thread_started(struct k_thread *thread)
 {
 	return (thread->base.thread_state & _THREAD_PRESTART) == 0U;
@@ -10,6 +10,7 @@
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/barrier.h>
 #include <kernel_arch_func.h>
+#include <zephyr/profiling/region.h>
 
 #ifdef CONFIG_STACK_SENTINEL
 extern void z_check_stack_sentinel(void);
@@ -28,6 +29,8 @@ extern struct k_spinlock sched_spinlock;
  */
 void z_smp_release_global_lock(struct k_thread *thread);
 
+PROFILING_PROBE_DECLARE(z_swap);
+
 /* context switching and scheduling-related routines */
 #ifdef CONFIG_USE_SWITCH
 
@@ -81,6 +84,8 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 	ARG_UNUSED(lock);
 	struct k_thread *new_thread, *old_thread;
 
+	PROFILING_PROBE_START(z_swap);
+
 #ifdef CONFIG_SPIN_VALIDATE
 	/* Make sure the key acts to unmask interrupts, if it doesn't,
 	 * then we are context switching out of a nested lock
@@ -163,9 +168,14 @@ static ALWAYS_INLINE unsigned int do_swap(unsigned int key,
 			new_thread->switch_handle = NULL;
 			barrier_dmem_fence_full(); /* write barrier */
 		}
+		/* Measure the scheduling decision, not the time the old
+		 * thread spends switched out.
+		 */
+		PROFILING_PROBE_END(z_swap);
 		k_spin_release(&sched_spinlock);
 		arch_switch(newsh, &old_thread->switch_handle);
 	} else {
+		PROFILING_PROBE_END(z_swap);
 		k_spin_release(&sched_spinlock);
 	}
 
@@ -250,6 +260,9 @@ static inline void z_dummy_thread_init(struct k_thread *dummy_thread)
 #ifdef CONFIG_USERSPACE
 	dummy_thread->mem_domain_info.mem_domain = &k_mem_domain_default;
 #endif
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+	dummy_thread->obj_cache.gen = 0U;
+#endif
 #if (CONFIG_HEAP_MEM_POOL_SIZE > 0)
 	k_thread_system_pool_assign(dummy_thread);
 #else
@@ -254,6 +254,239 @@ extern volatile uintptr_t __stack_chk_guard;
 __pinned_bss
 bool z_sys_post_kernel;
 
+#ifdef CONFIG_INIT_TIME_REPORT
+/* Every entry is written when it runs, no need to clear them at boot. */
+static __noinit uint32_t init_cycles[CONFIG_INIT_TIME_REPORT_MAX_ENTRIES];
+
+static struct {
+	const char *name;
+	uint32_t usec;
+} init_milestones[CONFIG_INIT_TIME_REPORT_MILESTONES];
+static size_t init_milestone_count;
+static struct k_spinlock init_milestone_lock;
+
+void sys_init_report_milestone(const char *name)
+{
+	k_spinlock_key_t key = k_spin_lock(&init_milestone_lock);
+	size_t i;
+
+	for (i = 0; i < init_milestone_count; i++) {
+		if (init_milestones[i].name == name) {
+			break;
+		}
+	}
+
+	if (i == init_milestone_count && i < ARRAY_SIZE(init_milestones)) {
+		init_milestones[i].name = name;
+		init_milestones[i].usec = k_ticks_to_us_floor32(k_uptime_ticks());
+		init_milestone_count++;
+	}
+
+	k_spin_unlock(&init_milestone_lock, key);
+}
+
+static size_t init_report_count(void)
+{
+	return MIN(__init_end - __init_EARLY_start, ARRAY_SIZE(init_cycles));
+}
+
+void sys_init_report_foreach(sys_init_report_cb_t cb, void *user_data)
+{
+	struct sys_init_report_item item = { 0 };
+	size_t count = init_report_count();
+	size_t prev = SIZE_MAX;
+	size_t next;
+
+	for (size_t i = 0; i < init_milestone_count; i++) {
+		item.milestone = init_milestones[i].name;
+		item.usec = init_milestones[i].usec;
+		cb(&item, user_data);
+	}
+
+	item.milestone = NULL;
+
+	/* Longest first, without sorting in place: each pass finds the entry
+	 * following the previous one in (duration, index) order.
+	 */
+	for (size_t n = 0; n < count; n++) {
+		next = SIZE_MAX;
+
+		for (size_t i = 0; i < count; i++) {
+			if (prev != SIZE_MAX &&
+			    (init_cycles[i] > init_cycles[prev] ||
+			     (init_cycles[i] == init_cycles[prev] && i <= prev))) {
+				continue;
+			}
+
+			if (next == SIZE_MAX || init_cycles[i] > init_cycles[next]) {
+				next = i;
+			}
+		}
+
+		item.entry = &__init_EARLY_start[next];
+		item.usec = k_cyc_to_us_floor32(init_cycles[next]);
+		cb(&item, user_data);
+		prev = next;
+	}
+}
+
+static void init_report_print(const struct sys_init_report_item *item,
+			      void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	if (item->milestone != NULL) {
+		printk("boot %s at %u us\n", item->milestone, item->usec);
+	} else if (item->entry->dev != NULL) {
+		printk("init %s: %u us\n", item->entry->dev->name, item->usec);
+	} else {
+		printk("init %p: %u us\n", (void *)item->entry->init_fn.sys,
+		       item->usec);
+	}
+}
+#endif /* CONFIG_INIT_TIME_REPORT */
+
+static void init_entry_run(const struct init_entry *entry)
+{
+	const struct device *dev = entry->dev;
+#ifdef CONFIG_INIT_TIME_REPORT
+	uint32_t start = k_cycle_get_32();
+	size_t idx = entry - __init_EARLY_start;
+#endif
+
+	if (dev != NULL) {
+		int rc = 0;
+
+		if (entry->init_fn.dev != NULL) {
+			rc = entry->init_fn.dev(dev);
+			/* Mark device initialized. If initialization
+			 * failed, record the error condition.
+			 */
+			if (rc != 0) {
+				if (rc < 0) {
+					rc = -rc;
+				}
+				if (rc > UINT8_MAX) {
+					rc = UINT8_MAX;
+				}
+				dev->state->init_res = rc;
+			}
+		}
+
+		dev->state->initialized = true;
+
+		if (rc == 0) {
+			/* Run automatic device runtime enablement */
+			(void)pm_device_runtime_auto_enable(dev);
+		}
+	} else {
+		(void)entry->init_fn.sys();
+	}
+
+#ifdef CONFIG_INIT_TIME_REPORT
+	if (idx < ARRAY_SIZE(init_cycles)) {
+		init_cycles[idx] = k_cycle_get_32() - start;
+	}
+#endif
+}
+
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+static K_THREAD_STACK_ARRAY_DEFINE(init_worker_stacks,
+				   CONFIG_DEVICE_INIT_PARALLEL_THREADS,
+				   CONFIG_DEVICE_INIT_PARALLEL_STACK_SIZE);
+static struct k_thread init_workers[CONFIG_DEVICE_INIT_PARALLEL_THREADS];
+static K_MUTEX_DEFINE(init_lock);
+static K_CONDVAR_DEFINE(init_done);
+
+/* Device entries being initialized, and the next one to start */
+static const struct init_entry *init_run_start;
+static const struct init_entry *init_run_next;
+static const struct init_entry *init_run_end;
+
+/* Check that the dependencies of a device initialized before it in the
+ * current run are done. Dependencies initialized after it cannot be
+ * waited for, their init priorities are not consistent with devicetree.
+ */
+static bool init_deps_ready(const struct init_entry *entry)
+{
+	const device_handle_t *deps;
+	const struct device *dep;
+	size_t count;
+
+	deps = device_required_handles_get(entry->dev, &count);
+
+	for (size_t i = 0; i < count; i++) {
+		dep = device_from_handle(deps[i]);
+		if ((dep == NULL) || dep->state->initialized) {
+			continue;
+		}
+
+		for (const struct init_entry *e = init_run_start; e < entry; e++) {
+			if (e->dev == dep) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/* Entries are started in order, so the earliest one waiting always has its
+ * dependencies done or in progress, and the run cannot deadlock.
+ */
+static void init_worker(void *p1, void *p2, void *p3)
+{
+	const struct init_entry *entry;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_mutex_lock(&init_lock, K_FOREVER);
+
+	while (init_run_next < init_run_end) {
+		entry = init_run_next++;
+
+		while (!init_deps_ready(entry)) {
+			k_condvar_wait(&init_done, &init_lock, K_FOREVER);
+		}
+
+		k_mutex_unlock(&init_lock);
+		init_entry_run(entry);
+		k_mutex_lock(&init_lock, K_FOREVER);
+
+		k_condvar_broadcast(&init_done);
+	}
+
+	k_mutex_unlock(&init_lock);
+}
+
+static void init_run_parallel(const struct init_entry *start,
+			      const struct init_entry *end)
+{
+	size_t workers = MIN(CONFIG_DEVICE_INIT_PARALLEL_THREADS,
+			     end - start - 1);
+
+	init_run_start = start;
+	init_run_next = start;
+	init_run_end = end;
+
+	for (size_t i = 0; i < workers; i++) {
+		k_thread_create(&init_workers[i], init_worker_stacks[i],
+				K_THREAD_STACK_SIZEOF(init_worker_stacks[i]),
+				init_worker, NULL, NULL, NULL,
+				CONFIG_MAIN_THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&init_workers[i], "init_worker");
+	}
+
+	init_worker(NULL, NULL, NULL);
+
+	for (size_t i = 0; i < workers; i++) {
+		(void)k_thread_join(&init_workers[i], K_FOREVER);
+	}
+}
+#endif /* CONFIG_DEVICE_INIT_PARALLEL */
+
 /**
  * @brief Execute all the init entry initialization functions at a given level
  *
@@ -281,37 +514,40 @@ static void z_sys_init_run_level(enum init_level level)
 	};
 	const struct init_entry *entry;
 
-	for (entry = levels[level]; entry < levels[level+1]; entry++) {
-		const struct device *dev = entry->dev;
-
-		if (dev != NULL) {
-			int rc = 0;
-
-			if (entry->init_fn.dev != NULL) {
-				rc = entry->init_fn.dev(dev);
-				/* Mark device initialized. If initialization
-				 * failed, record the error condition.
-				 */
-				if (rc != 0) {
-					if (rc < 0) {
-						rc = -rc;
-					}
-					if (rc > UINT8_MAX) {
-						rc = UINT8_MAX;
-					}
-					dev->state->init_res = rc;
-				}
-			}
+#ifdef CONFIG_INIT_TIME_REPORT
+	static const char *const level_names[] = {
+		"EARLY",
+		"PRE_KERNEL_1",
+		"PRE_KERNEL_2",
+		"POST_KERNEL",
+		"APPLICATION",
+#ifdef CONFIG_SMP
+		"SMP",
+#endif
+	};
 
-			dev->state->initialized = true;
+	sys_init_report_milestone(level_names[level]);
+#endif
 
-			if (rc == 0) {
-				/* Run automatic device runtime enablement */
-				(void)pm_device_runtime_auto_enable(dev);
+	for (entry = levels[level]; entry < levels[level+1]; entry++) {
+#ifdef CONFIG_DEVICE_INIT_PARALLEL
+		/* Consecutive devices run concurrently, SYS_INIT() entries
+		 * run alone.
+		 */
+		if ((level == INIT_LEVEL_POST_KERNEL ||
+		     level == INIT_LEVEL_APPLICATION) && (entry->dev != NULL)) {
+			const struct init_entry *end = entry;
+
+			while ((end < levels[level+1]) && (end->dev != NULL)) {
+				end++;
 			}
-		} else {
-			(void)entry->init_fn.sys();
+
+			init_run_parallel(entry, end);
+			entry = end - 1;
+			continue;
 		}
+#endif
+		init_entry_run(entry);
 	}
 }
 
@@ -371,6 +607,11 @@ static void bg_thread_main(void *unused1, void *unused2, void *unused3)
 	z_mem_manage_boot_finish();
 #endif /* CONFIG_MMU */
 
+#ifdef CONFIG_INIT_TIME_REPORT
+	sys_init_report_milestone("main");
+	sys_init_report_foreach(init_report_print, NULL);
+#endif
+
 	extern int main(void);
 
 	(void)main();
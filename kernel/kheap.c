@@ -8,14 +8,250 @@
 #include <zephyr/init.h>
 #include <zephyr/linker/linker-defs.h>
 #include <zephyr/sys/iterable_sections.h>
+#include <zephyr/sys/heap_listener.h>
+#include <zephyr/sys/math_extras.h>
+#include <string.h>
 /* private kernel APIs */
 #include <ksched.h>
 #include <wait_q.h>
 
+#ifdef CONFIG_KERNEL_HEAP_CPU_CACHE
+
+/* Per-CPU magazine cache of small blocks.
+ *
+ * Each CPU has, per heap, a stack ("magazine") of free blocks for each
+ * power-of-two size class.  Small allocations pop from and frees push
+ * to the current CPU's magazine under that CPU's cache lock only,
+ * which is never contended except by a flush.  Empty magazines are
+ * refilled, and full ones drained, by half their depth at a time
+ * under the heap lock.
+ *
+ * Lock order is cache lock, then heap lock: the heap lock must never
+ * be held while taking a cache lock.
+ *
+ * To heap listeners, blocks held in a magazine look free: a batch
+ * refill is followed by a free notification per block and a drain is
+ * preceded by an alloc notification, so that the events seen match
+ * what the heap's users actually hold.
+ */
+
+#define CACHE_MIN_SHIFT 4
+#define CACHE_CLASSES CONFIG_KERNEL_HEAP_CPU_CACHE_CLASSES
+#define CACHE_DEPTH CONFIG_KERNEL_HEAP_CPU_CACHE_DEPTH
+#define CACHE_BATCH (CACHE_DEPTH / 2)
+#define CACHE_CLASS_SIZE(c) (BIT(CACHE_MIN_SHIFT) << (c))
+#define CACHE_MAX_SIZE CACHE_CLASS_SIZE(CACHE_CLASSES - 1)
+
+BUILD_ASSERT(CACHE_DEPTH <= UINT8_MAX);
+
+/* Smallest size class holding @a bytes, or -1 if not cacheable */
+static inline int alloc_class(size_t bytes)
+{
+	if ((bytes == 0) || (bytes > CACHE_MAX_SIZE)) {
+		return -1;
+	}
+
+	if (bytes <= CACHE_CLASS_SIZE(0)) {
+		return 0;
+	}
+
+	return 32 - u32_count_leading_zeros((uint32_t)bytes - 1U) - CACHE_MIN_SHIFT;
+}
+
+/* Largest size class a block with @a usable bytes can serve, or -1 */
+static inline int free_class(size_t usable)
+{
+	if ((usable < CACHE_CLASS_SIZE(0)) || (usable >= 2 * CACHE_MAX_SIZE)) {
+		return -1;
+	}
+
+	return 31 - u32_count_leading_zeros((uint32_t)usable) - CACHE_MIN_SHIFT;
+}
+
+static inline void notify_alloc(struct k_heap *h, void *mem, size_t bytes)
+{
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(&h->heap), mem, bytes);
+#else
+	ARG_UNUSED(h);
+	ARG_UNUSED(mem);
+	ARG_UNUSED(bytes);
+#endif
+}
+
+static inline void notify_free(struct k_heap *h, void *mem, size_t bytes)
+{
+#ifdef CONFIG_SYS_HEAP_LISTENER
+	heap_listener_notify_free(HEAP_ID_FROM_POINTER(&h->heap), mem, bytes);
+#else
+	ARG_UNUSED(h);
+	ARG_UNUSED(mem);
+	ARG_UNUSED(bytes);
+#endif
+}
+
+/* Must be called with the cache lock held */
+static void cache_refill(struct k_heap *h, struct z_heap_cpu_cache *cache,
+			 int c)
+{
+	K_SPINLOCK(&h->lock) {
+		while (cache->count[c] < CACHE_BATCH) {
+			void *mem = sys_heap_alloc(&h->heap, CACHE_CLASS_SIZE(c));
+			size_t usable;
+
+			if (mem == NULL) {
+				break;
+			}
+
+			usable = sys_heap_usable_size(&h->heap, mem);
+			cache->blocks[c][cache->count[c]++] = mem;
+			cache->cached_bytes += usable;
+			notify_free(h, mem, usable);
+		}
+	}
+}
+
+/* Returns the @a n oldest (least likely to be cache-hot) blocks of
+ * class @a c to the heap.  Must be called with the cache lock held.
+ */
+static void cache_drain(struct k_heap *h, struct z_heap_cpu_cache *cache,
+			int c, int n)
+{
+	K_SPINLOCK(&h->lock) {
+		for (int i = 0; i < n; i++) {
+			void *mem = cache->blocks[c][i];
+			size_t usable = sys_heap_usable_size(&h->heap, mem);
+
+			cache->cached_bytes -= usable;
+			notify_alloc(h, mem, usable);
+			sys_heap_free(&h->heap, mem);
+		}
+	}
+
+	cache->count[c] -= n;
+	memmove(&cache->blocks[c][0], &cache->blocks[c][n],
+		cache->count[c] * sizeof(void *));
+}
+
+static void *cache_alloc(struct k_heap *h, size_t align, size_t bytes)
+{
+	int c = alloc_class(bytes);
+	void *ret = NULL;
+
+	if ((c < 0) || (align > sizeof(void *))) {
+		return NULL;
+	}
+
+	/* Lock interrupts first so we stay on the CPU whose cache we use */
+	unsigned int irq_key = arch_irq_lock();
+	struct z_heap_cpu_cache *cache = &h->cache[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+	if (cache->count[c] == 0) {
+		cache_refill(h, cache, c);
+	}
+
+	if (cache->count[c] != 0) {
+		size_t usable;
+
+		ret = cache->blocks[c][--cache->count[c]];
+		usable = sys_heap_usable_size(&h->heap, ret);
+		cache->cached_bytes -= usable;
+		notify_alloc(h, ret, usable);
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq_key);
+
+	return ret;
+}
+
+static bool cache_free(struct k_heap *h, void *mem)
+{
+	bool cached = false;
+	size_t usable;
+	int c;
+
+	if (mem == NULL) {
+		return false;
+	}
+
+	/* The header of a block we own can be read without the heap
+	 * lock: only freeing the block itself can change its size.
+	 */
+	usable = sys_heap_usable_size(&h->heap, mem);
+	c = free_class(usable);
+	if (c < 0) {
+		return false;
+	}
+
+	unsigned int irq_key = arch_irq_lock();
+	struct z_heap_cpu_cache *cache = &h->cache[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+
+	/* Waiters need the block back in the heap.  This is checked
+	 * under the cache lock, so a waiter's flush will catch any
+	 * block cached before it registered.
+	 */
+	if (atomic_get(&h->cache_waiters) == 0) {
+		if (cache->count[c] == CACHE_DEPTH) {
+			cache_drain(h, cache, c, CACHE_BATCH);
+		}
+
+		cache->blocks[c][cache->count[c]++] = mem;
+		cache->cached_bytes += usable;
+		notify_free(h, mem, usable);
+		cached = true;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq_key);
+
+	return cached;
+}
+
+static void cache_init(struct k_heap *h)
+{
+	(void)memset(h->cache, 0, sizeof(h->cache));
+	atomic_clear(&h->cache_waiters);
+}
+
+#endif /* CONFIG_KERNEL_HEAP_CPU_CACHE */
+
+void k_heap_cache_flush(struct k_heap *h)
+{
+#ifdef CONFIG_KERNEL_HEAP_CPU_CACHE
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct z_heap_cpu_cache *cache = &h->cache[i];
+
+		K_SPINLOCK(&cache->lock) {
+			for (int c = 0; c < CACHE_CLASSES; c++) {
+				if (cache->count[c] != 0) {
+					cache_drain(h, cache, c, cache->count[c]);
+				}
+			}
+		}
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&h->lock);
+
+	if (IS_ENABLED(CONFIG_MULTITHREADING) && z_unpend_all(&h->wait_q) != 0) {
+		z_reschedule(&h->lock, key);
+	} else {
+		k_spin_unlock(&h->lock, key);
+	}
+#else
+	ARG_UNUSED(h);
+#endif
+}
+
 void k_heap_init(struct k_heap *h, void *mem, size_t bytes)
 {
 	z_waitq_init(&h->wait_q);
 	sys_heap_init(&h->heap, mem, bytes);
+#ifdef CONFIG_KERNEL_HEAP_CPU_CACHE
+	cache_init(h);
+#endif
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, h);
 }
@@ -68,6 +304,17 @@ void *k_heap_aligned_alloc(struct k_heap *h, size_t align, size_t bytes,
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
 
+#ifdef CONFIG_KERNEL_HEAP_CPU_CACHE
+	bool flushed = false, waiting = false;
+
+	ret = cache_alloc(h, align, bytes);
+	if (ret != NULL) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, h, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, h, timeout, ret);
+		return ret;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&h->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_heap, aligned_alloc, h, timeout);
@@ -79,6 +326,25 @@ void *k_heap_aligned_alloc(struct k_heap *h, size_t align, size_t bytes,
 	while (ret == NULL) {
 		ret = sys_heap_aligned_alloc(&h->heap, align, bytes);
 
+#ifdef CONFIG_KERNEL_HEAP_CPU_CACHE
+		if ((ret == NULL) && !flushed) {
+			/* Retry once with the per-CPU caches returned to
+			 * the heap.  If we may wait, keep further frees
+			 * out of the caches first.
+			 */
+			flushed = true;
+			if (IS_ENABLED(CONFIG_MULTITHREADING) &&
+			    !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+				atomic_inc(&h->cache_waiters);
+				waiting = true;
+			}
+			k_spin_unlock(&h->lock, key);
+			k_heap_cache_flush(h);
+			key = k_spin_lock(&h->lock);
+			continue;
+		}
+#endif
+
 		if (!IS_ENABLED(CONFIG_MULTITHREADING) ||
 		    (ret != NULL) || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
 			break;
@@ -99,6 +365,12 @@ void *k_heap_aligned_alloc(struct k_heap *h, size_t align, size_t bytes,
 		key = k_spin_lock(&h->lock);
 	}
 
+#ifdef CONFIG_KERNEL_HEAP_CPU_CACHE
+	if (waiting) {
+		atomic_dec(&h->cache_waiters);
+	}
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_heap, aligned_alloc, h, timeout, ret);
 
 	k_spin_unlock(&h->lock, key);
@@ -118,6 +390,13 @@ void *k_heap_alloc(struct k_heap *h, size_t bytes, k_timeout_t timeout)
 
 void k_heap_free(struct k_heap *h, void *mem)
 {
+#ifdef CONFIG_KERNEL_HEAP_CPU_CACHE
+	if (cache_free(h, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, h);
+		return;
+	}
+#endif
+
 	k_spinlock_key_t key = k_spin_lock(&h->lock);
 
 	sys_heap_free(&h->heap, mem);
@@ -129,3 +408,33 @@ void k_heap_free(struct k_heap *h, void *mem)
 		k_spin_unlock(&h->lock, key);
 	}
 }
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+int k_heap_runtime_stats_get(struct k_heap *h, struct sys_memory_stats *stats)
+{
+	int ret;
+
+	if ((h == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&h->lock) {
+		ret = sys_heap_runtime_stats_get(&h->heap, stats);
+	}
+
+#ifdef CONFIG_KERNEL_HEAP_CPU_CACHE
+	/* Cached blocks are allocated from the sys_heap's point of view
+	 * but available to users.  This is a snapshot, each CPU's count
+	 * may change concurrently.
+	 */
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		size_t cached = h->cache[i].cached_bytes;
+
+		stats->allocated_bytes -= cached;
+		stats->free_bytes += cached;
+	}
+#endif
+
+	return ret;
+}
+#endif
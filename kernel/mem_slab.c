@@ -205,6 +205,52 @@ out:
 	return rc;
 }
 
+/* Takes a block off the free list, which must not be empty */
+static inline void *take_block(struct k_mem_slab *slab)
+{
+	void *mem = slab->free_list;
+
+	slab->free_list = *(char **)(slab->free_list);
+	slab->info.num_used++;
+
+	return mem;
+}
+
+/* Returns blocks to the slab, handing them to waiting threads first.
+ * Returns true if any thread was readied, in which case the caller
+ * must reschedule.
+ */
+static bool free_blocks_locked(struct k_mem_slab *slab, void **mem,
+			       uint32_t count)
+{
+	bool readied = false;
+
+	for (uint32_t i = 0; i < count; i++) {
+		__ASSERT(((char *)mem[i] >= slab->buffer) &&
+			 ((((char *)mem[i] - slab->buffer) % slab->info.block_size) == 0) &&
+			 ((char *)mem[i] <= (slab->buffer + (slab->info.block_size *
+							     (slab->info.num_blocks - 1)))),
+			 "Invalid memory pointer provided");
+
+		/* Threads only wait while the free list is empty */
+		if (slab->free_list == NULL && IS_ENABLED(CONFIG_MULTITHREADING)) {
+			struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
+
+			if (pending_thread != NULL) {
+				z_thread_return_value_set_with_data(pending_thread, 0, mem[i]);
+				z_ready_thread(pending_thread);
+				readied = true;
+				continue;
+			}
+		}
+		*(char **) mem[i] = slab->free_list;
+		slab->free_list = (char *) mem[i];
+		slab->info.num_used--;
+	}
+
+	return readied;
+}
+
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
@@ -214,9 +260,7 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 
 	if (slab->free_list != NULL) {
 		/* take a free block */
-		*mem = slab->free_list;
-		slab->free_list = *(char **)(slab->free_list);
-		slab->info.num_used++;
+		*mem = take_block(slab);
 
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 		slab->info.max_used = MAX(slab->info.num_used,
@@ -250,36 +294,89 @@ int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 	return result;
 }
 
-void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
+int k_mem_slab_alloc_n(struct k_mem_slab *slab, void **mem, uint32_t count,
+		       k_timeout_t timeout)
 {
+	k_timepoint_t end = sys_timepoint_calc(timeout);
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+	uint32_t n = 0U;
+	int result = 0;
 
-	__ASSERT(((char *)mem >= slab->buffer) &&
-		 ((((char *)mem - slab->buffer) % slab->info.block_size) == 0) &&
-		 ((char *)mem <= (slab->buffer + (slab->info.block_size *
-						  (slab->info.num_blocks - 1)))),
-		 "Invalid memory pointer provided");
-
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
-	if (slab->free_list == NULL && IS_ENABLED(CONFIG_MULTITHREADING)) {
-		struct k_thread *pending_thread = z_unpend_first_thread(&slab->wait_q);
-
-		if (pending_thread != NULL) {
-			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
-			z_thread_return_value_set_with_data(pending_thread, 0, mem);
-			z_ready_thread(pending_thread);
-			z_reschedule(&slab->lock, key);
-			return;
+	if (count > slab->info.num_blocks) {
+		result = -EINVAL;
+	} else if ((slab->info.num_blocks - slab->info.num_used < count) &&
+		   (K_TIMEOUT_EQ(timeout, K_NO_WAIT) ||
+		    !IS_ENABLED(CONFIG_MULTITHREADING))) {
+		/* don't wait for free blocks to become available */
+		result = -ENOMEM;
+	} else {
+		while (n < count) {
+			if (slab->free_list != NULL) {
+				mem[n++] = take_block(slab);
+				continue;
+			}
+
+			if (sys_timepoint_expired(end)) {
+				result = -EAGAIN;
+				break;
+			}
+
+			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mem_slab, alloc, slab, timeout);
+
+			/* wait for a block to be handed over, or timeout */
+			result = z_pend_curr(&slab->lock, key, &slab->wait_q,
+					     sys_timepoint_timeout(end));
+			key = k_spin_lock(&slab->lock);
+			if (result != 0) {
+				break;
+			}
+			mem[n++] = _current->base.swap_data;
 		}
 	}
-	*(char **) mem = slab->free_list;
-	slab->free_list = (char *) mem;
-	slab->info.num_used--;
 
-	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+	if (result == 0) {
+#ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
+		slab->info.max_used = MAX(slab->info.num_used,
+					  slab->info.max_used);
+#endif
+	} else if (n != 0U && free_blocks_locked(slab, mem, n)) {
+		/* Blocks taken so far went to other waiters */
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
+		z_reschedule(&slab->lock, key);
+		return result;
+	} else {
+		;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, result);
 
 	k_spin_unlock(&slab->lock, key);
+
+	return result;
+}
+
+void k_mem_slab_free_n(struct k_mem_slab *slab, void **mem, uint32_t count)
+{
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+
+	bool readied = free_blocks_locked(slab, mem, count);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+
+	if (readied) {
+		z_reschedule(&slab->lock, key);
+	} else {
+		k_spin_unlock(&slab->lock, key);
+	}
+}
+
+void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
+{
+	k_mem_slab_free_n(slab, &mem, 1U);
 }
 
 int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stats *stats)
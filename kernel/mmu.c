@@ -1000,6 +1000,7 @@ struct k_mem_paging_stats_t paging_stats;
 extern struct k_mem_paging_histogram_t z_paging_histogram_eviction;
 extern struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_in;
 extern struct k_mem_paging_histogram_t z_paging_histogram_backing_store_page_out;
+extern struct k_mem_paging_histogram_t z_paging_histogram_page_fault;
 #endif
 
 static inline void do_backing_store_page_in(uintptr_t location)
@@ -1373,27 +1374,118 @@ static inline struct z_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
+/* Bring the data page at addr in from page_in_location, evicting a page
+ * frame if none is free. Must be called with interrupts locked, *key is
+ * updated if they get unlocked meanwhile.
+ */
+static struct z_page_frame *page_in_locked(void *addr,
+					   uintptr_t page_in_location,
+					   struct k_thread *faulting_thread,
+					   int *key)
+{
+	struct z_page_frame *pf;
+	uintptr_t page_out_location;
+	bool dirty = false;
+	int ret;
+
+	pf = free_page_frame_list_get();
+	if (pf == NULL) {
+		/* Need to evict a page frame */
+		pf = do_eviction_select(&dirty);
+		__ASSERT(pf != NULL, "failed to get a page frame");
+		LOG_DBG("evicting %p at 0x%lx", pf->addr,
+			z_page_frame_to_phys(pf));
+
+		paging_stats_eviction_inc(faulting_thread, dirty);
+	}
+	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
+	__ASSERT(ret == 0, "failed to prepare page frame");
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	irq_unlock(*key);
+	/* Interrupts are now unlocked if they were not locked when we entered
+	 * this function, and we may service ISRs. The scheduler is still
+	 * locked.
+	 */
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	if (dirty) {
+		do_backing_store_page_out(page_out_location);
+	}
+	do_backing_store_page_in(page_in_location);
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	*key = irq_lock();
+	pf->flags &= ~Z_PAGE_FRAME_BUSY;
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	pf->flags |= Z_PAGE_FRAME_MAPPED;
+	pf->addr = UINT_TO_POINTER(POINTER_TO_UINT(addr)
+				   & ~(CONFIG_MMU_PAGE_SIZE - 1));
+
+	arch_mem_page_in(addr, z_page_frame_to_phys(pf));
+	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+
+	return pf;
+}
+
+#if CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0
+/* Read ahead the data pages following addr as long as they are paged out.
+ * Must be called with interrupts locked, *key is updated if they get
+ * unlocked meanwhile.
+ */
+static void prefetch_locked(void *addr, struct k_thread *faulting_thread,
+			    int *key)
+{
+	uint8_t *pos = UINT_TO_POINTER(POINTER_TO_UINT(addr)
+				       & ~(CONFIG_MMU_PAGE_SIZE - 1));
+	uintptr_t page_in_location;
+
+	for (int i = 0; i < CONFIG_DEMAND_PAGING_PREFETCH_PAGES; i++) {
+		pos += CONFIG_MMU_PAGE_SIZE;
+		if (pos >= Z_VIRT_RAM_END) {
+			break;
+		}
+
+		if (arch_page_location_get(pos, &page_in_location) !=
+		    ARCH_PAGE_LOCATION_PAGED_OUT) {
+			break;
+		}
+
+		(void)page_in_locked(pos, page_in_location, faulting_thread,
+				     key);
+#ifdef CONFIG_DEMAND_PAGING_STATS
+		paging_stats.prefetch.pages++;
+#endif
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+		faulting_thread->paging_stats.prefetch.pages++;
+#endif
+	}
+}
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0 */
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct z_page_frame *pf;
-	int key, ret;
-	uintptr_t page_in_location, page_out_location;
+	int key;
+	uintptr_t page_in_location;
 	enum arch_page_location status;
 	bool result;
-	bool dirty = false;
 	struct k_thread *faulting_thread = _current_cpu->current;
 
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+	uint32_t time_diff;
+
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	timing_t time_start, time_end;
+#else
+	uint32_t time_start;
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
+
 	__ASSERT(page_frames_initialized, "page fault at %p happened too early",
 		 addr);
 
 	LOG_DBG("page fault at %p", addr);
 
-	/*
-	 * TODO: Add performance accounting:
-	 * - k_mem_paging_eviction_select() metrics
-	 *   * periodic timer execution time histogram (if implemented)
-	 */
-
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
 	/* We lock the scheduler so that other threads are never scheduled
 	 * during the page-in/out operation.
@@ -1454,44 +1546,40 @@ static bool do_page_fault(void *addr, bool pin)
 
 	paging_stats_faults_inc(faulting_thread, key);
 
-	pf = free_page_frame_list_get();
-	if (pf == NULL) {
-		/* Need to evict a page frame */
-		pf = do_eviction_select(&dirty);
-		__ASSERT(pf != NULL, "failed to get a page frame");
-		LOG_DBG("evicting %p at 0x%lx", pf->addr,
-			z_page_frame_to_phys(pf));
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	time_start = timing_counter_get();
+#else
+	time_start = k_cycle_get_32();
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
 
-		paging_stats_eviction_inc(faulting_thread, dirty);
-	}
-	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
-	__ASSERT(ret == 0, "failed to prepare page frame");
+	pf = page_in_locked(addr, page_in_location, faulting_thread, &key);
 
-#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
-	irq_unlock(key);
-	/* Interrupts are now unlocked if they were not locked when we entered
-	 * this function, and we may service ISRs. The scheduler is still
-	 * locked.
+#if CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0
+	/* The faulting page has not been accessed yet, keep it from being
+	 * evicted to make room for the pages read ahead.
 	 */
-#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
-	if (dirty) {
-		do_backing_store_page_out(page_out_location);
+	if (!pin) {
+		pf->flags |= Z_PAGE_FRAME_PINNED;
+		prefetch_locked(addr, faulting_thread, &key);
+		pf->flags &= ~Z_PAGE_FRAME_PINNED;
 	}
-	do_backing_store_page_in(page_in_location);
-
-#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
-	key = irq_lock();
-	pf->flags &= ~Z_PAGE_FRAME_BUSY;
-#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+#endif /* CONFIG_DEMAND_PAGING_PREFETCH_PAGES > 0 */
 	if (pin) {
 		pf->flags |= Z_PAGE_FRAME_PINNED;
 	}
-	pf->flags |= Z_PAGE_FRAME_MAPPED;
-	pf->addr = UINT_TO_POINTER(POINTER_TO_UINT(addr)
-				   & ~(CONFIG_MMU_PAGE_SIZE - 1));
 
-	arch_mem_page_in(addr, z_page_frame_to_phys(pf));
-	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+#ifdef CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM
+#ifdef CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS
+	time_end = timing_counter_get();
+	time_diff = (uint32_t)timing_cycles_get(&time_start, &time_end);
+#else
+	time_diff = k_cycle_get_32() - time_start;
+#endif /* CONFIG_DEMAND_PAGING_STATS_USING_TIMING_FUNCTIONS */
+
+	z_paging_histogram_inc(&z_paging_histogram_page_fault, time_diff);
+#endif /* CONFIG_DEMAND_PAGING_TIMING_HISTOGRAM */
 out:
 	irq_unlock(key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
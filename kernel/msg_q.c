@@ -56,6 +56,9 @@ void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 #ifdef CONFIG_OBJ_CORE_MSGQ
 	k_obj_core_init_and_link(K_OBJ_CORE(msgq), &obj_type_msgq);
 #endif
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+	z_wait_stats_register(K_OBJ_CORE(msgq), &msgq->wait_stats);
+#endif
 
 	SYS_PORT_TRACING_OBJ_INIT(k_msgq, msgq);
 
@@ -171,7 +174,16 @@ int z_impl_k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout
 		/* wait for put message success, failure, or timeout */
 		_current->base.swap_data = (void *) data;
 
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+		uint32_t wait_start = k_cycle_get_32();
+#endif
+
 		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+		z_wait_stats_record(K_OBJ_CORE(msgq), wait_start);
+#endif
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
 		return result;
 	}
@@ -269,7 +281,16 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 		/* wait for get message success or timeout */
 		_current->base.swap_data = data;
 
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+		uint32_t wait_start = k_cycle_get_32();
+#endif
+
 		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+		z_wait_stats_record(K_OBJ_CORE(msgq), wait_start);
+#endif
+
 		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
 		return result;
 	}
@@ -425,11 +446,17 @@ static int init_msgq_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_msgq, K_OBJ_TYPE_MSGQ_ID,
 			offsetof(struct k_msgq, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+	k_obj_type_stats_init(&obj_type_msgq, &z_wait_stats_desc);
+#endif
 
 	/* Initialize and link statically defined message queues */
 
 	STRUCT_SECTION_FOREACH(k_msgq, msgq) {
 		k_obj_core_init_and_link(K_OBJ_CORE(msgq), &obj_type_msgq);
+#ifdef CONFIG_OBJ_CORE_STATS_MSGQ
+		z_wait_stats_register(K_OBJ_CORE(msgq), &msgq->wait_stats);
+#endif
 	}
 
 	return 0;
@@ -37,6 +37,7 @@
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
 #include <zephyr/logging/log.h>
+#include <kernel_internal.h>
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
 /* We use a global spinlock here because some of the synchronization
@@ -62,6 +63,9 @@ int z_impl_k_mutex_init(struct k_mutex *mutex)
 #ifdef CONFIG_OBJ_CORE_MUTEX
 	k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
 #endif
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	z_wait_stats_register(K_OBJ_CORE(mutex), &mutex->wait_stats);
+#endif
 
 	SYS_PORT_TRACING_OBJ_INIT(k_mutex, mutex, 0);
 
@@ -100,6 +104,28 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+/*
+ * Spin unlocked while the owner runs on another CPU, it is likely to unlock
+ * the mutex shortly. Returns with the lock held again.
+ */
+static k_spinlock_key_t mutex_spin(struct k_mutex *mutex, k_spinlock_key_t key)
+{
+	struct k_thread *owner = mutex->owner;
+	uint32_t start = k_cycle_get_32();
+
+	k_spin_unlock(&lock, key);
+
+	while ((mutex->owner == owner) && z_is_thread_running(owner) &&
+	       ((k_cycle_get_32() - start) < CONFIG_ADAPTIVE_SPIN_CYCLES)) {
+		arch_spin_relax();
+		compiler_barrier();
+	}
+
+	return k_spin_lock(&lock);
+}
+#endif
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
@@ -112,6 +138,13 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+	if ((mutex->lock_count != 0U) && (mutex->owner != _current) &&
+	    !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		key = mutex_spin(mutex, key);
+	}
+#endif
+
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
@@ -151,8 +184,16 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		resched = adjust_owner_prio(mutex, new_prio);
 	}
 
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	uint32_t wait_start = k_cycle_get_32();
+#endif
+
 	int got_mutex = z_pend_curr(&lock, key, &mutex->wait_q, timeout);
 
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	z_wait_stats_record(K_OBJ_CORE(mutex), wait_start);
+#endif
+
 	LOG_DBG("on mutex %p got_mutex value: %d", mutex, got_mutex);
 
 	LOG_DBG("%p got mutex %p (y/n): %c", _current, mutex,
@@ -297,11 +338,17 @@ static int init_mutex_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_mutex, K_OBJ_TYPE_MUTEX_ID,
 			offsetof(struct k_mutex, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+	k_obj_type_stats_init(&obj_type_mutex, &z_wait_stats_desc);
+#endif
 
 	/* Initialize and link statically defined mutexs */
 
 	STRUCT_SECTION_FOREACH(k_mutex, mutex) {
 		k_obj_core_init_and_link(K_OBJ_CORE(mutex), &obj_type_mutex);
+#ifdef CONFIG_OBJ_CORE_STATS_MUTEX
+		z_wait_stats_register(K_OBJ_CORE(mutex), &mutex->wait_stats);
+#endif
 	}
 
 	return 0;
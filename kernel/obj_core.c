@@ -6,6 +6,8 @@
 
 #include <zephyr/kernel.h>
 #include <zephyr/kernel/obj_core.h>
+#include <string.h>
+#include <kernel_internal.h>
 
 static struct k_spinlock  lock;
 
@@ -325,3 +327,122 @@ int k_obj_core_stats_enable(struct k_obj_core *obj_core)
 	return rv;
 }
 #endif
+
+#ifdef CONFIG_OBJ_CORE_STATS_WAIT
+#define WAIT_PRECISION  CONFIG_OBJ_CORE_STATS_WAIT_PRECISION
+#define WAIT_SUB_MASK   (BIT(WAIT_PRECISION) - 1U)
+
+/*
+ * Wait times below 2^WAIT_PRECISION microseconds have a bucket each. Every
+ * following power of two range is split into 2^WAIT_PRECISION buckets.
+ */
+static unsigned int wait_bucket(uint32_t us)
+{
+	unsigned int exp;
+	unsigned int bucket;
+
+	if (us < BIT(WAIT_PRECISION)) {
+		return us;
+	}
+
+	exp = 31U - __builtin_clz(us);
+	bucket = ((exp - WAIT_PRECISION + 1U) << WAIT_PRECISION) +
+		 ((us >> (exp - WAIT_PRECISION)) & WAIT_SUB_MASK);
+
+	return MIN(bucket, K_WAIT_STATS_BUCKETS - 1U);
+}
+
+static uint32_t wait_bucket_lower(unsigned int bucket)
+{
+	unsigned int exp;
+
+	if (bucket < BIT(WAIT_PRECISION)) {
+		return bucket;
+	}
+
+	exp = (bucket >> WAIT_PRECISION) - 1U + WAIT_PRECISION;
+
+	return (uint32_t)(BIT(WAIT_PRECISION) | (bucket & WAIT_SUB_MASK)) <<
+	       (exp - WAIT_PRECISION);
+}
+
+static uint32_t wait_percentile(const struct k_wait_stats *stats,
+				unsigned int percent)
+{
+	/* Smallest bucket covering at least percent of all waits */
+	uint32_t rank = DIV_ROUND_UP((uint64_t)stats->count * percent, 100U);
+	uint32_t sum = 0U;
+
+	for (unsigned int i = 0U; i < K_WAIT_STATS_BUCKETS - 1U; i++) {
+		sum += stats->histogram[i];
+		if (sum >= rank) {
+			return MIN(wait_bucket_lower(i + 1U) - 1U, stats->max);
+		}
+	}
+
+	return stats->max;
+}
+
+void z_wait_stats_register(struct k_obj_core *obj_core,
+			   struct k_wait_stats *stats)
+{
+	memset(stats, 0, sizeof(*stats));
+	(void)k_obj_core_stats_register(obj_core, stats, sizeof(*stats));
+}
+
+void z_wait_stats_record(struct k_obj_core *obj_core, uint32_t start)
+{
+	uint32_t us = k_cyc_to_us_floor32(k_cycle_get_32() - start);
+	k_spinlock_key_t  key = k_spin_lock(&lock);
+	struct k_wait_stats *stats = obj_core->stats;
+
+	if (stats != NULL) {
+		stats->total += us;
+		stats->count++;
+		stats->max = MAX(stats->max, us);
+		stats->histogram[wait_bucket(us)]++;
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+/* The stats descriptor operations are called with the lock held */
+
+static int wait_stats_raw(struct k_obj_core *obj_core, void *stats)
+{
+	memcpy(stats, obj_core->stats, sizeof(struct k_wait_stats));
+
+	return 0;
+}
+
+static int wait_stats_query(struct k_obj_core *obj_core, void *stats)
+{
+	const struct k_wait_stats *raw = obj_core->stats;
+	struct k_wait_stats_query *ptr = stats;
+
+	ptr->count = raw->count;
+	ptr->average = (raw->count != 0U) ? (uint32_t)(raw->total / raw->count) : 0U;
+	ptr->p50 = wait_percentile(raw, 50U);
+	ptr->p99 = wait_percentile(raw, 99U);
+	ptr->max = raw->max;
+
+	return 0;
+}
+
+static int wait_stats_reset(struct k_obj_core *obj_core)
+{
+	memset(obj_core->stats, 0, sizeof(struct k_wait_stats));
+
+	return 0;
+}
+
+struct k_obj_core_stats_desc z_wait_stats_desc = {
+	.raw_size = sizeof(struct k_wait_stats),
+	.query_size = sizeof(struct k_wait_stats_query),
+	.raw   = wait_stats_raw,
+	.query = wait_stats_query,
+	.reset = wait_stats_reset,
+	.disable = NULL,
+	.enable = NULL,
+};
+#endif
@@ -43,6 +43,7 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 	pipe->bytes_used = 0U;
 	pipe->read_index = 0U;
 	pipe->write_index = 0U;
+	pipe->put_claimed = 0U;
 	pipe->lock = (struct k_spinlock){};
 	z_waitq_init(&pipe->wait_q.writers);
 	z_waitq_init(&pipe->wait_q.readers);
@@ -293,6 +294,16 @@ static size_t pipe_buffer_list_populate(sys_dlist_t         *list,
 	return size - start + end;
 }
 
+/**
+ * @brief Check whether data may be written to the pipe buffer
+ *
+ * The pipe buffer is not written while space is claimed in it.
+ */
+static inline bool pipe_buffer_writable(struct k_pipe *pipe)
+{
+	return (pipe->bytes_used != pipe->size) && (pipe->put_claimed == 0U);
+}
+
 /**
  * @brief Determine the correct return code
  *
@@ -415,7 +426,7 @@ int z_impl_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 						    &pipe->wait_q.readers,
 						    bytes_to_write);
 
-	if (pipe->bytes_used != pipe->size) {
+	if (pipe_buffer_writable(pipe)) {
 		bytes_can_write += pipe_buffer_list_populate(&dest_list,
 							     pipe_desc,
 							     pipe->buffer,
@@ -625,7 +636,7 @@ static int pipe_get_internal(k_spinlock_key_t key, struct k_pipe *pipe,
 		src_desc = (struct _pipe_desc *)sys_dlist_get(&src_list);
 	}
 
-	if (pipe->bytes_used != pipe->size) {
+	if (pipe_buffer_writable(pipe)) {
 		sys_dlist_t         pipe_list;
 
 		/*
@@ -736,6 +747,127 @@ int z_vrfy_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 #include <syscalls/k_pipe_get_mrsh.c>
 #endif
 
+size_t k_pipe_put_claim(struct k_pipe *pipe, void **data, size_t size)
+{
+	size_t bytes_claimed = 0U;
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	if ((size != 0U) && pipe_buffer_writable(pipe)) {
+		if (pipe->bytes_used == 0U) {
+			/* Empty: start over to claim as much as possible */
+			pipe->read_index = 0U;
+			pipe->write_index = 0U;
+		}
+
+		if (pipe->write_index < pipe->read_index) {
+			bytes_claimed = pipe->read_index - pipe->write_index;
+		} else {
+			bytes_claimed = pipe->size - pipe->write_index;
+		}
+
+		bytes_claimed = MIN(bytes_claimed, size);
+		pipe->put_claimed = bytes_claimed;
+		*data = &pipe->buffer[pipe->write_index];
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return bytes_claimed;
+}
+
+int k_pipe_put_finish(struct k_pipe *pipe, size_t size)
+{
+	struct _pipe_desc  pipe_desc[2];
+	struct _pipe_desc *src;
+	struct _pipe_desc *dest;
+	sys_dlist_t        src_list;
+	sys_dlist_t        dest_list;
+	size_t             bytes_copied;
+	bool               reschedule_needed = false;
+	k_spinlock_key_t   key = k_spin_lock(&pipe->lock);
+
+	if (size > pipe->put_claimed) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->put_claimed = 0U;
+
+	if (size == 0U) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return 0;
+	}
+
+	pipe->bytes_used += size;
+	pipe->write_index += size;
+	if (pipe->write_index >= pipe->size) {
+		pipe->write_index -= pipe->size;
+	}
+
+	/*
+	 * Hand the data over to waiting readers. Readers only wait once the
+	 * pipe buffer has been drained, so this copies the data only once.
+	 */
+
+	sys_dlist_init(&src_list);
+	sys_dlist_init(&dest_list);
+
+	(void) pipe_waiter_list_populate(&dest_list, &pipe->wait_q.readers,
+					 pipe->bytes_used);
+	(void) pipe_buffer_list_populate(&src_list, pipe_desc, pipe->buffer,
+					 pipe->size, pipe->read_index,
+					 pipe->write_index);
+
+	src = (struct _pipe_desc *)sys_dlist_get(&src_list);
+	dest = (struct _pipe_desc *)sys_dlist_get(&dest_list);
+
+	while ((src != NULL) && (dest != NULL)) {
+		bytes_copied = pipe_xfer(dest->buffer, dest->bytes_to_xfer,
+					 src->buffer, src->bytes_to_xfer);
+
+		dest->buffer        += bytes_copied;
+		dest->bytes_to_xfer -= bytes_copied;
+
+		src->buffer         += bytes_copied;
+		src->bytes_to_xfer  -= bytes_copied;
+
+		pipe->bytes_used -= bytes_copied;
+		pipe->read_index += bytes_copied;
+		if (pipe->read_index >= pipe->size) {
+			pipe->read_index -= pipe->size;
+		}
+
+		if (dest->bytes_to_xfer == 0U) {
+
+			/* The thread's read request has been satisfied. */
+
+			z_unpend_thread(dest->thread);
+			z_ready_thread(dest->thread);
+
+			reschedule_needed = true;
+			dest = (struct _pipe_desc *)sys_dlist_get(&dest_list);
+		}
+
+		if (src->bytes_to_xfer == 0U) {
+			src = (struct _pipe_desc *)sys_dlist_get(&src_list);
+		}
+	}
+
+	if (pipe->bytes_used != 0U) {
+		handle_poll_events(pipe);
+	}
+
+	if (reschedule_needed) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+
+	return 0;
+}
+
 size_t z_impl_k_pipe_read_avail(struct k_pipe *pipe)
 {
 	size_t res;
@@ -35,10 +35,13 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+#ifdef CONFIG_POLL_SET
+static int signal_set(struct k_poll_event *event, uint32_t state);
+#endif
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -109,22 +112,35 @@ static struct k_thread *poller_thread(struct z_poller *p)
 	return p ? CONTAINER_OF(p, struct k_thread, poller) : NULL;
 }
 
+static inline bool is_set_poller(struct z_poller *p)
+{
+	return IS_ENABLED(CONFIG_POLL_SET) && (p != NULL) && (p->mode == MODE_SET);
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct z_poller *poller)
 {
 	struct k_poll_event *pending;
 
+	/* Poll sets have no priority and come after all polling threads */
+	if (is_set_poller(poller)) {
+		sys_dlist_append(events, &event->_node);
+		return;
+	}
+
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
 	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+		(!is_set_poller(pending->poller) &&
+		 (z_sched_prio_cmp(poller_thread(pending->poller),
+				   poller_thread(poller)) > 0))) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if (is_set_poller(pending->poller) ||
+		    (z_sched_prio_cmp(poller_thread(poller),
+				      poller_thread(pending->poller)) > 0)) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -443,6 +459,13 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 	struct z_poller *poller = event->poller;
 	int retcode = 0;
 
+#ifdef CONFIG_POLL_SET
+	/* The event stays registered, it is not made ready here */
+	if (is_set_poller(poller)) {
+		return signal_set(event, state);
+	}
+#endif
+
 	if (poller != NULL) {
 		if (poller->mode == MODE_POLL) {
 			retcode = signal_poller(event, state);
@@ -813,3 +836,118 @@ int k_work_poll_cancel(struct k_work_poll *work)
 
 	return retval;
 }
+
+#ifdef CONFIG_POLL_SET
+/* must be called with interrupts locked */
+static void set_queue_event(struct k_poll_set *set, struct k_poll_event *event,
+			    uint32_t state)
+{
+	/* The state is reset each time the event is handed out */
+	if (sys_dnode_is_linked(&event->_set_node)) {
+		event->state |= state;
+	} else {
+		event->state = state;
+		sys_dlist_append(&set->ready, &event->_set_node);
+	}
+}
+
+/* must be called with interrupts locked */
+static int signal_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set = CONTAINER_OF(event->poller, struct k_poll_set,
+					      poller);
+
+	set_queue_event(set, event, state);
+
+	/* The object took the event off its list, put it back at the end */
+	register_event(event, event->poller);
+
+	(void)z_sched_wake(&set->wait_q, 0, NULL);
+
+	return 0;
+}
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = true;
+	set->poller.mode = MODE_SET;
+	sys_dlist_init(&set->ready);
+	z_waitq_init(&set->wait_q);
+}
+
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t state;
+
+	if (event->poller != NULL) {
+		k_spin_unlock(&lock, key);
+		return -EBUSY;
+	}
+
+	sys_dnode_init(&event->_set_node);
+	event->state = K_POLL_STATE_NOT_READY;
+
+	if (is_condition_met(event, &state)) {
+		set_queue_event(set, event, state);
+	}
+
+	register_event(event, &set->poller);
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (event->poller != &set->poller) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	clear_event_registration(event);
+
+	if (sys_dnode_is_linked(&event->_set_node)) {
+		sys_dlist_remove(&event->_set_node);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events,
+		    int max_events, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+	__ASSERT(max_events > 0, "no room for events\n");
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	sys_dnode_t *node;
+	int num_events = 0;
+
+	if (sys_dlist_is_empty(&set->ready) &&
+	    !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		(void)z_pend_curr(&lock, key, &set->wait_q, timeout);
+		key = k_spin_lock(&lock);
+	}
+
+	/* An event may also have been queued as the wait timed out */
+	while (num_events < max_events) {
+		node = sys_dlist_get(&set->ready);
+		if (node == NULL) {
+			break;
+		}
+
+		events[num_events++] = CONTAINER_OF(node, struct k_poll_event,
+						    _set_node);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return (num_events > 0) ? num_events : -EAGAIN;
+}
+#endif /* CONFIG_POLL_SET */
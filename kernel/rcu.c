@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Read-copy-update.
+ *
+ * Readers lock the scheduler, so a thread in a read-side section keeps
+ * running on its CPU until the section ends. A CPU is thus done with the
+ * sections in progress as soon as it is seen running something else than a
+ * thread with the scheduler locked, and not running an interrupt. Grace
+ * periods are detected by sampling the CPUs instead of counting context
+ * switches, leaving the scheduler paths untouched.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/kernel/rcu.h>
+#include <zephyr/sys/barrier.h>
+
+static struct k_spinlock lock;
+static sys_slist_t pending = SYS_SLIST_STATIC_INIT(&pending);
+
+#ifdef CONFIG_SMP
+/* Only a sample, both may change right after they are read */
+static bool cpu_may_read(struct _cpu *cpu)
+{
+	struct k_thread *thread = *(struct k_thread *volatile *)&cpu->current;
+
+	if (*(volatile uint32_t *)&cpu->nested != 0U) {
+		return true;
+	}
+
+	return (thread != cpu->idle_thread) &&
+	       (*(volatile uint8_t *)&thread->base.sched_locked != 0U);
+}
+#endif
+
+void k_rcu_synchronize(void)
+{
+	__ASSERT(!k_is_in_isr(), "grace periods cannot be awaited in ISRs");
+	__ASSERT(_current->base.sched_locked == 0U, "synchronizing with the scheduler locked");
+
+	/* Updates are visible before the CPUs are sampled */
+	barrier_dmem_fence_full();
+
+#ifdef CONFIG_SMP
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		struct _cpu *cpu = &_kernel.cpus[i];
+
+		/* Our own CPU runs us, outside any read-side section */
+		while ((cpu->current != k_current_get()) && cpu_may_read(cpu)) {
+			k_yield();
+		}
+	}
+
+	barrier_dmem_fence_full();
+#endif
+}
+
+static void rcu_work_handler(struct k_work *work)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	sys_slist_t done = pending;
+	struct k_rcu_head *head, *next;
+
+	ARG_UNUSED(work);
+
+	sys_slist_init(&pending);
+	k_spin_unlock(&lock, key);
+
+	k_rcu_synchronize();
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&done, head, next, node) {
+		head->func(head);
+	}
+}
+
+static K_WORK_DEFINE(rcu_work, rcu_work_handler);
+
+void k_rcu_call(struct k_rcu_head *head, k_rcu_callback_t func)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	head->func = func;
+	sys_slist_append(&pending, &head->node);
+	k_spin_unlock(&lock, key);
+
+	(void)k_work_submit(&rcu_work);
+}
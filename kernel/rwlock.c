@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Reader-writer locks.
+ *
+ * The state word holds the number of readers and two writer bits.  Readers
+ * get in and out with a compare-and-swap as long as no writer holds the lock
+ * or waits for it.  Everything else, including all writer operations, is
+ * done under the lock below.  A writer waiting for the lock sets the pending
+ * bit, which keeps new readers out, and the lock is handed over to waiting
+ * threads when released so they never need to retry.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/toolchain.h>
+#include <ksched.h>
+#include <wait_q.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <kernel_internal.h>
+
+#define RWLOCK_WRITE_LOCKED  BIT(30)
+#define RWLOCK_WRITE_PENDING BIT(29)
+#define RWLOCK_READERS_MASK  (RWLOCK_WRITE_PENDING - 1)
+
+/* Global lock, writer priorities are adjusted as for mutexes */
+static struct k_spinlock lock;
+
+void z_impl_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	atomic_clear(&rwlock->state);
+	rwlock->writer = NULL;
+	z_waitq_init(&rwlock->read_wait_q);
+	z_waitq_init(&rwlock->write_wait_q);
+
+	k_object_init(rwlock);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_rwlock_init(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ_INIT(rwlock, K_OBJ_RWLOCK));
+	z_impl_k_rwlock_init(rwlock);
+}
+#include <syscalls/k_rwlock_init_mrsh.c>
+#endif
+
+static int32_t new_prio_for_inheritance(int32_t target, int32_t limit)
+{
+	int new_prio = z_is_prio_higher(target, limit) ? target : limit;
+
+	return z_get_new_prio_with_ceiling(new_prio);
+}
+
+/* must be called with the lock held */
+static bool adjust_writer_prio(struct k_rwlock *rwlock, int32_t new_prio)
+{
+	if (rwlock->writer->base.prio != new_prio) {
+		return z_set_prio(rwlock->writer, new_prio);
+	}
+
+	return false;
+}
+
+static bool read_trylock(struct k_rwlock *rwlock)
+{
+	atomic_val_t state = atomic_get(&rwlock->state);
+
+	while ((state & (RWLOCK_WRITE_LOCKED | RWLOCK_WRITE_PENDING)) == 0) {
+		if (atomic_cas(&rwlock->state, state, state + 1)) {
+			return true;
+		}
+
+		state = atomic_get(&rwlock->state);
+	}
+
+	return false;
+}
+
+/* must be called with the lock held, the pending bit keeps readers out */
+static bool write_trylock(struct k_rwlock *rwlock)
+{
+	atomic_val_t state = atomic_get(&rwlock->state);
+
+	while ((state & (RWLOCK_WRITE_LOCKED | RWLOCK_READERS_MASK)) == 0) {
+		if (atomic_cas(&rwlock->state, state, state | RWLOCK_WRITE_LOCKED)) {
+			rwlock->writer = _current;
+			rwlock->writer_orig_prio = _current->base.prio;
+			return true;
+		}
+
+		state = atomic_get(&rwlock->state);
+	}
+
+	return false;
+}
+
+/*
+ * Hand the lock over to the first waiting writer if it is free, or to all
+ * waiting readers if no writer waits. Must be called with the lock held.
+ */
+static bool wake_locked(struct k_rwlock *rwlock)
+{
+	atomic_val_t state = atomic_get(&rwlock->state);
+	struct k_thread *thread;
+	bool woken = false;
+
+	if ((state & RWLOCK_WRITE_LOCKED) != 0) {
+		return false;
+	}
+
+	thread = z_waitq_head(&rwlock->write_wait_q);
+	if (thread != NULL) {
+		if ((state & RWLOCK_READERS_MASK) != 0) {
+			/* The last reader out will come back here */
+			return false;
+		}
+
+		/* Readers are kept out by the pending bit, nothing races */
+		z_unpend_thread(thread);
+		rwlock->writer = thread;
+		rwlock->writer_orig_prio = thread->base.prio;
+		atomic_set(&rwlock->state, RWLOCK_WRITE_LOCKED |
+			   ((z_waitq_head(&rwlock->write_wait_q) != NULL) ?
+			    RWLOCK_WRITE_PENDING : 0));
+
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+
+		return true;
+	}
+
+	(void)atomic_and(&rwlock->state, ~RWLOCK_WRITE_PENDING);
+
+	while ((thread = z_unpend_first_thread(&rwlock->read_wait_q)) != NULL) {
+		(void)atomic_inc(&rwlock->state);
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+		woken = true;
+	}
+
+	return woken;
+}
+
+int z_impl_k_rwlock_read_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	if (likely(read_trylock(rwlock))) {
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return -EBUSY;
+	}
+
+	key = k_spin_lock(&lock);
+
+	/* The writer may have gone meanwhile, it wakes readers locked */
+	if (read_trylock(rwlock)) {
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	return z_pend_curr(&lock, key, &rwlock->read_wait_q, timeout);
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_read_lock(struct k_rwlock *rwlock,
+					    k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_read_lock(rwlock, timeout);
+}
+#include <syscalls/k_rwlock_read_lock_mrsh.c>
+#endif
+
+int z_impl_k_rwlock_write_lock(struct k_rwlock *rwlock, k_timeout_t timeout)
+{
+	k_spinlock_key_t key;
+	struct k_thread *waiter;
+	int32_t new_prio;
+	bool resched = false;
+	int ret;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	key = k_spin_lock(&lock);
+
+	if (rwlock->writer == _current) {
+		k_spin_unlock(&lock, key);
+		return -EDEADLK;
+	}
+
+	if (likely(write_trylock(rwlock))) {
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		k_spin_unlock(&lock, key);
+		return -EBUSY;
+	}
+
+	/* Keep new readers out, then check the last one did not just leave */
+	(void)atomic_or(&rwlock->state, RWLOCK_WRITE_PENDING);
+
+	if (write_trylock(rwlock)) {
+		k_spin_unlock(&lock, key);
+		return 0;
+	}
+
+	if (rwlock->writer != NULL) {
+		new_prio = new_prio_for_inheritance(_current->base.prio,
+						    rwlock->writer->base.prio);
+		if (z_is_prio_higher(new_prio, rwlock->writer->base.prio)) {
+			(void)adjust_writer_prio(rwlock, new_prio);
+		}
+	}
+
+	ret = z_pend_curr(&lock, key, &rwlock->write_wait_q, timeout);
+	if (ret == 0) {
+		return 0;
+	}
+
+	/* timed out */
+
+	key = k_spin_lock(&lock);
+
+	if (rwlock->writer != NULL) {
+		waiter = z_waitq_head(&rwlock->write_wait_q);
+		new_prio = (waiter != NULL) ?
+			new_prio_for_inheritance(waiter->base.prio,
+						 rwlock->writer_orig_prio) :
+			rwlock->writer_orig_prio;
+
+		resched = adjust_writer_prio(rwlock, new_prio);
+	}
+
+	/* Readers may get in if this was the last waiting writer */
+	resched = wake_locked(rwlock) || resched;
+
+	if (resched) {
+		z_reschedule(&lock, key);
+	} else {
+		k_spin_unlock(&lock, key);
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_write_lock(struct k_rwlock *rwlock,
+					     k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_write_lock(rwlock, timeout);
+}
+#include <syscalls/k_rwlock_write_lock_mrsh.c>
+#endif
+
+int z_impl_k_rwlock_unlock(struct k_rwlock *rwlock)
+{
+	k_spinlock_key_t key;
+	atomic_val_t state;
+	bool resched;
+
+	__ASSERT(!arch_is_in_isr(), "rwlocks cannot be used inside ISRs");
+
+	if (rwlock->writer == _current) {
+		key = k_spin_lock(&lock);
+
+		resched = adjust_writer_prio(rwlock, rwlock->writer_orig_prio);
+		rwlock->writer = NULL;
+		(void)atomic_and(&rwlock->state, ~RWLOCK_WRITE_LOCKED);
+
+		if (wake_locked(rwlock) || resched) {
+			z_reschedule(&lock, key);
+		} else {
+			k_spin_unlock(&lock, key);
+		}
+
+		return 0;
+	}
+
+	do {
+		state = atomic_get(&rwlock->state);
+		if ((state & RWLOCK_READERS_MASK) == 0) {
+			return -EPERM;
+		}
+	} while (!atomic_cas(&rwlock->state, state, state - 1));
+
+	/* The last reader out lets the first waiting writer in */
+	if (((state & RWLOCK_READERS_MASK) == 1) &&
+	    ((state & RWLOCK_WRITE_PENDING) != 0)) {
+		key = k_spin_lock(&lock);
+
+		if (wake_locked(rwlock)) {
+			z_reschedule(&lock, key);
+		} else {
+			k_spin_unlock(&lock, key);
+		}
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_rwlock_unlock(struct k_rwlock *rwlock)
+{
+	K_OOPS(K_SYSCALL_OBJ(rwlock, K_OBJ_RWLOCK));
+	return z_impl_k_rwlock_unlock(rwlock);
+}
+#include <syscalls/k_rwlock_unlock_mrsh.c>
+#endif
@@ -55,6 +55,11 @@ static ALWAYS_INLINE void z_priq_mq_remove(struct _priq_mq *pq,
 #endif
 
 struct k_spinlock sched_spinlock;
+K_SPINLOCK_STATS_DEFINE(sched_spinlock, sched_spinlock);
+
+#ifdef CONFIG_USE_SWITCH
+PROFILING_PROBE_DEFINE(z_swap);
+#endif
 
 static void update_cache(int preempt_ok);
 static void end_thread(struct k_thread *thread);
@@ -279,6 +284,27 @@ static ALWAYS_INLINE void dequeue_thread(struct k_thread *thread)
 	}
 }
 
+#if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
+static void send_ipi(uint32_t cpu_bitmap)
+{
+#ifdef CONFIG_SCHED_IPI_STATS
+	/* Not _current_cpu: a migration here only misattributes the count */
+	struct _cpu *cpu = arch_curr_cpu();
+
+	cpu_bitmap &= IPI_ALL_CPUS_MASK & ~BIT(cpu->id);
+	atomic_add(&cpu->ipi_sent, IS_ENABLED(CONFIG_ARCH_HAS_DIRECTED_IPIS)
+		   ? POPCOUNT(cpu_bitmap) : arch_num_cpus() - 1);
+#endif
+
+#ifdef CONFIG_ARCH_HAS_DIRECTED_IPIS
+	arch_sched_directed_ipi(cpu_bitmap);
+#else
+	ARG_UNUSED(cpu_bitmap);
+	arch_sched_ipi();
+#endif
+}
+#endif
+
 static void signal_pending_ipi(void)
 {
 	/* Synchronization note: you might think we need to lock these
@@ -290,9 +316,11 @@ static void signal_pending_ipi(void)
 	 */
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
 	if (arch_num_cpus() > 1) {
-		if (_kernel.pending_ipi) {
-			_kernel.pending_ipi = false;
-			arch_sched_ipi();
+		uint32_t cpu_bitmap;
+
+		cpu_bitmap = (uint32_t)atomic_clear(&_kernel.pending_ipi);
+		if (cpu_bitmap != 0) {
+			send_ipi(cpu_bitmap);
 		}
 	}
 #endif
@@ -412,12 +440,55 @@ static void move_thread_to_end_of_prio_q(struct k_thread *thread)
 	update_cache(thread == _current);
 }
 
-static void flag_ipi(void)
+static void flag_ipi(uint32_t ipi_mask)
 {
 #if defined(CONFIG_SMP) && defined(CONFIG_SCHED_IPI_SUPPORTED)
 	if (arch_num_cpus() > 1) {
-		_kernel.pending_ipi = true;
+		atomic_or(&_kernel.pending_ipi, (atomic_val_t)ipi_mask);
 	}
+#else
+	ARG_UNUSED(ipi_mask);
+#endif
+}
+
+/* Returns the set of other CPUs that should reschedule now that
+ * @a thread is runnable: those that are idle or running a thread
+ * that @a thread would preempt.  Must be called with the scheduler
+ * lock held, which keeps each CPU's _current stable.  Without
+ * directed IPI support every CPU is interrupted anyway, so don't
+ * bother computing it.
+ */
+static uint32_t ipi_mask_create(struct k_thread *thread)
+{
+#if defined(CONFIG_SMP) && defined(CONFIG_ARCH_HAS_DIRECTED_IPIS)
+	uint32_t ipi_mask = 0;
+	uint32_t id = _current_cpu->id;
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (uint32_t i = 0; i < num_cpus; i++) {
+		struct k_thread *cpu_thread = _kernel.cpus[i].current;
+
+		if ((i == id) || (cpu_thread == NULL)) {
+			continue;
+		}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+		if ((thread->base.cpu_mask & BIT(i)) == 0) {
+			continue;
+		}
+#endif
+
+		if (z_is_idle_thread_object(cpu_thread) ||
+		    ((is_preempt(cpu_thread) || is_metairq(thread)) &&
+		     (z_sched_prio_cmp(thread, cpu_thread) > 0))) {
+			ipi_mask |= BIT(i);
+		}
+	}
+
+	return ipi_mask;
+#else
+	ARG_UNUSED(thread);
+	return IPI_ALL_CPUS_MASK;
 #endif
 }
 
@@ -473,11 +544,10 @@ static void slice_timeout(struct _timeout *t)
 	slice_expired[cpu] = true;
 
 	/* We need an IPI if we just handled a timeslice expiration
-	 * for a different CPU.  Ideally this would be able to target
-	 * the specific core, but that's not part of the API yet.
+	 * for a different CPU.
 	 */
 	if (IS_ENABLED(CONFIG_SMP) && cpu != _current_cpu->id) {
-		flag_ipi();
+		flag_ipi(BIT(cpu));
 	}
 }
 
@@ -595,6 +665,39 @@ static void update_cache(int preempt_ok)
 #endif
 }
 
+#ifndef CONFIG_SMP
+/* Fast path of update_cache() for a thread just added to the run queue.
+ * When _current is runnable and preemptible, the cache holding it means
+ * it is the best thread in the queue. A thread of strictly higher
+ * priority is then the next one to run, without searching the queue.
+ */
+static ALWAYS_INLINE bool handoff_cache(struct k_thread *thread)
+{
+	if (IS_ENABLED(CONFIG_SCHED_CPU_MASK) ||
+	    (_kernel.ready_q.cache != _current) ||
+	    z_is_thread_prevented_from_running(_current) ||
+	    !is_preempt(_current) ||
+	    (z_sched_prio_cmp(thread, _current) <= 0)) {
+		return false;
+	}
+
+#if (CONFIG_NUM_METAIRQ_PRIORITIES > 0) &&                                                         \
+	(CONFIG_NUM_COOP_PRIORITIES > CONFIG_NUM_METAIRQ_PRIORITIES)
+	if (_current_cpu->metairq_preempted != NULL) {
+		return false;
+	}
+#endif
+
+#ifdef CONFIG_TIMESLICING
+	z_reset_time_slice(thread);
+#endif
+	update_metairq_preempt(thread);
+	_kernel.ready_q.cache = thread;
+
+	return true;
+}
+#endif /* !CONFIG_SMP */
+
 static bool thread_active_elsewhere(struct k_thread *thread)
 {
 	/* True if the thread is currently running on another CPU.
@@ -630,8 +733,14 @@ static void ready_thread(struct k_thread *thread)
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
 		queue_thread(thread);
+#ifndef CONFIG_SMP
+		if (!handoff_cache(thread)) {
+			update_cache(0);
+		}
+#else
 		update_cache(0);
-		flag_ipi();
+#endif
+		flag_ipi(ipi_mask_create(thread));
 	}
 }
 
@@ -954,7 +1063,10 @@ void z_thread_priority_set(struct k_thread *thread, int prio)
 {
 	bool need_sched = z_set_prio(thread, prio);
 
-	flag_ipi();
+	/* The thread may also be running elsewhere with a now lower
+	 * priority, so every CPU needs to reconsider its choice
+	 */
+	flag_ipi(IPI_ALL_CPUS_MASK);
 
 	if (need_sched && _current->base.sched_locked == 0U) {
 		z_reschedule_unlocked();
@@ -1549,9 +1661,9 @@ void z_impl_k_wakeup(k_tid_t thread)
 	}
 
 	z_mark_thread_as_not_suspended(thread);
-	z_ready_thread(thread);
 
-	flag_ipi();
+	/* z_ready_thread() flags the IPI to the CPUs that need it */
+	z_ready_thread(thread);
 
 	if (!arch_is_in_isr()) {
 		z_reschedule_unlocked();
@@ -1572,6 +1684,10 @@ void z_sched_ipi(void)
 	z_trace_sched_ipi();
 #endif
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	atomic_inc(&_current_cpu->ipi_received);
+#endif
+
 #ifdef CONFIG_TIMESLICING
 	if (sliceable(_current)) {
 		z_time_slice();
@@ -1790,7 +1906,7 @@ void z_thread_abort(struct k_thread *thread)
 		 * here, not deferred!
 		 */
 #ifdef CONFIG_SCHED_IPI_SUPPORTED
-		arch_sched_ipi();
+		send_ipi(BIT(thread->base.cpu));
 #endif
 	}
 
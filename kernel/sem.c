@@ -28,6 +28,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/sys/check.h>
+#include <kernel_internal.h>
 
 /* We use a system-wide lock to synchronize semaphores, which has
  * unfortunate performance impact vs. using a per-object lock
@@ -68,6 +69,9 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 #ifdef CONFIG_OBJ_CORE_SEM
 	k_obj_core_init_and_link(K_OBJ_CORE(sem), &obj_type_sem);
 #endif
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	z_wait_stats_register(K_OBJ_CORE(sem), &sem->wait_stats);
+#endif
 
 	return 0;
 }
@@ -155,8 +159,16 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_sem, take, sem, timeout);
 
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	uint32_t wait_start = k_cycle_get_32();
+#endif
+
 	ret = z_pend_curr(&lock, key, &sem->wait_q, timeout);
 
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	z_wait_stats_record(K_OBJ_CORE(sem), wait_start);
+#endif
+
 out:
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_sem, take, sem, timeout, ret);
 
@@ -216,11 +228,17 @@ static int init_sem_obj_core_list(void)
 
 	z_obj_type_init(&obj_type_sem, K_OBJ_TYPE_SEM_ID,
 			offsetof(struct k_sem, obj_core));
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+	k_obj_type_stats_init(&obj_type_sem, &z_wait_stats_desc);
+#endif
 
 	/* Initialize and link statically defined semaphores */
 
 	STRUCT_SECTION_FOREACH(k_sem, sem) {
 		k_obj_core_init_and_link(K_OBJ_CORE(sem), &obj_type_sem);
+#ifdef CONFIG_OBJ_CORE_STATS_SEM
+		z_wait_stats_register(K_OBJ_CORE(sem), &sem->wait_stats);
+#endif
 	}
 
 	return 0;
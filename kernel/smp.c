@@ -8,6 +8,9 @@
 #include <kswap.h>
 #include <kernel_internal.h>
 
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_SMP_CPU_ALIGN) || (CONFIG_SMP_CPU_ALIGN == 0),
+	     "CONFIG_SMP_CPU_ALIGN must be a power of two");
+
 static atomic_t global_lock;
 static atomic_t cpu_start_flag;
 static atomic_t ready_flag;
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Single-producer single-consumer message queues.
+ *
+ * The producer only writes the tail index and the consumer only writes the
+ * head index, so messages are passed without a lock.  The lock and the
+ * wait queue are only used when the consumer has to wait: it announces it
+ * in the waiting flag before checking the queue a last time, and the
+ * producer checks the flag after publishing a message.  As both accesses
+ * are sequentially consistent, either the consumer sees the message or the
+ * producer sees the flag and wakes the consumer.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+
+#include <string.h>
+#include <ksched.h>
+#include <wait_q.h>
+
+void k_spsc_msgq_init(struct k_spsc_msgq *msgq, char *buffer, size_t msg_size,
+		      uint32_t max_msgs)
+{
+	/* The free running indices wrap at 2^32, a multiple of max_msgs */
+	__ASSERT(IS_POWER_OF_TWO(max_msgs), "max_msgs must be a power of 2");
+
+	*msgq = (struct k_spsc_msgq) {
+		.msg_size = msg_size,
+		.max_msgs = max_msgs,
+		.buffer = buffer,
+	};
+	z_waitq_init(&msgq->wait_q);
+}
+
+static inline char *msg_addr(struct k_spsc_msgq *msgq, uint32_t idx)
+{
+	return msgq->buffer + (idx & (msgq->max_msgs - 1U)) * msgq->msg_size;
+}
+
+int k_spsc_msgq_put(struct k_spsc_msgq *msgq, const void *data)
+{
+	uint32_t tail = (uint32_t)atomic_get(&msgq->tail);
+	k_spinlock_key_t key;
+
+	if (tail - (uint32_t)atomic_get(&msgq->head) == msgq->max_msgs) {
+		return -ENOMSG;
+	}
+
+	(void)memcpy(msg_addr(msgq, tail), data, msgq->msg_size);
+
+	/* Publish the message before looking for a waiting consumer */
+	(void)atomic_set(&msgq->tail, (atomic_val_t)(tail + 1U));
+
+	if (atomic_get(&msgq->waiting) == 0) {
+		return 0;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+	atomic_clear(&msgq->waiting);
+
+	if (z_sched_wake(&msgq->wait_q, 0, NULL)) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return 0;
+}
+
+/* Get the next message if there is one, invoked by the consumer */
+static bool msgq_get(struct k_spsc_msgq *msgq, void *data)
+{
+	uint32_t head = (uint32_t)atomic_get(&msgq->head);
+
+	if ((uint32_t)atomic_get(&msgq->tail) == head) {
+		return false;
+	}
+
+	(void)memcpy(data, msg_addr(msgq, head), msgq->msg_size);
+
+	/* Free the slot once the message is copied */
+	(void)atomic_set(&msgq->head, (atomic_val_t)(head + 1U));
+
+	return true;
+}
+
+int k_spsc_msgq_get(struct k_spsc_msgq *msgq, void *data, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	k_spinlock_key_t key;
+	int ret;
+
+	if (msgq_get(msgq, data)) {
+		return 0;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return -ENOMSG;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+	(void)atomic_set(&msgq->waiting, 1);
+
+	/* A message put before the flag was set would not wake us */
+	if (msgq_get(msgq, data)) {
+		atomic_clear(&msgq->waiting);
+		k_spin_unlock(&msgq->lock, key);
+		return 0;
+	}
+
+	ret = z_sched_wait(&msgq->lock, key, &msgq->wait_q, timeout, NULL);
+	atomic_clear(&msgq->waiting);
+
+	/* A message may also have arrived as the wait timed out */
+	if (msgq_get(msgq, data)) {
+		return 0;
+	}
+
+	return (ret == 0) ? -EAGAIN : ret;
+}
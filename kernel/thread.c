@@ -595,6 +595,9 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	k_object_init(stack);
 	new_thread->stack_obj = stack;
 	new_thread->syscall_frame = NULL;
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+	(void)memset(&new_thread->obj_cache, 0, sizeof(new_thread->obj_cache));
+#endif
 
 	/* Any given thread has access to itself */
 	k_object_access_grant(new_thread, new_thread);
@@ -942,6 +945,23 @@ bool z_spin_lock_mem_coherent(struct k_spinlock *l)
 
 #endif /* CONFIG_SPIN_VALIDATE */
 
+#ifdef CONFIG_SPIN_LOCK_STATS
+/* Named locks can't point to their statistics from a static initializer,
+ * as the lock definition does not know about them. Link them before any
+ * other CPU runs, locks taken until then are not accounted.
+ */
+static int spinlock_stats_init(void)
+{
+	STRUCT_SECTION_FOREACH(k_spinlock_stats, stats) {
+		stats->lock->stats = stats;
+	}
+
+	return 0;
+}
+
+SYS_INIT(spinlock_stats_init, PRE_KERNEL_1, 0);
+#endif /* CONFIG_SPIN_LOCK_STATS */
+
 int z_impl_k_float_disable(struct k_thread *thread)
 {
 #if defined(CONFIG_FPU) && defined(CONFIG_FPU_SHARING)
@@ -1173,6 +1193,10 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 		stats->average_cycles   += tmp_stats.average_cycles;
 #endif
 		stats->idle_cycles      += tmp_stats.idle_cycles;
+#ifdef CONFIG_SCHED_IPI_STATS
+		stats->ipi_sent         += tmp_stats.ipi_sent;
+		stats->ipi_received     += tmp_stats.ipi_received;
+#endif
 	}
 #endif
 
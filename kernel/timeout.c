@@ -14,9 +14,8 @@
 
 static uint64_t curr_tick;
 
-static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
-
 static struct k_spinlock timeout_lock;
+K_SPINLOCK_STATS_DEFINE(timeout_lock, timeout_lock);
 
 #define MAX_WAIT (IS_ENABLED(CONFIG_SYSTEM_CLOCK_SLOPPY_IDLE) \
 		  ? K_TICKS_FOREVER : INT_MAX)
@@ -36,6 +35,64 @@ static inline int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+
+/* Timeouts are kept in a red/black tree keyed on their absolute
+ * expiry tick (stored in dticks), with ties broken by insertion order
+ * so that timeouts expiring on the same tick fire in FIFO order just
+ * like with the linked list.
+ */
+static bool timeout_lessthan(struct rbnode *a, struct rbnode *b);
+
+static struct rbtree timeout_tree = {
+	.lessthan_fn = timeout_lessthan,
+};
+
+static uint64_t next_order_key = 1U;
+
+static bool timeout_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	struct _timeout *ta = CONTAINER_OF(a, struct _timeout, node);
+	struct _timeout *tb = CONTAINER_OF(b, struct _timeout, node);
+
+	if (ta->dticks != tb->dticks) {
+		return ta->dticks < tb->dticks;
+	}
+
+	return ta->order_key < tb->order_key;
+}
+
+static struct _timeout *first(void)
+{
+	struct rbnode *n = rb_get_min(&timeout_tree);
+
+	return n == NULL ? NULL : CONTAINER_OF(n, struct _timeout, node);
+}
+
+/* Ticks from curr_tick until the (first) timeout expires */
+static int64_t first_dticks(const struct _timeout *t)
+{
+	return t->dticks - (int64_t)curr_tick;
+}
+
+/* to->dticks is relative to curr_tick on entry */
+static void insert_timeout(struct _timeout *to)
+{
+	to->dticks += curr_tick;
+	to->order_key = next_order_key++;
+	rb_insert(&timeout_tree, &to->node);
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	rb_remove(&timeout_tree, &t->node);
+	t->order_key = 0U;
+}
+
+#else
+
+static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -50,6 +107,28 @@ static struct _timeout *next(struct _timeout *t)
 	return n == NULL ? NULL : CONTAINER_OF(n, struct _timeout, node);
 }
 
+static int64_t first_dticks(const struct _timeout *t)
+{
+	return t->dticks;
+}
+
+/* to->dticks is relative to curr_tick on entry */
+static void insert_timeout(struct _timeout *to)
+{
+	struct _timeout *t;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			return;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	sys_dlist_append(&timeout_list, &to->node);
+}
+
 static void remove_timeout(struct _timeout *t)
 {
 	if (next(t) != NULL) {
@@ -59,6 +138,8 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+#endif /* CONFIG_TIMEOUT_QUEUE_SCALABLE */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -87,10 +168,10 @@ static int32_t next_timeout(void)
 	int32_t ret;
 
 	if ((to == NULL) ||
-	    ((int64_t)(to->dticks - ticks_elapsed) > (int64_t)INT_MAX)) {
+	    ((first_dticks(to) - ticks_elapsed) > (int64_t)INT_MAX)) {
 		ret = MAX_WAIT;
 	} else {
-		ret = MAX(0, to->dticks - ticks_elapsed);
+		ret = MAX(0, first_dticks(to) - ticks_elapsed);
 	}
 
 	return ret;
@@ -107,12 +188,10 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 	__ASSERT_NO_MSG(arch_mem_coherent(to));
 #endif
 
-	__ASSERT(!sys_dnode_is_linked(&to->node), "");
+	__ASSERT(z_is_inactive_timeout(to), "");
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
-
 		if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
 		    Z_TICK_ABS(timeout.ticks) >= 0) {
 			k_ticks_t ticks = Z_TICK_ABS(timeout.ticks) - curr_tick;
@@ -122,18 +201,18 @@ void z_add_timeout(struct _timeout *to, _timeout_func_t fn,
 			to->dticks = timeout.ticks + 1 + elapsed();
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
+#ifdef CONFIG_TIMEOUT_SLACK
+		if (to->slack > 1U) {
+			/* Round the expiry up to a multiple of the slack so
+			 * that timeouts sharing it expire on the same tick.
+			 */
+			uint64_t expiry = curr_tick + to->dticks;
 
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
+			to->dticks += ROUND_UP(expiry, to->slack) - expiry;
 		}
+#endif
+
+		insert_timeout(to);
 
 		if (to == first()) {
 			sys_clock_set_timeout(next_timeout(), false);
@@ -146,7 +225,7 @@ int z_abort_timeout(struct _timeout *to)
 	int ret = -EINVAL;
 
 	K_SPINLOCK(&timeout_lock) {
-		if (sys_dnode_is_linked(&to->node)) {
+		if (!z_is_inactive_timeout(to)) {
 			remove_timeout(to);
 			ret = 0;
 		}
@@ -164,12 +243,16 @@ static k_ticks_t timeout_rem(const struct _timeout *timeout)
 		return 0;
 	}
 
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+	ticks = timeout->dticks - (int64_t)curr_tick;
+#else
 	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
 		ticks += t->dticks;
 		if (timeout == t) {
 			break;
 		}
 	}
+#endif
 
 	return ticks - elapsed();
 }
@@ -227,12 +310,14 @@ void sys_clock_announce(int32_t ticks)
 	struct _timeout *t;
 
 	for (t = first();
-	     (t != NULL) && (t->dticks <= announce_remaining);
+	     (t != NULL) && (first_dticks(t) <= announce_remaining);
 	     t = first()) {
-		int dt = t->dticks;
+		int dt = first_dticks(t);
 
 		curr_tick += dt;
+#ifndef CONFIG_TIMEOUT_QUEUE_SCALABLE
 		t->dticks = 0;
+#endif
 		remove_timeout(t);
 
 		k_spin_unlock(&timeout_lock, key);
@@ -241,9 +326,11 @@ void sys_clock_announce(int32_t ticks)
 		announce_remaining -= dt;
 	}
 
+#ifndef CONFIG_TIMEOUT_QUEUE_SCALABLE
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
+#endif
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
@@ -329,6 +416,16 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_SCALABLE
+	struct _timeout *t;
+
+	/* Keep pending timeouts relative to the new tick as the delta
+	 * list does; a uniform shift preserves the tree order.
+	 */
+	RB_FOR_EACH_CONTAINER(&timeout_tree, t, node) {
+		t->dticks += (int64_t)(tick - curr_tick);
+	}
+#endif
 	curr_tick = tick;
 }
 
@@ -43,7 +43,7 @@ void z_timer_expiration_handler(struct _timeout *t)
 	 * was restarted, its expiration handler should not be executed then,
 	 * so the function exits immediately.
 	 */
-	if (sys_dnode_is_linked(&t->node)) {
+	if (!z_is_inactive_timeout(t)) {
 		k_spin_unlock(&lock, key);
 		return;
 	}
@@ -342,6 +342,17 @@ static inline void z_vrfy_k_timer_user_data_set(struct k_timer *timer,
 }
 #include <syscalls/k_timer_user_data_set_mrsh.c>
 
+#ifdef CONFIG_TIMEOUT_SLACK
+static inline void z_vrfy_k_timer_slack_set(struct k_timer *timer,
+					    k_timeout_t slack)
+{
+	K_OOPS(K_SYSCALL_OBJ(timer, K_OBJ_TIMER));
+	K_OOPS(K_SYSCALL_VERIFY(!K_TIMEOUT_EQ(slack, K_FOREVER)));
+	z_impl_k_timer_slack_set(timer, slack);
+}
+#include <syscalls/k_timer_slack_set_mrsh.c>
+#endif
+
 #endif
 
 #ifdef CONFIG_OBJ_CORE_TIMER
@@ -166,6 +166,11 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 
 	stats->execution_cycles = stats->total_cycles + stats->idle_cycles;
 
+#ifdef CONFIG_SCHED_IPI_STATS
+	stats->ipi_sent = atomic_get(&_kernel.cpus[cpu_id].ipi_sent);
+	stats->ipi_received = atomic_get(&_kernel.cpus[cpu_id].ipi_received);
+#endif
+
 	k_spin_unlock(&usage_lock, key);
 }
 #endif
@@ -219,6 +224,10 @@ void z_sched_thread_usage(struct k_thread *thread,
 
 #ifdef CONFIG_SCHED_THREAD_USAGE_ALL
 	stats->idle_cycles = 0;
+#endif
+#ifdef CONFIG_SCHED_IPI_STATS
+	stats->ipi_sent = 0;
+	stats->ipi_received = 0;
 #endif
 	stats->execution_cycles = thread->base.usage.total;
 
@@ -38,6 +38,47 @@ K_APPMEM_PARTITION_DEFINE(k_mbedtls_partition);
 #include <zephyr/logging/log.h>
 LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
 
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+/* Changed whenever an object is freed, which empties all caches. The
+ * permissions and flags of the objects are checked on each use, so the
+ * caches only need to forget objects that are gone.
+ */
+static atomic_t obj_cache_gen = ATOMIC_INIT(1);
+
+static inline void obj_cache_invalidate(void)
+{
+	(void)atomic_inc(&obj_cache_gen);
+}
+
+/* Only the thread itself uses its cache, interrupts leave it alone */
+static struct _thread_obj_cache *obj_cache_get(void)
+{
+	struct _thread_obj_cache *cache;
+	uint32_t gen = (uint32_t)atomic_get(&obj_cache_gen);
+
+	if (k_is_in_isr() || (_current == NULL)) {
+		return NULL;
+	}
+
+	cache = &_current->obj_cache;
+	if (cache->gen != gen) {
+		(void)memset(cache, 0, sizeof(*cache));
+		cache->gen = gen;
+	}
+
+	return cache;
+}
+
+static inline unsigned int obj_cache_slot(const void *obj)
+{
+	return ((uintptr_t)obj / sizeof(void *)) % CONFIG_USERSPACE_OBJ_CACHE_SIZE;
+}
+#else
+static inline void obj_cache_invalidate(void)
+{
+}
+#endif /* CONFIG_USERSPACE_OBJ_CACHE */
+
 /* The originally synchronization strategy made heavy use of recursive
  * irq_locking, which ports poorly to spinlocks which are
  * non-recursive.  Rather than try to redesign as part of
@@ -470,6 +511,7 @@ void k_object_free(void *obj)
 	k_spin_unlock(&objfree_lock, key);
 
 	if (dyn != NULL) {
+		obj_cache_invalidate();
 		k_free(dyn->data);
 		k_free(dyn);
 	}
@@ -479,6 +521,15 @@ struct k_object *k_object_find(const void *obj)
 {
 	struct k_object *ret;
 
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+	struct _thread_obj_cache *cache = obj_cache_get();
+	unsigned int slot = obj_cache_slot(obj);
+
+	if ((cache != NULL) && (obj != NULL) && (cache->addr[slot] == obj)) {
+		return cache->ko[slot];
+	}
+#endif
+
 	ret = z_object_gperf_find(obj);
 
 	if (ret == NULL) {
@@ -494,6 +545,13 @@ struct k_object *k_object_find(const void *obj)
 		}
 	}
 
+#ifdef CONFIG_USERSPACE_OBJ_CACHE
+	if ((cache != NULL) && (ret != NULL)) {
+		cache->addr[slot] = obj;
+		cache->ko[slot] = ret;
+	}
+#endif
+
 	return ret;
 }
 
@@ -572,6 +630,7 @@ static void unref_check(struct k_object *ko, uintptr_t index)
 	}
 
 	sys_dlist_remove(&dyn->dobj_list);
+	obj_cache_invalidate();
 	k_free(dyn->data);
 	k_free(dyn);
 out:
@@ -184,6 +184,9 @@ static void queue_flusher_locked(struct k_work_q *queue,
 	}
 
 	init_flusher(flusher);
+#ifdef CONFIG_WORKQUEUE_POOL
+	flusher->target = work;
+#endif
 	if (in_list) {
 		sys_slist_insert(&queue->pending, &work->node,
 				 &flusher->work.node);
@@ -229,6 +232,33 @@ static inline bool notify_queue_locked(struct k_work_q *queue)
 	return rv;
 }
 
+/* Check whether the current thread is a thread of a queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue to check
+ *
+ * @return true if and only if the current thread animates @p queue.
+ */
+static inline bool queue_is_current_locked(struct k_work_q *queue)
+{
+	if (_current == &queue->thread) {
+		return true;
+	}
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	struct k_work_q_worker *worker;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (_current == &worker->thread) {
+			return true;
+		}
+	}
+#endif
+
+	return false;
+}
+
 /* Submit an work item to a queue if queue state allows new work.
  *
  * Submission is rejected if no queue is provided, or if the queue is
@@ -256,7 +286,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret = -EBUSY;
-	bool chained = (_current == &queue->thread) && !k_is_in_isr();
+	bool chained = queue_is_current_locked(queue) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -593,6 +623,96 @@ bool k_work_cancel_sync(struct k_work *work,
 	return pending;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+/* Check whether a pending work item can be given to a queue thread.
+ *
+ * An item resubmitted while it is running, and a flusher for an item that
+ * is running, have to wait until the running handler returns: the former
+ * must not run concurrently with itself and the latter would complete the
+ * flush too early.
+ *
+ * Invoked with work lock held.
+ *
+ * @param work a work item on the pending list of a queue
+ */
+static inline bool work_runnable_locked(struct k_work *work)
+{
+	if (work->handler == handle_flush) {
+		work = CONTAINER_OF(work, struct z_work_flusher, work)->target;
+	}
+
+	return !flag_test(&work->flags, K_WORK_RUNNING_BIT);
+}
+
+/* Remove the first pending work item that can run from a queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue to get work from
+ *
+ * @return the work item, or null if none can run.
+ */
+static struct k_work *queue_get_locked(struct k_work_q *queue)
+{
+	struct k_work *work;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->pending, work, node) {
+		if (work_runnable_locked(work)) {
+			sys_slist_remove(&queue->pending, prev, &work->node);
+			return work;
+		}
+
+		prev = &work->node;
+	}
+
+	return NULL;
+}
+
+/* Account for a queue thread starting or completing a work item.
+ *
+ * The queue is busy as long as any of its threads runs an item.
+ *
+ * Invoked with work lock held.
+ */
+static inline void queue_busy_set_locked(struct k_work_q *queue)
+{
+	queue->busy++;
+	flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+}
+
+static inline void queue_busy_clear_locked(struct k_work_q *queue)
+{
+	if (--queue->busy == 0U) {
+		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+	}
+
+	/* Items that had to wait for this one may be runnable now, let
+	 * another thread of the queue pick them up.
+	 */
+	if (!sys_slist_is_empty(&queue->pending)) {
+		(void)notify_queue_locked(queue);
+	}
+}
+#else
+static inline struct k_work *queue_get_locked(struct k_work_q *queue)
+{
+	sys_snode_t *node = sys_slist_get(&queue->pending);
+
+	return (node != NULL) ? CONTAINER_OF(node, struct k_work, node) : NULL;
+}
+
+static inline void queue_busy_set_locked(struct k_work_q *queue)
+{
+	flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+}
+
+static inline void queue_busy_clear_locked(struct k_work_q *queue)
+{
+	flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
@@ -605,38 +725,25 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 	struct k_work_q *queue = (struct k_work_q *)workq_ptr;
 
 	while (true) {
-		sys_snode_t *node;
-		struct k_work *work = NULL;
+		struct k_work *work;
 		k_work_handler_t handler = NULL;
 		k_spinlock_key_t key = k_spin_lock(&lock);
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
-		if (node != NULL) {
+		work = queue_get_locked(queue);
+		if (work != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
-			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
-			work = CONTAINER_OF(node, struct k_work, node);
+			queue_busy_set_locked(queue);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
-
-			/* Static code analysis tool can raise a false-positive violation
-			 * in the line below that 'work' is checked for null after being
-			 * dereferenced.
-			 *
-			 * The work is figured out by CONTAINER_OF, as a container
-			 * of type struct k_work that contains the node.
-			 * The only way for it to be NULL is if node would be a member
-			 * of struct k_work object that has been placed at address NULL,
-			 * which should never happen, even line 'if (work != NULL)'
-			 * ensures that.
-			 * This means that if node is not NULL, then work will not be NULL.
-			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
-					       K_WORK_QUEUE_DRAIN_BIT)) {
+		} else if (!flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT)
+			   && sys_slist_is_empty(&queue->pending)
+			   && flag_test_and_clear(&queue->flags,
+						  K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
 			 * immediate reschedule; released threads get their
@@ -683,7 +790,7 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
-		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		queue_busy_clear_locked(queue);
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -723,6 +830,10 @@ void k_work_queue_start(struct k_work_q *queue,
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#ifdef CONFIG_WORKQUEUE_POOL
+	sys_slist_init(&queue->workers);
+	queue->busy = 0U;
+#endif
 
 	if ((cfg != NULL) && cfg->no_yield) {
 		flags |= K_WORK_QUEUE_NO_YIELD;
@@ -747,6 +858,67 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+int k_work_queue_add_worker(struct k_work_q *queue,
+			    struct k_work_q_worker *worker,
+			    k_thread_stack_t *stack,
+			    size_t stack_size,
+			    int prio,
+			    int cpu)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(worker);
+	__ASSERT_NO_MSG(stack);
+
+	const char *name;
+	k_spinlock_key_t key;
+	k_tid_t tid;
+
+	if (cpu >= 0) {
+		if (!IS_ENABLED(CONFIG_SCHED_CPU_MASK)) {
+			return -ENOTSUP;
+		}
+
+		if (cpu >= arch_num_cpus()) {
+			return -EINVAL;
+		}
+	}
+
+	key = k_spin_lock(&lock);
+	if (!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT)) {
+		k_spin_unlock(&lock, key);
+		return -ENODEV;
+	}
+	k_spin_unlock(&lock, key);
+
+	tid = k_thread_create(&worker->thread, stack, stack_size,
+			      work_queue_main, queue, NULL, NULL,
+			      prio, 0, K_FOREVER);
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	if (cpu >= 0) {
+		(void)k_thread_cpu_pin(tid, cpu);
+	}
+#endif
+
+	name = k_thread_name_get(&queue->thread);
+	if (name != NULL) {
+		(void)k_thread_name_set(tid, name);
+	}
+
+	/* Registered before it runs so that submissions from the worker
+	 * are recognized as chained.
+	 */
+	key = k_spin_lock(&lock);
+	sys_slist_append(&queue->workers, &worker->node);
+	k_spin_unlock(&lock, key);
+
+	k_thread_start(tid);
+
+	return 0;
+}
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -830,6 +1002,134 @@ static void work_timeout(struct _timeout *to)
 	k_spin_unlock(&lock, key);
 }
 
+#ifdef CONFIG_WORK_DELAYABLE_SLACK
+
+/* Delayable work scheduled with slack, sorted by end of slack window. */
+static sys_dlist_t slack_list = SYS_DLIST_STATIC_INIT(&slack_list);
+
+/* Timeout shared by all the work in slack_list. */
+static struct _timeout slack_timeout;
+
+static void slack_timeout_handler(struct _timeout *to);
+
+/* Arm the slack timeout for the first end of slack window.
+ *
+ * Invoked with work lock held.
+ *
+ * @param now current tick
+ */
+static void slack_arm_locked(k_ticks_t now)
+{
+	struct k_work_delayable *dw;
+
+	(void)z_abort_timeout(&slack_timeout);
+
+	dw = SYS_DLIST_PEEK_HEAD_CONTAINER(&slack_list, dw, slack_node);
+	if (dw != NULL) {
+		/* A relative timeout expires one tick after its ticks */
+		z_add_timeout(&slack_timeout, slack_timeout_handler,
+			      K_TICKS(MAX(dw->slack_end - now - 1, 0)));
+	}
+}
+
+/* Timeout handler for delayable work scheduled with slack.
+ *
+ * Submits all the work whose delay has expired, whether or not its slack
+ * window ends now.
+ *
+ * Invoked by timeout infrastructure.
+ * Takes and releases work lock.
+ * Conditionally reschedules.
+ */
+static void slack_timeout_handler(struct _timeout *to)
+{
+	ARG_UNUSED(to);
+
+	struct k_work_delayable *dw, *tmp;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_ticks_t now = sys_clock_tick_get();
+
+	SYS_DLIST_FOR_EACH_CONTAINER_SAFE(&slack_list, dw, tmp, slack_node) {
+		if (dw->slack_start > now) {
+			continue;
+		}
+
+		sys_dlist_remove(&dw->slack_node);
+
+		if (flag_test_and_clear(&dw->work.flags, K_WORK_DELAYED_BIT)) {
+			struct k_work_q *queue = dw->queue;
+
+			(void)submit_to_queue_locked(&dw->work, &queue);
+		}
+	}
+
+	slack_arm_locked(now);
+
+	k_spin_unlock(&lock, key);
+}
+
+/* Add delayable work to the work sharing the slack timeout.
+ *
+ * Invoked with work lock held.
+ *
+ * @param dwork the delayed work structure
+ * @param delay the delay to use before scheduling, not K_NO_WAIT or
+ * K_FOREVER
+ * @param slack the time the submission may be deferred by
+ */
+static void slack_add_locked(struct k_work_delayable *dwork,
+			     k_timeout_t delay,
+			     k_timeout_t slack)
+{
+	struct k_work_delayable *dw;
+	k_ticks_t now = sys_clock_tick_get();
+
+	__ASSERT_NO_MSG(!K_TIMEOUT_EQ(slack, K_FOREVER));
+
+	if (IS_ENABLED(CONFIG_TIMEOUT_64BIT) &&
+	    (Z_TICK_ABS(delay.ticks) >= 0)) {
+		dwork->slack_start = Z_TICK_ABS(delay.ticks);
+	} else {
+		/* Same rounding as a relative kernel timeout */
+		dwork->slack_start = now + delay.ticks + 1;
+	}
+	dwork->slack_end = dwork->slack_start + slack.ticks;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&slack_list, dw, slack_node) {
+		if (dw->slack_end > dwork->slack_end) {
+			sys_dlist_insert(&dw->slack_node, &dwork->slack_node);
+			break;
+		}
+	}
+
+	if (!sys_dnode_is_linked(&dwork->slack_node)) {
+		sys_dlist_append(&slack_list, &dwork->slack_node);
+	}
+
+	if (sys_dlist_peek_head(&slack_list) == &dwork->slack_node) {
+		slack_arm_locked(now);
+	}
+}
+
+/* Remove delayable work from the work sharing the slack timeout.
+ *
+ * Invoked with work lock held.
+ *
+ * @param dwork the delayed work structure, in slack_list
+ */
+static void slack_remove_locked(struct k_work_delayable *dwork)
+{
+	bool first = sys_dlist_peek_head(&slack_list) == &dwork->slack_node;
+
+	sys_dlist_remove(&dwork->slack_node);
+
+	if (first) {
+		slack_arm_locked(sys_clock_tick_get());
+	}
+}
+
+#endif /* CONFIG_WORK_DELAYABLE_SLACK */
+
 void k_work_init_delayable(struct k_work_delayable *dwork,
 			    k_work_handler_t handler)
 {
@@ -847,6 +1147,17 @@ void k_work_init_delayable(struct k_work_delayable *dwork,
 	SYS_PORT_TRACING_OBJ_INIT(k_work_delayable, dwork);
 }
 
+#ifdef CONFIG_TIMEOUT_SLACK
+void k_work_delayable_slack_set(struct k_work_delayable *dwork,
+				k_timeout_t slack)
+{
+	__ASSERT_NO_MSG(dwork != NULL);
+	__ASSERT_NO_MSG(!K_TIMEOUT_EQ(slack, K_FOREVER));
+
+	dwork->timeout.slack = (uint32_t)slack.ticks;
+}
+#endif
+
 static inline int work_delayable_busy_get_locked(const struct k_work_delayable *dwork)
 {
 	return flags_get(&dwork->work.flags) & K_WORK_MASK;
@@ -927,6 +1238,12 @@ static inline bool unschedule_locked(struct k_work_delayable *dwork)
 	 * false.
 	 */
 	if (flag_test_and_clear(&work->flags, K_WORK_DELAYED_BIT)) {
+#ifdef CONFIG_WORK_DELAYABLE_SLACK
+		if (sys_dnode_is_linked(&dwork->slack_node)) {
+			slack_remove_locked(dwork);
+			return true;
+		}
+#endif
 		ret = z_abort_timeout(&dwork->timeout) == 0;
 	}
 
@@ -987,6 +1304,46 @@ int k_work_schedule(struct k_work_delayable *dwork,
 	return ret;
 }
 
+#ifdef CONFIG_WORK_DELAYABLE_SLACK
+int k_work_schedule_for_queue_slack(struct k_work_q *queue,
+				    struct k_work_delayable *dwork,
+				    k_timeout_t delay,
+				    k_timeout_t slack)
+{
+	__ASSERT_NO_MSG(dwork != NULL);
+
+	struct k_work *work = &dwork->work;
+	int ret = 0;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	/* Schedule the work item if it's idle or running. */
+	if ((work_busy_get_locked(work) & ~K_WORK_RUNNING) != 0U) {
+		/* Already scheduled or submitted, do nothing. */
+	} else if (K_TIMEOUT_EQ(delay, K_NO_WAIT)
+		   || K_TIMEOUT_EQ(delay, K_FOREVER)
+		   || K_TIMEOUT_EQ(slack, K_NO_WAIT)) {
+		ret = schedule_for_queue_locked(&queue, dwork, delay);
+	} else {
+		flag_set(&work->flags, K_WORK_DELAYED_BIT);
+		dwork->queue = queue;
+		slack_add_locked(dwork, delay, slack);
+		ret = 1;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+int k_work_schedule_slack(struct k_work_delayable *dwork,
+			  k_timeout_t delay,
+			  k_timeout_t slack)
+{
+	return k_work_schedule_for_queue_slack(&k_sys_work_q, dwork,
+					       delay, slack);
+}
+#endif /* CONFIG_WORK_DELAYABLE_SLACK */
+
 int k_work_reschedule_for_queue(struct k_work_q *queue,
 				 struct k_work_delayable *dwork,
 				 k_timeout_t delay)
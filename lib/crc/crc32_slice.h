@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Table driven CRC-32 for reflected polynomials, processing 4 or 8 bytes
+ * per step. table[0] is the usual byte table and table[n] gives the CRC of
+ * a byte followed by n zero bytes, so the CRCs of the bytes of a word can be
+ * looked up independently and combined.
+ */
+
+#ifndef ZEPHYR_LIB_CRC_CRC32_SLICE_H_
+#define ZEPHYR_LIB_CRC_CRC32_SLICE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/byteorder.h>
+
+#if defined(CONFIG_CRC32_SLICE_BY_8)
+#define CRC32_SLICES 8
+#else
+#define CRC32_SLICES 4
+#endif
+
+static inline uint32_t crc32_slice_update(const uint32_t table[CRC32_SLICES][256],
+					  uint32_t crc, const uint8_t *data, size_t len)
+{
+	while (len >= CRC32_SLICES) {
+		uint32_t word = crc ^ sys_get_le32(data);
+
+#if CRC32_SLICES > 4
+		uint32_t next = sys_get_le32(data + 4);
+
+		crc = table[7][word & 0xff] ^ table[6][(word >> 8) & 0xff] ^
+		      table[5][(word >> 16) & 0xff] ^ table[4][word >> 24] ^
+		      table[3][next & 0xff] ^ table[2][(next >> 8) & 0xff] ^
+		      table[1][(next >> 16) & 0xff] ^ table[0][next >> 24];
+#else
+		crc = table[3][word & 0xff] ^ table[2][(word >> 8) & 0xff] ^
+		      table[1][(word >> 16) & 0xff] ^ table[0][word >> 24];
+#endif
+
+		data += CRC32_SLICES;
+		len -= CRC32_SLICES;
+	}
+
+	while (len-- > 0) {
+		crc = (crc >> 8) ^ table[0][(crc ^ *data++) & 0xff];
+	}
+
+	return crc;
+}
+
+#endif /* ZEPHYR_LIB_CRC_CRC32_SLICE_H_ */
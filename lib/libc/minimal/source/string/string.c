@@ -226,6 +226,31 @@ int memcmp(const void *m1, const void *m2, size_t n)
 		return 0;
 	}
 
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	const uintptr_t mask = sizeof(mem_word_t) - 1;
+
+	/* skip equal words if both areas have the same alignment, the
+	 * bytes of the first differing word are compared below
+	 */
+
+	if ((((uintptr_t)c1 ^ (uintptr_t)c2) & mask) == 0) {
+		while ((((uintptr_t)c1) & mask) && (n > 1) && (*c1 == *c2)) {
+			c1++;
+			c2++;
+			n--;
+		}
+
+		if ((((uintptr_t)c1) & mask) == 0) {
+			while ((n > sizeof(mem_word_t)) &&
+			       (*(const mem_word_t *)c1 == *(const mem_word_t *)c2)) {
+				c1 += sizeof(mem_word_t);
+				c2 += sizeof(mem_word_t);
+				n -= sizeof(mem_word_t);
+			}
+		}
+	}
+#endif
+
 	while ((--n > 0) && (*c1 == *c2)) {
 		c1++;
 		c2++;
@@ -278,38 +303,60 @@ void *memmove(void *d, const void *s, size_t n)
 
 void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 {
-	/* attempt word-sized copying only if buffers have identical alignment */
-
 	unsigned char *d_byte = (unsigned char *)d;
 	const unsigned char *s_byte = (const unsigned char *)s;
 
 #if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
 	const uintptr_t mask = sizeof(mem_word_t) - 1;
 
-	if ((((uintptr_t)d ^ (uintptr_t)s_byte) & mask) == 0) {
+	if (n >= 2 * sizeof(mem_word_t)) {
 
-		/* do byte-sized copying until word-aligned or finished */
+		/* do byte-sized copying until the destination is word-aligned */
 
 		while (((uintptr_t)d_byte) & mask) {
-			if (n == 0) {
-				return d;
-			}
 			*(d_byte++) = *(s_byte++);
 			n--;
 		}
 
-		/* do word-sized copying as long as possible */
-
 		mem_word_t *d_word = (mem_word_t *)d_byte;
-		const mem_word_t *s_word = (const mem_word_t *)s_byte;
 
-		while (n >= sizeof(mem_word_t)) {
-			*(d_word++) = *(s_word++);
-			n -= sizeof(mem_word_t);
+		if ((((uintptr_t)s_byte) & mask) == 0) {
+			const mem_word_t *s_word = (const mem_word_t *)s_byte;
+
+			/* do word-sized copying, four words at a time for
+			 * the compiler to use multiple load/store instructions
+			 */
+
+			while (n >= 4 * sizeof(mem_word_t)) {
+				d_word[0] = s_word[0];
+				d_word[1] = s_word[1];
+				d_word[2] = s_word[2];
+				d_word[3] = s_word[3];
+				d_word += 4;
+				s_word += 4;
+				n -= 4 * sizeof(mem_word_t);
+			}
+
+			while (n >= sizeof(mem_word_t)) {
+				*(d_word++) = *(s_word++);
+				n -= sizeof(mem_word_t);
+			}
+
+			s_byte = (const unsigned char *)s_word;
+		} else {
+			/* the source is misaligned: do word-sized stores from
+			 * unaligned loads, a single instruction on CPUs that
+			 * support them and byte loads elsewhere
+			 */
+
+			while (n >= sizeof(mem_word_t)) {
+				*(d_word++) = UNALIGNED_GET((const mem_word_t *)s_byte);
+				s_byte += sizeof(mem_word_t);
+				n -= sizeof(mem_word_t);
+			}
 		}
 
 		d_byte = (unsigned char *)d_word;
-		s_byte = (unsigned char *)s_word;
 	}
 #endif
 
@@ -357,6 +404,15 @@ void *memset(void *buf, int c, size_t n)
 	c_word |= c_word << 32;
 #endif
 
+	while (n >= 4 * sizeof(mem_word_t)) {
+		d_word[0] = c_word;
+		d_word[1] = c_word;
+		d_word[2] = c_word;
+		d_word[3] = c_word;
+		d_word += 4;
+		n -= 4 * sizeof(mem_word_t);
+	}
+
 	while (n >= sizeof(mem_word_t)) {
 		*(d_word++) = c_word;
 		n -= sizeof(mem_word_t);
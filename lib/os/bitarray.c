@@ -381,15 +381,122 @@ out:
 	return ret;
 }
 
+/*
+ * Find the first bit from @p bit which is set if @p set is true, or clear
+ * otherwise, looking at whole bundles. Returns @p limit if there is none
+ * before it.
+ */
+static size_t find_next_bit(sys_bitarray_t *bitarray, size_t bit, size_t limit,
+			    bool set)
+{
+	size_t idx = bit / bundle_bitness(bitarray);
+	uint32_t bundle;
+
+	if (bit >= limit) {
+		return limit;
+	}
+
+	bundle = set ? bitarray->bundles[idx] : ~bitarray->bundles[idx];
+	bundle &= ~(BIT(bit % bundle_bitness(bitarray)) - 1);
+
+	while (bundle == 0U) {
+		idx++;
+		if ((idx * bundle_bitness(bitarray)) >= limit) {
+			return limit;
+		}
+
+		bundle = set ? bitarray->bundles[idx] : ~bitarray->bundles[idx];
+	}
+
+	return MIN(idx * bundle_bitness(bitarray) + find_lsb_set(bundle) - 1, limit);
+}
+
+/*
+ * Find the first run of at least @p num_bits clear bits from @p bit, for a
+ * run no longer than a bundle. The bundle and the next one are looked at
+ * as a whole: the bits where such a run starts are found by and-ing the
+ * clear bits with themselves shifted, doubling the shift each time.
+ */
+static bool find_short_clear_region(sys_bitarray_t *bitarray, size_t bit,
+				    size_t num_bits, size_t *offset)
+{
+	size_t bitness = bundle_bitness(bitarray);
+	uint64_t clear;
+	uint32_t starts;
+	size_t run;
+
+	for (size_t idx = bit / bitness; idx * bitness < bitarray->num_bits; idx++) {
+		if (~bitarray->bundles[idx] == 0U) {
+			continue;
+		}
+
+		clear = ~(uint64_t)bitarray->bundles[idx] & BIT64_MASK(32);
+		if ((idx + 1) < bitarray->num_bundles) {
+			clear |= (uint64_t)~bitarray->bundles[idx + 1] << 32;
+		}
+
+		/* Bits past the end of the array are not clear */
+		if ((bitarray->num_bits - idx * bitness) < 64) {
+			clear &= BIT64_MASK(bitarray->num_bits - idx * bitness);
+		}
+
+		if (idx * bitness < bit) {
+			clear &= ~BIT64_MASK(bit - idx * bitness);
+		}
+
+		for (run = 1; run * 2 <= num_bits; run *= 2) {
+			clear &= clear >> run;
+		}
+		clear &= clear >> (num_bits - run);
+
+		starts = (uint32_t)clear;
+		if (starts != 0U) {
+			*offset = idx * bitness + find_lsb_set(starts) - 1;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Find the first run of at least @p num_bits clear bits from @p bit. Runs
+ * of set and clear bits are skipped over a bundle at a time, so each
+ * bundle is looked at once whatever the fragmentation.
+ */
+static bool find_clear_region(sys_bitarray_t *bitarray, size_t bit,
+			      size_t num_bits, size_t *offset)
+{
+	size_t end;
+
+	if (num_bits <= bundle_bitness(bitarray)) {
+		return find_short_clear_region(bitarray, bit, num_bits, offset);
+	}
+
+	while (bit + num_bits <= bitarray->num_bits) {
+		bit = find_next_bit(bitarray, bit, bitarray->num_bits, false);
+		if (bit + num_bits > bitarray->num_bits) {
+			break;
+		}
+
+		end = find_next_bit(bitarray, bit, bit + num_bits, true);
+		if (end == bit + num_bits) {
+			*offset = bit;
+			return true;
+		}
+
+		/* Too short, continue after the set bit ending it */
+		bit = end + 1;
+	}
+
+	return false;
+}
+
 int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		       size_t *offset)
 {
 	k_spinlock_key_t key;
-	uint32_t bit_idx;
 	int ret;
-	struct bundle_data bd;
-	size_t off_start, off_end;
-	size_t mismatch;
 
 	__ASSERT_NO_MSG(bitarray != NULL);
 	__ASSERT_NO_MSG(bitarray->num_bits > 0);
@@ -406,46 +513,59 @@ int sys_bitarray_alloc(sys_bitarray_t *bitarray, size_t num_bits,
 		goto out;
 	}
 
-	bit_idx = 0;
+	if (find_clear_region(bitarray, 0, num_bits, offset)) {
+		set_region(bitarray, *offset, num_bits, true, NULL);
+		ret = 0;
+	} else {
+		ret = -ENOSPC;
+	}
 
-	/* Find the first non-allocated bit by looking at bundles
-	 * instead of individual bits.
-	 *
-	 * On RISC-V 64-bit, it complains about undefined reference to `ffs`.
-	 * So don't use this on RISCV64.
-	 */
-	for (size_t idx = 0; idx < bitarray->num_bundles; idx++) {
-		if (~bitarray->bundles[idx] == 0U) {
-			/* bundle is all 1s => all allocated, skip */
-			bit_idx += bundle_bitness(bitarray);
-			continue;
-		}
+out:
+	k_spin_unlock(&bitarray->lock, key);
+	return ret;
+}
 
-		if (bitarray->bundles[idx] != 0U) {
-			/* Find the first free bit in bundle if not all free */
-			off_start = find_lsb_set(~bitarray->bundles[idx]) - 1;
-			bit_idx += off_start;
-		}
+int sys_bitarray_alloc_multi(sys_bitarray_t *bitarray, size_t num_bits,
+			     size_t count, size_t *offsets)
+{
+	k_spinlock_key_t key;
+	size_t bit = 0;
+	size_t i;
+	int ret;
+
+	__ASSERT_NO_MSG(bitarray != NULL);
+	__ASSERT_NO_MSG(bitarray->num_bits > 0);
+
+	key = k_spin_lock(&bitarray->lock);
 
-		break;
+	CHECKIF((offsets == NULL) && (count > 0)) {
+		ret = -EINVAL;
+		goto out;
 	}
 
-	off_end = bitarray->num_bits - num_bits;
-	ret = -ENOSPC;
-	while (bit_idx <= off_end) {
-		if (match_region(bitarray, bit_idx, num_bits, false,
-				 &bd, &mismatch)) {
-			set_region(bitarray, bit_idx, num_bits, true, &bd);
+	if ((num_bits == 0) || (num_bits > bitarray->num_bits)) {
+		ret = -EINVAL;
+		goto out;
+	}
 
-			*offset = bit_idx;
-			ret = 0;
+	/* Nothing before a region found can fit, start after it each time */
+	for (i = 0; i < count; i++) {
+		if (!find_clear_region(bitarray, bit, num_bits, &offsets[i])) {
 			break;
 		}
 
-		/* Fast-forward to the bit just after
-		 * the mismatched bit.
-		 */
-		bit_idx = mismatch + 1;
+		set_region(bitarray, offsets[i], num_bits, true, NULL);
+		bit = offsets[i] + num_bits;
+	}
+
+	if (i < count) {
+		while (i-- > 0) {
+			set_region(bitarray, offsets[i], num_bits, false, NULL);
+		}
+
+		ret = -ENOSPC;
+	} else {
+		ret = 0;
 	}
 
 out:
@@ -490,6 +610,53 @@ out:
 	return ret;
 }
 
+int sys_bitarray_free_multi(sys_bitarray_t *bitarray, size_t num_bits,
+			    size_t count, const size_t *offsets)
+{
+	k_spinlock_key_t key;
+	struct bundle_data bd;
+	size_t i;
+	int ret = 0;
+
+	__ASSERT_NO_MSG(bitarray != NULL);
+	__ASSERT_NO_MSG(bitarray->num_bits > 0);
+
+	key = k_spin_lock(&bitarray->lock);
+
+	CHECKIF((offsets == NULL) && (count > 0)) {
+		ret = -EINVAL;
+		goto out;
+	}
+
+	for (i = 0; i < count; i++) {
+		if ((num_bits == 0)
+		    || (num_bits > bitarray->num_bits)
+		    || (offsets[i] >= bitarray->num_bits)
+		    || (offsets[i] + num_bits - 1 >= bitarray->num_bits)) {
+			ret = -EINVAL;
+			break;
+		}
+
+		if (!match_region(bitarray, offsets[i], num_bits, true, &bd, NULL)) {
+			ret = -EFAULT;
+			break;
+		}
+
+		set_region(bitarray, offsets[i], num_bits, false, &bd);
+	}
+
+	if (ret != 0) {
+		/* Regions freed so far were all allocated, allocate them again */
+		while (i-- > 0) {
+			set_region(bitarray, offsets[i], num_bits, true, NULL);
+		}
+	}
+
+out:
+	k_spin_unlock(&bitarray->lock, key);
+	return ret;
+}
+
 static bool is_region_set_clear(sys_bitarray_t *bitarray, size_t num_bits,
 				size_t offset, bool to_set)
 {
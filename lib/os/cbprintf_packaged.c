@@ -878,7 +878,7 @@ static bool is_fmt_spec(char c)
 /* Function checks if nth argument is a pointer (%p). Returns true is yes. Returns
  * false if not or if string does not have nth argument.
  */
-bool is_ptr(const char *fmt, int n)
+static bool is_ptr(const char *fmt, int n)
 {
 	char c;
 	bool mod = false;
@@ -905,6 +905,49 @@ bool is_ptr(const char *fmt, int n)
 	return false;
 }
 
+/* Function returns a mask of the first 32 arguments which are pointers (%p), so
+ * that the format string is scanned once for all string candidates.
+ */
+static uint32_t ptr_args_mask(const char *fmt)
+{
+	char c;
+	bool mod = false;
+	uint32_t mask = 0;
+	int cnt = 0;
+
+	while (((c = *fmt++) != '\0') && (cnt < 32)) {
+		if (mod && is_fmt_spec(c)) {
+			if (c == 'p') {
+				mask |= BIT(cnt);
+			}
+			cnt++;
+			mod = false;
+		}
+		if (c == '%') {
+			mod = !mod;
+		}
+	}
+
+	return mask;
+}
+
+/* Function checks if nth argument is a pointer, using the mask of pointer arguments
+ * which is computed on the first call.
+ */
+static bool is_ptr_arg(const char *fmt, int n, uint32_t *mask, bool *mask_valid)
+{
+	if (n >= 32) {
+		return is_ptr(fmt, n);
+	}
+
+	if (!*mask_valid) {
+		*mask = ptr_args_mask(fmt);
+		*mask_valid = true;
+	}
+
+	return (*mask & BIT(n)) != 0;
+}
+
 int cbprintf_package_convert(void *in_packaged,
 			     size_t in_len,
 			     cbprintf_convert_cb cb,
@@ -919,6 +962,8 @@ int cbprintf_package_convert(void *in_packaged,
 	uint32_t *buf32 = in_packaged;
 	unsigned int args_size, ros_nbr, rws_nbr;
 	bool fmt_present = flags & CBPRINTF_PACKAGE_CONVERT_PTR_CHECK ? true : false;
+	uint32_t ptr_mask = 0;
+	bool ptr_mask_valid = false;
 	bool rw_cpy;
 	bool ro_cpy;
 	struct cbprintf_package_desc *in_desc = in_packaged;
@@ -1000,7 +1045,8 @@ int cbprintf_package_convert(void *in_packaged,
 			int len;
 
 			if (IS_ENABLED(CONFIG_CBPRINTF_CONVERT_CHECK_PTR) &&
-			    fmt_present && is_ptr(fmt, arg_idx)) {
+			    fmt_present &&
+			    is_ptr_arg(fmt, arg_idx, &ptr_mask, &ptr_mask_valid)) {
 				LOG_WRN("(unsigned) char * used for %%p argument. "
 					"It's recommended to cast it to void * because "
 					"it may cause misbehavior in certain "
@@ -1079,7 +1125,8 @@ calculate_string_length:
 		bool is_ro = ptr_in_rodata(str);
 
 		if (IS_ENABLED(CONFIG_CBPRINTF_CONVERT_CHECK_PTR) &&
-		    fmt_present && is_ptr(fmt, arg_idx)) {
+		    fmt_present &&
+		    is_ptr_arg(fmt, arg_idx, &ptr_mask, &ptr_mask_valid)) {
 			continue;
 		}
 
@@ -342,6 +342,10 @@ int close(int fd)
 		return -1;
 	}
 
+	if (IS_ENABLED(CONFIG_NET_SOCKETS_EPOLL)) {
+		z_epoll_fd_close(fd);
+	}
+
 	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
 
 	res = fdtable[fd].vtable->close(fdtable[fd].obj);
@@ -52,22 +52,35 @@ static bool valid_chunk(struct z_heap *h, chunkid_t c)
  * and see that they match.  Probably should unify the design a
  * bit...
  */
-static inline void check_nexts(struct z_heap *h, int bidx)
+static inline void check_nexts(struct z_heap *h, int list)
 {
-	struct z_heap_bucket *b = &h->buckets[bidx];
+	chunkid_t next = free_list_first(h, list);
 
-	bool emptybit = (h->avail_buckets & BIT(bidx)) == 0;
-	bool emptylist = b->next == 0;
+	bool emptybit = !free_list_avail(h, list);
+	bool emptylist = next == 0;
 	bool empties_match = emptybit == emptylist;
 
 	(void)empties_match;
 	CHECK(empties_match);
 
-	if (b->next != 0) {
-		CHECK(valid_chunk(h, b->next));
+	if (next != 0) {
+		CHECK(valid_chunk(h, next));
 	}
 }
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* The first level bit must be set iff any second level bit is */
+static bool valid_bucket_masks(struct z_heap *h)
+{
+	for (int b = 0; b <= bucket_idx(h, h->end_chunk); b++) {
+		bool avail = (h->avail_buckets & BIT(b)) != 0U;
+
+		VALIDATE(avail == (h->buckets[b].sl_avail != 0U));
+	}
+	return true;
+}
+#endif
+
 static void get_alloc_info(struct z_heap *h, size_t *alloc_bytes,
 			   size_t *free_bytes)
 {
@@ -120,12 +133,18 @@ bool sys_heap_validate(struct sys_heap *heap)
 	}
 #endif
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+	if (!valid_bucket_masks(h)) {
+		return false;
+	}
+#endif
+
 	/* Check the free lists: entry count should match, empty bit
 	 * should be correct, and all chunk entries should point into
 	 * valid unused chunks.  Mark those chunks USED, temporarily.
 	 */
-	for (int b = 0; b <= bucket_idx(h, h->end_chunk); b++) {
-		chunkid_t c0 = h->buckets[b].next;
+	for (int b = 0; b < nb_free_lists(h); b++) {
+		chunkid_t c0 = free_list_first(h, b);
 		uint32_t n = 0;
 
 		check_nexts(h, b);
@@ -138,14 +157,14 @@ bool sys_heap_validate(struct sys_heap *heap)
 			set_chunk_used(h, c, true);
 		}
 
-		bool empty = (h->avail_buckets & BIT(b)) == 0;
+		bool empty = !free_list_avail(h, b);
 		bool zero = n == 0;
 
 		if (empty != zero) {
 			return false;
 		}
 
-		if (empty && h->buckets[b].next != 0) {
+		if (empty && free_list_first(h, b) != 0) {
 			return false;
 		}
 	}
@@ -176,8 +195,8 @@ bool sys_heap_validate(struct sys_heap *heap)
 	 * pass caught all the blocks and that they now show UNUSED.
 	 * Mark them USED.
 	 */
-	for (int b = 0; b <= bucket_idx(h, h->end_chunk); b++) {
-		chunkid_t c0 = h->buckets[b].next;
+	for (int b = 0; b < nb_free_lists(h); b++) {
+		chunkid_t c0 = free_list_first(h, b);
 		int n = 0;
 
 		if (c0 == 0) {
@@ -360,21 +379,24 @@ void heap_print_info(struct z_heap *h, bool dump_chunks)
 	       "             threshold       chunks      (units)      (bytes)\n"
 	       "  -----------------------------------------------------------\n");
 	for (i = 0; i < nb_buckets; i++) {
-		chunkid_t first = h->buckets[i].next;
 		chunksz_t largest = 0;
 		int count = 0;
 
-		if (first) {
-			chunkid_t curr = first;
-			do {
-				count++;
-				largest = MAX(largest, chunk_size(h, curr));
-				curr = next_free_chunk(h, curr);
-			} while (curr != first);
+		for (int l = i * SL_COUNT; l < (i + 1) * SL_COUNT; l++) {
+			chunkid_t first = free_list_first(h, l);
+
+			if (first) {
+				chunkid_t curr = first;
+				do {
+					count++;
+					largest = MAX(largest, chunk_size(h, curr));
+					curr = next_free_chunk(h, curr);
+				} while (curr != first);
+			}
 		}
 		if (count) {
 			printk("%9d %12d %12d %12d %12zd\n",
-			       i, (1 << i) - 1 + min_chunk_size(h), count,
+			       i, bucket_min_size(h, i), count,
 			       largest, chunksz_to_bytes(h, largest));
 		}
 	}
@@ -427,6 +449,43 @@ int sys_heap_runtime_stats_get(struct sys_heap *heap,
 	return 0;
 }
 
+int sys_heap_fragmentation_stats_get(struct sys_heap *heap,
+		struct sys_heap_fragmentation_stats *stats)
+{
+	if ((heap == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	struct z_heap *h = heap->heap;
+	chunksz_t largest = 0;
+
+	*stats = (struct sys_heap_fragmentation_stats) {0};
+
+	for (int l = 0; l < nb_free_lists(h); l++) {
+		chunkid_t first = free_list_first(h, l);
+		chunkid_t c = first;
+
+		if (first == 0) {
+			continue;
+		}
+
+		do {
+			chunksz_t sz = chunk_size(h, c);
+
+			stats->free_chunks++;
+			stats->histogram[31 - __builtin_clz(sz)]++;
+			largest = MAX(largest, sz);
+			c = next_free_chunk(h, c);
+		} while (c != first);
+	}
+
+	if (largest != 0) {
+		stats->largest_free_bytes = chunksz_to_bytes(h, largest);
+	}
+
+	return 0;
+}
+
 int sys_heap_runtime_stats_reset_max(struct sys_heap *heap)
 {
 	if (heap == NULL) {
@@ -31,6 +31,89 @@ static void *chunk_mem(struct z_heap *h, chunkid_t c)
 	return ret;
 }
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+
+static void free_list_remove_idx(struct z_heap *h, chunkid_t c, int bidx,
+				 int sl)
+{
+	struct z_heap_bucket *b = &h->buckets[bidx];
+
+	CHECK(!chunk_used(h, c));
+	CHECK(b->next[sl] != 0);
+	CHECK(b->sl_avail & BIT(sl));
+	CHECK(h->avail_buckets & BIT(bidx));
+
+	if (next_free_chunk(h, c) == c) {
+		/* this is the last chunk */
+		b->sl_avail &= ~BIT(sl);
+		b->next[sl] = 0;
+		if (b->sl_avail == 0U) {
+			h->avail_buckets &= ~BIT(bidx);
+		}
+	} else {
+		chunkid_t first = prev_free_chunk(h, c),
+			  second = next_free_chunk(h, c);
+
+		b->next[sl] = second;
+		set_next_free_chunk(h, first, second);
+		set_prev_free_chunk(h, second, first);
+	}
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes -= chunksz_to_bytes(h, chunk_size(h, c));
+#endif
+}
+
+static void free_list_remove(struct z_heap *h, chunkid_t c)
+{
+	if (!solo_free_header(h, c)) {
+		chunksz_t sz = chunk_size(h, c);
+		int bidx = bucket_idx(h, sz);
+
+		free_list_remove_idx(h, c, bidx, sl_idx(h, sz, bidx));
+	}
+}
+
+static void free_list_add(struct z_heap *h, chunkid_t c)
+{
+	if (solo_free_header(h, c)) {
+		return;
+	}
+
+	chunksz_t sz = chunk_size(h, c);
+	int bidx = bucket_idx(h, sz);
+	int sl = sl_idx(h, sz, bidx);
+	struct z_heap_bucket *b = &h->buckets[bidx];
+
+	if (b->next[sl] == 0U) {
+		CHECK((b->sl_avail & BIT(sl)) == 0);
+
+		/* Empty list, first item */
+		b->sl_avail |= BIT(sl);
+		h->avail_buckets |= BIT(bidx);
+		b->next[sl] = c;
+		set_prev_free_chunk(h, c, c);
+		set_next_free_chunk(h, c, c);
+	} else {
+		CHECK(b->sl_avail & BIT(sl));
+
+		/* Insert before (!) the "next" pointer */
+		chunkid_t second = b->next[sl];
+		chunkid_t first = prev_free_chunk(h, second);
+
+		set_prev_free_chunk(h, c, first);
+		set_next_free_chunk(h, c, second);
+		set_next_free_chunk(h, first, c);
+		set_prev_free_chunk(h, second, c);
+	}
+
+#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+	h->free_bytes += chunksz_to_bytes(h, sz);
+#endif
+}
+
+#else /* CONFIG_SYS_HEAP_TLSF */
+
 static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
 {
 	struct z_heap_bucket *b = &h->buckets[bidx];
@@ -103,6 +186,8 @@ static void free_list_add(struct z_heap *h, chunkid_t c)
 	}
 }
 
+#endif /* CONFIG_SYS_HEAP_TLSF */
+
 /* Splits a chunk "lc" into a left chunk and a right chunk at "rc".
  * Leaves both chunks marked "free"
  */
@@ -208,6 +293,57 @@ size_t sys_heap_usable_size(struct sys_heap *heap, void *mem)
 	return chunk_sz - (addr - chunk_base);
 }
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+
+/* Two-level segregated fit: every chunk on the lists following the
+ * one a size maps to is guaranteed to fit, and finding the first
+ * non-empty one among them is two bit scans.  The head of the list
+ * the size itself maps to is checked first, as it fits more often
+ * than not and would otherwise be a perfect candidate for being
+ * skipped forever.
+ */
+static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
+{
+	int bi = bucket_idx(h, sz);
+	int sl = sl_idx(h, sz, bi);
+	uint32_t slmask = 0;
+
+	CHECK(bi <= bucket_idx(h, h->end_chunk));
+
+	if ((h->avail_buckets & BIT(bi)) != 0U) {
+		chunkid_t c = h->buckets[bi].next[sl];
+
+		if (c != 0U && chunk_size(h, c) >= sz) {
+			free_list_remove_idx(h, c, bi, sl);
+			return c;
+		}
+
+		/* Lists above sl, without overflowing BIT() for SL_COUNT == 32 */
+		slmask = h->buckets[bi].sl_avail & ~BIT_MASK(sl) & ~BIT(sl);
+	}
+
+	if (slmask == 0U) {
+		uint32_t bmask = h->avail_buckets & ~BIT_MASK(bi + 1);
+
+		if (bmask == 0U) {
+			return 0;
+		}
+
+		bi = __builtin_ctz(bmask);
+		slmask = h->buckets[bi].sl_avail;
+	}
+
+	sl = __builtin_ctz(slmask);
+
+	chunkid_t c = h->buckets[bi].next[sl];
+
+	free_list_remove_idx(h, c, bi, sl);
+	CHECK(chunk_size(h, c) >= sz);
+	return c;
+}
+
+#else /* CONFIG_SYS_HEAP_TLSF */
+
 static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 {
 	int bi = bucket_idx(h, sz);
@@ -260,6 +396,8 @@ static chunkid_t alloc_chunk(struct z_heap *h, chunksz_t sz)
 	return 0;
 }
 
+#endif /* CONFIG_SYS_HEAP_TLSF */
+
 void *sys_heap_alloc(struct sys_heap *heap, size_t bytes)
 {
 	struct z_heap *h = heap->heap;
@@ -482,6 +620,23 @@ void *sys_heap_aligned_realloc(struct sys_heap *heap, void *ptr,
 	return ptr2;
 }
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* Z_HEAP_MIN_SIZE is computed from these sizes, and from the number of
+ * buckets of a heap of that size.
+ */
+#define MIN_HEAP_CHUNKS \
+	((Z_HEAP_MIN_SIZE - Z_HEAP_TLSF_CHUNK_HDR_SIZE) / CHUNK_UNIT)
+#define MIN_HEAP_ALLOC_CHUNKS \
+	((Z_HEAP_TLSF_CHUNK_HDR_SIZE + 1 + CHUNK_UNIT - 1) / CHUNK_UNIT)
+#define MIN_HEAP_USABLE (MIN_HEAP_CHUNKS - MIN_HEAP_ALLOC_CHUNKS + 1)
+
+BUILD_ASSERT(sizeof(struct z_heap) == Z_HEAP_TLSF_HDR_SIZE);
+BUILD_ASSERT(sizeof(struct z_heap_bucket) == 4 + 4 * SL_COUNT);
+BUILD_ASSERT(Z_HEAP_TLSF_MIN_BUCKETS(SL_LOG2) ==
+	     (MIN_HEAP_USABLE < SL_COUNT ? 1 : LOG2(MIN_HEAP_USABLE) - SL_LOG2 + 2),
+	     "Z_HEAP_TLSF_MIN_BUCKETS() does not match the heap size");
+#endif
+
 void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 {
 	IF_ENABLED(CONFIG_MSAN, (__sanitizer_dtor_callback(mem, bytes)));
@@ -524,7 +679,14 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 	__ASSERT(chunk0_size + min_chunk_size(h) <= heap_sz, "heap size is too small");
 
 	for (int i = 0; i < nb_buckets; i++) {
+#ifdef CONFIG_SYS_HEAP_TLSF
+		h->buckets[i].sl_avail = 0;
+		for (int j = 0; j < SL_COUNT; j++) {
+			h->buckets[i].next[j] = 0;
+		}
+#else
 		h->buckets[i].next = 0;
+#endif
 	}
 
 	/* chunk containing our struct z_heap */
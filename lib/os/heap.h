@@ -41,9 +41,10 @@
  *   FREE_NEXT: Chunk ID of the next node in a free list.
  *
  * The free lists are circular lists, one for each power-of-two size
- * category.  The free list pointers exist only for free chunks,
- * obviously.  This memory is part of the user's buffer when
- * allocated.
+ * category (or, with CONFIG_SYS_HEAP_TLSF, one for each of the
+ * 2^SL_LOG2 linear subdivisions of each power-of-two category).  The
+ * free list pointers exist only for free chunks, obviously.  This
+ * memory is part of the user's buffer when allocated.
  *
  * The field order is so that allocated buffers are immediately bounded
  * by SIZE_AND_USED of the current chunk at the bottom, and LEFT_SIZE of
@@ -61,9 +62,22 @@ typedef struct { char bytes[CHUNK_UNIT]; } chunk_unit_t;
 typedef uint32_t chunkid_t;
 typedef uint32_t chunksz_t;
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* Second level subdivisions per power-of-two bucket */
+#define SL_LOG2 CONFIG_SYS_HEAP_TLSF_SL_LOG2
+#define SL_COUNT BIT(SL_LOG2)
+
+struct z_heap_bucket {
+	uint32_t sl_avail;	/* bitmask of non-empty next[] lists */
+	chunkid_t next[SL_COUNT];
+};
+#else
+#define SL_COUNT 1
+
 struct z_heap_bucket {
 	chunkid_t next;
 };
+#endif
 
 struct z_heap {
 	chunkid_t chunk0_hdr[2];
@@ -247,12 +261,76 @@ static inline size_t chunksz_to_bytes(struct z_heap *h, chunksz_t chunksz_in)
 	return chunksz_in * CHUNK_UNIT - chunk_header_bytes(h);
 }
 
+#ifdef CONFIG_SYS_HEAP_TLSF
+/* Sizes below SL_COUNT units share bucket 0 with one list per size,
+ * above that each power of two gets a bucket of SL_COUNT lists.
+ */
+static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
+{
+	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
+
+	if (usable_sz < SL_COUNT) {
+		return 0;
+	}
+	return 31 - __builtin_clz(usable_sz) - SL_LOG2 + 1;
+}
+
+/* Second level index of a chunk size within its bucket_idx(): the
+ * SL_LOG2 bits following the most significant one.
+ */
+static inline int sl_idx(struct z_heap *h, chunksz_t sz, int bidx)
+{
+	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
+
+	if (bidx == 0) {
+		return usable_sz;
+	}
+	return (usable_sz >> (bidx - 1)) - SL_COUNT;
+}
+
+/* Smallest chunk size in bucket bidx */
+static inline chunksz_t bucket_min_size(struct z_heap *h, int bidx)
+{
+	return (bidx == 0 ? 1 : SL_COUNT << (bidx - 1)) - 1 + min_chunk_size(h);
+}
+#else
 static inline int bucket_idx(struct z_heap *h, chunksz_t sz)
 {
 	unsigned int usable_sz = sz - min_chunk_size(h) + 1;
 	return 31 - __builtin_clz(usable_sz);
 }
 
+static inline chunksz_t bucket_min_size(struct z_heap *h, int bidx)
+{
+	return (1 << bidx) - 1 + min_chunk_size(h);
+}
+#endif
+
+/* Free lists are numbered bucket * SL_COUNT + second level index */
+static inline int nb_free_lists(struct z_heap *h)
+{
+	return (bucket_idx(h, h->end_chunk) + 1) * SL_COUNT;
+}
+
+static inline chunkid_t free_list_first(struct z_heap *h, int list)
+{
+#ifdef CONFIG_SYS_HEAP_TLSF
+	return h->buckets[list / SL_COUNT].next[list % SL_COUNT];
+#else
+	return h->buckets[list].next;
+#endif
+}
+
+static inline bool free_list_avail(struct z_heap *h, int list)
+{
+#ifdef CONFIG_SYS_HEAP_TLSF
+	return (h->avail_buckets & BIT(list / SL_COUNT)) != 0U &&
+	       (h->buckets[list / SL_COUNT].sl_avail & BIT(list % SL_COUNT)) != 0U;
+#else
+	return (h->avail_buckets & BIT(list)) != 0U;
+#endif
+}
+
 static inline bool size_too_big(struct z_heap *h, size_t bytes)
 {
 	/*
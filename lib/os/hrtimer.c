@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/counter.h>
+#include <zephyr/sys/hrtimer.h>
+
+/* Bring the time of the queue up to date. The counter must be read at least
+ * once per counter period while timers run, which the alarm ensures.
+ */
+static void queue_sync(struct hrtimer_queue *queue)
+{
+	uint32_t value;
+	uint32_t elapsed;
+
+	(void)counter_get_value(queue->counter, &value);
+
+	if (value >= queue->last_value) {
+		elapsed = value - queue->last_value;
+	} else {
+		elapsed = (queue->top_value - queue->last_value) + value + 1U;
+	}
+
+	queue->ticks += elapsed;
+	queue->last_value = value;
+}
+
+static void queue_insert(struct hrtimer_queue *queue, struct hrtimer *timer)
+{
+	struct hrtimer *t;
+
+	SYS_DLIST_FOR_EACH_CONTAINER(&queue->timers, t, node) {
+		if (t->expiry > timer->expiry) {
+			sys_dlist_insert(&t->node, &timer->node);
+			return;
+		}
+	}
+
+	sys_dlist_append(&queue->timers, &timer->node);
+}
+
+static void queue_alarm(const struct device *dev, uint8_t channel,
+			uint32_t ticks, void *user_data);
+
+/* Set the alarm to the earliest expiry. The alarm never goes further than
+ * half of the counter period, so that the queue time cannot miss a wrap.
+ * An alarm too close to be set on time expires immediately, rather than
+ * leaving the queue without an alarm.
+ */
+static void queue_program(struct hrtimer_queue *queue)
+{
+	struct counter_alarm_cfg alarm = {
+		.callback = queue_alarm,
+		.user_data = queue,
+		.flags = COUNTER_ALARM_CFG_EXPIRE_WHEN_LATE,
+	};
+	struct hrtimer *first;
+	uint64_t delay;
+	int ret;
+
+	if (queue->alarm_set) {
+		(void)counter_cancel_channel_alarm(queue->counter, queue->channel);
+		queue->alarm_set = false;
+	}
+
+	first = SYS_DLIST_PEEK_HEAD_CONTAINER(&queue->timers, first, node);
+	if (first == NULL) {
+		return;
+	}
+
+	queue_sync(queue);
+
+	delay = (first->expiry > queue->ticks) ? first->expiry - queue->ticks : 0U;
+	alarm.ticks = (uint32_t)CLAMP(delay, 1U, queue->top_value / 2U);
+
+	ret = counter_set_channel_alarm(queue->counter, queue->channel, &alarm);
+	__ASSERT((ret == 0) || (ret == -ETIME), "Cannot set alarm (%d)", ret);
+
+	/* A late alarm is set anyway, its callback is pending */
+	if ((ret == 0) || (ret == -ETIME)) {
+		queue->alarm_set = true;
+	}
+}
+
+static void queue_alarm(const struct device *dev, uint8_t channel,
+			uint32_t ticks, void *user_data)
+{
+	struct hrtimer_queue *queue = user_data;
+	k_spinlock_key_t key;
+
+	ARG_UNUSED(dev);
+	ARG_UNUSED(channel);
+	ARG_UNUSED(ticks);
+
+	key = k_spin_lock(&queue->lock);
+
+	queue->alarm_set = false;
+	queue_sync(queue);
+
+	while (true) {
+		struct hrtimer *timer;
+
+		timer = SYS_DLIST_PEEK_HEAD_CONTAINER(&queue->timers, timer, node);
+		if ((timer == NULL) || (timer->expiry > queue->ticks)) {
+			break;
+		}
+
+		sys_dlist_remove(&timer->node);
+
+		if (timer->period > 0U) {
+			timer->expiry += timer->period;
+			queue_insert(queue, timer);
+		}
+
+		/* The expiry function may start or stop timers. */
+		k_spin_unlock(&queue->lock, key);
+		timer->expiry_fn(timer);
+		key = k_spin_lock(&queue->lock);
+
+		queue_sync(queue);
+	}
+
+	queue_program(queue);
+
+	k_spin_unlock(&queue->lock, key);
+}
+
+int hrtimer_queue_init(struct hrtimer_queue *queue, const struct device *counter,
+		       uint8_t channel)
+{
+	if (!device_is_ready(counter)) {
+		return -ENODEV;
+	}
+
+	if (channel >= counter_get_num_of_channels(counter)) {
+		return -EINVAL;
+	}
+
+	/* The queue time is kept up to date from up-counting values */
+	if (!counter_is_counting_up(counter)) {
+		return -ENOTSUP;
+	}
+
+	queue->counter = counter;
+	queue->channel = channel;
+	queue->top_value = counter_get_top_value(counter);
+	queue->ticks = 0U;
+	queue->alarm_set = false;
+	sys_dlist_init(&queue->timers);
+
+	(void)counter_get_value(counter, &queue->last_value);
+
+	return counter_start(counter);
+}
+
+void hrtimer_init(struct hrtimer *timer, struct hrtimer_queue *queue,
+		  hrtimer_expiry_t expiry_fn)
+{
+	sys_dnode_init(&timer->node);
+	timer->queue = queue;
+	timer->expiry_fn = expiry_fn;
+	timer->period = 0U;
+}
+
+void hrtimer_start(struct hrtimer *timer, uint32_t delay_us, uint32_t period_us)
+{
+	struct hrtimer_queue *queue = timer->queue;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&queue->lock);
+
+	if (sys_dnode_is_linked(&timer->node)) {
+		sys_dlist_remove(&timer->node);
+	}
+
+	queue_sync(queue);
+
+	timer->expiry = queue->ticks + counter_us_to_ticks(queue->counter, delay_us);
+	timer->period = counter_us_to_ticks(queue->counter, period_us);
+	if ((period_us > 0U) && (timer->period == 0U)) {
+		timer->period = 1U;
+	}
+
+	queue_insert(queue, timer);
+
+	if (sys_dlist_peek_head(&queue->timers) == &timer->node) {
+		queue_program(queue);
+	}
+
+	k_spin_unlock(&queue->lock, key);
+}
+
+void hrtimer_stop(struct hrtimer *timer)
+{
+	struct hrtimer_queue *queue = timer->queue;
+	k_spinlock_key_t key;
+	bool first;
+
+	key = k_spin_lock(&queue->lock);
+
+	if (sys_dnode_is_linked(&timer->node)) {
+		first = (sys_dlist_peek_head(&queue->timers) == &timer->node);
+
+		sys_dlist_remove(&timer->node);
+
+		if (first) {
+			queue_program(queue);
+		}
+	}
+
+	k_spin_unlock(&queue->lock, key);
+}
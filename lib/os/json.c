@@ -419,26 +419,42 @@ static int skip_field(struct json_obj *obj, struct json_obj_key_value *kv)
 
 static int decode_num(const struct json_token *token, int32_t *num)
 {
-	/* FIXME: strtod() is not available in newlib/minimal libc,
-	 * so using strtol() here.
+	/* Decoded in place, the token is not terminated and strtol() would
+	 * need it to be.
 	 */
-	char *endptr;
-	char prev_end;
+	const char *pos = token->start;
+	uint32_t limit = INT32_MAX;
+	uint32_t value = 0U;
+	bool negative = false;
 
-	prev_end = *token->end;
-	*token->end = '\0';
+	if (pos < token->end && *pos == '-') {
+		negative = true;
+		limit = (uint32_t)INT32_MAX + 1U;
+		pos++;
+	}
 
-	errno = 0;
-	*num = strtol(token->start, &endptr, 10);
+	if (pos == token->end) {
+		return -EINVAL;
+	}
 
-	*token->end = prev_end;
+	for (; pos < token->end; pos++) {
+		uint32_t digit = (uint32_t)(uint8_t)*pos - '0';
 
-	if (errno != 0) {
-		return -errno;
+		if (digit > 9U) {
+			return -EINVAL;
+		}
+
+		if (value > (limit - digit) / 10U) {
+			return -ERANGE;
+		}
+
+		value = value * 10U + digit;
 	}
 
-	if (endptr != token->end) {
-		return -EINVAL;
+	if (negative) {
+		*num = (value == 0U) ? 0 : -(int32_t)(value - 1U) - 1;
+	} else {
+		*num = (int32_t)value;
 	}
 
 	return 0;
@@ -666,7 +682,8 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 {
 	struct json_obj_key_value kv;
 	int64_t decoded_fields = 0;
-	size_t i;
+	size_t i = 0;
+	size_t n;
 	int ret;
 
 	while (!obj_next(obj, &kv)) {
@@ -674,7 +691,10 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 			return decoded_fields;
 		}
 
-		for (i = 0; i < descr_len; i++) {
+		/* Fields mostly come in the order of the descriptors, so start
+		 * looking right after the last field found.
+		 */
+		for (n = 0; n < descr_len; n++, i = (i + 1 < descr_len) ? i + 1 : 0) {
 			void *decode_field = (char *)val + descr[i].offset;
 
 			/* Field has been decoded already, skip */
@@ -704,7 +724,7 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 		}
 
 		/* Skip field, if no descriptor was found */
-		if (i >= descr_len) {
+		if (n >= descr_len) {
 			ret = skip_field(obj, &kv);
 			if (ret < 0) {
 				return ret;
@@ -964,17 +984,20 @@ static int num_encode(const int32_t *num, json_append_bytes_t append_bytes,
 		      void *data)
 {
 	char buf[3 * sizeof(int32_t)];
-	int ret;
+	char *pos = buf + sizeof(buf);
+	uint32_t value = (*num < 0) ? 0U - (uint32_t)*num : (uint32_t)*num;
 
-	ret = snprintk(buf, sizeof(buf), "%d", *num);
-	if (ret < 0) {
-		return ret;
-	}
-	if (ret >= (int)sizeof(buf)) {
-		return -ENOMEM;
+	/* Digits are produced backwards from the end of the buffer */
+	do {
+		*--pos = '0' + value % 10U;
+		value /= 10U;
+	} while (value != 0U);
+
+	if (*num < 0) {
+		*--pos = '-';
 	}
 
-	return append_bytes(buf, (size_t)ret, data);
+	return append_bytes(pos, (size_t)(buf + sizeof(buf) - pos), data);
 }
 
 static int float_ascii_encode(struct json_obj_token *num, json_append_bytes_t append_bytes,
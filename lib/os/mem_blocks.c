@@ -86,6 +86,87 @@ out:
 	return ret;
 }
 
+/* Number of single blocks allocated or freed at once */
+#define BATCH_BLOCKS 8
+
+/* Allocate single blocks in one go, either all of them or none */
+static int alloc_single_blocks(sys_mem_blocks_t *mem_block, size_t count,
+			       void **out_blocks)
+{
+	size_t offsets[BATCH_BLOCKS];
+	int r;
+
+	__ASSERT_NO_MSG(count <= ARRAY_SIZE(offsets));
+
+#ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
+	k_spinlock_key_t  key = k_spin_lock(&mem_block->lock);
+#endif
+
+	r = sys_bitarray_alloc_multi(mem_block->bitmap, 1, count, offsets);
+
+#ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
+	if (r == 0) {
+		mem_block->info.used_blocks += (uint32_t)count;
+
+		if (mem_block->info.max_used_blocks < mem_block->info.used_blocks) {
+			mem_block->info.max_used_blocks = mem_block->info.used_blocks;
+		}
+	}
+
+	k_spin_unlock(&mem_block->lock, key);
+#endif
+
+	if (r != 0) {
+		return r;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		out_blocks[i] = mem_block->buffer +
+				(offsets[i] << mem_block->info.blk_sz_shift);
+	}
+
+	return 0;
+}
+
+/* Free single blocks in one go, either all of them or none */
+static int free_single_blocks(sys_mem_blocks_t *mem_block, size_t count,
+			      void **in_blocks)
+{
+	size_t offsets[BATCH_BLOCKS];
+	int r;
+
+	__ASSERT_NO_MSG(count <= ARRAY_SIZE(offsets));
+
+	for (size_t i = 0; i < count; i++) {
+		uint8_t *blk = in_blocks[i];
+
+		if (blk < mem_block->buffer) {
+			return -EFAULT;
+		}
+
+		offsets[i] = (blk - mem_block->buffer) >> mem_block->info.blk_sz_shift;
+		if (offsets[i] >= mem_block->info.num_blocks) {
+			return -EFAULT;
+		}
+	}
+
+#ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
+	k_spinlock_key_t  key = k_spin_lock(&mem_block->lock);
+#endif
+
+	r = sys_bitarray_free_multi(mem_block->bitmap, 1, count, offsets);
+
+#ifdef CONFIG_SYS_MEM_BLOCKS_RUNTIME_STATS
+	if (r == 0) {
+		mem_block->info.used_blocks -= (uint32_t)count;
+	}
+
+	k_spin_unlock(&mem_block->lock, key);
+#endif
+
+	return r;
+}
+
 int sys_mem_blocks_alloc_contiguous(sys_mem_blocks_t *mem_block, size_t count,
 				    void **out_block)
 {
@@ -127,7 +208,7 @@ int sys_mem_blocks_alloc(sys_mem_blocks_t *mem_block, size_t count,
 			 void **out_blocks)
 {
 	int ret = 0;
-	int i;
+	size_t i, n;
 
 	__ASSERT_NO_MSG(mem_block != NULL);
 	__ASSERT_NO_MSG(out_blocks != NULL);
@@ -145,19 +226,19 @@ int sys_mem_blocks_alloc(sys_mem_blocks_t *mem_block, size_t count,
 		goto out;
 	}
 
-	for (i = 0; i < count; i++) {
-		void *ptr = alloc_blocks(mem_block, 1);
+	for (i = 0; i < count; i += n) {
+		n = MIN(count - i, BATCH_BLOCKS);
 
-		if (ptr == NULL) {
+		if (alloc_single_blocks(mem_block, n, &out_blocks[i]) != 0) {
 			break;
 		}
 
-		out_blocks[i] = ptr;
-
 #ifdef CONFIG_SYS_MEM_BLOCKS_LISTENER
-		heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(mem_block),
-					   ptr,
-					   BIT(mem_block->info.blk_sz_shift));
+		for (size_t j = i; j < i + n; j++) {
+			heap_listener_notify_alloc(HEAP_ID_FROM_POINTER(mem_block),
+						   out_blocks[j],
+						   BIT(mem_block->info.blk_sz_shift));
+		}
 #endif
 	}
 
@@ -253,7 +334,7 @@ int sys_mem_blocks_free(sys_mem_blocks_t *mem_block, size_t count,
 			void **in_blocks)
 {
 	int ret = 0;
-	int i;
+	size_t i, n;
 
 	__ASSERT_NO_MSG(mem_block != NULL);
 	__ASSERT_NO_MSG(in_blocks != NULL);
@@ -270,25 +351,41 @@ int sys_mem_blocks_free(sys_mem_blocks_t *mem_block, size_t count,
 		goto out;
 	}
 
-	for (i = 0; i < count; i++) {
-		void *ptr = in_blocks[i];
-
-		int r = free_blocks(mem_block, ptr, 1);
+	for (i = 0; i < count; i += n) {
+		n = MIN(count - i, BATCH_BLOCKS);
 
-		if (r != 0) {
-			ret = r;
-		}
+		if (free_single_blocks(mem_block, n, &in_blocks[i]) == 0) {
 #ifdef CONFIG_SYS_MEM_BLOCKS_LISTENER
-		else {
-			/*
-			 * Since we do not keep track of failed free ops,
-			 * we need to notify free one-by-one, instead of
-			 * notifying at the end of function.
-			 */
-			heap_listener_notify_free(HEAP_ID_FROM_POINTER(mem_block),
-						  ptr, BIT(mem_block->info.blk_sz_shift));
+			for (size_t j = i; j < i + n; j++) {
+				heap_listener_notify_free(HEAP_ID_FROM_POINTER(mem_block),
+							  in_blocks[j],
+							  BIT(mem_block->info.blk_sz_shift));
+			}
+#endif
+			continue;
 		}
+
+		/* Free the blocks one by one to find out which ones fail */
+		for (size_t j = i; j < i + n; j++) {
+			void *ptr = in_blocks[j];
+
+			int r = free_blocks(mem_block, ptr, 1);
+
+			if (r != 0) {
+				ret = r;
+			}
+#ifdef CONFIG_SYS_MEM_BLOCKS_LISTENER
+			else {
+				/*
+				 * Since we do not keep track of failed free ops,
+				 * we need to notify free one-by-one, instead of
+				 * notifying at the end of function.
+				 */
+				heap_listener_notify_free(HEAP_ID_FROM_POINTER(mem_block),
+							  ptr, BIT(mem_block->info.blk_sz_shift));
+			}
 #endif
+		}
 	}
 
 out:
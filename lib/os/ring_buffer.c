@@ -268,3 +268,142 @@ int ring_buf_item_get(struct ring_buf *buf, uint16_t *type, uint8_t *value,
 
 	return 0;
 }
+
+/* Sequence numbers are stored relative to the slot index, so that a zeroed
+ * array is an empty buffer: slot i is free for the lap starting at position
+ * p when its sequence number is p + i, and holds the item of position
+ * p + i once it is p + i + 1.
+ */
+static inline uint32_t mpmc_seq_get(struct ring_buf_mpmc *buf, uint32_t pos)
+{
+	uint32_t idx = pos & buf->mask;
+
+	return (uint32_t)atomic_get(&buf->seq[idx]) + idx;
+}
+
+static inline void mpmc_seq_set(struct ring_buf_mpmc *buf, uint32_t pos, uint32_t seq)
+{
+	uint32_t idx = pos & buf->mask;
+
+	(void)atomic_set(&buf->seq[idx], (atomic_val_t)(seq - idx));
+}
+
+static inline uint8_t *mpmc_item(struct ring_buf_mpmc *buf, uint32_t pos)
+{
+	return &buf->buffer[(pos & buf->mask) * buf->item_size];
+}
+
+/* Reserve up to cnt consecutive slots from the position in pos_ptr, a slot
+ * being available when its sequence number is its position plus offset.
+ */
+static uint32_t mpmc_claim(struct ring_buf_mpmc *buf, atomic_t *pos_ptr,
+			   uint32_t offset, uint32_t cnt, uint32_t *pos)
+{
+	uint32_t start;
+	uint32_t n;
+
+	do {
+		start = (uint32_t)atomic_get(pos_ptr);
+
+		for (n = 0; n < cnt; n++) {
+			if (mpmc_seq_get(buf, start + n) != start + n + offset) {
+				break;
+			}
+		}
+
+		if (n == 0) {
+			/* The first slot was taken by another thread if its
+			 * sequence number is ahead, try again from there.
+			 */
+			if ((int32_t)(mpmc_seq_get(buf, start) - (start + offset)) > 0) {
+				continue;
+			}
+
+			return 0;
+		}
+	} while (!atomic_cas(pos_ptr, (atomic_val_t)start, (atomic_val_t)(start + n)));
+
+	*pos = start;
+
+	return n;
+}
+
+void ring_buf_mpmc_init(struct ring_buf_mpmc *buf, uint32_t item_size,
+			uint32_t item_cnt, uint8_t *data, atomic_t *seq)
+{
+	__ASSERT(IS_POWER_OF_TWO(item_cnt), "Number of items must be a power of 2");
+
+	memset(seq, 0, item_cnt * sizeof(atomic_t));
+	*buf = (struct ring_buf_mpmc) {
+		.buffer = data,
+		.seq = seq,
+		.item_size = item_size,
+		.mask = item_cnt - 1,
+	};
+}
+
+int ring_buf_mpmc_put_claim(struct ring_buf_mpmc *buf, void **item, uint32_t *pos)
+{
+	if (mpmc_claim(buf, &buf->put_pos, 0, 1, pos) == 0) {
+		return -EMSGSIZE;
+	}
+
+	*item = mpmc_item(buf, *pos);
+
+	return 0;
+}
+
+void ring_buf_mpmc_put_finish(struct ring_buf_mpmc *buf, uint32_t pos)
+{
+	mpmc_seq_set(buf, pos, pos + 1);
+}
+
+uint32_t ring_buf_mpmc_put(struct ring_buf_mpmc *buf, const void *items, uint32_t cnt)
+{
+	const uint8_t *src = items;
+	uint32_t pos;
+	uint32_t n;
+
+	n = mpmc_claim(buf, &buf->put_pos, 0, MIN(cnt, buf->mask + 1), &pos);
+
+	for (uint32_t i = 0; i < n; i++) {
+		memcpy(mpmc_item(buf, pos + i), src, buf->item_size);
+		src += buf->item_size;
+		mpmc_seq_set(buf, pos + i, pos + i + 1);
+	}
+
+	return n;
+}
+
+int ring_buf_mpmc_get_claim(struct ring_buf_mpmc *buf, void **item, uint32_t *pos)
+{
+	if (mpmc_claim(buf, &buf->get_pos, 1, 1, pos) == 0) {
+		return -EAGAIN;
+	}
+
+	*item = mpmc_item(buf, *pos);
+
+	return 0;
+}
+
+void ring_buf_mpmc_get_finish(struct ring_buf_mpmc *buf, uint32_t pos)
+{
+	mpmc_seq_set(buf, pos, pos + buf->mask + 1);
+}
+
+uint32_t ring_buf_mpmc_get(struct ring_buf_mpmc *buf, void *items, uint32_t cnt)
+{
+	uint8_t *dst = items;
+	uint32_t pos;
+	uint32_t n;
+
+	n = mpmc_claim(buf, &buf->get_pos, 1, MIN(cnt, buf->mask + 1), &pos);
+
+	for (uint32_t i = 0; i < n; i++) {
+		memcpy(dst, mpmc_item(buf, pos + i), buf->item_size);
+		dst += buf->item_size;
+		mpmc_seq_set(buf, pos + i, pos + i + buf->mask + 1);
+	}
+
+	return n;
+}
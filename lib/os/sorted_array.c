@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/sys/sorted_array.h>
+
+/* The elements are in descending order, the minimum being the last one */
+
+/* Number of elements sorted strictly after elem, i.e. greater than it */
+static size_t count_greater(struct sys_sorted_array *array, const void *elem)
+{
+	size_t lo = 0;
+	size_t hi = array->size;
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (array->lessthan_fn(elem, array->elems[mid])) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+/* Index of elem, or the size of the array if it is not in it */
+static size_t find(struct sys_sorted_array *array, const void *elem)
+{
+	size_t i;
+
+	/* Scan the elements equal to elem for the pointer itself */
+	for (i = count_greater(array, elem); i < array->size; i++) {
+		if (array->elems[i] == elem) {
+			return i;
+		}
+
+		if (array->lessthan_fn(array->elems[i], elem)) {
+			break;
+		}
+	}
+
+	return array->size;
+}
+
+int sys_sorted_array_insert(struct sys_sorted_array *array, void *elem)
+{
+	size_t i;
+
+	if (array->size == array->capacity) {
+		return -ENOMEM;
+	}
+
+	/* Going before the equal elements sorts elem after them in ascending order */
+	i = count_greater(array, elem);
+
+	memmove(&array->elems[i + 1], &array->elems[i],
+		(array->size - i) * sizeof(array->elems[0]));
+	array->elems[i] = elem;
+	array->size++;
+
+	return 0;
+}
+
+bool sys_sorted_array_remove(struct sys_sorted_array *array, void *elem)
+{
+	size_t i = find(array, elem);
+
+	if (i == array->size) {
+		return false;
+	}
+
+	array->size--;
+	memmove(&array->elems[i], &array->elems[i + 1],
+		(array->size - i) * sizeof(array->elems[0]));
+
+	return true;
+}
+
+bool sys_sorted_array_contains(struct sys_sorted_array *array, void *elem)
+{
+	return find(array, elem) != array->size;
+}
@@ -20,6 +20,43 @@
 static struct timespec rt_clock_base;
 static struct k_spinlock rt_clock_base_lock;
 
+#ifdef CONFIG_POSIX_CLOCK_ADJTIME
+/*
+ * Adjustment of `CLOCK_REALTIME` in progress, see `adjtime`.  From the
+ * uptime `slew_start` (in nanoseconds), the clock runs faster, or slower,
+ * by CONFIG_POSIX_CLOCK_ADJTIME_MAX_PPM until `slew_ns` nanoseconds have
+ * been added to it.
+ */
+static uint64_t slew_start;
+static int64_t slew_ns;
+
+/* Part of the adjustment applied at the given uptime. */
+static int64_t rt_clock_slewed(uint64_t uptime_ns)
+{
+	uint64_t applied = (uptime_ns - slew_start) / NSEC_PER_USEC *
+			   CONFIG_POSIX_CLOCK_ADJTIME_MAX_PPM / NSEC_PER_USEC;
+
+	if (slew_ns < 0) {
+		return -(int64_t)MIN(applied, (uint64_t)-slew_ns);
+	}
+
+	return MIN(applied, (uint64_t)slew_ns);
+}
+#endif
+
+static void timespec_normalize(struct timespec *ts)
+{
+	while (ts->tv_nsec >= NSEC_PER_SEC) {
+		ts->tv_sec++;
+		ts->tv_nsec -= NSEC_PER_SEC;
+	}
+
+	while (ts->tv_nsec < 0) {
+		ts->tv_sec--;
+		ts->tv_nsec += NSEC_PER_SEC;
+	}
+}
+
 /**
  * @brief Get clock time specified by clock_id.
  *
@@ -29,6 +66,7 @@ int z_impl_clock_gettime(clockid_t clock_id, struct timespec *ts)
 {
 	struct timespec base;
 	k_spinlock_key_t key;
+	uint64_t ticks = k_uptime_ticks();
 
 	switch (clock_id) {
 	case CLOCK_MONOTONIC:
@@ -39,6 +77,12 @@ int z_impl_clock_gettime(clockid_t clock_id, struct timespec *ts)
 	case CLOCK_REALTIME:
 		key = k_spin_lock(&rt_clock_base_lock);
 		base = rt_clock_base;
+#ifdef CONFIG_POSIX_CLOCK_ADJTIME
+		int64_t slewed = rt_clock_slewed(k_ticks_to_ns_floor64(ticks));
+
+		base.tv_sec += slewed / NSEC_PER_SEC;
+		base.tv_nsec += slewed % NSEC_PER_SEC;
+#endif
 		k_spin_unlock(&rt_clock_base_lock, key);
 		break;
 
@@ -47,7 +91,6 @@ int z_impl_clock_gettime(clockid_t clock_id, struct timespec *ts)
 		return -1;
 	}
 
-	uint64_t ticks = k_uptime_ticks();
 	uint64_t elapsed_secs = ticks / CONFIG_SYS_CLOCK_TICKS_PER_SEC;
 	uint64_t nremainder = ticks - elapsed_secs * CONFIG_SYS_CLOCK_TICKS_PER_SEC;
 
@@ -57,10 +100,7 @@ int z_impl_clock_gettime(clockid_t clock_id, struct timespec *ts)
 
 	ts->tv_sec += base.tv_sec;
 	ts->tv_nsec += base.tv_nsec;
-	if (ts->tv_nsec >= NSEC_PER_SEC) {
-		ts->tv_sec++;
-		ts->tv_nsec -= NSEC_PER_SEC;
-	}
+	timespec_normalize(ts);
 
 	return 0;
 }
@@ -101,10 +141,59 @@ int clock_settime(clockid_t clock_id, const struct timespec *tp)
 
 	key = k_spin_lock(&rt_clock_base_lock);
 	rt_clock_base = base;
+#ifdef CONFIG_POSIX_CLOCK_ADJTIME
+	/* Stepping the clock cancels the adjustment in progress. */
+	slew_ns = 0;
+#endif
+	k_spin_unlock(&rt_clock_base_lock, key);
+
+	return 0;
+}
+
+#ifdef CONFIG_POSIX_CLOCK_ADJTIME
+/**
+ * @brief Correct the time of the `CLOCK_REALTIME` clock gradually.
+ *
+ * The clock is sped up, or slowed down, by
+ * CONFIG_POSIX_CLOCK_ADJTIME_MAX_PPM until the correction is done, so it
+ * never jumps and never goes backward.  A new correction replaces the part
+ * of the previous one not applied yet, which is returned in `olddelta`.
+ *
+ * Same as adjtime() in the BSDs and Linux.
+ */
+int adjtime(const struct timeval *delta, struct timeval *olddelta)
+{
+	uint64_t uptime_ns = k_ticks_to_ns_floor64(k_uptime_ticks());
+	int64_t remaining;
+	int64_t slewed;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&rt_clock_base_lock);
+
+	slewed = rt_clock_slewed(uptime_ns);
+	remaining = slew_ns - slewed;
+
+	if (delta != NULL) {
+		/* Make the part already applied part of the base. */
+		rt_clock_base.tv_sec += slewed / NSEC_PER_SEC;
+		rt_clock_base.tv_nsec += slewed % NSEC_PER_SEC;
+		timespec_normalize(&rt_clock_base);
+
+		slew_start = uptime_ns;
+		slew_ns = (int64_t)delta->tv_sec * NSEC_PER_SEC +
+			  (int64_t)delta->tv_usec * NSEC_PER_USEC;
+	}
+
 	k_spin_unlock(&rt_clock_base_lock, key);
 
+	if (olddelta != NULL) {
+		olddelta->tv_sec = remaining / NSEC_PER_SEC;
+		olddelta->tv_usec = (remaining % NSEC_PER_SEC) / NSEC_PER_USEC;
+	}
+
 	return 0;
 }
+#endif
 
 /**
  * @brief Suspend execution for a nanosecond interval, or
@@ -150,6 +239,9 @@ int clock_nanosleep(clockid_t clock_id, int flags, const struct timespec *rqtp,
 	if (flags & TIMER_ABSTIME && clock_id == CLOCK_REALTIME) {
 		key = k_spin_lock(&rt_clock_base_lock);
 		ns -= rt_clock_base.tv_sec * NSEC_PER_SEC + rt_clock_base.tv_nsec;
+#ifdef CONFIG_POSIX_CLOCK_ADJTIME
+		ns -= rt_clock_slewed(uptime_ns);
+#endif
 		k_spin_unlock(&rt_clock_base_lock, key);
 	}
 
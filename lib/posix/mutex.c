@@ -11,6 +11,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/posix/pthread.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/sys/bitarray.h>
 
 LOG_MODULE_REGISTER(pthread_mutex, CONFIG_PTHREAD_MUTEX_LOG_LEVEL);
@@ -80,27 +81,43 @@ struct k_mutex *to_posix_mutex(pthread_mutex_t *mu)
 {
 	int err;
 	size_t bit;
-	struct k_mutex *m;
+	struct k_mutex *m = NULL;
+	k_spinlock_key_t key;
 
 	if (*mu != PTHREAD_MUTEX_INITIALIZER) {
 		return get_posix_mutex(*mu);
 	}
 
+	/* Only the lazy initialization is serialized */
+	key = k_spin_lock(&pthread_mutex_spinlock);
+
+	if (*mu != PTHREAD_MUTEX_INITIALIZER) {
+		/* Initialized by another thread in the meantime */
+		k_spin_unlock(&pthread_mutex_spinlock, key);
+		return get_posix_mutex(*mu);
+	}
+
 	/* Try and automatically associate a posix_mutex */
 	if (sys_bitarray_alloc(&posix_mutex_bitarray, 1, &bit) < 0) {
 		LOG_ERR("Unable to allocate pthread_mutex_t");
-		return NULL;
+		goto unlock;
 	}
 
-	/* Record the associated posix_mutex in mu and mark as initialized */
-	*mu = mark_pthread_obj_initialized(bit);
-
 	/* Initialize the posix_mutex */
 	m = &posix_mutex_pool[bit];
 
 	err = k_mutex_init(m);
 	__ASSERT_NO_MSG(err == 0);
 
+	/* Record the associated posix_mutex in mu and mark as initialized,
+	 * once readers without the lock can see the initialized k_mutex.
+	 */
+	barrier_dmem_fence_full();
+	*mu = mark_pthread_obj_initialized(bit);
+
+unlock:
+	k_spin_unlock(&pthread_mutex_spinlock, key);
+
 	return m;
 }
 
@@ -110,13 +127,9 @@ static int acquire_mutex(pthread_mutex_t *mu, k_timeout_t timeout)
 	size_t bit;
 	int ret = 0;
 	struct k_mutex *m;
-	k_spinlock_key_t key;
-
-	key = k_spin_lock(&pthread_mutex_spinlock);
 
 	m = to_posix_mutex(mu);
 	if (m == NULL) {
-		k_spin_unlock(&pthread_mutex_spinlock, key);
 		return EINVAL;
 	}
 
@@ -125,16 +138,18 @@ static int acquire_mutex(pthread_mutex_t *mu, k_timeout_t timeout)
 	bit = posix_mutex_to_offset(m);
 	type = posix_mutex_type[bit];
 
+	/*
+	 * Checked without a lock: only the current thread can make itself the
+	 * owner of the mutex, or stop being it.
+	 */
 	if (m->owner == k_current_get()) {
 		switch (type) {
 		case PTHREAD_MUTEX_NORMAL:
 			if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
-				k_spin_unlock(&pthread_mutex_spinlock, key);
 				LOG_ERR("Timeout locking mutex %p", m);
 				return EBUSY;
 			}
 			/* On most POSIX systems, this usually results in an infinite loop */
-			k_spin_unlock(&pthread_mutex_spinlock, key);
 			LOG_ERR("Attempt to relock non-recursive mutex %p", m);
 			do {
 				(void)k_sleep(K_FOREVER);
@@ -157,7 +172,6 @@ static int acquire_mutex(pthread_mutex_t *mu, k_timeout_t timeout)
 			break;
 		}
 	}
-	k_spin_unlock(&pthread_mutex_spinlock, key);
 
 	if (ret == 0) {
 		ret = k_mutex_lock(m, timeout);
@@ -45,6 +45,9 @@ struct posix_thread {
 
 	/* Queue ID (internal-only) */
 	uint8_t qid;
+
+	/* Generation of the pthread_t handle, incremented on each reuse */
+	uint16_t generation;
 };
 
 typedef struct pthread_key_obj {
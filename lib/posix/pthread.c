@@ -69,10 +69,16 @@ static const struct pthread_attr init_pthread_attrs = {
 
 /*
  * We reserve the MSB to mark a pthread_t as initialized (from the
- * perspective of the application). With a linear space, this means that
- * the theoretical pthread_t range is [0,2147483647].
+ * perspective of the application). Below it, the upper bits hold the
+ * generation of the thread and the lower bits its index in the pool, so
+ * that the handle of a recycled thread does not refer to the thread that
+ * reuses its slot.
  */
-BUILD_ASSERT(CONFIG_MAX_PTHREAD_COUNT < PTHREAD_OBJ_MASK_INIT,
+#define PTHREAD_IDX_BITS 16
+#define PTHREAD_IDX_MASK BIT_MASK(PTHREAD_IDX_BITS)
+#define PTHREAD_GEN_MASK BIT_MASK(31 - PTHREAD_IDX_BITS)
+
+BUILD_ASSERT(CONFIG_MAX_PTHREAD_COUNT <= PTHREAD_IDX_MASK,
 	     "CONFIG_MAX_PTHREAD_COUNT is too high");
 
 static inline size_t posix_thread_to_offset(struct posix_thread *t)
@@ -82,7 +88,25 @@ static inline size_t posix_thread_to_offset(struct posix_thread *t)
 
 static inline size_t get_posix_thread_idx(pthread_t pth)
 {
-	return mark_pthread_obj_uninitialized(pth);
+	return mark_pthread_obj_uninitialized(pth) & PTHREAD_IDX_MASK;
+}
+
+static inline uint32_t get_posix_thread_gen(pthread_t pth)
+{
+	return (mark_pthread_obj_uninitialized(pth) >> PTHREAD_IDX_BITS) & PTHREAD_GEN_MASK;
+}
+
+static inline pthread_t posix_thread_to_pthread(struct posix_thread *t)
+{
+	size_t bit = posix_thread_to_offset(t);
+
+	if (bit >= CONFIG_MAX_PTHREAD_COUNT) {
+		/* not a pthread, there is no generation to read */
+		return mark_pthread_obj_initialized(bit);
+	}
+
+	return mark_pthread_obj_initialized(((t->generation & PTHREAD_GEN_MASK)
+					     << PTHREAD_IDX_BITS) | bit);
 }
 
 struct posix_thread *to_posix_thread(pthread_t pthread)
@@ -90,6 +114,7 @@ struct posix_thread *to_posix_thread(pthread_t pthread)
 	k_spinlock_key_t key;
 	struct posix_thread *t;
 	bool actually_initialized;
+	bool stale;
 	size_t bit = get_posix_thread_idx(pthread);
 
 	/* if the provided thread does not claim to be initialized, its invalid */
@@ -114,6 +139,7 @@ struct posix_thread *to_posix_thread(pthread_t pthread)
 	actually_initialized =
 		!(t->qid == POSIX_THREAD_READY_Q ||
 		  (t->qid == POSIX_THREAD_DONE_Q && t->detachstate == PTHREAD_CREATE_DETACHED));
+	stale = get_posix_thread_gen(pthread) != (t->generation & PTHREAD_GEN_MASK);
 	k_spin_unlock(&pthread_pool_lock, key);
 
 	if (!actually_initialized) {
@@ -121,18 +147,21 @@ struct posix_thread *to_posix_thread(pthread_t pthread)
 		return NULL;
 	}
 
+	if (stale) {
+		LOG_ERR("Pthread has been recycled (%x)", pthread);
+		return NULL;
+	}
+
 	return &posix_thread_pool[bit];
 }
 
 pthread_t pthread_self(void)
 {
-	size_t bit;
 	struct posix_thread *t;
 
 	t = (struct posix_thread *)CONTAINER_OF(k_current_get(), struct posix_thread, thread);
-	bit = posix_thread_to_offset(t);
 
-	return mark_pthread_obj_initialized(bit);
+	return posix_thread_to_pthread(t);
 }
 
 static bool is_posix_policy_prio_valid(uint32_t priority, int policy)
@@ -401,6 +430,8 @@ int pthread_create(pthread_t *th, const pthread_attr_t *_attr, void *(*threadrou
 		/* initialize thread state */
 		sys_dlist_append(&run_q, &t->q_node);
 		t->qid = POSIX_THREAD_RUN_Q;
+		/* invalidate the handles of the previous thread in this slot */
+		t->generation++;
 		t->detachstate = attr->detachstate;
 		if ((BIT(_PTHREAD_CANCEL_POS) & attr->flags) != 0) {
 			t->cancel_state = PTHREAD_CANCEL_ENABLE;
@@ -452,7 +483,7 @@ int pthread_create(pthread_t *th, const pthread_attr_t *_attr, void *(*threadrou
 	}
 
 	/* finally provide the initialized thread to the caller */
-	*th = mark_pthread_obj_initialized(posix_thread_to_offset(t));
+	*th = posix_thread_to_pthread(t);
 
 	LOG_DBG("Created pthread %p", &t->thread);
 
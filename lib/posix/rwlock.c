@@ -11,8 +11,6 @@
 #define INITIALIZED 1
 #define NOT_INITIALIZED 0
 
-#define CONCURRENT_READER_LIMIT  (CONFIG_MAX_PTHREAD_COUNT + 1)
-
 int64_t timespec_to_timeoutms(const struct timespec *abstime);
 static uint32_t read_lock_acquire(pthread_rwlock_t *rwlock, int32_t timeout);
 static uint32_t write_lock_acquire(pthread_rwlock_t *rwlock, int32_t timeout);
@@ -25,11 +23,7 @@ static uint32_t write_lock_acquire(pthread_rwlock_t *rwlock, int32_t timeout);
 int pthread_rwlock_init(pthread_rwlock_t *rwlock,
 			const pthread_rwlockattr_t *attr)
 {
-	k_sem_init(&rwlock->rd_sem, CONCURRENT_READER_LIMIT,
-		   CONCURRENT_READER_LIMIT);
-	k_sem_init(&rwlock->wr_sem, 1, 1);
-	k_sem_init(&rwlock->reader_active, 1, 1);
-	rwlock->wr_owner = NULL;
+	k_rwlock_init(&rwlock->rwlock);
 	rwlock->status = INITIALIZED;
 	return 0;
 }
@@ -45,7 +39,7 @@ int pthread_rwlock_destroy(pthread_rwlock_t *rwlock)
 		return EINVAL;
 	}
 
-	if (rwlock->wr_owner != NULL) {
+	if (rwlock->rwlock.writer != NULL) {
 		return EBUSY;
 	}
 
@@ -60,9 +54,6 @@ int pthread_rwlock_destroy(pthread_rwlock_t *rwlock)
 /**
  * @brief Lock a read-write lock object for reading.
  *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
- *
  * See IEEE 1003.1
  */
 int pthread_rwlock_rdlock(pthread_rwlock_t *rwlock)
@@ -77,9 +68,6 @@ int pthread_rwlock_rdlock(pthread_rwlock_t *rwlock)
 /**
  * @brief Lock a read-write lock object for reading within specific time.
  *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
- *
  * See IEEE 1003.1
  */
 int pthread_rwlock_timedrdlock(pthread_rwlock_t *rwlock,
@@ -105,9 +93,6 @@ int pthread_rwlock_timedrdlock(pthread_rwlock_t *rwlock,
 /**
  * @brief Lock a read-write lock object for reading immediately.
  *
- * API behaviour is unpredictable if number of concurrent reader
- * lock held is greater than CONCURRENT_READER_LIMIT.
- *
  * See IEEE 1003.1
  */
 int pthread_rwlock_tryrdlock(pthread_rwlock_t *rwlock)
@@ -122,8 +107,7 @@ int pthread_rwlock_tryrdlock(pthread_rwlock_t *rwlock)
 /**
  * @brief Lock a read-write lock object for writing.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
+ * Waiting writers have priority over new readers.
  *
  * See IEEE 1003.1
  */
@@ -139,8 +123,7 @@ int pthread_rwlock_wrlock(pthread_rwlock_t *rwlock)
 /**
  * @brief Lock a read-write lock object for writing within specific time.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
+ * Waiting writers have priority over new readers.
  *
  * See IEEE 1003.1
  */
@@ -167,8 +150,7 @@ int pthread_rwlock_timedwrlock(pthread_rwlock_t *rwlock,
 /**
  * @brief Lock a read-write lock object for writing immediately.
  *
- * Write lock does not have priority over reader lock,
- * threads get lock based on priority.
+ * Waiting writers have priority over new readers.
  *
  * See IEEE 1003.1
  */
@@ -193,69 +175,28 @@ int pthread_rwlock_unlock(pthread_rwlock_t *rwlock)
 		return EINVAL;
 	}
 
-	if (k_current_get() == rwlock->wr_owner) {
-		/* Write unlock */
-		rwlock->wr_owner = NULL;
-		k_sem_give(&rwlock->reader_active);
-		k_sem_give(&rwlock->wr_sem);
-	} else {
-		/* Read unlock */
-		k_sem_give(&rwlock->rd_sem);
-
-		if (k_sem_count_get(&rwlock->rd_sem) ==
-				    CONCURRENT_READER_LIMIT) {
-			/* Last read lock, unlock writer */
-			k_sem_give(&rwlock->reader_active);
-		}
+	if (k_rwlock_unlock(&rwlock->rwlock) != 0) {
+		return EPERM;
 	}
+
 	return 0;
 }
 
 
 static uint32_t read_lock_acquire(pthread_rwlock_t *rwlock, int32_t timeout)
 {
-	uint32_t ret = 0U;
-
-	if (k_sem_take(&rwlock->wr_sem, SYS_TIMEOUT_MS(timeout)) == 0) {
-		k_sem_take(&rwlock->reader_active, K_NO_WAIT);
-		k_sem_take(&rwlock->rd_sem, K_NO_WAIT);
-		k_sem_give(&rwlock->wr_sem);
-	} else {
-		ret = EBUSY;
+	if (k_rwlock_read_lock(&rwlock->rwlock, SYS_TIMEOUT_MS(timeout)) != 0) {
+		return EBUSY;
 	}
 
-	return ret;
+	return 0U;
 }
 
 static uint32_t write_lock_acquire(pthread_rwlock_t *rwlock, int32_t timeout)
 {
-	uint32_t ret = 0U;
-	int64_t elapsed_time, st_time = k_uptime_get();
-	k_timeout_t k_timeout;
-
-	k_timeout = SYS_TIMEOUT_MS(timeout);
-
-	/* waiting for release of write lock */
-	if (k_sem_take(&rwlock->wr_sem, k_timeout) == 0) {
-		/* update remaining timeout time for 2nd sem */
-		if (timeout != SYS_FOREVER_MS) {
-			elapsed_time = k_uptime_get() - st_time;
-			timeout = timeout <= elapsed_time ? 0 :
-				  timeout - elapsed_time;
-		}
-
-		k_timeout = SYS_TIMEOUT_MS(timeout);
-
-		/* waiting for reader to complete operation */
-		if (k_sem_take(&rwlock->reader_active, k_timeout) == 0) {
-			rwlock->wr_owner = k_current_get();
-		} else {
-			k_sem_give(&rwlock->wr_sem);
-			ret = EBUSY;
-		}
-
-	} else {
-		ret = EBUSY;
+	if (k_rwlock_write_lock(&rwlock->rwlock, SYS_TIMEOUT_MS(timeout)) != 0) {
+		return EBUSY;
 	}
-	return ret;
+
+	return 0U;
 }
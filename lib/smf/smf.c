@@ -20,50 +20,74 @@ struct internal_ctx {
 	bool exit      : 1;
 };
 
-static bool share_paren(const struct smf_state *test_state,
-			const struct smf_state *target_state)
+static unsigned int get_depth_of(const struct smf_state *state)
 {
-	for (const struct smf_state *state = test_state;
-	     state != NULL;
-	     state = state->parent) {
-		if (target_state == state) {
-			return true;
-		}
+	unsigned int depth = 0;
+
+	for (; state != NULL; state = state->parent) {
+		depth++;
 	}
 
-	return false;
+	return depth;
 }
 
-static bool last_state_share_paren(struct smf_ctx *const ctx,
-				   const struct smf_state *state)
+/*
+ * Find the deepest state that is a strict ancestor of both states, or NULL if
+ * they have none in common. The ancestors below it are exited and entered by
+ * a transition from one state to the other.
+ */
+static const struct smf_state *get_lca_of(const struct smf_state *source,
+					  const struct smf_state *dest)
 {
-	/* Get parent state of previous state */
-	if (!ctx->previous) {
-		return false;
+	const struct smf_state *a = source->parent;
+	const struct smf_state *b = dest->parent;
+	unsigned int depth_a = get_depth_of(a);
+	unsigned int depth_b = get_depth_of(b);
+
+	for (; depth_a > depth_b; depth_a--) {
+		a = a->parent;
+	}
+
+	for (; depth_b > depth_a; depth_b--) {
+		b = b->parent;
 	}
 
-	return share_paren(ctx->previous->parent, state);
+	while (a != b) {
+		a = a->parent;
+		b = b->parent;
+	}
+
+	return a;
 }
 
-static const struct smf_state *get_child_of(const struct smf_state *states,
-					    const struct smf_state *parent)
+/*
+ * Execute the entry actions of the ancestors of a state below the given
+ * ancestor, outermost first.
+ */
+static bool smf_execute_entry_actions_below(struct smf_ctx *const ctx,
+					    const struct smf_state *state,
+					    const struct smf_state *topmost)
 {
-	for (const struct smf_state *tmp = states; ; tmp = tmp->parent) {
-		if (tmp->parent == parent) {
-			return tmp;
-		}
+	struct internal_ctx * const internal = (void *) &ctx->internal;
 
-		if (tmp->parent == NULL) {
-			return NULL;
-		}
+	if (state == topmost) {
+		return false;
 	}
 
-	return NULL;
-}
+	if (smf_execute_entry_actions_below(ctx, state->parent, topmost)) {
+		return true;
+	}
 
-static const struct smf_state *get_last_of(const struct smf_state *states)
-{
-	return get_child_of(states, NULL);
+	if (state->entry) {
+		state->entry(ctx);
+
+		/* No need to continue if terminate was set */
+		if (internal->terminate) {
+			return true;
+		}
+	}
+
+	return false;
 }
 
 /**
@@ -76,23 +100,11 @@ static const struct smf_state *get_last_of(const struct smf_state *states)
 __unused static bool smf_execute_ancestor_entry_actions(
 		struct smf_ctx *const ctx, const struct smf_state *target)
 {
-	struct internal_ctx * const internal = (void *) &ctx->internal;
+	/* Ancestors shared with the previous state have not been exited */
+	const struct smf_state *topmost = ctx->previous != NULL ?
+					  get_lca_of(ctx->previous, target) : NULL;
 
-	for (const struct smf_state *to_execute = get_last_of(target);
-	     to_execute != NULL && to_execute != target;
-	     to_execute = get_child_of(target, to_execute)) {
-		/* Execute parent state's entry */
-		if (!last_state_share_paren(ctx, to_execute) && to_execute->entry) {
-			to_execute->entry(ctx);
-
-			/* No need to continue if terminate was set */
-			if (internal->terminate) {
-				return true;
-			}
-		}
-	}
-
-	return false;
+	return smf_execute_entry_actions_below(ctx, target->parent, topmost);
 }
 
 /**
@@ -153,13 +165,15 @@ __unused static bool smf_execute_ancestor_exit_actions(
 		struct smf_ctx *const ctx, const struct smf_state *target)
 {
 	struct internal_ctx * const internal = (void *) &ctx->internal;
+	/* Ancestors shared with the target are not exited */
+	const struct smf_state *topmost = get_lca_of(ctx->current, target);
 
 	/* Execute all parent exit actions in reverse order */
 
 	for (const struct smf_state *tmp_state = ctx->current->parent;
-	     tmp_state != NULL;
+	     tmp_state != topmost;
 	     tmp_state = tmp_state->parent) {
-		if (!share_paren(target->parent, tmp_state) && tmp_state->exit) {
+		if (tmp_state->exit) {
 			tmp_state->exit(ctx);
 
 			/* No need to continue if terminate was set */
@@ -10,12 +10,129 @@
  * and has been previously avaialble from directory for that module
  * under name zfs_diskio.c.
  */
+#include <errno.h>
+#include <string.h>
 #include <ff.h>
 #include <diskio.h>	/* FatFs lower layer API */
+#include <zephyr/kernel.h>
 #include <zephyr/storage/disk_access.h>
 
 static const char * const pdrv_str[] = {FF_VOLUME_STRS};
 
+#ifdef CONFIG_FS_FATFS_READ_AHEAD
+/*
+ * Sequential reads of less than the read-ahead window are served from a
+ * window of CONFIG_FS_FATFS_READ_AHEAD_SECTORS sectors, read with a single
+ * multi-sector disk access.
+ */
+#define RA_SECTORS CONFIG_FS_FATFS_READ_AHEAD_SECTORS
+
+static struct {
+	uint8_t buf[RA_SECTORS * FF_MAX_SS] __aligned(FS_FATFS_WINDOW_ALIGNMENT);
+	/* Drive of the window and of the last read */
+	BYTE pdrv;
+	/* First sector and number of sectors in the window, 0 if empty */
+	LBA_t start;
+	UINT count;
+	/* Sector following the last read, for sequential access detection */
+	LBA_t next;
+	/* Sector size of the window */
+	uint32_t ss;
+} ra;
+
+static K_MUTEX_DEFINE(ra_lock);
+
+static int ra_fill(BYTE pdrv, LBA_t sector)
+{
+	uint32_t ss;
+	uint32_t sectors;
+	UINT count;
+
+	if ((disk_access_ioctl(pdrv_str[pdrv], DISK_IOCTL_GET_SECTOR_SIZE,
+			       &ss) != 0) || (ss == 0U) || (ss > FF_MAX_SS)) {
+		return -EIO;
+	}
+
+	if (disk_access_ioctl(pdrv_str[pdrv], DISK_IOCTL_GET_SECTOR_COUNT,
+			      &sectors) != 0) {
+		return -EIO;
+	}
+
+	/* Do not read past the end of the disk */
+	count = MIN(sizeof(ra.buf) / ss, RA_SECTORS);
+	if (sector >= sectors) {
+		return -EINVAL;
+	}
+	count = MIN(count, sectors - sector);
+
+	ra.count = 0;
+	if (disk_access_read(pdrv_str[pdrv], ra.buf, sector, count) != 0) {
+		return -EIO;
+	}
+
+	ra.pdrv = pdrv;
+	ra.start = sector;
+	ra.count = count;
+	ra.ss = ss;
+
+	return 0;
+}
+
+static inline bool ra_contains(BYTE pdrv, LBA_t sector, UINT count)
+{
+	return (ra.count != 0) && (ra.pdrv == pdrv) && (sector >= ra.start) &&
+	       ((sector + count) <= (ra.start + ra.count));
+}
+
+/*
+ * A read is sequential when it follows the previous read, or the window
+ * itself as FAT table accesses may be interleaved with file data reads.
+ */
+static inline bool ra_sequential(BYTE pdrv, LBA_t sector)
+{
+	return (ra.pdrv == pdrv) &&
+	       ((sector == ra.next) ||
+		((ra.count != 0) && (sector == (ra.start + ra.count))));
+}
+
+static DRESULT ra_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
+{
+	DRESULT res = RES_OK;
+
+	k_mutex_lock(&ra_lock, K_FOREVER);
+
+	if (!ra_contains(pdrv, sector, count) &&
+	    (!ra_sequential(pdrv, sector) || (ra_fill(pdrv, sector) != 0) ||
+	     !ra_contains(pdrv, sector, count))) {
+		/* Random access, or window could not be filled */
+		if (disk_access_read(pdrv_str[pdrv], buff, sector, count) != 0) {
+			res = RES_ERROR;
+		}
+	} else {
+		memcpy(buff, &ra.buf[(sector - ra.start) * ra.ss], count * ra.ss);
+	}
+
+	ra.pdrv = pdrv;
+	ra.next = sector + count;
+
+	k_mutex_unlock(&ra_lock);
+
+	return res;
+}
+
+static void ra_invalidate(BYTE pdrv, LBA_t sector, UINT count)
+{
+	k_mutex_lock(&ra_lock, K_FOREVER);
+
+	if ((ra.count != 0) && (ra.pdrv == pdrv) &&
+	    (sector < (ra.start + ra.count)) && ((sector + count) > ra.start)) {
+		ra.count = 0;
+	}
+
+	k_mutex_unlock(&ra_lock);
+}
+#endif /* CONFIG_FS_FATFS_READ_AHEAD */
+
 /* Get Drive Status */
 DSTATUS disk_status(BYTE pdrv)
 {
@@ -33,6 +150,10 @@ DSTATUS disk_initialize(BYTE pdrv)
 {
 	__ASSERT(pdrv < ARRAY_SIZE(pdrv_str), "pdrv out-of-range\n");
 
+#ifdef CONFIG_FS_FATFS_READ_AHEAD
+	ra_invalidate(pdrv, 0, ~(UINT)0);
+#endif
+
 	if (disk_access_init(pdrv_str[pdrv]) != 0) {
 		return STA_NOINIT;
 	} else {
@@ -45,6 +166,12 @@ DRESULT disk_read(BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
 {
 	__ASSERT(pdrv < ARRAY_SIZE(pdrv_str), "pdrv out-of-range\n");
 
+#ifdef CONFIG_FS_FATFS_READ_AHEAD
+	if (count < RA_SECTORS) {
+		return ra_read(pdrv, buff, sector, count);
+	}
+#endif
+
 	if (disk_access_read(pdrv_str[pdrv], buff, sector, count) != 0) {
 		return RES_ERROR;
 	} else {
@@ -58,6 +185,10 @@ DRESULT disk_write(BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
 {
 	__ASSERT(pdrv < ARRAY_SIZE(pdrv_str), "pdrv out-of-range\n");
 
+#ifdef CONFIG_FS_FATFS_READ_AHEAD
+	ra_invalidate(pdrv, sector, count);
+#endif
+
 	if (disk_access_write(pdrv_str[pdrv], buff, sector, count) != 0) {
 		return RES_ERROR;
 	} else {
@@ -43,6 +43,13 @@ void lvgl_wait_cb(lv_disp_drv_t *disp_drv)
 	k_sem_take(&flush_complete, K_FOREVER);
 }
 
+#else
+
+static void lvgl_flush_done(const struct device *dev, int result, void *user_data)
+{
+	lv_disp_flush_ready((lv_disp_drv_t *)user_data);
+}
+
 #endif /* CONFIG_LV_Z_FLUSH_THREAD */
 
 int set_lvgl_rendering_cb(lv_disp_drv_t *disp_drv)
@@ -108,12 +115,17 @@ void lvgl_flush_display(struct lvgl_display_flush *request)
 	/* Explicitly yield, in case the calling thread is a cooperative one */
 	k_yield();
 #else
-	/* Write directly to the display */
+	/*
+	 * Write directly to the display. Drivers supporting it return before
+	 * the data is sent, so LVGL can render into its other buffer meanwhile.
+	 */
 	struct lvgl_disp_data *data =
 		(struct lvgl_disp_data *)request->disp_drv->user_data;
 
-	display_write(data->display_dev, request->x, request->y,
-		      &request->desc, request->buf);
-	lv_disp_flush_ready(request->disp_drv);
+	if (display_write_async(data->display_dev, request->x, request->y,
+				&request->desc, request->buf, lvgl_flush_done,
+				request->disp_drv) != 0) {
+		lv_disp_flush_ready(request->disp_drv);
+	}
 #endif
 }
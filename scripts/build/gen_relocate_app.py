@@ -20,6 +20,10 @@ One can also specify the program header for a given memory region:
 
    SRAM2\\ :phdr0:COPY:/home/xyz/zephyr/samples/hello_world/src/main.c
 
+and a regular expression the name of the relocated sections must match:
+
+   SRAM2:COPY:^.text.main:/home/xyz/zephyr/samples/hello_world/src/main.c
+
 To invoke this script::
 
    python3 gen_relocate_app.py -i input_string -o generated_linker -c generated_code
@@ -43,6 +47,7 @@ import sys
 import argparse
 import os
 import glob
+import re
 import warnings
 from collections import defaultdict
 from enum import Enum
@@ -218,12 +223,13 @@ def region_is_default_ram(region_name: str) -> bool:
     return region_name == args.default_ram_region
 
 
-def find_sections(filename: str) -> 'dict[SectionKind, list[OutputSection]]':
+def find_sections(filename: str, section_filter: str = '') -> 'dict[SectionKind, list[OutputSection]]':
     """
     Locate relocatable sections in the given object file.
 
     The output value maps categories of sections to the list of actual sections
-    located in the object file that fit in that category.
+    located in the object file that fit in that category. If a filter is given,
+    only the sections whose name matches this regular expression are located.
     """
     obj_file_path = Path(filename)
 
@@ -240,6 +246,9 @@ def find_sections(filename: str) -> 'dict[SectionKind, list[OutputSection]]':
             if section_kind is None:
                 continue
 
+            if section_filter and not re.search(section_filter, section.name):
+                continue
+
             out[section_kind].append(
                 OutputSection(obj_file_path.name, section.name)
             )
@@ -486,22 +495,25 @@ def get_obj_filename(searchpath, filename):
 
 
 # Extracts all possible components for the input strin:
-# <mem_region>[\ :program_header]:<flag>:<file_name>
-# Returns a 4-tuple with them: (mem_region, program_header, flag, file_name)
-# If no `program_header` is defined, returns an empty string
+# <mem_region>[\ :program_header]:<flag>:[filter]:<file_name>
+# Returns a 5-tuple with them:
+# (mem_region, program_header, flag, filter, file_name)
+# If no `program_header` or `filter` is defined, returns an empty string
 def parse_input_string(line):
     line = line.replace(' :', ':')
 
     flag_sep = ':NOCOPY:' if ':NOCOPY' in line else ':COPY:'
-    mem_region_phdr, copy_flag, file_name = line.partition(flag_sep)
+    mem_region_phdr, copy_flag, filter_file_name = line.partition(flag_sep)
     copy_flag = copy_flag.replace(':', '')
 
     mem_region, _, phdr = mem_region_phdr.partition(':')
+    section_filter, _, file_name = filter_file_name.partition(':')
 
-    return mem_region, phdr, copy_flag, file_name
+    return mem_region, phdr, copy_flag, section_filter, file_name
 
 
-# Create a dict with key as memory type and files as a list of values.
+# Create a dict with key as memory type and a list of (file, section filter)
+# tuples as values.
 # Also, return another dict with program headers for memory regions
 def create_dict_wrt_mem():
     # need to support wild card *
@@ -515,7 +527,7 @@ def create_dict_wrt_mem():
         if ':' not in line:
             continue
 
-        mem_region, phdr, copy_flag, file_list = parse_input_string(line)
+        mem_region, phdr, copy_flag, section_filter, file_list = parse_input_string(line)
 
         # Handle any program header
         if phdr != '':
@@ -542,11 +554,12 @@ def create_dict_wrt_mem():
             print("Memory region ", mem_region, " Selected for files:", file_name_list)
 
         mem_region = "|".join((mem_region, copy_flag))
+        file_filter_list = [(file_name, section_filter) for file_name in file_name_list]
 
         if mem_region in rel_dict:
-            rel_dict[mem_region].extend(file_name_list)
+            rel_dict[mem_region].extend(file_filter_list)
         else:
-            rel_dict[mem_region] = file_name_list
+            rel_dict[mem_region] = file_filter_list
 
     return rel_dict, phdrs
 
@@ -570,13 +583,13 @@ def main():
     for memory_type, files in rel_dict.items():
         full_list_of_sections: 'dict[SectionKind, list[OutputSection]]' = defaultdict(list)
 
-        for filename in files:
+        for filename, section_filter in files:
             obj_filename = get_obj_filename(searchpath, filename)
             # the obj file wasn't found. Probably not compiled.
             if not obj_filename:
                 continue
 
-            file_sections = find_sections(obj_filename)
+            file_sections = find_sections(obj_filename, section_filter)
             # Merge sections from file into collection of sections for all files
             for category, sections in file_sections.items():
                 full_list_of_sections[category].extend(sections)
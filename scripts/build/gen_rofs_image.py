@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 Zephyr Project
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""Generate a read-only image file system (rofs) from a directory
+
+The image is the format read by subsys/fs/rofs.c, see
+include/zephyr/fs/rofs.h. It is usually converted with file2hex.py to be
+included in a constant array of the application.
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+ROFS_MAGIC = 0x53464f52
+ROFS_VERSION = 1
+ROFS_ROOT = 0xffff
+
+FS_DIR_ENTRY_FILE = 0
+FS_DIR_ENTRY_DIR = 1
+
+HEADER = struct.Struct('<IHHII')
+ENTRY = struct.Struct('<IIIHH')
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter, allow_abbrev=False)
+
+    parser.add_argument("-i", "--input-dir", required=True,
+                        help="Directory to generate the image from")
+    parser.add_argument("-o", "--output", required=True,
+                        help="Image file to generate")
+    parser.add_argument("-a", "--align", type=lambda x: int(x, 0), default=4,
+                        help="Alignment in bytes of the file contents in the "
+                        "image, defaults to 4")
+
+    return parser.parse_args()
+
+
+def collect(input_dir):
+    entries = []
+
+    for root, dirs, files in os.walk(input_dir):
+        dirs.sort()
+        rel = os.path.relpath(root, input_dir)
+        for name in dirs:
+            path = name if rel == '.' else f'{rel}/{name}'
+            entries.append((path.replace(os.sep, '/'), None))
+        for name in sorted(files):
+            path = name if rel == '.' else f'{rel}/{name}'
+            entries.append((path.replace(os.sep, '/'),
+                            os.path.join(root, name)))
+
+    # Entries are looked up by binary search on their UTF-8 path
+    entries.sort(key=lambda e: e[0].encode('utf-8'))
+
+    return entries
+
+
+def align(offset, alignment):
+    return (offset + alignment - 1) // alignment * alignment
+
+
+def generate(entries, alignment):
+    if len(entries) >= ROFS_ROOT:
+        sys.exit(f'Too many entries in rofs image: {len(entries)}')
+
+    index = {path: i for i, (path, _) in enumerate(entries)}
+    names = b''.join(path.encode('utf-8') + b'\0' for path, _ in entries)
+
+    names_offset = HEADER.size + ENTRY.size * len(entries)
+    offset = align(names_offset + len(names), alignment)
+
+    table = b''
+    data = b''
+    name_offset = names_offset
+    for path, source in entries:
+        parent = path.rpartition('/')[0]
+        parent_index = index[parent] if parent else ROFS_ROOT
+
+        if source is None:
+            table += ENTRY.pack(name_offset, 0, 0, FS_DIR_ENTRY_DIR,
+                                parent_index)
+        else:
+            with open(source, 'rb') as f:
+                content = f.read()
+            pad = align(offset + len(data), alignment) - offset - len(data)
+            data += b'\0' * pad
+            table += ENTRY.pack(name_offset, offset + len(data), len(content),
+                                FS_DIR_ENTRY_FILE, parent_index)
+            data += content
+
+        name_offset += len(path.encode('utf-8')) + 1
+
+    pad = offset - (names_offset + len(names))
+    image_size = offset + len(data)
+    header = HEADER.pack(ROFS_MAGIC, ROFS_VERSION, len(entries), image_size,
+                         alignment)
+
+    return header + table + names + b'\0' * pad + data
+
+
+def main():
+    args = parse_args()
+
+    if args.align <= 0 or (args.align & (args.align - 1)) != 0:
+        sys.exit(f'Alignment must be a power of two: {args.align}')
+
+    image = generate(collect(args.input_dir), args.align)
+
+    with open(args.output, 'wb') as f:
+        f.write(image)
+
+
+if __name__ == "__main__":
+    main()
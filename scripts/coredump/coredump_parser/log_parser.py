@@ -20,6 +20,7 @@ LOG_ARCH_HDR_SIZE = struct.calcsize(LOG_ARCH_HDR_STRUCT)
 
 COREDUMP_MEM_HDR_ID = b'M'
 COREDUMP_MEM_HDR_VER = 1
+COREDUMP_MEM_HDR_VER_RLE = 2
 LOG_MEM_HDR_STRUCT = "<cH"
 LOG_MEM_HDR_SIZE = struct.calcsize(LOG_MEM_HDR_STRUCT)
 
@@ -85,8 +86,9 @@ class CoredumpLogFile:
         hdr = self.fd.read(LOG_MEM_HDR_SIZE)
         _, hdr_ver = struct.unpack(LOG_MEM_HDR_STRUCT, hdr)
 
-        if hdr_ver != COREDUMP_MEM_HDR_VER:
-            logger.error(f"Memory block version: {hdr_ver}, expected {COREDUMP_MEM_HDR_VER}!")
+        if hdr_ver not in (COREDUMP_MEM_HDR_VER, COREDUMP_MEM_HDR_VER_RLE):
+            logger.error(f"Memory block version: {hdr_ver}, expected {COREDUMP_MEM_HDR_VER}"
+                         f" or {COREDUMP_MEM_HDR_VER_RLE}!")
             return False
 
         # Figure out how to read the start and end addresses
@@ -103,7 +105,12 @@ class CoredumpLogFile:
 
         size = eaddr - saddr
 
-        data = self.fd.read(size)
+        if hdr_ver == COREDUMP_MEM_HDR_VER_RLE:
+            data = self.read_rle(size)
+            if data is None:
+                return False
+        else:
+            data = self.fd.read(size)
 
         mem = {"start": saddr, "end": eaddr, "data": data}
         self.memory_regions.append(mem)
@@ -113,6 +120,29 @@ class CoredumpLogFile:
 
         return True
 
+    def read_rle(self, size):
+        # PackBits: control byte n < 128 is followed by n + 1 literal bytes,
+        # n > 128 by one byte repeated 257 - n times. 128 is a no-op.
+        data = bytearray()
+
+        while len(data) < size:
+            ctrl = self.fd.read(1)
+            if not ctrl:
+                logger.error("Memory block truncated")
+                return None
+
+            ctrl = ctrl[0]
+            if ctrl < 128:
+                data += self.fd.read(ctrl + 1)
+            elif ctrl > 128:
+                data += self.fd.read(1) * (257 - ctrl)
+
+        if len(data) != size:
+            logger.error("Memory block size does not match its content")
+            return None
+
+        return bytes(data)
+
     def parse(self):
         if self.fd is None:
             self.open()
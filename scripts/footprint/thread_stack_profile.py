@@ -0,0 +1,127 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2024 Zephyr Project
+#
+# SPDX-License-Identifier: Apache-2.0
+
+"""Recommend thread stack sizes from thread analyzer peak stack usage.
+
+Reads console or log captures containing the output of
+thread_analyzer_peak_print() (CONFIG_THREAD_ANALYZER_PEAK), possibly from
+several devices, and writes a Kconfig fragment with stack sizes for the
+threads of the kernel, networking, Bluetooth and shell subsystems, sized
+to the highest usage seen plus a margin. Other threads are listed as
+comments, since their stack size is set by the application.
+
+Example:
+
+    thread_stack_profile.py --margin 30 device1.log device2.log > stacks.conf
+    west build ... -- -DEXTRA_CONF_FILE=stacks.conf
+"""
+
+import argparse
+import re
+import sys
+
+# Line printed by thread_analyzer_peak_print(), possibly after a log prefix
+PEAK_RE = re.compile(r"([^:]+?)\s*: peak (\d+) / (\d+)\s*$")
+
+# Thread names, as set by the subsystems, and the options of their stacks
+THREAD_OPTIONS = [
+    (re.compile(r"main$"), "CONFIG_MAIN_STACK_SIZE"),
+    (re.compile(r"idle( \d+)?$"), "CONFIG_IDLE_STACK_SIZE"),
+    (re.compile(r"sysworkq$"), "CONFIG_SYSTEM_WORKQUEUE_STACK_SIZE"),
+    (re.compile(r"logging$"), "CONFIG_LOG_PROCESS_THREAD_STACK_SIZE"),
+    (re.compile(r"shell_"), "CONFIG_SHELL_STACK_SIZE"),
+    (re.compile(r"rx_q\["), "CONFIG_NET_RX_STACK_SIZE"),
+    (re.compile(r"tx_q\["), "CONFIG_NET_TX_STACK_SIZE"),
+    (re.compile(r"net_mgmt$"), "CONFIG_NET_MGMT_EVENT_STACK_SIZE"),
+    (re.compile(r"tcp_work$"), "CONFIG_NET_TCP_WORKQ_STACK_SIZE"),
+    (re.compile(r"BT RX$"), "CONFIG_BT_RX_STACK_SIZE"),
+    (re.compile(r"BT TX$"), "CONFIG_BT_HCI_TX_STACK_SIZE"),
+    (re.compile(r"BT_LW_WQ$"), "CONFIG_BT_LONG_WQ_STACK_SIZE"),
+]
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter,
+        allow_abbrev=False)
+    parser.add_argument("logs", nargs="+",
+                        help="console or log captures with thread stack peaks")
+    parser.add_argument("--margin", type=int, default=25,
+                        help="margin added to the peak usage, in percent "
+                             "(default: %(default)s)")
+    parser.add_argument("--align", type=int, default=64,
+                        help="stack sizes are rounded up to a multiple of "
+                             "this (default: %(default)s)")
+    return parser.parse_args()
+
+
+def read_peaks(logs):
+    """Return {thread name: (peak usage, stack size)} over all the logs."""
+    peaks = {}
+
+    for log in logs:
+        with open(log, encoding="utf-8", errors="replace") as f:
+            for line in f:
+                match = PEAK_RE.search(line)
+                if not match:
+                    continue
+
+                name = match.group(1).strip()
+                used = int(match.group(2))
+                size = int(match.group(3))
+
+                old_used, old_size = peaks.get(name, (0, 0))
+                peaks[name] = (max(used, old_used), max(size, old_size))
+
+    return peaks
+
+
+def option_of(name):
+    for regex, option in THREAD_OPTIONS:
+        if regex.match(name):
+            return option
+
+    return None
+
+
+def main():
+    args = parse_args()
+    peaks = read_peaks(args.logs)
+
+    if not peaks:
+        sys.exit("No thread stack peaks found")
+
+    # Several threads may share an option, e.g. the RX queues
+    options = {}
+    others = []
+
+    for name, (used, size) in sorted(peaks.items()):
+        option = option_of(name)
+        if option is None:
+            others.append((name, used, size))
+            continue
+
+        old_used, old_size, old_names = options.get(option, (0, 0, []))
+        options[option] = (max(used, old_used), max(size, old_size),
+                           old_names + [name])
+
+    print("# Stack sizes from the peak usage of threads, "
+          f"with a {args.margin} % margin")
+
+    for option, (used, size, names) in sorted(options.items()):
+        recommended = used * (100 + args.margin) // 100
+        recommended = -(-recommended // args.align) * args.align
+
+        print(f"# {', '.join(names)}: peak {used} / {size}")
+        print(f"{option}={recommended}")
+
+    for name, used, size in others:
+        print(f"# {name}: peak {used} / {size}, set by the application")
+
+
+if __name__ == "__main__":
+    main()
@@ -20,3 +20,8 @@ class LogParser(abc.ABC):
     def parse_log_data(self, logdata, debug=False):
         """Parse log data"""
         return None
+
+    def parse_log_stream(self, logdata, debug=False):
+        """Parse the complete messages at the beginning of log data
+        and return number of bytes parsed, or None on error"""
+        return None
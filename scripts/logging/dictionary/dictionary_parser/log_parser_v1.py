@@ -50,8 +50,23 @@ FMT_MSG_HDR_64 = "IQ"
 # Message type
 # 0: normal message
 # 1: number of dropped messages
+# 2: compact normal message
 FMT_MSG_TYPE = "B"
 
+# Need to keep sync with struct log_dict_output_compact_msg_hdr_t in
+# include/logging/log_output_dict.h.
+#
+# struct log_dict_output_compact_msg_hdr_t {
+#     uint8_t type;
+#     uint8_t seq;
+#     uint8_t domain:3;
+#     uint8_t level:3;
+# } __packed;
+#
+# followed by varint encoded source ID, zigzag encoded timestamp
+# difference, package length and data length.
+FMT_COMPACT_MSG_HDR = "BB"
+
 # Depends on CONFIG_LOG_TIMESTAMP_64BIT
 FMT_MSG_TIMESTAMP_32 = "I"
 FMT_MSG_TIMESTAMP_64 = "Q"
@@ -59,6 +74,7 @@ FMT_MSG_TIMESTAMP_64 = "Q"
 # Keep message types in sync with include/logging/log_output_dict.h
 MSG_TYPE_NORMAL = 0
 MSG_TYPE_DROPPED = 1
+MSG_TYPE_NORMAL_COMPACT = 2
 
 # Number of dropped messages
 FMT_DROPPED_CNT = "H"
@@ -67,6 +83,29 @@ FMT_DROPPED_CNT = "H"
 logger = logging.getLogger("parser")
 
 
+class IncompleteMessage(Exception):
+    """Log data ends before the end of the message"""
+
+
+def decode_varint(logdata, offset):
+    """Decode one LEB128 encoded value, return it with the offset after it"""
+    value = 0
+    shift = 0
+
+    while True:
+        if offset >= len(logdata):
+            raise IncompleteMessage()
+
+        one_byte = logdata[offset]
+        offset += 1
+
+        value |= (one_byte & 0x7F) << shift
+        shift += 7
+
+        if (one_byte & 0x80) == 0:
+            return value, offset
+
+
 def get_log_level_str_color(lvl):
     """Convert numeric log level to string"""
     if lvl < 0 or lvl >= len(LOG_LEVELS):
@@ -190,6 +229,14 @@ class LogParserV1(LogParser):
         else:
             self.fmt_msg_timestamp = endian + FMT_MSG_TIMESTAMP_32
 
+        self.fmt_compact_msg_hdr = endian + FMT_COMPACT_MSG_HDR
+        self.fmt_pkg_word = endian + "I"
+        self.timestamp_mask = (1 << (struct.calcsize(self.fmt_msg_timestamp) * 8)) - 1
+
+        # Sequence number and timestamp of the previous compact message
+        self.compact_seq = None
+        self.compact_timestamp = 0
+
         self.data_types = DataTypes(self.database)
 
 
@@ -361,6 +408,10 @@ class LogParserV1(LogParser):
 
     def parse_one_normal_msg(self, logdata, offset):
         """Parse one normal log message and print the encoded message"""
+        if offset + struct.calcsize(self.fmt_msg_hdr) + \
+           struct.calcsize(self.fmt_msg_timestamp) > len(logdata):
+            raise IncompleteMessage()
+
         # Parse log message header
         log_desc, source_id = struct.unpack_from(self.fmt_msg_hdr, logdata, offset)
         offset += struct.calcsize(self.fmt_msg_hdr)
@@ -379,6 +430,8 @@ class LogParserV1(LogParser):
 
         # Skip over data to point to next message (save as return value)
         next_msg_offset = offset + pkg_len + data_len
+        if next_msg_offset > len(logdata):
+            raise IncompleteMessage()
 
         # Offset from beginning of cbprintf_packaged data to end of va_list arguments
         offset_end_of_args = struct.unpack_from("B", logdata, offset)[0]
@@ -445,32 +498,125 @@ class LogParserV1(LogParser):
         return next_msg_offset
 
 
+    def parse_one_compact_msg(self, logdata, offset):
+        """Parse one compact log message and print the encoded message"""
+        if offset + struct.calcsize(self.fmt_compact_msg_hdr) > len(logdata):
+            raise IncompleteMessage()
+
+        seq, log_desc = struct.unpack_from(self.fmt_compact_msg_hdr, logdata, offset)
+        offset += struct.calcsize(self.fmt_compact_msg_hdr)
+
+        source_id, offset = decode_varint(logdata, offset)
+        ts_delta, offset = decode_varint(logdata, offset)
+        pkg_len, offset = decode_varint(logdata, offset)
+        data_len, offset = decode_varint(logdata, offset)
+
+        # Rebuild the package: words of the arguments section are
+        # varint encoded, the length in words is in the first byte.
+        pkg = b''
+        if pkg_len > 0:
+            word, offset = decode_varint(logdata, offset)
+            pkg = struct.pack(self.fmt_pkg_word, word)
+            args_len = min(pkg[0] * struct.calcsize(self.fmt_pkg_word), pkg_len)
+
+            while len(pkg) < args_len:
+                word, offset = decode_varint(logdata, offset)
+                pkg += struct.pack(self.fmt_pkg_word, word)
+
+            pkg = pkg[:args_len]
+
+        remaining = pkg_len - len(pkg) + data_len
+        if offset + remaining > len(logdata):
+            raise IncompleteMessage()
+
+        pkg += logdata[offset:(offset + remaining)]
+        offset += remaining
+
+        if self.compact_seq is not None and seq != self.compact_seq:
+            print(f"--- {(seq - self.compact_seq) & 0xFF} messages lost ---")
+
+        self.compact_seq = (seq + 1) & 0xFF
+
+        # Timestamps restart from 0 when the sequence number wraps
+        if seq == 0:
+            self.compact_timestamp = 0
+
+        ts_delta = (ts_delta >> 1) ^ -(ts_delta & 1)
+        self.compact_timestamp = (self.compact_timestamp + ts_delta) & self.timestamp_mask
+
+        # Convert to a normal message
+        log_desc = (log_desc & 0x3F) | (pkg_len << 6) | (data_len << 16)
+        msg = struct.pack(self.fmt_msg_hdr, log_desc, source_id)
+        msg += struct.pack(self.fmt_msg_timestamp, self.compact_timestamp)
+        msg += pkg
+
+        if self.parse_one_normal_msg(msg, 0) is None:
+            return None
+
+        return offset
+
+
+    def parse_one_msg(self, logdata, offset):
+        """Parse one log message of any type and return the offset
+        of the next message"""
+        # Get message type
+        msg_type = struct.unpack_from(self.fmt_msg_type, logdata, offset)[0]
+        offset += struct.calcsize(self.fmt_msg_type)
+
+        if msg_type == MSG_TYPE_DROPPED:
+            if offset + struct.calcsize(self.fmt_dropped_cnt) > len(logdata):
+                raise IncompleteMessage()
+
+            num_dropped = struct.unpack_from(self.fmt_dropped_cnt, logdata, offset)
+            offset += struct.calcsize(self.fmt_dropped_cnt)
+
+            print(f"--- {num_dropped} messages dropped ---")
+
+            return offset
+
+        if msg_type == MSG_TYPE_NORMAL:
+            return self.parse_one_normal_msg(logdata, offset)
+
+        if msg_type == MSG_TYPE_NORMAL_COMPACT:
+            return self.parse_one_compact_msg(logdata, offset)
+
+        logger.error("------ Unknown message type: %s", msg_type)
+        return None
+
+
     def parse_log_data(self, logdata, debug=False):
         """Parse binary log data and print the encoded log messages"""
         offset = 0
 
         while offset < len(logdata):
-            # Get message type
-            msg_type = struct.unpack_from(self.fmt_msg_type, logdata, offset)[0]
-            offset += struct.calcsize(self.fmt_msg_type)
+            try:
+                offset = self.parse_one_msg(logdata, offset)
+            except IncompleteMessage:
+                logger.error("------ Log data ends within a message")
+                return False
 
-            if msg_type == MSG_TYPE_DROPPED:
-                num_dropped = struct.unpack_from(self.fmt_dropped_cnt, logdata, offset)
-                offset += struct.calcsize(self.fmt_dropped_cnt)
+            if offset is None:
+                return False
 
-                print(f"--- {num_dropped} messages dropped ---")
+        return True
 
-            elif msg_type == MSG_TYPE_NORMAL:
-                ret = self.parse_one_normal_msg(logdata, offset)
-                if ret is None:
-                    return False
 
-                offset = ret
+    def parse_log_stream(self, logdata, debug=False):
+        """Parse the complete log messages at the beginning of binary
+        log data and return the number of bytes parsed"""
+        offset = 0
 
-            else:
-                logger.error("------ Unknown message type: %s", msg_type)
-                return False
+        while offset < len(logdata):
+            try:
+                ret = self.parse_one_msg(logdata, offset)
+            except IncompleteMessage:
+                break
 
-        return True
+            if ret is None:
+                return None
+
+            offset = ret
+
+        return offset
 
 colorama.init()
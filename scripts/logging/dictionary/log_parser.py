@@ -15,6 +15,7 @@ import argparse
 import binascii
 import logging
 import sys
+import time
 
 import dictionary_parser
 from dictionary_parser.log_database import LogDatabase
@@ -25,6 +26,9 @@ logger = logging.getLogger("parser")
 
 LOG_HEX_SEP = "##ZLOGV1##"
 
+# Seconds to wait for more data when parsing a live log file
+LIVE_POLL_INTERVAL = 0.1
+
 
 def parse_args():
     """Parse command line arguments"""
@@ -36,6 +40,10 @@ def parse_args():
                            help="Log Data file is in hexadecimal strings")
     argparser.add_argument("--rawhex", action="store_true",
                            help="Log file only contains hexadecimal log data")
+    argparser.add_argument("--live", action="store_true",
+                           help="Keep parsing binary log data as it is written to "
+                                "the log data file, e.g. a serial port, or to stdin "
+                                "if the log data file is -")
     argparser.add_argument("--debug", action="store_true",
                            help="Print extra debugging information")
 
@@ -101,6 +109,49 @@ def read_log_file(args):
     return logdata
 
 
+def parse_live(args, log_parser):
+    """
+    Parse binary log data as it arrives until end of stdin or interrupted
+    """
+    # Unbuffered so that reads return whatever data is available
+    if args.logfile == "-":
+        logfile = sys.stdin.buffer.raw
+    else:
+        logfile = open(args.logfile, "rb", buffering=0)
+
+    logdata = b''
+
+    try:
+        while True:
+            data = logfile.read(4096)
+            if not data:
+                if logfile is sys.stdin.buffer.raw:
+                    break
+
+                # Wait for more data to be appended to the file
+                time.sleep(LIVE_POLL_INTERVAL)
+                continue
+
+            logdata += data
+            parsed = log_parser.parse_log_stream(logdata, debug=args.debug)
+            if parsed is None:
+                return False
+
+            logdata = logdata[parsed:]
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        if logfile is not sys.stdin.buffer.raw:
+            logfile.close()
+
+    if len(logdata) != 0:
+        logger.error("ERROR: log data ends within a message")
+        return False
+
+    return True
+
+
 def main():
     """Main function of log parser"""
     args = parse_args()
@@ -118,11 +169,16 @@ def main():
         logger.error("ERROR: Cannot open database file: %s, exiting...", args.dbfile)
         sys.exit(1)
 
-    logdata = read_log_file(args)
-    if logdata is None:
-        logger.error("ERROR: cannot read log from file: %s, exiting...", args.logfile)
+    if args.live and args.hex:
+        logger.error("ERROR: live parsing only supports binary log data, exiting...")
         sys.exit(1)
 
+    if not args.live:
+        logdata = read_log_file(args)
+        if logdata is None:
+            logger.error("ERROR: cannot read log from file: %s, exiting...", args.logfile)
+            sys.exit(1)
+
     log_parser = dictionary_parser.get_parser(database)
     if log_parser is not None:
         logger.debug("# Build ID: %s", database.get_build_id())
@@ -132,7 +188,10 @@ def main():
         else:
             logger.debug("# Endianness: Big")
 
-        ret = log_parser.parse_log_data(logdata, debug=args.debug)
+        if args.live:
+            ret = parse_live(args, log_parser)
+        else:
+            ret = log_parser.parse_log_data(logdata, debug=args.debug)
         if not ret:
             logger.error("ERROR: there were error(s) parsing log data")
             sys.exit(1)
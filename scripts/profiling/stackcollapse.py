@@ -0,0 +1,131 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2023 The Zephyr Project Contributors
+#
+# SPDX-License-Identifier: Apache-2.0
+"""
+Convert the output of the perf shell command to folded stacks, one line
+per distinct stack followed by its number of samples, as consumed by
+flamegraph.pl or speedscope:
+
+    uart:~$ perf record 1000 100
+    uart:~$ perf printbuf
+
+    ./scripts/profiling/stackcollapse.py build/zephyr/zephyr.elf perf.log \\
+        | flamegraph.pl > perf.svg
+
+Samples hold the program counter and link register of the interrupted
+code. The link register is only a valid return address in leaf functions,
+so it is used as caller only when it resolves to a different function.
+"""
+
+import argparse
+import bisect
+import re
+import sys
+from collections import Counter
+
+from elftools.elf.elffile import ELFFile
+from elftools.elf.sections import SymbolTableSection
+
+THREAD_RE = re.compile(r"thread (0x[0-9a-fA-F]+) (\S+)")
+SAMPLE_RE = re.compile(r"sample (\d+) (0x[0-9a-fA-F]+) ([0-9a-fA-F]+) ([0-9a-fA-F]+)")
+LOST_RE = re.compile(r"lost (\d+) (\d+)")
+
+
+class Symbols:
+    def __init__(self, elf_path):
+        self.starts = []
+        self.syms = []
+
+        with open(elf_path, "rb") as f:
+            elf = ELFFile(f)
+            # Thumb code has bit 0 set in the symbol value
+            mask = ~1 if elf["e_machine"] == "EM_ARM" else ~0
+            funcs = []
+
+            for section in elf.iter_sections():
+                if not isinstance(section, SymbolTableSection):
+                    continue
+
+                for sym in section.iter_symbols():
+                    if sym["st_info"]["type"] != "STT_FUNC" or not sym.name:
+                        continue
+                    start = sym["st_value"] & mask
+                    funcs.append((start, start + max(sym["st_size"], 1), sym.name))
+
+        for start, end, name in sorted(funcs):
+            self.starts.append(start)
+            self.syms.append((end, name))
+
+    def lookup(self, addr):
+        i = bisect.bisect_right(self.starts, addr) - 1
+        if i < 0 or addr >= self.syms[i][0]:
+            return None
+        return self.syms[i][1]
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+            description=__doc__,
+            formatter_class=argparse.RawDescriptionHelpFormatter, allow_abbrev=False)
+    parser.add_argument("elf", help="zephyr.elf of the profiled image")
+    parser.add_argument("log", nargs="?", type=argparse.FileType("r"),
+            default=sys.stdin, help="perf printbuf output, default stdin")
+    parser.add_argument("--per-cpu", action="store_true",
+            help="use the CPU as the root frame of every stack")
+    return parser.parse_args()
+
+
+def main():
+    args = parse_args()
+    symbols = Symbols(args.elf)
+    threads = {}
+    stacks = Counter()
+    lost = 0
+
+    for line in args.log:
+        m = THREAD_RE.search(line)
+        if m:
+            threads[int(m.group(1), 16)] = m.group(2)
+            continue
+
+        m = LOST_RE.search(line)
+        if m:
+            lost += int(m.group(2))
+            continue
+
+        m = SAMPLE_RE.search(line)
+        if not m:
+            continue
+
+        cpu = m.group(1)
+        thread = int(m.group(2), 16)
+        pc = int(m.group(3), 16)
+        lr = int(m.group(4), 16)
+
+        frames = []
+        if args.per_cpu:
+            frames.append(f"cpu{cpu}")
+        name = threads.get(thread, "-")
+        frames.append(f"{hex(thread)}" if name == "-" else name)
+
+        func = symbols.lookup(pc) if pc else None
+        # The return address may be just past the end of the caller
+        caller = symbols.lookup((lr & ~1) - 1) if lr else None
+        if caller is not None and caller != func:
+            frames.append(caller)
+        frames.append(func if func is not None else f"[{hex(pc) if pc else 'unknown'}]")
+
+        stacks[";".join(frames)] += 1
+
+    for stack, count in sorted(stacks.items()):
+        print(f"{stack} {count}")
+
+    if lost:
+        print(f"{lost} samples were lost, increase CONFIG_PROFILING_PERF_BUFFER_SIZE",
+              file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
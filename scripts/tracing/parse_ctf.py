@@ -80,6 +80,9 @@ def main():
                 ]:
 
             cpu = event.payload_field.get("cpu", None)
+            if cpu is None and event.common_context_field is not None:
+                # Set with CONFIG_TRACING_PER_CPU_BUFFERS
+                cpu = event.common_context_field.get("cpu_id", None)
             thread_id = event.payload_field.get("thread_id", None)
             thread_name = event.payload_field.get("name", None)
 
@@ -1623,6 +1623,19 @@ void isoal_source_destroy(isoal_source_handle_t hdl)
 	/* Atomic disable */
 	isoal_source_disable(hdl);
 
+#if defined(CONFIG_BT_CTLR_ISOAL_PROFILE)
+	if (hdl < ARRAY_SIZE(isoal_global.source_state)) {
+		const struct isoal_tx_profile *profile =
+			&isoal_global.source_state[hdl].profile;
+
+		LOG_INF("Source %u: frags= %u, pdus= %u, cycles min= %u max= %u avg= %u",
+			hdl, profile->sdu_frags, profile->pdus,
+			profile->cycles_min, profile->cycles_max,
+			profile->sdu_frags ?
+			(uint32_t)(profile->cycles_total / profile->sdu_frags) : 0U);
+	}
+#endif /* CONFIG_BT_CTLR_ISOAL_PROFILE */
+
 	/* Permit allocation anew */
 	isoal_source_deallocate(hdl);
 }
@@ -1812,6 +1825,9 @@ static isoal_status_t isoal_tx_try_emit_pdu(struct isoal_source *source,
 					pp->sdu_fragments,
 					pp->payload_number,
 					pp->pdu_written);
+#if defined(CONFIG_BT_CTLR_ISOAL_PROFILE)
+		source->profile.pdus++;
+#endif /* CONFIG_BT_CTLR_ISOAL_PROFILE */
 		pp->payload_number++;
 		pp->sdu_fragments = 0;
 		pp->pdu_allocated = 0U;
@@ -2800,6 +2816,43 @@ static isoal_status_t isoal_tx_framed_event_prepare_handle(isoal_source_handle_t
 	return err;
 }
 
+#if defined(CONFIG_BT_CTLR_ISOAL_PROFILE)
+static void isoal_tx_profile_update(struct isoal_tx_profile *profile,
+				    uint32_t cycles)
+{
+	if ((profile->sdu_frags == 0U) || (cycles < profile->cycles_min)) {
+		profile->cycles_min = cycles;
+	}
+
+	if (cycles > profile->cycles_max) {
+		profile->cycles_max = cycles;
+	}
+
+	profile->cycles_last = cycles;
+	profile->cycles_total += cycles;
+	profile->sdu_frags++;
+}
+
+/**
+ * @brief  Get the TX path profile of a source
+ * @param  source_hdl Handle of the source
+ * @param  profile    Copy of the profile gathered since the source was created
+ * @return            Operation status
+ */
+isoal_status_t isoal_tx_get_profile(isoal_source_handle_t source_hdl,
+				    struct isoal_tx_profile *profile)
+{
+	isoal_status_t err;
+
+	err = isoal_check_source_hdl_valid(source_hdl);
+	if (err == ISOAL_STATUS_OK) {
+		*profile = isoal_global.source_state[source_hdl].profile;
+	}
+
+	return err;
+}
+#endif /* CONFIG_BT_CTLR_ISOAL_PROFILE */
+
 /**
  * @brief Deep copy a SDU, fragment into PDU(s)
  * @details Fragmentation will occur individually for every enabled source
@@ -2814,11 +2867,18 @@ isoal_status_t isoal_tx_sdu_fragment(isoal_source_handle_t source_hdl,
 	struct isoal_source_session *session;
 	struct isoal_source *source;
 	isoal_status_t err;
+#if defined(CONFIG_BT_CTLR_ISOAL_PROFILE)
+	uint32_t cycles_start;
+#endif /* CONFIG_BT_CTLR_ISOAL_PROFILE */
 
 	source = &isoal_global.source_state[source_hdl];
 	session = &source->session;
 	err = ISOAL_STATUS_ERR_PDU_ALLOC;
 
+#if defined(CONFIG_BT_CTLR_ISOAL_PROFILE)
+	cycles_start = k_cycle_get_32();
+#endif /* CONFIG_BT_CTLR_ISOAL_PROFILE */
+
 	/* Set source context active to mutually exclude ISO Event prepare
 	 * kick.
 	 */
@@ -2844,6 +2904,10 @@ isoal_status_t isoal_tx_sdu_fragment(isoal_source_handle_t source_hdl,
 
 	source->context_active = 0U;
 
+#if defined(CONFIG_BT_CTLR_ISOAL_PROFILE)
+	isoal_tx_profile_update(&source->profile, k_cycle_get_32() - cycles_start);
+#endif /* CONFIG_BT_CTLR_ISOAL_PROFILE */
+
 	if (source->timeout_trigger) {
 		source->timeout_trigger = 0U;
 		if (session->framed) {
@@ -400,6 +400,20 @@ struct isoal_pdu_production {
 	isoal_pdu_len_t           last_seg_hdr_loc;
 };
 
+#if defined(CONFIG_BT_CTLR_ISOAL_PROFILE)
+struct isoal_tx_profile {
+	/* SDU fragments processed */
+	uint32_t sdu_frags;
+	/* PDUs emitted towards the LL */
+	uint32_t pdus;
+	/* CPU cycles spent fragmenting an SDU fragment into PDUs */
+	uint32_t cycles_last;
+	uint32_t cycles_min;
+	uint32_t cycles_max;
+	uint64_t cycles_total;
+};
+#endif /* CONFIG_BT_CTLR_ISOAL_PROFILE */
+
 struct isoal_source {
 	/* Session-constant */
 	struct isoal_source_session session;
@@ -407,6 +421,11 @@ struct isoal_source {
 	/* State for PDU production */
 	struct isoal_pdu_production pdu_production;
 
+#if defined(CONFIG_BT_CTLR_ISOAL_PROFILE)
+	/* TX path profile, kept across enable / disable */
+	struct isoal_tx_profile profile;
+#endif /* CONFIG_BT_CTLR_ISOAL_PROFILE */
+
 	/* Context Control */
 	uint64_t timeout_event_count:39;
 	uint64_t timeout_trigger:1;
@@ -492,3 +511,8 @@ isoal_status_t isoal_tx_get_sync_info(isoal_source_handle_t source_hdl,
 
 void isoal_tx_event_prepare(isoal_source_handle_t source_hdl,
 			    uint64_t event_number);
+
+#if defined(CONFIG_BT_CTLR_ISOAL_PROFILE)
+isoal_status_t isoal_tx_get_profile(isoal_source_handle_t source_hdl,
+				    struct isoal_tx_profile *profile);
+#endif /* CONFIG_BT_CTLR_ISOAL_PROFILE */
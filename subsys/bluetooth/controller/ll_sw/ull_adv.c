@@ -1068,6 +1068,10 @@ uint8_t ll_adv_enable(uint8_t enable)
 		conn->connect_expire = 6;
 		conn->supervision_expire = 0;
 
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+		memset(&conn->sched_stats, 0, sizeof(conn->sched_stats));
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
 #if defined(CONFIG_BT_CTLR_LE_PING)
 		conn->apto_expire = 0U;
 		conn->appto_expire = 0U;
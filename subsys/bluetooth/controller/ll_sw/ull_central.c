@@ -268,6 +268,10 @@ uint8_t ll_create_connection(uint16_t scan_interval, uint16_t scan_window,
 
 	conn->connect_expire = CONN_ESTAB_COUNTDOWN;
 	conn->supervision_expire = 0U;
+
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+	memset(&conn->sched_stats, 0, sizeof(conn->sched_stats));
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
 	conn_interval_us = (uint32_t)interval * CONN_INT_UNIT_US;
 	conn->supervision_timeout = timeout;
 
@@ -918,6 +922,13 @@ void ull_central_ticker_cb(uint32_t ticks_at_expire, uint32_t ticks_drift,
 	    (lazy != TICKER_LAZY_MUST_EXPIRE)) {
 		int ret;
 
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+		/* Central role does not apply latency, every lazy expiry is
+		 * an event skipped due to an overlapping role.
+		 */
+		conn->sched_stats.skipped += lazy;
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
 		/* Handle any LL Control Procedures */
 		ret = ull_conn_llcp(conn, ticks_at_expire, remainder, lazy);
 		if (ret) {
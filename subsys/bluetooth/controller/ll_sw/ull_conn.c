@@ -97,6 +97,11 @@ static void tx_lll_flush(void *param);
 static int empty_data_start_release(struct ll_conn *conn, struct node_tx *tx);
 #endif /* CONFIG_BT_CTLR_LLID_DATA_START_EMPTY */
 
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+static void sched_stats_update(struct ll_conn *conn,
+			       struct node_rx_event_done *done);
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
 #if defined(CONFIG_BT_CTLR_CONN_PARAM_REQ)
 /* Connection context pointer used as CPR mutex to serialize connection
  * parameter requests procedures across simulataneous connections so that
@@ -955,6 +960,10 @@ void ull_conn_done(struct node_rx_event_done *done)
 		return;
 	}
 
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+	sched_stats_update(conn, done);
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
 	ull_cp_tx_ntf(conn);
 
 #if defined(CONFIG_BT_CTLR_LE_ENC)
@@ -1803,6 +1812,13 @@ static void conn_cleanup(struct ll_conn *conn, uint8_t reason)
 	cpr_active_check_and_reset(conn);
 #endif /* CONFIG_BT_CTLR_CONN_PARAM_REQ */
 
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+	LOG_INF("handle %u sched: done= %u, skipped= %u, aborted= %u, missed= %u.",
+		conn->lll.handle, conn->sched_stats.done,
+		conn->sched_stats.skipped, conn->sched_stats.aborted,
+		conn->sched_stats.missed);
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
 	/* Only termination structure is populated here in ULL context
 	 * but the actual enqueue happens in the LLL context in
 	 * tx_lll_flush. The reason being to avoid passing the reason
@@ -1827,6 +1843,21 @@ static void conn_cleanup(struct ll_conn *conn, uint8_t reason)
 	conn_cleanup_finalize(conn);
 }
 
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+static void sched_stats_update(struct ll_conn *conn,
+			       struct node_rx_event_done *done)
+{
+	conn->sched_stats.done++;
+
+	if (conn->lll.latency_prepare) {
+		/* Aborted in the prepare pipeline by an overlapping role */
+		conn->sched_stats.aborted++;
+	} else if (!done->extra.trx_cnt) {
+		conn->sched_stats.missed++;
+	}
+}
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
+
 static void tx_ull_flush(struct ll_conn *conn)
 {
 	struct node_tx *tx;
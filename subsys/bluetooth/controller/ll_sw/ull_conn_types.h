@@ -249,6 +249,15 @@ struct ll_conn {
 	/* Detect empty L2CAP start frame */
 	uint8_t  start_empty:1;
 #endif /* CONFIG_BT_CTLR_LLID_DATA_START_EMPTY */
+
+#if defined(CONFIG_BT_CTLR_SCHED_STATS)
+	struct {
+		uint32_t done;    /* Event done count */
+		uint32_t skipped; /* Ticker expiries skipped (central only) */
+		uint32_t aborted; /* Aborted in the prepare pipeline */
+		uint32_t missed;  /* Radio time given, no PDU exchanged */
+	} sched_stats;
+#endif /* CONFIG_BT_CTLR_SCHED_STATS */
 }; /* struct ll_conn */
 
 struct node_rx_cc {
@@ -56,6 +56,10 @@ struct tx_meta {
 	bool is_cont;
 	/* Indicates whether the ISO PDU contains a timestamp */
 	bool iso_has_ts;
+#if defined(CONFIG_BT_CONN_TX_STATS)
+	/* Cycle count when the buffer was queued */
+	uint32_t queued;
+#endif /* CONFIG_BT_CONN_TX_STATS */
 };
 
 BUILD_ASSERT(sizeof(struct tx_meta) == CONFIG_BT_CONN_TX_USER_DATA_SIZE,
@@ -482,6 +486,9 @@ int bt_conn_send_cb(struct bt_conn *conn, struct net_buf *buf,
 	}
 
 	tx_data(buf)->is_cont = false;
+#if defined(CONFIG_BT_CONN_TX_STATS)
+	tx_data(buf)->queued = k_cycle_get_32();
+#endif /* CONFIG_BT_CONN_TX_STATS */
 
 	net_buf_put(&conn->tx_queue, buf);
 	return 0;
@@ -656,6 +663,44 @@ fail:
 	return err;
 }
 
+#if defined(CONFIG_BT_CONN_TX_STATS)
+static void tx_stats_update(struct bt_conn *conn, struct net_buf *buf)
+{
+	struct bt_conn_tx_stats *stats = &conn->tx_stats;
+	uint32_t latency;
+
+	latency = k_cyc_to_us_floor32(k_cycle_get_32() - tx_data(buf)->queued);
+
+	stats->packets++;
+	stats->latency_total_us += latency;
+	stats->latency_max_us = MAX(stats->latency_max_us, latency);
+}
+
+int bt_conn_tx_stats_get(struct bt_conn *conn, struct bt_conn_tx_stats *stats,
+			 bool reset)
+{
+	unsigned int key;
+
+	/* The statistics are updated from the TX thread */
+	key = irq_lock();
+
+	*stats = conn->tx_stats;
+	if (reset) {
+		(void)memset(&conn->tx_stats, 0, sizeof(conn->tx_stats));
+	}
+
+	irq_unlock(key);
+
+	return 0;
+}
+#else
+static inline void tx_stats_update(struct bt_conn *conn, struct net_buf *buf)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(buf);
+}
+#endif /* CONFIG_BT_CONN_TX_STATS */
+
 static int send_frag(struct bt_conn *conn,
 		     struct net_buf *buf, struct net_buf *frag,
 		     uint8_t flags)
@@ -680,6 +725,8 @@ static int send_frag(struct bt_conn *conn,
 		 */
 		buf = net_buf_get(&conn->tx_queue, K_NO_WAIT);
 		frag = buf;
+
+		tx_stats_update(conn, buf);
 	}
 
 	return do_send_frag(conn, frag, flags);
@@ -861,6 +908,11 @@ static int conn_prepare_events(struct bt_conn *conn,
 	return 0;
 }
 
+#if defined(CONFIG_BT_CONN)
+/* First ACL connection the TX thread polls on */
+static uint8_t tx_rr_start;
+#endif /* CONFIG_BT_CONN */
+
 int bt_conn_prepare_events(struct k_poll_event events[])
 {
 	int i, ev_count = 0;
@@ -874,13 +926,19 @@ int bt_conn_prepare_events(struct k_poll_event events[])
 			  K_POLL_MODE_NOTIFY_ONLY, &conn_change);
 
 #if defined(CONFIG_BT_CONN)
+	/* The TX thread serves the ready connections in the order of the
+	 * events, so rotate where the order starts to not always favour the
+	 * first connections when controller buffers are scarce.
+	 */
 	for (i = 0; i < ARRAY_SIZE(acl_conns); i++) {
-		conn = &acl_conns[i];
+		conn = &acl_conns[(tx_rr_start + i) % ARRAY_SIZE(acl_conns)];
 
 		if (!conn_prepare_events(conn, &events[ev_count])) {
 			ev_count++;
 		}
 	}
+
+	tx_rr_start = (tx_rr_start + 1) % ARRAY_SIZE(acl_conns);
 #endif /* CONFIG_BT_CONN */
 
 #if defined(CONFIG_BT_ISO)
@@ -910,33 +968,44 @@ void bt_conn_process_tx(struct bt_conn *conn)
 		return;
 	}
 
-	/* Get next ACL packet for connection. The buffer will only get dequeued
-	 * if there is a free controller buffer to put it in.
-	 *
-	 * Important: no operations should be done on `buf` until it is properly
-	 * dequeued from the FIFO, using the `net_buf_get()` API.
-	 */
-	buf = k_fifo_peek_head(&conn->tx_queue);
-	BT_ASSERT(buf);
+	for (int i = 0; i < CONFIG_BT_CONN_TX_BURST; i++) {
+		/* Get next ACL packet for connection. The buffer will only get
+		 * dequeued if there is a free controller buffer to put it in.
+		 *
+		 * Important: no operations should be done on `buf` until it is
+		 * properly dequeued from the FIFO, using the `net_buf_get()` API.
+		 */
+		buf = k_fifo_peek_head(&conn->tx_queue);
+		if (!buf) {
+			/* Queue drained within the burst */
+			BT_ASSERT(i > 0);
+			return;
+		}
 
-	/* Since we used `peek`, the queue still owns the reference to the
-	 * buffer, so we need to take an explicit additional reference here.
-	 */
-	buf = net_buf_ref(buf);
-	err = send_buf(conn, buf);
-	net_buf_unref(buf);
+		/* Since we used `peek`, the queue still owns the reference to
+		 * the buffer, so we need to take an explicit additional
+		 * reference here.
+		 */
+		buf = net_buf_ref(buf);
+		err = send_buf(conn, buf);
+		net_buf_unref(buf);
 
-	if (err  == -EIO) {
-		struct bt_conn_tx *tx = tx_data(buf)->tx;
+		if (err == -EIO) {
+			struct bt_conn_tx *tx = tx_data(buf)->tx;
 
-		tx_data(buf)->tx = NULL;
+			tx_data(buf)->tx = NULL;
 
-		/* destroy the buffer */
-		net_buf_unref(buf);
+			/* destroy the buffer */
+			net_buf_unref(buf);
 
-		/* destroy the tx context (and any associated meta-data) */
-		if (tx) {
-			conn_tx_destroy(conn, tx);
+			/* destroy the tx context (and any associated meta-data) */
+			if (tx) {
+				conn_tx_destroy(conn, tx);
+			}
+		}
+
+		if (err) {
+			return;
 		}
 	}
 }
@@ -193,6 +193,9 @@ struct bt_conn {
 
 	/* Queue for outgoing ACL data */
 	struct k_fifo		tx_queue;
+#if defined(CONFIG_BT_CONN_TX_STATS)
+	struct bt_conn_tx_stats tx_stats;
+#endif /* CONFIG_BT_CONN_TX_STATS */
 
 	/* Active L2CAP channels */
 	sys_slist_t		channels;
@@ -12,6 +12,7 @@
 
 #include "ecc.h"
 #include "hci_core.h"
+#include "hci_ecc.h"
 
 #define LOG_LEVEL CONFIG_BT_HCI_CORE_LOG_LEVEL
 #include <zephyr/logging/log.h>
@@ -202,6 +203,59 @@ int bt_dh_key_gen(const uint8_t remote_pk[BT_PUB_KEY_LEN], bt_dh_key_cb_t cb)
 	return 0;
 }
 
+#if defined(CONFIG_BT_TINYCRYPT_ECC_PARALLEL)
+static void dh_key_job_done(struct k_work *work)
+{
+	struct bt_dh_key_job *job = CONTAINER_OF(work, struct bt_dh_key_job,
+						 done);
+	bt_dh_key_job_cb_t cb = job->func;
+
+	LOG_DBG("job %p err %d waited %u us computed in %u us", job, job->err,
+		k_cyc_to_us_floor32(job->started - job->submitted),
+		k_cyc_to_us_floor32(job->completed - job->started));
+
+	/* The job may be resubmitted from the callback */
+	atomic_clear(&job->busy);
+
+	cb(job, job->err ? NULL : job->dhkey);
+}
+
+int bt_dh_key_job_submit(struct bt_dh_key_job *job,
+			 const uint8_t remote_pk[BT_PUB_KEY_LEN],
+			 bt_dh_key_job_cb_t cb)
+{
+	int err;
+
+	if (atomic_test_bit(bt_dev.flags, BT_DEV_PUB_KEY_BUSY)) {
+		return -EBUSY;
+	}
+
+	if (!atomic_test_bit(bt_dev.flags, BT_DEV_HAS_PUB_KEY)) {
+		return -EADDRNOTAVAIL;
+	}
+
+	if (!atomic_cas(&job->busy, 0, 1)) {
+		return -EINPROGRESS;
+	}
+
+	k_work_init(&job->done, dh_key_job_done);
+	job->func = cb;
+	job->debug = IS_ENABLED(CONFIG_BT_USE_DEBUG_KEYS);
+	job->err = 0;
+	memcpy(job->remote_pk, remote_pk, BT_PUB_KEY_LEN);
+	job->submitted = k_cycle_get_32();
+
+	err = bt_hci_ecc_dhkey_job(job);
+	if (err) {
+		atomic_clear(&job->busy);
+		LOG_WRN("Failed to submit DHKey job (err %d)", err);
+		return err;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_BT_TINYCRYPT_ECC_PARALLEL */
+
 void bt_hci_evt_le_pkey_complete(struct net_buf *buf)
 {
 	struct bt_hci_evt_le_p256_public_key_complete *evt = (void *)buf->data;
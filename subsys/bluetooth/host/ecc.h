@@ -92,3 +92,54 @@ typedef void (*bt_dh_key_cb_t)(const uint8_t key[BT_DH_KEY_LEN]);
  *  @return Zero on success or negative error code otherwise
  */
 int bt_dh_key_gen(const uint8_t remote_pk[BT_PUB_KEY_LEN], bt_dh_key_cb_t cb);
+
+#if defined(CONFIG_BT_TINYCRYPT_ECC_PARALLEL)
+struct bt_dh_key_job;
+
+/*  @typedef bt_dh_key_job_cb_t
+ *  @brief Callback type for DH Key job completion.
+ *
+ *  Called from the Bluetooth RX context once the job is done.
+ *
+ *  @param job The completed job.
+ *  @param key The DH Key, or NULL in case of failure.
+ */
+typedef void (*bt_dh_key_job_cb_t)(struct bt_dh_key_job *job,
+				   const uint8_t key[BT_DH_KEY_LEN]);
+
+/*  @brief DH Key calculation job.
+ *
+ *  Unlike bt_dh_key_gen(), which serializes all requests through the HCI
+ *  commands, any number of jobs may be in progress at the same time. They
+ *  are computed by a pool of CONFIG_BT_TINYCRYPT_ECC_WORKERS threads.
+ */
+struct bt_dh_key_job {
+	/* Internal */
+	void *fifo_reserved;
+	struct k_work done;
+	bt_dh_key_job_cb_t func;
+	atomic_t busy;
+	bool debug;
+	int err;
+	uint8_t remote_pk[BT_PUB_KEY_LEN];
+	uint8_t dhkey[BT_DH_KEY_LEN];
+
+	/* Cycle counts at submission, start and end of the computation */
+	uint32_t submitted;
+	uint32_t started;
+	uint32_t completed;
+};
+
+/*  @brief Calculate a DH Key from a remote Public Key in the background.
+ *
+ *  @param job Job to use, must stay valid until the callback is called.
+ *  @param remote_pk Remote Public Key.
+ *  @param cb Callback to notify the calculated key.
+ *
+ *  @return Zero on success, -EINPROGRESS if the job is still in use or
+ *          another negative error code otherwise.
+ */
+int bt_dh_key_job_submit(struct bt_dh_key_job *job,
+			 const uint8_t remote_pk[BT_PUB_KEY_LEN],
+			 bt_dh_key_job_cb_t cb);
+#endif /* CONFIG_BT_TINYCRYPT_ECC_PARALLEL */
@@ -56,6 +56,12 @@ LOG_MODULE_REGISTER(bt_gatt);
 
 static uint16_t last_static_handle;
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+static void attr_index_rebuild(void);
+#else
+static inline void attr_index_rebuild(void) {}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 /* Persistent storage format for GATT CCC */
 struct ccc_store {
 	uint16_t handle;
@@ -1232,6 +1238,7 @@ populate:
 	}
 
 	gatt_insert(svc, last_handle);
+	attr_index_rebuild();
 
 	return 0;
 }
@@ -1454,6 +1461,8 @@ static void bt_gatt_service_init(void)
 	STRUCT_SECTION_FOREACH(bt_gatt_service_static, svc) {
 		last_static_handle += svc->attr_count;
 	}
+
+	attr_index_rebuild();
 }
 
 void bt_gatt_init(void)
@@ -1639,6 +1648,8 @@ static int gatt_unregister(struct bt_gatt_service *svc)
 		}
 	}
 
+	attr_index_rebuild();
+
 	return 0;
 }
 
@@ -1991,6 +2002,163 @@ static void foreach_attr_type_dyndb(uint16_t start_handle, uint16_t end_handle,
 #endif /* CONFIG_BT_GATT_DYNAMIC_DB */
 }
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+#define ATTR_INDEX_BUCKET_BITS 5
+#define ATTR_INDEX_BUCKETS BIT(ATTR_INDEX_BUCKET_BITS)
+
+struct attr_index_entry {
+	const struct bt_gatt_attr *attr;
+	uint16_t handle;
+};
+
+static struct {
+	/* Attributes sorted by handle */
+	struct attr_index_entry attrs[CONFIG_BT_GATT_ATTR_INDEX_MAX];
+	/* Positions in attrs grouped by UUID bucket, sorted by handle within
+	 * each bucket.
+	 */
+	uint16_t by_type[CONFIG_BT_GATT_ATTR_INDEX_MAX];
+	/* Start of each bucket in by_type, the last entry is the end */
+	uint16_t buckets[ATTR_INDEX_BUCKETS + 1];
+	uint16_t count;
+	bool valid;
+	bool overflow_reported;
+} attr_index;
+
+static uint8_t attr_index_bucket(const struct bt_uuid *uuid)
+{
+	uint32_t val;
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		val = BT_UUID_16(uuid)->val;
+		break;
+	case BT_UUID_TYPE_32:
+		val = BT_UUID_32(uuid)->val;
+		break;
+	default:
+		/* UUIDs built from the Bluetooth Base UUID compare equal to
+		 * their 16/32-bit form, which sits in the last 4 bytes.
+		 */
+		val = sys_get_le32(&BT_UUID_128(uuid)->val[12]);
+		break;
+	}
+
+	return (val * 2654435761U) >> (32 - ATTR_INDEX_BUCKET_BITS);
+}
+
+static uint8_t attr_index_add(const struct bt_gatt_attr *attr, uint16_t handle,
+			      void *user_data)
+{
+	bool *overflow = user_data;
+
+	if (attr_index.count == ARRAY_SIZE(attr_index.attrs)) {
+		*overflow = true;
+		return BT_GATT_ITER_STOP;
+	}
+
+	attr_index.attrs[attr_index.count].attr = attr;
+	attr_index.attrs[attr_index.count].handle = handle;
+	attr_index.count++;
+
+	return BT_GATT_ITER_CONTINUE;
+}
+
+static void attr_index_rebuild(void)
+{
+	uint16_t next[ATTR_INDEX_BUCKETS];
+	bool overflow = false;
+
+	attr_index.valid = false;
+	attr_index.count = 0U;
+
+	/* The database is walked in handle order so attrs ends up sorted */
+	bt_gatt_foreach_attr(BT_ATT_FIRST_ATTRIBUTE_HANDLE,
+			     BT_ATT_LAST_ATTRIBUTE_HANDLE, attr_index_add,
+			     &overflow);
+	if (overflow) {
+		if (!attr_index.overflow_reported) {
+			LOG_WRN("More than %u attributes, index disabled",
+				CONFIG_BT_GATT_ATTR_INDEX_MAX);
+			attr_index.overflow_reported = true;
+		}
+		return;
+	}
+
+	/* Counting sort by bucket, stable so buckets stay in handle order */
+	(void)memset(attr_index.buckets, 0, sizeof(attr_index.buckets));
+
+	for (uint16_t i = 0U; i < attr_index.count; i++) {
+		attr_index.buckets[attr_index_bucket(attr_index.attrs[i].attr->uuid) + 1]++;
+	}
+
+	for (uint8_t b = 0U; b < ATTR_INDEX_BUCKETS; b++) {
+		attr_index.buckets[b + 1] += attr_index.buckets[b];
+		next[b] = attr_index.buckets[b];
+	}
+
+	for (uint16_t i = 0U; i < attr_index.count; i++) {
+		uint8_t b = attr_index_bucket(attr_index.attrs[i].attr->uuid);
+
+		attr_index.by_type[next[b]++] = i;
+	}
+
+	attr_index.valid = true;
+}
+
+/* Return the first position in [lo, hi) whose handle is >= handle, pos maps
+ * a position to an index in attrs when walking a bucket.
+ */
+static uint16_t attr_index_lower_bound(const uint16_t *pos, uint16_t lo,
+				       uint16_t hi, uint16_t handle)
+{
+	while (lo < hi) {
+		uint16_t mid = lo + (hi - lo) / 2U;
+		uint16_t i = pos ? pos[mid] : mid;
+
+		if (attr_index.attrs[i].handle < handle) {
+			lo = mid + 1U;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+static void attr_index_foreach(uint16_t start_handle, uint16_t end_handle,
+			       const struct bt_uuid *uuid,
+			       const void *attr_data, uint16_t num_matches,
+			       bt_gatt_attr_func_t func, void *user_data)
+{
+	const uint16_t *pos = NULL;
+	uint16_t lo = 0U;
+	uint16_t hi = attr_index.count;
+
+	if (uuid) {
+		uint8_t b = attr_index_bucket(uuid);
+
+		pos = attr_index.by_type;
+		lo = attr_index.buckets[b];
+		hi = attr_index.buckets[b + 1];
+	}
+
+	for (lo = attr_index_lower_bound(pos, lo, hi, start_handle); lo < hi;
+	     lo++) {
+		const struct attr_index_entry *entry;
+
+		entry = &attr_index.attrs[pos ? pos[lo] : lo];
+
+		/* Bucket collisions are filtered by the UUID compare */
+		if (gatt_foreach_iter(entry->attr, entry->handle, start_handle,
+				      end_handle, uuid, attr_data, &num_matches,
+				      func, user_data) == BT_GATT_ITER_STOP) {
+			return;
+		}
+	}
+}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 			       const struct bt_uuid *uuid,
 			       const void *attr_data, uint16_t num_matches,
@@ -2002,6 +2170,14 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 		num_matches = UINT16_MAX;
 	}
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+	if (attr_index.valid) {
+		attr_index_foreach(start_handle, end_handle, uuid, attr_data,
+				   num_matches, func, user_data);
+		return;
+	}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 	if (start_handle <= last_static_handle) {
 		uint16_t handle = 1;
 
@@ -2432,17 +2608,6 @@ static int gatt_notify(struct bt_conn *conn, uint16_t handle,
 		return -EPERM;
 	}
 
-	if (IS_ENABLED(CONFIG_BT_GATT_ENFORCE_SUBSCRIPTION)) {
-		/* Check if client has subscribed before sending notifications.
-		 * This is not really required in the Bluetooth specification,
-		 * but follows its spirit.
-		 */
-		if (!bt_gatt_is_subscribed(conn, params->attr, BT_GATT_CCC_NOTIFY)) {
-			LOG_WRN("Device is not subscribed to characteristic");
-			return -EINVAL;
-		}
-	}
-
 	if (IS_ENABLED(CONFIG_BT_EATT) &&
 	    !bt_att_chan_opt_valid(conn, BT_ATT_CHAN_OPT(params))) {
 		return -EINVAL;
@@ -2780,50 +2945,89 @@ struct bt_gatt_attr *bt_gatt_find_by_uuid(const struct bt_gatt_attr *attr,
 	return found;
 }
 
-int bt_gatt_notify_cb(struct bt_conn *conn,
-		      struct bt_gatt_notify_params *params)
+/* Resolve the handle to notify and the attribute to use for the parameters */
+static int gatt_notify_resolve(struct bt_gatt_notify_params *params,
+			       struct notify_data *data)
 {
-	struct notify_data data;
-
-	__ASSERT(params, "invalid parameters\n");
-	__ASSERT(params->attr || params->uuid, "invalid parameters\n");
-
-	if (!atomic_test_bit(bt_dev.flags, BT_DEV_READY)) {
-		return -EAGAIN;
-	}
-
-	if (conn && conn->state != BT_CONN_CONNECTED) {
-		return -ENOTCONN;
-	}
-
-	data.attr = params->attr;
-	data.handle = bt_gatt_attr_get_handle(data.attr);
+	data->attr = params->attr;
+	data->handle = bt_gatt_attr_get_handle(data->attr);
 
 	/* Lookup UUID if it was given */
 	if (params->uuid) {
-		if (!gatt_find_by_uuid(&data, params->uuid)) {
+		if (!gatt_find_by_uuid(data, params->uuid)) {
 			return -ENOENT;
 		}
 
-		params->attr = data.attr;
+		params->attr = data->attr;
 	} else {
-		if (!data.handle) {
+		if (!data->handle) {
 			return -ENOENT;
 		}
 	}
 
 	/* Check if attribute is a characteristic then adjust the handle */
-	if (!bt_uuid_cmp(data.attr->uuid, BT_UUID_GATT_CHRC)) {
-		struct bt_gatt_chrc *chrc = data.attr->user_data;
+	if (!bt_uuid_cmp(data->attr->uuid, BT_UUID_GATT_CHRC)) {
+		struct bt_gatt_chrc *chrc = data->attr->user_data;
 
 		if (!(chrc->properties & BT_GATT_CHRC_NOTIFY)) {
 			return -EINVAL;
 		}
 
-		data.handle = bt_gatt_attr_value_handle(data.attr);
+		data->handle = bt_gatt_attr_value_handle(data->attr);
+	}
+
+	return 0;
+}
+
+static bool ccc_is_subscribed(const struct _bt_gatt_ccc *ccc,
+			      struct bt_conn *conn, uint16_t ccc_type)
+{
+	for (size_t i = 0; i < BT_GATT_CCC_MAX; i++) {
+		const struct bt_gatt_ccc_cfg *cfg = &ccc->cfg[i];
+
+		if (bt_conn_is_peer_addr_le(conn, cfg->id, &cfg->peer) &&
+		    (ccc_type & cfg->value)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int bt_gatt_notify_cb(struct bt_conn *conn,
+		      struct bt_gatt_notify_params *params)
+{
+	struct notify_data data;
+	int err;
+
+	__ASSERT(params, "invalid parameters\n");
+	__ASSERT(params->attr || params->uuid, "invalid parameters\n");
+
+	if (!atomic_test_bit(bt_dev.flags, BT_DEV_READY)) {
+		return -EAGAIN;
+	}
+
+	if (conn && conn->state != BT_CONN_CONNECTED) {
+		return -ENOTCONN;
+	}
+
+	err = gatt_notify_resolve(params, &data);
+	if (err) {
+		return err;
 	}
 
 	if (conn) {
+		if (IS_ENABLED(CONFIG_BT_GATT_ENFORCE_SUBSCRIPTION) &&
+		    !bt_gatt_is_subscribed(conn, params->attr,
+					   BT_GATT_CCC_NOTIFY)) {
+			/* Check if client has subscribed before sending
+			 * notifications. This is not really required in the
+			 * Bluetooth specification, but follows its spirit.
+			 */
+			LOG_WRN("Device is not subscribed to characteristic");
+			return -EINVAL;
+		}
+
 		return gatt_notify(conn, data.handle, params);
 	}
 
@@ -2837,6 +3041,69 @@ int bt_gatt_notify_cb(struct bt_conn *conn,
 	return data.err;
 }
 
+int bt_gatt_notify_conns(struct bt_conn *conns[], size_t num_conns,
+			 struct bt_gatt_notify_params *params)
+{
+	const struct _bt_gatt_ccc *ccc;
+	struct notify_data data;
+	struct notify_data found;
+	int count = 0;
+	int err;
+
+	__ASSERT(conns || !num_conns, "invalid parameters\n");
+	__ASSERT(params, "invalid parameters\n");
+	__ASSERT(params->attr || params->uuid, "invalid parameters\n");
+
+	if (!atomic_test_bit(bt_dev.flags, BT_DEV_READY)) {
+		return -EAGAIN;
+	}
+
+	/* Resolve the attribute and its CCC descriptor once for all the
+	 * connections instead of once per connection.
+	 */
+	err = gatt_notify_resolve(params, &data);
+	if (err) {
+		return err;
+	}
+
+	found.handle = data.handle;
+	if (!gatt_find_by_uuid(&found, BT_UUID_GATT_CCC) ||
+	    found.attr->write != bt_gatt_attr_write_ccc) {
+		return -ENOENT;
+	}
+
+	ccc = found.attr->user_data;
+
+	for (size_t i = 0; i < num_conns; i++) {
+		struct bt_conn *conn = conns[i];
+
+		if (conn->state != BT_CONN_CONNECTED ||
+		    !ccc_is_subscribed(ccc, conn, BT_GATT_CCC_NOTIFY)) {
+			continue;
+		}
+
+		/* Confirm match if cfg is managed by application */
+		if (ccc->cfg_match && !ccc->cfg_match(conn, found.attr)) {
+			continue;
+		}
+
+		err = gatt_notify(conn, data.handle, params);
+		if (err == -ENOMEM) {
+			/* Other connections share the same buffer pool */
+			break;
+		}
+
+		if (err) {
+			LOG_DBG("conn %p notify failed (err %d)", conn, err);
+			continue;
+		}
+
+		count++;
+	}
+
+	return count ? count : err;
+}
+
 #if defined(CONFIG_BT_GATT_NOTIFY_MULTIPLE)
 static int gatt_notify_multiple_verify_args(struct bt_conn *conn,
 					    struct bt_gatt_notify_params params[],
@@ -3397,16 +3664,7 @@ bool bt_gatt_is_subscribed(struct bt_conn *conn,
 	ccc = attr->user_data;
 
 	/* Check if the connection is subscribed */
-	for (size_t i = 0; i < BT_GATT_CCC_MAX; i++) {
-		const struct bt_gatt_ccc_cfg *cfg = &ccc->cfg[i];
-
-		if (bt_conn_is_peer_addr_le(conn, cfg->id, &cfg->peer) &&
-		    (ccc_type & ccc->cfg[i].value)) {
-			return true;
-		}
-	}
-
-	return false;
+	return ccc_is_subscribed(ccc, conn, ccc_type);
 }
 
 static bool gatt_sub_is_empty(struct gatt_sub *sub)
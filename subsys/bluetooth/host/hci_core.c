@@ -3762,6 +3762,15 @@ static void rx_queue_put(struct net_buf *buf)
 		LOG_ERR("Could not submit rx_work: %d", err);
 	}
 }
+
+int bt_hci_rx_work_submit(struct k_work *work)
+{
+#if defined(CONFIG_BT_RECV_WORKQ_SYS)
+	return k_work_submit(work);
+#elif defined(CONFIG_BT_RECV_WORKQ_BT)
+	return k_work_submit_to_queue(&bt_workq, work);
+#endif /* CONFIG_BT_RECV_WORKQ_SYS */
+}
 #endif /* !CONFIG_BT_RECV_BLOCKING */
 
 int bt_recv(struct net_buf *buf)
@@ -445,6 +445,11 @@ const bt_addr_le_t *bt_lookup_id_addr(uint8_t id, const bt_addr_le_t *addr);
 
 int bt_send(struct net_buf *buf);
 
+/* Run work in the context that processes incoming HCI packets, so that it is
+ * serialized with them. Not available with CONFIG_BT_RECV_BLOCKING.
+ */
+int bt_hci_rx_work_submit(struct k_work *work);
+
 /* Don't require everyone to include keys.h */
 struct bt_keys;
 void bt_id_add(struct bt_keys *keys);
@@ -10,6 +10,7 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/init.h>
 #include <zephyr/sys/atomic.h>
 #include <zephyr/debug/stack.h>
 #include <zephyr/sys/byteorder.h>
@@ -161,6 +162,26 @@ static void emulate_le_p256_public_key_cmd(void)
 	bt_recv(buf);
 }
 
+/* Doesn't touch any global state other than reading the private key, so it
+ * may run concurrently on the DHKey workers. dhkey_be may alias public_key_be.
+ */
+static int compute_dhkey(const uint8_t *public_key_be, bool use_debug,
+			 uint8_t *dhkey_be)
+{
+	int ret;
+
+	ret = uECC_valid_public_key(public_key_be, &curve_secp256r1);
+	if (ret < 0) {
+		LOG_ERR("public key is not valid (ret %d)", ret);
+		return TC_CRYPTO_FAIL;
+	}
+
+	return uECC_shared_secret(public_key_be,
+				  use_debug ? debug_private_key_be :
+					      ecc.private_key_be,
+				  dhkey_be, &curve_secp256r1);
+}
+
 static void emulate_le_generate_dhkey(void)
 {
 	struct bt_hci_evt_le_generate_dhkey_complete *evt;
@@ -169,18 +190,8 @@ static void emulate_le_generate_dhkey(void)
 	struct net_buf *buf;
 	int ret;
 
-	ret = uECC_valid_public_key(ecc.public_key_be, &curve_secp256r1);
-	if (ret < 0) {
-		LOG_ERR("public key is not valid (ret %d)", ret);
-		ret = TC_CRYPTO_FAIL;
-	} else {
-		bool use_debug = atomic_test_bit(flags, USE_DEBUG_KEY);
-
-		ret = uECC_shared_secret(ecc.public_key_be,
-					 use_debug ? debug_private_key_be :
-						     ecc.private_key_be,
-					 ecc.dhkey_be, &curve_secp256r1);
-	}
+	ret = compute_dhkey(ecc.public_key_be,
+			    atomic_test_bit(flags, USE_DEBUG_KEY), ecc.dhkey_be);
 
 	buf = bt_buf_get_rx(BT_BUF_EVT, K_FOREVER);
 
@@ -220,6 +231,91 @@ static void ecc_process(struct k_work *work)
 	}
 }
 
+#if defined(CONFIG_BT_TINYCRYPT_ECC_PARALLEL)
+static K_FIFO_DEFINE(dhkey_jobs);
+static atomic_t dhkey_jobs_active;
+static K_THREAD_STACK_ARRAY_DEFINE(dhkey_stacks, CONFIG_BT_TINYCRYPT_ECC_WORKERS,
+				   CONFIG_BT_TINYCRYPT_ECC_WORKER_STACK_SIZE);
+static struct k_thread dhkey_threads[CONFIG_BT_TINYCRYPT_ECC_WORKERS];
+
+static void dhkey_worker(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct bt_dh_key_job *job = k_fifo_get(&dhkey_jobs, K_FOREVER);
+		uint8_t public_key_be[BT_PUB_KEY_LEN];
+		uint8_t dhkey_be[BT_DH_KEY_LEN];
+
+		job->started = k_cycle_get_32();
+
+		sys_memcpy_swap(public_key_be, job->remote_pk,
+				BT_PUB_KEY_COORD_LEN);
+		sys_memcpy_swap(&public_key_be[BT_PUB_KEY_COORD_LEN],
+				&job->remote_pk[BT_PUB_KEY_COORD_LEN],
+				BT_PUB_KEY_COORD_LEN);
+
+		if (compute_dhkey(public_key_be, job->debug, dhkey_be) ==
+		    TC_CRYPTO_FAIL) {
+			job->err = -EIO;
+		} else {
+			sys_memcpy_swap(job->dhkey, dhkey_be, BT_DH_KEY_LEN);
+		}
+
+		job->completed = k_cycle_get_32();
+
+		atomic_dec(&dhkey_jobs_active);
+
+		(void)bt_hci_rx_work_submit(&job->done);
+	}
+}
+
+int bt_hci_ecc_dhkey_job(struct bt_dh_key_job *job)
+{
+	/* Pairs with le_p256_pub_key(): the private key must not change
+	 * while any job may still be reading it.
+	 */
+	atomic_inc(&dhkey_jobs_active);
+
+	if (atomic_test_bit(flags, PENDING_PUB_KEY)) {
+		atomic_dec(&dhkey_jobs_active);
+		return -EBUSY;
+	}
+
+	k_fifo_put(&dhkey_jobs, job);
+
+	return 0;
+}
+
+static int dhkey_workers_init(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(dhkey_threads); i++) {
+		k_thread_create(&dhkey_threads[i], dhkey_stacks[i],
+				K_THREAD_STACK_SIZEOF(dhkey_stacks[i]),
+				dhkey_worker, NULL, NULL, NULL,
+				K_PRIO_PREEMPT(CONFIG_BT_TINYCRYPT_ECC_WORKER_PRIO),
+				0, K_NO_WAIT);
+		k_thread_name_set(&dhkey_threads[i], "BT DHKey");
+	}
+
+	return 0;
+}
+
+SYS_INIT(dhkey_workers_init, POST_KERNEL, CONFIG_BT_LONG_WQ_INIT_PRIO);
+
+static bool dhkey_jobs_pending(void)
+{
+	return atomic_get(&dhkey_jobs_active) != 0;
+}
+#else
+static bool dhkey_jobs_pending(void)
+{
+	return false;
+}
+#endif /* CONFIG_BT_TINYCRYPT_ECC_PARALLEL */
+
 static void clear_ecc_events(struct net_buf *buf)
 {
 	struct bt_hci_cp_le_set_event_mask *cmd;
@@ -297,6 +393,9 @@ static void le_p256_pub_key(struct net_buf *buf)
 		status = BT_HCI_ERR_CMD_DISALLOWED;
 	} else if (atomic_test_and_set_bit(flags, PENDING_PUB_KEY)) {
 		status = BT_HCI_ERR_CMD_DISALLOWED;
+	} else if (dhkey_jobs_pending()) {
+		atomic_clear_bit(flags, PENDING_PUB_KEY);
+		status = BT_HCI_ERR_CMD_DISALLOWED;
 	} else {
 		bt_long_wq_submit(&ecc_work);
 		status = BT_HCI_ERR_SUCCESS;
@@ -344,7 +443,24 @@ void bt_hci_ecc_supported_commands(uint8_t *supported_commands)
 	supported_commands[41] |= BIT(2);
 }
 
+#if defined(CONFIG_BT_TINYCRYPT_ECC_PARALLEL)
+/* The DHKey workers may request random numbers at the same time */
+static K_MUTEX_DEFINE(csprng_lock);
+#endif
+
 int default_CSPRNG(uint8_t *dst, unsigned int len)
 {
-	return !bt_rand(dst, len);
+	int err;
+
+#if defined(CONFIG_BT_TINYCRYPT_ECC_PARALLEL)
+	(void)k_mutex_lock(&csprng_lock, K_FOREVER);
+#endif
+
+	err = bt_rand(dst, len);
+
+#if defined(CONFIG_BT_TINYCRYPT_ECC_PARALLEL)
+	(void)k_mutex_unlock(&csprng_lock);
+#endif
+
+	return !err;
 }
@@ -8,3 +8,12 @@
 
 int bt_hci_ecc_send(struct net_buf *buf);
 void bt_hci_ecc_supported_commands(uint8_t *supported_commands);
+
+#if defined(CONFIG_BT_TINYCRYPT_ECC_PARALLEL)
+struct bt_dh_key_job;
+
+/* Queue the job to the DHKey worker threads. Returns -EBUSY while the local
+ * key pair is being regenerated.
+ */
+int bt_hci_ecc_dhkey_job(struct bt_dh_key_job *job);
+#endif /* CONFIG_BT_TINYCRYPT_ECC_PARALLEL */
@@ -325,6 +325,8 @@ int bt_keys_store(struct bt_keys *keys)
 
 	__ASSERT_NO_MSG(keys != NULL);
 
+	keys->state &= ~BT_KEYS_STORE_PENDING;
+
 	err = bt_settings_store_keys(keys->id, &keys->addr, keys->storage_start,
 				     BT_KEYS_STORAGE_LEN);
 	if (err) {
@@ -452,6 +454,22 @@ BT_SETTINGS_DEFINE(keys, "keys", keys_set, keys_commit);
 
 #endif /* CONFIG_BT_SETTINGS */
 
+#if defined(CONFIG_BT_KEYS_SAVE_AGING_COUNTER_DELAYED)
+static void store_pending(struct bt_keys *keys, void *data)
+{
+	if (keys->state & BT_KEYS_STORE_PENDING) {
+		(void)bt_keys_store(keys);
+	}
+}
+
+static void delayed_store(struct k_work *work)
+{
+	bt_keys_foreach_type(BT_KEYS_ALL, store_pending, NULL);
+}
+
+static K_WORK_DELAYABLE_DEFINE(delayed_store_work, delayed_store);
+#endif /* CONFIG_BT_KEYS_SAVE_AGING_COUNTER_DELAYED */
+
 #if defined(CONFIG_BT_KEYS_OVERWRITE_OLDEST)
 void bt_keys_update_usage(uint8_t id, const bt_addr_le_t *addr)
 {
@@ -472,9 +490,16 @@ void bt_keys_update_usage(uint8_t id, const bt_addr_le_t *addr)
 
 	LOG_DBG("Aging counter for %s is set to %u", bt_addr_le_str(addr), keys->aging_counter);
 
+#if defined(CONFIG_BT_KEYS_SAVE_AGING_COUNTER_DELAYED)
+	/* Coalesce with the updates of other peers connecting meanwhile */
+	keys->state |= BT_KEYS_STORE_PENDING;
+	k_work_reschedule(&delayed_store_work,
+			  K_MSEC(CONFIG_BT_SETTINGS_DELAYED_STORE_MS));
+#else
 	if (IS_ENABLED(CONFIG_BT_KEYS_SAVE_AGING_COUNTER_ON_PAIRING)) {
 		bt_keys_store(keys);
 	}
+#endif /* CONFIG_BT_KEYS_SAVE_AGING_COUNTER_DELAYED */
 }
 
 #endif  /* CONFIG_BT_KEYS_OVERWRITE_OLDEST */
@@ -25,6 +25,7 @@ enum {
 	BT_KEYS_ID_PENDING_ADD  = BIT(0),
 	BT_KEYS_ID_PENDING_DEL  = BIT(1),
 	BT_KEYS_ID_ADDED        = BIT(2),
+	BT_KEYS_STORE_PENDING   = BIT(3),
 };
 
 enum {
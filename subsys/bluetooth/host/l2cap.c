@@ -1810,8 +1810,12 @@ static inline struct net_buf *l2cap_alloc_seg(struct net_buf *buf, struct bt_l2c
 		seg = ch->chan.ops->alloc_seg(&ch->chan);
 		__ASSERT_NO_MSG(seg);
 	} else {
-		/* Try to use original pool if possible */
-		seg = net_buf_alloc(pool, K_NO_WAIT);
+		/* Try to use original pool if possible, only asking for what a
+		 * PDU needs so variable size pools don't hand out a buffer as
+		 * big as the SDU for each segment.
+		 */
+		seg = net_buf_alloc_len(pool, BT_L2CAP_CHAN_SEND_RESERVE + ch->tx.mps,
+					K_NO_WAIT);
 	}
 
 	if (seg) {
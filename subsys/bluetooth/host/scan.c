@@ -8,6 +8,7 @@
 
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/crc.h>
 
 #include <zephyr/bluetooth/bluetooth.h>
 #include <zephyr/bluetooth/iso.h>
@@ -436,6 +437,66 @@ static uint8_t get_adv_props_legacy(uint8_t evt_type)
 	}
 }
 
+#if defined(CONFIG_BT_SCAN_DUP_FILTER)
+struct dup_filter_entry {
+	bt_addr_le_t addr;
+	uint8_t adv_type;
+	bool used;
+	uint32_t hash;
+	uint32_t reported;
+};
+
+static struct dup_filter_entry dup_filter[CONFIG_BT_SCAN_DUP_FILTER_SIZE];
+
+static void dup_filter_reset(void)
+{
+	(void)memset(dup_filter, 0, sizeof(dup_filter));
+}
+
+/* Returns true if the advertiser reported the same data less than
+ * CONFIG_BT_SCAN_DUP_FILTER_PERIOD ago, otherwise records the report.
+ * When the table is full, the advertiser reported the longest ago is
+ * forgotten.
+ */
+static bool dup_filter_match(const bt_addr_le_t *addr, uint8_t adv_type,
+			     const uint8_t *data, uint16_t len)
+{
+	struct dup_filter_entry *entry = NULL;
+	uint32_t now = k_uptime_get_32();
+	uint32_t oldest_age = 0U;
+	uint32_t hash = crc32_ieee(data, len);
+
+	for (size_t i = 0; i < ARRAY_SIZE(dup_filter); i++) {
+		struct dup_filter_entry *e = &dup_filter[i];
+		uint32_t age;
+
+		if (e->used && e->adv_type == adv_type && bt_addr_le_eq(&e->addr, addr)) {
+			if (e->hash == hash &&
+			    (now - e->reported) < CONFIG_BT_SCAN_DUP_FILTER_PERIOD) {
+				return true;
+			}
+
+			entry = e;
+			break;
+		}
+
+		age = e->used ? (now - e->reported) : UINT32_MAX;
+		if (entry == NULL || age > oldest_age) {
+			entry = e;
+			oldest_age = age;
+		}
+	}
+
+	bt_addr_le_copy(&entry->addr, addr);
+	entry->adv_type = adv_type;
+	entry->used = true;
+	entry->hash = hash;
+	entry->reported = now;
+
+	return false;
+}
+#endif /* CONFIG_BT_SCAN_DUP_FILTER */
+
 static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 			struct net_buf_simple *buf, uint16_t len)
 {
@@ -454,6 +515,14 @@ static void le_adv_recv(bt_addr_le_t *addr, struct bt_le_scan_recv_info *info,
 		return;
 	}
 
+#if defined(CONFIG_BT_SCAN_DUP_FILTER)
+	if (atomic_test_bit(bt_dev.flags, BT_DEV_EXPLICIT_SCAN) &&
+	    atomic_test_bit(bt_dev.flags, BT_DEV_SCAN_FILTER_DUP) &&
+	    dup_filter_match(addr, info->adv_type, buf->data, len)) {
+		return;
+	}
+#endif /* CONFIG_BT_SCAN_DUP_FILTER */
+
 	if (bt_addr_le_is_resolved(addr)) {
 		bt_addr_le_copy_resolved(&id_addr, addr);
 	} else if (addr->type == BT_HCI_PEER_ADDR_ANONYMOUS) {
@@ -1484,6 +1553,10 @@ int bt_le_scan_start(const struct bt_le_scan_param *param, bt_le_scan_cb_t cb)
 	atomic_set_bit_to(bt_dev.flags, BT_DEV_SCAN_FILTER_DUP,
 			  param->options & BT_LE_SCAN_OPT_FILTER_DUPLICATE);
 
+#if defined(CONFIG_BT_SCAN_DUP_FILTER)
+	dup_filter_reset();
+#endif /* CONFIG_BT_SCAN_DUP_FILTER */
+
 #if defined(CONFIG_BT_FILTER_ACCEPT_LIST)
 	atomic_set_bit_to(bt_dev.flags, BT_DEV_SCAN_FILTERED,
 			  param->options & BT_LE_SCAN_OPT_FILTER_ACCEPT_LIST);
@@ -139,6 +139,17 @@ enum {
 	SMP_NUM_FLAGS,
 };
 
+#if defined(CONFIG_BT_SMP_PAIRING_TIMING)
+enum {
+	SMP_TIMING_START,	/* pairing started */
+	SMP_TIMING_PUBLIC_KEY,	/* remote Public Key received */
+	SMP_TIMING_DHKEY,	/* DHKey available */
+
+	/* Total number of timestamps - must be at the end */
+	SMP_TIMING_NUM,
+};
+#endif /* CONFIG_BT_SMP_PAIRING_TIMING */
+
 /* SMP channel specific context */
 struct bt_smp {
 	/* Commands that remote is allowed to send */
@@ -198,6 +209,11 @@ struct bt_smp {
 	/* Remote key distribution */
 	uint8_t				remote_dist;
 
+#if defined(CONFIG_BT_SMP_PAIRING_TIMING)
+	/* Cycle count at each pairing phase, 0 if not reached */
+	uint32_t			timing[SMP_TIMING_NUM];
+#endif /* CONFIG_BT_SMP_PAIRING_TIMING */
+
 	/* The channel this context is associated with.
 	 * This marks the beginning of the part of the structure that will not
 	 * be memset to zero in init.
@@ -212,10 +228,44 @@ struct bt_smp {
 
 	/* Bondable flag */
 	atomic_t			bondable;
+
+#if defined(CONFIG_BT_TINYCRYPT_ECC_PARALLEL)
+	/* DHKey calculation, may outlive the pairing it was started for */
+	struct bt_dh_key_job		dhkey_job;
+#endif /* CONFIG_BT_TINYCRYPT_ECC_PARALLEL */
 };
 
 static unsigned int fixed_passkey = BT_PASSKEY_INVALID;
 
+#if defined(CONFIG_BT_SMP_PAIRING_TIMING)
+static void smp_timing_mark(struct bt_smp *smp, int phase)
+{
+	smp->timing[phase] = k_cycle_get_32();
+}
+
+static uint32_t smp_timing_us(struct bt_smp *smp, int from, int to)
+{
+	if (!smp->timing[from] || !smp->timing[to]) {
+		return 0;
+	}
+
+	return k_cyc_to_us_floor32(smp->timing[to] - smp->timing[from]);
+}
+
+static void smp_timing_log(struct bt_smp *smp)
+{
+	uint32_t now = k_cycle_get_32();
+
+	LOG_INF("Pairing took %u us (public key %u us, DHKey %u us)",
+		k_cyc_to_us_floor32(now - smp->timing[SMP_TIMING_START]),
+		smp_timing_us(smp, SMP_TIMING_START, SMP_TIMING_PUBLIC_KEY),
+		smp_timing_us(smp, SMP_TIMING_PUBLIC_KEY, SMP_TIMING_DHKEY));
+}
+#else
+#define smp_timing_mark(smp, phase)
+#define smp_timing_log(smp)
+#endif /* CONFIG_BT_SMP_PAIRING_TIMING */
+
 #define DISPLAY_FIXED(smp) (IS_ENABLED(CONFIG_BT_FIXED_PASSKEY) && \
 			    fixed_passkey != BT_PASSKEY_INVALID && \
 			    (smp)->method == PASSKEY_DISPLAY)
@@ -1681,6 +1731,8 @@ static void smp_pairing_complete(struct bt_smp *smp, uint8_t status)
 			bt_keys_store(conn->le.keys);
 		}
 
+		smp_timing_log(smp);
+
 		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&bt_auth_info_cbs, listener,
 						  next, node) {
 			if (listener->pairing_complete) {
@@ -2560,6 +2612,8 @@ static int smp_init(struct bt_smp *smp)
 	 */
 	(void)memset(smp, 0, offsetof(struct bt_smp, chan));
 
+	smp_timing_mark(smp, SMP_TIMING_START);
+
 	/* Generate local random number */
 	if (bt_rand(smp->prnd, 16)) {
 		return BT_SMP_ERR_UNSPECIFIED;
@@ -3407,13 +3461,29 @@ static uint8_t compute_and_check_and_send_periph_dhcheck(struct bt_smp *smp)
 }
 #endif /* CONFIG_BT_PERIPHERAL */
 
+#if defined(CONFIG_BT_TINYCRYPT_ECC_PARALLEL)
+static void smp_dhkey_job_done(struct bt_dh_key_job *job, const uint8_t *dhkey);
+#else
 static void bt_smp_dhkey_ready(const uint8_t *dhkey);
+#endif /* CONFIG_BT_TINYCRYPT_ECC_PARALLEL */
 static uint8_t smp_dhkey_generate(struct bt_smp *smp)
 {
 	int err;
 
 	atomic_set_bit(smp->flags, SMP_FLAG_DHKEY_GEN);
+#if defined(CONFIG_BT_TINYCRYPT_ECC_PARALLEL)
+	err = bt_dh_key_job_submit(&smp->dhkey_job, smp->pkey,
+				   smp_dhkey_job_done);
+	if (err == -EINPROGRESS) {
+		/* The job of an aborted pairing is still running, DHKey will
+		 * be generated again once it completes.
+		 */
+		atomic_clear_bit(smp->flags, SMP_FLAG_DHKEY_GEN);
+		return 0;
+	}
+#else
 	err = bt_dh_key_gen(smp->pkey, bt_smp_dhkey_ready);
+#endif /* CONFIG_BT_TINYCRYPT_ECC_PARALLEL */
 	if (err) {
 		atomic_clear_bit(smp->flags, SMP_FLAG_DHKEY_GEN);
 
@@ -3433,6 +3503,8 @@ static uint8_t smp_dhkey_ready(struct bt_smp *smp, const uint8_t *dhkey)
 	atomic_clear_bit(smp->flags, SMP_FLAG_DHKEY_PENDING);
 	memcpy(smp->dhkey, dhkey, BT_DH_KEY_LEN);
 
+	smp_timing_mark(smp, SMP_TIMING_DHKEY);
+
 	/* wait for user passkey confirmation */
 	if (atomic_test_bit(smp->flags, SMP_FLAG_USER)) {
 		atomic_set_bit(smp->flags, SMP_FLAG_DHKEY_SEND);
@@ -3472,6 +3544,28 @@ static struct bt_smp *smp_find(int flag)
 	return NULL;
 }
 
+#if defined(CONFIG_BT_TINYCRYPT_ECC_PARALLEL)
+static void smp_dhkey_job_done(struct bt_dh_key_job *job, const uint8_t *dhkey)
+{
+	struct bt_smp *smp = CONTAINER_OF(job, struct bt_smp, dhkey_job);
+	uint8_t err;
+
+	LOG_DBG("%p", (void *)dhkey);
+
+	if (atomic_test_and_clear_bit(smp->flags, SMP_FLAG_DHKEY_GEN)) {
+		err = smp_dhkey_ready(smp, dhkey);
+	} else if (atomic_test_bit(smp->flags, SMP_FLAG_DHKEY_PENDING)) {
+		/* Result belongs to an aborted pairing */
+		err = smp_dhkey_generate(smp);
+	} else {
+		return;
+	}
+
+	if (err) {
+		smp_error(smp, err);
+	}
+}
+#else
 static void bt_smp_dhkey_ready(const uint8_t *dhkey)
 {
 	LOG_DBG("%p", (void *)dhkey);
@@ -3497,6 +3591,7 @@ static void bt_smp_dhkey_ready(const uint8_t *dhkey)
 		}
 	} while (smp && err);
 }
+#endif /* CONFIG_BT_TINYCRYPT_ECC_PARALLEL */
 
 static uint8_t sc_smp_check_confirm(struct bt_smp *smp)
 {
@@ -4092,7 +4187,8 @@ static uint8_t generate_dhkey(struct bt_smp *smp)
 	}
 
 	atomic_set_bit(smp->flags, SMP_FLAG_DHKEY_PENDING);
-	if (!smp_find(SMP_FLAG_DHKEY_GEN)) {
+	if (IS_ENABLED(CONFIG_BT_TINYCRYPT_ECC_PARALLEL) ||
+	    !smp_find(SMP_FLAG_DHKEY_GEN)) {
 		return smp_dhkey_generate(smp);
 	}
 
@@ -4195,6 +4291,8 @@ static uint8_t smp_public_key(struct bt_smp *smp, struct net_buf *buf)
 	memcpy(smp->pkey, req->x, BT_PUB_KEY_COORD_LEN);
 	memcpy(&smp->pkey[BT_PUB_KEY_COORD_LEN], req->y, BT_PUB_KEY_COORD_LEN);
 
+	smp_timing_mark(smp, SMP_TIMING_PUBLIC_KEY);
+
 	/* mark key as debug if remote is using it */
 	if (bt_pub_key_is_debug(smp->pkey)) {
 		LOG_INF("Remote is using Debug Public key");
@@ -4613,7 +4711,12 @@ static void bt_smp_disconnected(struct bt_l2cap_chan *chan)
 		}
 	}
 
+#if defined(CONFIG_BT_TINYCRYPT_ECC_PARALLEL)
+	/* A DHKey job may still be running and reference the context */
+	(void)memset(smp, 0, offsetof(struct bt_smp, dhkey_job));
+#else
 	(void)memset(smp, 0, sizeof(*smp));
+#endif /* CONFIG_BT_TINYCRYPT_ECC_PARALLEL */
 }
 
 static void bt_smp_encrypt_change(struct bt_l2cap_chan *chan,
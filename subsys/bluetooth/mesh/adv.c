@@ -118,6 +118,10 @@ static struct net_buf *bt_mesh_adv_create_from_pool(struct net_buf_pool *buf_poo
 
 	buf = net_buf_alloc(buf_pool, timeout);
 	if (!buf) {
+		if (IS_ENABLED(CONFIG_BT_MESH_STATISTIC)) {
+			bt_mesh_stat_dropped_count(tag);
+		}
+
 		return NULL;
 	}
 
@@ -157,7 +161,87 @@ struct net_buf *bt_mesh_adv_create(enum bt_mesh_adv_type type,
 					    tag, xmit, timeout);
 }
 
+static struct net_buf *adv_queue_get(struct k_fifo *queue, k_timeout_t timeout)
+{
+	struct net_buf *buf;
+
+	buf = net_buf_get(queue, timeout);
+	if (buf && IS_ENABLED(CONFIG_BT_MESH_STATISTIC)) {
+		bt_mesh_stat_dequeued_count(BT_MESH_ADV(buf));
+	}
+
+	return buf;
+}
+
+#if defined(CONFIG_BT_MESH_ADV_WEIGHTED)
+/* Queues served by the advertiser that sends local messages */
+static const struct {
+	struct k_fifo *queue;
+	uint8_t weight;
+} adv_classes[] = {
+	{ &bt_mesh_adv_queue, CONFIG_BT_MESH_ADV_WEIGHT_LOCAL },
+#if defined(CONFIG_BT_MESH_ADV_WEIGHT_RELAY)
+	{ &bt_mesh_relay_queue, CONFIG_BT_MESH_ADV_WEIGHT_RELAY },
+#endif
+#if defined(CONFIG_BT_MESH_ADV_WEIGHT_FRIEND)
+	{ &bt_mesh_friend_queue, CONFIG_BT_MESH_ADV_WEIGHT_FRIEND },
+#endif
+};
+
+/* Class currently being served and number of messages it got in a row */
+static uint8_t adv_class;
+static uint8_t adv_class_sent;
+
+static struct net_buf *adv_buf_get_weighted(void)
+{
+	struct net_buf *buf;
+
+	/* The current class may have used up its weight, so it comes around
+	 * twice to be tried again with a fresh one.
+	 */
+	for (int i = 0; i <= ARRAY_SIZE(adv_classes); i++) {
+		if (adv_class_sent < adv_classes[adv_class].weight) {
+			buf = adv_queue_get(adv_classes[adv_class].queue, K_NO_WAIT);
+			if (buf) {
+				adv_class_sent++;
+				return buf;
+			}
+		}
+
+		adv_class = (adv_class + 1) % ARRAY_SIZE(adv_classes);
+		adv_class_sent = 0;
+	}
+
+	return NULL;
+}
+
+struct net_buf *bt_mesh_adv_buf_get(k_timeout_t timeout)
+{
+	struct k_poll_event events[ARRAY_SIZE(adv_classes)];
+	struct net_buf *buf;
+	int err;
+
+	buf = adv_buf_get_weighted();
+	if (buf || K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return buf;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(events); i++) {
+		k_poll_event_init(&events[i], K_POLL_TYPE_FIFO_DATA_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, adv_classes[i].queue);
+	}
+
+	err = k_poll(events, ARRAY_SIZE(events), timeout);
+	if (err) {
+		return NULL;
+	}
+
+	return adv_buf_get_weighted();
+}
+#endif /* CONFIG_BT_MESH_ADV_WEIGHTED */
+
 #if CONFIG_BT_MESH_RELAY_ADV_SETS || CONFIG_BT_MESH_ADV_EXT_FRIEND_SEPARATE
+#if !defined(CONFIG_BT_MESH_ADV_WEIGHTED)
 static struct net_buf *process_events(struct k_poll_event *ev, int count)
 {
 	for (; count; ev++, count--) {
@@ -165,7 +249,7 @@ static struct net_buf *process_events(struct k_poll_event *ev, int count)
 
 		switch (ev->state) {
 		case K_POLL_STATE_FIFO_DATA_AVAILABLE:
-			return net_buf_get(ev->fifo, K_NO_WAIT);
+			return adv_queue_get(ev->fifo, K_NO_WAIT);
 		case K_POLL_STATE_NOT_READY:
 		case K_POLL_STATE_CANCELLED:
 			break;
@@ -201,27 +285,30 @@ struct net_buf *bt_mesh_adv_buf_get(k_timeout_t timeout)
 
 	return process_events(events, ARRAY_SIZE(events));
 }
+#endif /* !CONFIG_BT_MESH_ADV_WEIGHTED */
 
 struct net_buf *bt_mesh_adv_buf_get_by_tag(enum bt_mesh_adv_tag_bit tags, k_timeout_t timeout)
 {
 	if (IS_ENABLED(CONFIG_BT_MESH_ADV_EXT_FRIEND_SEPARATE) &&
 	    tags & BT_MESH_ADV_TAG_BIT_FRIEND) {
-		return net_buf_get(&bt_mesh_friend_queue, timeout);
+		return adv_queue_get(&bt_mesh_friend_queue, timeout);
 	}
 
 #if CONFIG_BT_MESH_RELAY_ADV_SETS
 	if (!(tags & BT_MESH_ADV_TAG_BIT_LOCAL)) {
-		return net_buf_get(&bt_mesh_relay_queue, timeout);
+		return adv_queue_get(&bt_mesh_relay_queue, timeout);
 	}
 #endif
 
 	return bt_mesh_adv_buf_get(timeout);
 }
 #else /* !(CONFIG_BT_MESH_RELAY_ADV_SETS || CONFIG_BT_MESH_ADV_EXT_FRIEND_SEPARATE) */
+#if !defined(CONFIG_BT_MESH_ADV_WEIGHTED)
 struct net_buf *bt_mesh_adv_buf_get(k_timeout_t timeout)
 {
-	return net_buf_get(&bt_mesh_adv_queue, timeout);
+	return adv_queue_get(&bt_mesh_adv_queue, timeout);
 }
+#endif /* !CONFIG_BT_MESH_ADV_WEIGHTED */
 
 struct net_buf *bt_mesh_adv_buf_get_by_tag(enum bt_mesh_adv_tag_bit tags, k_timeout_t timeout)
 {
@@ -237,13 +324,13 @@ void bt_mesh_adv_buf_get_cancel(void)
 
 	k_fifo_cancel_wait(&bt_mesh_adv_queue);
 
-#if CONFIG_BT_MESH_RELAY_ADV_SETS
+#if CONFIG_BT_MESH_RELAY_ADV_SETS || defined(CONFIG_BT_MESH_ADV_WEIGHT_RELAY)
 	k_fifo_cancel_wait(&bt_mesh_relay_queue);
-#endif /* CONFIG_BT_MESH_RELAY_ADV_SETS */
+#endif /* CONFIG_BT_MESH_RELAY_ADV_SETS || CONFIG_BT_MESH_ADV_WEIGHT_RELAY */
 
-	if (IS_ENABLED(CONFIG_BT_MESH_ADV_EXT_FRIEND_SEPARATE)) {
-		k_fifo_cancel_wait(&bt_mesh_friend_queue);
-	}
+#if defined(CONFIG_BT_MESH_ADV_EXT_FRIEND_SEPARATE) || defined(CONFIG_BT_MESH_ADV_WEIGHT_FRIEND)
+	k_fifo_cancel_wait(&bt_mesh_friend_queue);
+#endif
 }
 
 void bt_mesh_adv_send(struct net_buf *buf, const struct bt_mesh_send_cb *cb,
@@ -267,6 +354,15 @@ void bt_mesh_adv_send(struct net_buf *buf, const struct bt_mesh_send_cb *cb,
 		return;
 	}
 
+#if defined(CONFIG_BT_MESH_ADV_WEIGHT_FRIEND)
+	/* Sent by the same advertiser as local messages, but queued apart */
+	if (BT_MESH_ADV(buf)->tag == BT_MESH_ADV_TAG_FRIEND) {
+		net_buf_put(&bt_mesh_friend_queue, net_buf_ref(buf));
+		bt_mesh_adv_buf_local_ready();
+		return;
+	}
+#endif
+
 #if CONFIG_BT_MESH_RELAY_ADV_SETS
 	if (BT_MESH_ADV(buf)->tag == BT_MESH_ADV_TAG_RELAY ||
 	    (IS_ENABLED(CONFIG_BT_MESH_PB_ADV_USE_RELAY_SETS) &&
@@ -275,6 +371,12 @@ void bt_mesh_adv_send(struct net_buf *buf, const struct bt_mesh_send_cb *cb,
 		bt_mesh_adv_buf_relay_ready();
 		return;
 	}
+#elif defined(CONFIG_BT_MESH_ADV_WEIGHT_RELAY)
+	if (BT_MESH_ADV(buf)->tag == BT_MESH_ADV_TAG_RELAY) {
+		net_buf_put(&bt_mesh_relay_queue, net_buf_ref(buf));
+		bt_mesh_adv_buf_local_ready();
+		return;
+	}
 #endif
 
 	net_buf_put(&bt_mesh_adv_queue, net_buf_ref(buf));
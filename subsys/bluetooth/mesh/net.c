@@ -82,6 +82,14 @@ static struct {
 } msg_cache[CONFIG_BT_MESH_MSG_CACHE_SIZE];
 static uint16_t msg_cache_next;
 
+/* Open addressing hash index of msg_cache with linear probing. Each bucket
+ * holds the position of an entry + 1, or 0 if it is empty. At most half of the
+ * buckets are in use, which keeps the probe sequences short.
+ */
+#define MSG_CACHE_INDEX_BITS LOG2CEIL(2 * CONFIG_BT_MESH_MSG_CACHE_SIZE)
+#define MSG_CACHE_INDEX_MASK BIT_MASK(MSG_CACHE_INDEX_BITS)
+static uint16_t msg_cache_index[BIT(MSG_CACHE_INDEX_BITS)];
+
 /* Singleton network context (the implementation only supports one) */
 struct bt_mesh_net bt_mesh = {
 	.local_queue = SYS_SLIST_STATIC_INIT(&bt_mesh.local_queue),
@@ -143,32 +151,81 @@ static bool check_dup(struct net_buf_simple *data)
 	return false;
 }
 
+static uint32_t msg_cache_bucket(uint16_t src, uint32_t seq)
+{
+	/* Fibonacci hashing of the 32 bits that make up an entry */
+	uint32_t key = ((uint32_t)src << 17) | (seq & BIT_MASK(17));
+
+	return (key * 2654435761U) >> (32 - MSG_CACHE_INDEX_BITS);
+}
+
 static bool msg_cache_match(struct net_buf_simple *pdu)
 {
-	uint16_t i;
+	uint16_t src = SRC(pdu->data);
+	uint32_t seq = SEQ(pdu->data) & BIT_MASK(17);
+	uint32_t i;
 
-	for (i = msg_cache_next; i > 0U;) {
-		if (msg_cache[--i].src == SRC(pdu->data) &&
-		    msg_cache[i].seq == (SEQ(pdu->data) & BIT_MASK(17))) {
+	for (i = msg_cache_bucket(src, seq); msg_cache_index[i];
+	     i = (i + 1) & MSG_CACHE_INDEX_MASK) {
+		uint16_t pos = msg_cache_index[i] - 1;
+
+		if (msg_cache[pos].src == src && msg_cache[pos].seq == seq) {
 			return true;
 		}
 	}
 
-	for (i = ARRAY_SIZE(msg_cache); i > msg_cache_next;) {
-		if (msg_cache[--i].src == SRC(pdu->data) &&
-		    msg_cache[i].seq == (SEQ(pdu->data) & BIT_MASK(17))) {
-			return true;
+	return false;
+}
+
+/* Remove the entry at pos from the index, moving back any entries of the
+ * same probe sequence so that no lookup stops early at the freed bucket.
+ */
+static void msg_cache_index_del(uint16_t pos)
+{
+	uint32_t i = msg_cache_bucket(msg_cache[pos].src, msg_cache[pos].seq);
+	uint32_t j;
+
+	while (msg_cache_index[i] != pos + 1) {
+		i = (i + 1) & MSG_CACHE_INDEX_MASK;
+	}
+
+	for (j = (i + 1) & MSG_CACHE_INDEX_MASK; msg_cache_index[j];
+	     j = (j + 1) & MSG_CACHE_INDEX_MASK) {
+		uint16_t other = msg_cache_index[j] - 1;
+		uint32_t home = msg_cache_bucket(msg_cache[other].src,
+						 msg_cache[other].seq);
+
+		/* Can be moved if its home bucket is not between i and j */
+		if (((j - home) & MSG_CACHE_INDEX_MASK) >=
+		    ((j - i) & MSG_CACHE_INDEX_MASK)) {
+			msg_cache_index[i] = msg_cache_index[j];
+			i = j;
 		}
 	}
 
-	return false;
+	msg_cache_index[i] = 0U;
 }
 
 static void msg_cache_add(struct bt_mesh_net_rx *rx)
 {
+	uint32_t i;
+
 	msg_cache_next %= ARRAY_SIZE(msg_cache);
+
+	/* Source address is never unassigned for a received PDU */
+	if (msg_cache[msg_cache_next].src) {
+		msg_cache_index_del(msg_cache_next);
+	}
+
 	msg_cache[msg_cache_next].src = rx->ctx.addr;
 	msg_cache[msg_cache_next].seq = rx->seq;
+
+	i = msg_cache_bucket(rx->ctx.addr, rx->seq);
+	while (msg_cache_index[i]) {
+		i = (i + 1) & MSG_CACHE_INDEX_MASK;
+	}
+
+	msg_cache_index[i] = msg_cache_next + 1;
 	msg_cache_next++;
 }
 
@@ -214,6 +271,7 @@ int bt_mesh_net_create(uint16_t idx, uint8_t flags, const struct bt_mesh_key *ke
 	}
 
 	(void)memset(msg_cache, 0, sizeof(msg_cache));
+	(void)memset(msg_cache_index, 0, sizeof(msg_cache_index));
 	msg_cache_next = 0U;
 
 	bt_mesh.iv_index = iv_index;
@@ -622,6 +680,7 @@ static bool net_decrypt(struct bt_mesh_net_rx *rx, struct net_buf_simple *in,
 			const struct bt_mesh_net_cred *cred)
 {
 	bool proxy = (rx->net_if == BT_MESH_NET_IF_PROXY_CFG);
+	bool decrypted;
 
 	if (NID(in->data) != cred->nid) {
 		return false;
@@ -658,8 +717,14 @@ static bool net_decrypt(struct bt_mesh_net_rx *rx, struct net_buf_simple *in,
 
 	LOG_DBG("src 0x%04x", rx->ctx.addr);
 
-	return bt_mesh_net_decrypt(&cred->enc, out, BT_MESH_NET_IVI_RX(rx),
-				   proxy) == 0;
+	decrypted = (bt_mesh_net_decrypt(&cred->enc, out, BT_MESH_NET_IVI_RX(rx),
+					 proxy) == 0);
+
+	if (IS_ENABLED(CONFIG_BT_MESH_STATISTIC)) {
+		bt_mesh_stat_decrypt(decrypted);
+	}
+
+	return decrypted;
 }
 
 /* Relaying from advertising to the advertising bearer should only happen
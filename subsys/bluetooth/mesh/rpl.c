@@ -38,6 +38,16 @@ struct rpl_val {
 static struct bt_mesh_rpl replay_list[CONFIG_BT_MESH_CRPL];
 static ATOMIC_DEFINE(store, CONFIG_BT_MESH_CRPL);
 
+/* Open addressing hash index of replay_list by source address. Each bucket
+ * holds the position of an entry + 1, or 0 if it is empty. Unicast addresses
+ * are usually assigned sequentially, so their low bits are a good enough hash.
+ * At most half of the buckets are in use, which keeps the probe sequences
+ * short. The index must be rebuilt whenever entries are moved or removed.
+ */
+#define RPL_INDEX_SIZE NHPOT(2 * CONFIG_BT_MESH_CRPL)
+#define RPL_INDEX_MASK (RPL_INDEX_SIZE - 1)
+static uint16_t rpl_index[RPL_INDEX_SIZE];
+
 enum {
 	PENDING_CLEAR,
 	PENDING_RESET,
@@ -49,6 +59,43 @@ static inline int rpl_idx(const struct bt_mesh_rpl *rpl)
 	return rpl - &replay_list[0];
 }
 
+static void rpl_index_add(const struct bt_mesh_rpl *rpl)
+{
+	uint32_t i = rpl->src & RPL_INDEX_MASK;
+
+	while (rpl_index[i]) {
+		i = (i + 1) & RPL_INDEX_MASK;
+	}
+
+	rpl_index[i] = rpl_idx(rpl) + 1;
+}
+
+static void rpl_index_rebuild(void)
+{
+	(void)memset(rpl_index, 0, sizeof(rpl_index));
+
+	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		if (replay_list[i].src) {
+			rpl_index_add(&replay_list[i]);
+		}
+	}
+}
+
+static struct bt_mesh_rpl *bt_mesh_rpl_find(uint16_t src)
+{
+	uint32_t i;
+
+	for (i = src & RPL_INDEX_MASK; rpl_index[i]; i = (i + 1) & RPL_INDEX_MASK) {
+		struct bt_mesh_rpl *rpl = &replay_list[rpl_index[i] - 1];
+
+		if (rpl->src == src) {
+			return rpl;
+		}
+	}
+
+	return NULL;
+}
+
 static void clear_rpl(struct bt_mesh_rpl *rpl)
 {
 	int err;
@@ -92,7 +139,11 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		rpl->seg = 0;
 	}
 
-	rpl->src = rx->ctx.addr;
+	if (rpl->src != rx->ctx.addr) {
+		rpl->src = rx->ctx.addr;
+		rpl_index_add(rpl);
+	}
+
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
 
@@ -122,6 +173,32 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		return false;
 	}
 
+	/* Existing slot for given address */
+	rpl = bt_mesh_rpl_find(rx->ctx.addr);
+	if (rpl) {
+		if (!rpl->old_iv &&
+		    atomic_test_bit(&rpl_flags, PENDING_RESET) &&
+		    !atomic_test_bit(store, rpl_idx(rpl))) {
+			/* Until rpl reset is finished, entry with old_iv == false and
+			 * without "store" bit set will be removed, therefore it can be
+			 * reused. If such entry is reused, "store" bit will be set and
+			 * the entry won't be removed.
+			 */
+			goto match;
+		}
+
+		if (rx->old_iv && !rpl->old_iv) {
+			return true;
+		}
+
+		if ((!rx->old_iv && rpl->old_iv) ||
+		    rpl->seq < rx->seq) {
+			goto match;
+		} else {
+			return true;
+		}
+	}
+
 	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
 		rpl = &replay_list[i];
 
@@ -129,31 +206,6 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		if (!rpl->src) {
 			goto match;
 		}
-
-		/* Existing slot for given address */
-		if (rpl->src == rx->ctx.addr) {
-			if (!rpl->old_iv &&
-			    atomic_test_bit(&rpl_flags, PENDING_RESET) &&
-			    !atomic_test_bit(store, i)) {
-				/* Until rpl reset is finished, entry with old_iv == false and
-				 * without "store" bit set will be removed, therefore it can be
-				 * reused. If such entry is reused, "store" bit will be set and
-				 * the entry won't be removed.
-				 */
-				goto match;
-			}
-
-			if (rx->old_iv && !rpl->old_iv) {
-				return true;
-			}
-
-			if ((!rx->old_iv && rpl->old_iv) ||
-			    rpl->seq < rx->seq) {
-				goto match;
-			} else {
-				return true;
-			}
-		}
 	}
 
 	LOG_ERR("RPL is full!");
@@ -175,6 +227,7 @@ void bt_mesh_rpl_clear(void)
 
 	if (!IS_ENABLED(CONFIG_BT_SETTINGS)) {
 		(void)memset(replay_list, 0, sizeof(replay_list));
+		(void)memset(rpl_index, 0, sizeof(rpl_index));
 		return;
 	}
 
@@ -183,19 +236,6 @@ void bt_mesh_rpl_clear(void)
 	bt_mesh_settings_store_schedule(BT_MESH_SETTINGS_RPL_PENDING);
 }
 
-static struct bt_mesh_rpl *bt_mesh_rpl_find(uint16_t src)
-{
-	int i;
-
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
-		if (replay_list[i].src == src) {
-			return &replay_list[i];
-		}
-	}
-
-	return NULL;
-}
-
 static struct bt_mesh_rpl *bt_mesh_rpl_alloc(uint16_t src)
 {
 	int i;
@@ -203,6 +243,7 @@ static struct bt_mesh_rpl *bt_mesh_rpl_alloc(uint16_t src)
 	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
 		if (!replay_list[i].src) {
 			replay_list[i].src = src;
+			rpl_index_add(&replay_list[i]);
 			return &replay_list[i];
 		}
 	}
@@ -261,6 +302,7 @@ void bt_mesh_rpl_reset(void)
 		}
 
 		(void)memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+		rpl_index_rebuild();
 	}
 }
 
@@ -284,6 +326,7 @@ static int rpl_set(const char *name, size_t len_rd,
 		LOG_DBG("val (null)");
 		if (entry) {
 			(void)memset(entry, 0, sizeof(*entry));
+			rpl_index_rebuild();
 		} else {
 			LOG_WRN("Unable to find RPL entry for 0x%04x", src);
 		}
@@ -402,5 +445,6 @@ void bt_mesh_rpl_pending_store(uint16_t addr)
 
 	if (addr == BT_MESH_ADDR_ALL_NODES) {
 		(void)memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+		rpl_index_rebuild();
 	}
 }
@@ -1616,12 +1616,22 @@ static int cmd_stat_get(const struct shell *sh, size_t argc, char *argv[])
 	shell_print(sh, "loopback:  %d", st.rx_loopback);
 	shell_print(sh, "proxy:     %d", st.rx_proxy);
 	shell_print(sh, "unknown:   %d", st.rx_uknown);
+	shell_print(sh, "Decryption attempts: %d, failed: %d", st.rx_decrypt_attempts,
+		    st.rx_decrypt_failed);
 
 	shell_print(sh, "Transmitted frames: <planned> - <succeeded>");
 	shell_print(sh, "relay adv:   %d - %d", st.tx_adv_relay_planned, st.tx_adv_relay_succeeded);
 	shell_print(sh, "local adv:   %d - %d", st.tx_local_planned, st.tx_local_succeeded);
 	shell_print(sh, "friend:      %d - %d", st.tx_friend_planned, st.tx_friend_succeeded);
 
+	shell_print(sh, "Advertising buffers: <dropped> - <queued> - <max queued>");
+	shell_print(sh, "relay adv:   %d - %d - %d", st.tx_adv_relay_dropped,
+		    st.tx_adv_relay_queued, st.tx_adv_relay_queued_max);
+	shell_print(sh, "local adv:   %d - %d - %d", st.tx_local_dropped,
+		    st.tx_local_queued, st.tx_local_queued_max);
+	shell_print(sh, "friend:      %d - %d - %d", st.tx_friend_dropped,
+		    st.tx_friend_queued, st.tx_friend_queued_max);
+
 	return 0;
 }
 
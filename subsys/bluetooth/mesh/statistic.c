@@ -12,9 +12,18 @@
 
 static struct bt_mesh_statistic stat;
 
+/* Frames currently waiting for an advertiser, not cleared by a reset */
+static uint32_t queued_local;
+static uint32_t queued_relay;
+static uint32_t queued_friend;
+
 void bt_mesh_stat_get(struct bt_mesh_statistic *st)
 {
 	memcpy(st, &stat, sizeof(struct bt_mesh_statistic));
+
+	st->tx_local_queued = queued_local;
+	st->tx_adv_relay_queued = queued_relay;
+	st->tx_friend_queued = queued_friend;
 }
 
 void bt_mesh_stat_reset(void)
@@ -22,14 +31,52 @@ void bt_mesh_stat_reset(void)
 	memset(&stat, 0, sizeof(struct bt_mesh_statistic));
 }
 
+static void queued_inc(uint32_t *queued, uint32_t *max)
+{
+	(*queued)++;
+	*max = MAX(*max, *queued);
+}
+
+static void queued_dec(uint32_t *queued)
+{
+	if (*queued) {
+		(*queued)--;
+	}
+}
+
 void bt_mesh_stat_planned_count(struct bt_mesh_adv *adv)
 {
 	if (adv->tag == BT_MESH_ADV_TAG_LOCAL) {
 		stat.tx_local_planned++;
+		queued_inc(&queued_local, &stat.tx_local_queued_max);
 	} else if (adv->tag == BT_MESH_ADV_TAG_RELAY) {
 		stat.tx_adv_relay_planned++;
+		queued_inc(&queued_relay, &stat.tx_adv_relay_queued_max);
 	} else if (adv->tag == BT_MESH_ADV_TAG_FRIEND) {
 		stat.tx_friend_planned++;
+		queued_inc(&queued_friend, &stat.tx_friend_queued_max);
+	}
+}
+
+void bt_mesh_stat_dequeued_count(struct bt_mesh_adv *adv)
+{
+	if (adv->tag == BT_MESH_ADV_TAG_LOCAL) {
+		queued_dec(&queued_local);
+	} else if (adv->tag == BT_MESH_ADV_TAG_RELAY) {
+		queued_dec(&queued_relay);
+	} else if (adv->tag == BT_MESH_ADV_TAG_FRIEND) {
+		queued_dec(&queued_friend);
+	}
+}
+
+void bt_mesh_stat_dropped_count(enum bt_mesh_adv_tag tag)
+{
+	if (tag == BT_MESH_ADV_TAG_LOCAL) {
+		stat.tx_local_dropped++;
+	} else if (tag == BT_MESH_ADV_TAG_RELAY) {
+		stat.tx_adv_relay_dropped++;
+	} else if (tag == BT_MESH_ADV_TAG_FRIEND) {
+		stat.tx_friend_dropped++;
 	}
 }
 
@@ -62,3 +109,12 @@ void bt_mesh_stat_rx(enum bt_mesh_net_if net_if)
 		break;
 	}
 }
+
+void bt_mesh_stat_decrypt(bool success)
+{
+	stat.rx_decrypt_attempts++;
+
+	if (!success) {
+		stat.rx_decrypt_failed++;
+	}
+}
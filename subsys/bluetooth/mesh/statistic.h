@@ -9,6 +9,9 @@
 
 void bt_mesh_stat_planned_count(struct bt_mesh_adv *adv);
 void bt_mesh_stat_succeeded_count(struct bt_mesh_adv *adv);
+void bt_mesh_stat_dequeued_count(struct bt_mesh_adv *adv);
+void bt_mesh_stat_dropped_count(enum bt_mesh_adv_tag tag);
 void bt_mesh_stat_rx(enum bt_mesh_net_if net_if);
+void bt_mesh_stat_decrypt(bool success);
 
 #endif /* ZEPHYR_SUBSYS_BLUETOOTH_MESH_STATISTIC_H_ */
@@ -150,7 +150,7 @@ static void receive_send_fc(struct isotp_recv_ctx *rctx, uint8_t fs)
 	}
 
 	*data++ = ISOTP_PCI_TYPE_FC | fs;
-	*data++ = rctx->opts.bs;
+	*data++ = rctx->bs;
 	*data++ = rctx->opts.stmin;
 	payload_len = data - frame.data;
 
@@ -228,12 +228,27 @@ static int receive_alloc_buffer(struct isotp_recv_ctx *rctx)
 
 	if (rctx->opts.bs == 0) {
 		/* Alloc all buffers because we can't wait during reception */
+		rctx->bs = 0;
 		buf = receive_alloc_buffer_chain(rctx->length);
 	} else {
-		/* Alloc the minimum of the remaining length and bytes of one block */
-		uint32_t len = MIN(rctx->length, rctx->opts.bs * (rctx->rx_addr.dl - 1));
+		uint32_t block_len = rctx->opts.bs * (rctx->rx_addr.dl - 1);
 
-		buf = receive_alloc_buffer_chain(len);
+		rctx->bs = rctx->opts.bs;
+
+		/* If the buffers for the rest of the message are free, ask for it in
+		 * one block so that the sender doesn't wait for more FC frames.
+		 */
+		if (IS_ENABLED(CONFIG_ISOTP_RX_ADAPTIVE_BS) && rctx->length > block_len) {
+			buf = receive_alloc_buffer_chain(rctx->length);
+			if (buf) {
+				rctx->bs = 0;
+			}
+		}
+
+		if (!buf) {
+			/* Alloc the minimum of the remaining length and bytes of one block */
+			buf = receive_alloc_buffer_chain(MIN(rctx->length, block_len));
+		}
 	}
 
 	if (!buf) {
@@ -299,7 +314,6 @@ static void receive_state_machine(struct isotp_recv_ctx *rctx)
 		}
 
 		if (rctx->opts.bs) {
-			rctx->bs = rctx->opts.bs;
 			ud_rem_len = net_buf_user_data(rctx->buf);
 			*ud_rem_len = rctx->length;
 			net_buf_put(&rctx->fifo, rctx->buf);
@@ -544,9 +558,8 @@ static void process_cf(struct isotp_recv_ctx *rctx, struct can_frame *frame)
 		return;
 	}
 
-	if (rctx->opts.bs && !--rctx->bs) {
+	if (rctx->bs && !--rctx->bs) {
 		LOG_DBG("Block is complete. Allocate new buffer");
-		rctx->bs = rctx->opts.bs;
 		*ud_rem_len = rctx->length;
 		net_buf_put(&rctx->fifo, rctx->buf);
 		rctx->state = ISOTP_RX_STATE_TRY_ALLOC;
@@ -5,6 +5,7 @@
  */
 
 #include <errno.h>
+#include <string.h>
 #include <kernel_internal.h>
 #include <zephyr/toolchain.h>
 #include <zephyr/debug/coredump.h>
@@ -58,11 +59,25 @@ static void dump_header(unsigned int reason)
 	backend_api->buffer_output((uint8_t *)&hdr, sizeof(hdr));
 }
 
-static void dump_thread(struct k_thread *thread)
+#if defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_MIN) || \
+	defined(CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS)
+static void dump_thread_memory(struct k_thread *thread)
 {
-#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_MIN
 	uintptr_t end_addr;
 
+	end_addr = POINTER_TO_UINT(thread) + sizeof(*thread);
+
+	coredump_memory_dump(POINTER_TO_UINT(thread), end_addr);
+
+	end_addr = thread->stack_info.start + thread->stack_info.size;
+
+	coredump_memory_dump(thread->stack_info.start, end_addr);
+}
+#endif
+
+static void dump_thread(struct k_thread *thread)
+{
+#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_MIN
 	/*
 	 * When dumping minimum information,
 	 * the current thread struct and stack need to
@@ -73,15 +88,63 @@ static void dump_thread(struct k_thread *thread)
 		return;
 	}
 
-	end_addr = POINTER_TO_UINT(thread) + sizeof(*thread);
+	dump_thread_memory(thread);
+#endif
+}
 
-	coredump_memory_dump(POINTER_TO_UINT(thread), end_addr);
+#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS
+#define DUMP_KERNEL_OBJECTS(type)                                              \
+	do {                                                                   \
+		STRUCT_SECTION_START_EXTERN(type);                             \
+		STRUCT_SECTION_END_EXTERN(type);                               \
+									       \
+		coredump_memory_dump(POINTER_TO_UINT(STRUCT_SECTION_START(type)), \
+				     POINTER_TO_UINT(STRUCT_SECTION_END(type))); \
+	} while (false)
+
+static void dump_threads_and_objects(void)
+{
+	/* The thread currently running on each CPU is in the list */
+	for (struct k_thread *thread = _kernel.threads; thread != NULL;
+	     thread = thread->next_thread) {
+		dump_thread_memory(thread);
+	}
 
-	end_addr = thread->stack_info.start + thread->stack_info.size;
+	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		uintptr_t start = POINTER_TO_UINT(
+			Z_KERNEL_STACK_BUFFER(z_interrupt_stacks[i]));
 
-	coredump_memory_dump(thread->stack_info.start, end_addr);
-#endif
+		coredump_memory_dump(start, start +
+				     K_KERNEL_STACK_SIZEOF(z_interrupt_stacks[i]));
+	}
+
+	coredump_memory_dump(POINTER_TO_UINT(&_kernel),
+			     POINTER_TO_UINT(&_kernel) + sizeof(_kernel));
+
+	/* Objects defined at runtime are within the structs owning them,
+	 * which are only in the dump when they are in a marked region.
+	 */
+	DUMP_KERNEL_OBJECTS(k_timer);
+	DUMP_KERNEL_OBJECTS(k_mem_slab);
+	DUMP_KERNEL_OBJECTS(k_heap);
+	DUMP_KERNEL_OBJECTS(k_mutex);
+	DUMP_KERNEL_OBJECTS(k_stack);
+	DUMP_KERNEL_OBJECTS(k_msgq);
+	DUMP_KERNEL_OBJECTS(k_mbox);
+	DUMP_KERNEL_OBJECTS(k_pipe);
+	DUMP_KERNEL_OBJECTS(k_sem);
+	DUMP_KERNEL_OBJECTS(k_event);
+	DUMP_KERNEL_OBJECTS(k_queue);
+	DUMP_KERNEL_OBJECTS(k_fifo);
+	DUMP_KERNEL_OBJECTS(k_lifo);
+	DUMP_KERNEL_OBJECTS(k_condvar);
+
+	STRUCT_SECTION_FOREACH(coredump_memory_region, r) {
+		coredump_memory_dump(POINTER_TO_UINT(r->start),
+				     POINTER_TO_UINT(r->start) + r->size);
+	}
 }
+#endif /* CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS */
 
 #if defined(CONFIG_COREDUMP_DEVICE)
 static void process_coredump_dev_memory(const struct device *dev)
@@ -111,6 +174,10 @@ void process_memory_region_list(void)
 	}
 #endif
 
+#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_DUMP_THREADS
+	dump_threads_and_objects();
+#endif
+
 #if defined(CONFIG_COREDUMP_DEVICE)
 #define MY_FN(inst) process_coredump_dev_memory(DEVICE_DT_INST_GET(inst));
 	DT_INST_FOREACH_STATUS_OKAY(MY_FN)
@@ -157,6 +224,82 @@ void coredump_buffer_output(uint8_t *buf, size_t buflen)
 	backend_api->buffer_output(buf, buflen);
 }
 
+#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_COMPRESSION
+/*
+ * Memory content is encoded as PackBits: a control byte n of 0 to 127 is
+ * followed by n + 1 literal bytes, a control byte n of 129 to 255 by a
+ * single byte repeated 257 - n times. Every run is encoded from the memory
+ * in place, only the output is buffered so the backend is not called for
+ * every control byte.
+ */
+#define RLE_MAX_LITERAL	128
+#define RLE_MAX_REPEAT	128
+#define RLE_MIN_REPEAT	3
+
+static uint8_t rle_buf[RLE_MAX_LITERAL + 1];
+static size_t rle_buf_len;
+
+static void rle_flush(void)
+{
+	if (rle_buf_len > 0) {
+		backend_api->buffer_output(rle_buf, rle_buf_len);
+		rle_buf_len = 0;
+	}
+}
+
+static void rle_put(const uint8_t *data, size_t len)
+{
+	if (rle_buf_len + len > sizeof(rle_buf)) {
+		rle_flush();
+	}
+
+	memcpy(&rle_buf[rle_buf_len], data, len);
+	rle_buf_len += len;
+}
+
+static size_t rle_repeat_len(const uint8_t *data, size_t len)
+{
+	size_t n = 1;
+
+	while ((n < len) && (n < RLE_MAX_REPEAT) && (data[n] == data[0])) {
+		n++;
+	}
+
+	return n;
+}
+
+static void rle_output(const uint8_t *data, size_t len)
+{
+	while (len > 0) {
+		size_t n = rle_repeat_len(data, len);
+		uint8_t ctrl;
+
+		if (n >= RLE_MIN_REPEAT) {
+			uint8_t repeat[2] = { (uint8_t)(257 - n), data[0] };
+
+			rle_put(repeat, sizeof(repeat));
+		} else {
+			/* Extend the literal up to the next worthwhile repeat */
+			n = 0;
+			do {
+				n++;
+			} while ((n < len) && (n < RLE_MAX_LITERAL) &&
+				 (rle_repeat_len(&data[n], MIN(len - n, RLE_MIN_REPEAT)) <
+				  RLE_MIN_REPEAT));
+
+			ctrl = (uint8_t)(n - 1);
+			rle_put(&ctrl, 1);
+			rle_put(data, n);
+		}
+
+		data += n;
+		len -= n;
+	}
+
+	rle_flush();
+}
+#endif /* CONFIG_DEBUG_COREDUMP_MEMORY_COMPRESSION */
+
 void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
 {
 	struct coredump_mem_hdr_t m;
@@ -174,7 +317,8 @@ void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
 	len = end_addr - start_addr;
 
 	m.id = COREDUMP_MEM_HDR_ID;
-	m.hdr_version = COREDUMP_MEM_HDR_VER;
+	m.hdr_version = IS_ENABLED(CONFIG_DEBUG_COREDUMP_MEMORY_COMPRESSION) ?
+			COREDUMP_MEM_HDR_VER_RLE : COREDUMP_MEM_HDR_VER;
 
 	if (sizeof(uintptr_t) == 8) {
 		m.start	= sys_cpu_to_le64(start_addr);
@@ -186,7 +330,11 @@ void coredump_memory_dump(uintptr_t start_addr, uintptr_t end_addr)
 
 	coredump_buffer_output((uint8_t *)&m, sizeof(m));
 
+#ifdef CONFIG_DEBUG_COREDUMP_MEMORY_COMPRESSION
+	rle_output((const uint8_t *)start_addr, len);
+#else
 	coredump_buffer_output((uint8_t *)start_addr, len);
+#endif
 }
 
 int coredump_query(enum coredump_query_id query_id, void *arg)
@@ -36,6 +36,125 @@ LOG_MODULE_REGISTER(thread_analyzer, CONFIG_THREAD_ANALYZER_LOG_LEVEL);
  */
 #define PTR_STR_MAXLEN (sizeof(void *) * 2 + 2)
 
+#if defined(CONFIG_THREAD_ANALYZER_PEAK)
+#include <zephyr/settings/settings.h>
+
+#define PEAK_SUBTREE "thread_peak"
+
+/* Value stored in settings for each thread, under PEAK_SUBTREE/<name> */
+struct peak_value {
+	uint32_t size;
+	uint32_t used;
+};
+
+struct thread_peak {
+	char name[CONFIG_THREAD_MAX_NAME_LEN];
+	struct peak_value value;
+	bool dirty;
+};
+
+/* Used entries are first, followed by entries with an empty name */
+static struct thread_peak peaks[CONFIG_THREAD_ANALYZER_PEAK_THREADS];
+
+static struct thread_peak *peak_get(const char *name)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(peaks); i++) {
+		if (peaks[i].name[0] == '\0') {
+			strncpy(peaks[i].name, name, sizeof(peaks[i].name) - 1);
+			return &peaks[i];
+		}
+
+		if (strncmp(peaks[i].name, name, sizeof(peaks[i].name) - 1) == 0) {
+			return &peaks[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void peak_update(const char *name, size_t size, size_t used)
+{
+	struct thread_peak *peak = peak_get(name);
+
+	if (peak == NULL) {
+		return;
+	}
+
+	if (used > peak->value.used || size != peak->value.size) {
+		peak->value.used = MAX(used, peak->value.used);
+		peak->value.size = size;
+		peak->dirty = true;
+	}
+}
+
+static void peak_save(void)
+{
+	char key[sizeof(PEAK_SUBTREE) + CONFIG_THREAD_MAX_NAME_LEN];
+	int err;
+
+	for (size_t i = 0; i < ARRAY_SIZE(peaks) && peaks[i].name[0] != '\0'; i++) {
+		if (!peaks[i].dirty) {
+			continue;
+		}
+
+		snprintk(key, sizeof(key), PEAK_SUBTREE "/%s", peaks[i].name);
+
+		err = settings_save_one(key, &peaks[i].value, sizeof(peaks[i].value));
+		if (err) {
+			LOG_WRN("Cannot save stack peak of %s (%d)", peaks[i].name, err);
+			continue;
+		}
+
+		peaks[i].dirty = false;
+	}
+}
+
+static int peak_set(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg)
+{
+	struct thread_peak *peak;
+	struct peak_value value;
+	ssize_t rc;
+
+	if (len != sizeof(value)) {
+		return -EINVAL;
+	}
+
+	rc = read_cb(cb_arg, &value, sizeof(value));
+	if (rc < 0) {
+		return rc;
+	}
+
+	peak = peak_get(key);
+	if (peak == NULL) {
+		return -ENOMEM;
+	}
+
+	/* Peaks seen before the settings were loaded are kept if higher */
+	peak->value.used = MAX(value.used, peak->value.used);
+
+	if (peak->value.size == 0U) {
+		peak->value.size = value.size;
+	}
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(thread_analyzer_peak, PEAK_SUBTREE, NULL, peak_set, NULL,
+			       NULL);
+
+void thread_analyzer_peak_print(void)
+{
+	THREAD_ANALYZER_PRINT(THREAD_ANALYZER_FMT("Thread stack peaks:"));
+
+	for (size_t i = 0; i < ARRAY_SIZE(peaks) && peaks[i].name[0] != '\0'; i++) {
+		THREAD_ANALYZER_PRINT(
+			THREAD_ANALYZER_FMT(" %-20s: peak %u / %u"),
+			THREAD_ANALYZER_VSTR(peaks[i].name),
+			peaks[i].value.used, peaks[i].value.size);
+	}
+}
+#endif /* CONFIG_THREAD_ANALYZER_PEAK */
+
 static void thread_print_cb(struct thread_analyzer_info *info)
 {
 	size_t pcnt = (info->stack_used * 100U) / info->stack_size;
@@ -108,6 +227,13 @@ static void thread_analyze_cb(const struct k_thread *cthread, void *user_data)
 	info.stack_size = size;
 	info.stack_used = size - unused;
 
+#if defined(CONFIG_THREAD_ANALYZER_PEAK)
+	/* Threads without a name cannot be told apart across boots */
+	if (name != hexname) {
+		peak_update(name, info.stack_size, info.stack_used);
+	}
+#endif
+
 #ifdef CONFIG_THREAD_RUNTIME_STATS
 	ret = 0;
 
@@ -161,6 +287,10 @@ void thread_analyzer_run(thread_analyzer_cb cb)
 	if (IS_ENABLED(CONFIG_THREAD_ANALYZER_ISR_STACK_USAGE)) {
 		isr_stacks();
 	}
+
+#if defined(CONFIG_THREAD_ANALYZER_PEAK)
+	peak_save();
+#endif
 }
 
 void thread_analyzer_print(void)
@@ -175,6 +305,9 @@ void thread_analyzer_auto(void)
 {
 	for (;;) {
 		thread_analyzer_print();
+#if defined(CONFIG_THREAD_ANALYZER_PEAK)
+		thread_analyzer_peak_print();
+#endif
 		k_sleep(K_SECONDS(CONFIG_THREAD_ANALYZER_AUTO_INTERVAL));
 	}
 }
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Clock (second chance) eviction algorithm for demand paging
+ */
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+/* The page frames form a circle with a hand pointing at the next
+ * candidate for eviction. Starting from the hand, a page that was
+ * accessed since the hand last passed it gets its accessed bit cleared
+ * and a second chance, the first one that was not accessed is evicted.
+ *
+ * Unlike NRU this needs no periodic timer: the accessed bits are only
+ * cleared as the hand sweeps, so a page is evicted only if it was left
+ * untouched for a full turn of the hand, which approximates LRU.
+ */
+static size_t clock_hand;
+
+static struct z_page_frame *clock_next(void)
+{
+	struct z_page_frame *pf = &z_page_frames[clock_hand];
+
+	clock_hand++;
+	if (clock_hand == Z_NUM_PAGE_FRAMES) {
+		clock_hand = 0;
+	}
+
+	return pf;
+}
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct z_page_frame *pf, *dirty_pf = NULL;
+	uintptr_t flags;
+
+	/* After one turn every accessed bit is clear, so a second turn
+	 * always finds a page unless nothing can be evicted.
+	 */
+	for (size_t i = 0; i < 2 * Z_NUM_PAGE_FRAMES; i++) {
+		pf = clock_next();
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		/* Read and clear the accessed bit */
+		flags = arch_page_info_get(pf->addr, NULL, true);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL) {
+			continue;
+		}
+
+		if ((flags & ARCH_DATA_PAGE_DIRTY) == 0UL) {
+			*dirty_ptr = false;
+			return pf;
+		}
+
+		/* Prefer a clean page over the turn if there is one, as it
+		 * need not be written out.
+		 */
+		if (dirty_pf == NULL) {
+			dirty_pf = pf;
+		} else if (dirty_pf == pf) {
+			break;
+		}
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(dirty_pf != NULL, "no page to evict");
+
+	*dirty_ptr = true;
+
+	return dirty_pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
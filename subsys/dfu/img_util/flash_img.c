@@ -18,6 +18,12 @@
 #include <zephyr/dfu/mcuboot.h>
 #endif
 
+#ifdef CONFIG_IMG_STREAM_HASH
+#ifdef CONFIG_FLASH_AREA_CHECK_INTEGRITY_TC
+#include <tinycrypt/constants.h>
+#endif
+#endif
+
 #include <zephyr/devicetree.h>
 #ifdef CONFIG_TRUSTED_EXECUTION_NONSECURE
 	#define UPLOAD_FLASH_AREA_LABEL slot1_ns_partition
@@ -43,12 +49,70 @@ BUILD_ASSERT((CONFIG_IMG_BLOCK_BUF_SIZE % FLASH_WRITE_BLOCK_SIZE == 0),
 	     "FLASH_WRITE_BLOCK_SIZE");
 #endif
 
+#ifdef CONFIG_IMG_STREAM_HASH
+static void img_hash_start(struct flash_img_context *ctx, uint8_t area_id)
+{
+	ctx->hashed = 0;
+	ctx->area_id = area_id;
+#ifdef CONFIG_FLASH_AREA_CHECK_INTEGRITY_TC
+	ctx->hash_valid = (tc_sha256_init(&ctx->sha) == TC_CRYPTO_SUCCESS);
+#else
+	mbedtls_sha256_init(&ctx->sha);
+	ctx->hash_valid = (mbedtls_sha256_starts(&ctx->sha, 0) == 0);
+#endif
+}
+
+static void img_hash_update(struct flash_img_context *ctx, const uint8_t *data,
+			    size_t len)
+{
+	if (!ctx->hash_valid || len == 0) {
+		return;
+	}
+
+#ifdef CONFIG_FLASH_AREA_CHECK_INTEGRITY_TC
+	ctx->hash_valid = (tc_sha256_update(&ctx->sha, data, len) ==
+			   TC_CRYPTO_SUCCESS);
+#else
+	ctx->hash_valid = (mbedtls_sha256_update(&ctx->sha, data, len) == 0);
+#endif
+	ctx->hashed += len;
+}
+
+static void img_hash_finish(struct flash_img_context *ctx)
+{
+	if (!ctx->hash_valid) {
+		return;
+	}
+
+#ifdef CONFIG_FLASH_AREA_CHECK_INTEGRITY_TC
+	ctx->hash_valid = (tc_sha256_final(ctx->digest, &ctx->sha) ==
+			   TC_CRYPTO_SUCCESS);
+#else
+	ctx->hash_valid = (mbedtls_sha256_finish(&ctx->sha, ctx->digest) == 0);
+	mbedtls_sha256_free(&ctx->sha);
+#endif
+}
+#endif /* CONFIG_IMG_STREAM_HASH */
+
 int flash_img_buffered_write(struct flash_img_context *ctx, const uint8_t *data,
 			     size_t len, bool flush)
 {
 	int rc;
 
 	rc = stream_flash_buffered_write(&ctx->stream, data, len, flush);
+
+#ifdef CONFIG_IMG_STREAM_HASH
+	if (rc == 0) {
+		img_hash_update(ctx, data, len);
+	} else {
+		ctx->hash_valid = false;
+	}
+
+	if (flush) {
+		img_hash_finish(ctx);
+	}
+#endif
+
 	if (!flush) {
 		return rc;
 	}
@@ -88,9 +152,25 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 
 	flash_dev = flash_area_get_device(ctx->flash_area);
 
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
 			CONFIG_IMG_BLOCK_BUF_SIZE, ctx->flash_area->fa_off,
 			ctx->flash_area->fa_size, NULL);
+	if (rc) {
+		return rc;
+	}
+
+#ifdef CONFIG_IMG_STREAM_PIPELINE
+	rc = stream_flash_pipeline_init(&ctx->stream, ctx->buf2);
+	if (rc) {
+		return rc;
+	}
+#endif
+
+#ifdef CONFIG_IMG_STREAM_HASH
+	img_hash_start(ctx, area_id);
+#endif
+
+	return 0;
 }
 
 int flash_img_init(struct flash_img_context *ctx)
@@ -110,6 +190,16 @@ int flash_img_check(struct flash_img_context *ctx,
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_IMG_STREAM_HASH
+	/* The image was hashed while it was written, no need to read it back */
+	if (ctx->hash_valid && ctx->flash_area == NULL &&
+	    ctx->area_id == area_id && ctx->hashed == fic->clen &&
+	    fic->match != NULL) {
+		return memcmp(ctx->digest, fic->match, sizeof(ctx->digest)) ?
+		       -EILSEQ : 0;
+	}
+#endif
+
 	rc = flash_area_open(area_id,
 			     (const struct flash_area **)&(ctx->flash_area));
 	if (rc) {
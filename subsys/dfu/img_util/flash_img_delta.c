@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/dfu/flash_img.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/util.h>
+
+enum delta_state {
+	DELTA_STATE_MAGIC,
+	DELTA_STATE_SIZE,
+	DELTA_STATE_OP,
+	DELTA_STATE_ARG,
+	DELTA_STATE_DATA,
+};
+
+static int delta_output(struct flash_img_delta_context *ctx,
+			const uint8_t *data, size_t len)
+{
+	int rc;
+
+	if (len > ctx->size - ctx->written) {
+		return -EINVAL;
+	}
+
+	rc = flash_img_buffered_write(&ctx->img, data, len, false);
+	if (rc == 0) {
+		ctx->written += len;
+	}
+
+	return rc;
+}
+
+/* Output len bytes of the source image, with diff added when not NULL. */
+static int delta_copy(struct flash_img_delta_context *ctx, size_t len,
+		      const uint8_t *diff)
+{
+	size_t n;
+	int rc;
+
+	if (ctx->source_off > ctx->source->fa_size ||
+	    len > ctx->source->fa_size - ctx->source_off) {
+		return -EINVAL;
+	}
+
+	while (len > 0) {
+		n = MIN(len, sizeof(ctx->buf));
+
+		rc = flash_area_read(ctx->source, ctx->source_off, ctx->buf, n);
+		if (rc) {
+			return rc;
+		}
+
+		if (diff != NULL) {
+			for (size_t i = 0; i < n; i++) {
+				ctx->buf[i] += diff[i];
+			}
+			diff += n;
+		}
+
+		rc = delta_output(ctx, ctx->buf, n);
+		if (rc) {
+			return rc;
+		}
+
+		ctx->source_off += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+static int delta_seek(struct flash_img_delta_context *ctx)
+{
+	int32_t delta = (int32_t)(ctx->arg >> 1) ^ -(int32_t)(ctx->arg & 1);
+	int64_t off = (int64_t)ctx->source_off + delta;
+
+	if (off < 0 || off > ctx->source->fa_size) {
+		return -EINVAL;
+	}
+
+	ctx->source_off = off;
+
+	return 0;
+}
+
+/* Run an operation once its argument is decoded. */
+static int delta_op(struct flash_img_delta_context *ctx)
+{
+	int rc = 0;
+
+	ctx->shift = 0;
+	ctx->state = DELTA_STATE_OP;
+
+	switch (ctx->op) {
+	case FLASH_IMG_DELTA_OP_COPY:
+		rc = delta_copy(ctx, ctx->arg, NULL);
+		break;
+	case FLASH_IMG_DELTA_OP_ADD:
+	case FLASH_IMG_DELTA_OP_INSERT:
+		if (ctx->arg > 0) {
+			/* arg now counts the data bytes left */
+			ctx->state = DELTA_STATE_DATA;
+			return 0;
+		}
+		break;
+	case FLASH_IMG_DELTA_OP_SEEK:
+		rc = delta_seek(ctx);
+		break;
+	default:
+		rc = -EINVAL;
+		break;
+	}
+
+	ctx->arg = 0;
+
+	return rc;
+}
+
+int flash_img_delta_write(struct flash_img_delta_context *ctx,
+			  const uint8_t *data, size_t len, bool flush)
+{
+	size_t n;
+	int rc;
+
+	while (len > 0) {
+		switch (ctx->state) {
+		case DELTA_STATE_MAGIC:
+		case DELTA_STATE_SIZE:
+			ctx->arg |= (uint32_t)*data << ctx->shift;
+			ctx->shift += 8;
+			data++;
+			len--;
+
+			if (ctx->shift < 32) {
+				break;
+			}
+
+			if (ctx->state == DELTA_STATE_MAGIC) {
+				if (ctx->arg != FLASH_IMG_DELTA_MAGIC) {
+					return -EINVAL;
+				}
+				ctx->state = DELTA_STATE_SIZE;
+			} else {
+				if (ctx->arg > ctx->img.flash_area->fa_size) {
+					return -EINVAL;
+				}
+				ctx->size = ctx->arg;
+				ctx->state = DELTA_STATE_OP;
+			}
+
+			ctx->arg = 0;
+			ctx->shift = 0;
+			break;
+		case DELTA_STATE_OP:
+			ctx->op = *data;
+			ctx->state = DELTA_STATE_ARG;
+			data++;
+			len--;
+			break;
+		case DELTA_STATE_ARG:
+			/* At most five LEB128 bytes for a 32-bit value */
+			if (ctx->shift > 28) {
+				return -EINVAL;
+			}
+
+			ctx->arg |= (uint32_t)(*data & 0x7f) << ctx->shift;
+			ctx->shift += 7;
+			data++;
+			len--;
+
+			if ((data[-1] & 0x80) == 0) {
+				rc = delta_op(ctx);
+				if (rc) {
+					return rc;
+				}
+			}
+			break;
+		case DELTA_STATE_DATA:
+			n = MIN(len, ctx->arg);
+
+			if (ctx->op == FLASH_IMG_DELTA_OP_ADD) {
+				rc = delta_copy(ctx, n, data);
+			} else {
+				rc = delta_output(ctx, data, n);
+			}
+
+			if (rc) {
+				return rc;
+			}
+
+			data += n;
+			len -= n;
+			ctx->arg -= n;
+
+			if (ctx->arg == 0) {
+				ctx->state = DELTA_STATE_OP;
+			}
+			break;
+		default:
+			return -EINVAL;
+		}
+	}
+
+	if (!flush) {
+		return 0;
+	}
+
+	if (ctx->state != DELTA_STATE_OP || ctx->written != ctx->size) {
+		return -EINVAL;
+	}
+
+	rc = flash_img_buffered_write(&ctx->img, data, 0, true);
+
+	flash_area_close(ctx->source);
+
+	return rc;
+}
+
+int flash_img_delta_init_id(struct flash_img_delta_context *ctx,
+			    uint8_t source_area_id, uint8_t area_id)
+{
+	int rc;
+
+	if (source_area_id == area_id) {
+		return -EINVAL;
+	}
+
+	rc = flash_area_open(source_area_id, &ctx->source);
+	if (rc) {
+		return rc;
+	}
+
+	rc = flash_img_init_id(&ctx->img, area_id);
+	if (rc) {
+		flash_area_close(ctx->source);
+		return rc;
+	}
+
+	ctx->source_off = 0;
+	ctx->size = 0;
+	ctx->written = 0;
+	ctx->arg = 0;
+	ctx->shift = 0;
+	ctx->op = 0;
+	ctx->state = DELTA_STATE_MAGIC;
+
+	return 0;
+}
@@ -0,0 +1,407 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Portable C implementation of the DSP basic math functions.
+ *
+ * The results match the CMSIS-DSP ones bit for bit, including the rounding
+ * of the fixed-point functions. Each function is a single loop with no
+ * dependency between iterations other than the accumulation of the dot
+ * products, which the compiler can vectorize for the SIMD extension of the
+ * target (Arm MVE, RISC-V P or V, Xtensa HiFi...). Pointers are not
+ * restrict qualified as the functions may be called in place.
+ */
+
+#include <zephyr/dsp/dsp.h>
+#include <zephyr/sys/util.h>
+
+static inline q7_t sat_q7(int32_t x)
+{
+	return (q7_t)CLAMP(x, INT8_MIN, INT8_MAX);
+}
+
+static inline q15_t sat_q15(int32_t x)
+{
+	return (q15_t)CLAMP(x, INT16_MIN, INT16_MAX);
+}
+
+static inline q31_t sat_q31(int64_t x)
+{
+	return (q31_t)CLAMP(x, INT32_MIN, INT32_MAX);
+}
+
+void zdsp_mult_q7(const DSP_DATA q7_t *src_a, const DSP_DATA q7_t *src_b, DSP_DATA q7_t *dst,
+		  uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q7(((int32_t)src_a[i] * src_b[i]) >> 7);
+	}
+}
+
+void zdsp_mult_q15(const DSP_DATA q15_t *src_a, const DSP_DATA q15_t *src_b,
+		   DSP_DATA q15_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q15(((int32_t)src_a[i] * src_b[i]) >> 15);
+	}
+}
+
+void zdsp_mult_q31(const DSP_DATA q31_t *src_a, const DSP_DATA q31_t *src_b,
+		   DSP_DATA q31_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		/* Only -1 * -1 saturates, the low bit is dropped as in CMSIS-DSP */
+		int64_t out = ((int64_t)src_a[i] * src_b[i]) >> 32;
+
+		dst[i] = (q31_t)((uint32_t)CLAMP(out, INT32_MIN >> 1, INT32_MAX >> 1) << 1);
+	}
+}
+
+void zdsp_mult_f32(const DSP_DATA float32_t *src_a, const DSP_DATA float32_t *src_b,
+		   DSP_DATA float32_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = src_a[i] * src_b[i];
+	}
+}
+
+void zdsp_add_f32(const DSP_DATA float32_t *src_a, const DSP_DATA float32_t *src_b,
+		  DSP_DATA float32_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = src_a[i] + src_b[i];
+	}
+}
+
+void zdsp_add_q7(const DSP_DATA q7_t *src_a, const DSP_DATA q7_t *src_b, DSP_DATA q7_t *dst,
+		 uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q7((int32_t)src_a[i] + src_b[i]);
+	}
+}
+
+void zdsp_add_q15(const DSP_DATA q15_t *src_a, const DSP_DATA q15_t *src_b, DSP_DATA q15_t *dst,
+		  uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q15((int32_t)src_a[i] + src_b[i]);
+	}
+}
+
+void zdsp_add_q31(const DSP_DATA q31_t *src_a, const DSP_DATA q31_t *src_b, DSP_DATA q31_t *dst,
+		  uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q31((int64_t)src_a[i] + src_b[i]);
+	}
+}
+
+void zdsp_sub_f32(const DSP_DATA float32_t *src_a, const DSP_DATA float32_t *src_b,
+		  DSP_DATA float32_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = src_a[i] - src_b[i];
+	}
+}
+
+void zdsp_sub_q7(const DSP_DATA q7_t *src_a, const DSP_DATA q7_t *src_b, DSP_DATA q7_t *dst,
+		 uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q7((int32_t)src_a[i] - src_b[i]);
+	}
+}
+
+void zdsp_sub_q15(const DSP_DATA q15_t *src_a, const DSP_DATA q15_t *src_b, DSP_DATA q15_t *dst,
+		  uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q15((int32_t)src_a[i] - src_b[i]);
+	}
+}
+
+void zdsp_sub_q31(const DSP_DATA q31_t *src_a, const DSP_DATA q31_t *src_b, DSP_DATA q31_t *dst,
+		  uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q31((int64_t)src_a[i] - src_b[i]);
+	}
+}
+
+void zdsp_scale_f32(const DSP_DATA float32_t *src, float32_t scale, DSP_DATA float32_t *dst,
+		    uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = src[i] * scale;
+	}
+}
+
+void zdsp_scale_q7(const DSP_DATA q7_t *src, q7_t scale_fract, int8_t shift, DSP_DATA q7_t *dst,
+		   uint32_t block_size)
+{
+	int shift_r = 7 - shift;
+
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q7(((int32_t)src[i] * scale_fract) >> shift_r);
+	}
+}
+
+void zdsp_scale_q15(const DSP_DATA q15_t *src, q15_t scale_fract, int8_t shift,
+		    DSP_DATA q15_t *dst, uint32_t block_size)
+{
+	int shift_r = 15 - shift;
+
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q15(((int32_t)src[i] * scale_fract) >> shift_r);
+	}
+}
+
+void zdsp_scale_q31(const DSP_DATA q31_t *src, q31_t scale_fract, int8_t shift,
+		    DSP_DATA q31_t *dst, uint32_t block_size)
+{
+	/* The product keeps one bit of headroom, taken back by the shift */
+	int shift_l = shift + 1;
+
+	if (shift_l >= 0) {
+		for (uint32_t i = 0; i < block_size; i++) {
+			int64_t in = ((int64_t)src[i] * scale_fract) >> 32;
+
+			dst[i] = sat_q31(in * ((int64_t)1 << shift_l));
+		}
+	} else {
+		for (uint32_t i = 0; i < block_size; i++) {
+			int64_t in = ((int64_t)src[i] * scale_fract) >> 32;
+
+			dst[i] = (q31_t)(in >> -shift_l);
+		}
+	}
+}
+
+void zdsp_abs_f32(const DSP_DATA float32_t *src, DSP_DATA float32_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = (src[i] < 0.0f) ? -src[i] : src[i];
+	}
+}
+
+void zdsp_abs_q7(const DSP_DATA q7_t *src, DSP_DATA q7_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q7(((int32_t)src[i] < 0) ? -(int32_t)src[i] : src[i]);
+	}
+}
+
+void zdsp_abs_q15(const DSP_DATA q15_t *src, DSP_DATA q15_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q15(((int32_t)src[i] < 0) ? -(int32_t)src[i] : src[i]);
+	}
+}
+
+void zdsp_abs_q31(const DSP_DATA q31_t *src, DSP_DATA q31_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q31((src[i] < 0) ? -(int64_t)src[i] : src[i]);
+	}
+}
+
+void zdsp_dot_prod_f32(const DSP_DATA float32_t *src_a, const DSP_DATA float32_t *src_b,
+		       uint32_t block_size, DSP_DATA float32_t *result)
+{
+	float32_t sum = 0.0f;
+
+	for (uint32_t i = 0; i < block_size; i++) {
+		sum += src_a[i] * src_b[i];
+	}
+
+	*result = sum;
+}
+
+void zdsp_dot_prod_q7(const DSP_DATA q7_t *src_a, const DSP_DATA q7_t *src_b,
+		      uint32_t block_size, DSP_DATA q31_t *result)
+{
+	int32_t sum = 0;
+
+	for (uint32_t i = 0; i < block_size; i++) {
+		sum += (int32_t)src_a[i] * src_b[i];
+	}
+
+	*result = sum;
+}
+
+void zdsp_dot_prod_q15(const DSP_DATA q15_t *src_a, const DSP_DATA q15_t *src_b,
+		       uint32_t block_size, DSP_DATA q63_t *result)
+{
+	int64_t sum = 0;
+
+	for (uint32_t i = 0; i < block_size; i++) {
+		sum += (int32_t)src_a[i] * src_b[i];
+	}
+
+	*result = sum;
+}
+
+void zdsp_dot_prod_q31(const DSP_DATA q31_t *src_a, const DSP_DATA q31_t *src_b,
+		       uint32_t block_size, DSP_DATA q63_t *result)
+{
+	int64_t sum = 0;
+
+	/* Products are accumulated in 16.48 format */
+	for (uint32_t i = 0; i < block_size; i++) {
+		sum += ((int64_t)src_a[i] * src_b[i]) >> 14;
+	}
+
+	*result = sum;
+}
+
+void zdsp_shift_q7(const DSP_DATA q7_t *src, int8_t shift_bits, DSP_DATA q7_t *dst,
+		   uint32_t block_size)
+{
+	if (shift_bits >= 0) {
+		for (uint32_t i = 0; i < block_size; i++) {
+			dst[i] = sat_q7((int32_t)src[i] * (1 << shift_bits));
+		}
+	} else {
+		for (uint32_t i = 0; i < block_size; i++) {
+			dst[i] = (q7_t)(src[i] >> -shift_bits);
+		}
+	}
+}
+
+void zdsp_shift_q15(const DSP_DATA q15_t *src, int8_t shift_bits, DSP_DATA q15_t *dst,
+		    uint32_t block_size)
+{
+	if (shift_bits >= 0) {
+		for (uint32_t i = 0; i < block_size; i++) {
+			dst[i] = sat_q15((int32_t)src[i] * (1 << shift_bits));
+		}
+	} else {
+		for (uint32_t i = 0; i < block_size; i++) {
+			dst[i] = (q15_t)(src[i] >> -shift_bits);
+		}
+	}
+}
+
+void zdsp_shift_q31(const DSP_DATA q31_t *src, int8_t shift_bits, DSP_DATA q31_t *dst,
+		    uint32_t block_size)
+{
+	if (shift_bits >= 0) {
+		for (uint32_t i = 0; i < block_size; i++) {
+			dst[i] = sat_q31((int64_t)src[i] * ((int64_t)1 << shift_bits));
+		}
+	} else {
+		for (uint32_t i = 0; i < block_size; i++) {
+			dst[i] = src[i] >> -shift_bits;
+		}
+	}
+}
+
+void zdsp_offset_f32(const DSP_DATA float32_t *src, float32_t offset, DSP_DATA float32_t *dst,
+		     uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = src[i] + offset;
+	}
+}
+
+void zdsp_offset_q7(const DSP_DATA q7_t *src, q7_t offset, DSP_DATA q7_t *dst,
+		    uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q7((int32_t)src[i] + offset);
+	}
+}
+
+void zdsp_offset_q15(const DSP_DATA q15_t *src, q15_t offset, DSP_DATA q15_t *dst,
+		     uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q15((int32_t)src[i] + offset);
+	}
+}
+
+void zdsp_offset_q31(const DSP_DATA q31_t *src, q31_t offset, DSP_DATA q31_t *dst,
+		     uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q31((int64_t)src[i] + offset);
+	}
+}
+
+void zdsp_negate_f32(const DSP_DATA float32_t *src, DSP_DATA float32_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = -src[i];
+	}
+}
+
+void zdsp_negate_q7(const DSP_DATA q7_t *src, DSP_DATA q7_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q7(-(int32_t)src[i]);
+	}
+}
+
+void zdsp_negate_q15(const DSP_DATA q15_t *src, DSP_DATA q15_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q15(-(int32_t)src[i]);
+	}
+}
+
+void zdsp_negate_q31(const DSP_DATA q31_t *src, DSP_DATA q31_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = sat_q31(-(int64_t)src[i]);
+	}
+}
+
+#define ZDSP_BITWISE_2(name, type, op)                                                             \
+	void zdsp_##name(const DSP_DATA type *src_a, const DSP_DATA type *src_b,                   \
+			 DSP_DATA type *dst, uint32_t block_size)                                  \
+	{                                                                                          \
+		for (uint32_t i = 0; i < block_size; i++) {                                        \
+			dst[i] = src_a[i] op src_b[i];                                             \
+		}                                                                                  \
+	}
+
+ZDSP_BITWISE_2(and_u8, uint8_t, &)
+ZDSP_BITWISE_2(and_u16, uint16_t, &)
+ZDSP_BITWISE_2(and_u32, uint32_t, &)
+ZDSP_BITWISE_2(or_u8, uint8_t, |)
+ZDSP_BITWISE_2(or_u16, uint16_t, |)
+ZDSP_BITWISE_2(or_u32, uint32_t, |)
+ZDSP_BITWISE_2(xor_u8, uint8_t, ^)
+ZDSP_BITWISE_2(xor_u16, uint16_t, ^)
+ZDSP_BITWISE_2(xor_u32, uint32_t, ^)
+
+#define ZDSP_NOT(name, type)                                                                       \
+	void zdsp_##name(const DSP_DATA type *src, DSP_DATA type *dst, uint32_t block_size)        \
+	{                                                                                          \
+		for (uint32_t i = 0; i < block_size; i++) {                                        \
+			dst[i] = (type)~src[i];                                                    \
+		}                                                                                  \
+	}
+
+ZDSP_NOT(not_u8, uint8_t)
+ZDSP_NOT(not_u16, uint16_t)
+ZDSP_NOT(not_u32, uint32_t)
+
+#define ZDSP_CLIP(name, type)                                                                      \
+	void zdsp_##name(const DSP_DATA type *src, DSP_DATA type *dst, type low, type high,        \
+			 uint32_t num_samples)                                                     \
+	{                                                                                          \
+		for (uint32_t i = 0; i < num_samples; i++) {                                       \
+			dst[i] = CLAMP(src[i], low, high);                                         \
+		}                                                                                  \
+	}
+
+ZDSP_CLIP(clip_f32, float32_t)
+ZDSP_CLIP(clip_q31, q31_t)
+ZDSP_CLIP(clip_q15, q15_t)
+ZDSP_CLIP(clip_q7, q7_t)
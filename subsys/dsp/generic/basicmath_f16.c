@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Portable C implementation of the DSP basic math functions for
+ *        16 bit floating point.
+ */
+
+#include <zephyr/dsp/dsp.h>
+#include <zephyr/sys/util.h>
+
+void zdsp_mult_f16(const float16_t *src_a, const float16_t *src_b, float16_t *dst,
+		   uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = src_a[i] * src_b[i];
+	}
+}
+
+void zdsp_add_f16(const float16_t *src_a, const float16_t *src_b, float16_t *dst,
+		  uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = src_a[i] + src_b[i];
+	}
+}
+
+void zdsp_sub_f16(const float16_t *src_a, const float16_t *src_b, float16_t *dst,
+		  uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = src_a[i] - src_b[i];
+	}
+}
+
+void zdsp_scale_f16(const float16_t *src, float16_t scale, float16_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = src[i] * scale;
+	}
+}
+
+void zdsp_abs_f16(const float16_t *src, float16_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = (src[i] < 0) ? -src[i] : src[i];
+	}
+}
+
+void zdsp_dot_prod_f16(const float16_t *src_a, const float16_t *src_b, uint32_t block_size,
+		       float16_t *result)
+{
+	float16_t sum = 0;
+
+	for (uint32_t i = 0; i < block_size; i++) {
+		sum += src_a[i] * src_b[i];
+	}
+
+	*result = sum;
+}
+
+void zdsp_offset_f16(const float16_t *src, float16_t offset, float16_t *dst,
+		     uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = src[i] + offset;
+	}
+}
+
+void zdsp_negate_f16(const float16_t *src, float16_t *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		dst[i] = -src[i];
+	}
+}
+
+void zdsp_clip_f16(const float16_t *src, float16_t *dst, float16_t low, float16_t high,
+		   uint32_t num_samples)
+{
+	for (uint32_t i = 0; i < num_samples; i++) {
+		dst[i] = CLAMP(src[i], low, high);
+	}
+}
@@ -0,0 +1,13 @@
+/* Copyright (c) 2024 Zephyr Project
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef SUBSYS_MATH_GENERIC_BACKEND_PUBLIC_ZDSP_BACKEND_DSP_H_
+#define SUBSYS_MATH_GENERIC_BACKEND_PUBLIC_ZDSP_BACKEND_DSP_H_
+
+/*
+ * The generic backend implements the functions declared by
+ * <zephyr/dsp/basicmath.h> in subsys/dsp/generic, nothing is inlined.
+ */
+
+#endif /* SUBSYS_MATH_GENERIC_BACKEND_PUBLIC_ZDSP_BACKEND_DSP_H_ */
@@ -91,6 +91,75 @@ fcb_erase_sector(const struct fcb *fcb, const struct flash_sector *sector)
 	return 0;
 }
 
+#ifdef CONFIG_FCB_ENTRY_INDEX
+/* Count the valid entries of each sector */
+static int fcb_index_build(struct fcb *fcb)
+{
+	struct fcb_entry loc;
+	int rc;
+
+	if (fcb->f_entry_cnt == NULL) {
+		return 0;
+	}
+
+	(void)memset(fcb->f_entry_cnt, 0,
+		     fcb->f_sector_cnt * sizeof(fcb->f_entry_cnt[0]));
+	(void)memset(&loc, 0, sizeof(loc));
+
+	while ((rc = fcb_getnext_nolock(fcb, &loc)) == 0) {
+		fcb_index_add(fcb, loc.fe_sector);
+	}
+
+	return (rc == -ENOTSUP) ? 0 : rc;
+}
+
+/* Find the entry n entries before the end using the entry index */
+static int fcb_index_last_n(struct fcb *fcb, uint8_t entries,
+			    struct fcb_entry *last_n_entry)
+{
+	struct flash_sector *sector;
+	struct fcb_entry loc;
+	uint32_t total = 0U;
+	uint32_t skip;
+	int rc;
+
+	sector = fcb->f_oldest;
+	while (true) {
+		total += *fcb_index_cnt(fcb, sector);
+		if (sector == fcb->f_active.fe_sector) {
+			break;
+		}
+		sector = fcb_getnext_sector(fcb, sector);
+	}
+
+	if (total == 0U) {
+		return -ENOENT;
+	}
+
+	skip = (total > entries) ? total - entries : 0U;
+
+	/* Skip the sectors holding only older entries */
+	sector = fcb->f_oldest;
+	while (skip >= *fcb_index_cnt(fcb, sector)) {
+		skip -= *fcb_index_cnt(fcb, sector);
+		sector = fcb_getnext_sector(fcb, sector);
+	}
+
+	(void)memset(&loc, 0, sizeof(loc));
+	loc.fe_sector = sector;
+	do {
+		rc = fcb_getnext_nolock(fcb, &loc);
+		if (rc) {
+			return -ENOENT;
+		}
+	} while (skip-- > 0U);
+
+	*last_n_entry = loc;
+
+	return 0;
+}
+#endif /* CONFIG_FCB_ENTRY_INDEX */
+
 int
 fcb_init(int f_area_id, struct fcb *fcb)
 {
@@ -171,6 +240,11 @@ fcb_init(int f_area_id, struct fcb *fcb)
 		}
 	}
 	k_mutex_init(&fcb->f_mtx);
+#ifdef CONFIG_FCB_ENTRY_INDEX
+	if (rc == 0) {
+		rc = fcb_index_build(fcb);
+	}
+#endif
 	return rc;
 }
 
@@ -270,6 +344,7 @@ fcb_sector_hdr_init(struct fcb *fcb, struct flash_sector *sector, uint16_t id)
 	if (rc != 0) {
 		return -EIO;
 	}
+	fcb_index_reset(fcb, sector);
 	return 0;
 }
 
@@ -321,6 +396,18 @@ fcb_offset_last_n(struct fcb *fcb, uint8_t entries,
 		entries = 1U;
 	}
 
+#ifdef CONFIG_FCB_ENTRY_INDEX
+	if (fcb->f_entry_cnt != NULL) {
+		rc = k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+		if (rc) {
+			return -EINVAL;
+		}
+		rc = fcb_index_last_n(fcb, entries, last_n_entry);
+		k_mutex_unlock(&fcb->f_mtx);
+		return rc;
+	}
+#endif
+
 	i = 0;
 	(void)memset(&loc, 0, sizeof(loc));
 	while (!fcb_getnext(fcb, &loc)) {
@@ -136,5 +136,8 @@ fcb_append_finish(struct fcb *fcb, struct fcb_entry *loc)
 	if (rc) {
 		return -EIO;
 	}
+	k_mutex_lock(&fcb->f_mtx, K_FOREVER);
+	fcb_index_add(fcb, loc->fe_sector);
+	k_mutex_unlock(&fcb->f_mtx);
 	return 0;
 }
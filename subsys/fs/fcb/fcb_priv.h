@@ -73,6 +73,38 @@ int fcb_elem_info(struct fcb *fcb, struct fcb_entry *loc);
 int fcb_elem_endmarker(struct fcb *fcb, struct fcb_entry *loc, uint8_t *crc8p);
 
 int fcb_sector_hdr_init(struct fcb *fcb, struct flash_sector *sector, uint16_t id);
+
+/* Per sector entry index, kept in RAM when fcb->f_entry_cnt is given */
+static inline uint16_t *fcb_index_cnt(struct fcb *fcb,
+				      const struct flash_sector *sector)
+{
+#ifdef CONFIG_FCB_ENTRY_INDEX
+	if (fcb->f_entry_cnt != NULL) {
+		return &fcb->f_entry_cnt[sector - fcb->f_sectors];
+	}
+#endif
+	return NULL;
+}
+
+static inline void fcb_index_reset(struct fcb *fcb,
+				   const struct flash_sector *sector)
+{
+	uint16_t *cnt = fcb_index_cnt(fcb, sector);
+
+	if (cnt != NULL) {
+		*cnt = 0U;
+	}
+}
+
+static inline void fcb_index_add(struct fcb *fcb,
+				 const struct flash_sector *sector)
+{
+	uint16_t *cnt = fcb_index_cnt(fcb, sector);
+
+	if (cnt != NULL) {
+		(*cnt)++;
+	}
+}
 int fcb_sector_hdr_read(struct fcb *fcb, struct flash_sector *sector,
 			struct fcb_disk_area *fdap);
 
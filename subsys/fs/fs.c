@@ -16,6 +16,7 @@
 #include <zephyr/fs/fs_sys.h>
 #include <zephyr/sys/check.h>
 
+#include "fs_impl.h"
 
 #define LOG_LEVEL CONFIG_FS_LOG_LEVEL
 #include <zephyr/logging/log.h>
@@ -161,7 +162,25 @@ int fs_open(struct fs_file_t *zfp, const char *file_name, fs_mode_t flags)
 	}
 
 	zfp->mp = mp;
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	if (mp->cache != NULL) {
+		/* Pages are loaded and written back at their own offset, the
+		 * cache takes care of the append mode.
+		 */
+		rc = mp->fs->open(zfp, file_name,
+				  (flags | FS_O_READ) & ~FS_O_APPEND);
+		if (rc == 0) {
+			rc = fs_cache_open(zfp);
+			if (rc < 0) {
+				mp->fs->close(zfp);
+			}
+		}
+	} else {
+		rc = mp->fs->open(zfp, file_name, flags);
+	}
+#else
 	rc = mp->fs->open(zfp, file_name, flags);
+#endif
 	if (rc < 0) {
 		LOG_ERR("file open error (%d)", rc);
 		zfp->mp = NULL;
@@ -186,6 +205,16 @@ int fs_close(struct fs_file_t *zfp)
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	if (zfp->mp->cache != NULL) {
+		rc = fs_cache_close(zfp);
+		if (rc < 0) {
+			LOG_ERR("file cache flush error (%d)", rc);
+			return rc;
+		}
+	}
+#endif
+
 	rc = zfp->mp->fs->close(zfp);
 	if (rc < 0) {
 		LOG_ERR("file close error (%d)", rc);
@@ -209,7 +238,15 @@ ssize_t fs_read(struct fs_file_t *zfp, void *ptr, size_t size)
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	if (zfp->mp->cache != NULL) {
+		rc = fs_cache_read(zfp, ptr, size);
+	} else {
+		rc = zfp->mp->fs->read(zfp, ptr, size);
+	}
+#else
 	rc = zfp->mp->fs->read(zfp, ptr, size);
+#endif
 	if (rc < 0) {
 		LOG_ERR("file read error (%d)", rc);
 	}
@@ -229,7 +266,15 @@ ssize_t fs_write(struct fs_file_t *zfp, const void *ptr, size_t size)
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	if (zfp->mp->cache != NULL) {
+		rc = fs_cache_write(zfp, ptr, size);
+	} else {
+		rc = zfp->mp->fs->write(zfp, ptr, size);
+	}
+#else
 	rc = zfp->mp->fs->write(zfp, ptr, size);
+#endif
 	if (rc < 0) {
 		LOG_ERR("file write error (%d)", rc);
 	}
@@ -249,7 +294,15 @@ int fs_seek(struct fs_file_t *zfp, off_t offset, int whence)
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	if (zfp->mp->cache != NULL) {
+		rc = fs_cache_seek(zfp, offset, whence);
+	} else {
+		rc = zfp->mp->fs->lseek(zfp, offset, whence);
+	}
+#else
 	rc = zfp->mp->fs->lseek(zfp, offset, whence);
+#endif
 	if (rc < 0) {
 		LOG_ERR("file seek error (%d)", rc);
 	}
@@ -269,7 +322,15 @@ off_t fs_tell(struct fs_file_t *zfp)
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	if (zfp->mp->cache != NULL) {
+		rc = fs_cache_tell(zfp);
+	} else {
+		rc = zfp->mp->fs->tell(zfp);
+	}
+#else
 	rc = zfp->mp->fs->tell(zfp);
+#endif
 	if (rc < 0) {
 		LOG_ERR("file tell error (%d)", rc);
 	}
@@ -289,7 +350,15 @@ int fs_truncate(struct fs_file_t *zfp, off_t length)
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	if (zfp->mp->cache != NULL) {
+		rc = fs_cache_truncate(zfp, length);
+	} else {
+		rc = zfp->mp->fs->truncate(zfp, length);
+	}
+#else
 	rc = zfp->mp->fs->truncate(zfp, length);
+#endif
 	if (rc < 0) {
 		LOG_ERR("file truncate error (%d)", rc);
 	}
@@ -309,6 +378,16 @@ int fs_sync(struct fs_file_t *zfp)
 		return -ENOTSUP;
 	}
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	if (zfp->mp->cache != NULL) {
+		rc = fs_cache_flush(zfp);
+		if (rc < 0) {
+			LOG_ERR("file cache flush error (%d)", rc);
+			return rc;
+		}
+	}
+#endif
+
 	rc = zfp->mp->fs->sync(zfp);
 	if (rc < 0) {
 		LOG_ERR("file sync error (%d)", rc);
@@ -317,6 +396,26 @@ int fs_sync(struct fs_file_t *zfp)
 	return rc;
 }
 
+int fs_mmap(struct fs_file_t *zfp, const void **addr, size_t *size)
+{
+	int rc;
+
+	if (zfp->mp == NULL) {
+		return -EBADF;
+	}
+
+	if (zfp->mp->fs->mmap == NULL) {
+		return -ENOTSUP;
+	}
+
+	rc = zfp->mp->fs->mmap(zfp, addr, size);
+	if (rc < 0) {
+		LOG_ERR("file mmap error (%d)", rc);
+	}
+
+	return rc;
+}
+
 /* Directory operations */
 int fs_opendir(struct fs_dir_t *zdp, const char *abs_path)
 {
@@ -639,6 +738,31 @@ int fs_statvfs(const char *abs_path, struct fs_statvfs *stat)
 	return rc;
 }
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+int fs_cache_stats_get(const char *path, struct fs_cache_stats *stats)
+{
+	struct fs_mount_t *mp;
+	int rc;
+
+	if ((path == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	rc = fs_get_mnt_point(&mp, path, NULL);
+	if (rc < 0) {
+		return rc;
+	}
+
+	if (mp->cache == NULL) {
+		return -ENOTSUP;
+	}
+
+	fs_cache_stats_read(mp->cache, stats);
+
+	return 0;
+}
+#endif /* CONFIG_FILE_SYSTEM_CACHE */
+
 int fs_mount(struct fs_mount_t *mp)
 {
 	struct fs_mount_t *itr;
@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Page cache of the files of a mount point.
+ *
+ * Pages are CONFIG_FILE_SYSTEM_CACHE_PAGE_SIZE aligned blocks of an open
+ * file, identified by its fs_file_t. The file position and size are kept
+ * in the fs_file_t, and the file system driver is only used to load pages,
+ * write back dirty pages and get the size of the file at open.
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/sys/util.h>
+
+#include "fs_impl.h"
+
+#define PAGE_SIZE CONFIG_FILE_SYSTEM_CACHE_PAGE_SIZE
+
+static inline uint8_t *page_data(struct fs_cache *cache,
+				 struct fs_cache_page *page)
+{
+	return &cache->data[(page - cache->pages) * PAGE_SIZE];
+}
+
+static int page_write_back(struct fs_cache *cache, struct fs_cache_page *page)
+{
+	struct fs_file_t *zfp = page->zfp;
+	off_t off = (off_t)page->index * PAGE_SIZE;
+	size_t len;
+	ssize_t rc;
+
+	if (zfp->cache_size > off) {
+		len = MIN(PAGE_SIZE, zfp->cache_size - off);
+
+		rc = zfp->mp->fs->lseek(zfp, off, FS_SEEK_SET);
+		if (rc < 0) {
+			return rc;
+		}
+
+		rc = zfp->mp->fs->write(zfp, page_data(cache, page), len);
+		if (rc < 0) {
+			return rc;
+		}
+
+		if ((size_t)rc != len) {
+			return -ENOSPC;
+		}
+
+		cache->stats.writebacks++;
+	}
+
+	page->dirty = false;
+
+	return 0;
+}
+
+static int page_load(struct fs_cache *cache, struct fs_cache_page *page)
+{
+	struct fs_file_t *zfp = page->zfp;
+	uint8_t *data = page_data(cache, page);
+	ssize_t rc;
+
+	rc = zfp->mp->fs->lseek(zfp, (off_t)page->index * PAGE_SIZE,
+				FS_SEEK_SET);
+	if (rc < 0) {
+		return rc;
+	}
+
+	rc = zfp->mp->fs->read(zfp, data, PAGE_SIZE);
+	if (rc < 0) {
+		return rc;
+	}
+
+	memset(data + rc, 0, PAGE_SIZE - rc);
+
+	return 0;
+}
+
+/* Get the page of zfp with the given index, the least recently used page is
+ * reused on a miss. The content is loaded from the file system if 'load' is
+ * set, zeroed otherwise.
+ */
+static int page_get(struct fs_cache *cache, struct fs_file_t *zfp,
+		    uint32_t index, bool load, struct fs_cache_page **pagep)
+{
+	struct fs_cache_page *page, *victim = NULL;
+	int rc;
+
+	for (size_t i = 0; i < cache->page_count; i++) {
+		page = &cache->pages[i];
+
+		if ((page->zfp == zfp) && (page->index == index)) {
+			cache->stats.hits++;
+			page->lru = ++cache->clock;
+			*pagep = page;
+			return 0;
+		}
+
+		if ((victim == NULL) || (victim->zfp != NULL &&
+		    ((page->zfp == NULL) || (page->lru < victim->lru)))) {
+			victim = page;
+		}
+	}
+
+	cache->stats.misses++;
+
+	if (victim->dirty) {
+		rc = page_write_back(cache, victim);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+
+	victim->zfp = zfp;
+	victim->index = index;
+	victim->lru = ++cache->clock;
+
+	if (load) {
+		rc = page_load(cache, victim);
+		if (rc < 0) {
+			victim->zfp = NULL;
+			return rc;
+		}
+	} else {
+		memset(page_data(cache, victim), 0, PAGE_SIZE);
+	}
+
+	*pagep = victim;
+
+	return 0;
+}
+
+/* Write back the dirty pages of zfp, in file order */
+static int file_write_back(struct fs_cache *cache, struct fs_file_t *zfp)
+{
+	struct fs_cache_page *page, *next;
+	int rc;
+
+	while (true) {
+		next = NULL;
+
+		for (size_t i = 0; i < cache->page_count; i++) {
+			page = &cache->pages[i];
+
+			if ((page->zfp == zfp) && page->dirty &&
+			    ((next == NULL) || (page->index < next->index))) {
+				next = page;
+			}
+		}
+
+		if (next == NULL) {
+			return 0;
+		}
+
+		rc = page_write_back(cache, next);
+		if (rc < 0) {
+			return rc;
+		}
+	}
+}
+
+static void file_release(struct fs_cache *cache, struct fs_file_t *zfp)
+{
+	for (size_t i = 0; i < cache->page_count; i++) {
+		if (cache->pages[i].zfp == zfp) {
+			cache->pages[i].zfp = NULL;
+			cache->pages[i].dirty = false;
+		}
+	}
+}
+
+int fs_cache_open(struct fs_file_t *zfp)
+{
+	const struct fs_file_system_t *fs = zfp->mp->fs;
+	off_t size;
+	int rc;
+
+	if ((fs->lseek == NULL) || (fs->tell == NULL) || (fs->read == NULL)) {
+		return -ENOTSUP;
+	}
+
+	rc = fs->lseek(zfp, 0, FS_SEEK_END);
+	if (rc < 0) {
+		return rc;
+	}
+
+	size = fs->tell(zfp);
+	if (size < 0) {
+		return size;
+	}
+
+	zfp->cache_pos = 0;
+	zfp->cache_size = size;
+
+	return 0;
+}
+
+ssize_t fs_cache_read(struct fs_file_t *zfp, void *ptr, size_t size)
+{
+	struct fs_cache *cache = zfp->mp->cache;
+	struct fs_cache_page *page;
+	uint8_t *dst = ptr;
+	size_t done = 0;
+	size_t off, len;
+	int rc = 0;
+
+	if ((zfp->flags & FS_O_READ) == 0) {
+		return -EBADF;
+	}
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	if (zfp->cache_pos >= zfp->cache_size) {
+		size = 0;
+	} else {
+		size = MIN(size, zfp->cache_size - zfp->cache_pos);
+	}
+
+	while (done < size) {
+		off = zfp->cache_pos % PAGE_SIZE;
+		len = MIN(PAGE_SIZE - off, size - done);
+
+		rc = page_get(cache, zfp, zfp->cache_pos / PAGE_SIZE, true, &page);
+		if (rc < 0) {
+			break;
+		}
+
+		memcpy(dst + done, page_data(cache, page) + off, len);
+		zfp->cache_pos += len;
+		done += len;
+	}
+
+	k_mutex_unlock(&cache->lock);
+
+	return (done == 0 && rc < 0) ? rc : done;
+}
+
+ssize_t fs_cache_write(struct fs_file_t *zfp, const void *ptr, size_t size)
+{
+	struct fs_cache *cache = zfp->mp->cache;
+	struct fs_cache_page *page;
+	const uint8_t *src = ptr;
+	size_t done = 0;
+	size_t off, len;
+	uint32_t index;
+	bool load;
+	int rc = 0;
+
+	if ((zfp->flags & FS_O_WRITE) == 0) {
+		return -EBADF;
+	}
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	if ((zfp->flags & FS_O_APPEND) != 0) {
+		zfp->cache_pos = zfp->cache_size;
+	}
+
+	while (done < size) {
+		index = zfp->cache_pos / PAGE_SIZE;
+		off = zfp->cache_pos % PAGE_SIZE;
+		len = MIN(PAGE_SIZE - off, size - done);
+
+		/* no need to load pages fully overwritten or past the end */
+		load = (len != PAGE_SIZE) &&
+		       ((off_t)index * PAGE_SIZE < zfp->cache_size);
+
+		rc = page_get(cache, zfp, index, load, &page);
+		if (rc < 0) {
+			break;
+		}
+
+		memcpy(page_data(cache, page) + off, src + done, len);
+		page->dirty = true;
+		zfp->cache_pos += len;
+		done += len;
+
+		if (zfp->cache_pos > zfp->cache_size) {
+			zfp->cache_size = zfp->cache_pos;
+		}
+	}
+
+	k_mutex_unlock(&cache->lock);
+
+	return (done == 0 && rc < 0) ? rc : done;
+}
+
+int fs_cache_seek(struct fs_file_t *zfp, off_t offset, int whence)
+{
+	off_t pos;
+
+	switch (whence) {
+	case FS_SEEK_SET:
+		pos = offset;
+		break;
+	case FS_SEEK_CUR:
+		pos = zfp->cache_pos + offset;
+		break;
+	case FS_SEEK_END:
+		pos = zfp->cache_size + offset;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	if (pos < 0) {
+		return -EINVAL;
+	}
+
+	zfp->cache_pos = pos;
+
+	return 0;
+}
+
+off_t fs_cache_tell(struct fs_file_t *zfp)
+{
+	return zfp->cache_pos;
+}
+
+int fs_cache_flush(struct fs_file_t *zfp)
+{
+	struct fs_cache *cache = zfp->mp->cache;
+	int rc;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+	rc = file_write_back(cache, zfp);
+	k_mutex_unlock(&cache->lock);
+
+	return rc;
+}
+
+int fs_cache_truncate(struct fs_file_t *zfp, off_t length)
+{
+	struct fs_cache *cache = zfp->mp->cache;
+	int rc;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	rc = file_write_back(cache, zfp);
+	if (rc == 0) {
+		file_release(cache, zfp);
+
+		rc = zfp->mp->fs->truncate(zfp, length);
+		if (rc == 0) {
+			zfp->cache_size = length;
+		}
+	}
+
+	k_mutex_unlock(&cache->lock);
+
+	return rc;
+}
+
+int fs_cache_close(struct fs_file_t *zfp)
+{
+	struct fs_cache *cache = zfp->mp->cache;
+	int rc;
+
+	k_mutex_lock(&cache->lock, K_FOREVER);
+
+	rc = file_write_back(cache, zfp);
+	if (rc == 0) {
+		file_release(cache, zfp);
+	}
+
+	k_mutex_unlock(&cache->lock);
+
+	return rc;
+}
+
+void fs_cache_stats_read(struct fs_cache *cache, struct fs_cache_stats *stats)
+{
+	k_mutex_lock(&cache->lock, K_FOREVER);
+	*stats = cache->stats;
+	k_mutex_unlock(&cache->lock);
+}
@@ -28,6 +28,18 @@ extern "C" {
 const char *fs_impl_strip_prefix(const char *path,
 				 const struct fs_mount_t *mp);
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+/* Page cache operations, used by the VFS on mount points with a cache. */
+int fs_cache_open(struct fs_file_t *zfp);
+int fs_cache_close(struct fs_file_t *zfp);
+ssize_t fs_cache_read(struct fs_file_t *zfp, void *ptr, size_t size);
+ssize_t fs_cache_write(struct fs_file_t *zfp, const void *ptr, size_t size);
+int fs_cache_seek(struct fs_file_t *zfp, off_t offset, int whence);
+off_t fs_cache_tell(struct fs_file_t *zfp);
+int fs_cache_truncate(struct fs_file_t *zfp, off_t length);
+int fs_cache_flush(struct fs_file_t *zfp);
+void fs_cache_stats_read(struct fs_cache *cache, struct fs_cache_stats *stats);
+#endif
 
 #ifdef __cplusplus
 }
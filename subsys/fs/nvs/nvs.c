@@ -36,14 +36,105 @@ static inline size_t nvs_lookup_cache_pos(uint16_t id)
 	return hash % CONFIG_NVS_LOOKUP_CACHE_SIZE;
 }
 
+#ifdef CONFIG_NVS_LOOKUP_CACHE_INDEX
+
+/* Find the cache entry owned by id, probing linearly from its hash position.
+ * An unowned entry is claimed for id if 'claim' is set. Entries are never
+ * released until the cache is rebuilt, an entry of a deleted id keeps
+ * NVS_LOOKUP_CACHE_NO_ADDR so that the probing of other ids is not broken.
+ */
+static uint32_t *nvs_lookup_cache_entry(struct nvs_fs *fs, uint16_t id, bool claim)
+{
+	size_t pos = nvs_lookup_cache_pos(id);
+
+	for (size_t i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
+		if (fs->lookup_cache_ids[pos] == id) {
+			return &fs->lookup_cache[pos];
+		}
+
+		if (fs->lookup_cache_ids[pos] == NVS_LOOKUP_CACHE_NO_ID) {
+			if (!claim) {
+				return NULL;
+			}
+
+			fs->lookup_cache_ids[pos] = id;
+			return &fs->lookup_cache[pos];
+		}
+
+		pos = (pos + 1) % CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	}
+
+	return NULL;
+}
+
+/* Address to start the search for the most recent ate of id from */
+static uint32_t nvs_lookup_cache_get(struct nvs_fs *fs, uint16_t id)
+{
+	uint32_t *cache_entry = nvs_lookup_cache_entry(fs, id, false);
+
+	if (cache_entry != NULL) {
+		return *cache_entry;
+	}
+
+	return fs->lookup_cache_full ? fs->ate_wra : NVS_LOOKUP_CACHE_NO_ADDR;
+}
+
+static bool nvs_lookup_cache_has(struct nvs_fs *fs, uint16_t id)
+{
+	return nvs_lookup_cache_entry(fs, id, false) != NULL;
+}
+
+static void nvs_lookup_cache_set(struct nvs_fs *fs, uint16_t id, uint32_t addr)
+{
+	uint32_t *cache_entry = nvs_lookup_cache_entry(fs, id, true);
+
+	if (cache_entry == NULL) {
+		fs->lookup_cache_full = true;
+		return;
+	}
+
+	*cache_entry = addr;
+}
+
+static void nvs_lookup_cache_clear(struct nvs_fs *fs)
+{
+	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+	memset(fs->lookup_cache_ids, 0xff, sizeof(fs->lookup_cache_ids));
+	fs->lookup_cache_full = false;
+}
+
+#else
+
+/* Address to start the search for the most recent ate of id from */
+static uint32_t nvs_lookup_cache_get(struct nvs_fs *fs, uint16_t id)
+{
+	return fs->lookup_cache[nvs_lookup_cache_pos(id)];
+}
+
+static bool nvs_lookup_cache_has(struct nvs_fs *fs, uint16_t id)
+{
+	return nvs_lookup_cache_get(fs, id) != NVS_LOOKUP_CACHE_NO_ADDR;
+}
+
+static void nvs_lookup_cache_set(struct nvs_fs *fs, uint16_t id, uint32_t addr)
+{
+	fs->lookup_cache[nvs_lookup_cache_pos(id)] = addr;
+}
+
+static void nvs_lookup_cache_clear(struct nvs_fs *fs)
+{
+	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+}
+
+#endif /* CONFIG_NVS_LOOKUP_CACHE_INDEX */
+
 static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 {
 	int rc;
 	uint32_t addr, ate_addr;
-	uint32_t *cache_entry;
 	struct nvs_ate ate;
 
-	memset(fs->lookup_cache, 0xff, sizeof(fs->lookup_cache));
+	nvs_lookup_cache_clear(fs);
 	addr = fs->ate_wra;
 
 	while (true) {
@@ -55,11 +146,9 @@ static int nvs_lookup_cache_rebuild(struct nvs_fs *fs)
 			return rc;
 		}
 
-		cache_entry = &fs->lookup_cache[nvs_lookup_cache_pos(ate.id)];
-
-		if (ate.id != 0xFFFF && *cache_entry == NVS_LOOKUP_CACHE_NO_ADDR &&
+		if (ate.id != 0xFFFF && !nvs_lookup_cache_has(fs, ate.id) &&
 		    nvs_ate_valid(fs, &ate)) {
-			*cache_entry = ate_addr;
+			nvs_lookup_cache_set(fs, ate.id, ate_addr);
 		}
 
 		if (addr == fs->ate_wra) {
@@ -166,7 +255,7 @@ static int nvs_flash_ate_wrt(struct nvs_fs *fs, const struct nvs_ate *entry)
 #ifdef CONFIG_NVS_LOOKUP_CACHE
 	/* 0xFFFF is a special-purpose identifier. Exclude it from the cache */
 	if (entry->id != 0xFFFF) {
-		fs->lookup_cache[nvs_lookup_cache_pos(entry->id)] = fs->ate_wra;
+		nvs_lookup_cache_set(fs, entry->id, fs->ate_wra);
 	}
 #endif
 	fs->ate_wra -= nvs_al_size(fs, sizeof(struct nvs_ate));
@@ -573,6 +662,92 @@ static int nvs_add_gc_done_ate(struct nvs_fs *fs)
 	return nvs_flash_ate_wrt(fs, &gc_done_ate);
 }
 
+#ifdef CONFIG_NVS_GC_STATS
+static void nvs_gc_stats_cycles(struct nvs_fs *fs, uint32_t start)
+{
+	uint32_t cycles = k_cycle_get_32() - start;
+
+	if (cycles > fs->gc_stats.max_cycles) {
+		fs->gc_stats.max_cycles = cycles;
+	}
+}
+#endif
+
+/* check if the entry with ate gc_ate located at gc_ate_addr has to be moved by
+ * gc: it should be the most recent valid ate with its id and not a delete ate.
+ * returns 1 if a move is needed, 0 if not and a negative value on error.
+ */
+static int nvs_gc_ate_needs_move(struct nvs_fs *fs, uint32_t gc_ate_addr,
+				 const struct nvs_ate *gc_ate)
+{
+	int rc;
+	struct nvs_ate wlk_ate;
+	uint32_t wlk_addr, wlk_prev_addr;
+
+#ifdef CONFIG_NVS_LOOKUP_CACHE
+	wlk_addr = nvs_lookup_cache_get(fs, gc_ate->id);
+
+	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
+		wlk_addr = fs->ate_wra;
+	}
+#else
+	wlk_addr = fs->ate_wra;
+#endif
+	do {
+		wlk_prev_addr = wlk_addr;
+		rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
+		if (rc) {
+			return rc;
+		}
+		/* if ate with same id is reached we might need to copy.
+		 * only consider valid wlk_ate's. Something wrong might
+		 * have been written that has the same ate but is
+		 * invalid, don't consider these as a match.
+		 */
+		if ((wlk_ate.id == gc_ate->id) &&
+		    (nvs_ate_valid(fs, &wlk_ate))) {
+			break;
+		}
+	} while (wlk_addr != fs->ate_wra);
+
+	/* if walk has reached the same address as gc_ate_addr copy is
+	 * needed unless it is a deleted item.
+	 */
+	return (wlk_prev_addr == gc_ate_addr) && gc_ate->len;
+}
+
+/* move the entry with ate gc_ate located at gc_ate_addr to the write sector */
+static int nvs_gc_ate_move(struct nvs_fs *fs, uint32_t gc_ate_addr,
+			   struct nvs_ate *gc_ate)
+{
+	int rc;
+	uint32_t data_addr;
+
+	LOG_DBG("Moving %d, len %d", gc_ate->id, gc_ate->len);
+
+	data_addr = (gc_ate_addr & ADDR_SECT_MASK);
+	data_addr += gc_ate->offset;
+
+	gc_ate->offset = (uint16_t)(fs->data_wra & ADDR_OFFS_MASK);
+	nvs_ate_crc8_update(gc_ate);
+
+	rc = nvs_flash_block_move(fs, data_addr, gc_ate->len);
+	if (rc) {
+		return rc;
+	}
+
+	rc = nvs_flash_ate_wrt(fs, gc_ate);
+	if (rc) {
+		return rc;
+	}
+
+#ifdef CONFIG_NVS_GC_STATS
+	fs->gc_stats.moved_entries++;
+	fs->gc_stats.moved_bytes += gc_ate->len;
+#endif
+	return 0;
+}
+
 /* garbage collection: the address ate_wra has been updated to the new sector
  * that has just been started. The data to gc is in the sector after this new
  * sector.
@@ -580,10 +755,12 @@ static int nvs_add_gc_done_ate(struct nvs_fs *fs)
 static int nvs_gc(struct nvs_fs *fs)
 {
 	int rc;
-	struct nvs_ate close_ate, gc_ate, wlk_ate;
-	uint32_t sec_addr, gc_addr, gc_prev_addr, wlk_addr, wlk_prev_addr,
-	      data_addr, stop_addr;
+	struct nvs_ate close_ate, gc_ate;
+	uint32_t sec_addr, gc_addr, gc_prev_addr, stop_addr;
 	size_t ate_size;
+#ifdef CONFIG_NVS_GC_STATS
+	uint32_t start = k_cycle_get_32();
+#endif
 
 	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
 
@@ -626,51 +803,14 @@ static int nvs_gc(struct nvs_fs *fs)
 			continue;
 		}
 
-#ifdef CONFIG_NVS_LOOKUP_CACHE
-		wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(gc_ate.id)];
-
-		if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
-			wlk_addr = fs->ate_wra;
+		rc = nvs_gc_ate_needs_move(fs, gc_prev_addr, &gc_ate);
+		if (rc < 0) {
+			return rc;
 		}
-#else
-		wlk_addr = fs->ate_wra;
-#endif
-		do {
-			wlk_prev_addr = wlk_addr;
-			rc = nvs_prev_ate(fs, &wlk_addr, &wlk_ate);
-			if (rc) {
-				return rc;
-			}
-			/* if ate with same id is reached we might need to copy.
-			 * only consider valid wlk_ate's. Something wrong might
-			 * have been written that has the same ate but is
-			 * invalid, don't consider these as a match.
-			 */
-			if ((wlk_ate.id == gc_ate.id) &&
-			    (nvs_ate_valid(fs, &wlk_ate))) {
-				break;
-			}
-		} while (wlk_addr != fs->ate_wra);
 
-		/* if walk has reached the same address as gc_addr copy is
-		 * needed unless it is a deleted item.
-		 */
-		if ((wlk_prev_addr == gc_prev_addr) && gc_ate.len) {
+		if (rc) {
 			/* copy needed */
-			LOG_DBG("Moving %d, len %d", gc_ate.id, gc_ate.len);
-
-			data_addr = (gc_prev_addr & ADDR_SECT_MASK);
-			data_addr += gc_ate.offset;
-
-			gc_ate.offset = (uint16_t)(fs->data_wra & ADDR_OFFS_MASK);
-			nvs_ate_crc8_update(&gc_ate);
-
-			rc = nvs_flash_block_move(fs, data_addr, gc_ate.len);
-			if (rc) {
-				return rc;
-			}
-
-			rc = nvs_flash_ate_wrt(fs, &gc_ate);
+			rc = nvs_gc_ate_move(fs, gc_prev_addr, &gc_ate);
 			if (rc) {
 				return rc;
 			}
@@ -697,6 +837,11 @@ gc_done:
 	if (rc) {
 		return rc;
 	}
+
+#ifdef CONFIG_NVS_GC_STATS
+	fs->gc_stats.gc_count++;
+	nvs_gc_stats_cycles(fs, start);
+#endif
 	return 0;
 }
 
@@ -865,9 +1010,14 @@ static int nvs_startup(struct nvs_fs *fs)
 		 * So, temporarily, we set the lookup cache to the end of the fs.
 		 * The cache will be rebuilt afterwards
 		 **/
+#ifdef CONFIG_NVS_LOOKUP_CACHE_INDEX
+		nvs_lookup_cache_clear(fs);
+		fs->lookup_cache_full = true;
+#else
 		for (i = 0; i < CONFIG_NVS_LOOKUP_CACHE_SIZE; i++) {
 			fs->lookup_cache[i] = fs->ate_wra;
 		}
+#endif
 #endif
 		rc = nvs_gc(fs);
 		goto end;
@@ -985,6 +1135,13 @@ int nvs_mount(struct nvs_fs *fs)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+	fs->gc_step_addr = NVS_GC_STEP_NO_ADDR;
+#endif
+#ifdef CONFIG_NVS_GC_STATS
+	memset(&fs->gc_stats, 0, sizeof(fs->gc_stats));
+#endif
+
 	rc = nvs_startup(fs);
 	if (rc) {
 		return rc;
@@ -1032,7 +1189,7 @@ ssize_t nvs_write(struct nvs_fs *fs, uint16_t id, const void *data, size_t len)
 
 	/* find latest entry with same id */
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	wlk_addr = nvs_lookup_cache_get(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		goto no_cached_entry;
@@ -1162,7 +1319,7 @@ ssize_t nvs_read_hist(struct nvs_fs *fs, uint16_t id, void *data, size_t len,
 	cnt_his = 0U;
 
 #ifdef CONFIG_NVS_LOOKUP_CACHE
-	wlk_addr = fs->lookup_cache[nvs_lookup_cache_pos(id)];
+	wlk_addr = nvs_lookup_cache_get(fs, id);
 
 	if (wlk_addr == NVS_LOOKUP_CACHE_NO_ADDR) {
 		rc = -ENOENT;
@@ -1267,3 +1424,151 @@ ssize_t nvs_calc_free_space(struct nvs_fs *fs)
 	}
 	return free_space;
 }
+
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+int nvs_gc_step(struct nvs_fs *fs, size_t max_entries)
+{
+	int rc;
+	struct nvs_ate close_ate, gc_ate;
+	uint32_t sec_addr, gc_addr, stop_addr;
+	size_t ate_size, free_space, cnt;
+#ifdef CONFIG_NVS_GC_STATS
+	uint32_t start;
+#endif
+
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	/* with two sectors the oldest sector is the write sector itself */
+	if (fs->sector_count < 3) {
+		return -ENOTSUP;
+	}
+
+	ate_size = nvs_al_size(fs, sizeof(struct nvs_ate));
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+#ifdef CONFIG_NVS_GC_STATS
+	start = k_cycle_get_32();
+#endif
+
+	free_space = fs->ate_wra - fs->data_wra;
+	if ((free_space * 100U) >
+	    ((size_t)fs->sector_size * CONFIG_NVS_GC_INCREMENTAL_THRESHOLD)) {
+		rc = 0;
+		goto end;
+	}
+
+	/* the oldest sector is the one after the empty sector that follows
+	 * the write sector, it is the next one to be gc'ed.
+	 */
+	sec_addr = (fs->ate_wra & ADDR_SECT_MASK);
+	nvs_sector_advance(fs, &sec_addr);
+	nvs_sector_advance(fs, &sec_addr);
+	gc_addr = sec_addr + fs->sector_size - ate_size;
+	stop_addr = gc_addr - ate_size;
+
+	if ((fs->gc_step_addr & ADDR_SECT_MASK) != sec_addr) {
+		/* start at the last ate of the oldest sector, if the sector is
+		 * not closed there is nothing to move.
+		 */
+		rc = nvs_flash_ate_rd(fs, gc_addr, &close_ate);
+		if (rc < 0) {
+			goto end;
+		}
+
+		rc = nvs_ate_cmp_const(&close_ate, fs->flash_parameters->erase_value);
+		if (!rc) {
+			fs->gc_step_addr = gc_addr;
+		} else if (nvs_close_ate_valid(fs, &close_ate)) {
+			fs->gc_step_addr = sec_addr + close_ate.offset;
+		} else {
+			rc = nvs_recover_last_ate(fs, &gc_addr);
+			if (rc) {
+				goto end;
+			}
+			fs->gc_step_addr = gc_addr;
+		}
+	}
+
+	/* Move the entries that are still in use ahead of the gc, each of
+	 * them is a regular write of an id that supersedes the old entry,
+	 * so an interrupted step leaves a consistent file system.
+	 */
+	for (cnt = 0; fs->gc_step_addr <= stop_addr; cnt++) {
+		if (cnt == max_entries) {
+			rc = 1;
+			goto end;
+		}
+
+		rc = nvs_flash_ate_rd(fs, fs->gc_step_addr, &gc_ate);
+		if (rc) {
+			goto end;
+		}
+
+		if (nvs_ate_valid(fs, &gc_ate)) {
+			rc = nvs_gc_ate_needs_move(fs, fs->gc_step_addr, &gc_ate);
+			if (rc < 0) {
+				goto end;
+			}
+
+			if (rc && (fs->ate_wra < (fs->data_wra + ate_size +
+					 nvs_al_size(fs, gc_ate.len)))) {
+				/* the write sector is full, let the gc move
+				 * the remaining entries.
+				 */
+				break;
+			}
+
+			if (rc) {
+				rc = nvs_gc_ate_move(fs, fs->gc_step_addr, &gc_ate);
+				if (rc) {
+					goto end;
+				}
+			}
+		}
+
+		fs->gc_step_addr += ate_size;
+	}
+
+	/* All entries in use are moved: switch to the next sector, the gc of
+	 * the oldest sector has nothing left to do but erasing it.
+	 */
+	rc = nvs_sector_close(fs);
+	if (rc) {
+		goto end;
+	}
+
+	rc = nvs_gc(fs);
+	if (rc) {
+		goto end;
+	}
+
+	rc = 1;
+end:
+#ifdef CONFIG_NVS_GC_STATS
+	if (rc > 0) {
+		nvs_gc_stats_cycles(fs, start);
+	}
+#endif
+	k_mutex_unlock(&fs->nvs_lock);
+	return rc;
+}
+#endif /* CONFIG_NVS_GC_INCREMENTAL */
+
+#ifdef CONFIG_NVS_GC_STATS
+int nvs_gc_stats_get(struct nvs_fs *fs, struct nvs_gc_stats *stats)
+{
+	if (!fs->ready) {
+		LOG_ERR("NVS not initialized");
+		return -EACCES;
+	}
+
+	k_mutex_lock(&fs->nvs_lock, K_FOREVER);
+	*stats = fs->gc_stats;
+	k_mutex_unlock(&fs->nvs_lock);
+
+	return 0;
+}
+#endif /* CONFIG_NVS_GC_STATS */
@@ -29,6 +29,9 @@ extern "C" {
 #define NVS_BLOCK_SIZE 32
 
 #define NVS_LOOKUP_CACHE_NO_ADDR 0xFFFFFFFF
+#define NVS_LOOKUP_CACHE_NO_ID 0xFFFF
+
+#define NVS_GC_STEP_NO_ADDR 0xFFFFFFFF
 
 /* Allocation Table Entry */
 struct nvs_ate {
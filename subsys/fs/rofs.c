@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/fs_sys.h>
+#include <zephyr/fs/rofs.h>
+#include <zephyr/sys/byteorder.h>
+
+#include "fs_impl.h"
+
+#define LOG_LEVEL CONFIG_FS_LOG_LEVEL
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(rofs);
+
+struct rofs_file {
+	const struct rofs_entry *entry;
+	off_t pos;
+};
+
+struct rofs_dir {
+	/* Index of the directory, ROFS_ROOT for the root */
+	uint16_t index;
+	/* Index of the next entry to check */
+	uint16_t next;
+};
+
+K_MEM_SLAB_DEFINE_STATIC(rofs_file_pool, sizeof(struct rofs_file),
+			 CONFIG_FS_ROFS_NUM_FILES, 4);
+K_MEM_SLAB_DEFINE_STATIC(rofs_dir_pool, sizeof(struct rofs_dir),
+			 CONFIG_FS_ROFS_NUM_DIRS, 4);
+
+static inline const struct rofs_header *rofs_header(const struct fs_mount_t *mp)
+{
+	return mp->fs_data;
+}
+
+static inline const struct rofs_entry *rofs_entry(const struct rofs_header *hdr,
+						  uint16_t index)
+{
+	return &((const struct rofs_entry *)(hdr + 1))[index];
+}
+
+static inline const char *rofs_entry_name(const struct rofs_header *hdr,
+					  const struct rofs_entry *entry)
+{
+	return (const char *)hdr + sys_le32_to_cpu(entry->name_offset);
+}
+
+static inline const uint8_t *rofs_entry_data(const struct rofs_header *hdr,
+					     const struct rofs_entry *entry)
+{
+	return (const uint8_t *)hdr + sys_le32_to_cpu(entry->data_offset);
+}
+
+/* Find the index of the entry of a path within the mount point, entries are
+ * sorted by path. Returns ROFS_ROOT for the root directory.
+ */
+static int rofs_lookup(const struct rofs_header *hdr, const char *path)
+{
+	int lo = 0;
+	int hi = sys_le16_to_cpu(hdr->entry_count) - 1;
+	size_t len;
+	int mid;
+	int cmp;
+
+	while (*path == '/') {
+		path++;
+	}
+
+	len = strlen(path);
+	while ((len > 0) && (path[len - 1] == '/')) {
+		len--;
+	}
+
+	if (len == 0) {
+		return ROFS_ROOT;
+	}
+
+	while (lo <= hi) {
+		mid = (lo + hi) / 2;
+		const char *name = rofs_entry_name(hdr, rofs_entry(hdr, mid));
+
+		cmp = strncmp(name, path, len);
+		if ((cmp == 0) && (name[len] != '\0')) {
+			cmp = 1;
+		}
+
+		if (cmp == 0) {
+			return mid;
+		} else if (cmp < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid - 1;
+		}
+	}
+
+	return -ENOENT;
+}
+
+static void rofs_entry_to_dirent(const struct rofs_header *hdr,
+				 const struct rofs_entry *entry,
+				 struct fs_dirent *dirent)
+{
+	const char *name = rofs_entry_name(hdr, entry);
+	const char *base = strrchr(name, '/');
+
+	dirent->type = sys_le16_to_cpu(entry->type);
+	dirent->size = sys_le32_to_cpu(entry->size);
+	strncpy(dirent->name, (base != NULL) ? base + 1 : name,
+		sizeof(dirent->name));
+	dirent->name[sizeof(dirent->name) - 1] = '\0';
+}
+
+static int rofs_open(struct fs_file_t *fp, const char *path, fs_mode_t flags)
+{
+	const struct rofs_header *hdr = rofs_header(fp->mp);
+	const struct rofs_entry *entry;
+	struct rofs_file *file;
+	int index;
+
+	if ((flags & (FS_O_WRITE | FS_O_CREATE | FS_O_APPEND)) != 0) {
+		return -EROFS;
+	}
+
+	index = rofs_lookup(hdr, fs_impl_strip_prefix(path, fp->mp));
+	if (index < 0) {
+		return index;
+	}
+
+	if (index == ROFS_ROOT) {
+		return -EISDIR;
+	}
+
+	entry = rofs_entry(hdr, index);
+	if (sys_le16_to_cpu(entry->type) != FS_DIR_ENTRY_FILE) {
+		return -EISDIR;
+	}
+
+	if (k_mem_slab_alloc(&rofs_file_pool, &fp->filep, K_NO_WAIT) != 0) {
+		return -ENOMEM;
+	}
+
+	file = fp->filep;
+	file->entry = entry;
+	file->pos = 0;
+
+	return 0;
+}
+
+static int rofs_close(struct fs_file_t *fp)
+{
+	k_mem_slab_free(&rofs_file_pool, fp->filep);
+	fp->filep = NULL;
+
+	return 0;
+}
+
+static ssize_t rofs_read(struct fs_file_t *fp, void *ptr, size_t len)
+{
+	const struct rofs_header *hdr = rofs_header(fp->mp);
+	struct rofs_file *file = fp->filep;
+	off_t size = sys_le32_to_cpu(file->entry->size);
+
+	if (file->pos >= size) {
+		return 0;
+	}
+
+	len = MIN(len, size - file->pos);
+	memcpy(ptr, rofs_entry_data(hdr, file->entry) + file->pos, len);
+	file->pos += len;
+
+	return len;
+}
+
+static int rofs_lseek(struct fs_file_t *fp, off_t off, int whence)
+{
+	struct rofs_file *file = fp->filep;
+	off_t pos;
+
+	switch (whence) {
+	case FS_SEEK_SET:
+		pos = off;
+		break;
+	case FS_SEEK_CUR:
+		pos = file->pos + off;
+		break;
+	case FS_SEEK_END:
+		pos = sys_le32_to_cpu(file->entry->size) + off;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	if ((pos < 0) || (pos > sys_le32_to_cpu(file->entry->size))) {
+		return -EINVAL;
+	}
+
+	file->pos = pos;
+
+	return 0;
+}
+
+static off_t rofs_tell(struct fs_file_t *fp)
+{
+	struct rofs_file *file = fp->filep;
+
+	return file->pos;
+}
+
+static int rofs_mmap(struct fs_file_t *fp, const void **addr, size_t *size)
+{
+	const struct rofs_header *hdr = rofs_header(fp->mp);
+	struct rofs_file *file = fp->filep;
+
+	*addr = rofs_entry_data(hdr, file->entry);
+	*size = sys_le32_to_cpu(file->entry->size);
+
+	return 0;
+}
+
+static int rofs_opendir(struct fs_dir_t *dp, const char *path)
+{
+	const struct rofs_header *hdr = rofs_header(dp->mp);
+	struct rofs_dir *dir;
+	int index;
+
+	index = rofs_lookup(hdr, fs_impl_strip_prefix(path, dp->mp));
+	if (index < 0) {
+		return index;
+	}
+
+	if ((index != ROFS_ROOT) &&
+	    (sys_le16_to_cpu(rofs_entry(hdr, index)->type) != FS_DIR_ENTRY_DIR)) {
+		return -ENOTDIR;
+	}
+
+	if (k_mem_slab_alloc(&rofs_dir_pool, &dp->dirp, K_NO_WAIT) != 0) {
+		return -ENOMEM;
+	}
+
+	dir = dp->dirp;
+	dir->index = index;
+	/* Children are sorted after their parent directory */
+	dir->next = (index == ROFS_ROOT) ? 0 : index + 1;
+
+	return 0;
+}
+
+static int rofs_readdir(struct fs_dir_t *dp, struct fs_dirent *entry)
+{
+	const struct rofs_header *hdr = rofs_header(dp->mp);
+	uint16_t count = sys_le16_to_cpu(hdr->entry_count);
+	struct rofs_dir *dir = dp->dirp;
+	const struct rofs_entry *child;
+
+	while (dir->next < count) {
+		child = rofs_entry(hdr, dir->next++);
+
+		if (sys_le16_to_cpu(child->parent) == dir->index) {
+			rofs_entry_to_dirent(hdr, child, entry);
+			return 0;
+		}
+	}
+
+	/* End of directory */
+	entry->name[0] = '\0';
+
+	return 0;
+}
+
+static int rofs_closedir(struct fs_dir_t *dp)
+{
+	k_mem_slab_free(&rofs_dir_pool, dp->dirp);
+	dp->dirp = NULL;
+
+	return 0;
+}
+
+static int rofs_stat(struct fs_mount_t *mountp, const char *path,
+		     struct fs_dirent *entry)
+{
+	const struct rofs_header *hdr = rofs_header(mountp);
+	int index;
+
+	index = rofs_lookup(hdr, fs_impl_strip_prefix(path, mountp));
+	if (index < 0) {
+		return index;
+	}
+
+	if (index == ROFS_ROOT) {
+		entry->type = FS_DIR_ENTRY_DIR;
+		entry->size = 0;
+		entry->name[0] = '\0';
+	} else {
+		rofs_entry_to_dirent(hdr, rofs_entry(hdr, index), entry);
+	}
+
+	return 0;
+}
+
+static int rofs_statvfs(struct fs_mount_t *mountp, const char *path,
+			struct fs_statvfs *stat)
+{
+	const struct rofs_header *hdr = rofs_header(mountp);
+
+	ARG_UNUSED(path);
+
+	stat->f_bsize = sys_le32_to_cpu(hdr->align);
+	stat->f_frsize = sys_le32_to_cpu(hdr->align);
+	stat->f_blocks = sys_le32_to_cpu(hdr->image_size) / stat->f_frsize;
+	stat->f_bfree = 0;
+
+	return 0;
+}
+
+static int rofs_mount(struct fs_mount_t *mountp)
+{
+	const struct rofs_header *hdr = rofs_header(mountp);
+
+	if (hdr == NULL) {
+		return -EINVAL;
+	}
+
+	if ((sys_le32_to_cpu(hdr->magic) != ROFS_MAGIC) ||
+	    (sys_le16_to_cpu(hdr->version) != ROFS_VERSION) ||
+	    (sys_le32_to_cpu(hdr->align) == 0U)) {
+		LOG_ERR("Invalid rofs image at %p", (void *)hdr);
+		return -EINVAL;
+	}
+
+	mountp->flags |= FS_MOUNT_FLAG_READ_ONLY;
+
+	return 0;
+}
+
+static int rofs_unmount(struct fs_mount_t *mountp)
+{
+	ARG_UNUSED(mountp);
+
+	return 0;
+}
+
+/* File system interface */
+static const struct fs_file_system_t rofs_fs = {
+	.open = rofs_open,
+	.close = rofs_close,
+	.read = rofs_read,
+	.lseek = rofs_lseek,
+	.tell = rofs_tell,
+	.mmap = rofs_mmap,
+	.opendir = rofs_opendir,
+	.readdir = rofs_readdir,
+	.closedir = rofs_closedir,
+	.mount = rofs_mount,
+	.unmount = rofs_unmount,
+	.stat = rofs_stat,
+	.statvfs = rofs_statvfs,
+};
+
+static int rofs_init(void)
+{
+	return fs_register(FS_ROFS, &rofs_fs);
+}
+
+SYS_INIT(rofs_init, POST_KERNEL, 99);
@@ -442,6 +442,33 @@ static int cmd_statvfs(const struct shell *sh, size_t argc, char **argv)
 	return 0;
 }
 
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+static int cmd_cache(const struct shell *sh, size_t argc, char **argv)
+{
+	int err;
+	char path[MAX_PATH_LEN];
+	struct fs_cache_stats stats;
+	uint32_t total;
+
+	create_abs_path(argv[1], path, sizeof(path));
+
+	err = fs_cache_stats_get(path, &stats);
+	if (err < 0) {
+		shell_error(sh, "Failed to get cache stats of %s (%d)", path, err);
+		return -ENOEXEC;
+	}
+
+	total = stats.hits + stats.misses;
+	shell_fprintf(sh, SHELL_NORMAL,
+		      "hits %u, misses %u (%u%% hit), writebacks %u\n",
+		      stats.hits, stats.misses,
+		      (total != 0U) ? (uint32_t)((100ULL * stats.hits) / total) : 0U,
+		      stats.writebacks);
+
+	return 0;
+}
+#endif
+
 static int cmd_write(const struct shell *sh, size_t argc, char **argv)
 {
 	char path[MAX_PATH_LEN];
@@ -851,6 +878,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_fs,
 	SHELL_CMD_ARG(rm, NULL, "Remove file", cmd_rm, 2, 0),
 	SHELL_CMD_ARG(statvfs, NULL, "Show file system state", cmd_statvfs, 2, 0),
 	SHELL_CMD_ARG(trunc, NULL, "Truncate file", cmd_trunc, 2, 255),
+#ifdef CONFIG_FILE_SYSTEM_CACHE
+	SHELL_CMD_ARG(cache, NULL, "Show page cache statistics", cmd_cache, 2, 0),
+#endif
 	SHELL_CMD_ARG(write, NULL, "Write file", cmd_write, 3, 255),
 #ifdef CONFIG_FILE_SYSTEM_SHELL_TEST_COMMANDS
 	SHELL_CMD_ARG(read_test, NULL, "Read file test",
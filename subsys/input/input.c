@@ -7,6 +7,7 @@
 #include <zephyr/input/input.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
 #include <zephyr/sys/iterable_sections.h>
 
 LOG_MODULE_REGISTER(input, CONFIG_INPUT_LOG_LEVEL);
@@ -16,6 +17,28 @@ LOG_MODULE_REGISTER(input, CONFIG_INPUT_LOG_LEVEL);
 K_MSGQ_DEFINE(input_msgq, sizeof(struct input_event),
 	      CONFIG_INPUT_QUEUE_MAX_MSGS, 4);
 
+static atomic_t input_queue_max_used;
+static atomic_t input_queue_dropped;
+
+static void input_queue_stats_update(int ret)
+{
+	atomic_val_t used;
+	atomic_val_t max_used;
+
+	if (ret != 0) {
+		atomic_inc(&input_queue_dropped);
+		return;
+	}
+
+	used = k_msgq_num_used_get(&input_msgq);
+	do {
+		max_used = atomic_get(&input_queue_max_used);
+		if (used <= max_used) {
+			break;
+		}
+	} while (!atomic_cas(&input_queue_max_used, max_used, used));
+}
+
 #endif
 
 static void input_process(struct input_event *evt)
@@ -37,6 +60,26 @@ bool input_queue_empty(void)
 	return true;
 }
 
+int input_queue_stats_get(struct input_queue_stats *stats, bool reset)
+{
+#ifdef CONFIG_INPUT_MODE_THREAD
+	if (reset) {
+		stats->max_used = atomic_clear(&input_queue_max_used);
+		stats->dropped = atomic_clear(&input_queue_dropped);
+	} else {
+		stats->max_used = atomic_get(&input_queue_max_used);
+		stats->dropped = atomic_get(&input_queue_dropped);
+	}
+
+	return 0;
+#else
+	ARG_UNUSED(stats);
+	ARG_UNUSED(reset);
+
+	return -ENOTSUP;
+#endif
+}
+
 int input_report(const struct device *dev,
 		 uint8_t type, uint16_t code, int32_t value, bool sync,
 		 k_timeout_t timeout)
@@ -50,7 +93,12 @@ int input_report(const struct device *dev,
 	};
 
 #ifdef CONFIG_INPUT_MODE_THREAD
-	return k_msgq_put(&input_msgq, &evt, timeout);
+	int ret;
+
+	ret = k_msgq_put(&input_msgq, &evt, timeout);
+	input_queue_stats_update(ret);
+
+	return ret;
 #else
 	input_process(&evt);
 	return 0;
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+
 #include <zephyr/input/input.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/shell/shell.h>
@@ -111,6 +113,21 @@ static int input_cmd_report(const struct shell *sh, size_t argc, char *argv[])
 	return 0;
 }
 
+#ifdef CONFIG_INPUT_MODE_THREAD
+static int input_cmd_stats(const struct shell *sh, size_t argc, char *argv[])
+{
+	struct input_queue_stats stats;
+	bool reset = argc > 1 && strcmp(argv[1], "reset") == 0;
+
+	input_queue_stats_get(&stats, reset);
+
+	shell_print(sh, "queue size: %d, max used: %u, dropped: %u",
+		    CONFIG_INPUT_QUEUE_MAX_MSGS, stats.max_used, stats.dropped);
+
+	return 0;
+}
+#endif /* CONFIG_INPUT_MODE_THREAD */
+
 SHELL_STATIC_SUBCMD_SET_CREATE(
 	sub_input_cmds,
 #ifdef CONFIG_INPUT_EVENT_DUMP
@@ -123,6 +140,12 @@ SHELL_STATIC_SUBCMD_SET_CREATE(
 		      "Trigger an input report event\n"
 		      "usage: report <type> <code> <value> [<sync>]",
 		      input_cmd_report, 4, 1),
+#ifdef CONFIG_INPUT_MODE_THREAD
+	SHELL_CMD_ARG(stats, NULL,
+		      "Show the input queue statistics\n"
+		      "usage: stats [reset]",
+		      input_cmd_stats, 1, 1),
+#endif /* CONFIG_INPUT_MODE_THREAD */
 	SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(input, &sub_input_cmds, "Input commands", NULL);
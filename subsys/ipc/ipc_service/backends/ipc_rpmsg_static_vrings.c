@@ -61,6 +61,7 @@ struct backend_config_t {
 	unsigned int wq_prio;
 	unsigned int id;
 	unsigned int buffer_size;
+	uint32_t rx_poll_time_us;
 };
 
 static void rpmsg_service_unbind(struct rpmsg_endpoint *ep)
@@ -298,13 +299,44 @@ static void virtio_notify_cb(struct virtqueue *vq, void *priv)
 
 static void mbox_callback_process(struct k_work *item)
 {
+	const struct backend_config_t *conf;
 	struct backend_data_t *data;
+	struct virtqueue *vq;
 	unsigned int vq_id;
+	uint32_t start;
 
 	data = CONTAINER_OF(item, struct backend_data_t, mbox_work);
+	conf = data->vr.priv;
 	vq_id = (data->role == ROLE_HOST) ? VIRTQUEUE_ID_HOST : VIRTQUEUE_ID_REMOTE;
+	vq = data->vr.vq[vq_id];
 
-	virtqueue_notification(data->vr.vq[vq_id]);
+	if (!IS_ENABLED(CONFIG_IPC_SERVICE_BACKEND_RPMSG_NOTIFY_SUPPRESS)) {
+		virtqueue_notification(vq);
+		return;
+	}
+
+	/*
+	 * Tell the other side not to notify while the ring is drained here,
+	 * the buffers it adds in the meantime are picked up by this loop.
+	 * The notifications are enabled again only when the ring is found
+	 * empty, after polling it for rx_poll_time_us.
+	 */
+	virtqueue_disable_cb(vq);
+	start = k_cycle_get_32();
+
+	while (true) {
+		virtqueue_notification(vq);
+
+		if (k_cyc_to_us_floor32(k_cycle_get_32() - start) < conf->rx_poll_time_us) {
+			continue;
+		}
+
+		if (virtqueue_enable_cb(vq) == 0) {
+			break;
+		}
+
+		virtqueue_disable_cb(vq);
+	}
 }
 
 static void mbox_callback(const struct device *instance, uint32_t channel,
@@ -799,6 +831,7 @@ static int backend_init(const struct device *instance)
 			   (PRIO_PREEMPT)),						\
 		.buffer_size = DT_INST_PROP_OR(i, zephyr_buffer_size,			\
 					       RPMSG_BUFFER_SIZE),			\
+		.rx_poll_time_us = DT_INST_PROP_OR(i, zephyr_rx_poll_time_us, 0),	\
 		.id = i,								\
 	};										\
 											\
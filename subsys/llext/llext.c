@@ -31,6 +31,15 @@ static inline int llext_seek(struct llext_loader *l, size_t pos)
 	return l->seek(l, pos);
 }
 
+static inline void *llext_peek(struct llext_loader *l, size_t pos)
+{
+	if (l->peek) {
+		return l->peek(l, pos);
+	}
+
+	return NULL;
+}
+
 static sys_slist_t _llext_list = SYS_SLIST_STATIC_INIT(&_llext_list);
 
 sys_slist_t *llext_list(void)
@@ -55,13 +64,56 @@ struct llext *llext_by_name(const char *name)
 	return NULL;
 }
 
+/*
+ * Compare symbol names in the order the linker sorted the built-in symbol
+ * table, which is that of the section names, where each name is followed by
+ * an underscore.
+ */
+static int llext_sym_name_cmp(const char *a, const char *b)
+{
+	size_t i = 0;
+
+	while (a[i] != '\0' && a[i] == b[i]) {
+		i++;
+	}
+
+	if (a[i] == b[i]) {
+		return 0;
+	}
+
+	if (a[i] == '\0') {
+		return b[i] == '_' ? -1 : '_' - (unsigned char)b[i];
+	}
+
+	if (b[i] == '\0') {
+		return a[i] == '_' ? 1 : (unsigned char)a[i] - '_';
+	}
+
+	return (unsigned char)a[i] - (unsigned char)b[i];
+}
+
 const void * const llext_find_sym(const struct llext_symtable *sym_table, const char *sym_name)
 {
 	if (sym_table == NULL) {
-		/* Buildin symbol table */
-		STRUCT_SECTION_FOREACH(llext_const_symbol, sym) {
-			if (strcmp(sym->name, sym_name) == 0) {
+		/* Built-in symbol table, sorted by name */
+		struct llext_const_symbol *sym;
+		size_t lo = 0;
+		size_t hi;
+
+		STRUCT_SECTION_COUNT(llext_const_symbol, &hi);
+
+		while (lo < hi) {
+			size_t mid = lo + (hi - lo) / 2;
+			int cmp;
+
+			STRUCT_SECTION_GET(llext_const_symbol, mid, &sym);
+			cmp = llext_sym_name_cmp(sym->name, sym_name);
+			if (cmp == 0) {
 				return sym->addr;
+			} else if (cmp < 0) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
 			}
 		}
 	} else {
@@ -193,6 +245,11 @@ static int llext_map_sections(struct llext_loader *ldr, struct llext *ext)
 			sect_idx = LLEXT_SECT_RODATA;
 		} else if (strcmp(name, ".bss") == 0) {
 			sect_idx = LLEXT_SECT_BSS;
+		} else if (strcmp(name, ".rel.text") == 0 ||
+			   strcmp(name, ".rela.text") == 0) {
+			sect_idx = LLEXT_SECT_REL_TEXT;
+		} else if (strcmp(name, ".rel.rodata") == 0) {
+			sect_idx = LLEXT_SECT_REL_RODATA;
 		} else {
 			LOG_DBG("Not copied section %s", name);
 			continue;
@@ -236,6 +293,28 @@ static inline enum llext_section llext_sect_from_mem(enum llext_mem m)
 	return s;
 }
 
+/*
+ * Whether a section is left unmodified by the loader, so that it can be used
+ * from the loader data instead of being copied.
+ */
+static bool llext_section_in_place(struct llext_loader *ldr, enum llext_mem mem_idx)
+{
+	switch (mem_idx) {
+	case LLEXT_MEM_STRTAB:
+	case LLEXT_MEM_SHSTRTAB:
+		return true;
+	case LLEXT_MEM_TEXT:
+		return IS_ENABLED(CONFIG_LLEXT_STORAGE_WRITABLE) ||
+		       !ldr->sects[LLEXT_SECT_REL_TEXT].sh_type;
+	case LLEXT_MEM_RODATA:
+		return IS_ENABLED(CONFIG_LLEXT_STORAGE_WRITABLE) ||
+		       !ldr->sects[LLEXT_SECT_REL_RODATA].sh_type;
+	default:
+		/* .data and .bss are written at run time */
+		return false;
+	}
+}
+
 static int llext_copy_section(struct llext_loader *ldr, struct llext *ext,
 			      enum llext_mem mem_idx)
 {
@@ -246,12 +325,24 @@ static int llext_copy_section(struct llext_loader *ldr, struct llext *ext,
 		return 0;
 	}
 
+	if (llext_section_in_place(ldr, mem_idx)) {
+		size_t align = MAX(ldr->sects[sect_idx].sh_addralign, 1);
+		void *data = llext_peek(ldr, ldr->sects[sect_idx].sh_offset);
+
+		if (data != NULL && (uintptr_t)data % align == 0) {
+			ext->mem[mem_idx] = data;
+			ext->mem_on_heap[mem_idx] = false;
+			return 0;
+		}
+	}
+
 	ext->mem[mem_idx] = k_heap_aligned_alloc(&llext_heap, sizeof(uintptr_t),
 						 ldr->sects[sect_idx].sh_size,
 						 K_NO_WAIT);
 	if (!ext->mem[mem_idx]) {
 		return -ENOMEM;
 	}
+	ext->mem_on_heap[mem_idx] = true;
 
 	ret = llext_seek(ldr, ldr->sects[sect_idx].sh_offset);
 	if (ret != 0) {
@@ -267,6 +358,8 @@ static int llext_copy_section(struct llext_loader *ldr, struct llext *ext,
 
 err:
 	k_heap_free(&llext_heap, ext->mem[mem_idx]);
+	ext->mem[mem_idx] = NULL;
+	ext->mem_on_heap[mem_idx] = false;
 	return ret;
 }
 
@@ -616,7 +709,7 @@ out:
 	if (ret != 0) {
 		LOG_DBG("Failed to load extension, freeing memory...");
 		for (enum llext_mem mem_idx = 0; mem_idx < LLEXT_MEM_COUNT; mem_idx++) {
-			if (ext->mem[mem_idx] != NULL) {
+			if (ext->mem_on_heap[mem_idx]) {
 				k_heap_free(&llext_heap, ext->mem[mem_idx]);
 			}
 		}
@@ -697,11 +790,12 @@ void llext_unload(struct llext *ext)
 	sys_slist_find_and_remove(&_llext_list, &ext->_llext_list);
 
 	for (int i = 0; i < LLEXT_MEM_COUNT; i++) {
-		if (ext->mem[i] != NULL) {
+		if (ext->mem_on_heap[i]) {
 			LOG_DBG("freeing memory region %d", i);
 			k_heap_free(&llext_heap, ext->mem[i]);
-			ext->mem[i] = NULL;
 		}
+		ext->mem[i] = NULL;
+		ext->mem_on_heap[i] = false;
 	}
 
 	if (ext->sym_tab.syms != NULL) {
@@ -58,4 +58,23 @@ config LOG_BACKEND_FS_FILES_LIMIT
 	  Limit of number of files with logs. It is also limited by
 	  size of file system partition.
 
+config LOG_BACKEND_FS_WRITE_BUFFER_SIZE
+	int "Write-back buffer size"
+	default 0
+	help
+	  Size of a buffer (in bytes) in which logs are collected before being
+	  written to the file, preferably the block size of the file system.
+	  Writing and synchronizing the file once per block instead of once per
+	  message greatly reduces the file system overhead. The buffer is also
+	  written out on panic. When 0, each message is written and
+	  synchronized directly.
+
+config LOG_BACKEND_FS_FLUSH_INTERVAL
+	int "Write-back buffer flush interval"
+	default 1000
+	depends on LOG_BACKEND_FS_WRITE_BUFFER_SIZE > 0
+	help
+	  Maximum time (in milliseconds) logs stay in the write-back buffer
+	  before being written to the file.
+
 endif # LOG_BACKEND_FS
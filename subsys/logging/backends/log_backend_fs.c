@@ -146,7 +146,7 @@ close_dir:
 	return rc;
 }
 
-int write_log_to_file(uint8_t *data, size_t length, void *ctx)
+static int log_file_write(uint8_t *data, size_t length)
 {
 	int rc;
 	struct fs_file_t *f = &fs_file;
@@ -225,6 +225,70 @@ on_error:
 	return length;
 }
 
+#if CONFIG_LOG_BACKEND_FS_WRITE_BUFFER_SIZE > 0
+/* Logs are collected in a write-back buffer and written to the file a block
+ * at a time, so that the file system metadata is not updated for each
+ * message.
+ */
+static uint8_t __aligned(4) wb_buf[CONFIG_LOG_BACKEND_FS_WRITE_BUFFER_SIZE];
+static size_t wb_len;
+static K_MUTEX_DEFINE(wb_mutex);
+
+static void wb_flush(void)
+{
+	size_t offset = 0;
+
+	while ((offset < wb_len) && (backend_state != BACKEND_FS_CORRUPTED)) {
+		offset += log_file_write(&wb_buf[offset], wb_len - offset);
+	}
+
+	wb_len = 0;
+}
+
+static void wb_flush_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	(void)k_mutex_lock(&wb_mutex, K_FOREVER);
+	wb_flush();
+	(void)k_mutex_unlock(&wb_mutex);
+}
+
+static K_WORK_DELAYABLE_DEFINE(wb_flush_work, wb_flush_handler);
+
+int write_log_to_file(uint8_t *data, size_t length, void *ctx)
+{
+	size_t len;
+
+	ARG_UNUSED(ctx);
+
+	(void)k_mutex_lock(&wb_mutex, K_FOREVER);
+
+	len = MIN(length, sizeof(wb_buf) - wb_len);
+	memcpy(&wb_buf[wb_len], data, len);
+	wb_len += len;
+
+	if (wb_len == sizeof(wb_buf)) {
+		wb_flush();
+	} else {
+		/* Does nothing if a flush is already scheduled */
+		(void)k_work_schedule(&wb_flush_work,
+				      K_MSEC(CONFIG_LOG_BACKEND_FS_FLUSH_INTERVAL));
+	}
+
+	(void)k_mutex_unlock(&wb_mutex);
+
+	return len;
+}
+#else
+int write_log_to_file(uint8_t *data, size_t length, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	return log_file_write(data, length);
+}
+#endif /* CONFIG_LOG_BACKEND_FS_WRITE_BUFFER_SIZE > 0 */
+
 static int get_log_file_id(struct fs_dirent *ent)
 {
 	size_t len;
@@ -460,6 +524,16 @@ static void log_backend_fs_init(const struct log_backend *const backend)
 
 static void panic(struct log_backend const *const backend)
 {
+#if CONFIG_LOG_BACKEND_FS_WRITE_BUFFER_SIZE > 0
+	/* Buffered logs are the last ones before the panic, write them if
+	 * the file system can still be used from this context.
+	 */
+	(void)k_work_cancel_delayable(&wb_flush_work);
+	if (!k_is_in_isr()) {
+		wb_flush();
+	}
+#endif
+
 	/* In case of panic deinitialize backend. It is better to keep
 	 * current data rather than log new and risk of failure.
 	 */
@@ -11,6 +11,7 @@
 #include <zephyr/logging/log_backend_std.h>
 #include <zephyr/logging/log_core.h>
 #include <zephyr/logging/log_output.h>
+#include <zephyr/logging/log_output_dict.h>
 #include <zephyr/irq.h>
 #include <zephyr/arch/posix/posix_trace.h>
 
@@ -67,7 +68,11 @@ static void dropped(const struct log_backend *const backend, uint32_t cnt)
 {
 	ARG_UNUSED(backend);
 
-	log_output_dropped_process(&log_output_posix, cnt);
+	if (IS_ENABLED(CONFIG_LOG_BACKEND_NATIVE_POSIX_OUTPUT_DICTIONARY)) {
+		log_dict_output_dropped_process(&log_output_posix, cnt);
+	} else {
+		log_output_dropped_process(&log_output_posix, cnt);
+	}
 }
 
 static void process(const struct log_backend *const backend,
@@ -11,6 +11,7 @@ LOG_MODULE_REGISTER(log_backend_net, CONFIG_LOG_DEFAULT_LEVEL);
 #include <zephyr/logging/log_core.h>
 #include <zephyr/logging/log_output.h>
 #include <zephyr/logging/log_backend_net.h>
+#include <zephyr/logging/log_backend_std.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_context.h>
 
@@ -76,6 +77,53 @@ fail:
 
 LOG_OUTPUT_DEFINE(log_output_net, line_out, output_buf, sizeof(output_buf));
 
+#if CONFIG_LOG_BACKEND_NET_RATE_LIMIT > 0
+/* Token bucket, refilled with CONFIG_LOG_BACKEND_NET_RATE_LIMIT tokens per
+ * second up to CONFIG_LOG_BACKEND_NET_RATE_BURST, each message taking one.
+ */
+static uint32_t rate_tokens = CONFIG_LOG_BACKEND_NET_RATE_BURST;
+static int64_t rate_last_refill;
+static uint32_t rate_dropped;
+
+static bool rate_limit_allow(void)
+{
+	int64_t now = k_uptime_get();
+	uint64_t refill;
+
+	refill = (uint64_t)(now - rate_last_refill) * CONFIG_LOG_BACKEND_NET_RATE_LIMIT /
+		 MSEC_PER_SEC;
+	if (refill > 0) {
+		if (rate_tokens + refill >= CONFIG_LOG_BACKEND_NET_RATE_BURST) {
+			rate_tokens = CONFIG_LOG_BACKEND_NET_RATE_BURST;
+			rate_last_refill = now;
+		} else {
+			rate_tokens += refill;
+			rate_last_refill += refill * MSEC_PER_SEC /
+					    CONFIG_LOG_BACKEND_NET_RATE_LIMIT;
+		}
+	}
+
+	if (rate_tokens == 0) {
+		rate_dropped++;
+		return false;
+	}
+
+	rate_tokens--;
+
+	if (rate_dropped > 0) {
+		log_backend_std_dropped(&log_output_net, rate_dropped);
+		rate_dropped = 0;
+	}
+
+	return true;
+}
+#else
+static inline bool rate_limit_allow(void)
+{
+	return true;
+}
+#endif /* CONFIG_LOG_BACKEND_NET_RATE_LIMIT > 0 */
+
 static int do_net_init(void)
 {
 	struct sockaddr *local_addr = NULL;
@@ -186,6 +234,10 @@ static void process(const struct log_backend *const backend,
 		net_init_done = true;
 	}
 
+	if (!rate_limit_allow()) {
+		return;
+	}
+
 	log_format_func_t log_output_func = log_format_func_t_get(log_format_current);
 
 	log_output_func(&log_output_net, &msg->log, flags);
@@ -9,6 +9,7 @@
 #include <zephyr/logging/log_output.h>
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/logging/log_backend_std.h>
+#include <zephyr/logging/log_backend_uart.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/device.h>
 #include <zephyr/drivers/uart.h>
@@ -16,6 +17,7 @@
 #include <zephyr/sys/__assert.h>
 #include <zephyr/pm/device.h>
 #include <zephyr/pm/device_runtime.h>
+#include <string.h>
 LOG_MODULE_REGISTER(log_uart);
 
 /* Fixed size to avoid auto-added trailing '\0'.
@@ -30,12 +32,34 @@ static volatile bool in_panic;
 static bool use_async;
 static uint32_t log_format_current = CONFIG_LOG_BACKEND_UART_OUTPUT_DEFAULT;
 
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC_DOUBLE_BUFFER
+/* Holds data being transmitted while the next chunk is formatted. */
+static uint8_t uart_tx_buf[CONFIG_LOG_BACKEND_UART_BUFFER_SIZE];
+/* Device is released when the transfer started by char_out() completes. */
+static bool tx_pm_put;
+#endif
+
+#ifdef CONFIG_LOG_BACKEND_UART_STATS
+static struct log_backend_uart_stats stats;
+
+#define STATS_ADD(_field, _val) (stats._field += (_val))
+#else
+#define STATS_ADD(_field, _val)
+#endif
+
 static void uart_callback(const struct device *dev,
 			  struct uart_event *evt,
 			  void *user_data)
 {
 	switch (evt->type) {
 	case UART_TX_DONE:
+	case UART_TX_ABORTED:
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC_DOUBLE_BUFFER
+		if (tx_pm_put) {
+			tx_pm_put = false;
+			(void)pm_device_runtime_put_async(dev);
+		}
+#endif
 		k_sem_give(&sem);
 		break;
 	default:
@@ -43,6 +67,28 @@ static void uart_callback(const struct device *dev,
 	}
 }
 
+static void tx_wait(void)
+{
+	int err;
+
+#ifdef CONFIG_LOG_BACKEND_UART_STATS
+	if (k_sem_count_get(&sem) == 0U) {
+		uint32_t start = k_cycle_get_32();
+
+		err = k_sem_take(&sem, K_FOREVER);
+		stats.tx_waits++;
+		stats.tx_wait_us += k_cyc_to_us_floor32(k_cycle_get_32() - start);
+		__ASSERT_NO_MSG(err == 0);
+		return;
+	}
+#endif
+
+	err = k_sem_take(&sem, K_FOREVER);
+	__ASSERT_NO_MSG(err == 0);
+
+	(void)err;
+}
+
 static void dict_char_out_hex(uint8_t *data, size_t length)
 {
 	for (size_t i = 0; i < length; i++) {
@@ -87,14 +133,36 @@ static int char_out(uint8_t *data, size_t length, void *ctx)
 		goto cleanup;
 	}
 
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC_DOUBLE_BUFFER
+	/* Wait for the previous transfer only when its buffer is needed. */
+	tx_wait();
+
+	length = MIN(length, sizeof(uart_tx_buf));
+	memcpy(uart_tx_buf, data, length);
+	tx_pm_put = pm_device_runtime_is_enabled(uart_dev) && !k_is_in_isr();
+
+	err = uart_tx(uart_dev, uart_tx_buf, length, SYS_FOREVER_US);
+	if (err == 0) {
+		STATS_ADD(bytes, length);
+		return length;
+	}
+
+	/* No completion will be signaled, data is lost. */
+	__ASSERT_NO_MSG(err == 0);
+	tx_pm_put = false;
+	k_sem_give(&sem);
+	goto cleanup;
+#else
 	err = uart_tx(uart_dev, data, length, SYS_FOREVER_US);
 	__ASSERT_NO_MSG(err == 0);
 
-	err = k_sem_take(&sem, K_FOREVER);
-	__ASSERT_NO_MSG(err == 0);
+	tx_wait();
 
 	(void)err;
+#endif
 cleanup:
+	STATS_ADD(bytes, length);
+
 	if (pm_device_runtime_is_enabled(uart_dev) && !k_is_in_isr()) {
 		/* As errors cannot be returned, ignore the return value */
 		(void)pm_device_runtime_put(uart_dev);
@@ -144,7 +212,10 @@ static void log_backend_uart_init(struct log_backend const *const backend)
 
 		if (err == 0) {
 			use_async = true;
-			k_sem_init(&sem, 0, 1);
+			/* With double buffering no transfer is in flight. */
+			k_sem_init(&sem,
+				   IS_ENABLED(CONFIG_LOG_BACKEND_UART_ASYNC_DOUBLE_BUFFER) ? 1 : 0,
+				   1);
 		} else {
 			LOG_WRN("Failed to initialize asynchronous mode (err:%d). "
 				"Fallback to polling.", err);
@@ -174,6 +245,15 @@ static void panic(struct log_backend const *const backend)
 	}
 #endif /* CONFIG_PM_DEVICE */
 
+#ifdef CONFIG_LOG_BACKEND_UART_ASYNC_DOUBLE_BUFFER
+	/* Transfer completion may never be signaled anymore, output after
+	 * panic is polled.
+	 */
+	if (use_async && (k_sem_count_get(&sem) == 0U)) {
+		(void)uart_tx_abort(uart_dev);
+	}
+#endif
+
 	in_panic = true;
 	log_backend_std_panic(&log_output_uart);
 }
@@ -182,6 +262,8 @@ static void dropped(const struct log_backend *const backend, uint32_t cnt)
 {
 	ARG_UNUSED(backend);
 
+	STATS_ADD(dropped, cnt);
+
 	if (IS_ENABLED(CONFIG_LOG_BACKEND_UART_OUTPUT_DICTIONARY)) {
 		log_dict_output_dropped_process(&log_output_uart, cnt);
 	} else {
@@ -189,6 +271,13 @@ static void dropped(const struct log_backend *const backend, uint32_t cnt)
 	}
 }
 
+#ifdef CONFIG_LOG_BACKEND_UART_STATS
+void log_backend_uart_stats_get(struct log_backend_uart_stats *out)
+{
+	*out = stats;
+}
+#endif
+
 const struct log_backend_api log_backend_uart_api = {
 	.process = process,
 	.panic = panic,
@@ -22,6 +22,7 @@
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/logging/log_output_custom.h>
 #include <zephyr/linker/utils.h>
+#include <zephyr/profiling/region.h>
 
 LOG_MODULE_REGISTER(log);
 
@@ -132,6 +133,34 @@ static const struct mpsc_pbuf_buffer_config mpsc_config = {
 };
 #endif
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+/* CPU 0 uses log_buffer, other CPUs have a dedicated buffer each. */
+static struct mpsc_pbuf_buffer cpu_log_buffer[CONFIG_MP_MAX_NUM_CPUS - 1];
+static uint32_t __aligned(Z_LOG_MSG_ALIGNMENT)
+	cpu_buf32[CONFIG_MP_MAX_NUM_CPUS - 1][CONFIG_LOG_BUFFER_SIZE / sizeof(int)];
+
+/* Message claimed from each buffer but not yet processed. */
+static union log_msg_generic *cpu_msg[CONFIG_MP_MAX_NUM_CPUS];
+
+static struct mpsc_pbuf_buffer *cpu_buffer_get(unsigned int cpu)
+{
+	return cpu == 0 ? &log_buffer : &cpu_log_buffer[cpu - 1];
+}
+
+/* Get the buffer that a message has been allocated from. */
+static struct mpsc_pbuf_buffer *cpu_buffer_of(const void *msg)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cpu_buf32); i++) {
+		if ((msg >= (void *)cpu_buf32[i]) &&
+		    (msg < (void *)&cpu_buf32[i][ARRAY_SIZE(cpu_buf32[i])])) {
+			return &cpu_log_buffer[i];
+		}
+	}
+
+	return &log_buffer;
+}
+#endif /* CONFIG_LOG_PER_CPU_BUFFERS */
+
 /* Check that default tag can fit in tag buffer. */
 COND_CODE_0(CONFIG_LOG_TAG_MAX_LEN, (),
 	(BUILD_ASSERT(sizeof(CONFIG_LOG_TAG_DEFAULT) <= CONFIG_LOG_TAG_MAX_LEN + 1,
@@ -491,9 +520,12 @@ void z_log_notify_backend_enabled(void)
 
 static inline bool z_log_unordered_pending(void)
 {
-	return IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) && unordered_cnt;
+	return (IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) ||
+		IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFERS)) && unordered_cnt;
 }
 
+PROFILING_PROBE_DEFINE(log_process);
+
 bool z_impl_log_process(void)
 {
 	if (!IS_ENABLED(CONFIG_LOG_MODE_DEFERRED)) {
@@ -510,9 +542,13 @@ bool z_impl_log_process(void)
 	msg = z_log_msg_claim(&backoff);
 
 	if (msg) {
+		PROFILING_PROBE_START(log_process);
+
 		atomic_dec(&buffered_cnt);
 		msg_process(msg);
 		z_log_msg_free(msg);
+
+		PROFILING_PROBE_END(log_process);
 	} else if (CONFIG_LOG_PROCESSING_LATENCY_US > 0 && !K_TIMEOUT_EQ(backoff, K_NO_WAIT)) {
 		/* If backoff is requested, it means that there are pending
 		 * messages but they are too new and processing shall back off
@@ -589,6 +625,20 @@ void z_log_msg_init(void)
 	mpsc_pbuf_init(&log_buffer, &mpsc_config);
 	curr_log_buffer = &log_buffer;
 #endif
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	struct mpsc_pbuf_buffer_config config = mpsc_config;
+
+	for (size_t i = 0; i < ARRAY_SIZE(cpu_log_buffer); i++) {
+		config.buf = cpu_buf32[i];
+		config.size = ARRAY_SIZE(cpu_buf32[i]);
+		mpsc_pbuf_init(&cpu_log_buffer[i], &config);
+	}
+
+	memset(cpu_msg, 0, sizeof(cpu_msg));
+	/* Timestamps restart on reinitialization, they are not unordered. */
+	prev_timestamp = 0;
+	atomic_clear(&unordered_cnt);
+#endif
 }
 
 static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
@@ -606,7 +656,15 @@ static struct log_msg *msg_alloc(struct mpsc_pbuf_buffer *buffer, uint32_t wlen)
 
 struct log_msg *z_log_msg_alloc(uint32_t wlen)
 {
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	/* Being migrated after reading the CPU id only costs contention on
+	 * the buffer of the previous CPU, the message is committed to the
+	 * buffer it was allocated from.
+	 */
+	return msg_alloc(cpu_buffer_get(arch_curr_cpu()->id), wlen);
+#else
 	return msg_alloc(&log_buffer, wlen);
+#endif
 }
 
 static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
@@ -628,7 +686,11 @@ static void msg_commit(struct mpsc_pbuf_buffer *buffer, struct log_msg *msg)
 void z_log_msg_commit(struct log_msg *msg)
 {
 	msg->hdr.timestamp = timestamp_func();
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	msg_commit(cpu_buffer_of(msg), msg);
+#else
 	msg_commit(&log_buffer, msg);
+#endif
 }
 
 union log_msg_generic *z_log_msg_local_claim(void)
@@ -641,6 +703,34 @@ union log_msg_generic *z_log_msg_local_claim(void)
 
 }
 
+/* Check if the oldest message might still be preceded by messages being
+ * created in other buffers. If so, set how long processing shall back off.
+ */
+static bool msg_too_new(log_timestamp_t t_min, k_timeout_t *backoff)
+{
+	if (CONFIG_LOG_PROCESSING_LATENCY_US > 0) {
+		int32_t diff = t_min - (timestamp_func() - proc_latency);
+
+		if (diff > 0) {
+		       /* Entry is too new. Back off for sometime to allow new
+			* remote messages to arrive which may have been captured
+			* earlier (but on other platform). Calculate for how
+			* long processing shall back off.
+			*/
+			if (timestamp_freq == sys_clock_hw_cycles_per_sec()) {
+				*backoff = K_TICKS(diff);
+			} else {
+				*backoff = K_TICKS((diff * sys_clock_hw_cycles_per_sec()) /
+						timestamp_freq);
+			}
+
+			return true;
+		}
+	}
+
+	return false;
+}
+
 /* If there are buffers dedicated for each link, claim the oldest message (lowest timestamp). */
 union log_msg_generic *z_log_msg_claim_oldest(k_timeout_t *backoff)
 {
@@ -676,24 +766,8 @@ union log_msg_generic *z_log_msg_claim_oldest(k_timeout_t *backoff)
 	}
 
 	if (msg) {
-		if (CONFIG_LOG_PROCESSING_LATENCY_US > 0) {
-			int32_t diff = t_min - (timestamp_func() - proc_latency);
-
-			if (diff > 0) {
-			       /* Entry is too new. Back off for sometime to allow new
-				* remote messages to arrive which may have been captured
-				* earlier (but on other platform). Calculate for how
-				* long processing shall back off.
-				*/
-				if (timestamp_freq == sys_clock_hw_cycles_per_sec()) {
-					*backoff = K_TICKS(diff);
-				} else {
-					*backoff = K_TICKS((diff * sys_clock_hw_cycles_per_sec()) /
-							timestamp_freq);
-				}
-
-				return NULL;
-			}
+		if (msg_too_new(t_min, backoff)) {
+			return NULL;
 		}
 
 		(*chosen).msg = NULL;
@@ -708,10 +782,60 @@ union log_msg_generic *z_log_msg_claim_oldest(k_timeout_t *backoff)
 	return msg;
 }
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+/* Claim the oldest message (lowest timestamp) amongst the CPU buffers. */
+static union log_msg_generic *cpu_msg_claim_oldest(k_timeout_t *backoff)
+{
+	union log_msg_generic *msg = NULL;
+	log_timestamp_t t_min = 0;
+	unsigned int chosen = 0;
+
+	for (unsigned int i = 0; i < ARRAY_SIZE(cpu_msg); i++) {
+		if (cpu_msg[i] == NULL) {
+			cpu_msg[i] = (union log_msg_generic *)
+				mpsc_pbuf_claim(cpu_buffer_get(i));
+		}
+
+		if (cpu_msg[i]) {
+			log_timestamp_t t = log_msg_get_timestamp(&cpu_msg[i]->log);
+
+			if ((msg == NULL) || (t < t_min)) {
+				t_min = t;
+				msg = cpu_msg[i];
+				chosen = i;
+			}
+		}
+	}
+
+	if (msg == NULL) {
+		return NULL;
+	}
+
+	if (msg_too_new(t_min, backoff)) {
+		return NULL;
+	}
+
+	cpu_msg[chosen] = NULL;
+	curr_log_buffer = cpu_buffer_get(chosen);
+
+	if (t_min < prev_timestamp) {
+		atomic_inc(&unordered_cnt);
+	}
+
+	prev_timestamp = t_min;
+
+	return msg;
+}
+#endif /* CONFIG_LOG_PER_CPU_BUFFERS */
+
 union log_msg_generic *z_log_msg_claim(k_timeout_t *backoff)
 {
 	size_t len;
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	return cpu_msg_claim_oldest(backoff);
+#endif
+
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	/* Use only one buffer if others are not registered. */
@@ -748,6 +872,16 @@ bool z_log_msg_pending(void)
 	size_t len;
 	int i = 0;
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	for (unsigned int cpu = 0; cpu < ARRAY_SIZE(cpu_msg); cpu++) {
+		if (cpu_msg[cpu] || msg_pending(cpu_buffer_get(cpu))) {
+			return true;
+		}
+	}
+
+	return false;
+#endif
+
 	STRUCT_SECTION_COUNT(log_mpsc_pbuf, &len);
 
 	if (!IS_ENABLED(CONFIG_LOG_MULTIDOMAIN) || (len == 1)) {
@@ -832,6 +966,17 @@ int log_mem_get_usage(uint32_t *buf_size, uint32_t *usage)
 
 	mpsc_pbuf_get_utilization(&log_buffer, buf_size, usage);
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	for (size_t i = 0; i < ARRAY_SIZE(cpu_log_buffer); i++) {
+		uint32_t size;
+		uint32_t used;
+
+		mpsc_pbuf_get_utilization(&cpu_log_buffer[i], &size, &used);
+		*buf_size += size;
+		*usage += used;
+	}
+#endif
+
 	return 0;
 }
 
@@ -843,7 +988,27 @@ int log_mem_get_max_usage(uint32_t *max)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_LOG_PER_CPU_BUFFERS
+	uint32_t total = 0;
+
+	for (unsigned int cpu = 0; cpu < ARRAY_SIZE(cpu_msg); cpu++) {
+		uint32_t cpu_max;
+		int err;
+
+		err = mpsc_pbuf_get_max_utilization(cpu_buffer_get(cpu), &cpu_max);
+		if (err) {
+			return err;
+		}
+
+		total += cpu_max;
+	}
+
+	*max = total;
+
+	return 0;
+#else
 	return mpsc_pbuf_get_max_utilization(&log_buffer, max);
+#endif
 }
 
 static void log_backend_notify_all(enum log_backend_evt event,
@@ -238,11 +238,15 @@ void z_impl_z_log_msg_static_create(const void *source,
 		uint32_t flags = CBPRINTF_PACKAGE_CONVERT_RW_STR |
 				 (IS_ENABLED(CONFIG_LOG_FMT_SECTION_STRIP) ?
 				 0 : CBPRINTF_PACKAGE_CONVERT_PTR_CHECK);
+		/* Without string arguments to append, the package laid out at
+		 * build time is copied as is.
+		 */
+		bool raw_copy = ((union cbprintf_package_hdr *)package)->desc.rw_str_cnt == 0;
 		uint16_t strl[4];
 		int len;
 
-		len = cbprintf_package_copy(package, inlen,
-					    NULL, 0, flags,
+		len = raw_copy ? inlen :
+		      cbprintf_package_copy(package, inlen, NULL, 0, flags,
 					    strl, ARRAY_SIZE(strl));
 
 		if (len > Z_LOG_MSG_MAX_PACKAGE) {
@@ -258,7 +262,9 @@ void z_impl_z_log_msg_static_create(const void *source,
 		 */
 		out_desc.package_len = len;
 		msg = z_log_msg_alloc(log_msg_get_total_wlen(out_desc));
-		if (msg) {
+		if (msg && raw_copy) {
+			memcpy(msg->data, package, inlen);
+		} else if (msg) {
 			len = cbprintf_package_copy(package, inlen,
 						    msg->data, out_desc.package_len,
 						    flags, strl, ARRAY_SIZE(strl));
@@ -272,10 +278,34 @@ void z_impl_z_log_msg_static_create(const void *source,
 }
 
 #ifdef CONFIG_USERSPACE
+/* Runtime filters cannot be read from user mode so messages created there are
+ * not filtered at the call site. Drop them before any buffer space is taken.
+ */
+static bool user_msg_filtered(const void *source, uint8_t level)
+{
+	const struct log_source_dynamic_data *dsource = source;
+
+	if (!IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) || IS_ENABLED(CONFIG_LOG_FRONTEND)) {
+		return false;
+	}
+
+	/* Source is provided by the caller, only trust it when it is valid. */
+	if ((dsource < TYPE_SECTION_START(log_dynamic)) ||
+	    (dsource >= TYPE_SECTION_END(log_dynamic))) {
+		return false;
+	}
+
+	return level > Z_LOG_RUNTIME_FILTER(dsource->filters);
+}
+
 static inline void z_vrfy_z_log_msg_static_create(const void *source,
 			      const struct log_msg_desc desc,
 			      uint8_t *package, const void *data)
 {
+	if (user_msg_filtered(source, desc.level)) {
+		return;
+	}
+
 	return z_impl_z_log_msg_static_create(source, desc, package, data);
 }
 #include <syscalls/z_log_msg_static_create_mrsh.c>
@@ -337,6 +367,10 @@ static inline void z_vrfy_z_log_msg_runtime_vcreate(uint8_t domain_id,
 				uint8_t level, const void *data, size_t dlen,
 				uint32_t package_flags, const char *fmt, va_list ap)
 {
+	if (user_msg_filtered(source, level)) {
+		return;
+	}
+
 	return z_impl_z_log_msg_runtime_vcreate(domain_id, source, level, data,
 						dlen, package_flags, fmt, ap);
 }
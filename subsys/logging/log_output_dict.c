@@ -11,6 +11,7 @@
 #include <zephyr/logging/log_output_dict.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/sys/util.h>
+#include <string.h>
 
 static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
 			 void *ctx)
@@ -24,11 +25,124 @@ static void buffer_write(log_output_func_t outf, uint8_t *buf, size_t len,
 	} while (len != 0);
 }
 
+static uint32_t source_id_get(struct log_msg *msg)
+{
+	void *source = (void *)log_msg_get_source(msg);
+
+	if (source == NULL) {
+		return 0U;
+	}
+
+	return IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
+		log_dynamic_source_id(source) : log_const_source_id(source);
+}
+
+#ifdef CONFIG_LOG_DICTIONARY_COMPACT
+/* Maximum length of a LEB128 encoded 64-bit value. */
+#define VARINT_MAX_LEN 10
+
+static size_t varint_encode(uint8_t *buf, uint64_t val)
+{
+	size_t len = 0;
+
+	do {
+		buf[len] = val & 0x7F;
+		val >>= 7;
+		if (val != 0U) {
+			buf[len] |= 0x80;
+		}
+		len++;
+	} while (val != 0U);
+
+	return len;
+}
+
+static void compact_msg_process(const struct log_output *output,
+				struct log_msg *msg)
+{
+	struct log_output_control_block *cb = output->control_block;
+	struct log_dict_output_compact_msg_hdr_t *hdr;
+	uint8_t buf[sizeof(*hdr) + 4 * VARINT_MAX_LEN];
+	log_timestamp_t timestamp = msg->hdr.timestamp;
+	size_t pkg_len;
+	size_t data_len;
+	uint8_t *pkg = log_msg_get_package(msg, &pkg_len);
+	uint8_t *data = log_msg_get_data(msg, &data_len);
+	size_t args_len = 0;
+	size_t len = sizeof(*hdr);
+	int64_t delta;
+
+	if (cb->dict_seq == 0U) {
+		cb->dict_timestamp = 0;
+	}
+
+	hdr = (struct log_dict_output_compact_msg_hdr_t *)buf;
+	hdr->type = MSG_NORMAL_COMPACT;
+	hdr->seq = cb->dict_seq++;
+	hdr->domain = msg->hdr.desc.domain;
+	hdr->level = msg->hdr.desc.level;
+
+	/* Timestamps of messages from other domains may go backwards, a
+	 * wrapping 32-bit timestamp must still give a small difference.
+	 */
+	delta = (sizeof(log_timestamp_t) == sizeof(int64_t)) ?
+		(int64_t)(timestamp - cb->dict_timestamp) :
+		(int32_t)(timestamp - cb->dict_timestamp);
+	cb->dict_timestamp = timestamp;
+
+	len += varint_encode(&buf[len], source_id_get(msg));
+	len += varint_encode(&buf[len], ((uint64_t)delta << 1) ^ (uint64_t)(delta >> 63));
+	len += varint_encode(&buf[len], pkg_len);
+	len += varint_encode(&buf[len], data_len);
+	buffer_write(output->func, buf, len, (void *)output);
+
+	if (pkg_len > 0U) {
+		/* First byte of the package is the length of its arguments
+		 * section in 32-bit words. Arguments are mostly small integers
+		 * so encoding each word as varint saves most of its bytes.
+		 */
+		args_len = MIN(pkg[0] * sizeof(uint32_t), pkg_len);
+		len = 0;
+
+		for (size_t i = 0; i < args_len; i += sizeof(uint32_t)) {
+			uint32_t word;
+
+			memcpy(&word, &pkg[i], sizeof(word));
+			len += varint_encode(&buf[len], word);
+
+			if (len > sizeof(buf) - VARINT_MAX_LEN) {
+				buffer_write(output->func, buf, len, (void *)output);
+				len = 0;
+			}
+		}
+
+		if (len > 0U) {
+			buffer_write(output->func, buf, len, (void *)output);
+		}
+	}
+
+	if (pkg_len > args_len) {
+		buffer_write(output->func, &pkg[args_len], pkg_len - args_len,
+			     (void *)output);
+	}
+
+	if (data_len > 0U) {
+		buffer_write(output->func, data, data_len, (void *)output);
+	}
+
+	log_output_flush(output);
+}
+#endif /* CONFIG_LOG_DICTIONARY_COMPACT */
+
 void log_dict_output_msg_process(const struct log_output *output,
 				 struct log_msg *msg, uint32_t flags)
 {
 	struct log_dict_output_normal_msg_hdr_t output_hdr;
-	void *source = (void *)log_msg_get_source(msg);
+
+#ifdef CONFIG_LOG_DICTIONARY_COMPACT
+	compact_msg_process(output, msg);
+	return;
+#endif
 
 	/* Keep sync with header in struct log_msg */
 	output_hdr.type = MSG_NORMAL;
@@ -38,11 +152,7 @@ void log_dict_output_msg_process(const struct log_output *output,
 	output_hdr.data_len = msg->hdr.desc.data_len;
 	output_hdr.timestamp = msg->hdr.timestamp;
 
-	output_hdr.source = (source != NULL) ?
-				(IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
-					log_dynamic_source_id(source) :
-					log_const_source_id(source)) :
-				0U;
+	output_hdr.source = source_id_get(msg);
 
 	buffer_write(output->func, (uint8_t *)&output_hdr, sizeof(output_hdr),
 		     (void *)output);
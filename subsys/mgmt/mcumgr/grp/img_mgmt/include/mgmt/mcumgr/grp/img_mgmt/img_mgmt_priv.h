@@ -75,6 +75,18 @@ int img_mgmt_read(int slot, unsigned int offset, void *dst, unsigned int num_byt
 int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned int num_bytes,
 			      bool last);
 
+#if defined(CONFIG_MCUMGR_GRP_IMG_UPLOAD_ASYNC_WRITE)
+/**
+ * @brief Waits until the image data queued by img_mgmt_write_image_data() has
+ * been written to flash.
+ */
+void img_mgmt_write_image_data_wait(void);
+#else
+static inline void img_mgmt_write_image_data_wait(void)
+{
+}
+#endif
+
 /**
  * @brief Indicates the type of swap operation that will occur on the next
  * reboot, if any, between provided slot and it's pair.
@@ -360,6 +360,7 @@ img_mgmt_erase(struct smp_streamer *ctxt)
 		}
 	}
 
+	img_mgmt_write_image_data_wait();
 	rc = img_mgmt_erase_slot(slot);
 	img_mgmt_reset_upload();
 
@@ -566,6 +567,9 @@ defined(CONFIG_MCUMGR_SMP_COMMAND_STATUS_HOOKS)
 
 		g_img_mgmt_state.off = 0;
 
+		/* Data of a previous upload may still be in the process of being written */
+		img_mgmt_write_image_data_wait();
+
 #if defined(CONFIG_MCUMGR_GRP_IMG_STATUS_HOOKS)
 		(void)mgmt_callback_notify(MGMT_EVT_OP_IMG_MGMT_DFU_STARTED, NULL, 0, &err_rc,
 					   &err_group);
@@ -415,6 +415,94 @@ out:
 
 	return rc;
 }
+#elif defined(CONFIG_MCUMGR_GRP_IMG_UPLOAD_ASYNC_WRITE)
+/*
+ * Image data is queued to a pipe and written to flash by a dedicated thread,
+ * so the transport can receive the next chunks while the flash is programmed.
+ * A write error is reported by the next call, and the last chunk is only
+ * acknowledged once all of the image has been written.
+ */
+static struct flash_img_context img_mgmt_write_ctx;
+K_PIPE_DEFINE(img_mgmt_write_pipe, CONFIG_MCUMGR_GRP_IMG_UPLOAD_ASYNC_WRITE_BUF_SIZE, 4);
+static K_SEM_DEFINE(img_mgmt_write_idle_sem, 0, 1);
+/* Number of bytes queued and not yet written */
+static atomic_t img_mgmt_write_pending;
+static atomic_t img_mgmt_write_rc;
+
+static void img_mgmt_write_thread(void *p1, void *p2, void *p3)
+{
+	static uint8_t chunk[CONFIG_IMG_BLOCK_BUF_SIZE];
+	size_t len;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (1) {
+		(void)k_pipe_get(&img_mgmt_write_pipe, chunk, sizeof(chunk), &len, 1,
+				 K_FOREVER);
+
+		/* Data following a failed write is dropped */
+		if (atomic_get(&img_mgmt_write_rc) == IMG_MGMT_ERR_OK &&
+		    flash_img_buffered_write(&img_mgmt_write_ctx, chunk, len, false) != 0) {
+			atomic_set(&img_mgmt_write_rc, IMG_MGMT_ERR_FLASH_WRITE_FAILED);
+		}
+
+		if (atomic_sub(&img_mgmt_write_pending, len) == len) {
+			k_sem_give(&img_mgmt_write_idle_sem);
+		}
+	}
+}
+
+K_THREAD_DEFINE(img_mgmt_write, CONFIG_MCUMGR_GRP_IMG_UPLOAD_ASYNC_WRITE_STACK_SIZE,
+		img_mgmt_write_thread, NULL, NULL, NULL,
+		CONFIG_MCUMGR_GRP_IMG_UPLOAD_ASYNC_WRITE_THREAD_PRIO, 0, 0);
+
+void img_mgmt_write_image_data_wait(void)
+{
+	k_sem_reset(&img_mgmt_write_idle_sem);
+
+	while (atomic_get(&img_mgmt_write_pending) != 0) {
+		k_sem_take(&img_mgmt_write_idle_sem, K_FOREVER);
+	}
+}
+
+int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned int num_bytes,
+			      bool last)
+{
+	size_t written;
+
+	if (offset == 0) {
+		img_mgmt_write_image_data_wait();
+		atomic_set(&img_mgmt_write_rc, IMG_MGMT_ERR_OK);
+
+		if (flash_img_init_id(&img_mgmt_write_ctx, g_img_mgmt_state.area_id) != 0) {
+			return IMG_MGMT_ERR_FLASH_OPEN_FAILED;
+		}
+	}
+
+	if (last) {
+		/* Write the last chunk in place, once everything before it is written */
+		img_mgmt_write_image_data_wait();
+
+		if (atomic_get(&img_mgmt_write_rc) != IMG_MGMT_ERR_OK ||
+		    flash_img_buffered_write(&img_mgmt_write_ctx, data, num_bytes, true) != 0) {
+			return IMG_MGMT_ERR_FLASH_WRITE_FAILED;
+		}
+
+		return IMG_MGMT_ERR_OK;
+	}
+
+	if (atomic_get(&img_mgmt_write_rc) != IMG_MGMT_ERR_OK) {
+		return atomic_get(&img_mgmt_write_rc);
+	}
+
+	atomic_add(&img_mgmt_write_pending, num_bytes);
+	(void)k_pipe_put(&img_mgmt_write_pipe, (void *)data, num_bytes, &written, num_bytes,
+			 K_FOREVER);
+
+	return IMG_MGMT_ERR_OK;
+}
 #else
 int img_mgmt_write_image_data(unsigned int offset, const void *data, unsigned int num_bytes,
 			      bool last)
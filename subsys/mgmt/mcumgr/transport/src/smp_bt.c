@@ -144,6 +144,10 @@ static struct conn_param_data *conn_param_data_alloc(struct bt_conn *conn)
 
 			k_sem_reset(&conn_data[i].smp_notify_sem);
 
+			for (size_t l = 0; l < CONFIG_MCUMGR_TRANSPORT_BT_NOTIFY_COUNT; l++) {
+				k_sem_give(&conn_data[i].smp_notify_sem);
+			}
+
 			return &conn_data[i];
 		}
 	}
@@ -499,9 +503,12 @@ static int smp_bt_tx_pkt(struct net_buf *nb)
 		goto cleanup;
 	}
 
-	k_sem_reset(&cpd->smp_notify_sem);
-
 	while (off < nb->len) {
+		/* Wait for one of the notifications in progress (if the maximum number of
+		 * them is reached) to complete, or for the disconnection.
+		 */
+		k_sem_take(&cpd->smp_notify_sem, K_FOREVER);
+
 		if (cpd->id == 0 || cpd->id != ud->id) {
 			/* The device that sent this packet has disconnected or is not the same
 			 * active connection, drop the outgoing data
@@ -518,6 +525,11 @@ static int smp_bt_tx_pkt(struct net_buf *nb)
 		notify_param.len = mtu_size;
 		rc = bt_gatt_notify_cb(conn, &notify_param);
 
+		if (rc != 0) {
+			/* Nothing was sent, no completion will give the semaphore back */
+			k_sem_give(&cpd->smp_notify_sem);
+		}
+
 		if (rc == -ENOMEM) {
 			if (sent == false) {
 				/* Failed to send a packet thus far, try reducing the MTU size
@@ -545,11 +557,6 @@ static int smp_bt_tx_pkt(struct net_buf *nb)
 			off += mtu_size;
 			notify_param.data = &nb->data[off];
 			sent = true;
-
-			/* Wait for the completion (or disconnect) semaphore before
-			 * continuing, allowing other parts of the system to run.
-			 */
-			k_sem_take(&cpd->smp_notify_sem, K_FOREVER);
 		} else {
 			/* No connection, cannot continue */
 			rc = MGMT_ERR_EUNKNOWN;
@@ -655,7 +662,8 @@ static void smp_bt_setup(void)
 	}
 
 	while (i < CONFIG_BT_MAX_CONN) {
-		k_sem_init(&conn_data[i].smp_notify_sem, 0, 1);
+		k_sem_init(&conn_data[i].smp_notify_sem, 0,
+			   CONFIG_MCUMGR_TRANSPORT_BT_NOTIFY_COUNT);
 		++i;
 	}
 
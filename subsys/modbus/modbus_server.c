@@ -291,6 +291,33 @@ static bool mbs_fc02_di_read(struct modbus_context *ctx)
 	return true;
 }
 
+/* Maximum number of integer registers in a read or write request */
+#define MBS_REGS_LIMIT 125
+
+/*
+ * Read a contiguous range of integer registers with a single call of a block
+ * read callback and store them in the response payload.
+ */
+static int mbs_regs_rd_block(int (*regs_rd)(uint16_t addr, uint16_t *regs,
+					    uint16_t num_regs),
+			     uint16_t reg_addr, uint16_t reg_qty, uint8_t *presp)
+{
+	uint16_t regs[MBS_REGS_LIMIT];
+	int err;
+
+	err = regs_rd(reg_addr, regs, reg_qty);
+	if (err != 0) {
+		return err;
+	}
+
+	for (uint16_t i = 0; i < reg_qty; i++) {
+		sys_put_be16(regs[i], presp);
+		presp += sizeof(uint16_t);
+	}
+
+	return 0;
+}
+
 /*
  * 03 (0x03) Read Holding Registers
  *
@@ -306,7 +333,7 @@ static bool mbs_fc02_di_read(struct modbus_context *ctx)
  */
 static bool mbs_fc03_hreg_read(struct modbus_context *ctx)
 {
-	const uint16_t regs_limit = 125;
+	const uint16_t regs_limit = MBS_REGS_LIMIT;
 	const uint8_t request_len = 4;
 	uint8_t *presp;
 	uint16_t err;
@@ -325,7 +352,8 @@ static bool mbs_fc03_hreg_read(struct modbus_context *ctx)
 	if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
 	    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
 		/* Read integer register */
-		if (ctx->mbs_user_cb->holding_reg_rd == NULL) {
+		if (ctx->mbs_user_cb->holding_reg_rd == NULL &&
+		    ctx->mbs_user_cb->holding_regs_rd == NULL) {
 			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
 			return true;
 		}
@@ -362,6 +390,21 @@ static bool mbs_fc03_hreg_read(struct modbus_context *ctx)
 
 	/* Reset the pointer to the start of the response payload */
 	presp = &ctx->tx_adu.data[1];
+
+	if ((ctx->mbs_user_cb->holding_regs_rd != NULL) &&
+	    ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
+	     !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS))) {
+		/* Read all integer registers at once */
+		err = mbs_regs_rd_block(ctx->mbs_user_cb->holding_regs_rd,
+					reg_addr, reg_qty, presp);
+		if (err != 0) {
+			LOG_INF("Holding register address not supported");
+			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_ADDR);
+		}
+
+		return true;
+	}
+
 	/* Loop through each register requested. */
 	while (reg_qty > 0) {
 		if (reg_addr < MODBUS_FP_EXTENSIONS_ADDR) {
@@ -416,7 +459,7 @@ static bool mbs_fc03_hreg_read(struct modbus_context *ctx)
  */
 static bool mbs_fc04_inreg_read(struct modbus_context *ctx)
 {
-	const uint16_t regs_limit = 125;
+	const uint16_t regs_limit = MBS_REGS_LIMIT;
 	const uint8_t request_len = 4;
 	uint8_t *presp;
 	int err;
@@ -435,7 +478,8 @@ static bool mbs_fc04_inreg_read(struct modbus_context *ctx)
 	if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
 	    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
 		/* Read integer register */
-		if (ctx->mbs_user_cb->input_reg_rd == NULL) {
+		if (ctx->mbs_user_cb->input_reg_rd == NULL &&
+		    ctx->mbs_user_cb->input_regs_rd == NULL) {
 			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
 			return true;
 		}
@@ -472,6 +516,21 @@ static bool mbs_fc04_inreg_read(struct modbus_context *ctx)
 
 	/* Reset the pointer to the start of the response payload */
 	presp = &ctx->tx_adu.data[1];
+
+	if ((ctx->mbs_user_cb->input_regs_rd != NULL) &&
+	    ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
+	     !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS))) {
+		/* Read all integer registers at once */
+		err = mbs_regs_rd_block(ctx->mbs_user_cb->input_regs_rd,
+					reg_addr, reg_qty, presp);
+		if (err != 0) {
+			LOG_INF("Input register address not supported");
+			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_ADDR);
+		}
+
+		return true;
+	}
+
 	/* Loop through each register requested. */
 	while (reg_qty > 0) {
 		if (reg_addr < MODBUS_FP_EXTENSIONS_ADDR) {
@@ -825,7 +884,7 @@ static bool mbs_fc15_coils_write(struct modbus_context *ctx)
  */
 static bool mbs_fc16_hregs_write(struct modbus_context *ctx)
 {
-	const uint16_t regs_limit = 125;
+	const uint16_t regs_limit = MBS_REGS_LIMIT;
 	const uint8_t request_len = 6;
 	const uint8_t response_len = 4;
 	uint8_t *prx_data;
@@ -848,7 +907,8 @@ static bool mbs_fc16_hregs_write(struct modbus_context *ctx)
 	if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
 	    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
 		/* Write integer register */
-		if (ctx->mbs_user_cb->holding_reg_wr == NULL) {
+		if (ctx->mbs_user_cb->holding_reg_wr == NULL &&
+		    ctx->mbs_user_cb->holding_regs_wr == NULL) {
 			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_FC);
 			return true;
 		}
@@ -892,30 +952,48 @@ static bool mbs_fc16_hregs_write(struct modbus_context *ctx)
 	/* The 1st registers data byte is 6th element in payload */
 	prx_data = &ctx->rx_adu.data[5];
 
-	for (uint16_t reg_cntr = 0; reg_cntr < reg_qty; reg_cntr++) {
-		uint16_t addr = reg_addr + reg_cntr;
-
-		if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
-		    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
-			uint16_t reg_val = sys_get_be16(prx_data);
+	if ((ctx->mbs_user_cb->holding_regs_wr != NULL) &&
+	    (reg_size == sizeof(uint16_t))) {
+		uint16_t regs[MBS_REGS_LIMIT];
 
+		/* Write all integer registers at once */
+		for (uint16_t i = 0; i < reg_qty; i++) {
+			regs[i] = sys_get_be16(prx_data);
 			prx_data += sizeof(uint16_t);
-			err = ctx->mbs_user_cb->holding_reg_wr(addr, reg_val);
-		} else {
-			uint32_t reg_val = sys_get_be32(prx_data);
-			float fp;
-
-			/* Write to floating point register */
-			memcpy(&fp, &reg_val, sizeof(float));
-			prx_data += sizeof(uint32_t);
-			err = ctx->mbs_user_cb->holding_reg_wr_fp(addr, fp);
 		}
 
+		err = ctx->mbs_user_cb->holding_regs_wr(reg_addr, regs, reg_qty);
 		if (err != 0) {
 			LOG_INF("Register address not supported");
 			mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_ADDR);
 			return true;
 		}
+	} else {
+		for (uint16_t reg_cntr = 0; reg_cntr < reg_qty; reg_cntr++) {
+			uint16_t addr = reg_addr + reg_cntr;
+
+			if ((reg_addr < MODBUS_FP_EXTENSIONS_ADDR) ||
+			    !IS_ENABLED(CONFIG_MODBUS_FP_EXTENSIONS)) {
+				uint16_t reg_val = sys_get_be16(prx_data);
+
+				prx_data += sizeof(uint16_t);
+				err = ctx->mbs_user_cb->holding_reg_wr(addr, reg_val);
+			} else {
+				uint32_t reg_val = sys_get_be32(prx_data);
+				float fp;
+
+				/* Write to floating point register */
+				memcpy(&fp, &reg_val, sizeof(float));
+				prx_data += sizeof(uint32_t);
+				err = ctx->mbs_user_cb->holding_reg_wr_fp(addr, fp);
+			}
+
+			if (err != 0) {
+				LOG_INF("Register address not supported");
+				mbs_exception_rsp(ctx, MODBUS_EXC_ILLEGAL_DATA_ADDR);
+				return true;
+			}
+		}
 	}
 
 	/* Assemble response payload */
@@ -22,6 +22,14 @@ static void modem_backend_uart_receive_ready_handler(struct k_work *item)
 	modem_pipe_notify_receive_ready(&backend->pipe);
 }
 
+static void modem_backend_uart_transmit_idle_handler(struct k_work *item)
+{
+	struct modem_backend_uart *backend =
+		CONTAINER_OF(item, struct modem_backend_uart, transmit_idle_work);
+
+	modem_pipe_notify_transmit_idle(&backend->pipe);
+}
+
 struct modem_pipe *modem_backend_uart_init(struct modem_backend_uart *backend,
 					   const struct modem_backend_uart_config *config)
 {
@@ -35,6 +43,7 @@ struct modem_pipe *modem_backend_uart_init(struct modem_backend_uart *backend,
 	memset(backend, 0x00, sizeof(*backend));
 	backend->uart = config->uart;
 	k_work_init(&backend->receive_ready_work, modem_backend_uart_receive_ready_handler);
+	k_work_init(&backend->transmit_idle_work, modem_backend_uart_transmit_idle_handler);
 
 #ifdef CONFIG_MODEM_BACKEND_UART_ASYNC
 	if (modem_backend_uart_async_is_supported(backend)) {
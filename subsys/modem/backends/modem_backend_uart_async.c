@@ -58,6 +58,7 @@ static void modem_backend_uart_async_event_handler(const struct device *dev,
 		atomic_clear_bit(&backend->async.state,
 				 MODEM_BACKEND_UART_ASYNC_STATE_TRANSMITTING_BIT);
 
+		k_work_submit(&backend->transmit_idle_work);
 		break;
 
 	case UART_TX_ABORTED:
@@ -65,6 +66,7 @@ static void modem_backend_uart_async_event_handler(const struct device *dev,
 		atomic_clear_bit(&backend->async.state,
 				 MODEM_BACKEND_UART_ASYNC_STATE_TRANSMITTING_BIT);
 
+		k_work_submit(&backend->transmit_idle_work);
 		break;
 
 	case UART_RX_BUF_REQUEST:
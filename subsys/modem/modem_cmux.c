@@ -13,7 +13,6 @@ LOG_MODULE_REGISTER(modem_cmux, CONFIG_MODEM_CMUX_LOG_LEVEL);
 
 #include <string.h>
 
-#define MODEM_CMUX_FCS_POLYNOMIAL		(0xE0)
 #define MODEM_CMUX_FCS_INIT_VALUE		(0xFF)
 #define MODEM_CMUX_EA				(0x01)
 #define MODEM_CMUX_CR				(0x02)
@@ -197,8 +196,28 @@ static void modem_cmux_bus_callback(struct modem_pipe *pipe, enum modem_pipe_eve
 {
 	struct modem_cmux *cmux = (struct modem_cmux *)user_data;
 
-	if (event == MODEM_PIPE_EVENT_RECEIVE_READY) {
+	switch (event) {
+	case MODEM_PIPE_EVENT_RECEIVE_READY:
 		k_work_schedule(&cmux->receive_work, K_NO_WAIT);
+		break;
+
+	case MODEM_PIPE_EVENT_TRANSMIT_IDLE:
+		k_work_schedule(&cmux->transmit_work, K_NO_WAIT);
+		break;
+
+	default:
+		break;
+	}
+}
+
+static void modem_cmux_dlci_notify_transmit_idle(struct modem_cmux *cmux)
+{
+	sys_snode_t *node;
+	struct modem_cmux_dlci *dlci;
+
+	SYS_SLIST_FOR_EACH_NODE(&cmux->dlcis, node) {
+		dlci = (struct modem_cmux_dlci *)node;
+		modem_pipe_notify_transmit_idle(&dlci->pipe);
 	}
 }
 
@@ -219,18 +238,18 @@ static uint16_t modem_cmux_transmit_frame(struct modem_cmux *cmux,
 
 	/* DLCI Address (Max 63) */
 	byte = 0x01 | (frame->cr << 1) | (frame->dlci_address << 2);
-	fcs = crc8(&byte, 1, MODEM_CMUX_FCS_POLYNOMIAL, MODEM_CMUX_FCS_INIT_VALUE, true);
+	fcs = crc8_rohc(MODEM_CMUX_FCS_INIT_VALUE, &byte, 1);
 	ring_buf_put(&cmux->transmit_rb, &byte, 1);
 
 	/* Frame type and poll/final */
 	byte = frame->type | (frame->pf << 4);
-	fcs = crc8(&byte, 1, MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
+	fcs = crc8_rohc(fcs, &byte, 1);
 	ring_buf_put(&cmux->transmit_rb, &byte, 1);
 
 	/* Data length */
 	if (data_len > 127) {
 		byte = data_len << 1;
-		fcs = crc8(&byte, 1, MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
+		fcs = crc8_rohc(fcs, &byte, 1);
 		ring_buf_put(&cmux->transmit_rb, &byte, 1);
 		byte = 0x01 | (data_len >> 7);
 		ring_buf_put(&cmux->transmit_rb, &byte, 1);
@@ -241,10 +260,10 @@ static uint16_t modem_cmux_transmit_frame(struct modem_cmux *cmux,
 
 	/* FCS final */
 	if (frame->type == MODEM_CMUX_FRAME_TYPE_UIH) {
-		fcs = 0xFF - crc8(&byte, 1, MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
+		fcs = 0xFF - crc8_rohc(fcs, &byte, 1);
 	} else {
-		fcs = crc8(&byte, 1, MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
-		fcs = 0xFF - crc8(frame->data, data_len, MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
+		fcs = crc8_rohc(fcs, &byte, 1);
+		fcs = 0xFF - crc8_rohc(fcs, frame->data, data_len);
 	}
 
 	/* Data */
@@ -307,8 +326,9 @@ static int16_t modem_cmux_transmit_data_frame(struct modem_cmux *cmux,
 	 * bytes of wrapping.
 	 */
 	if (space < ((MODEM_CMUX_CMD_FRAME_SIZE_MAX * 2) + MODEM_CMUX_DATA_FRAME_SIZE_MIN)) {
+		/* The DLCI pipes are notified once the transmit buffer is empty */
 		k_mutex_unlock(&cmux->transmit_rb_lock);
-		return -ENOMEM;
+		return 0;
 	}
 
 	modem_cmux_log_transmit_frame(frame);
@@ -351,6 +371,7 @@ static void modem_cmux_on_fcon_command(struct modem_cmux *cmux)
 	cmux->flow_control_on = true;
 	k_mutex_unlock(&cmux->transmit_rb_lock);
 	modem_cmux_acknowledge_received_frame(cmux);
+	modem_cmux_dlci_notify_transmit_idle(cmux);
 }
 
 static void modem_cmux_on_fcoff_command(struct modem_cmux *cmux)
@@ -695,15 +716,13 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 	case MODEM_CMUX_RECEIVE_STATE_FCS:
 		/* Compute FCS */
 		if (cmux->frame.type == MODEM_CMUX_FRAME_TYPE_UIH) {
-			fcs = 0xFF - crc8(cmux->frame_header, cmux->frame_header_len,
-					  MODEM_CMUX_FCS_POLYNOMIAL, MODEM_CMUX_FCS_INIT_VALUE,
-					  true);
+			fcs = 0xFF - crc8_rohc(MODEM_CMUX_FCS_INIT_VALUE, cmux->frame_header,
+					       cmux->frame_header_len);
 		} else {
-			fcs = crc8(cmux->frame_header, cmux->frame_header_len,
-				   MODEM_CMUX_FCS_POLYNOMIAL, MODEM_CMUX_FCS_INIT_VALUE, true);
+			fcs = crc8_rohc(MODEM_CMUX_FCS_INIT_VALUE, cmux->frame_header,
+					cmux->frame_header_len);
 
-			fcs = 0xFF - crc8(cmux->frame.data, cmux->frame.data_len,
-					  MODEM_CMUX_FCS_POLYNOMIAL, fcs, true);
+			fcs = 0xFF - crc8_rohc(fcs, cmux->frame.data, cmux->frame.data_len);
 		}
 
 		/* Validate FCS */
@@ -744,11 +763,27 @@ static void modem_cmux_process_received_byte(struct modem_cmux *cmux, uint8_t by
 	}
 }
 
+/* Copy the data of the frame being received in one go, returns the number of bytes copied */
+static uint16_t modem_cmux_process_received_data(struct modem_cmux *cmux, const uint8_t *data,
+						 uint16_t len)
+{
+	uint16_t copy;
+
+	/* Leave the last byte of the frame and of the buffer to the state machine */
+	copy = MIN(cmux->frame.data_len, cmux->receive_buf_size) - cmux->receive_buf_len;
+	copy = MIN(copy - 1, len);
+
+	memcpy(&cmux->receive_buf[cmux->receive_buf_len], data, copy);
+	cmux->receive_buf_len += copy;
+	return copy;
+}
+
 static void modem_cmux_receive_handler(struct k_work *item)
 {
 	struct k_work_delayable *dwork = k_work_delayable_from_work(item);
 	struct modem_cmux *cmux = CONTAINER_OF(dwork, struct modem_cmux, receive_work);
-	uint8_t buf[16];
+	uint8_t buf[CONFIG_MODEM_CMUX_WORK_BUFFER_SIZE];
+	uint16_t i = 0;
 	int ret;
 
 	/* Receive data from pipe */
@@ -758,8 +793,16 @@ static void modem_cmux_receive_handler(struct k_work *item)
 	}
 
 	/* Process received data */
-	for (uint16_t i = 0; i < (uint16_t)ret; i++) {
+	while (i < (uint16_t)ret) {
+		if (cmux->receive_state == MODEM_CMUX_RECEIVE_STATE_DATA) {
+			i += modem_cmux_process_received_data(cmux, &buf[i], (uint16_t)ret - i);
+			if (i == (uint16_t)ret) {
+				break;
+			}
+		}
+
 		modem_cmux_process_received_byte(cmux, buf[i]);
+		i++;
 	}
 
 	/* Reschedule received work */
@@ -772,6 +815,7 @@ static void modem_cmux_transmit_handler(struct k_work *item)
 	struct modem_cmux *cmux = CONTAINER_OF(dwork, struct modem_cmux, transmit_work);
 	uint8_t *reserved;
 	uint32_t reserved_size;
+	bool transmit_rb_empty;
 	int ret;
 
 	k_mutex_lock(&cmux->transmit_rb_lock, K_FOREVER);
@@ -784,7 +828,14 @@ static void modem_cmux_transmit_handler(struct k_work *item)
 	if (ret < 1) {
 		ring_buf_get_finish(&cmux->transmit_rb, 0);
 		k_mutex_unlock(&cmux->transmit_rb_lock);
-		k_work_schedule(&cmux->transmit_work, K_NO_WAIT);
+
+		/*
+		 * The bus is busy, frames queued meanwhile are sent together
+		 * once it notifies that it is idle.
+		 */
+		if (ret < 0) {
+			k_work_schedule(&cmux->transmit_work, K_NO_WAIT);
+		}
 
 		return;
 	}
@@ -793,11 +844,16 @@ static void modem_cmux_transmit_handler(struct k_work *item)
 	ring_buf_get_finish(&cmux->transmit_rb, ret);
 
 	/* Resubmit transmit work if data remains */
-	if (ring_buf_is_empty(&cmux->transmit_rb) == false) {
+	transmit_rb_empty = ring_buf_is_empty(&cmux->transmit_rb);
+	if (transmit_rb_empty == false) {
 		k_work_schedule(&cmux->transmit_work, K_NO_WAIT);
 	}
 
 	k_mutex_unlock(&cmux->transmit_rb_lock);
+
+	if (transmit_rb_empty) {
+		modem_cmux_dlci_notify_transmit_idle(cmux);
+	}
 }
 
 static void modem_cmux_connect_handler(struct k_work *item)
@@ -211,3 +211,14 @@ void modem_pipe_notify_receive_ready(struct modem_pipe *pipe)
 
 	k_mutex_unlock(&pipe->lock);
 }
+
+void modem_pipe_notify_transmit_idle(struct modem_pipe *pipe)
+{
+	k_mutex_lock(&pipe->lock, K_FOREVER);
+
+	if (pipe->callback != NULL) {
+		pipe->callback(pipe, MODEM_PIPE_EVENT_TRANSMIT_IDLE, pipe->user_data);
+	}
+
+	k_mutex_unlock(&pipe->lock);
+}
@@ -19,6 +19,8 @@ LOG_MODULE_REGISTER(modem_ppp, CONFIG_MODEM_MODULES_LOG_LEVEL);
 #define MODEM_PPP_CODE_ESCAPE		(0x7D)
 #define MODEM_PPP_VALUE_ESCAPE		(0x20)
 
+#define MODEM_PPP_WRAP_CHUNK_SIZE	(32)
+
 static uint16_t modem_ppp_fcs_init(uint8_t byte)
 {
 	return crc16_ccitt(0xFFFF, &byte, 1);
@@ -48,6 +50,12 @@ static uint16_t modem_ppp_ppp_protocol(struct net_pkt *pkt)
 	return 0;
 }
 
+static bool modem_ppp_needs_escape(uint8_t byte)
+{
+	return (byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
+	       (byte < MODEM_PPP_VALUE_ESCAPE);
+}
+
 static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 {
 	uint8_t byte;
@@ -88,8 +96,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		byte = (ppp->tx_pkt_protocol >> 8) & 0xFF;
 		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_needs_escape(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_PROTOCOL_HIGH;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -106,8 +113,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		byte = ppp->tx_pkt_protocol & 0xFF;
 		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_needs_escape(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_PROTOCOL_LOW;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -125,8 +131,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		net_pkt_read_u8(ppp->tx_pkt, &byte);
 		ppp->tx_pkt_fcs = modem_ppp_fcs_update(ppp->tx_pkt_fcs, byte);
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_needs_escape(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_DATA;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -152,8 +157,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 		ppp->tx_pkt_fcs = modem_ppp_fcs_final(ppp->tx_pkt_fcs);
 		byte = ppp->tx_pkt_fcs & 0xFF;
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_needs_escape(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_FCS_LOW;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -169,8 +173,7 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 	case MODEM_PPP_TRANSMIT_STATE_FCS_HIGH:
 		byte = (ppp->tx_pkt_fcs >> 8) & 0xFF;
 
-		if ((byte == MODEM_PPP_CODE_DELIMITER) || (byte == MODEM_PPP_CODE_ESCAPE) ||
-		    (byte < MODEM_PPP_VALUE_ESCAPE)) {
+		if (modem_ppp_needs_escape(byte)) {
 			ppp->tx_pkt_escaped = byte ^ MODEM_PPP_VALUE_ESCAPE;
 			ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_ESCAPING_FCS_HIGH;
 			return MODEM_PPP_CODE_ESCAPE;
@@ -192,6 +195,88 @@ static uint8_t modem_ppp_wrap_net_pkt_byte(struct modem_ppp *ppp)
 	return 0;
 }
 
+/*
+ * Wrap as much of the packet data as fits in the contiguous space of the transmit ring
+ * buffer, escaping it in a single pass. Returns the number of bytes of data wrapped.
+ */
+static size_t modem_ppp_wrap_net_pkt_data(struct modem_ppp *ppp)
+{
+	uint8_t chunk[MODEM_PPP_WRAP_CHUNK_SIZE];
+	uint8_t *reserved;
+	uint32_t reserved_size;
+	uint32_t wrapped = 0;
+	size_t len;
+
+	reserved_size = ring_buf_put_claim(&ppp->transmit_rb, &reserved, UINT32_MAX);
+
+	/* Each byte takes two bytes when escaped */
+	len = MIN(net_pkt_remaining_data(ppp->tx_pkt), MIN(sizeof(chunk), reserved_size / 2));
+	if ((len == 0) || (net_pkt_read(ppp->tx_pkt, chunk, len) < 0)) {
+		ring_buf_put_finish(&ppp->transmit_rb, 0);
+		return 0;
+	}
+
+	ppp->tx_pkt_fcs = crc16_ccitt(ppp->tx_pkt_fcs, chunk, len);
+
+	for (size_t i = 0; i < len; i++) {
+		if (modem_ppp_needs_escape(chunk[i])) {
+			reserved[wrapped++] = MODEM_PPP_CODE_ESCAPE;
+			reserved[wrapped++] = chunk[i] ^ MODEM_PPP_VALUE_ESCAPE;
+		} else {
+			reserved[wrapped++] = chunk[i];
+		}
+	}
+
+	ring_buf_put_finish(&ppp->transmit_rb, wrapped);
+
+	if (net_pkt_remaining_data(ppp->tx_pkt) == 0) {
+		ppp->transmit_state = MODEM_PPP_TRANSMIT_STATE_FCS_LOW;
+	}
+
+	return len;
+}
+
+/*
+ * Write the received bytes up to the next delimiter or escape byte to the packet at
+ * once. Returns the number of bytes consumed, 0 to let the byte state machine handle
+ * the next byte.
+ */
+static size_t modem_ppp_process_received_data(struct modem_ppp *ppp, const uint8_t *data,
+					      size_t len)
+{
+	size_t available;
+	size_t run;
+
+	for (run = 0; run < len; run++) {
+		if ((data[run] == MODEM_PPP_CODE_DELIMITER) || (data[run] == MODEM_PPP_CODE_ESCAPE)) {
+			break;
+		}
+	}
+
+	/* Keep a byte of the buffer available, as the byte state machine does */
+	available = net_pkt_available_buffer(ppp->rx_pkt);
+	if (available < 2) {
+		return 0;
+	}
+
+	run = MIN(run, available - 1);
+	if (run == 0) {
+		return 0;
+	}
+
+	if (net_pkt_write(ppp->rx_pkt, data, run) < 0) {
+		LOG_WRN("Dropped PPP frame");
+		net_pkt_unref(ppp->rx_pkt);
+		ppp->rx_pkt = NULL;
+		ppp->receive_state = MODEM_PPP_RECEIVE_STATE_HDR_SOF;
+#if defined(CONFIG_NET_STATISTICS_PPP)
+		ppp->stats.drop++;
+#endif
+	}
+
+	return run;
+}
+
 static void modem_ppp_process_received_byte(struct modem_ppp *ppp, uint8_t byte)
 {
 	switch (ppp->receive_state) {
@@ -314,8 +399,17 @@ static void modem_ppp_pipe_callback(struct modem_pipe *pipe, enum modem_pipe_eve
 {
 	struct modem_ppp *ppp = (struct modem_ppp *)user_data;
 
-	if (event == MODEM_PIPE_EVENT_RECEIVE_READY) {
+	switch (event) {
+	case MODEM_PIPE_EVENT_RECEIVE_READY:
 		k_work_submit(&ppp->process_work);
+		break;
+
+	case MODEM_PIPE_EVENT_TRANSMIT_IDLE:
+		k_work_submit(&ppp->send_work);
+		break;
+
+	default:
+		break;
 	}
 }
 
@@ -339,6 +433,11 @@ static void modem_ppp_send_handler(struct k_work *item)
 
 		/* Fill transmit ring buffer */
 		while (ring_buf_space_get(&ppp->transmit_rb) > 0) {
+			if ((ppp->transmit_state == MODEM_PPP_TRANSMIT_STATE_DATA) &&
+			    (modem_ppp_wrap_net_pkt_data(ppp) > 0)) {
+				continue;
+			}
+
 			byte = modem_ppp_wrap_net_pkt_byte(ppp);
 
 			ring_buf_put(&ppp->transmit_rb, &byte, 1);
@@ -358,6 +457,12 @@ static void modem_ppp_send_handler(struct k_work *item)
 	}
 
 	ret = modem_pipe_transmit(ppp->pipe, reserved, reserved_size);
+	if (ret == 0) {
+		/* Resubmitted once the pipe notifies that it is idle */
+		ring_buf_get_finish(&ppp->transmit_rb, 0);
+		return;
+	}
+
 	if (ret < 0) {
 		ring_buf_get_finish(&ppp->transmit_rb, 0);
 	} else {
@@ -381,6 +486,13 @@ static void modem_ppp_process_handler(struct k_work *item)
 	}
 
 	for (int i = 0; i < ret; i++) {
+		if (ppp->receive_state == MODEM_PPP_RECEIVE_STATE_WRITING) {
+			i += modem_ppp_process_received_data(ppp, &ppp->receive_buf[i], ret - i);
+			if (i == ret) {
+				break;
+			}
+		}
+
 		modem_ppp_process_received_byte(ppp, ppp->receive_buf[i]);
 	}
 
@@ -232,6 +232,40 @@ static void data_unref(struct net_buf *buf, uint8_t *data)
 	pool->alloc->cb->unref(buf, data);
 }
 
+/* Set up a buffer taken from the pool, it is given back on failure */
+static bool buf_setup(struct net_buf_pool *pool, struct net_buf *buf,
+		      size_t size, k_timeout_t timeout)
+{
+	if (size) {
+#if __ASSERT_ON
+		size_t req_size = size;
+#endif
+		buf->__buf = data_alloc(buf, &size, timeout);
+		if (!buf->__buf) {
+			net_buf_destroy(buf);
+			return false;
+		}
+
+#if __ASSERT_ON
+		NET_BUF_ASSERT(req_size <= size);
+#endif
+	} else {
+		buf->__buf = NULL;
+	}
+
+	buf->ref   = 1U;
+	buf->flags = 0U;
+	buf->frags = NULL;
+	buf->size  = size;
+	net_buf_reset(buf);
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	atomic_dec(&pool->avail_count);
+	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
+#endif
+	return true;
+}
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf *net_buf_alloc_len_debug(struct net_buf_pool *pool, size_t size,
 					k_timeout_t timeout, const char *func,
@@ -318,36 +352,11 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 success:
 	NET_BUF_DBG("allocated buf %p", buf);
 
-	if (size) {
-#if __ASSERT_ON
-		size_t req_size = size;
-#endif
-		timeout = sys_timepoint_timeout(end);
-		buf->__buf = data_alloc(buf, &size, timeout);
-		if (!buf->__buf) {
-			NET_BUF_ERR("%s():%d: Failed to allocate data",
-				    func, line);
-			net_buf_destroy(buf);
-			return NULL;
-		}
-
-#if __ASSERT_ON
-		NET_BUF_ASSERT(req_size <= size);
-#endif
-	} else {
-		buf->__buf = NULL;
+	if (!buf_setup(pool, buf, size, sys_timepoint_timeout(end))) {
+		NET_BUF_ERR("%s():%d: Failed to allocate data", func, line);
+		return NULL;
 	}
 
-	buf->ref   = 1U;
-	buf->flags = 0U;
-	buf->frags = NULL;
-	buf->size  = size;
-	net_buf_reset(buf);
-
-#if defined(CONFIG_NET_BUF_POOL_USAGE)
-	atomic_dec(&pool->avail_count);
-	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
-#endif
 	return buf;
 }
 
@@ -371,6 +380,71 @@ struct net_buf *net_buf_alloc_fixed(struct net_buf_pool *pool,
 }
 #endif
 
+#if defined(CONFIG_NET_BUF_LOG)
+struct net_buf *net_buf_alloc_bulk_debug(struct net_buf_pool *pool,
+					 size_t count, k_timeout_t timeout,
+					 const char *func, int line)
+#else
+struct net_buf *net_buf_alloc_bulk(struct net_buf_pool *pool, size_t count,
+				   k_timeout_t timeout)
+#endif
+{
+	const struct net_buf_pool_fixed *fixed = pool->alloc->alloc_data;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct net_buf *first = NULL;
+	struct net_buf *last = NULL;
+	struct net_buf *buf;
+	k_spinlock_key_t key;
+	uint16_t uninit_count;
+	size_t uninit_taken;
+
+	__ASSERT_NO_MSG(pool);
+	__ASSERT_NO_MSG(count > 0);
+
+	NET_BUF_DBG("%s():%d: pool %p count %zu", func, line, pool, count);
+
+	/* Take all the uninitialized buffers needed at once */
+	key = k_spin_lock(&pool->lock);
+	uninit_count = pool->uninit_count;
+	uninit_taken = MIN(count, uninit_count);
+	pool->uninit_count -= uninit_taken;
+	k_spin_unlock(&pool->lock, key);
+
+	for (size_t i = 0; i < count; i++) {
+		if (i < uninit_taken) {
+			/* Fixed size data is never missing */
+			buf = pool_get_uninit(pool, uninit_count - i);
+			(void)buf_setup(pool, buf, fixed->data_size, K_NO_WAIT);
+		} else {
+#if defined(CONFIG_NET_BUF_LOG)
+			buf = net_buf_alloc_len_debug(pool, fixed->data_size,
+						      sys_timepoint_timeout(end),
+						      func, line);
+#else
+			buf = net_buf_alloc_len(pool, fixed->data_size,
+						sys_timepoint_timeout(end));
+#endif
+			if (!buf) {
+				if (first) {
+					net_buf_unref(first);
+				}
+
+				return NULL;
+			}
+		}
+
+		if (last) {
+			last->frags = buf;
+		} else {
+			first = buf;
+		}
+
+		last = buf;
+	}
+
+	return first;
+}
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf *net_buf_alloc_with_data_debug(struct net_buf_pool *pool,
 					      void *data, size_t size,
@@ -464,8 +538,13 @@ void net_buf_unref_debug(struct net_buf *buf, const char *func, int line)
 void net_buf_unref(struct net_buf *buf)
 #endif
 {
+	struct net_buf_pool *free_pool = NULL;
+	sys_slist_t free_list;
+
 	__ASSERT_NO_MSG(buf);
 
+	sys_slist_init(&free_list);
+
 	while (buf) {
 		struct net_buf *frags = buf->frags;
 		struct net_buf_pool *pool;
@@ -474,14 +553,14 @@ void net_buf_unref(struct net_buf *buf)
 		if (!buf->ref) {
 			NET_BUF_ERR("%s():%d: buf %p double free", func, line,
 				    buf);
-			return;
+			break;
 		}
 #endif
 		NET_BUF_DBG("buf %p ref %u pool_id %u frags %p", buf, buf->ref,
 			    buf->pool_id, buf->frags);
 
 		if (--buf->ref > 0) {
-			return;
+			break;
 		}
 
 		if (buf->__buf) {
@@ -502,11 +581,25 @@ void net_buf_unref(struct net_buf *buf)
 		if (pool->destroy) {
 			pool->destroy(buf);
 		} else {
-			net_buf_destroy(buf);
+			/* Fragments of a chain are given back in one go */
+			if (pool != free_pool) {
+				if (free_pool) {
+					(void)k_queue_merge_slist(&free_pool->free._queue,
+								  &free_list);
+				}
+
+				free_pool = pool;
+			}
+
+			sys_slist_append(&free_list, &buf->node);
 		}
 
 		buf = frags;
 	}
+
+	if (free_pool) {
+		(void)k_queue_merge_slist(&free_pool->free._queue, &free_list);
+	}
 }
 
 struct net_buf *net_buf_ref(struct net_buf *buf)
@@ -144,6 +144,9 @@ static void conn_mgr_mon_handle_update(void)
 		} else if (original_ready_count == 0) {
 			/* We just gained connectivity */
 			net_mgmt_event_notify(NET_EVENT_L4_CONNECTED, last_iface_up);
+#if defined(CONFIG_INIT_TIME_REPORT)
+			sys_init_report_milestone("network up");
+#endif
 		}
 	}
 
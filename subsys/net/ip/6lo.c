@@ -1389,7 +1389,18 @@ static bool uncompress_IPHC_header(struct net_pkt *pkt)
 		return false;
 	}
 
-	if (net_buf_tailroom(pkt->buffer) >= diff) {
+	if (net_buf_headroom(pkt->buffer) >= diff) {
+		/* Uncompress in front of the payload, which stays in place.
+		 * The uncompressed header ends where the compressed one does,
+		 * and no field after the context identifier is shorter once
+		 * uncompressed, so no inline byte is overwritten before being
+		 * read.
+		 */
+		NET_DBG("Enough headroom. Uncompress inplace");
+		frag = pkt->buffer;
+		cursor = frag->data;
+		net_buf_push(frag, diff);
+	} else if (net_buf_tailroom(pkt->buffer) >= diff) {
 		NET_DBG("Enough tailroom. Uncompress inplace");
 		frag = pkt->buffer;
 		net_buf_add(frag, diff);
@@ -59,10 +59,126 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #define NET_CONN_RANK(_flags)		(_flags & 0x78)
 
+/** All of the local and remote address and port specified */
+#define NET_CONN_RANK_EXACT		0x78
+
 static struct net_conn conns[CONFIG_NET_MAX_CONN];
 
 static sys_slist_t conn_unused;
-static sys_slist_t conn_used;
+
+/* Used connections are hashed to speed up net_conn_input(). Fully
+ * specified TCP and UDP connections, typically connected sockets, are
+ * hashed by their addresses and ports. Other TCP and UDP connections bound
+ * to a local port, typically listening sockets, are hashed by that port.
+ * The remaining connections are kept in a list of their own.
+ */
+#define CONN_HASH_SIZE			CONFIG_NET_CONN_HASH_SIZE
+#define CONN_LIST_UNHASHED		0
+#define CONN_LIST_PORT(_hash)		(1 + (_hash))
+#define CONN_LIST_EXACT(_hash)		(1 + CONN_HASH_SIZE + (_hash))
+#define CONN_LIST_COUNT			(1 + 2 * CONN_HASH_SIZE)
+
+static sys_slist_t conn_lists[CONN_LIST_COUNT];
+
+/* Walks the unhashed connections, then the ones in lists first to last */
+struct conn_iter {
+	sys_snode_t *node;
+	int list;
+	int first;
+	int last;
+};
+
+static struct net_conn *conn_iter_next(struct conn_iter *iter)
+{
+	if (iter->node != NULL) {
+		iter->node = sys_slist_peek_next(iter->node);
+	}
+
+	while (iter->node == NULL && iter->list < iter->last) {
+		iter->list = MAX(iter->list + 1, iter->first);
+		iter->node = sys_slist_peek_head(&conn_lists[iter->list]);
+	}
+
+	return iter->node != NULL ?
+		CONTAINER_OF(iter->node, struct net_conn, node) : NULL;
+}
+
+static struct net_conn *conn_iter_start(struct conn_iter *iter,
+					int first, int last)
+{
+	iter->node = sys_slist_peek_head(&conn_lists[CONN_LIST_UNHASHED]);
+	iter->list = CONN_LIST_UNHASHED;
+	iter->first = first;
+	iter->last = last;
+
+	return iter->node != NULL ?
+		CONTAINER_OF(iter->node, struct net_conn, node) :
+		conn_iter_next(iter);
+}
+
+#define CONN_FOR_EACH(_iter, _conn)					\
+	for (_conn = conn_iter_start(_iter, CONN_LIST_UNHASHED + 1,	\
+				     CONN_LIST_COUNT - 1);		\
+	     _conn != NULL; _conn = conn_iter_next(_iter))
+
+static inline uint32_t conn_hash(uint32_t key)
+{
+	/* Multiplicative hashing, the upper bits are the best mixed */
+	return ((key * 0x9e3779b1U) >> 16) % CONN_HASH_SIZE;
+}
+
+/* Ports are in network byte order */
+static inline int conn_port_list(uint16_t proto, uint16_t local_port)
+{
+	return CONN_LIST_PORT(conn_hash((uint32_t)proto << 16 | local_port));
+}
+
+static inline int conn_exact_list(uint16_t proto, uint16_t local_port,
+				  uint16_t remote_port, uint32_t remote_addr)
+{
+	return CONN_LIST_EXACT(conn_hash(remote_addr ^ proto ^
+					 ((uint32_t)local_port << 16 | remote_port)));
+}
+
+static uint32_t conn_remote_addr_key(const struct sockaddr *addr)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && addr->sa_family == AF_INET6) {
+		return net_sin6(addr)->sin6_addr.s6_addr32[3];
+	}
+
+	return net_sin(addr)->sin_addr.s_addr;
+}
+
+static uint32_t conn_pkt_remote_addr_key(struct net_pkt *pkt,
+					 union net_ip_header *ip_hdr)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		return UNALIGNED_GET((uint32_t *)&ip_hdr->ipv6->src[12]);
+	}
+
+	return UNALIGNED_GET((uint32_t *)ip_hdr->ipv4->src);
+}
+
+/* Find the list a connection belongs to, from its registered tuple */
+static int conn_list_get(struct net_conn *conn)
+{
+	if (!((IS_ENABLED(CONFIG_NET_UDP) && conn->proto == IPPROTO_UDP) ||
+	      (IS_ENABLED(CONFIG_NET_TCP) && conn->proto == IPPROTO_TCP)) ||
+	    !((IS_ENABLED(CONFIG_NET_IPV4) && conn->family == AF_INET) ||
+	      (IS_ENABLED(CONFIG_NET_IPV6) && conn->family == AF_INET6)) ||
+	    !(conn->flags & NET_CONN_LOCAL_PORT_SPEC)) {
+		return CONN_LIST_UNHASHED;
+	}
+
+	if (NET_CONN_RANK(conn->flags) == NET_CONN_RANK_EXACT) {
+		return conn_exact_list(conn->proto,
+				       net_sin(&conn->local_addr)->sin_port,
+				       net_sin(&conn->remote_addr)->sin_port,
+				       conn_remote_addr_key(&conn->remote_addr));
+	}
+
+	return conn_port_list(conn->proto, net_sin(&conn->local_addr)->sin_port);
+}
 
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
@@ -140,7 +256,7 @@ static void conn_set_used(struct net_conn *conn)
 	conn->flags |= NET_CONN_IN_USE;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
-	sys_slist_prepend(&conn_used, &conn->node);
+	sys_slist_prepend(&conn_lists[conn_list_get(conn)], &conn->node);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -161,12 +277,12 @@ static struct net_conn *conn_find_handler(uint16_t proto, uint8_t family,
 					  uint16_t local_port,
 					  bool reuseport_set)
 {
+	struct conn_iter iter;
 	struct net_conn *conn;
-	struct net_conn *tmp;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&conn_used, conn, tmp, node) {
+	CONN_FOR_EACH(&iter, conn) {
 		if (conn->proto != proto) {
 			continue;
 		}
@@ -405,7 +521,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 	NET_DBG("Connection handler %p removed", conn);
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
-	sys_slist_find_and_remove(&conn_used, &conn->node);
+	sys_slist_find_and_remove(&conn_lists[conn_list_get(conn)], &conn->node);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -576,6 +692,46 @@ static enum net_verdict conn_raw_socket(struct net_pkt *pkt,
 	return NET_OK;
 }
 
+/* Look up the connection registered for the exact addresses and ports of a
+ * TCP or UDP packet. Such a connection always is the best match.
+ */
+static struct net_conn *conn_find_exact(struct net_pkt *pkt,
+					union net_ip_header *ip_hdr,
+					uint8_t proto,
+					uint16_t src_port, uint16_t dst_port)
+{
+	int list = conn_exact_list(proto, dst_port, src_port,
+				   conn_pkt_remote_addr_key(pkt, ip_hdr));
+	struct net_conn *conn;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&conn_lists[list], conn, node) {
+		if (conn->proto != proto ||
+		    conn->family != net_pkt_family(pkt) ||
+		    net_sin(&conn->local_addr)->sin_port != dst_port ||
+		    net_sin(&conn->remote_addr)->sin_port != src_port) {
+			continue;
+		}
+
+		if (!conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true) ||
+		    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+			continue;
+		}
+
+		/* The tuple is unique, if the interface does not match then
+		 * a less specific connection might.
+		 */
+		if (conn->context != NULL &&
+		    net_context_is_bound_to_iface(conn->context) &&
+		    net_pkt_iface(pkt) != net_context_get_iface(conn->context)) {
+			return NULL;
+		}
+
+		return conn;
+	}
+
+	return NULL;
+}
+
 enum net_verdict net_conn_input(struct net_pkt *pkt,
 				union net_ip_header *ip_hdr,
 				uint8_t proto,
@@ -630,6 +786,9 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 	bool is_bcast_pkt = false;
 	bool raw_pkt_delivered = false;
 	bool raw_pkt_continue = false;
+	int first_list = CONN_LIST_UNHASHED + 1;
+	int last_list = CONN_LIST_COUNT - 1;
+	struct conn_iter iter;
 	struct net_conn *conn;
 
 	if (IS_ENABLED(CONFIG_NET_IP)) {
@@ -648,7 +807,24 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		}
 	}
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
+	/* A unicast TCP or UDP packet goes to the connection registered for
+	 * its exact tuple if there is one. Otherwise only the connections
+	 * bound to its destination port, or to no port at all, need to be
+	 * looked at. Everything else is matched against all connections.
+	 */
+	if (IS_ENABLED(CONFIG_NET_IP) && !is_mcast_pkt &&
+	    (pkt_family == AF_INET || pkt_family == AF_INET6) &&
+	    ((IS_ENABLED(CONFIG_NET_UDP) && proto == IPPROTO_UDP) ||
+	     (IS_ENABLED(CONFIG_NET_TCP) && proto == IPPROTO_TCP))) {
+		best_match = conn_find_exact(pkt, ip_hdr, proto, src_port, dst_port);
+
+		first_list = conn_port_list(proto, dst_port);
+		last_list = first_list;
+	}
+
+	for (conn = best_match != NULL ? NULL :
+		    conn_iter_start(&iter, first_list, last_list);
+	     conn != NULL; conn = conn_iter_next(&iter)) {
 		/* Is the candidate connection matching the packet's interface? */
 		if (conn->context != NULL &&
 		    net_context_is_bound_to_iface(conn->context) &&
@@ -876,11 +1052,12 @@ drop:
 
 void net_conn_foreach(net_conn_foreach_cb_t cb, void *user_data)
 {
+	struct conn_iter iter;
 	struct net_conn *conn;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
+	CONN_FOR_EACH(&iter, conn) {
 		cb(conn, user_data);
 	}
 
@@ -892,7 +1069,10 @@ void net_conn_init(void)
 	int i;
 
 	sys_slist_init(&conn_unused);
-	sys_slist_init(&conn_used);
+
+	for (i = 0; i < CONN_LIST_COUNT; i++) {
+		sys_slist_init(&conn_lists[i]);
+	}
 
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
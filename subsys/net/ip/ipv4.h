@@ -280,12 +280,27 @@ struct net_ipv4_reassembly {
 	 */
 	struct k_work_delayable timer;
 
-	/** Pointers to pending fragments */
+	/** Pointers to pending fragments, sorted by fragment offset */
 	struct net_pkt *pkt[CONFIG_NET_IPV4_FRAGMENT_MAX_PKT];
 
+	/** Node in the reassembly lookup hash or in the free slot list */
+	sys_snode_t node;
+
+	/** Number of payload bytes received so far */
+	uint32_t received;
+
+	/** Payload length of the packet, known once the last fragment is received */
+	uint32_t total_len;
+
+	/** Number of pending fragments */
+	uint16_t count;
+
 	/** IPv4 fragment identification */
 	uint16_t id;
 	uint8_t protocol;
+
+	/** Whether the last fragment has been received */
+	bool last;
 };
 #else
 struct net_ipv4_reassembly;
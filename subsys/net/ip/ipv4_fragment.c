@@ -31,83 +31,113 @@ static void reassembly_timeout(struct k_work *work);
 
 static struct net_ipv4_reassembly reassembly[CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT];
 
-static struct net_ipv4_reassembly *reassembly_get(uint16_t id, struct in_addr *src,
-						  struct in_addr *dst, uint8_t protocol)
+/* Reassembly slots in use are hashed by fragment identity, the others are
+ * kept in a free list so that neither lookup nor allocation has to scan
+ * all the slots.
+ */
+static sys_slist_t reassembly_hash[CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT];
+static sys_slist_t reassembly_free;
+
+/* Protects the slots, which are used by the RX thread and by the timeouts
+ * run from the system work queue.
+ */
+static K_MUTEX_DEFINE(reassembly_lock);
+
+static sys_slist_t *reassembly_bucket(uint16_t id, const struct in_addr *src,
+				      const struct in_addr *dst)
 {
-	int i, avail = -1;
+	uint32_t key = UNALIGNED_GET(&src->s_addr) ^ UNALIGNED_GET(&dst->s_addr) ^ id;
 
-	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
-		if (k_work_delayable_remaining_get(&reassembly[i].timer) &&
-		    reassembly[i].id == id &&
-		    net_ipv4_addr_cmp(src, &reassembly[i].src) &&
-		    net_ipv4_addr_cmp(dst, &reassembly[i].dst) &&
-		    reassembly[i].protocol == protocol) {
-			return &reassembly[i];
-		}
+	return &reassembly_hash[((key * 0x9e3779b1U) >> 16) %
+				CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT];
+}
 
-		if (k_work_delayable_remaining_get(&reassembly[i].timer)) {
-			continue;
-		}
+static inline unsigned int fragment_start(struct net_pkt *pkt)
+{
+	return net_pkt_ipv4_fragment_offset(pkt);
+}
 
-		if (avail < 0) {
-			avail = i;
+static inline unsigned int fragment_end(struct net_pkt *pkt)
+{
+	return net_pkt_ipv4_fragment_offset(pkt) +
+	       net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt);
+}
+
+static struct net_ipv4_reassembly *reassembly_get(uint16_t id, struct in_addr *src,
+						  struct in_addr *dst, uint8_t protocol)
+{
+	sys_slist_t *bucket = reassembly_bucket(id, src, dst);
+	struct net_ipv4_reassembly *reass;
+	sys_snode_t *node;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(bucket, reass, node) {
+		if (reass->id == id &&
+		    net_ipv4_addr_cmp(src, &reass->src) &&
+		    net_ipv4_addr_cmp(dst, &reass->dst) &&
+		    reass->protocol == protocol) {
+			return reass;
 		}
 	}
 
-	if (avail < 0) {
+	node = sys_slist_get(&reassembly_free);
+	if (!node) {
 		return NULL;
 	}
 
-	k_work_reschedule(&reassembly[avail].timer, K_SECONDS(CONFIG_NET_IPV4_FRAGMENT_TIMEOUT));
+	reass = CONTAINER_OF(node, struct net_ipv4_reassembly, node);
 
-	net_ipaddr_copy(&reassembly[avail].src, src);
-	net_ipaddr_copy(&reassembly[avail].dst, dst);
+	k_work_reschedule(&reass->timer, K_SECONDS(CONFIG_NET_IPV4_FRAGMENT_TIMEOUT));
 
-	reassembly[avail].protocol = protocol;
-	reassembly[avail].id = id;
+	net_ipaddr_copy(&reass->src, src);
+	net_ipaddr_copy(&reass->dst, dst);
 
-	return &reassembly[avail];
-}
-
-static bool reassembly_cancel(uint32_t id, struct in_addr *src, struct in_addr *dst)
-{
-	int i, j;
+	reass->protocol = protocol;
+	reass->id = id;
+	reass->count = 0U;
+	reass->received = 0U;
+	reass->total_len = 0U;
+	reass->last = false;
 
-	LOG_DBG("Cancel 0x%x", id);
+	sys_slist_prepend(bucket, &reass->node);
 
-	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
-		int32_t remaining;
+	return reass;
+}
 
-		if (reassembly[i].id != id ||
-		    !net_ipv4_addr_cmp(src, &reassembly[i].src) ||
-		    !net_ipv4_addr_cmp(dst, &reassembly[i].dst)) {
-			continue;
-		}
+static bool reassembly_cancel(struct net_ipv4_reassembly *reass)
+{
+	int32_t remaining;
+	int j;
 
-		remaining = k_ticks_to_ms_ceil32(
-			k_work_delayable_remaining_get(&reassembly[i].timer));
-		k_work_cancel_delayable(&reassembly[i].timer);
+	LOG_DBG("Cancel 0x%x", reass->id);
 
-		LOG_DBG("IPv4 reassembly id 0x%x remaining %d ms", reassembly[i].id, remaining);
+	if (!sys_slist_find_and_remove(reassembly_bucket(reass->id, &reass->src, &reass->dst),
+				       &reass->node)) {
+		return false;
+	}
 
-		reassembly[i].id = 0U;
+	remaining = k_ticks_to_ms_ceil32(k_work_delayable_remaining_get(&reass->timer));
+	k_work_cancel_delayable(&reass->timer);
 
-		for (j = 0; j < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; j++) {
-			if (!reassembly[i].pkt[j]) {
-				continue;
-			}
+	LOG_DBG("IPv4 reassembly id 0x%x remaining %d ms", reass->id, remaining);
 
-			LOG_DBG("[%d] IPv4 reassembly pkt %p %zd bytes data", j,
-				reassembly[i].pkt[j], net_pkt_get_len(reassembly[i].pkt[j]));
+	reass->id = 0U;
 
-			net_pkt_unref(reassembly[i].pkt[j]);
-			reassembly[i].pkt[j] = NULL;
+	for (j = 0; j < reass->count; j++) {
+		if (!reass->pkt[j]) {
+			continue;
 		}
 
-		return true;
+		LOG_DBG("[%d] IPv4 reassembly pkt %p %zd bytes data", j,
+			reass->pkt[j], net_pkt_get_len(reass->pkt[j]));
+
+		net_pkt_unref(reass->pkt[j]);
+		reass->pkt[j] = NULL;
 	}
 
-	return false;
+	reass->count = 0U;
+	sys_slist_append(&reassembly_free, &reass->node);
+
+	return true;
 }
 
 static void reassembly_info(char *str, struct net_ipv4_reassembly *reass)
@@ -125,15 +155,31 @@ static void reassembly_timeout(struct k_work *work)
 	struct net_ipv4_reassembly *reass =
 		CONTAINER_OF(dwork, struct net_ipv4_reassembly, timer);
 
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
+
+	/* Skip a slot reused while this work waited for the lock. A slot
+	 * released meanwhile holds no fragments and is not cancelled again.
+	 */
+	if (k_work_delayable_is_pending(dwork)) {
+		k_mutex_unlock(&reassembly_lock);
+		return;
+	}
+
 	reassembly_info("Reassembly cancelled", reass);
 
+	if (reass->pkt[0]) {
+		net_stats_update_ipv4_reassembly_timeout(net_pkt_iface(reass->pkt[0]));
+	}
+
 	/* Send a ICMPv4 Time Exceeded only if we received the first fragment */
 	if (reass->pkt[0] && net_pkt_ipv4_fragment_offset(reass->pkt[0]) == 0) {
 		net_icmpv4_send_error(reass->pkt[0], NET_ICMPV4_TIME_EXCEEDED,
 				      NET_ICMPV4_TIME_EXCEEDED_FRAGMENT_REASSEMBLY_TIME);
 	}
 
-	reassembly_cancel(reass->id, &reass->src, &reass->dst);
+	reassembly_cancel(reass);
+
+	k_mutex_unlock(&reassembly_lock);
 }
 
 static void reassemble_packet(struct net_ipv4_reassembly *reass)
@@ -150,19 +196,19 @@ static void reassemble_packet(struct net_ipv4_reassembly *reass)
 
 	last = net_buf_frag_last(reass->pkt[0]->buffer);
 
-	/* We start from 2nd packet which is then appended to the first one */
-	for (i = 1; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
+	/* We start from 2nd packet which is then appended to the first one. The
+	 * fragment buffers are chained as they are, no data is copied.
+	 */
+	for (i = 1; i < reass->count; i++) {
 		pkt = reass->pkt[i];
-		if (!pkt) {
-			break;
-		}
 
 		net_pkt_cursor_init(pkt);
 
 		/* Get rid of IPv4 header which is at the beginning of the fragment. */
 		ipv4_hdr = (struct net_ipv4_hdr *)net_pkt_get_data(pkt, &ipv4_access);
 		if (!ipv4_hdr) {
-			goto error;
+			LOG_ERR("Failed to access headers");
+			goto cancel;
 		}
 
 		LOG_DBG("Removing %d bytes from start of pkt %p", net_pkt_ip_hdr_len(pkt),
@@ -170,8 +216,7 @@ static void reassemble_packet(struct net_ipv4_reassembly *reass)
 
 		if (net_pkt_pull(pkt, net_pkt_ip_hdr_len(pkt))) {
 			LOG_ERR("Failed to pull headers");
-			reassembly_cancel(reass->id, &reass->src, &reass->dst);
-			return;
+			goto cancel;
 		}
 
 		/* Attach the data to the previous packet */
@@ -187,6 +232,9 @@ static void reassemble_packet(struct net_ipv4_reassembly *reass)
 	pkt = reass->pkt[0];
 	reass->pkt[0] = NULL;
 
+	/* All fragments are consumed, release the slot */
+	reassembly_cancel(reass);
+
 	/* Update the header details for the packet */
 	net_pkt_cursor_init(pkt);
 
@@ -206,6 +254,8 @@ static void reassemble_packet(struct net_ipv4_reassembly *reass)
 
 	LOG_DBG("New pkt %p IPv4 len is %d bytes", pkt, net_pkt_get_len(pkt));
 
+	net_stats_update_ipv4_reassembly_done(net_pkt_iface(pkt));
+
 	/* We need to use the queue when feeding the packet back into the
 	 * IP stack as we might run out of stack if we call processing_data()
 	 * directly. As the packet does not contain link layer header, we
@@ -218,12 +268,19 @@ static void reassemble_packet(struct net_ipv4_reassembly *reass)
 
 error:
 	net_pkt_unref(pkt);
+	return;
+
+cancel:
+	net_stats_update_ipv4_reassembly_drop(net_pkt_iface(reass->pkt[0]));
+	reassembly_cancel(reass);
 }
 
 void net_ipv4_frag_foreach(net_ipv4_frag_cb_t cb, void *user_data)
 {
 	int i;
 
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
+
 	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
 		if (!k_work_delayable_remaining_get(&reassembly[i].timer)) {
 			continue;
@@ -231,108 +288,91 @@ void net_ipv4_frag_foreach(net_ipv4_frag_cb_t cb, void *user_data)
 
 		cb(&reassembly[i], user_data);
 	}
+
+	k_mutex_unlock(&reassembly_lock);
 }
 
-/* Verify that we have all the fragments received and in correct order.
+/* Store the fragment in offset order. The fragments stored so far never
+ * overlap, so the received fragments cover the whole packet once as many
+ * bytes as announced by the last fragment are received.
  * Return:
- * - a negative value if the fragments are erroneous and must be dropped
- * - zero if we are expecting more fragments
- * - a positive value if we can proceed with the reassembly
+ * - -ENOMEM if there is no room left for the fragment
+ * - -EBADMSG if the fragment is erroneous and the packet must be dropped
+ * - zero if the fragment was stored
  */
-static int fragments_are_ready(struct net_ipv4_reassembly *reass)
+static int fragment_insert(struct net_ipv4_reassembly *reass, struct net_pkt *pkt)
 {
-	unsigned int expected_offset = 0;
-	bool more = true;
-	int i;
+	unsigned int start = fragment_start(pkt);
+	unsigned int end;
+	int lo = 0, hi = reass->count;
 
-	/* Fragments can arrive in any order, for example in reverse order:
-	 *   1 -> Fragment3(M=0, offset=x2)
-	 *   2 -> Fragment2(M=1, offset=x1)
-	 *   3 -> Fragment1(M=1, offset=0)
-	 * We have to test several requirements before proceeding with the reassembly:
-	 * - We received the first fragment (Fragment Offset is 0)
-	 * - All intermediate fragments are contiguous
-	 * - The More bit of the last fragment is 0
-	 */
-	for (i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
-		struct net_pkt *pkt = reass->pkt[i];
-		unsigned int offset;
-		int payload_len;
+	if (net_pkt_get_len(pkt) < net_pkt_ip_hdr_len(pkt)) {
+		return -EBADMSG;
+	}
 
-		if (!pkt) {
-			break;
-		}
+	if (reass->count == CONFIG_NET_IPV4_FRAGMENT_MAX_PKT) {
+		return -ENOMEM;
+	}
 
-		offset = net_pkt_ipv4_fragment_offset(pkt);
+	end = fragment_end(pkt);
 
-		if (offset < expected_offset) {
-			/* Overlapping or duplicated, drop it */
-			return -EBADMSG;
-		} else if (offset != expected_offset) {
-			/* Not contiguous, let's wait for fragments */
-			return 0;
-		}
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
 
-		payload_len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt);
-
-		if (payload_len < 0) {
-			return -EBADMSG;
+		if (fragment_start(reass->pkt[mid]) < start) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
 		}
-
-		expected_offset += payload_len;
-		more = net_pkt_ipv4_fragment_more(pkt);
 	}
 
-	if (more) {
-		return 0;
+	/* Overlapping or duplicated, drop it */
+	if ((lo > 0 && fragment_end(reass->pkt[lo - 1]) > start) ||
+	    (lo < reass->count && fragment_start(reass->pkt[lo]) < end)) {
+		return -EBADMSG;
 	}
 
-	return 1;
-}
-
-static int shift_packets(struct net_ipv4_reassembly *reass, int pos)
-{
-	int i;
-
-	for (i = pos + 1; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
-		if (!reass->pkt[i]) {
-			LOG_DBG("Moving [%d] %p (offset 0x%x) to [%d]", pos, reass->pkt[pos],
-				net_pkt_ipv4_fragment_offset(reass->pkt[pos]), pos + 1);
+	if (!net_pkt_ipv4_fragment_more(pkt)) {
+		/* Nothing may follow the last fragment */
+		if (reass->last || lo < reass->count) {
+			return -EBADMSG;
+		}
 
-			/* pkt[i] is free, so shift everything between [pos] and [i - 1] by one
-			 * element
-			 */
-			memmove(&reass->pkt[pos + 1], &reass->pkt[pos],
-				sizeof(void *) * (i - pos));
+		reass->last = true;
+		reass->total_len = end;
+	} else if (reass->last && end > reass->total_len) {
+		return -EBADMSG;
+	}
 
-			/* pkt[pos] is now free */
-			reass->pkt[pos] = NULL;
+	LOG_DBG("Storing pkt %p to slot %d offset %d", pkt, lo, start);
 
-			return 0;
-		}
-	}
+	memmove(&reass->pkt[lo + 1], &reass->pkt[lo],
+		sizeof(void *) * (reass->count - lo));
+	reass->pkt[lo] = pkt;
+	reass->count++;
+	reass->received += end - start;
 
-	/* We do not have free space left in the array */
-	return -ENOMEM;
+	return 0;
 }
 
-enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt, struct net_ipv4_hdr *hdr)
+static enum net_verdict handle_fragment_hdr(struct net_pkt *pkt, struct net_ipv4_hdr *hdr)
 {
 	struct net_ipv4_reassembly *reass = NULL;
 	uint16_t flag;
-	bool found;
 	uint8_t more;
 	uint16_t id;
 	int ret;
-	int i;
 
 	flag = ntohs(*((uint16_t *)&hdr->offset));
 	id = ntohs(*((uint16_t *)&hdr->id));
 
+	net_stats_update_ipv4_reassembly_fragment(net_pkt_iface(pkt));
+
 	reass = reassembly_get(id, (struct in_addr *)hdr->src,
 			       (struct in_addr *)hdr->dst, hdr->proto);
 	if (!reass) {
 		LOG_ERR("Cannot get reassembly slot, dropping pkt %p", pkt);
+		net_stats_update_ipv4_reassembly_drop(net_pkt_iface(pkt));
 		goto drop;
 	}
 
@@ -345,56 +385,30 @@ enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt, struct net_ip
 		 */
 		net_icmpv4_send_error(pkt, NET_ICMPV4_BAD_IP_HEADER,
 				      NET_ICMPV4_BAD_IP_HEADER_LENGTH);
+		net_stats_update_ipv4_reassembly_drop(net_pkt_iface(pkt));
 		goto drop;
 	}
 
 	/* The fragments might come in wrong order so place them in the reassembly chain in the
 	 * correct order.
 	 */
-	for (i = 0, found = false; i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT; i++) {
-		if (reass->pkt[i]) {
-			if (net_pkt_ipv4_fragment_offset(reass->pkt[i]) <
-			    net_pkt_ipv4_fragment_offset(pkt)) {
-				continue;
-			}
-
-			/* Make room for this fragment. If there is no room then it will discard
-			 * the whole reassembly.
-			 */
-			if (shift_packets(reass, i)) {
-				break;
-			}
-		}
-
-		LOG_DBG("Storing pkt %p to slot %d offset %d", pkt, i,
-			net_pkt_ipv4_fragment_offset(pkt));
-		reass->pkt[i] = pkt;
-		found = true;
-
-		break;
-	}
-
-	if (!found) {
+	ret = fragment_insert(reass, pkt);
+	if (ret == -ENOMEM) {
 		/* We could not add this fragment into our saved fragment list. The whole packet
 		 * must be discarded at this point.
 		 */
 		LOG_ERR("No slots available for 0x%x", reass->id);
-		net_pkt_unref(pkt);
-		goto drop;
+	} else if (ret < 0) {
+		LOG_ERR("Reassembled IPv4 verify failed, dropping id %u", reass->id);
 	}
 
-	ret = fragments_are_ready(reass);
 	if (ret < 0) {
-		LOG_ERR("Reassembled IPv4 verify failed, dropping id %u", reass->id);
-
-		/* Let the caller release the already inserted pkt */
-		if (i < CONFIG_NET_IPV4_FRAGMENT_MAX_PKT) {
-			reass->pkt[i] = NULL;
-		}
-
+		net_stats_update_ipv4_reassembly_drop(net_pkt_iface(pkt));
 		net_pkt_unref(pkt);
 		goto drop;
-	} else if (ret == 0) {
+	}
+
+	if (!reass->last || reass->received != reass->total_len) {
 		reassembly_info("Reassembly nth pkt", reass);
 
 		LOG_DBG("More fragments to be received");
@@ -411,7 +425,7 @@ accept:
 
 drop:
 	if (reass) {
-		if (reassembly_cancel(reass->id, &reass->src, &reass->dst)) {
+		if (reassembly_cancel(reass)) {
 			return NET_OK;
 		}
 	}
@@ -419,6 +433,17 @@ drop:
 	return NET_DROP;
 }
 
+enum net_verdict net_ipv4_handle_fragment_hdr(struct net_pkt *pkt, struct net_ipv4_hdr *hdr)
+{
+	enum net_verdict verdict;
+
+	k_mutex_lock(&reassembly_lock, K_FOREVER);
+	verdict = handle_fragment_hdr(pkt, hdr);
+	k_mutex_unlock(&reassembly_lock);
+
+	return verdict;
+}
+
 static int send_ipv4_fragment(struct net_pkt *pkt, uint16_t rand_id, uint16_t fit_len,
 			      uint16_t frag_offset, bool final)
 {
@@ -587,9 +612,10 @@ enum net_verdict net_ipv4_prepare_for_send(struct net_pkt *pkt)
 	}
 
 	/* If we have already fragmented the packet, the ID field will contain a non-zero value
-	 * and we can skip other checks.
+	 * and we can skip other checks. TCP packets larger than the MTU that are segmented
+	 * below the IP layer are not fragmented either.
 	 */
-	if (ip_hdr->id[0] == 0 && ip_hdr->id[1] == 0) {
+	if (ip_hdr->id[0] == 0 && ip_hdr->id[1] == 0 && net_pkt_gso_size(pkt) == 0U) {
 		uint16_t mtu = net_if_get_mtu(net_pkt_iface(pkt));
 		size_t pkt_len = net_pkt_get_len(pkt);
 
@@ -635,5 +661,6 @@ void net_ipv4_setup_fragment_buffers(void)
 	 */
 	for (int i = 0; i < CONFIG_NET_IPV4_FRAGMENT_MAX_COUNT; i++) {
 		k_work_init_delayable(&reassembly[i].timer, reassembly_timeout);
+		sys_slist_append(&reassembly_free, &reassembly[i].node);
 	}
 }
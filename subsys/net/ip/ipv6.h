@@ -417,11 +417,26 @@ struct net_ipv6_reassembly {
 	 */
 	struct k_work_delayable timer;
 
-	/** Pointers to pending fragments */
+	/** Pointers to pending fragments, sorted by fragment offset */
 	struct net_pkt *pkt[CONFIG_NET_IPV6_FRAGMENT_MAX_PKT];
 
+	/** Node in the reassembly lookup hash or in the free slot list */
+	sys_snode_t node;
+
+	/** Number of payload bytes received so far */
+	uint32_t received;
+
+	/** Payload length of the packet, known once the last fragment is received */
+	uint32_t total_len;
+
 	/** IPv6 fragment identification */
 	uint32_t id;
+
+	/** Number of pending fragments */
+	uint16_t count;
+
+	/** Whether the last fragment has been received */
+	bool last;
 };
 #else
 struct net_ipv6_reassembly;
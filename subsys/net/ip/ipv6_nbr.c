@@ -256,13 +256,63 @@ void nbr_print(void)
 #define nbr_print(...)
 #endif
 
+/* Neighbors are chained by their IPv6 address into hash buckets so that
+ * a lookup does not need to scan the whole pool. The chains store pool
+ * indexes, NBR_HASH_END terminates a chain.
+ */
+#define NBR_HASH_END UINT8_MAX
+
+static uint8_t nbr_hash_head[CONFIG_NET_IPV6_MAX_NEIGHBORS] = {
+	[0 ... (CONFIG_NET_IPV6_MAX_NEIGHBORS - 1)] = NBR_HASH_END
+};
+static uint8_t nbr_hash_next[CONFIG_NET_IPV6_MAX_NEIGHBORS];
+
+static inline uint8_t nbr_index(struct net_nbr *nbr)
+{
+	return ((uint8_t *)nbr - (uint8_t *)net_neighbor_pool) /
+		sizeof(net_neighbor_pool[0]);
+}
+
+static uint8_t nbr_hash(const struct in6_addr *addr)
+{
+	uint32_t key = addr->s6_addr32[0] ^ addr->s6_addr32[1] ^
+		       addr->s6_addr32[2] ^ addr->s6_addr32[3];
+
+	return ((key * 0x9e3779b1U) >> 16) % CONFIG_NET_IPV6_MAX_NEIGHBORS;
+}
+
+static void nbr_hash_add(struct net_nbr *nbr)
+{
+	uint8_t bucket = nbr_hash(&net_ipv6_nbr_data(nbr)->addr);
+	uint8_t idx = nbr_index(nbr);
+
+	nbr_hash_next[idx] = nbr_hash_head[bucket];
+	nbr_hash_head[bucket] = idx;
+}
+
+static void nbr_hash_del(struct net_nbr *nbr)
+{
+	uint8_t *link = &nbr_hash_head[nbr_hash(&net_ipv6_nbr_data(nbr)->addr)];
+	uint8_t idx = nbr_index(nbr);
+
+	while (*link != NBR_HASH_END) {
+		if (*link == idx) {
+			*link = nbr_hash_next[idx];
+			return;
+		}
+
+		link = &nbr_hash_next[*link];
+	}
+}
+
 static struct net_nbr *nbr_lookup(struct net_nbr_table *table,
 				  struct net_if *iface,
 				  const struct in6_addr *addr)
 {
-	int i;
+	uint8_t i;
 
-	for (i = 0; i < CONFIG_NET_IPV6_MAX_NEIGHBORS; i++) {
+	for (i = nbr_hash_head[nbr_hash(addr)]; i != NBR_HASH_END;
+	     i = nbr_hash_next[i]) {
 		struct net_nbr *nbr = get_nbr(i);
 
 		if (!nbr->ref) {
@@ -408,6 +458,7 @@ static void nbr_init(struct net_nbr *nbr, struct net_if *iface,
 	nbr->iface = iface;
 
 	net_ipaddr_copy(&net_ipv6_nbr_data(nbr)->addr, addr);
+	nbr_hash_add(nbr);
 	ipv6_nbr_set_state(nbr, state);
 	net_ipv6_nbr_data(nbr)->is_router = is_router;
 	net_ipv6_nbr_data(nbr)->pending = NULL;
@@ -651,6 +702,8 @@ void net_neighbor_data_remove(struct net_nbr *nbr)
 {
 	NET_DBG("Neighbor %p removed", nbr);
 
+	nbr_hash_del(nbr);
+
 	return;
 }
 
@@ -785,9 +838,11 @@ enum net_verdict net_ipv6_prepare_for_send(struct net_pkt *pkt)
 
 #if defined(CONFIG_NET_IPV6_FRAGMENT)
 	/* If we have already fragmented the packet, the fragment id will
-	 * contain a proper value and we can skip other checks.
+	 * contain a proper value and we can skip other checks. TCP packets
+	 * larger than the MTU that are segmented below the IP layer are not
+	 * fragmented either.
 	 */
-	if (net_pkt_ipv6_fragment_id(pkt) == 0U) {
+	if (net_pkt_ipv6_fragment_id(pkt) == 0U && net_pkt_gso_size(pkt) == 0U) {
 		uint16_t mtu = net_if_get_mtu(net_pkt_iface(pkt));
 		size_t pkt_len = net_pkt_get_len(pkt);
 
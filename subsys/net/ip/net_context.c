@@ -1581,6 +1581,7 @@ static int context_setup_udp_packet(struct net_context *context,
 				    struct net_pkt *pkt,
 				    const void *buf,
 				    size_t len,
+				    struct net_buf *frags,
 				    const struct msghdr *msg,
 				    const struct sockaddr *dst_addr,
 				    socklen_t addrlen)
@@ -1623,6 +1624,11 @@ static int context_setup_udp_packet(struct net_context *context,
 		return ret;
 	}
 
+	if (frags) {
+		net_pkt_append_buffer(pkt, net_buf_ref(frags));
+		return 0;
+	}
+
 	ret = context_write_data(pkt, buf, len, msg);
 	if (ret) {
 		return ret;
@@ -1686,6 +1692,63 @@ static struct net_pkt *context_alloc_pkt(struct net_context *context,
 	return pkt;
 }
 
+/* Zero-copy sends carry the payload in the caller's buffers, so UDP only needs
+ * room for its headers and TCP, which builds headers per segment, none at all.
+ */
+static struct net_pkt *context_alloc_frags_pkt(struct net_context *context,
+					       k_timeout_t timeout)
+{
+	struct net_pkt *pkt;
+
+	if (net_context_get_proto(context) != IPPROTO_TCP) {
+		return context_alloc_pkt(context, 0, timeout);
+	}
+
+#if defined(CONFIG_NET_CONTEXT_NET_PKT_POOL)
+	if (context->tx_slab) {
+		pkt = net_pkt_alloc_from_slab(context->tx_slab(), timeout);
+		if (pkt) {
+			net_pkt_set_iface(pkt, net_context_get_iface(context));
+		}
+	} else
+#endif
+	{
+		pkt = net_pkt_alloc_on_iface(net_context_get_iface(context),
+					     timeout);
+	}
+
+	if (pkt) {
+		net_pkt_set_family(pkt, net_context_get_family(context));
+		net_pkt_set_context(pkt, context);
+	}
+
+	return pkt;
+}
+
+static bool context_pkt_fits_mtu(struct net_context *context,
+				 struct net_pkt *pkt)
+{
+	size_t max_len = net_if_get_mtu(net_pkt_iface(pkt));
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) &&
+	    net_context_get_family(context) == AF_INET6) {
+		if (IS_ENABLED(CONFIG_NET_IPV6_FRAGMENT)) {
+			return true;
+		}
+
+		max_len = MAX(max_len, NET_IPV6_MTU);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) &&
+		   net_context_get_family(context) == AF_INET) {
+		if (IS_ENABLED(CONFIG_NET_IPV4_FRAGMENT)) {
+			return true;
+		}
+
+		max_len = MAX(max_len, NET_IPV4_MTU);
+	}
+
+	return net_pkt_get_len(pkt) <= max_len;
+}
+
 static void set_pkt_txtime(struct net_pkt *pkt, const struct msghdr *msghdr)
 {
 	struct cmsghdr *cmsg;
@@ -1704,6 +1767,7 @@ static void set_pkt_txtime(struct net_pkt *pkt, const struct msghdr *msghdr)
 static int context_sendto(struct net_context *context,
 			  const void *buf,
 			  size_t len,
+			  struct net_buf *frags,
 			  const struct sockaddr *dst_addr,
 			  socklen_t addrlen,
 			  net_context_send_cb_t cb,
@@ -1935,13 +1999,20 @@ static int context_sendto(struct net_context *context,
 		return -ENETDOWN;
 	}
 
-	pkt = context_alloc_pkt(context, len, PKT_WAIT_TIME);
+	if (frags) {
+		len = net_buf_frags_len(frags);
+
+		pkt = context_alloc_frags_pkt(context, PKT_WAIT_TIME);
+	} else {
+		pkt = context_alloc_pkt(context, len, PKT_WAIT_TIME);
+	}
+
 	if (!pkt) {
 		NET_ERR("Failed to allocate net_pkt");
 		return -ENOBUFS;
 	}
 
-	tmp_len = net_pkt_available_payload_buffer(
+	tmp_len = frags ? len : net_pkt_available_payload_buffer(
 				pkt, net_context_get_proto(context));
 	if (tmp_len < len) {
 		if (net_context_get_type(context) == SOCK_DGRAM) {
@@ -1996,21 +2067,30 @@ static int context_sendto(struct net_context *context,
 		}
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_proto(context) == IPPROTO_UDP) {
-		ret = context_setup_udp_packet(context, pkt, buf, len, msghdr,
-					       dst_addr, addrlen);
+		ret = context_setup_udp_packet(context, pkt, buf, len, frags,
+					       msghdr, dst_addr, addrlen);
 		if (ret < 0) {
 			goto fail;
 		}
 
+		if (frags && !context_pkt_fits_mtu(context, pkt)) {
+			ret = -EMSGSIZE;
+			goto fail;
+		}
+
 		context_finalize_packet(context, pkt);
 
 		ret = net_send_data(pkt);
 	} else if (IS_ENABLED(CONFIG_NET_TCP) &&
 		   net_context_get_proto(context) == IPPROTO_TCP) {
 
-		ret = context_write_data(pkt, buf, len, msghdr);
-		if (ret < 0) {
-			goto fail;
+		if (frags) {
+			net_pkt_append_buffer(pkt, net_buf_ref(frags));
+		} else {
+			ret = context_write_data(pkt, buf, len, msghdr);
+			if (ret < 0) {
+				goto fail;
+			}
 		}
 
 		net_pkt_cursor_init(pkt);
@@ -2113,7 +2193,7 @@ int net_context_send(struct net_context *context,
 		addrlen = 0;
 	}
 
-	ret = context_sendto(context, buf, len, &context->remote,
+	ret = context_sendto(context, buf, len, NULL, &context->remote,
 			     addrlen, cb, timeout, user_data, false);
 unlock:
 	k_mutex_unlock(&context->lock);
@@ -2132,7 +2212,7 @@ int net_context_sendmsg(struct net_context *context,
 
 	k_mutex_lock(&context->lock, K_FOREVER);
 
-	ret = context_sendto(context, msghdr, 0, NULL, 0,
+	ret = context_sendto(context, msghdr, 0, NULL, NULL, 0,
 			     cb, timeout, user_data, true);
 
 	k_mutex_unlock(&context->lock);
@@ -2153,7 +2233,7 @@ int net_context_sendto(struct net_context *context,
 
 	k_mutex_lock(&context->lock, K_FOREVER);
 
-	ret = context_sendto(context, buf, len, dst_addr, addrlen,
+	ret = context_sendto(context, buf, len, NULL, dst_addr, addrlen,
 			     cb, timeout, user_data, true);
 
 	k_mutex_unlock(&context->lock);
@@ -2161,6 +2241,53 @@ int net_context_sendto(struct net_context *context,
 	return ret;
 }
 
+int net_context_send_buf(struct net_context *context,
+			 struct net_buf *buf,
+			 const struct sockaddr *dst_addr,
+			 socklen_t addrlen,
+			 net_context_send_cb_t cb,
+			 k_timeout_t timeout,
+			 void *user_data)
+{
+	int ret;
+
+	if (buf == NULL) {
+		return -EINVAL;
+	}
+
+	if (net_context_get_proto(context) != IPPROTO_UDP &&
+	    net_context_get_proto(context) != IPPROTO_TCP) {
+		return -EOPNOTSUPP;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+	    net_if_is_ip_offloaded(net_context_get_iface(context))) {
+		return -EOPNOTSUPP;
+	}
+
+	k_mutex_lock(&context->lock, K_FOREVER);
+
+	if (dst_addr == NULL) {
+		if (!(context->flags & NET_CONTEXT_REMOTE_ADDR_SET) ||
+		    !net_sin(&context->remote)->sin_port) {
+			ret = -EDESTADDRREQ;
+			goto unlock;
+		}
+
+		dst_addr = &context->remote;
+		addrlen = net_context_get_family(context) == AF_INET6 ?
+			  sizeof(struct sockaddr_in6) :
+			  sizeof(struct sockaddr_in);
+	}
+
+	ret = context_sendto(context, NULL, 0, buf, dst_addr, addrlen,
+			     cb, timeout, user_data, dst_addr != &context->remote);
+unlock:
+	k_mutex_unlock(&context->lock);
+
+	return ret;
+}
+
 enum net_verdict net_context_packet_received(struct net_conn *conn,
 					     struct net_pkt *pkt,
 					     union net_ip_header *ip_hdr,
@@ -59,6 +59,270 @@ LOG_MODULE_REGISTER(net_core, CONFIG_NET_CORE_LOG_LEVEL);
 
 #include "net_stats.h"
 
+static enum net_verdict process_ip_data(struct net_pkt *pkt, bool is_loopback)
+{
+	/* IP version and header length. */
+	uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && vtc_vhl == 0x60) {
+		return net_ipv6_input(pkt, is_loopback);
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && vtc_vhl == 0x40) {
+		return net_ipv4_input(pkt);
+	}
+
+	NET_DBG("Unknown IP family packet (0x%x)", NET_IPV6_HDR(pkt)->vtc & 0xf0);
+	net_stats_update_ip_errors_protoerr(net_pkt_iface(pkt));
+	net_stats_update_ip_errors_vhlerr(net_pkt_iface(pkt));
+	return NET_DROP;
+}
+
+#if defined(CONFIG_NET_TCP_GRO)
+/* TCP flags, a segment is only coalesced if it has data, the ACK flag and
+ * optionally the PSH one.
+ */
+#define GRO_TCP_PSH 0x08
+#define GRO_TCP_ACK 0x10
+
+/* The segment waiting for the next ones of its connection. It is only
+ * accessed by the single RX thread.
+ */
+static struct net_pkt *gro_pkt;
+static size_t gro_hdr_len;
+
+/* Return the TCP header of a segment that could be coalesced with others,
+ * the IP and TCP headers need to be in the first buffer.
+ */
+static struct net_tcp_hdr *gro_tcp_hdr(struct net_pkt *pkt, size_t *hdr_len)
+{
+	struct net_buf *buf = pkt->buffer;
+	struct net_tcp_hdr *tcp_hdr;
+	size_t ip_len;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && buf->len >= sizeof(struct net_ipv4_hdr) &&
+	    (buf->data[0] & 0xf0) == 0x40) {
+		struct net_ipv4_hdr *hdr = (struct net_ipv4_hdr *)buf->data;
+
+		/* No options, and not a fragment */
+		if (hdr->vhl != 0x45 || hdr->proto != IPPROTO_TCP ||
+		    (sys_get_be16(hdr->offset) &
+		     (NET_IPV4_FRAGH_OFFSET_MASK | NET_IPV4_MORE_FRAG_MASK)) != 0 ||
+		    ntohs(hdr->len) != net_pkt_get_len(pkt)) {
+			return NULL;
+		}
+
+		net_pkt_set_family(pkt, AF_INET);
+		net_pkt_set_ipv4_opts_len(pkt, 0);
+		ip_len = sizeof(struct net_ipv4_hdr);
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) && buf->len >= sizeof(struct net_ipv6_hdr) &&
+		   (buf->data[0] & 0xf0) == 0x60) {
+		struct net_ipv6_hdr *hdr = (struct net_ipv6_hdr *)buf->data;
+
+		/* No extension headers */
+		if (hdr->nexthdr != IPPROTO_TCP ||
+		    ntohs(hdr->len) + sizeof(struct net_ipv6_hdr) != net_pkt_get_len(pkt)) {
+			return NULL;
+		}
+
+		net_pkt_set_family(pkt, AF_INET6);
+		net_pkt_set_ipv6_ext_len(pkt, 0);
+		ip_len = sizeof(struct net_ipv6_hdr);
+	} else {
+		return NULL;
+	}
+
+	if (buf->len < ip_len + sizeof(struct net_tcp_hdr)) {
+		return NULL;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)(buf->data + ip_len);
+	*hdr_len = ip_len + (tcp_hdr->offset >> 4) * 4U;
+
+	if (*hdr_len < ip_len + sizeof(struct net_tcp_hdr) || buf->len < *hdr_len ||
+	    net_pkt_get_len(pkt) <= *hdr_len ||
+	    (tcp_hdr->flags & ~GRO_TCP_PSH) != GRO_TCP_ACK) {
+		return NULL;
+	}
+
+	net_pkt_set_ip_hdr_len(pkt, ip_len);
+
+	return tcp_hdr;
+}
+
+/* Verify the checksums the IP and TCP layers would otherwise check */
+static bool gro_chksum_ok(struct net_pkt *pkt)
+{
+	if (!net_if_need_calc_rx_checksum(net_pkt_iface(pkt))) {
+		return true;
+	}
+
+#if defined(CONFIG_NET_IPV4)
+	if (net_pkt_family(pkt) == AF_INET && net_calc_chksum_ipv4(pkt) != 0U) {
+		return false;
+	}
+#endif
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM)) {
+		if (net_calc_chksum_tcp(pkt) != 0U) {
+			return false;
+		}
+
+		net_pkt_set_chksum_done(pkt, true);
+	}
+
+	return true;
+}
+
+static bool gro_can_merge(struct net_pkt *pkt, struct net_tcp_hdr *tcp_hdr,
+			  size_t hdr_len)
+{
+	uint8_t *gro_hdr = gro_pkt->buffer->data;
+	uint8_t *hdr = pkt->buffer->data;
+	size_t len = net_pkt_get_len(gro_pkt);
+	struct net_tcp_hdr *gro_tcp_hdr;
+
+	gro_tcp_hdr = (struct net_tcp_hdr *)(gro_hdr + net_pkt_ip_hdr_len(gro_pkt));
+
+	if (net_pkt_iface(pkt) != net_pkt_iface(gro_pkt) ||
+	    net_pkt_family(pkt) != net_pkt_family(gro_pkt) ||
+	    hdr_len != gro_hdr_len ||
+	    len + net_pkt_get_len(pkt) - hdr_len > UINT16_MAX ||
+	    (gro_tcp_hdr->flags & GRO_TCP_PSH) != 0U) {
+		return false;
+	}
+
+	if (net_pkt_family(pkt) == AF_INET) {
+		struct net_ipv4_hdr *ip = (struct net_ipv4_hdr *)hdr;
+		struct net_ipv4_hdr *gro_ip = (struct net_ipv4_hdr *)gro_hdr;
+
+		if (ip->tos != gro_ip->tos ||
+		    memcmp(ip->src, gro_ip->src, sizeof(ip->src) + sizeof(ip->dst)) != 0) {
+			return false;
+		}
+	} else {
+		struct net_ipv6_hdr *ip = (struct net_ipv6_hdr *)hdr;
+		struct net_ipv6_hdr *gro_ip = (struct net_ipv6_hdr *)gro_hdr;
+
+		/* Traffic class and flow label */
+		if (memcmp(ip, gro_ip, 4) != 0 ||
+		    memcmp(ip->src, gro_ip->src, sizeof(ip->src) + sizeof(ip->dst)) != 0) {
+			return false;
+		}
+	}
+
+	/* Same connection and acknowledgment, the data follows the one of the
+	 * waiting segment and the options are identical.
+	 */
+	return tcp_hdr->src_port == gro_tcp_hdr->src_port &&
+	       tcp_hdr->dst_port == gro_tcp_hdr->dst_port &&
+	       sys_get_be32(tcp_hdr->seq) == sys_get_be32(gro_tcp_hdr->seq) + len - hdr_len &&
+	       memcmp(tcp_hdr->ack, gro_tcp_hdr->ack, sizeof(tcp_hdr->ack)) == 0 &&
+	       memcmp(tcp_hdr->wnd, gro_tcp_hdr->wnd, sizeof(tcp_hdr->wnd)) == 0 &&
+	       memcmp(tcp_hdr->optdata, gro_tcp_hdr->optdata,
+		      hdr_len - net_pkt_ip_hdr_len(pkt) - sizeof(struct net_tcp_hdr)) == 0;
+}
+
+/* Append the data of pkt to the waiting segment */
+static void gro_merge(struct net_pkt *pkt, struct net_tcp_hdr *tcp_hdr, size_t hdr_len)
+{
+	uint8_t *gro_hdr = gro_pkt->buffer->data;
+	struct net_tcp_hdr *gro_tcp_hdr;
+	size_t len;
+
+	gro_tcp_hdr = (struct net_tcp_hdr *)(gro_hdr + net_pkt_ip_hdr_len(gro_pkt));
+	gro_tcp_hdr->flags |= tcp_hdr->flags;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_pull(pkt, hdr_len);
+	net_pkt_trim_buffer(pkt);
+
+	net_pkt_append_buffer(gro_pkt, pkt->buffer);
+	pkt->buffer = NULL;
+	net_pkt_unref(pkt);
+
+	len = net_pkt_get_len(gro_pkt);
+
+	if (net_pkt_family(gro_pkt) == AF_INET) {
+		struct net_ipv4_hdr *ip = (struct net_ipv4_hdr *)gro_hdr;
+
+		ip->len = htons(len);
+
+#if defined(CONFIG_NET_IPV4)
+		if (net_if_need_calc_rx_checksum(net_pkt_iface(gro_pkt))) {
+			ip->chksum = 0U;
+			ip->chksum = net_calc_chksum_ipv4(gro_pkt);
+		}
+#endif
+	} else {
+		struct net_ipv6_hdr *ip = (struct net_ipv6_hdr *)gro_hdr;
+
+		ip->len = htons(len - sizeof(struct net_ipv6_hdr));
+	}
+}
+
+static void gro_flush(void)
+{
+	struct net_pkt *pkt = gro_pkt;
+
+	if (pkt == NULL) {
+		return;
+	}
+
+	gro_pkt = NULL;
+
+	net_pkt_cursor_init(pkt);
+
+	if (process_ip_data(pkt, false) != NET_OK) {
+		NET_DBG("Dropping pkt %p", pkt);
+		net_pkt_unref(pkt);
+	}
+}
+
+void net_gro_flush(void)
+{
+	gro_flush();
+}
+
+/* Return true if the packet was taken, either merged into the waiting
+ * segment or kept waiting for the next ones itself.
+ */
+static bool gro_receive(struct net_pkt *pkt)
+{
+	struct net_tcp_hdr *tcp_hdr;
+	size_t hdr_len;
+
+	tcp_hdr = gro_tcp_hdr(pkt, &hdr_len);
+	if (tcp_hdr == NULL) {
+		/* Keep the order of the packets */
+		gro_flush();
+		return false;
+	}
+
+	if (gro_pkt != NULL && gro_can_merge(pkt, tcp_hdr, hdr_len)) {
+		if (gro_chksum_ok(pkt)) {
+			gro_merge(pkt, tcp_hdr, hdr_len);
+			return true;
+		}
+
+		/* Let the IP or TCP layer drop it */
+		gro_flush();
+		return false;
+	}
+
+	gro_flush();
+
+	if (!gro_chksum_ok(pkt)) {
+		return false;
+	}
+
+	gro_pkt = pkt;
+	gro_hdr_len = hdr_len;
+
+	return true;
+}
+#else
+#define gro_receive(...) false
+#endif /* CONFIG_NET_TCP_GRO */
+
 static inline enum net_verdict process_data(struct net_pkt *pkt,
 					    bool is_loopback)
 {
@@ -130,19 +394,14 @@ static inline enum net_verdict process_data(struct net_pkt *pkt,
 			return ret;
 		}
 
-		/* IP version and header length. */
-		uint8_t vtc_vhl = NET_IPV6_HDR(pkt)->vtc & 0xf0;
-
-		if (IS_ENABLED(CONFIG_NET_IPV6) && vtc_vhl == 0x60) {
-			return net_ipv6_input(pkt, is_loopback);
-		} else if (IS_ENABLED(CONFIG_NET_IPV4) && vtc_vhl == 0x40) {
-			return net_ipv4_input(pkt);
+		/* Loopback packets may be processed directly in the thread of
+		 * the sender, only the RX thread may hold segments.
+		 */
+		if (IS_ENABLED(CONFIG_NET_TCP_GRO) && !is_loopback && gro_receive(pkt)) {
+			return NET_OK;
 		}
 
-		NET_DBG("Unknown IP family packet (0x%x)", NET_IPV6_HDR(pkt)->vtc & 0xf0);
-		net_stats_update_ip_errors_protoerr(net_pkt_iface(pkt));
-		net_stats_update_ip_errors_vhlerr(net_pkt_iface(pkt));
-		return NET_DROP;
+		return process_ip_data(pkt, is_loopback);
 	} else if (IS_ENABLED(CONFIG_NET_SOCKETS_CAN) && family == AF_CAN) {
 		return net_canbus_socket_input(pkt);
 	}
@@ -41,7 +41,12 @@ static K_MUTEX_DEFINE(net_mgmt_event_lock);
 K_KERNEL_STACK_DEFINE(mgmt_stack, CONFIG_NET_MGMT_EVENT_STACK_SIZE);
 static struct k_thread mgmt_thread_data;
 static uint32_t global_event_mask;
-static sys_slist_t event_callbacks = SYS_SLIST_STATIC_INIT(&event_callbacks);
+
+/* Callbacks are only run for events of their layer and layer code, so they
+ * are kept in lists indexed by a hash of both, and an event only walks the
+ * list its layer and layer code hash to.
+ */
+static sys_slist_t event_callbacks[CONFIG_NET_MGMT_EVENT_CALLBACK_LISTS];
 
 /* event structure used to prevent increasing the stack usage on the caller thread */
 static struct mgmt_event_entry new_event;
@@ -96,6 +101,15 @@ static inline void mgmt_pop_event(struct mgmt_event_entry *dst)
 	} while (k_msgq_get(&event_msgq, dst, K_FOREVER) != 0);
 }
 
+static inline sys_slist_t *mgmt_event_callbacks(uint32_t mgmt_event)
+{
+	uint32_t code = NET_MGMT_GET_LAYER_CODE(mgmt_event);
+
+	return &event_callbacks[(code ^ (code >> 4) ^
+				 NET_MGMT_GET_LAYER(mgmt_event)) %
+				CONFIG_NET_MGMT_EVENT_CALLBACK_LISTS];
+}
+
 static inline void mgmt_add_event_mask(uint32_t event_mask)
 {
 	global_event_mask |= event_mask;
@@ -107,8 +121,10 @@ static inline void mgmt_rebuild_global_event_mask(void)
 
 	global_event_mask = 0U;
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks, cb, tmp, node) {
-		mgmt_add_event_mask(cb->event_mask);
+	for (size_t i = 0; i < ARRAY_SIZE(event_callbacks); i++) {
+		SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks[i], cb, tmp, node) {
+			mgmt_add_event_mask(cb->event_mask);
+		}
 	}
 }
 
@@ -127,6 +143,7 @@ static inline bool mgmt_is_event_handled(uint32_t mgmt_event)
 
 static inline void mgmt_run_callbacks(const struct mgmt_event_entry * const mgmt_event)
 {
+	sys_slist_t *callbacks = mgmt_event_callbacks(mgmt_event->event);
 	sys_snode_t *prev = NULL;
 	struct net_mgmt_event_callback *cb, *tmp;
 
@@ -135,7 +152,7 @@ static inline void mgmt_run_callbacks(const struct mgmt_event_entry * const mgmt
 		NET_MGMT_GET_LAYER_CODE(mgmt_event->event),
 		NET_MGMT_GET_COMMAND(mgmt_event->event));
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&event_callbacks, cb, tmp, node) {
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(callbacks, cb, tmp, node) {
 		if (!(NET_MGMT_GET_LAYER(mgmt_event->event) ==
 		      NET_MGMT_GET_LAYER(cb->event_mask)) ||
 		    !(NET_MGMT_GET_LAYER_CODE(mgmt_event->event) ==
@@ -172,7 +189,7 @@ static inline void mgmt_run_callbacks(const struct mgmt_event_entry * const mgmt
 			cb->raised_event = mgmt_event->event;
 			sync_data->iface = mgmt_event->iface;
 
-			sys_slist_remove(&event_callbacks, prev, &cb->node);
+			sys_slist_remove(callbacks, prev, &cb->node);
 
 			k_sem_give(cb->sync_call);
 		} else {
@@ -276,7 +293,7 @@ void net_mgmt_add_event_callback(struct net_mgmt_event_callback *cb)
 
 	(void)k_mutex_lock(&net_mgmt_callback_lock, K_FOREVER);
 
-	sys_slist_prepend(&event_callbacks, &cb->node);
+	sys_slist_prepend(mgmt_event_callbacks(cb->event_mask), &cb->node);
 
 	mgmt_add_event_mask(cb->event_mask);
 
@@ -289,7 +306,7 @@ void net_mgmt_del_event_callback(struct net_mgmt_event_callback *cb)
 
 	(void)k_mutex_lock(&net_mgmt_callback_lock, K_FOREVER);
 
-	sys_slist_find_and_remove(&event_callbacks, &cb->node);
+	sys_slist_find_and_remove(mgmt_event_callbacks(cb->event_mask), &cb->node);
 
 	mgmt_rebuild_global_event_mask();
 
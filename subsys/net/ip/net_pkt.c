@@ -37,6 +37,7 @@ LOG_MODULE_REGISTER(net_pkt, CONFIG_NET_PKT_LOG_LEVEL);
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/udp.h>
+#include <zephyr/profiling/region.h>
 
 #include "net_private.h"
 #include "tcp_internal.h"
@@ -120,6 +121,9 @@ LOG_MODULE_REGISTER(net_pkt, CONFIG_NET_PKT_LOG_LEVEL);
 K_MEM_SLAB_DEFINE(rx_pkts, sizeof(struct net_pkt), CONFIG_NET_PKT_RX_COUNT, 4);
 K_MEM_SLAB_DEFINE(tx_pkts, sizeof(struct net_pkt), CONFIG_NET_PKT_TX_COUNT, 4);
 
+K_SPINLOCK_STATS_DEFINE(net_pkt_rx_slab, rx_pkts.lock);
+K_SPINLOCK_STATS_DEFINE(net_pkt_tx_slab, tx_pkts.lock);
+
 #if defined(CONFIG_NET_BUF_FIXED_DATA_SIZE)
 
 NET_BUF_POOL_FIXED_DEFINE(rx_bufs, CONFIG_NET_BUF_RX_COUNT, CONFIG_NET_BUF_DATA_SIZE,
@@ -866,51 +870,35 @@ static struct net_buf *pkt_alloc_buffer(struct net_buf_pool *pool,
 					size_t size, k_timeout_t timeout)
 #endif
 {
-	k_timepoint_t end = sys_timepoint_calc(timeout);
-	struct net_buf *first = NULL;
-	struct net_buf *current = NULL;
+	const struct net_buf_pool_fixed *fixed = pool->alloc->alloc_data;
+	struct net_buf *first;
+	struct net_buf *current;
 
-	do {
-		struct net_buf *new;
-
-		new = net_buf_alloc_fixed(pool, timeout);
-		if (!new) {
-			goto error;
-		}
-
-		if (!first && !current) {
-			first = new;
-		} else {
-			current->frags = new;
-		}
+	first = net_buf_alloc_bulk(pool, MAX(DIV_ROUND_UP(size, fixed->data_size), 1),
+				   timeout);
+	if (!first) {
+		return NULL;
+	}
 
-		current = new;
+	for (current = first; current; current = current->frags) {
 		if (current->size > size) {
 			current->size = size;
 		}
 
 		size -= current->size;
 
-		timeout = sys_timepoint_timeout(end);
-
 #if CONFIG_NET_PKT_LOG_LEVEL >= LOG_LEVEL_DBG
-		NET_FRAG_CHECK_IF_NOT_IN_USE(new, new->ref + 1);
+		NET_FRAG_CHECK_IF_NOT_IN_USE(current, current->ref + 1);
 
-		net_pkt_alloc_add(new, false, caller, line);
+		net_pkt_alloc_add(current, false, caller, line);
 
 		NET_DBG("%s (%s) [%d] frag %p ref %d (%s():%d)",
 			pool2str(pool), get_name(pool), get_frees(pool),
-			new, new->ref, caller, line);
+			current, current->ref, caller, line);
 #endif
-	} while (size);
-
-	return first;
-error:
-	if (first) {
-		net_buf_unref(first);
 	}
 
-	return NULL;
+	return first;
 }
 
 #else /* !CONFIG_NET_BUF_FIXED_DATA_SIZE */
@@ -1197,6 +1185,8 @@ int net_pkt_alloc_buffer(struct net_pkt *pkt,
 	return 0;
 }
 
+PROFILING_PROBE_DEFINE(net_pkt_alloc);
+
 #if NET_LOG_LEVEL >= LOG_LEVEL_DBG
 static struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout,
 				 const char *caller, int line)
@@ -1208,6 +1198,8 @@ static struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout)
 	uint32_t create_time;
 	int ret;
 
+	PROFILING_PROBE_START(net_pkt_alloc);
+
 	if (k_is_in_isr()) {
 		timeout = K_NO_WAIT;
 	}
@@ -1264,6 +1256,8 @@ static struct net_pkt *pkt_alloc(struct k_mem_slab *slab, k_timeout_t timeout)
 
 	net_pkt_cursor_init(pkt);
 
+	PROFILING_PROBE_END(net_pkt_alloc);
+
 	return pkt;
 }
 
@@ -1816,6 +1810,8 @@ static void clone_pkt_attributes(struct net_pkt *pkt, struct net_pkt *clone_pkt)
 	net_pkt_set_l2_bridged(clone_pkt, net_pkt_is_l2_bridged(pkt));
 	net_pkt_set_l2_processed(clone_pkt, net_pkt_is_l2_processed(pkt));
 	net_pkt_set_ll_proto_type(clone_pkt, net_pkt_ll_proto_type(pkt));
+	net_pkt_set_gso_size(clone_pkt, net_pkt_gso_size(pkt));
+	net_pkt_set_flow_hash(clone_pkt, net_pkt_flow_hash(pkt));
 
 	if (pkt->buffer && clone_pkt->buffer) {
 		memcpy(net_pkt_lladdr_src(clone_pkt), net_pkt_lladdr_src(pkt),
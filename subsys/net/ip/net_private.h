@@ -57,6 +57,11 @@ extern void net_if_post_init(void);
 extern void net_if_stats_reset(struct net_if *iface);
 extern void net_if_stats_reset_all(void);
 extern void net_process_rx_packet(struct net_pkt *pkt);
+#if defined(CONFIG_NET_TCP_GRO)
+extern void net_gro_flush(void);
+#else
+static inline void net_gro_flush(void) { }
+#endif
 extern void net_process_tx_packet(struct net_pkt *pkt);
 
 extern int net_icmp_call_ipv4_handlers(struct net_pkt *pkt,
@@ -91,6 +91,19 @@ static inline void stats(struct net_if *iface)
 			 GET_STAT(iface, ipv6_nd.sent),
 			 GET_STAT(iface, ipv6_nd.drop));
 #endif /* CONFIG_NET_STATISTICS_IPV6_ND */
+#if defined(CONFIG_NET_STATISTICS_IPV6_ROUTE)
+		NET_INFO("IPv6 route lookup %d\tcache hit\t%d\tnot found\t%d",
+			 GET_STAT(iface, ipv6_route.lookup),
+			 GET_STAT(iface, ipv6_route.cache_hit),
+			 GET_STAT(iface, ipv6_route.not_found));
+#endif /* CONFIG_NET_STATISTICS_IPV6_ROUTE */
+#if defined(CONFIG_NET_STATISTICS_IPV6_REASSEMBLY)
+		NET_INFO("IPv6 reass frags %d\treassembled\t%d\ttimeout\t%d\tdrop\t%d",
+			 GET_STAT(iface, ipv6_reassembly.fragments),
+			 GET_STAT(iface, ipv6_reassembly.reassembled),
+			 GET_STAT(iface, ipv6_reassembly.timeout),
+			 GET_STAT(iface, ipv6_reassembly.drop));
+#endif /* CONFIG_NET_STATISTICS_IPV6_REASSEMBLY */
 #if defined(CONFIG_NET_STATISTICS_MLD)
 		NET_INFO("IPv6 MLD recv  %d\tsent\t%d\tdrop\t%d",
 			 GET_STAT(iface, ipv6_mld.recv),
@@ -105,6 +118,13 @@ static inline void stats(struct net_if *iface)
 			 GET_STAT(iface, ipv4.sent),
 			 GET_STAT(iface, ipv4.drop),
 			 GET_STAT(iface, ipv4.forwarded));
+#if defined(CONFIG_NET_STATISTICS_IPV4_REASSEMBLY)
+		NET_INFO("IPv4 reass frags %d\treassembled\t%d\ttimeout\t%d\tdrop\t%d",
+			 GET_STAT(iface, ipv4_reassembly.fragments),
+			 GET_STAT(iface, ipv4_reassembly.reassembled),
+			 GET_STAT(iface, ipv4_reassembly.timeout),
+			 GET_STAT(iface, ipv4_reassembly.drop));
+#endif /* CONFIG_NET_STATISTICS_IPV4_REASSEMBLY */
 #endif /* CONFIG_NET_STATISTICS_IPV4 */
 
 		NET_INFO("IP vhlerr      %d\thblener\t%d\tlblener\t%d",
@@ -279,6 +299,24 @@ static int net_stats_get(uint32_t mgmt_request, struct net_if *iface,
 		src = GET_STAT_ADDR(iface, ipv6_nd);
 		break;
 #endif
+#if defined(CONFIG_NET_STATISTICS_IPV6_ROUTE)
+	case NET_REQUEST_STATS_CMD_GET_IPV6_ROUTE:
+		len_chk = sizeof(struct net_stats_ipv6_route);
+		src = GET_STAT_ADDR(iface, ipv6_route);
+		break;
+#endif
+#if defined(CONFIG_NET_STATISTICS_IPV4_REASSEMBLY)
+	case NET_REQUEST_STATS_CMD_GET_IPV4_REASSEMBLY:
+		len_chk = sizeof(struct net_stats_ip_reassembly);
+		src = GET_STAT_ADDR(iface, ipv4_reassembly);
+		break;
+#endif
+#if defined(CONFIG_NET_STATISTICS_IPV6_REASSEMBLY)
+	case NET_REQUEST_STATS_CMD_GET_IPV6_REASSEMBLY:
+		len_chk = sizeof(struct net_stats_ip_reassembly);
+		src = GET_STAT_ADDR(iface, ipv6_reassembly);
+		break;
+#endif
 #if defined(CONFIG_NET_STATISTICS_ICMP)
 	case NET_REQUEST_STATS_CMD_GET_ICMP:
 		len_chk = sizeof(struct net_stats_icmp);
@@ -341,6 +379,21 @@ NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_STATS_GET_IPV6_ND,
 				  net_stats_get);
 #endif
 
+#if defined(CONFIG_NET_STATISTICS_IPV6_ROUTE)
+NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_STATS_GET_IPV6_ROUTE,
+				  net_stats_get);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IPV4_REASSEMBLY)
+NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_STATS_GET_IPV4_REASSEMBLY,
+				  net_stats_get);
+#endif
+
+#if defined(CONFIG_NET_STATISTICS_IPV6_REASSEMBLY)
+NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_STATS_GET_IPV6_REASSEMBLY,
+				  net_stats_get);
+#endif
+
 #if defined(CONFIG_NET_STATISTICS_ICMP)
 NET_MGMT_REGISTER_REQUEST_HANDLER(NET_REQUEST_STATS_GET_ICMP,
 				  net_stats_get);
@@ -113,6 +113,67 @@ static inline void net_stats_update_ipv6_nd_drop(struct net_if *iface)
 #define net_stats_update_ipv6_nd_drop(iface)
 #endif /* CONFIG_NET_STATISTICS_IPV6_ND */
 
+#if defined(CONFIG_NET_STATISTICS_IPV6_ROUTE) && defined(CONFIG_NET_NATIVE_IPV6)
+/* IPv6 route lookup stats, the interface is NULL for lookups that are
+ * not bound to an interface.
+ */
+
+#define UPDATE_ROUTE_STAT(_iface, _cmd)		\
+	do {					\
+		if (_iface) {			\
+			UPDATE_STAT(_iface, _cmd);	\
+		} else {			\
+			UPDATE_STAT_GLOBAL(_cmd);	\
+		}				\
+	} while (false)
+
+static inline void net_stats_update_ipv6_route_lookup(struct net_if *iface)
+{
+	UPDATE_ROUTE_STAT(iface, stats.ipv6_route.lookup++);
+}
+
+static inline void net_stats_update_ipv6_route_cache_hit(struct net_if *iface)
+{
+	UPDATE_ROUTE_STAT(iface, stats.ipv6_route.cache_hit++);
+}
+
+static inline void net_stats_update_ipv6_route_not_found(struct net_if *iface)
+{
+	UPDATE_ROUTE_STAT(iface, stats.ipv6_route.not_found++);
+}
+#else
+#define net_stats_update_ipv6_route_lookup(iface)
+#define net_stats_update_ipv6_route_cache_hit(iface)
+#define net_stats_update_ipv6_route_not_found(iface)
+#endif /* CONFIG_NET_STATISTICS_IPV6_ROUTE */
+
+#if defined(CONFIG_NET_STATISTICS_IPV6_REASSEMBLY) && defined(CONFIG_NET_NATIVE_IPV6)
+static inline void net_stats_update_ipv6_reassembly_fragment(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.ipv6_reassembly.fragments++);
+}
+
+static inline void net_stats_update_ipv6_reassembly_done(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.ipv6_reassembly.reassembled++);
+}
+
+static inline void net_stats_update_ipv6_reassembly_timeout(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.ipv6_reassembly.timeout++);
+}
+
+static inline void net_stats_update_ipv6_reassembly_drop(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.ipv6_reassembly.drop++);
+}
+#else
+#define net_stats_update_ipv6_reassembly_fragment(iface)
+#define net_stats_update_ipv6_reassembly_done(iface)
+#define net_stats_update_ipv6_reassembly_timeout(iface)
+#define net_stats_update_ipv6_reassembly_drop(iface)
+#endif /* CONFIG_NET_STATISTICS_IPV6_REASSEMBLY */
+
 #if defined(CONFIG_NET_STATISTICS_IPV4) && defined(CONFIG_NET_NATIVE_IPV4)
 /* IPv4 stats */
 
@@ -136,6 +197,33 @@ static inline void net_stats_update_ipv4_recv(struct net_if *iface)
 #define net_stats_update_ipv4_recv(iface)
 #endif /* CONFIG_NET_STATISTICS_IPV4 */
 
+#if defined(CONFIG_NET_STATISTICS_IPV4_REASSEMBLY) && defined(CONFIG_NET_NATIVE_IPV4)
+static inline void net_stats_update_ipv4_reassembly_fragment(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.ipv4_reassembly.fragments++);
+}
+
+static inline void net_stats_update_ipv4_reassembly_done(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.ipv4_reassembly.reassembled++);
+}
+
+static inline void net_stats_update_ipv4_reassembly_timeout(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.ipv4_reassembly.timeout++);
+}
+
+static inline void net_stats_update_ipv4_reassembly_drop(struct net_if *iface)
+{
+	UPDATE_STAT(iface, stats.ipv4_reassembly.drop++);
+}
+#else
+#define net_stats_update_ipv4_reassembly_fragment(iface)
+#define net_stats_update_ipv4_reassembly_done(iface)
+#define net_stats_update_ipv4_reassembly_timeout(iface)
+#define net_stats_update_ipv4_reassembly_drop(iface)
+#endif /* CONFIG_NET_STATISTICS_IPV4_REASSEMBLY */
+
 #if defined(CONFIG_NET_STATISTICS_ICMP) && defined(CONFIG_NET_NATIVE_IPV4)
 /* Common ICMPv4/ICMPv6 stats */
 static inline void net_stats_update_icmp_sent(struct net_if *iface)
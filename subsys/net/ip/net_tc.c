@@ -13,33 +13,180 @@ LOG_MODULE_REGISTER(net_tc, CONFIG_NET_TC_LOG_LEVEL);
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_pkt.h>
 #include <zephyr/net/net_stats.h>
+#include <zephyr/net/ethernet.h>
 
 #include "net_private.h"
 #include "net_stats.h"
 #include "net_tc_mapping.h"
+#include "ipv4.h"
 
 /* Template for thread name. The "xx" is either "TX" denoting transmit thread,
  * or "RX" denoting receive thread. The "q[y]" denotes the traffic class queue
  * where y indicates the traffic class id. The value of y can be from 0 to 7.
+ * With flow queues, the queue index z is added as "q[y.z]".
  */
-#define MAX_NAME_LEN sizeof("xx_q[y]")
+#define MAX_NAME_LEN sizeof("xx_q[y.z]")
+
+#if defined(CONFIG_NET_TC_FLOW_HASH)
+#define NET_TC_FLOW_QUEUES CONFIG_NET_TC_FLOW_QUEUES
+#else
+#define NET_TC_FLOW_QUEUES 1
+#endif
+
+/* The flow queues of a traffic class are next to each other */
+#define NET_TC_TX_QUEUES (NET_TC_TX_COUNT * NET_TC_FLOW_QUEUES)
+#define NET_TC_RX_QUEUES (NET_TC_RX_COUNT * NET_TC_FLOW_QUEUES)
 
 /* Stacks for TX work queue */
-K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_COUNT,
+K_KERNEL_STACK_ARRAY_DEFINE(tx_stack, NET_TC_TX_QUEUES,
 			    CONFIG_NET_TX_STACK_SIZE);
 
 /* Stacks for RX work queue */
-K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_COUNT,
+K_KERNEL_STACK_ARRAY_DEFINE(rx_stack, NET_TC_RX_QUEUES,
 			    CONFIG_NET_RX_STACK_SIZE);
 
 #if NET_TC_TX_COUNT > 0
-static struct net_traffic_class tx_classes[NET_TC_TX_COUNT];
+static struct net_traffic_class tx_classes[NET_TC_TX_QUEUES];
 #endif
 
 #if NET_TC_RX_COUNT > 0
-static struct net_traffic_class rx_classes[NET_TC_RX_COUNT];
+static struct net_traffic_class rx_classes[NET_TC_RX_QUEUES];
+#endif
+
+#if defined(CONFIG_NET_TC_FLOW_HASH)
+static inline uint32_t flow_hash_mix(uint32_t key)
+{
+	/* Multiplicative hashing, the upper bits are the best mixed. Never
+	 * return 0 as it means that the hash is not calculated.
+	 */
+	return ((key * 0x9e3779b1U) >> 16) | BIT(31);
+}
+
+/* Hash the addresses and ports of the IP packet in data. The values of
+ * both directions are XORed so that a flow and its replies use the same
+ * queue index.
+ */
+static uint32_t flow_hash_ip(const uint8_t *data, size_t len)
+{
+	size_t hdr_len;
+	uint32_t key;
+	uint8_t proto;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && len >= sizeof(struct net_ipv4_hdr) &&
+	    (data[0] & 0xf0) == 0x40) {
+		const struct net_ipv4_hdr *hdr = (const struct net_ipv4_hdr *)data;
+
+		key = UNALIGNED_GET((uint32_t *)hdr->src) ^
+		      UNALIGNED_GET((uint32_t *)hdr->dst);
+		hdr_len = (hdr->vhl & NET_IPV4_IHL_MASK) * 4U;
+		proto = hdr->proto;
+
+		/* Only the first fragment has the ports, so keep all the
+		 * fragments of a datagram together by ignoring them.
+		 */
+		if (sys_get_be16(hdr->offset) &
+		    ((NET_IPV4_MF << 13) | NET_IPV4_FRAGH_OFFSET_MASK)) {
+			return flow_hash_mix(key);
+		}
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		   len >= sizeof(struct net_ipv6_hdr) &&
+		   (data[0] & 0xf0) == 0x60) {
+		const struct net_ipv6_hdr *hdr = (const struct net_ipv6_hdr *)data;
+
+		key = 0;
+
+		for (int i = 0; i < NET_IPV6_ADDR_SIZE; i += sizeof(uint32_t)) {
+			key ^= UNALIGNED_GET((uint32_t *)&hdr->src[i]) ^
+			       UNALIGNED_GET((uint32_t *)&hdr->dst[i]);
+		}
+
+		/* Extension headers, including the fragment header, are not
+		 * parsed and only the addresses are used then.
+		 */
+		hdr_len = sizeof(struct net_ipv6_hdr);
+		proto = hdr->nexthdr;
+	} else {
+		return 0;
+	}
+
+	if ((proto == IPPROTO_TCP || proto == IPPROTO_UDP) &&
+	    len >= hdr_len + 2 * sizeof(uint16_t)) {
+		key ^= UNALIGNED_GET((uint16_t *)&data[hdr_len]) ^
+		       UNALIGNED_GET((uint16_t *)&data[hdr_len + 2]);
+	}
+
+	return flow_hash_mix(key);
+}
+
+#if NET_TC_TX_COUNT > 0
+/* The headers are expected to be in the first buffer, as they are in
+ * practice. Packets that cannot be parsed go to the first queue.
+ */
+static uint32_t tx_flow_hash(struct net_pkt *pkt)
+{
+	struct net_buf *buf = pkt->buffer;
+
+	if (buf == NULL) {
+		return 0;
+	}
+
+	return flow_hash_ip(buf->data, buf->len);
+}
+#endif
+
+#if NET_TC_RX_COUNT > 0
+#if defined(CONFIG_NET_L2_ETHERNET)
+static uint32_t eth_flow_hash(struct net_buf *buf)
+{
+	size_t hdr_len = sizeof(struct net_eth_hdr);
+	uint16_t type;
+
+	if (buf->len < hdr_len) {
+		return 0;
+	}
+
+	type = ntohs(((struct net_eth_hdr *)buf->data)->type);
+	if (type == NET_ETH_PTYPE_VLAN &&
+	    buf->len >= sizeof(struct net_eth_vlan_hdr)) {
+		hdr_len = sizeof(struct net_eth_vlan_hdr);
+		type = ntohs(((struct net_eth_vlan_hdr *)buf->data)->type);
+	}
+
+	if (type != NET_ETH_PTYPE_IP && type != NET_ETH_PTYPE_IPV6) {
+		return 0;
+	}
+
+	return flow_hash_ip(buf->data + hdr_len, buf->len - hdr_len);
+}
+#endif
+
+/* Received packets are queued before L2 has parsed them, so the Ethernet
+ * header is skipped here. For other L2s, one queue is used per interface.
+ */
+static uint32_t rx_flow_hash(struct net_pkt *pkt)
+{
+	struct net_if *iface = net_pkt_iface(pkt);
+
+	if (pkt->buffer == NULL) {
+		return 0;
+	}
+
+#if defined(CONFIG_NET_L2_ETHERNET)
+	if (net_if_l2(iface) == &NET_L2_GET_NAME(ETHERNET)) {
+		return eth_flow_hash(pkt->buffer);
+	}
+#endif
+
+	return flow_hash_mix(net_if_get_by_iface(iface));
+}
 #endif
 
+static inline int flow_queue(uint8_t tc, uint32_t hash)
+{
+	return tc * NET_TC_FLOW_QUEUES + hash % NET_TC_FLOW_QUEUES;
+}
+#endif /* CONFIG_NET_TC_FLOW_HASH */
+
 #if NET_TC_RX_COUNT > 0 || NET_TC_TX_COUNT > 0
 static void submit_to_queue(struct k_fifo *queue, struct net_pkt *pkt)
 {
@@ -47,12 +194,49 @@ static void submit_to_queue(struct k_fifo *queue, struct net_pkt *pkt)
 }
 #endif
 
+#if NET_TC_TX_COUNT > 0
+static int tx_queue(uint8_t tc, struct net_pkt *pkt)
+{
+#if defined(CONFIG_NET_TC_FLOW_HASH)
+	if (net_pkt_flow_hash(pkt) == 0U) {
+		net_pkt_set_flow_hash(pkt, tx_flow_hash(pkt));
+	}
+
+	return flow_queue(tc, net_pkt_flow_hash(pkt));
+#else
+	ARG_UNUSED(pkt);
+
+	return tc;
+#endif
+}
+#endif
+
+#if NET_TC_RX_COUNT > 0
+static int rx_queue(uint8_t tc, struct net_pkt *pkt)
+{
+#if defined(CONFIG_NET_TC_FLOW_HASH)
+	/* Drivers may have set the hash already, e.g. from their hardware
+	 * queue.
+	 */
+	if (net_pkt_flow_hash(pkt) == 0U) {
+		net_pkt_set_flow_hash(pkt, rx_flow_hash(pkt));
+	}
+
+	return flow_queue(tc, net_pkt_flow_hash(pkt));
+#else
+	ARG_UNUSED(pkt);
+
+	return tc;
+#endif
+}
+#endif
+
 bool net_tc_submit_to_tx_queue(uint8_t tc, struct net_pkt *pkt)
 {
 #if NET_TC_TX_COUNT > 0
 	net_pkt_set_tx_stats_tick(pkt, k_cycle_get_32());
 
-	submit_to_queue(&tx_classes[tc].fifo, pkt);
+	submit_to_queue(&tx_classes[tx_queue(tc, pkt)].fifo, pkt);
 #else
 	ARG_UNUSED(tc);
 	ARG_UNUSED(pkt);
@@ -65,7 +249,7 @@ void net_tc_submit_to_rx_queue(uint8_t tc, struct net_pkt *pkt)
 #if NET_TC_RX_COUNT > 0
 	net_pkt_set_rx_stats_tick(pkt, k_cycle_get_32());
 
-	submit_to_queue(&rx_classes[tc].fifo, pkt);
+	submit_to_queue(&rx_classes[rx_queue(tc, pkt)].fifo, pkt);
 #else
 	ARG_UNUSED(tc);
 	ARG_UNUSED(pkt);
@@ -246,7 +430,19 @@ static void tc_rx_handler(void *p1, void *p2, void *p3)
 	struct net_pkt *pkt;
 
 	while (1) {
-		pkt = k_fifo_get(fifo, K_FOREVER);
+		if (IS_ENABLED(CONFIG_NET_TCP_GRO)) {
+			/* TCP segments held for coalescing are passed on
+			 * once the queue runs empty.
+			 */
+			pkt = k_fifo_get(fifo, K_NO_WAIT);
+			if (pkt == NULL) {
+				net_gro_flush();
+				pkt = k_fifo_get(fifo, K_FOREVER);
+			}
+		} else {
+			pkt = k_fifo_get(fifo, K_FOREVER);
+		}
+
 		if (pkt == NULL) {
 			continue;
 		}
@@ -276,6 +472,22 @@ static void tc_tx_handler(void *p1, void *p2, void *p3)
 }
 #endif
 
+#if NET_TC_RX_COUNT > 0 || NET_TC_TX_COUNT > 0
+/* Spread the flow queues of each traffic class over the CPUs */
+static void flow_queue_pin(k_tid_t tid, int queue)
+{
+#if defined(CONFIG_NET_TC_FLOW_HASH) && defined(CONFIG_SCHED_CPU_MASK)
+	if (k_thread_cpu_pin(tid, (queue % NET_TC_FLOW_QUEUES) %
+			     arch_num_cpus()) < 0) {
+		NET_WARN("Cannot pin flow queue %d", queue);
+	}
+#else
+	ARG_UNUSED(tid);
+	ARG_UNUSED(queue);
+#endif
+}
+#endif
+
 /* Create a fifo for each traffic class we are using. All the network
  * traffic goes through these classes.
  */
@@ -293,12 +505,12 @@ void net_tc_tx_init(void)
 	net_if_foreach(net_tc_tx_stats_priority_setup, NULL);
 #endif
 
-	for (i = 0; i < NET_TC_TX_COUNT; i++) {
+	for (i = 0; i < NET_TC_TX_QUEUES; i++) {
 		uint8_t thread_priority;
 		int priority;
 		k_tid_t tid;
 
-		thread_priority = tx_tc2thread(i);
+		thread_priority = tx_tc2thread(i / NET_TC_FLOW_QUEUES);
 
 		priority = IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE) ?
 			K_PRIO_COOP(thread_priority) :
@@ -328,10 +540,19 @@ void net_tc_tx_init(void)
 		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
 			char name[MAX_NAME_LEN];
 
-			snprintk(name, sizeof(name), "tx_q[%d]", i);
+			if (NET_TC_FLOW_QUEUES > 1) {
+				snprintk(name, sizeof(name), "tx_q[%d.%d]",
+					 i / NET_TC_FLOW_QUEUES,
+					 i % NET_TC_FLOW_QUEUES);
+			} else {
+				snprintk(name, sizeof(name), "tx_q[%d]", i);
+			}
+
 			k_thread_name_set(tid, name);
 		}
 
+		flow_queue_pin(tid, i);
+
 		k_thread_start(tid);
 	}
 #endif
@@ -351,12 +572,12 @@ void net_tc_rx_init(void)
 	net_if_foreach(net_tc_rx_stats_priority_setup, NULL);
 #endif
 
-	for (i = 0; i < NET_TC_RX_COUNT; i++) {
+	for (i = 0; i < NET_TC_RX_QUEUES; i++) {
 		uint8_t thread_priority;
 		int priority;
 		k_tid_t tid;
 
-		thread_priority = rx_tc2thread(i);
+		thread_priority = rx_tc2thread(i / NET_TC_FLOW_QUEUES);
 
 		priority = IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE) ?
 			K_PRIO_COOP(thread_priority) :
@@ -386,10 +607,19 @@ void net_tc_rx_init(void)
 		if (IS_ENABLED(CONFIG_THREAD_NAME)) {
 			char name[MAX_NAME_LEN];
 
-			snprintk(name, sizeof(name), "rx_q[%d]", i);
+			if (NET_TC_FLOW_QUEUES > 1) {
+				snprintk(name, sizeof(name), "rx_q[%d.%d]",
+					 i / NET_TC_FLOW_QUEUES,
+					 i % NET_TC_FLOW_QUEUES);
+			} else {
+				snprintk(name, sizeof(name), "rx_q[%d]", i);
+			}
+
 			k_thread_name_set(tid, name);
 		}
 
+		flow_queue_pin(tid, i);
+
 		k_thread_start(tid);
 	}
 #endif
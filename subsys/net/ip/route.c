@@ -28,6 +28,7 @@ LOG_MODULE_REGISTER(net_route, CONFIG_NET_ROUTE_LOG_LEVEL);
 #include "icmpv6.h"
 #include "nbr.h"
 #include "route.h"
+#include "net_stats.h"
 
 #if !defined(NET_ROUTE_EXTRA_DATA_SIZE)
 #define NET_ROUTE_EXTRA_DATA_SIZE 0
@@ -276,34 +277,302 @@ static inline void update_route_access(struct net_route_entry *route)
 	sys_slist_prepend(&routes, &route->node);
 }
 
-struct net_route_entry *net_route_lookup(struct net_if *iface,
-					 struct in6_addr *dst)
+/* The routes are kept in a path compressed binary trie for the longest
+ * prefix match. A node holds the routes to its prefix, typically one per
+ * interface. Nodes without routes only exist to branch and always have
+ * two children, so there are less than two nodes per route.
+ */
+struct route_trie_node {
+	struct route_trie_node *child[2];
+	sys_slist_t routes;
+	struct in6_addr prefix;
+	uint8_t prefix_len;
+};
+
+static struct route_trie_node route_trie_nodes[2 * CONFIG_NET_MAX_ROUTES];
+static struct route_trie_node *route_trie_free;
+static struct route_trie_node *route_trie_root;
+
+static inline int addr_bit(const struct in6_addr *addr, uint8_t bit)
 {
-	struct net_route_entry *route, *found = NULL;
-	uint8_t longest_match = 0U;
-	int i;
+	return (addr->s6_addr[bit / 8] >> (7 - bit % 8)) & 1;
+}
 
-	k_mutex_lock(&lock, K_FOREVER);
+static uint8_t common_prefix_len(const struct in6_addr *a,
+				 const struct in6_addr *b, uint8_t max_len)
+{
+	uint8_t len = 0U;
 
-	for (i = 0; i < CONFIG_NET_MAX_ROUTES && longest_match < 128; i++) {
-		struct net_nbr *nbr = get_nbr(i);
+	for (int i = 0; i < sizeof(a->s6_addr) && len < max_len; i++) {
+		uint8_t diff = a->s6_addr[i] ^ b->s6_addr[i];
 
-		if (!nbr->ref) {
-			continue;
+		if (diff) {
+			while (!(diff & 0x80)) {
+				diff <<= 1;
+				len++;
+			}
+
+			break;
 		}
 
-		if (iface && nbr->iface != iface) {
-			continue;
+		len += 8U;
+	}
+
+	return MIN(len, max_len);
+}
+
+static struct route_trie_node *route_trie_node_alloc(const struct in6_addr *prefix,
+						     uint8_t prefix_len)
+{
+	struct route_trie_node *node = route_trie_free;
+
+	if (!node) {
+		return NULL;
+	}
+
+	route_trie_free = node->child[0];
+
+	node->child[0] = NULL;
+	node->child[1] = NULL;
+	sys_slist_init(&node->routes);
+	net_ipaddr_copy(&node->prefix, prefix);
+	node->prefix_len = prefix_len;
+
+	return node;
+}
+
+static void route_trie_node_free(struct route_trie_node *node)
+{
+	node->child[0] = route_trie_free;
+	route_trie_free = node;
+}
+
+static void route_trie_init(void)
+{
+	route_trie_root = NULL;
+	route_trie_free = NULL;
+
+	for (int i = 0; i < ARRAY_SIZE(route_trie_nodes); i++) {
+		route_trie_node_free(&route_trie_nodes[i]);
+	}
+}
+
+static int route_trie_add(struct net_route_entry *route)
+{
+	struct route_trie_node **link = &route_trie_root;
+	struct route_trie_node *node, *branch;
+	uint8_t len = route->prefix_len;
+	uint8_t common = 0U;
+
+	while ((node = *link) != NULL) {
+		common = common_prefix_len(&route->addr, &node->prefix,
+					   MIN(len, node->prefix_len));
+		if (common < node->prefix_len) {
+			break;
 		}
 
-		route = net_route_data(nbr);
+		if (node->prefix_len == len) {
+			goto add;
+		}
+
+		link = &node->child[addr_bit(&route->addr, node->prefix_len)];
+	}
+
+	node = route_trie_node_alloc(&route->addr, len);
+	if (!node) {
+		return -ENOMEM;
+	}
+
+	if (*link == NULL) {
+		*link = node;
+	} else if (common == len) {
+		/* The new prefix covers the subtree at link */
+		node->child[addr_bit(&(*link)->prefix, len)] = *link;
+		*link = node;
+	} else {
+		/* The prefixes diverge, branch at the common part */
+		branch = route_trie_node_alloc(&route->addr, common);
+		if (!branch) {
+			route_trie_node_free(node);
+			return -ENOMEM;
+		}
+
+		branch->child[addr_bit(&(*link)->prefix, common)] = *link;
+		branch->child[addr_bit(&route->addr, common)] = node;
+		*link = branch;
+	}
+
+add:
+	sys_slist_append(&node->routes, &route->prefix_node);
+
+	return 0;
+}
+
+static inline struct route_trie_node *route_trie_only_child(struct route_trie_node *node)
+{
+	return node->child[0] ? node->child[0] : node->child[1];
+}
+
+static void route_trie_del(struct net_route_entry *route)
+{
+	struct route_trie_node **parent_link = NULL;
+	struct route_trie_node **link = &route_trie_root;
+	struct route_trie_node *node, *parent;
+
+	while ((node = *link) != NULL && node->prefix_len < route->prefix_len) {
+		parent_link = link;
+		link = &node->child[addr_bit(&route->addr, node->prefix_len)];
+	}
+
+	if (!node || !sys_slist_find_and_remove(&node->routes,
+						&route->prefix_node)) {
+		return;
+	}
+
+	if (!sys_slist_is_empty(&node->routes) ||
+	    (node->child[0] && node->child[1])) {
+		return;
+	}
+
+	*link = route_trie_only_child(node);
+	route_trie_node_free(node);
+
+	/* The parent might now be a branch with a single child */
+	if (parent_link) {
+		parent = *parent_link;
+
+		if (sys_slist_is_empty(&parent->routes) &&
+		    !(parent->child[0] && parent->child[1])) {
+			*parent_link = route_trie_only_child(parent);
+			route_trie_node_free(parent);
+		}
+	}
+}
+
+static struct net_route_entry *route_trie_lookup(struct net_if *iface,
+						 const struct in6_addr *dst)
+{
+	struct route_trie_node *node = route_trie_root;
+	struct net_route_entry *route, *found = NULL;
+
+	/* Routes found deeper in the trie have longer prefixes */
+	while (node && net_ipv6_is_prefix(dst->s6_addr, node->prefix.s6_addr,
+					  node->prefix_len)) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&node->routes, route, prefix_node) {
+			if (!iface || route->iface == iface) {
+				found = route;
+				break;
+			}
+		}
 
-		if (route->prefix_len >= longest_match &&
-		    net_ipv6_is_prefix(dst->s6_addr,
-				       route->addr.s6_addr,
-				       route->prefix_len)) {
-			found = route;
-			longest_match = route->prefix_len;
+		if (node->prefix_len == 128U) {
+			break;
+		}
+
+		node = node->child[addr_bit(dst, node->prefix_len)];
+	}
+
+	return found;
+}
+
+/* Find the route to exactly this prefix */
+static struct net_route_entry *route_trie_find(struct net_if *iface,
+					       const struct in6_addr *addr,
+					       uint8_t prefix_len)
+{
+	struct route_trie_node *node = route_trie_root;
+	struct net_route_entry *route;
+
+	while (node && node->prefix_len <= prefix_len &&
+	       net_ipv6_is_prefix(addr->s6_addr, node->prefix.s6_addr,
+				  node->prefix_len)) {
+		if (node->prefix_len == prefix_len) {
+			SYS_SLIST_FOR_EACH_CONTAINER(&node->routes, route,
+						     prefix_node) {
+				if (route->iface == iface) {
+					return route;
+				}
+			}
+
+			break;
+		}
+
+		node = node->child[addr_bit(addr, node->prefix_len)];
+	}
+
+	return NULL;
+}
+
+#if CONFIG_NET_ROUTE_DST_CACHE_SIZE > 0
+struct route_dst_cache_entry {
+	struct net_if *iface;
+	struct net_route_entry *route;
+	struct in6_addr dst;
+};
+
+static struct route_dst_cache_entry dst_cache[CONFIG_NET_ROUTE_DST_CACHE_SIZE];
+
+static struct route_dst_cache_entry *dst_cache_slot(struct net_if *iface,
+						    const struct in6_addr *dst)
+{
+	uint32_t key = UNALIGNED_GET(&dst->s6_addr32[2]) ^
+		       UNALIGNED_GET(&dst->s6_addr32[3]) ^
+		       (uint32_t)(uintptr_t)iface;
+
+	return &dst_cache[((key * 0x9e3779b1U) >> 16) %
+			  CONFIG_NET_ROUTE_DST_CACHE_SIZE];
+}
+
+static struct net_route_entry *dst_cache_get(struct net_if *iface,
+					     const struct in6_addr *dst)
+{
+	struct route_dst_cache_entry *entry = dst_cache_slot(iface, dst);
+
+	if (entry->route && entry->iface == iface &&
+	    net_ipv6_addr_cmp(&entry->dst, dst)) {
+		return entry->route;
+	}
+
+	return NULL;
+}
+
+static void dst_cache_set(struct net_if *iface, const struct in6_addr *dst,
+			  struct net_route_entry *route)
+{
+	struct route_dst_cache_entry *entry = dst_cache_slot(iface, dst);
+
+	entry->iface = iface;
+	entry->route = route;
+	net_ipaddr_copy(&entry->dst, dst);
+}
+
+/* The cached routes might be gone or no longer be the best match */
+static void dst_cache_flush(void)
+{
+	memset(dst_cache, 0, sizeof(dst_cache));
+}
+#else
+#define dst_cache_get(...) NULL
+#define dst_cache_set(...)
+#define dst_cache_flush(...)
+#endif /* CONFIG_NET_ROUTE_DST_CACHE_SIZE > 0 */
+
+struct net_route_entry *net_route_lookup(struct net_if *iface,
+					 struct in6_addr *dst)
+{
+	struct net_route_entry *found;
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	net_stats_update_ipv6_route_lookup(iface);
+
+	found = dst_cache_get(iface, dst);
+	if (found) {
+		net_stats_update_ipv6_route_cache_hit(iface);
+	} else {
+		found = route_trie_lookup(iface, dst);
+		if (found) {
+			dst_cache_set(iface, dst, found);
 		}
 	}
 
@@ -311,6 +580,8 @@ struct net_route_entry *net_route_lookup(struct net_if *iface,
 		net_route_info("Found", found, dst);
 
 		update_route_access(found);
+	} else {
+		net_stats_update_ipv6_route_not_found(iface);
 	}
 
 	k_mutex_unlock(&lock);
@@ -370,7 +641,8 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 			net_sprint_ll_addr(nexthop_lladdr->addr, nexthop_lladdr->len));
 	}
 
-	route = net_route_lookup(iface, addr);
+	/* A route to a longer or shorter prefix is a different route */
+	route = route_trie_find(iface, addr, prefix_len);
 	if (route) {
 		/* Update nexthop if not the same */
 		struct in6_addr *nexthop_addr;
@@ -464,6 +736,16 @@ struct net_route_entry *net_route_add(struct net_if *iface,
 	sys_slist_init(&route->nexthop);
 	sys_slist_prepend(&route->nexthop, &nexthop_route->node);
 
+	if (route_trie_add(route) < 0) {
+		/* Cannot happen as there are enough nodes for all routes */
+		NET_ERR("Cannot add route to the prefix trie");
+		net_route_del(route);
+		route = NULL;
+		goto exit;
+	}
+
+	dst_cache_flush();
+
 	net_route_info("Added", route, addr);
 
 #if defined(CONFIG_NET_MGMT_EVENT_INFO)
@@ -597,6 +879,9 @@ int net_route_del(struct net_route_entry *route)
 
 	sys_slist_find_and_remove(&routes, &route->node);
 
+	route_trie_del(route);
+	dst_cache_flush();
+
 	nbr = net_route_get_nbr(route);
 	if (!nbr) {
 		k_mutex_unlock(&lock);
@@ -1100,5 +1385,7 @@ void net_route_init(void)
 	NET_DBG("Allocated %d nexthop entries (%zu bytes)",
 		CONFIG_NET_MAX_NEXTHOPS, sizeof(net_route_nexthop_pool));
 
+	route_trie_init();
+
 	k_work_init_delayable(&route_lifetime_timer, route_lifetime_timeout);
 }
@@ -52,6 +52,9 @@ struct net_route_entry {
 	/** List of neighbors that the routes go through. */
 	sys_slist_t nexthop;
 
+	/** Node in the list of routes sharing the same prefix. */
+	sys_snode_t prefix_node;
+
 	/** Network interface for the route. */
 	struct net_if *iface;
 
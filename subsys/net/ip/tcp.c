@@ -62,10 +62,6 @@ static int tcp_tx_window =
 #define TCP_RTO_MS (tcp_rto)
 #endif
 
-/* Define the number of MSS sections the congestion window is initialized at */
-#define TCP_CONGESTION_INITIAL_WIN 1
-#define TCP_CONGESTION_INITIAL_SSTHRESH 3
-
 static sys_slist_t tcp_conns = SYS_SLIST_STATIC_INIT(&tcp_conns);
 
 static K_MUTEX_DEFINE(tcp_lock);
@@ -439,7 +435,7 @@ static void tcp_new_reno_dup_ack(struct tcp *conn)
 	int32_t new_win = conn->ca.cwnd;
 
 	new_win += conn_mss(conn);
-	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+	conn->ca.cwnd = MIN(new_win, (int32_t)NET_TCP_MAX_WIN);
 	tcp_new_reno_log(conn, "dup_ack");
 }
 
@@ -455,7 +451,7 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 			/* Implement a div_ceil	to avoid rounding to 0 */
 			new_win += ((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd;
 		}
-		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+		conn->ca.cwnd = MIN(new_win, (int32_t)NET_TCP_MAX_WIN);
 	} else {
 		/* Check if it is still in fast recovery mode */
 		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
@@ -469,29 +465,98 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 	tcp_new_reno_log(conn, "pkts_acked");
 }
 
+static const struct tcp_ca_ops tcp_ca_new_reno = {
+	.name = "reno",
+	.init = tcp_new_reno_init,
+	.fast_retransmit = tcp_new_reno_fast_retransmit,
+	.timeout = tcp_new_reno_timeout,
+	.dup_ack = tcp_new_reno_dup_ack,
+	.pkts_acked = tcp_new_reno_pkts_acked,
+};
+
+static const struct tcp_ca_ops * const tcp_ca_algorithms[] = {
+	&tcp_ca_new_reno,
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+	&tcp_ca_cubic,
+#endif
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+	&tcp_ca_bbr,
+#endif
+};
+
+#if defined(CONFIG_NET_TCP_CONGESTION_DEFAULT_CUBIC)
+#define TCP_CA_DEFAULT (&tcp_ca_cubic)
+#elif defined(CONFIG_NET_TCP_CONGESTION_DEFAULT_BBR)
+#define TCP_CA_DEFAULT (&tcp_ca_bbr)
+#else
+#define TCP_CA_DEFAULT (&tcp_ca_new_reno)
+#endif
+
 static void tcp_ca_init(struct tcp *conn)
 {
-	tcp_new_reno_init(conn);
+	conn->ca_ops->init(conn);
 }
 
 static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
-	tcp_new_reno_fast_retransmit(conn);
+	conn->ca_ops->fast_retransmit(conn);
 }
 
 static void tcp_ca_timeout(struct tcp *conn)
 {
-	tcp_new_reno_timeout(conn);
+	conn->ca_ops->timeout(conn);
 }
 
 static void tcp_ca_dup_ack(struct tcp *conn)
 {
-	tcp_new_reno_dup_ack(conn);
+	conn->ca_ops->dup_ack(conn);
 }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	conn->ca_ops->pkts_acked(conn, acked_len);
+}
+
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
+{
+	const char *name = value;
+
+	len = strnlen(name, len);
+
+	for (int i = 0; i < ARRAY_SIZE(tcp_ca_algorithms); i++) {
+		const struct tcp_ca_ops *ops = tcp_ca_algorithms[i];
+
+		if (strlen(ops->name) != len || strncmp(ops->name, name, len) != 0) {
+			continue;
+		}
+
+		if (ops != conn->ca_ops) {
+			/* The current window is kept, the new algorithm
+			 * starts without any history.
+			 */
+			conn->ca_ops = ops;
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC) || defined(CONFIG_NET_TCP_CONGESTION_BBR)
+			memset(&conn->ca_priv, 0, sizeof(conn->ca_priv));
+#endif
+		}
+
+		return 0;
+	}
+
+	return -ENOENT;
+}
+
+/* As with Linux, the name is truncated to fit a short buffer */
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
+{
+	if (len == NULL) {
+		return -EINVAL;
+	}
+
+	*len = MIN(*len, strlen(conn->ca_ops->name) + 1);
+	memcpy(value, conn->ca_ops->name, *len);
+
+	return 0;
 }
 #else
 
@@ -505,6 +570,16 @@ static void tcp_ca_dup_ack(struct tcp *conn) { }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
 
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
+{
+	return -ENOPROTOOPT;
+}
+
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
+{
+	return -ENOPROTOOPT;
+}
+
 #endif
 
 static void tcp_send_queue_flush(struct tcp *conn)
@@ -807,7 +882,8 @@ static uint8_t *tcp_options_get(struct net_pkt *pkt, int tcp_options_len,
 }
 
 static bool tcp_options_check(struct tcp_options *recv_options,
-			      struct net_pkt *pkt, ssize_t len)
+			      struct tcp_sack *sack, struct net_pkt *pkt,
+			      ssize_t len, bool syn)
 {
 	uint8_t options_buf[40]; /* TCP header max options size is 40 */
 	bool result = len > 0 && ((len % 4) == 0) ? true : false;
@@ -817,8 +893,17 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
-	recv_options->wnd_found = false;
+	/* The MSS, window scale and SACK permitted options are only
+	 * meaningful in SYN segments, do not let any later segment
+	 * carrying other options reset them.
+	 */
+	if (syn) {
+		recv_options->mss_found = false;
+		recv_options->wnd_found = false;
+		recv_options->sack_perm_found = false;
+	}
+
+	sack->count = 0;
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -853,6 +938,10 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
+			if (!syn) {
+				break;
+			}
+
 			recv_options->mss =
 				ntohs(UNALIGNED_GET((uint16_t *)(options + 2)));
 			recv_options->mss_found = true;
@@ -864,8 +953,48 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 				goto end;
 			}
 
-			recv_options->window = opt;
+			if (!syn) {
+				break;
+			}
+
+			/* Larger shift counts are treated as the maximum,
+			 * RFC 7323 ch 2.3
+			 */
+			recv_options->window = MIN(options[2],
+						   NET_TCP_MAX_WINDOW_SCALE);
 			recv_options->wnd_found = true;
+			NET_DBG("WS=%hu", recv_options->window);
+			break;
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			if (syn) {
+				recv_options->sack_perm_found = true;
+			}
+
+			break;
+		case NET_TCP_SACK_OPT:
+			if (((opt_len - 2) % NET_TCP_SACK_BLOCK_SIZE) != 0 ||
+			    opt_len == 2) {
+				result = false;
+				goto end;
+			}
+
+			for (int i = 2; i < opt_len &&
+			     sack->count < NET_TCP_SACK_BLOCKS;
+			     i += NET_TCP_SACK_BLOCK_SIZE) {
+				struct tcp_sack_block *block =
+					&sack->blocks[sack->count++];
+
+				block->start = ntohl(UNALIGNED_GET(
+						(uint32_t *)(options + i)));
+				block->end = ntohl(UNALIGNED_GET(
+						(uint32_t *)(options + i + 4)));
+			}
+
 			break;
 		default:
 			continue;
@@ -1040,8 +1169,40 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 	return -EINVAL;
 }
 
+#if defined(CONFIG_NET_TCP_RECV_WINDOW_PRESSURE)
+/* Limit the window to half of the free RX data buffers, which all the
+ * connections share, but keep room for at least one segment.
+ */
+static uint32_t tcp_recv_win_pressure(struct tcp *conn, uint32_t win)
+{
+	struct net_buf_pool *rx_data;
+	uint32_t avail;
+
+	net_pkt_get_info(NULL, NULL, &rx_data, NULL);
+
+	avail = (uint32_t)atomic_get(&rx_data->avail_count) *
+		CONFIG_NET_BUF_DATA_SIZE / 2U;
+
+	return MIN(win, MAX(avail, (uint32_t)conn_mss(conn)));
+}
+#else
+#define tcp_recv_win_pressure(conn, win) (win)
+#endif
+
+static uint16_t tcp_recv_win_adv(struct tcp *conn, uint8_t flags)
+{
+	uint32_t win = tcp_recv_win_pressure(conn, conn->recv_win);
+
+	/* The window in SYN segments is never scaled, RFC 7323 ch 2.2 */
+	if (conn->wscale_ok && !(flags & SYN)) {
+		win >>= conn->rcv_wscale;
+	}
+
+	return MIN(win, UINT16_MAX);
+}
+
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, size_t options_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -1055,14 +1216,10 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, &th->th_sport);
 	UNALIGNED_PUT(conn->dst.sin.sin_port, &th->th_dport);
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + options_len / sizeof(uint32_t);
 
 	UNALIGNED_PUT(flags, &th->th_flags);
-	UNALIGNED_PUT(htons(conn->recv_win), &th->th_win);
+	UNALIGNED_PUT(htons(tcp_recv_win_adv(conn, flags)), &th->th_win);
 	UNALIGNED_PUT(htonl(seq), &th->th_seq);
 
 	if (ACK & flags) {
@@ -1139,6 +1296,159 @@ static int net_tcp_set_mss_opt(struct tcp *conn, struct net_pkt *pkt)
 	return net_pkt_set_data(pkt, &mss_opt_access);
 }
 
+static uint8_t tcp_rcv_wscale_get(struct tcp *conn)
+{
+	uint8_t shift = 0;
+
+	while (shift < NET_TCP_MAX_WINDOW_SCALE &&
+	       (conn->recv_win_max >> shift) > UINT16_MAX) {
+		shift++;
+	}
+
+	return shift;
+}
+
+/* Add a block of out-of-order data to the SACK blocks to send. The block
+ * holding the most recently received data goes first (RFC 2018 section 4),
+ * the others follow in sequence order as long as there is room.
+ */
+static void tcp_sack_block_add(struct tcp *conn, struct tcp_sack *sack,
+			       uint32_t start, uint32_t end)
+{
+	if (net_tcp_seq_cmp(conn->recv_ooo_seq, start) >= 0 &&
+	    net_tcp_seq_cmp(conn->recv_ooo_seq, end) < 0) {
+		memmove(&sack->blocks[1], &sack->blocks[0],
+			MIN(sack->count, NET_TCP_SACK_BLOCKS - 1) *
+			sizeof(struct tcp_sack_block));
+		sack->count = MIN(sack->count + 1, NET_TCP_SACK_BLOCKS);
+		sack->blocks[0].start = start;
+		sack->blocks[0].end = end;
+	} else if (sack->count < NET_TCP_SACK_BLOCKS) {
+		sack->blocks[sack->count].start = start;
+		sack->blocks[sack->count].end = end;
+		sack->count++;
+	}
+}
+
+/* Collect the out-of-order data held in the receive queue as SACK blocks */
+static void tcp_sack_blocks_get(struct tcp *conn, struct net_pkt *data,
+				uint8_t flags, struct tcp_sack *sack)
+{
+	struct net_buf *buf;
+	uint32_t start;
+	uint32_t end;
+
+	sack->count = 0;
+
+	/* Only pure acknowledgements carry the SACK option, so that data
+	 * segments never exceed the MSS.
+	 */
+	if (!conn->sack_ok || data || !(flags & ACK) || (flags & (SYN | RST)) ||
+	    !conn->queue_recv_data || !conn->queue_recv_data->buffer) {
+		return;
+	}
+
+	buf = conn->queue_recv_data->buffer;
+	start = tcp_get_seq(buf);
+	end = start + buf->len;
+
+	for (buf = buf->frags; buf; buf = buf->frags) {
+		uint32_t seq = tcp_get_seq(buf);
+
+		if (seq != end) {
+			tcp_sack_block_add(conn, sack, start, end);
+			start = seq;
+			end = seq;
+		}
+
+		end += buf->len;
+	}
+
+	tcp_sack_block_add(conn, sack, start, end);
+}
+
+/* Length of the options following the TCP header, a multiple of 4 */
+static size_t tcp_options_len_get(struct tcp *conn, uint8_t flags,
+				  const struct tcp_sack *sack)
+{
+	size_t len = 0;
+
+	if (conn->send_options.mss_found) {
+		len += NET_TCP_MSS_SIZE;
+	}
+
+	/* Window scaling and SACK are offered in a SYN, and accepted in
+	 * a SYN-ACK only if the peer offered them.
+	 */
+	if (flags & SYN) {
+		if (IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE) &&
+		    (!(flags & ACK) || conn->wscale_ok)) {
+			len += NET_TCP_NOP_SIZE + NET_TCP_WINDOW_SCALE_SIZE;
+		}
+
+		if (IS_ENABLED(CONFIG_NET_TCP_SACK) &&
+		    (!(flags & ACK) || conn->sack_ok)) {
+			len += 2 * NET_TCP_NOP_SIZE + NET_TCP_SACK_PERM_SIZE;
+		}
+	}
+
+	if (sack->count > 0) {
+		len += 2 * NET_TCP_NOP_SIZE + 2 +
+		       sack->count * NET_TCP_SACK_BLOCK_SIZE;
+	}
+
+	return len;
+}
+
+/* Write the options that follow the MSS one */
+static int tcp_options_add(struct tcp *conn, struct net_pkt *pkt,
+			   uint8_t flags, const struct tcp_sack *sack)
+{
+	uint8_t options[40 - NET_TCP_MSS_SIZE];
+	size_t len = 0;
+
+	if (flags & SYN) {
+		if (IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE) &&
+		    (!(flags & ACK) || conn->wscale_ok)) {
+			conn->rcv_wscale = tcp_rcv_wscale_get(conn);
+
+			options[len++] = NET_TCP_NOP_OPT;
+			options[len++] = NET_TCP_WINDOW_SCALE_OPT;
+			options[len++] = NET_TCP_WINDOW_SCALE_SIZE;
+			options[len++] = conn->rcv_wscale;
+		}
+
+		if (IS_ENABLED(CONFIG_NET_TCP_SACK) &&
+		    (!(flags & ACK) || conn->sack_ok)) {
+			options[len++] = NET_TCP_NOP_OPT;
+			options[len++] = NET_TCP_NOP_OPT;
+			options[len++] = NET_TCP_SACK_PERM_OPT;
+			options[len++] = NET_TCP_SACK_PERM_SIZE;
+		}
+	}
+
+	if (sack->count > 0) {
+		options[len++] = NET_TCP_NOP_OPT;
+		options[len++] = NET_TCP_NOP_OPT;
+		options[len++] = NET_TCP_SACK_OPT;
+		options[len++] = 2 + sack->count * NET_TCP_SACK_BLOCK_SIZE;
+
+		for (int i = 0; i < sack->count; i++) {
+			UNALIGNED_PUT(htonl(sack->blocks[i].start),
+				      (uint32_t *)&options[len]);
+			UNALIGNED_PUT(htonl(sack->blocks[i].end),
+				      (uint32_t *)&options[len + 4]);
+			len += NET_TCP_SACK_BLOCK_SIZE;
+		}
+	}
+
+	if (len == 0) {
+		return 0;
+	}
+
+	return net_pkt_write(pkt, options, len);
+}
+
 static bool is_destination_local(struct net_pkt *pkt)
 {
 	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
@@ -1238,16 +1548,65 @@ err:
 	tcp_pkt_unref(rst);
 }
 
+#if defined(CONFIG_NET_TCP_GSO)
+/* Leave room for the largest IP and TCP headers */
+#define TCP_GSO_MAX_LEN (UINT16_MAX - 120)
+
+static bool tcp_gso_enabled(struct tcp *conn)
+{
+	return net_if_l2(conn->iface) == &NET_L2_GET_NAME(ETHERNET);
+}
+
+/* Unlike tcp_pkt_alloc(), the size of the packet is not limited by the
+ * MTU of the interface.
+ */
+static struct net_pkt *tcp_gso_pkt_alloc(struct tcp *conn, size_t len)
+{
+	struct net_pkt *pkt;
+	struct net_buf *buf;
+
+	pkt = tcp_pkt_alloc(conn, 0);
+	if (!pkt) {
+		return NULL;
+	}
+
+	net_pkt_set_iface(pkt, conn->iface);
+	net_pkt_set_family(pkt, net_context_get_family(conn->context));
+
+	while (net_pkt_available_buffer(pkt) < len) {
+		size_t frag_len = len - net_pkt_available_buffer(pkt);
+
+#if defined(CONFIG_NET_BUF_FIXED_DATA_SIZE)
+		frag_len = MIN(frag_len, CONFIG_NET_BUF_DATA_SIZE);
+#endif
+		buf = net_pkt_get_frag(pkt, frag_len, TCP_PKT_ALLOC_TIMEOUT);
+		if (!buf) {
+			tcp_pkt_unref(pkt);
+			return NULL;
+		}
+
+		net_pkt_append_buffer(pkt, buf);
+	}
+
+	return pkt;
+}
+#else
+#define tcp_gso_enabled(...) false
+#define tcp_gso_pkt_alloc(...) NULL
+#endif /* CONFIG_NET_TCP_GSO */
+
 static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
 	size_t alloc_len = sizeof(struct tcphdr);
+	size_t options_len;
+	struct tcp_sack sack;
 	struct net_pkt *pkt;
 	int ret = 0;
 
-	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
-	}
+	tcp_sack_blocks_get(conn, data, flags, &sack);
+	options_len = tcp_options_len_get(conn, flags, &sack);
+	alloc_len += options_len;
 
 	pkt = tcp_pkt_alloc(conn, alloc_len);
 	if (!pkt) {
@@ -1255,6 +1614,12 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
+	/* Every segment carries the options, keep the frames within the MTU */
+	if (data && tcp_gso_enabled(conn) &&
+	    net_pkt_get_len(data) > conn_mss(conn) - options_len) {
+		net_pkt_set_gso_size(pkt, conn_mss(conn) - options_len);
+	}
+
 	if (data) {
 		/* Append the data buffer to the pkt */
 		net_pkt_append_buffer(pkt, data->buffer);
@@ -1267,7 +1632,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	ret = tcp_header_add(conn, pkt, flags, seq, options_len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
@@ -1281,6 +1646,12 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	ret = tcp_options_add(conn, pkt, flags, &sack);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		goto out;
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1389,62 +1760,308 @@ static int tcp_unsent_len(struct tcp *conn)
 	return unsent_len;
 }
 
-static int tcp_send_data(struct tcp *conn)
+/* Largest amount of data to put in a single packet */
+static int tcp_send_seg_max(struct tcp *conn)
 {
-	int ret = 0;
-	int len;
-	struct net_pkt *pkt;
+	int mss = conn_mss(conn);
 
-	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
-	if (len < 0) {
-		ret = len;
-		goto out;
+#if defined(CONFIG_NET_TCP_GSO)
+	if (tcp_gso_enabled(conn)) {
+		return MIN(mss * CONFIG_NET_TCP_GSO_MAX_SEGS, TCP_GSO_MAX_LEN);
 	}
-	if (len == 0) {
-		NET_DBG("conn: %p no data to send", conn);
-		ret = -ENODATA;
-		goto out;
+#endif
+
+	return mss;
+}
+
+/* Send len bytes of the send_data queue starting at offset, relative to
+ * the oldest unacknowledged byte.
+ */
+static int tcp_send_data_segment(struct tcp *conn, int offset, int len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NET_TCP_GSO) && len > conn_mss(conn)) {
+		pkt = tcp_gso_pkt_alloc(conn, len);
+	} else {
+		pkt = tcp_pkt_alloc(conn, len);
 	}
 
-	pkt = tcp_pkt_alloc(conn, len);
 	if (!pkt) {
 		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
 		ret = -ENOBUFS;
 		goto out;
 	}
 
-	ret = tcp_pkt_peek(pkt, conn->send_data, conn->unacked_len, len);
+	ret = tcp_pkt_peek(pkt, conn->send_data, offset, len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		ret = -ENOBUFS;
 		goto out;
 	}
 
-	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + offset);
+
+	/* The data we want to send, has been moved to the send queue so we
+	 * can unref the head net_pkt. If there was an error, we need to remove
+	 * the packet anyway.
+	 */
+	tcp_pkt_unref(pkt);
+
+ out:
+	return ret;
+}
+
+static int tcp_send_data(struct tcp *conn)
+{
+	int mss = conn_mss(conn);
+	int ret = 0;
+	int len;
+
+	len = MIN(tcp_unsent_len(conn), tcp_send_seg_max(conn));
+	if (len < 0) {
+		ret = len;
+		goto out;
+	}
+	if (len == 0) {
+		NET_DBG("conn: %p no data to send", conn);
+		ret = -ENODATA;
+		goto out;
+	}
+
+	/* A packet holding several segments leaves the trailing partial
+	 * segment to the next call, so that Nagle's algorithm applies to it.
+	 */
+	if (len > mss) {
+		len -= len % mss;
+	}
+
+	ret = tcp_send_data_segment(conn, conn->unacked_len, len);
 	if (ret == 0) {
 		conn->unacked_len += len;
 
 		if (conn->data_mode == TCP_DATA_MODE_RESEND) {
 			net_stats_update_tcp_resent(conn->iface, len);
-			net_stats_update_tcp_seg_rexmit(conn->iface);
+			for (int i = 0; i < len; i += mss) {
+				net_stats_update_tcp_seg_rexmit(conn->iface);
+			}
 		} else {
 			net_stats_update_tcp_sent(conn->iface, len);
-			net_stats_update_tcp_seg_sent(conn->iface);
+			for (int i = 0; i < len; i += mss) {
+				net_stats_update_tcp_seg_sent(conn->iface);
+			}
 		}
 	}
 
-	/* The data we want to send, has been moved to the send queue so we
-	 * can unref the head net_pkt. If there was an error, we need to remove
-	 * the packet anyway.
-	 */
-	tcp_pkt_unref(pkt);
-
 	conn_send_data_dump(conn);
 
  out:
 	return ret;
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+
+/* Add a block to the scoreboard, which is kept sorted and free of
+ * overlapping blocks. If it is full, the highest block is dropped as it
+ * is the least useful one for finding the holes to retransmit.
+ */
+static void tcp_sack_insert(struct tcp_sack *sb, uint32_t start, uint32_t end)
+{
+	int i = 0;
+
+	while (i < sb->count) {
+		struct tcp_sack_block *block = &sb->blocks[i];
+
+		if (net_tcp_seq_cmp(block->end, start) < 0 ||
+		    net_tcp_seq_cmp(block->start, end) > 0) {
+			i++;
+			continue;
+		}
+
+		/* Merge the overlapping or adjacent block into the new one */
+		if (net_tcp_seq_cmp(block->start, start) < 0) {
+			start = block->start;
+		}
+
+		if (net_tcp_seq_cmp(block->end, end) > 0) {
+			end = block->end;
+		}
+
+		sb->count--;
+		memmove(block, block + 1, (sb->count - i) * sizeof(*block));
+	}
+
+	for (i = 0; i < sb->count; i++) {
+		if (net_tcp_seq_cmp(sb->blocks[i].start, start) > 0) {
+			break;
+		}
+	}
+
+	if (i == NET_TCP_SACK_BLOCKS) {
+		return;
+	}
+
+	if (sb->count == NET_TCP_SACK_BLOCKS) {
+		sb->count--;
+	}
+
+	memmove(&sb->blocks[i + 1], &sb->blocks[i],
+		(sb->count - i) * sizeof(sb->blocks[0]));
+	sb->blocks[i].start = start;
+	sb->blocks[i].end = end;
+	sb->count++;
+}
+
+static void tcp_sack_update(struct tcp *conn, const struct tcp_sack *sack)
+{
+	uint32_t snd_nxt = conn->seq + conn->unacked_len;
+
+	if (!conn->sack_ok || conn->data_mode != TCP_DATA_MODE_SEND) {
+		return;
+	}
+
+	for (int i = 0; i < sack->count; i++) {
+		const struct tcp_sack_block *block = &sack->blocks[i];
+
+		/* Only blocks within the data in flight are of any use */
+		if (!net_tcp_seq_greater(block->end, block->start) ||
+		    net_tcp_seq_cmp(block->start, conn->seq) < 0 ||
+		    net_tcp_seq_cmp(block->end, snd_nxt) > 0) {
+			NET_DBG("conn: %p ignoring SACK block %u-%u", conn,
+				block->start, block->end);
+			continue;
+		}
+
+		tcp_sack_insert(&conn->sack, block->start, block->end);
+	}
+}
+
+/* Retransmit at most one segment from the lowest hole in the scoreboard
+ * that has not been retransmitted yet, RFC 6675 ch 4 NextSeg() rule 1.
+ */
+static int tcp_sack_retransmit(struct tcp *conn)
+{
+	uint32_t seq = conn->sack_rexmit;
+
+	if (net_tcp_seq_cmp(seq, conn->seq) < 0) {
+		seq = conn->seq;
+	}
+
+	for (int i = 0; i < conn->sack.count; i++) {
+		const struct tcp_sack_block *block = &conn->sack.blocks[i];
+		int len;
+		int ret;
+
+		if (net_tcp_seq_cmp(seq, block->start) >= 0) {
+			if (net_tcp_seq_cmp(seq, block->end) < 0) {
+				seq = block->end;
+			}
+
+			continue;
+		}
+
+		len = MIN(block->start - seq, conn_mss(conn));
+
+		NET_DBG("conn: %p retransmitting hole %u len %d", conn, seq,
+			len);
+
+		ret = tcp_send_data_segment(conn, seq - conn->seq, len);
+		if (ret == 0) {
+			conn->sack_rexmit = seq + len;
+			net_stats_update_tcp_resent(conn->iface, len);
+			net_stats_update_tcp_seg_rexmit(conn->iface);
+		}
+
+		return ret;
+	}
+
+	return -ENODATA;
+}
+
+/* Start the loss recovery if the scoreboard shows what is missing,
+ * otherwise the plain fast retransmit is done by the caller.
+ */
+static bool tcp_sack_recovery_start(struct tcp *conn)
+{
+	if (conn->sack.count == 0) {
+		return false;
+	}
+
+	conn->sack_recovery = true;
+	conn->sack_recover = conn->seq + conn->unacked_len;
+	conn->sack_rexmit = conn->seq;
+
+	(void)tcp_sack_retransmit(conn);
+
+	return true;
+}
+
+/* Every further duplicate ACK in recovery lets one more segment out */
+static void tcp_sack_dup_ack(struct tcp *conn)
+{
+	if (conn->sack_recovery && conn->data_mode == TCP_DATA_MODE_SEND) {
+		(void)tcp_sack_retransmit(conn);
+	}
+}
+
+/* Called once conn->seq has advanced */
+static void tcp_sack_pkts_acked(struct tcp *conn)
+{
+	struct tcp_sack *sb = &conn->sack;
+	int i;
+
+	for (i = 0; i < sb->count; i++) {
+		if (net_tcp_seq_cmp(sb->blocks[i].end, conn->seq) > 0) {
+			break;
+		}
+	}
+
+	sb->count -= i;
+	memmove(&sb->blocks[0], &sb->blocks[i], sb->count * sizeof(sb->blocks[0]));
+
+	if (sb->count > 0 && net_tcp_seq_cmp(sb->blocks[0].start, conn->seq) < 0) {
+		sb->blocks[0].start = conn->seq;
+	}
+
+	if (!conn->sack_recovery) {
+		return;
+	}
+
+	if (net_tcp_seq_cmp(conn->seq, conn->sack_recover) >= 0) {
+		conn->sack_recovery = false;
+		return;
+	}
+
+	/* A partial acknowledgement, repair the next hole right away */
+	if (conn->data_mode == TCP_DATA_MODE_SEND) {
+		(void)tcp_sack_retransmit(conn);
+	}
+}
+
+/* After a retransmission timeout everything is sent again, RFC 2018 ch 8 */
+static void tcp_sack_timeout(struct tcp *conn)
+{
+	conn->sack.count = 0;
+	conn->sack_recovery = false;
+}
+
+#else
+
+static void tcp_sack_update(struct tcp *conn, const struct tcp_sack *sack) { }
+
+#ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
+static bool tcp_sack_recovery_start(struct tcp *conn) { return false; }
+
+static void tcp_sack_dup_ack(struct tcp *conn) { }
+#endif
+
+static void tcp_sack_pkts_acked(struct tcp *conn) { }
+
+static void tcp_sack_timeout(struct tcp *conn) { }
+
+#endif /* CONFIG_NET_TCP_SACK */
+
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
 static int tcp_send_queued_data(struct tcp *conn)
@@ -1541,6 +2158,7 @@ static void tcp_resend_data(struct k_work *work)
 
 	conn->data_mode = TCP_DATA_MODE_RESEND;
 	conn->unacked_len = 0;
+	tcp_sack_timeout(conn);
 
 	ret = tcp_send_data(conn);
 	conn->send_data_retries++;
@@ -1729,7 +2347,8 @@ static struct tcp *tcp_conn_alloc(void)
 	/* Initially set the congestion window at its max size, since only the MSS
 	 * is available as soon as the connection is established
 	 */
-	conn->ca.cwnd = UINT16_MAX;
+	conn->ca.cwnd = NET_TCP_MAX_WIN;
+	conn->ca_ops = TCP_CA_DEFAULT;
 #endif
 
 	/* The ISN value will be set when we get the connection attempt or
@@ -1853,6 +2472,10 @@ static enum net_verdict tcp_recv(struct net_conn *net_conn,
 		}
 
 		conn->accepted_conn = conn_old;
+#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
+		/* Use the congestion control selected for the listener */
+		conn->ca_ops = conn_old->ca_ops;
+#endif
 	}
  in:
 	if (conn) {
@@ -2146,12 +2769,28 @@ static bool check_seq_list(struct net_buf *buf)
 static void tcp_queue_recv_data(struct tcp *conn, struct net_pkt *pkt,
 				size_t len, uint32_t seq)
 {
+	uint32_t win_end = conn->ack + conn->recv_win;
 	uint32_t seq_start = seq;
 	bool inserted = false;
 	struct net_buf *tmp;
 
 	NET_DBG("conn: %p len %zd seq %u ack %u", conn, len, seq, conn->ack);
 
+	/* Only keep the data within the advertised receive window, so that the
+	 * queue never holds more than the receive buffer allows.
+	 */
+	if (net_tcp_seq_greater(seq + len, win_end)) {
+		uint32_t excess = (seq + len) - win_end;
+
+		if (excess >= len) {
+			NET_DBG("Data outside of the receive window, dropped");
+			return;
+		}
+
+		net_pkt_remove_tail(pkt, excess);
+		len -= excess;
+	}
+
 	tmp = pkt->buffer;
 
 	tcp_set_seq(tmp, seq);
@@ -2268,6 +2907,9 @@ static void tcp_queue_recv_data(struct tcp *conn, struct net_pkt *pkt,
 	}
 
 	if (inserted) {
+		/* Reported first in the SACK blocks */
+		conn->recv_ooo_seq = seq_start;
+
 		/* We need to keep the received data but free the pkt */
 		pkt->buffer = NULL;
 
@@ -2379,6 +3021,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 	struct net_pkt *recv_pkt;
 	void *recv_user_data;
 	struct k_fifo *recv_data_fifo;
+	struct tcp_sack sack = { .count = 0 };
 	size_t len;
 	int ret;
 	int close_status = 0;
@@ -2432,8 +3075,9 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
-	if (tcp_options_len && !tcp_options_check(&conn->recv_options, pkt,
-						  tcp_options_len)) {
+	if (tcp_options_len && !tcp_options_check(&conn->recv_options, &sack,
+						  pkt, tcp_options_len,
+						  fl & SYN)) {
 		NET_DBG("DROP: Invalid TCP option list");
 		tcp_out(conn, RST);
 		do_close = true;
@@ -2441,6 +3085,21 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		goto out;
 	}
 
+	if (th && (fl & SYN) &&
+	    (conn->state == TCP_LISTEN || conn->state == TCP_SYN_SENT)) {
+		/* Window scaling and SACK are used only if both ends sent
+		 * the option in their SYN.
+		 */
+		bool options = tcp_options_len > 0;
+
+		conn->wscale_ok = IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE) &&
+				  options && conn->recv_options.wnd_found;
+		conn->snd_wscale = conn->wscale_ok ?
+				   conn->recv_options.window : 0;
+		conn->sack_ok = IS_ENABLED(CONFIG_NET_TCP_SACK) && options &&
+				conn->recv_options.sack_perm_found;
+	}
+
 	if (th && (conn->state != TCP_LISTEN) && (conn->state != TCP_SYN_SENT) &&
 	    tcp_validate_seq(conn, th) && FL(&fl, &, SYN)) {
 		/* According to RFC 793, ch 3.9 Event Processing, receiving SYN
@@ -2458,6 +3117,10 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 
 	if (th) {
 		conn->send_win = ntohs(th_win(th));
+		if (conn->wscale_ok && !(fl & SYN)) {
+			conn->send_win <<= conn->snd_wscale;
+		}
+
 		if (conn->send_win > conn->send_win_max) {
 			NET_DBG("Lowering send window from %u to %u",
 				conn->send_win, conn->send_win_max);
@@ -2672,6 +3335,10 @@ next_state:
 			break;
 		}
 
+		if (th) {
+			tcp_sack_update(conn, &sack);
+		}
+
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 		if (th && (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0)) {
 			/* Only if there is pending data, increment the duplicate ack count */
@@ -2684,6 +3351,11 @@ next_state:
 					conn->dup_ack_cnt = MIN(conn->dup_ack_cnt + 1,
 						DUPLICATE_ACK_RETRANSMIT_TRHESHOLD + 1);
 					tcp_ca_dup_ack(conn);
+
+					if (conn->dup_ack_cnt >
+					    DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) {
+						tcp_sack_dup_ack(conn);
+					}
 				}
 			} else {
 				conn->dup_ack_cnt = 0;
@@ -2693,14 +3365,16 @@ next_state:
 			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
 			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
 				/* Apply a fast retransmit */
-				int temp_unacked_len = conn->unacked_len;
+				if (!tcp_sack_recovery_start(conn)) {
+					int temp_unacked_len = conn->unacked_len;
 
-				conn->unacked_len = 0;
+					conn->unacked_len = 0;
 
-				(void)tcp_send_data(conn);
+					(void)tcp_send_data(conn);
 
-				/* Restore the current transmission */
-				conn->unacked_len = temp_unacked_len;
+					/* Restore the current transmission */
+					conn->unacked_len = temp_unacked_len;
+				}
 
 				tcp_ca_fast_retransmit(conn);
 				if (tcp_window_full(conn)) {
@@ -2752,6 +3426,8 @@ next_state:
 			conn_seq(conn, + len_acked);
 			net_stats_update_tcp_seg_recv(conn->iface);
 
+			tcp_sack_pkts_acked(conn);
+
 			conn_send_data_dump(conn);
 
 			conn->send_data_retries = 0;
@@ -3593,7 +4269,11 @@ int net_tcp_finalize(struct net_pkt *pkt)
 
 	tcp_hdr->chksum = 0U;
 
-	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt))) {
+	/* The checksum of a packet to be segmented is calculated for each
+	 * segment, either by L2 or by the device.
+	 */
+	if (net_if_need_calc_tx_checksum(net_pkt_iface(pkt)) &&
+	    net_pkt_gso_size(pkt) == 0U) {
 		tcp_hdr->chksum = net_calc_chksum_tcp(pkt);
 	}
 
@@ -3607,6 +4287,7 @@ struct net_tcp_hdr *net_tcp_input(struct net_pkt *pkt,
 
 	if (IS_ENABLED(CONFIG_NET_TCP_CHECKSUM) &&
 	    net_if_need_calc_rx_checksum(net_pkt_iface(pkt)) &&
+	    !net_pkt_is_chksum_done(pkt) &&
 	    net_calc_chksum_tcp(pkt) != 0U) {
 		NET_DBG("DROP: checksum mismatch");
 		goto drop;
@@ -3959,6 +4640,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_NODELAY:
 		ret = set_tcp_nodelay(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -3984,6 +4668,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_NODELAY:
 		ret = get_tcp_nodelay(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
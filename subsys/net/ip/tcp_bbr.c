@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Simplified BBR congestion control. The bottleneck bandwidth and the
+ * minimum round trip time are estimated once per round trip and the
+ * congestion window is set to a multiple of their product. The stack
+ * does not pace its transmissions, so only the window is controlled.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+
+#include "tcp_internal.h"
+
+enum bbr_mode {
+	BBR_STARTUP,
+	BBR_DRAIN,
+	BBR_PROBE_BW,
+};
+
+/* Gains are scaled by 256 */
+#define BBR_UNIT 256
+#define BBR_HIGH_GAIN 739 /* 2 / ln(2) */
+#define BBR_DRAIN_GAIN 88 /* 1 / high gain */
+#define BBR_CWND_GAIN 512
+
+/* Minimum window, in segments */
+#define BBR_MIN_CWND 4
+
+/* Rounds without 25% bandwidth growth until the pipe is considered full */
+#define BBR_FULL_BW_ROUNDS 3
+#define BBR_FULL_BW_THRESH 320
+
+/* Lifetime of the bandwidth sample in rounds and of the RTT one in ms */
+#define BBR_BW_WIN_ROUNDS 10
+#define BBR_MIN_RTT_WIN_MS (10 * MSEC_PER_SEC)
+
+static const uint16_t bbr_pacing_gain[] = {
+	320, 192, 256, 256, 256, 256, 256, 256,
+};
+
+static void tcp_bbr_log(struct tcp *conn, char *step)
+{
+	NET_DBG("conn: %p, bbr %s, mode=%u, cwnd=%u, btl_bw=%u, min_rtt=%u",
+		conn, step, conn->ca_priv.bbr.mode, conn->ca.cwnd,
+		conn->ca_priv.bbr.btl_bw, conn->ca_priv.bbr.min_rtt);
+}
+
+static uint32_t tcp_bbr_bdp(struct tcp *conn, uint32_t gain)
+{
+	struct tcp_ca_bbr *bbr = &conn->ca_priv.bbr;
+	uint64_t bdp;
+
+	bdp = (uint64_t)bbr->btl_bw * bbr->min_rtt / MSEC_PER_SEC;
+
+	return MIN(bdp * gain / BBR_UNIT, NET_TCP_MAX_WIN);
+}
+
+static void tcp_bbr_round_start(struct tcp *conn, uint32_t snd_nxt)
+{
+	struct tcp_ca_bbr *bbr = &conn->ca_priv.bbr;
+
+	bbr->round_end = snd_nxt;
+	/* Avoid 0, it means there is no round in progress */
+	bbr->round_start = k_uptime_get_32() | 1;
+	bbr->round_delivered = 0;
+}
+
+static void tcp_bbr_init(struct tcp *conn)
+{
+	memset(&conn->ca_priv.bbr, 0, sizeof(conn->ca_priv.bbr));
+	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
+	conn->ca.ssthresh = NET_TCP_MAX_WIN;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	tcp_bbr_round_start(conn, conn->seq);
+	tcp_bbr_log(conn, "init");
+}
+
+static void tcp_bbr_fast_retransmit(struct tcp *conn)
+{
+	/* Loss is not a congestion signal for the model */
+	tcp_bbr_log(conn, "fast_retransmit");
+}
+
+static void tcp_bbr_timeout(struct tcp *conn)
+{
+	conn->ca.cwnd = conn_mss(conn);
+	tcp_bbr_log(conn, "timeout");
+}
+
+static void tcp_bbr_dup_ack(struct tcp *conn)
+{
+	ARG_UNUSED(conn);
+}
+
+static void tcp_bbr_update_model(struct tcp *conn)
+{
+	struct tcp_ca_bbr *bbr = &conn->ca_priv.bbr;
+	uint32_t now = k_uptime_get_32();
+	uint32_t rtt = MAX(now - bbr->round_start, 1);
+	uint32_t bw = (uint64_t)bbr->round_delivered * MSEC_PER_SEC / rtt;
+
+	bbr->round_count++;
+
+	if (bw >= bbr->btl_bw ||
+	    (uint16_t)(bbr->round_count - bbr->btl_bw_round) > BBR_BW_WIN_ROUNDS) {
+		bbr->btl_bw = bw;
+		bbr->btl_bw_round = bbr->round_count;
+	}
+
+	if (bbr->min_rtt == 0 || rtt <= bbr->min_rtt ||
+	    now - bbr->min_rtt_stamp > BBR_MIN_RTT_WIN_MS) {
+		bbr->min_rtt = rtt;
+		bbr->min_rtt_stamp = now;
+	}
+
+	switch (bbr->mode) {
+	case BBR_STARTUP:
+		if (bbr->btl_bw >= (uint64_t)bbr->full_bw * BBR_FULL_BW_THRESH / BBR_UNIT) {
+			bbr->full_bw = bbr->btl_bw;
+			bbr->full_bw_count = 0;
+		} else if (++bbr->full_bw_count >= BBR_FULL_BW_ROUNDS) {
+			bbr->mode = BBR_DRAIN;
+		}
+		break;
+	case BBR_DRAIN:
+		if (conn->unacked_len <= tcp_bbr_bdp(conn, BBR_UNIT)) {
+			bbr->mode = BBR_PROBE_BW;
+			bbr->cycle_idx = 0;
+		}
+		break;
+	case BBR_PROBE_BW:
+		bbr->cycle_idx = (bbr->cycle_idx + 1) % ARRAY_SIZE(bbr_pacing_gain);
+		break;
+	}
+}
+
+static void tcp_bbr_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_ca_bbr *bbr = &conn->ca_priv.bbr;
+	uint32_t ack = conn->seq + acked_len;
+	uint32_t gain;
+
+	bbr->round_delivered += acked_len;
+
+	if (bbr->round_start == 0) {
+		tcp_bbr_round_start(conn, conn->seq + conn->unacked_len);
+	} else if ((int32_t)(ack - bbr->round_end) >= 0) {
+		tcp_bbr_update_model(conn);
+		tcp_bbr_round_start(conn, conn->seq + conn->unacked_len);
+	}
+
+	if (bbr->btl_bw == 0 || bbr->min_rtt == 0) {
+		/* No model yet, grow like slow start */
+		conn->ca.cwnd = MIN(conn->ca.cwnd + acked_len, NET_TCP_MAX_WIN);
+		tcp_bbr_log(conn, "pkts_acked");
+		return;
+	}
+
+	switch (bbr->mode) {
+	case BBR_STARTUP:
+		gain = BBR_HIGH_GAIN;
+		break;
+	case BBR_DRAIN:
+		gain = BBR_DRAIN_GAIN;
+		break;
+	default:
+		gain = (uint32_t)BBR_CWND_GAIN * bbr_pacing_gain[bbr->cycle_idx] /
+		       BBR_UNIT;
+		break;
+	}
+
+	conn->ca.cwnd = MAX(tcp_bbr_bdp(conn, gain), conn_mss(conn) * BBR_MIN_CWND);
+	tcp_bbr_log(conn, "pkts_acked");
+}
+
+const struct tcp_ca_ops tcp_ca_bbr = {
+	.name = "bbr",
+	.init = tcp_bbr_init,
+	.fast_retransmit = tcp_bbr_fast_retransmit,
+	.timeout = tcp_bbr_timeout,
+	.dup_ack = tcp_bbr_dup_ack,
+	.pkts_acked = tcp_bbr_pkts_acked,
+};
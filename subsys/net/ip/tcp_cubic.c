@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* CUBIC congestion control, RFC 8312 */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+
+#include "tcp_internal.h"
+
+/* Multiplicative decrease factor, 0.7 scaled by 1024 */
+#define CUBIC_BETA 717
+
+/* Slope of the Reno friendly window, 3 * (1 - beta) / (1 + beta) scaled
+ * by 1024
+ */
+#define CUBIC_RENO_SLOPE 542
+
+/* Cube of the time in ms until the window grows back to w_max for each
+ * segment of window reduction, 1 / C with C = 0.4 segments/s^3
+ */
+#define CUBIC_K_CUBE_PER_SEG 2500000000ULL
+
+/* Bound the time difference so that its cube fits in 64 bits */
+#define CUBIC_MAX_DELTA_MS (1 << 20)
+
+static uint32_t cubic_root(uint64_t a)
+{
+	uint64_t x = 0;
+
+	for (int shift = 63 - 63 % 3; shift >= 0; shift -= 3) {
+		uint64_t b;
+
+		x <<= 1;
+		b = 3 * x * (x + 1) + 1;
+
+		if ((a >> shift) >= b) {
+			a -= b << shift;
+			x++;
+		}
+	}
+
+	return (uint32_t)x;
+}
+
+static void tcp_cubic_log(struct tcp *conn, char *step)
+{
+	NET_DBG("conn: %p, cubic %s, cwnd=%u, ssthresh=%u, w_max=%u, k=%u",
+		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
+		conn->ca_priv.cubic.w_max, conn->ca_priv.cubic.k);
+}
+
+static void tcp_cubic_init(struct tcp *conn)
+{
+	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
+	conn->ca.ssthresh = conn_mss(conn) * TCP_CONGESTION_INITIAL_SSTHRESH;
+	conn->ca.pending_fast_retransmit_bytes = 0;
+	memset(&conn->ca_priv.cubic, 0, sizeof(conn->ca_priv.cubic));
+	tcp_cubic_log(conn, "init");
+}
+
+static void tcp_cubic_reduce(struct tcp *conn)
+{
+	struct tcp_ca_cubic *cubic = &conn->ca_priv.cubic;
+
+	/* Fast convergence, release bandwidth to newer flows */
+	if (conn->ca.cwnd < cubic->w_max) {
+		cubic->w_max = (uint64_t)conn->ca.cwnd * (1024 + CUBIC_BETA) / 2048;
+	} else {
+		cubic->w_max = conn->ca.cwnd;
+	}
+
+	conn->ca.ssthresh = MAX(conn_mss(conn) * 2,
+				(uint64_t)conn->ca.cwnd * CUBIC_BETA / 1024);
+	cubic->epoch_start = 0;
+}
+
+static void tcp_cubic_fast_retransmit(struct tcp *conn)
+{
+	if (conn->ca.pending_fast_retransmit_bytes == 0) {
+		tcp_cubic_reduce(conn);
+		/* Account for the segments that left the network */
+		conn->ca.cwnd = conn_mss(conn) * 3 + conn->ca.ssthresh;
+		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
+		tcp_cubic_log(conn, "fast_retransmit");
+	}
+}
+
+static void tcp_cubic_timeout(struct tcp *conn)
+{
+	tcp_cubic_reduce(conn);
+	conn->ca.cwnd = conn_mss(conn);
+	tcp_cubic_log(conn, "timeout");
+}
+
+static void tcp_cubic_dup_ack(struct tcp *conn)
+{
+	conn->ca.cwnd = MIN(conn->ca.cwnd + conn_mss(conn), NET_TCP_MAX_WIN);
+	tcp_cubic_log(conn, "dup_ack");
+}
+
+static void tcp_cubic_avoidance(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_ca_cubic *cubic = &conn->ca_priv.cubic;
+	uint32_t mss = conn_mss(conn);
+	uint32_t cwnd = conn->ca.cwnd;
+	uint32_t now = k_uptime_get_32();
+	int64_t delta;
+	int64_t target;
+
+	if (cubic->epoch_start == 0) {
+		/* Avoid 0, it means there is no epoch */
+		cubic->epoch_start = now | 1;
+		cubic->w_est = cwnd;
+
+		if (cwnd < cubic->w_max) {
+			cubic->k = cubic_root((uint64_t)(cubic->w_max - cwnd) *
+					      CUBIC_K_CUBE_PER_SEG / mss);
+		} else {
+			cubic->k = 0;
+			cubic->w_max = cwnd;
+		}
+	}
+
+	delta = (int64_t)(now - cubic->epoch_start) - cubic->k;
+	delta = CLAMP(delta, -CUBIC_MAX_DELTA_MS, CUBIC_MAX_DELTA_MS);
+
+	/* W_cubic(t) = C * (t - K)^3 + W_max, in bytes */
+	target = cubic->w_max +
+		 (delta * delta * delta / (CUBIC_K_CUBE_PER_SEG / 1000)) *
+		 mss / 1000;
+
+	/* Do not grow by more than half of the window per round trip */
+	target = CLAMP(target, cwnd, cwnd + cwnd / 2);
+
+	/* Stay at least as aggressive as Reno would be */
+	cubic->w_est += (uint64_t)acked_len * mss * CUBIC_RENO_SLOPE / 1024 / cwnd;
+	if (cubic->w_est > target) {
+		target = cubic->w_est;
+	}
+
+	cwnd += (target - cwnd) * acked_len / cwnd;
+	conn->ca.cwnd = MIN(cwnd, NET_TCP_MAX_WIN);
+}
+
+static void tcp_cubic_pkts_acked(struct tcp *conn, uint32_t acked_len)
+{
+	if (conn->ca.pending_fast_retransmit_bytes > 0) {
+		/* Check if it is still in fast recovery mode */
+		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
+			conn->ca.pending_fast_retransmit_bytes = 0;
+			conn->ca.cwnd = conn->ca.ssthresh;
+		} else {
+			conn->ca.pending_fast_retransmit_bytes -= acked_len;
+			conn->ca.cwnd -= MIN(acked_len, conn->ca.cwnd - conn_mss(conn));
+		}
+	} else if (conn->ca.cwnd < conn->ca.ssthresh) {
+		conn->ca.cwnd += MIN(acked_len, conn_mss(conn));
+	} else {
+		tcp_cubic_avoidance(conn, acked_len);
+	}
+
+	tcp_cubic_log(conn, "pkts_acked");
+}
+
+const struct tcp_ca_ops tcp_ca_cubic = {
+	.name = "cubic",
+	.init = tcp_cubic_init,
+	.fast_retransmit = tcp_cubic_fast_retransmit,
+	.timeout = tcp_cubic_timeout,
+	.dup_ack = tcp_cubic_dup_ack,
+	.pkts_acked = tcp_cubic_pkts_acked,
+};
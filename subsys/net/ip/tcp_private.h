@@ -146,7 +146,7 @@
 #define conn_send_data_dump(_conn)                                             \
 	({                                                                     \
 		NET_DBG("conn: %p total=%zd, unacked_len=%d, "                 \
-			"send_win=%hu, mss=%hu",                               \
+			"send_win=%u, mss=%hu",                                \
 			(_conn), net_pkt_get_len((_conn)->send_data),          \
 			_conn->unacked_len, _conn->send_win,                   \
 			(uint16_t)conn_mss((_conn)));                          \
@@ -226,27 +226,113 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_BLOCK_SIZE   8
+
+/* Largest window shift count allowed by RFC 7323 ch 2.3 */
+#define NET_TCP_MAX_WINDOW_SCALE 14
+
+#if defined(CONFIG_NET_TCP_WINDOW_SCALE)
+#define NET_TCP_MAX_WIN ((uint32_t)UINT16_MAX << NET_TCP_MAX_WINDOW_SCALE)
+#else
+#define NET_TCP_MAX_WIN UINT16_MAX
+#endif
+
+/* At most 4 SACK blocks fit into the 40 bytes of TCP options */
+#define NET_TCP_SACK_BLOCKS 4
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
 	bool mss_found : 1;
 	bool wnd_found : 1;
+	bool sack_perm_found : 1;
+};
+
+struct tcp_sack_block {
+	uint32_t start; /* first sequence number of the block */
+	uint32_t end;   /* sequence number following the block */
+};
+
+struct tcp_sack {
+	struct tcp_sack_block blocks[NET_TCP_SACK_BLOCKS];
+	uint8_t count;
 };
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
+#define TCP_CONGESTION_INITIAL_WIN 1
+#define TCP_CONGESTION_INITIAL_SSTHRESH 3
+
+/* Longest congestion control algorithm name, including the terminator */
+#define TCP_CA_NAME_MAX 16
+
 struct tcp_collision_avoidance_reno {
-	uint16_t cwnd;
-	uint16_t ssthresh;
-	uint16_t pending_fast_retransmit_bytes;
+	uint32_t cwnd;
+	uint32_t ssthresh;
+	uint32_t pending_fast_retransmit_bytes;
+};
+
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+struct tcp_ca_cubic {
+	uint32_t w_max;       /* window before the last reduction */
+	uint32_t w_est;       /* window a Reno flow would have reached */
+	uint32_t k;           /* time in ms to get back to w_max */
+	uint32_t epoch_start; /* start of the growth epoch in ms, 0 if none */
+};
+#endif
+
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+struct tcp_ca_bbr {
+	uint32_t btl_bw;          /* bottleneck bandwidth in bytes/s */
+	uint32_t full_bw;         /* bandwidth used for the full pipe check */
+	uint32_t min_rtt;         /* minimum round trip time in ms */
+	uint32_t min_rtt_stamp;   /* when min_rtt was measured */
+	uint32_t round_end;       /* sequence number ending the round */
+	uint32_t round_start;     /* start of the round in ms */
+	uint32_t round_delivered; /* bytes acknowledged during the round */
+	uint16_t round_count;
+	uint16_t btl_bw_round;    /* round btl_bw was measured in */
+	uint8_t mode;
+	uint8_t full_bw_count;
+	uint8_t cycle_idx;
+};
+#endif
+
+struct tcp;
+
+/* Congestion control algorithm. Each one keeps the congestion window
+ * of the connection in conn->ca.cwnd up to date.
+ */
+struct tcp_ca_ops {
+	const char *name;
+	/* Connection established */
+	void (*init)(struct tcp *conn);
+	/* Loss detected by duplicate acknowledgements */
+	void (*fast_retransmit)(struct tcp *conn);
+	/* Retransmission timeout */
+	void (*timeout)(struct tcp *conn);
+	/* Duplicate acknowledgement received */
+	void (*dup_ack)(struct tcp *conn);
+	/* New data acknowledged, called before conn->seq is advanced */
+	void (*pkts_acked)(struct tcp *conn, uint32_t acked_len);
 };
+
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+extern const struct tcp_ca_ops tcp_ca_cubic;
+#endif
+
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+extern const struct tcp_ca_ops tcp_ca_bbr;
+#endif
 #endif
 
 struct tcp { /* TCP connection */
@@ -293,21 +379,43 @@ struct tcp { /* TCP connection */
 	enum tcp_data_mode data_mode;
 	uint32_t seq;
 	uint32_t ack;
-	uint16_t recv_win_max;
-	uint16_t recv_win;
-	uint16_t send_win_max;
-	uint16_t send_win;
+	uint32_t recv_win_max;
+	uint32_t recv_win;
+	uint32_t send_win_max;
+	uint32_t send_win;
+	uint32_t recv_ooo_seq; /* start of the last out-of-order data queued */
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack sack; /* SACK scoreboard of the sent data */
+	uint32_t sack_recover; /* highest seq sent when recovery started */
+	uint32_t sack_rexmit; /* next seq to retransmit during recovery */
+#endif
 #ifdef CONFIG_NET_TCP_RANDOMIZED_RTO
 	uint16_t rto;
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 	struct tcp_collision_avoidance_reno ca;
+	const struct tcp_ca_ops *ca_ops;
+#if defined(CONFIG_NET_TCP_CONGESTION_CUBIC) || defined(CONFIG_NET_TCP_CONGESTION_BBR)
+	union {
+#ifdef CONFIG_NET_TCP_CONGESTION_CUBIC
+		struct tcp_ca_cubic cubic;
+#endif
+#ifdef CONFIG_NET_TCP_CONGESTION_BBR
+		struct tcp_ca_bbr bbr;
+#endif
+	} ca_priv;
+#endif
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	uint8_t dup_ack_cnt;
 #endif
 	uint8_t zwp_retries;
+	uint8_t rcv_wscale; /* shift count applied to our advertised window */
+	uint8_t snd_wscale; /* shift count applied to the peer's window */
+	bool wscale_ok : 1;
+	bool sack_ok : 1;
+	bool sack_recovery : 1;
 	bool in_retransmission : 1;
 	bool in_connect : 1;
 	bool in_close : 1;
@@ -25,6 +25,7 @@ LOG_MODULE_REGISTER(net_ethernet, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
 #include "arp.h"
 #include "eth_stats.h"
 #include "net_private.h"
+#include "ipv4.h"
 #include "ipv6.h"
 #include "ipv4_autoconf_internal.h"
 #include "bridge.h"
@@ -598,6 +599,142 @@ static void ethernet_remove_l2_header(struct net_pkt *pkt)
 	net_pkt_frag_unref(buf);
 }
 
+#if defined(CONFIG_NET_TCP_GSO)
+/* Largest IP and TCP headers of a packet to be segmented */
+#define GSO_HDR_MAX_LEN (NET_IPV6H_LEN + 64 + 60)
+
+/* TCP flags only set in the last segment, FIN and PSH */
+#define GSO_LAST_SEG_FLAGS 0x09
+
+/* Split a TCP packet larger than the MTU into frames carrying at most
+ * gso_size bytes of payload. The IP and TCP headers of the packet are read
+ * once and used as the template of every frame, only the sequence number,
+ * the flags, the IPv4 ID, the lengths and the checksums differ between the
+ * frames.
+ */
+static int ethernet_gso_send(struct ethernet_context *ctx, struct net_if *iface,
+			     const struct ethernet_api *api, struct net_pkt *pkt,
+			     uint16_t ptype)
+{
+	size_t ip_len = net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt);
+	uint16_t gso_size = net_pkt_gso_size(pkt);
+	struct net_tcp_hdr *tcp_hdr;
+	uint8_t hdr[GSO_HDR_MAX_LEN];
+	size_t hdr_len, payload_len, seg_len;
+	struct net_ipv4_hdr *ipv4_hdr = NULL;
+	uint16_t ipv4_id = 0U;
+	uint32_t seq;
+	uint8_t flags;
+	int sent = 0;
+	int ret;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	hdr_len = ip_len + sizeof(struct net_tcp_hdr);
+	if (hdr_len > sizeof(hdr) || net_pkt_read(pkt, hdr, hdr_len)) {
+		return -EMSGSIZE;
+	}
+
+	tcp_hdr = (struct net_tcp_hdr *)(hdr + ip_len);
+	hdr_len = ip_len + (tcp_hdr->offset >> 4) * 4U;
+	if (hdr_len > sizeof(hdr) || hdr_len > net_pkt_get_len(pkt) ||
+	    net_pkt_read(pkt, tcp_hdr->optdata,
+			 hdr_len - ip_len - sizeof(struct net_tcp_hdr))) {
+		return -EMSGSIZE;
+	}
+
+	payload_len = net_pkt_get_len(pkt) - hdr_len;
+	seq = sys_get_be32(tcp_hdr->seq);
+	flags = tcp_hdr->flags;
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(pkt) == AF_INET) {
+		ipv4_hdr = (struct net_ipv4_hdr *)hdr;
+		ipv4_hdr->chksum = 0U;
+
+		/* Each frame needs its own ID, unless it may not be
+		 * fragmented (RFC 6864).
+		 */
+		if (sys_get_be16(ipv4_hdr->offset) & NET_IPV4_DO_NOT_FRAG_MASK) {
+			ipv4_hdr = NULL;
+		} else {
+			ipv4_id = sys_get_be16(ipv4_hdr->id);
+		}
+	}
+
+	for (size_t offset = 0; offset < payload_len; offset += seg_len) {
+		struct net_pkt *seg;
+
+		seg_len = MIN(gso_size, payload_len - offset);
+
+		seg = net_pkt_alloc_with_buffer(iface, hdr_len + seg_len,
+						AF_UNSPEC, 0, NET_BUF_TIMEOUT);
+		if (!seg) {
+			return -ENOMEM;
+		}
+
+		net_pkt_set_family(seg, net_pkt_family(pkt));
+		net_pkt_set_ip_hdr_len(seg, net_pkt_ip_hdr_len(pkt));
+		net_pkt_set_ipv4_opts_len(seg, net_pkt_ipv4_opts_len(pkt));
+		net_pkt_set_ipv6_ext_len(seg, net_pkt_ipv6_ext_len(pkt));
+		net_pkt_set_ipv6_next_hdr(seg, net_pkt_ipv6_next_hdr(pkt));
+		net_pkt_set_vlan_tci(seg, net_pkt_vlan_tci(pkt));
+		net_pkt_set_priority(seg, net_pkt_priority(pkt));
+		*net_pkt_lladdr_src(seg) = *net_pkt_lladdr_src(pkt);
+		*net_pkt_lladdr_dst(seg) = *net_pkt_lladdr_dst(pkt);
+
+		sys_put_be32(seq + offset, tcp_hdr->seq);
+
+		if (ipv4_hdr != NULL) {
+			sys_put_be16(ipv4_id++, ipv4_hdr->id);
+		}
+
+		if (offset + seg_len < payload_len) {
+			tcp_hdr->flags = flags & ~GSO_LAST_SEG_FLAGS;
+		} else {
+			tcp_hdr->flags = flags;
+		}
+
+		if (net_pkt_write(seg, hdr, hdr_len) ||
+		    net_pkt_copy(seg, pkt, seg_len)) {
+			net_pkt_unref(seg);
+			return -ENOBUFS;
+		}
+
+		/* Set the lengths and, unless the device does it, the
+		 * checksums of the frame.
+		 */
+		net_pkt_cursor_init(seg);
+
+		if (IS_ENABLED(CONFIG_NET_IPV4) && net_pkt_family(seg) == AF_INET) {
+			ret = net_ipv4_finalize(seg, IPPROTO_TCP);
+		} else {
+			ret = net_ipv6_finalize(seg, IPPROTO_TCP);
+		}
+
+		if (ret < 0 || !ethernet_fill_header(ctx, seg, ptype)) {
+			net_pkt_unref(seg);
+			return -ENOBUFS;
+		}
+
+		net_pkt_cursor_init(seg);
+
+		ret = net_l2_send(api->send, net_if_get_device(iface), iface, seg);
+		if (ret != 0) {
+			eth_stats_update_errors_tx(iface);
+			net_pkt_unref(seg);
+			return ret;
+		}
+
+		ethernet_update_tx_stats(iface, seg);
+		sent += net_pkt_get_len(seg);
+		net_pkt_unref(seg);
+	}
+
+	return sent;
+}
+#endif /* CONFIG_NET_TCP_GSO */
+
 static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 {
 	const struct ethernet_api *api = net_if_get_device(iface)->api;
@@ -706,6 +843,20 @@ static int ethernet_send(struct net_if *iface, struct net_pkt *pkt)
 		set_vlan_priority(ctx, pkt);
 	}
 
+#if defined(CONFIG_NET_TCP_GSO)
+	/* Devices without segmentation offload get one frame per segment */
+	if (net_pkt_gso_size(pkt) > 0U &&
+	    !(net_eth_get_hw_capabilities(iface) & ETHERNET_HW_TSO)) {
+		ret = ethernet_gso_send(ctx, iface, api, pkt, ptype);
+		if (ret < 0) {
+			goto error;
+		}
+
+		net_pkt_unref(pkt);
+		return ret;
+	}
+#endif
+
 	/* Then set the ethernet header.
 	 */
 	if (!ethernet_fill_header(ctx, pkt, ptype)) {
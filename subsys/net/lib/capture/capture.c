@@ -10,6 +10,7 @@ LOG_MODULE_REGISTER(net_capture, CONFIG_NET_CAPTURE_LOG_LEVEL);
 #include <zephyr/kernel.h>
 #include <stdlib.h>
 #include <zephyr/sys/slist.h>
+#include <zephyr/sys/ring_buffer.h>
 #include <zephyr/net/net_core.h>
 #include <zephyr/net/net_ip.h>
 #include <zephyr/net/net_if.h>
@@ -94,8 +95,27 @@ struct net_capture {
 	 * Is this context initialized yet
 	 */
 	bool init_done : 1;
+
+#if defined(CONFIG_NET_CAPTURE_RING)
+	/**
+	 * Captured packets waiting for the export thread, each one
+	 * behind a struct capture_record.
+	 */
+	struct ring_buf ring;
+
+	uint8_t ring_data[CONFIG_NET_CAPTURE_RING_SIZE];
+#endif
+};
+
+#if defined(CONFIG_NET_CAPTURE_RING)
+struct capture_record {
+	/** Length of the data following the record */
+	uint16_t len;
 };
 
+static K_SEM_DEFINE(ring_sem, 0, 1);
+#endif
+
 static struct k_mem_slab *get_net_pkt(void)
 {
 	return &capture_pkts;
@@ -499,6 +519,114 @@ static int capture_disable(const struct device *dev)
 	return 0;
 }
 
+#if defined(CONFIG_NET_CAPTURE_RING)
+/* Copy the packet, up to the snap length, straight to the ring. Called
+ * with the lock held, so that there is a single writer.
+ */
+static void capture_ring_put(struct net_capture *ctx, struct net_pkt *pkt)
+{
+	struct capture_record record;
+	struct net_buf *buf;
+	size_t left;
+
+	record.len = MIN(net_pkt_get_len(pkt), CONFIG_NET_CAPTURE_RING_SNAPLEN);
+
+	if (ring_buf_space_get(&ctx->ring) < sizeof(record) + record.len) {
+		NET_DBG("Captured pkt %s", "dropped");
+		return;
+	}
+
+	(void)ring_buf_put(&ctx->ring, (uint8_t *)&record, sizeof(record));
+
+	for (buf = pkt->buffer, left = record.len; buf && left > 0;
+	     buf = buf->frags) {
+		size_t len = MIN(buf->len, left);
+
+		(void)ring_buf_put(&ctx->ring, buf->data, len);
+		left -= len;
+	}
+
+	k_sem_give(&ring_sem);
+}
+
+/* Send the packets of the ring through the tunnel, called from the export
+ * thread only, which is the single reader of the rings.
+ */
+static void capture_ring_export(struct net_capture *ctx)
+{
+	struct capture_record record;
+
+	while (ring_buf_get(&ctx->ring, (uint8_t *)&record,
+			    sizeof(record)) == sizeof(record)) {
+		struct net_pkt *pkt;
+		size_t left = record.len;
+
+		pkt = net_pkt_alloc_from_slab(get_net_pkt(), PKT_ALLOC_TIME);
+		if (pkt != NULL) {
+			net_pkt_set_context(pkt, ctx->context);
+			net_pkt_set_iface(pkt, ctx->tunnel_iface);
+
+			if (net_pkt_alloc_buffer(pkt, record.len, 0,
+						 PKT_ALLOC_TIME) < 0) {
+				net_pkt_unref(pkt);
+				pkt = NULL;
+			}
+		}
+
+		while (left > 0) {
+			uint8_t *data;
+			uint32_t len;
+
+			len = ring_buf_get_claim(&ctx->ring, &data, left);
+
+			if (pkt != NULL && net_pkt_write(pkt, data, len) < 0) {
+				net_pkt_unref(pkt);
+				pkt = NULL;
+			}
+
+			(void)ring_buf_get_finish(&ctx->ring, len);
+			left -= len;
+		}
+
+		if (pkt == NULL) {
+			NET_DBG("Captured pkt %s", "dropped");
+			continue;
+		}
+
+		if (net_capture_send(ctx->dev, ctx->tunnel_iface, pkt) < 0) {
+			net_pkt_unref(pkt);
+		}
+	}
+}
+
+static void capture_export_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		sys_snode_t *sn;
+
+		k_sem_take(&ring_sem, K_FOREVER);
+
+		/* The capture devices are never removed from the list. */
+		SYS_SLIST_FOR_EACH_NODE(&net_capture_devlist, sn) {
+			struct net_capture *ctx = CONTAINER_OF(sn, struct net_capture,
+							       node);
+
+			if (ctx->in_use) {
+				capture_ring_export(ctx);
+			}
+		}
+	}
+}
+
+K_THREAD_DEFINE(capture_export, CONFIG_NET_CAPTURE_RING_STACK_SIZE,
+		capture_export_thread, NULL, NULL, NULL,
+		K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+#endif /* CONFIG_NET_CAPTURE_RING */
+
 void net_capture_pkt(struct net_if *iface, struct net_pkt *pkt)
 {
 	struct k_mem_slab *orig_slab;
@@ -524,6 +652,14 @@ void net_capture_pkt(struct net_if *iface, struct net_pkt *pkt)
 			continue;
 		}
 
+#if defined(CONFIG_NET_CAPTURE_RING)
+		ARG_UNUSED(orig_slab);
+		ARG_UNUSED(captured);
+		ARG_UNUSED(ret);
+
+		capture_ring_put(ctx, pkt);
+		net_pkt_set_captured(pkt, true);
+#else
 		orig_slab = pkt->slab;
 		pkt->slab = get_net_pkt();
 
@@ -545,6 +681,7 @@ void net_capture_pkt(struct net_if *iface, struct net_pkt *pkt)
 		if (ret < 0) {
 			net_pkt_unref(captured);
 		}
+#endif
 
 		goto out;
 	}
@@ -565,6 +702,10 @@ static int capture_dev_init(const struct device *dev)
 	ctx->dev = dev;
 	ctx->init_done = true;
 
+#if defined(CONFIG_NET_CAPTURE_RING)
+	ring_buf_init(&ctx->ring, sizeof(ctx->ring_data), ctx->ring_data);
+#endif
+
 	k_mutex_unlock(&lock);
 
 	return 0;
@@ -1137,6 +1137,25 @@ static bool is_request(const struct coap_packet *cpkt)
 	return !(code & ~COAP_REQUEST_MASK);
 }
 
+static int handle_resource_request(struct coap_resource *resource,
+				   struct coap_packet *cpkt,
+				   struct sockaddr *addr, socklen_t addr_len)
+{
+	coap_method_t method;
+	uint8_t code;
+
+	code = coap_header_get_code(cpkt);
+	if (method_from_code(resource, code, &method) < 0) {
+		return -ENOTSUP;
+	}
+
+	if (!method) {
+		return -EPERM;
+	}
+
+	return method(resource, cpkt, addr, addr_len);
+}
+
 int coap_handle_request(struct coap_packet *cpkt,
 			struct coap_resource *resources,
 			struct coap_option *options,
@@ -1151,27 +1170,181 @@ int coap_handle_request(struct coap_packet *cpkt,
 
 	/* FIXME: deal with hierarchical resources */
 	for (resource = resources; resource && resource->path; resource++) {
-		coap_method_t method;
-		uint8_t code;
-
 		if (!uri_path_eq(cpkt, resource->path, options, opt_num)) {
 			continue;
 		}
 
-		code = coap_header_get_code(cpkt);
-		if (method_from_code(resource, code, &method) < 0) {
-			return -ENOTSUP;
+		return handle_resource_request(resource, cpkt, addr, addr_len);
+	}
+
+	NET_DBG("%d", __LINE__);
+	return -ENOENT;
+}
+
+static bool path_has_wildcard(const char * const *path)
+{
+	if (!IS_ENABLED(CONFIG_COAP_URI_WILDCARD)) {
+		return false;
+	}
+
+	for (; *path; path++) {
+		if (strcmp(*path, "+") == 0 || strcmp(*path, "#") == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Orders paths segment by segment, as strcmp() orders the segments. */
+static int path_cmp(const char * const *a, const char * const *b)
+{
+	int r;
+
+	for (; *a && *b; a++, b++) {
+		r = strcmp(*a, *b);
+		if (r) {
+			return r;
+		}
+	}
+
+	return (*a != NULL) - (*b != NULL);
+}
+
+/* Same order as path_cmp(), the request path being given by its options. */
+static int request_path_cmp(struct coap_option *options, uint8_t opt_num,
+			    const char * const *path)
+{
+	size_t len;
+	int r;
+
+	for (uint8_t i = 0U; i < opt_num; i++) {
+		if (options[i].delta != COAP_OPTION_URI_PATH) {
+			continue;
+		}
+
+		if (!*path) {
+			return 1;
 		}
 
-		if (!method) {
-			return -EPERM;
+		len = strlen(*path);
+
+		r = memcmp(options[i].value, *path, MIN(options[i].len, len));
+		if (r) {
+			return r;
+		}
+
+		if (options[i].len != len) {
+			return options[i].len < len ? -1 : 1;
 		}
 
-		return method(resource, cpkt, addr, addr_len);
+		path++;
 	}
 
-	NET_DBG("%d", __LINE__);
-	return -ENOENT;
+	return *path ? -1 : 0;
+}
+
+int coap_resource_index_init(struct coap_resource_index *index,
+			     struct coap_resource *resources,
+			     uint16_t *order, size_t order_len)
+{
+	size_t count = 0U;
+	size_t exact = 0U;
+	size_t j;
+
+	for (; resources[count].path; count++) {
+		if (count >= order_len || count >= UINT16_MAX) {
+			return -ENOMEM;
+		}
+	}
+
+	/* Insertion sort, stable so that the first of identical paths is
+	 * found first, as with coap_handle_request().
+	 */
+	for (size_t i = 0U; i < count; i++) {
+		if (path_has_wildcard(resources[i].path)) {
+			continue;
+		}
+
+		for (j = exact; j > 0; j--) {
+			if (path_cmp(resources[order[j - 1]].path,
+				     resources[i].path) <= 0) {
+				break;
+			}
+
+			order[j] = order[j - 1];
+		}
+
+		order[j] = i;
+		exact++;
+	}
+
+	/* Resources with wildcards follow, in their array order */
+	j = exact;
+	for (size_t i = 0U; i < count; i++) {
+		if (path_has_wildcard(resources[i].path)) {
+			order[j++] = i;
+		}
+	}
+
+	index->resources = resources;
+	index->order = order;
+	index->num_exact = exact;
+	index->num_resources = count;
+
+	return 0;
+}
+
+int coap_handle_request_index(struct coap_packet *cpkt,
+			      const struct coap_resource_index *index,
+			      struct coap_option *options,
+			      uint8_t opt_num,
+			      struct sockaddr *addr, socklen_t addr_len)
+{
+	const char * const *path;
+	uint16_t found = UINT16_MAX;
+	uint16_t low = 0U;
+	uint16_t high = index->num_exact;
+	uint16_t mid;
+
+	if (!is_request(cpkt)) {
+		return 0;
+	}
+
+	while (low < high) {
+		mid = low + (high - low) / 2U;
+		path = index->resources[index->order[mid]].path;
+
+		if (request_path_cmp(options, opt_num, path) > 0) {
+			low = mid + 1U;
+		} else {
+			high = mid;
+		}
+	}
+
+	if (low < index->num_exact &&
+	    request_path_cmp(options, opt_num,
+			     index->resources[index->order[low]].path) == 0) {
+		found = index->order[low];
+	}
+
+	/* A matching wildcard resource placed before in the array wins */
+	for (uint16_t i = index->num_exact;
+	     i < index->num_resources && index->order[i] < found; i++) {
+		path = index->resources[index->order[i]].path;
+
+		if (uri_path_eq(cpkt, path, options, opt_num)) {
+			found = index->order[i];
+			break;
+		}
+	}
+
+	if (found == UINT16_MAX) {
+		return -ENOENT;
+	}
+
+	return handle_resource_request(&index->resources[found], cpkt, addr,
+				       addr_len);
 }
 
 int coap_block_transfer_init(struct coap_block_context *ctx,
@@ -1803,6 +1976,52 @@ int coap_resource_notify(struct coap_resource *resource)
 	return 0;
 }
 
+int coap_resource_notify_packet(struct coap_resource *resource,
+				const struct coap_packet *cpkt,
+				coap_notify_send_t send, void *user_data)
+{
+	struct coap_observer *o;
+	uint8_t hdr[BASIC_HEADER_SIZE];
+	struct iovec iov[3];
+	struct msghdr msg = { 0 };
+	int r;
+
+	/* The token of each observer goes right after the header */
+	if (cpkt->hdr_len != BASIC_HEADER_SIZE) {
+		return -EINVAL;
+	}
+
+	memcpy(hdr, cpkt->data, sizeof(hdr));
+
+	iov[0].iov_base = hdr;
+	iov[0].iov_len = sizeof(hdr);
+	iov[2].iov_base = cpkt->data + BASIC_HEADER_SIZE;
+	iov[2].iov_len = cpkt->offset - BASIC_HEADER_SIZE;
+
+	msg.msg_iov = iov;
+	msg.msg_iovlen = ARRAY_SIZE(iov);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&resource->observers, o, list) {
+		hdr[0] = (cpkt->data[0] & 0xF0) | (o->tkl & 0xF);
+		sys_put_be16(coap_next_id(), &hdr[2]);
+
+		iov[1].iov_base = o->token;
+		iov[1].iov_len = o->tkl;
+
+		msg.msg_name = &o->addr;
+		msg.msg_namelen = o->addr.sa_family == AF_INET6 ?
+				  sizeof(struct sockaddr_in6) :
+				  sizeof(struct sockaddr_in);
+
+		r = send(resource, o, &msg, user_data);
+		if (r < 0) {
+			return r;
+		}
+	}
+
+	return 0;
+}
+
 bool coap_request_is_observe(const struct coap_packet *request)
 {
 	return coap_get_option_int(request, COAP_OPTION_OBSERVE) == 0;
@@ -0,0 +1,279 @@
+/** @file
+ * @brief DNS resolver response cache
+ *
+ * Keeps the answers of recent DNS queries until their TTL expires so
+ * that resolving the same name again does not need a network round trip.
+ */
+
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_dns_resolve, CONFIG_DNS_RESOLVER_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <errno.h>
+
+#include <zephyr/net/dns_resolve.h>
+#include "dns_cache.h"
+
+/* RFC 1035, 3.1. Name space definitions */
+#define DNS_CACHE_NAME_LEN 255
+
+struct dns_cache_entry {
+	/** Name that was resolved */
+	char query[DNS_CACHE_NAME_LEN + 1];
+
+	/** Resolved address, unused for a negative entry */
+	struct dns_addrinfo info;
+
+	/** Uptime in ms when the entry expires, 0 if the entry is free */
+	int64_t expiry;
+
+	/** 0 for a resolved address, DNS_EAI_* error for a negative entry */
+	int status;
+
+	/** Type of the query */
+	enum dns_query_type type;
+};
+
+static struct dns_cache_entry cache[CONFIG_DNS_RESOLVER_CACHE_MAX_ENTRIES];
+
+static K_MUTEX_DEFINE(cache_lock);
+
+static inline bool entry_is_valid(struct dns_cache_entry *entry, int64_t now)
+{
+	return entry->expiry > now;
+}
+
+static inline bool entry_matches(struct dns_cache_entry *entry,
+				 const char *query, enum dns_query_type type)
+{
+	return entry->type == type && strcmp(entry->query, query) == 0;
+}
+
+static inline int64_t ttl_to_expiry(uint32_t ttl, int64_t now)
+{
+	return now + (int64_t)ttl * MSEC_PER_SEC;
+}
+
+/* Must be invoked with cache lock held */
+static void remove_matching(const char *query, enum dns_query_type type,
+			    bool negative_only)
+{
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		struct dns_cache_entry *entry = &cache[i];
+
+		if (entry->expiry == 0 || !entry_matches(entry, query, type)) {
+			continue;
+		}
+
+		if (negative_only && entry->status == 0) {
+			continue;
+		}
+
+		entry->expiry = 0;
+	}
+}
+
+/* Return a free or expired entry, or the one closest to expiry if the
+ * cache is full.
+ *
+ * Must be invoked with cache lock held
+ */
+static struct dns_cache_entry *get_entry(int64_t now)
+{
+	struct dns_cache_entry *oldest = &cache[0];
+
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		struct dns_cache_entry *entry = &cache[i];
+
+		if (!entry_is_valid(entry, now)) {
+			return entry;
+		}
+
+		if (entry->expiry < oldest->expiry) {
+			oldest = entry;
+		}
+	}
+
+	NET_DBG("Cache full, evicting %s", oldest->query);
+
+	return oldest;
+}
+
+/* Must be invoked with cache lock held */
+static void add_entry(const char *query, enum dns_query_type type,
+		      const struct dns_addrinfo *info, int status,
+		      uint32_t ttl)
+{
+	int64_t now = k_uptime_get();
+	struct dns_cache_entry *entry;
+
+	entry = get_entry(now);
+
+	strcpy(entry->query, query);
+	entry->type = type;
+	entry->status = status;
+	entry->expiry = ttl_to_expiry(ttl, now);
+
+	if (info != NULL) {
+		memcpy(&entry->info, info, sizeof(entry->info));
+	} else {
+		memset(&entry->info, 0, sizeof(entry->info));
+	}
+}
+
+static bool can_cache(const char *query, uint32_t ttl)
+{
+	if (ttl == 0U) {
+		return false;
+	}
+
+	return strlen(query) <= DNS_CACHE_NAME_LEN;
+}
+
+void dns_cache_add(const char *query, enum dns_query_type type,
+		   const struct dns_addrinfo *info, uint32_t ttl)
+{
+	int64_t now;
+
+	if (!can_cache(query, ttl)) {
+		return;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	/* A resolved address makes earlier negative answers obsolete */
+	remove_matching(query, type, true);
+
+	now = k_uptime_get();
+
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		struct dns_cache_entry *entry = &cache[i];
+
+		if (!entry_is_valid(entry, now) ||
+		    !entry_matches(entry, query, type) ||
+		    entry->info.ai_addrlen != info->ai_addrlen ||
+		    memcmp(&entry->info.ai_addr, &info->ai_addr,
+			   info->ai_addrlen) != 0) {
+			continue;
+		}
+
+		/* Same address seen again, just refresh it */
+		entry->expiry = ttl_to_expiry(ttl, now);
+		goto out;
+	}
+
+	add_entry(query, type, info, 0, ttl);
+
+	NET_DBG("Cached %s type %d for %u s", query, type, ttl);
+
+out:
+	k_mutex_unlock(&cache_lock);
+}
+
+void dns_cache_add_negative(const char *query, enum dns_query_type type,
+			    int status, uint32_t ttl)
+{
+	if (!can_cache(query, ttl)) {
+		return;
+	}
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	remove_matching(query, type, false);
+	add_entry(query, type, NULL, status, ttl);
+
+	NET_DBG("Cached %s type %d as unresolvable (%d) for %u s", query,
+		type, status, ttl);
+
+	k_mutex_unlock(&cache_lock);
+}
+
+void dns_cache_remove(const char *query, enum dns_query_type type)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+	remove_matching(query, type, false);
+	k_mutex_unlock(&cache_lock);
+}
+
+int dns_cache_find(const char *query, enum dns_query_type type,
+		   struct dns_addrinfo *info, size_t info_len, int *status)
+{
+	int64_t now = k_uptime_get();
+	int ret = -ENOENT;
+	size_t count = 0;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		struct dns_cache_entry *entry = &cache[i];
+
+		if (!entry_is_valid(entry, now) ||
+		    !entry_matches(entry, query, type)) {
+			continue;
+		}
+
+		if (entry->status != 0) {
+			*status = entry->status;
+			ret = 0;
+			break;
+		}
+
+		if (count < info_len) {
+			memcpy(&info[count++], &entry->info, sizeof(*info));
+		}
+
+		ret = count;
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return ret;
+}
+
+int dns_cache_foreach(dns_cache_cb_t cb, void *user_data)
+{
+	int64_t now = k_uptime_get();
+	struct dns_cache_info info;
+	int count = 0;
+
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		struct dns_cache_entry *entry = &cache[i];
+
+		if (!entry_is_valid(entry, now)) {
+			continue;
+		}
+
+		info.query = entry->query;
+		info.query_type = entry->type;
+		info.status = entry->status;
+		info.info = entry->status == 0 ? &entry->info : NULL;
+		info.ttl = (uint32_t)((entry->expiry - now) / MSEC_PER_SEC);
+
+		cb(&info, user_data);
+		count++;
+	}
+
+	k_mutex_unlock(&cache_lock);
+
+	return count;
+}
+
+void dns_cache_flush(void)
+{
+	k_mutex_lock(&cache_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		cache[i].expiry = 0;
+	}
+
+	k_mutex_unlock(&cache_lock);
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* DNS resolver response cache, private to the DNS resolver */
+
+#ifndef __DNS_CACHE_H
+#define __DNS_CACHE_H
+
+#include <zephyr/net/dns_resolve.h>
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+#define DNS_CACHE_NEGATIVE_TTL CONFIG_DNS_RESOLVER_CACHE_NEGATIVE_TTL
+
+/* Remember a resolved address for ttl seconds */
+void dns_cache_add(const char *query, enum dns_query_type type,
+		   const struct dns_addrinfo *info, uint32_t ttl);
+
+/* Remember for ttl seconds that the name could not be resolved */
+void dns_cache_add_negative(const char *query, enum dns_query_type type,
+			    int status, uint32_t ttl);
+
+/* Forget everything known about the name */
+void dns_cache_remove(const char *query, enum dns_query_type type);
+
+/* Look up the name in the cache. Returns -ENOENT if nothing valid is
+ * cached, otherwise the number of addresses copied to info. A negative
+ * entry returns 0 and sets status to the cached error.
+ */
+int dns_cache_find(const char *query, enum dns_query_type type,
+		   struct dns_addrinfo *info, size_t info_len, int *status);
+#else
+#define DNS_CACHE_NEGATIVE_TTL 0
+
+static inline void dns_cache_add(const char *query, enum dns_query_type type,
+				 const struct dns_addrinfo *info, uint32_t ttl)
+{
+	ARG_UNUSED(query);
+	ARG_UNUSED(type);
+	ARG_UNUSED(info);
+	ARG_UNUSED(ttl);
+}
+
+static inline void dns_cache_add_negative(const char *query,
+					  enum dns_query_type type,
+					  int status, uint32_t ttl)
+{
+	ARG_UNUSED(query);
+	ARG_UNUSED(type);
+	ARG_UNUSED(status);
+	ARG_UNUSED(ttl);
+}
+
+static inline void dns_cache_remove(const char *query,
+				    enum dns_query_type type)
+{
+	ARG_UNUSED(query);
+	ARG_UNUSED(type);
+}
+
+static inline int dns_cache_find(const char *query, enum dns_query_type type,
+				 struct dns_addrinfo *info, size_t info_len,
+				 int *status)
+{
+	ARG_UNUSED(query);
+	ARG_UNUSED(type);
+	ARG_UNUSED(info);
+	ARG_UNUSED(info_len);
+	ARG_UNUSED(status);
+
+	return -ENOENT;
+}
+#endif /* CONFIG_DNS_RESOLVER_CACHE */
+
+#endif /* __DNS_CACHE_H */
@@ -26,6 +26,7 @@ LOG_MODULE_REGISTER(net_dns_resolve, CONFIG_DNS_RESOLVER_LOG_LEVEL);
 #include <zephyr/net/dns_resolve.h>
 #include "dns_pack.h"
 #include "dns_internal.h"
+#include "dns_cache.h"
 
 #define DNS_SERVER_COUNT CONFIG_DNS_RESOLVER_MAX_SERVERS
 #define SERVER_COUNT     (DNS_SERVER_COUNT + DNS_MAX_MCAST_SERVERS)
@@ -460,6 +461,63 @@ static inline int get_slot_by_id(struct dns_resolve_context *ctx,
 	return -ENOENT;
 }
 
+/* Store an answer of a pending query in the cache. The first answer of a
+ * response replaces whatever was cached for the name before, and a NULL
+ * info means that the name has no address.
+ *
+ * Must be invoked with context lock held
+ */
+static void cache_answer(struct dns_pending_query *pending_query,
+			 const struct dns_addrinfo *info, uint32_t ttl,
+			 bool first)
+{
+	if (pending_query->query == NULL) {
+		return;
+	}
+
+	if (info == NULL) {
+		dns_cache_add_negative(pending_query->query,
+				       pending_query->query_type,
+				       DNS_EAI_NODATA, ttl);
+		return;
+	}
+
+	if (first) {
+		dns_cache_remove(pending_query->query,
+				 pending_query->query_type);
+	}
+
+	dns_cache_add(pending_query->query, pending_query->query_type, info,
+		      ttl);
+}
+
+/* Call the callback with the cached answer for the query, if any.
+ *
+ * @return true if the query was answered from the cache.
+ */
+static bool resolve_from_cache(const char *query, enum dns_query_type type,
+			       dns_resolve_cb_t cb, void *user_data)
+{
+	struct dns_addrinfo info[CONFIG_DNS_RESOLVER_AI_MAX_ENTRIES];
+	int status = DNS_EAI_ALLDONE;
+	int count, i;
+
+	count = dns_cache_find(query, type, info, ARRAY_SIZE(info), &status);
+	if (count < 0) {
+		return false;
+	}
+
+	NET_DBG("Resolved %s from cache", query);
+
+	for (i = 0; i < count; i++) {
+		cb(DNS_EAI_INPROGRESS, &info[i], user_data);
+	}
+
+	cb(status, NULL, user_data);
+
+	return true;
+}
+
 /* Unit test needs to be able to call this function */
 #if !defined(CONFIG_NET_TEST)
 static
@@ -472,7 +530,7 @@ int dns_validate_msg(struct dns_resolve_context *ctx,
 		     uint16_t *query_hash)
 {
 	struct dns_addrinfo info = { 0 };
-	uint32_t ttl; /* RR ttl, so far it is not passed to caller */
+	uint32_t ttl; /* RR ttl, used as the cache lifetime */
 	uint8_t *src, *addr;
 	const char *query_name;
 	int address_size;
@@ -635,6 +693,8 @@ query_known:
 
 			invoke_query_callback(DNS_EAI_INPROGRESS, &info,
 					      &ctx->queries[*query_idx]);
+			cache_answer(&ctx->queries[*query_idx], &info, ttl,
+				     items == 0);
 			items++;
 			break;
 
@@ -702,6 +762,8 @@ query_known:
 
 	if (items == 0) {
 		ret = DNS_EAI_NODATA;
+		cache_answer(&ctx->queries[*query_idx], NULL,
+			     DNS_CACHE_NEGATIVE_TTL, true);
 	} else {
 		ret = DNS_EAI_ALLDONE;
 	}
@@ -1182,6 +1244,14 @@ int dns_resolve_name(struct dns_resolve_context *ctx,
 	}
 
 try_resolve:
+	if (resolve_from_cache(query, type, cb, user_data)) {
+		if (dns_id) {
+			*dns_id = 0U;
+		}
+
+		return 0;
+	}
+
 	k_mutex_lock(&ctx->lock, K_FOREVER);
 
 	if (ctx->state != DNS_RESOLVE_CONTEXT_ACTIVE) {
@@ -1473,6 +1543,9 @@ int dns_resolve_reconfigure(struct dns_resolve_context *ctx,
 
 	err = dns_resolve_init_locked(ctx, servers, servers_sa);
 
+	/* Answers from the old servers are not trusted anymore */
+	dns_cache_flush();
+
 unlock:
 	k_mutex_unlock(&ctx->lock);
 
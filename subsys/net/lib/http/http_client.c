@@ -27,8 +27,13 @@ LOG_MODULE_REGISTER(net_http, CONFIG_NET_HTTP_LOG_LEVEL);
 #include "net_private.h"
 
 #define HTTP_CONTENT_LEN_SIZE 11
+#define HTTP_RANGE_SIZE 48
 #define MAX_SEND_BUF_LEN 192
 
+/* Size line in front of the data of a chunk, and CRLF after it */
+#define CHUNK_HEADER_LEN 6
+#define CHUNK_TRAILER_LEN 2
+
 static int sendall(int sock, const void *buf, size_t len)
 {
 	while (len) {
@@ -343,6 +348,10 @@ static int on_message_complete(struct http_parser *parser)
 		http_method_str(req->method));
 
 	req->internal.response.message_complete = 1;
+	req->internal.response.keep_alive = http_should_keep_alive(parser) != 0;
+
+	/* Data following the response belongs to the next pipelined one */
+	http_parser_pause(parser, 1);
 
 	return 0;
 }
@@ -413,10 +422,18 @@ static void http_data_final_null_resp(struct http_request *req)
 	}
 }
 
-static int http_wait_data(int sock, struct http_request *req, int32_t timeout)
+/*
+ * Receive the response to a request. On input, pending_data and pending_len
+ * give data of the response already received with the previous one. On
+ * output, they give the data received after the end of the response.
+ */
+static int http_wait_data(int sock, struct http_request *req,
+			  const uint8_t **pending_data, size_t *pending_len,
+			  int32_t timeout)
 {
 	int total_received = 0;
 	size_t offset = 0;
+	size_t parsed;
 	int received, ret;
 	struct zsock_pollfd fds[1];
 	int nfds = 1;
@@ -426,29 +443,44 @@ static int http_wait_data(int sock, struct http_request *req, int32_t timeout)
 	fds[0].fd = sock;
 	fds[0].events = ZSOCK_POLLIN;
 
+	if (*pending_len > req->internal.response.recv_buf_len) {
+		NET_ERR("Pipelined data does not fit (%zd > %zd)", *pending_len,
+			req->internal.response.recv_buf_len);
+		return -ENOBUFS;
+	}
+
 	do {
-		if (timeout > 0) {
-			remaining_time -= (int32_t)k_uptime_delta(&timestamp);
-			if (remaining_time < 0) {
-				/* timeout, make poll return immediately */
-				remaining_time = 0;
+		if (*pending_len > 0) {
+			received = *pending_len;
+			memmove(req->internal.response.recv_buf, *pending_data,
+				received);
+			*pending_len = 0;
+		} else {
+			if (timeout > 0) {
+				remaining_time -= (int32_t)k_uptime_delta(&timestamp);
+				if (remaining_time < 0) {
+					/* timeout, make poll return immediately */
+					remaining_time = 0;
+				}
+			}
+
+			ret = zsock_poll(fds, nfds, remaining_time);
+			if (ret == 0) {
+				LOG_DBG("Timeout");
+				goto finalize_data;
+			} else if (ret < 0) {
+				goto error;
+			}
+			if (fds[0].revents & (ZSOCK_POLLERR | ZSOCK_POLLNVAL)) {
+				goto error;
+			} else if (fds[0].revents & ZSOCK_POLLHUP) {
+				/* Connection closed */
+				LOG_DBG("Connection closed");
+				goto finalize_data;
+			} else if (!(fds[0].revents & ZSOCK_POLLIN)) {
+				continue;
 			}
-		}
 
-		ret = zsock_poll(fds, nfds, remaining_time);
-		if (ret == 0) {
-			LOG_DBG("Timeout");
-			goto finalize_data;
-		} else if (ret < 0) {
-			goto error;
-		}
-		if (fds[0].revents & (ZSOCK_POLLERR | ZSOCK_POLLNVAL)) {
-			goto error;
-		} else if (fds[0].revents & ZSOCK_POLLHUP) {
-			/* Connection closed */
-			LOG_DBG("Connection closed");
-			goto finalize_data;
-		} else if (fds[0].revents & ZSOCK_POLLIN) {
 			received = zsock_recv(sock, req->internal.response.recv_buf + offset,
 					      req->internal.response.recv_buf_len - offset, 0);
 			if (received == 0) {
@@ -457,56 +489,68 @@ static int http_wait_data(int sock, struct http_request *req, int32_t timeout)
 				goto finalize_data;
 			} else if (received < 0) {
 				goto error;
-			} else {
-				req->internal.response.data_len += received;
-
-				(void)http_parser_execute(
-					&req->internal.parser, &req->internal.parser_settings,
-					req->internal.response.recv_buf + offset, received);
 			}
+		}
 
-			total_received += received;
-			offset += received;
+		req->internal.response.data_len += received;
 
-			if (offset >= req->internal.response.recv_buf_len) {
-				offset = 0;
+		parsed = http_parser_execute(
+			&req->internal.parser, &req->internal.parser_settings,
+			req->internal.response.recv_buf + offset, received);
+
+		if (req->internal.response.message_complete && parsed < received) {
+			/* The rest is the beginning of the next response */
+			*pending_data = req->internal.response.recv_buf + offset + parsed;
+			*pending_len = received - parsed;
+
+			req->internal.response.data_len -= *pending_len;
+			if (req->internal.response.body_frag_start) {
+				req->internal.response.body_frag_len -= *pending_len;
 			}
 
-			if (req->internal.response.cb) {
-				bool notify = false;
-				enum http_final_call event;
+			received = parsed;
+		}
 
-				if (req->internal.response.message_complete) {
-					NET_DBG("Calling callback for %zd len data",
-						req->internal.response.data_len);
+		total_received += received;
+		offset += received;
 
-					notify = true;
-					event = HTTP_DATA_FINAL;
-				} else if (offset == 0) {
-					NET_DBG("Calling callback for partitioned %zd len data",
-						req->internal.response.data_len);
+		if (offset >= req->internal.response.recv_buf_len) {
+			offset = 0;
+		}
 
-					notify = true;
-					event = HTTP_DATA_MORE;
-				}
+		if (req->internal.response.cb) {
+			bool notify = false;
+			enum http_final_call event;
+
+			if (req->internal.response.message_complete) {
+				NET_DBG("Calling callback for %zd len data",
+					req->internal.response.data_len);
 
-				if (notify) {
-					req->internal.response.cb(&req->internal.response, event,
-								  req->internal.user_data);
+				notify = true;
+				event = HTTP_DATA_FINAL;
+			} else if (offset == 0) {
+				NET_DBG("Calling callback for partitioned %zd len data",
+					req->internal.response.data_len);
 
-					/* Re-use the result buffer and start to fill it again */
-					req->internal.response.data_len = 0;
-					req->internal.response.body_frag_start = NULL;
-					req->internal.response.body_frag_len = 0;
-				}
+				notify = true;
+				event = HTTP_DATA_MORE;
 			}
 
-			if (req->internal.response.message_complete) {
-				ret = total_received;
-				break;
+			if (notify) {
+				req->internal.response.cb(&req->internal.response, event,
+							  req->internal.user_data);
+
+				/* Re-use the result buffer and start to fill it again */
+				req->internal.response.data_len = 0;
+				req->internal.response.body_frag_start = NULL;
+				req->internal.response.body_frag_len = 0;
 			}
 		}
 
+		if (req->internal.response.message_complete) {
+			ret = total_received;
+			break;
+		}
 	} while (true);
 
 	return ret;
@@ -523,22 +567,68 @@ error:
 	return ret;
 }
 
-int http_client_req(int sock, struct http_request *req,
-		    int32_t timeout, void *user_data)
+/* Send the payload given by the stream callback of the request */
+static int http_send_payload_stream(int sock, struct http_request *req,
+				    char *buf, size_t buf_len, void *user_data)
+{
+	static const char hex[] = "0123456789abcdef";
+	bool chunked = req->payload_len == 0;
+	size_t head = chunked ? CHUNK_HEADER_LEN : 0;
+	size_t max = buf_len - (chunked ? CHUNK_HEADER_LEN + CHUNK_TRAILER_LEN : 0);
+	int total_sent = 0;
+	int len, ret;
+
+	do {
+		len = req->payload_stream_cb(req, (uint8_t *)buf + head, max,
+					     user_data);
+		if (len < 0) {
+			return len;
+		}
+
+		if ((size_t)len > max) {
+			return -EINVAL;
+		}
+
+		if (!chunked) {
+			ret = sendall(sock, buf, len);
+			if (ret < 0) {
+				return ret;
+			}
+
+			total_sent += len;
+			continue;
+		}
+
+		/* Fixed width size, the last chunk being "0000" */
+		for (int i = 0; i < 4; i++) {
+			buf[3 - i] = hex[(len >> (4 * i)) & 0xf];
+		}
+		buf[4] = '\r';
+		buf[5] = '\n';
+		buf[head + len] = '\r';
+		buf[head + len + 1] = '\n';
+
+		ret = sendall(sock, buf, head + len + CHUNK_TRAILER_LEN);
+		if (ret < 0) {
+			return ret;
+		}
+
+		total_sent += head + len + CHUNK_TRAILER_LEN;
+	} while (len > 0);
+
+	return total_sent;
+}
+
+static int http_send_req(int sock, struct http_request *req, void *user_data)
 {
 	/* Utilize the network usage by sending data in bigger blocks */
 	char send_buf[MAX_SEND_BUF_LEN];
 	const size_t send_buf_max_len = sizeof(send_buf);
 	size_t send_buf_pos = 0;
 	int total_sent = 0;
-	int ret, total_recv, i;
+	int ret, i;
 	const char *method;
 
-	if (sock < 0 || req == NULL || req->response == NULL ||
-	    req->recv_buf == NULL || req->recv_buf_len == 0) {
-		return -EINVAL;
-	}
-
 	memset(&req->internal.response, 0, sizeof(req->internal.response));
 
 	req->internal.response.http_cb = req->http_cb;
@@ -621,6 +711,33 @@ int http_client_req(int sock, struct http_request *req,
 		total_sent += ret;
 	}
 
+	if (req->range) {
+		char range_str[HTTP_RANGE_SIZE];
+
+		if (req->range->len > 0) {
+			ret = snprintk(range_str, sizeof(range_str), "bytes=%zu-%zu",
+				       req->range->start,
+				       req->range->start + req->range->len - 1);
+		} else {
+			ret = snprintk(range_str, sizeof(range_str), "bytes=%zu-",
+				       req->range->start);
+		}
+
+		if (ret <= 0 || ret >= sizeof(range_str)) {
+			ret = -ENOMEM;
+			goto out;
+		}
+
+		ret = http_send_data(sock, send_buf, send_buf_max_len,
+				     &send_buf_pos, "Range", ": ", range_str,
+				     HTTP_CRLF, NULL);
+		if (ret < 0) {
+			goto out;
+		}
+
+		total_sent += ret;
+	}
+
 	if (req->content_type_value) {
 		ret = http_send_data(sock, send_buf, send_buf_max_len,
 				     &send_buf_pos, "Content-Type", ": ",
@@ -632,7 +749,7 @@ int http_client_req(int sock, struct http_request *req,
 		total_sent += ret;
 	}
 
-	if (req->payload || req->payload_cb) {
+	if (req->payload || req->payload_cb || req->payload_stream_cb) {
 		if (req->payload_len) {
 			char content_len_str[HTTP_CONTENT_LEN_SIZE];
 
@@ -647,6 +764,11 @@ int http_client_req(int sock, struct http_request *req,
 					     &send_buf_pos, "Content-Length", ": ",
 					     content_len_str, HTTP_CRLF,
 					     HTTP_CRLF, NULL);
+		} else if (req->payload_stream_cb) {
+			ret = http_send_data(sock, send_buf, send_buf_max_len,
+					     &send_buf_pos, "Transfer-Encoding",
+					     ": ", "chunked", HTTP_CRLF,
+					     HTTP_CRLF, NULL);
 		} else {
 			ret = http_send_data(sock, send_buf, send_buf_max_len,
 				     &send_buf_pos, HTTP_CRLF, NULL);
@@ -666,7 +788,16 @@ int http_client_req(int sock, struct http_request *req,
 		send_buf_pos = 0;
 		total_sent += ret;
 
-		if (req->payload_cb) {
+		if (req->payload_stream_cb) {
+			ret = http_send_payload_stream(sock, req, send_buf,
+						       send_buf_max_len,
+						       user_data);
+			if (ret < 0) {
+				goto out;
+			}
+
+			total_sent += ret;
+		} else if (req->payload_cb) {
 			ret = req->payload_cb(sock, req, user_data);
 			if (ret < 0) {
 				goto out;
@@ -710,19 +841,101 @@ int http_client_req(int sock, struct http_request *req,
 
 	NET_DBG("Sent %d bytes", total_sent);
 
+	return total_sent;
+
+out:
+	return ret;
+}
+
+static int http_recv_resp(int sock, struct http_request *req,
+			  const uint8_t **pending_data, size_t *pending_len,
+			  int32_t timeout)
+{
+	int total_recv;
+
 	http_client_init_parser(&req->internal.parser,
 				&req->internal.parser_settings);
 
-	/* Request is sent, now wait data to be received */
-	total_recv = http_wait_data(sock, req, timeout);
+	total_recv = http_wait_data(sock, req, pending_data, pending_len,
+				    timeout);
 	if (total_recv < 0) {
 		NET_DBG("Wait data failure (%d)", total_recv);
 	} else {
 		NET_DBG("Received %d bytes", total_recv);
 	}
 
+	return total_recv;
+}
+
+static bool http_req_is_valid(int sock, struct http_request *req)
+{
+	return sock >= 0 && req != NULL && req->response != NULL &&
+	       req->recv_buf != NULL && req->recv_buf_len != 0;
+}
+
+int http_client_req(int sock, struct http_request *req,
+		    int32_t timeout, void *user_data)
+{
+	const uint8_t *pending_data = NULL;
+	size_t pending_len = 0;
+	int total_sent;
+
+	if (!http_req_is_valid(sock, req)) {
+		return -EINVAL;
+	}
+
+	total_sent = http_send_req(sock, req, user_data);
+	if (total_sent < 0) {
+		return total_sent;
+	}
+
+	/* Request is sent, now wait data to be received */
+	(void)http_recv_resp(sock, req, &pending_data, &pending_len, timeout);
+
 	return total_sent;
+}
 
-out:
-	return ret;
+int http_client_req_pipelined(int sock, struct http_request *reqs[],
+			      size_t count, int32_t timeout, void *user_data)
+{
+	const uint8_t *pending_data = NULL;
+	size_t pending_len = 0;
+	int total_sent = 0;
+	size_t i;
+	int ret;
+
+	if (reqs == NULL || count == 0) {
+		return -EINVAL;
+	}
+
+	for (i = 0; i < count; i++) {
+		if (!http_req_is_valid(sock, reqs[i]) || reqs[i]->payload ||
+		    reqs[i]->payload_cb || reqs[i]->payload_stream_cb) {
+			return -EINVAL;
+		}
+	}
+
+	for (i = 0; i < count; i++) {
+		ret = http_send_req(sock, reqs[i], user_data);
+		if (ret < 0) {
+			return ret;
+		}
+
+		total_sent += ret;
+	}
+
+	for (i = 0; i < count; i++) {
+		ret = http_recv_resp(sock, reqs[i], &pending_data, &pending_len,
+				     timeout);
+		if (ret < 0) {
+			break;
+		}
+	}
+
+	/* The connection failed, the remaining responses will not come */
+	while (++i < count) {
+		http_data_final_null_resp(reqs[i]);
+	}
+
+	return total_sent;
 }
@@ -0,0 +1,760 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief HTTP/1.1 server.
+ *
+ * A single thread polls the listening socket of each service and the
+ * connections of the client pool.  Sockets are only used with non-blocking
+ * calls, a client being either receiving a request or sending a response:
+ * once a request is complete the parser is paused, so that pipelined
+ * requests stay in the receive buffer until the response has been sent.
+ */
+
+#include <errno.h>
+#include <stdarg.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/http/server.h>
+#include <zephyr/net/http/service.h>
+#include <zephyr/net/http/status.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_REGISTER(net_http_server, CONFIG_NET_HTTP_LOG_LEVEL);
+
+/* Period of the checks for inactive clients and stop requests */
+#define HTTP_SERVER_POLL_PERIOD_MS 1000
+
+/* Size line in front of the data of a chunk, and CRLF after it */
+#define CHUNK_HEADER_LEN  6
+#define CHUNK_TRAILER_LEN 2
+#define LAST_CHUNK        "0\r\n\r\n"
+
+static struct http_client_ctx clients[CONFIG_HTTP_SERVER_MAX_CLIENTS];
+
+static const struct http_service_desc *services[CONFIG_HTTP_SERVER_MAX_SERVICES];
+static int listen_fds[CONFIG_HTTP_SERVER_MAX_SERVICES];
+static size_t service_clients[CONFIG_HTTP_SERVER_MAX_SERVICES];
+static size_t num_services;
+
+static struct zsock_pollfd fds[CONFIG_HTTP_SERVER_MAX_SERVICES +
+			       CONFIG_HTTP_SERVER_MAX_CLIENTS];
+
+static struct http_parser_settings parser_settings;
+
+static atomic_t server_running;
+static atomic_t stop_requested;
+
+static K_THREAD_STACK_DEFINE(http_server_stack, CONFIG_HTTP_SERVER_STACK_SIZE);
+static struct k_thread http_server_thread;
+
+static const char *status_reason(uint16_t status)
+{
+	switch (status) {
+	case HTTP_200_OK:
+		return "OK";
+	case HTTP_400_BAD_REQUEST:
+		return "Bad Request";
+	case HTTP_404_NOT_FOUND:
+		return "Not Found";
+	case HTTP_405_METHOD_NOT_ALLOWED:
+		return "Method Not Allowed";
+	case HTTP_414_URI_TOO_LONG:
+		return "URI Too Long";
+	default:
+		return "Internal Server Error";
+	}
+}
+
+static const struct http_resource_desc *find_resource(const struct http_service_desc *svc,
+						       const char *url)
+{
+	/* The query and the fragment are left to the resource */
+	size_t len = strcspn(url, "?#");
+
+	HTTP_SERVICE_FOREACH_RESOURCE(svc, res) {
+		if (res->detail != NULL && strncmp(res->resource, url, len) == 0 &&
+		    res->resource[len] == '\0') {
+			return res;
+		}
+	}
+
+	return NULL;
+}
+
+static const struct http_resource_detail *client_detail(struct http_client_ctx *client)
+{
+	if (client->status != HTTP_200_OK) {
+		return NULL;
+	}
+
+	return client->resource->detail;
+}
+
+static const struct http_resource_detail_dynamic *client_dynamic(struct http_client_ctx *client)
+{
+	const struct http_resource_detail *detail = client_detail(client);
+
+	if (detail == NULL || detail->type != HTTP_RESOURCE_TYPE_DYNAMIC) {
+		return NULL;
+	}
+
+	return CONTAINER_OF(detail, struct http_resource_detail_dynamic, common);
+}
+
+static void request_reset(struct http_client_ctx *client)
+{
+	client->resource = NULL;
+	client->url[0] = '\0';
+	client->url_len = 0;
+	client->url_overflow = false;
+	client->status = HTTP_500_INTERNAL_SERVER_ERROR;
+	client->keep_alive = false;
+	client->state = HTTP_CLIENT_RECV;
+}
+
+static int on_url(struct http_parser *parser, const char *at, size_t length)
+{
+	struct http_client_ctx *client = parser->data;
+
+	/* May be called several times if the URL spans several reads */
+	if (client->url_len + length >= sizeof(client->url)) {
+		client->url_overflow = true;
+		return 0;
+	}
+
+	memcpy(&client->url[client->url_len], at, length);
+	client->url_len += length;
+	client->url[client->url_len] = '\0';
+
+	return 0;
+}
+
+static int on_headers_complete(struct http_parser *parser)
+{
+	struct http_client_ctx *client = parser->data;
+	const struct http_resource_detail *detail;
+	uint32_t methods;
+
+	if (client->url_overflow) {
+		client->status = HTTP_414_URI_TOO_LONG;
+		return 0;
+	}
+
+	client->resource = find_resource(client->service, client->url);
+	if (client->resource == NULL) {
+		client->status = HTTP_404_NOT_FOUND;
+		return 0;
+	}
+
+	detail = client->resource->detail;
+	methods = detail->bitmask_of_supported_http_methods;
+
+	/* HEAD gets the headers of GET */
+	if ((methods & BIT(HTTP_GET)) != 0) {
+		methods |= BIT(HTTP_HEAD);
+	}
+
+	if ((methods & BIT(parser->method)) == 0) {
+		client->status = HTTP_405_METHOD_NOT_ALLOWED;
+		return 0;
+	}
+
+	client->status = HTTP_200_OK;
+
+	return 0;
+}
+
+static int on_body(struct http_parser *parser, const char *at, size_t length)
+{
+	struct http_client_ctx *client = parser->data;
+	const struct http_resource_detail_dynamic *dynamic = client_dynamic(client);
+
+	if (dynamic == NULL || dynamic->request_cb == NULL) {
+		return 0;
+	}
+
+	if (dynamic->request_cb(client, (const uint8_t *)at, length, false,
+				dynamic->user_data) < 0) {
+		client->status = HTTP_500_INTERNAL_SERVER_ERROR;
+	}
+
+	return 0;
+}
+
+static int on_message_complete(struct http_parser *parser)
+{
+	struct http_client_ctx *client = parser->data;
+	const struct http_resource_detail_dynamic *dynamic = client_dynamic(client);
+
+	if (dynamic != NULL && dynamic->request_cb != NULL &&
+	    dynamic->request_cb(client, NULL, 0, true, dynamic->user_data) < 0) {
+		client->status = HTTP_500_INTERNAL_SERVER_ERROR;
+	}
+
+	client->keep_alive = http_should_keep_alive(parser) != 0;
+
+	/* Leave the next request in the buffer until this one is answered */
+	http_parser_pause(parser, 1);
+
+	return 0;
+}
+
+static bool tx_printf(struct http_client_ctx *client, const char *fmt, ...)
+{
+	size_t room = sizeof(client->tx) - client->tx_len;
+	va_list ap;
+	int len;
+
+	va_start(ap, fmt);
+	len = vsnprintk((char *)&client->tx[client->tx_len], room, fmt, ap);
+	va_end(ap);
+
+	if (len < 0 || (size_t)len >= room) {
+		return false;
+	}
+
+	client->tx_len += len;
+
+	return true;
+}
+
+static int response_start(struct http_client_ctx *client)
+{
+	const struct http_resource_detail *detail = client_detail(client);
+	bool head = client->parser.method == HTTP_HEAD;
+	bool ok;
+
+	client->tx_off = 0;
+	client->tx_len = 0;
+	client->data = NULL;
+	client->data_len = 0;
+	client->chunked = false;
+	client->send_body = false;
+	client->body_done = false;
+
+	ok = tx_printf(client, "HTTP/1.1 %u %s\r\n", client->status,
+		       status_reason(client->status));
+
+	if (detail == NULL) {
+		ok = ok && tx_printf(client, "Content-Length: 0\r\n");
+	} else {
+		if (detail->content_type != NULL) {
+			ok = ok && tx_printf(client, "Content-Type: %s\r\n",
+					     detail->content_type);
+		}
+
+		if (detail->content_encoding != NULL) {
+			ok = ok && tx_printf(client, "Content-Encoding: %s\r\n",
+					     detail->content_encoding);
+		}
+
+		if (detail->type == HTTP_RESOURCE_TYPE_STATIC) {
+			const struct http_resource_detail_static *res =
+				CONTAINER_OF(detail, struct http_resource_detail_static, common);
+
+			ok = ok && tx_printf(client, "Content-Length: %zu\r\n",
+					     res->static_data_len);
+
+			if (!head) {
+				client->data = res->static_data;
+				client->data_len = res->static_data_len;
+			}
+		} else {
+			client->send_body = !head;
+
+			if (client->parser.http_major > 1 ||
+			    (client->parser.http_major == 1 && client->parser.http_minor >= 1)) {
+				client->chunked = true;
+				ok = ok && tx_printf(client, "Transfer-Encoding: chunked\r\n");
+			} else {
+				/* HTTP/1.0: the end of the connection ends the body */
+				client->keep_alive = false;
+			}
+		}
+	}
+
+	if (!client->keep_alive) {
+		ok = ok && tx_printf(client, "Connection: close\r\n");
+	}
+
+	ok = ok && tx_printf(client, "\r\n");
+	if (!ok) {
+		LOG_WRN("Response headers do not fit in %zu bytes", sizeof(client->tx));
+		return -ENOBUFS;
+	}
+
+	client->state = HTTP_CLIENT_SEND;
+
+	return 0;
+}
+
+/* Fill the transmit buffer with the next chunk of a dynamic resource */
+static int response_next_chunk(struct http_client_ctx *client)
+{
+	static const char hex[] = "0123456789abcdef";
+	const struct http_resource_detail_dynamic *dynamic = client_dynamic(client);
+	uint8_t *buf = client->tx;
+	size_t max = sizeof(client->tx);
+	int len;
+
+	if (client->chunked) {
+		buf += CHUNK_HEADER_LEN;
+		max -= CHUNK_HEADER_LEN + CHUNK_TRAILER_LEN;
+	}
+
+	len = dynamic->response_cb(client, buf, max, dynamic->user_data);
+	if (len < 0) {
+		return len;
+	}
+
+	if ((size_t)len > max) {
+		return -EINVAL;
+	}
+
+	client->tx_off = 0;
+
+	if (len == 0) {
+		client->body_done = true;
+
+		if (client->chunked) {
+			memcpy(client->tx, LAST_CHUNK, strlen(LAST_CHUNK));
+			client->tx_len = strlen(LAST_CHUNK);
+		} else {
+			client->tx_len = 0;
+		}
+
+		return 0;
+	}
+
+	if (!client->chunked) {
+		client->tx_len = len;
+		return 0;
+	}
+
+	/* Fixed width size, padded with zeros, so the data needs no move */
+	for (int i = 0; i < 4; i++) {
+		client->tx[3 - i] = hex[(len >> (4 * i)) & 0xf];
+	}
+	client->tx[4] = '\r';
+	client->tx[5] = '\n';
+	buf[len] = '\r';
+	buf[len + 1] = '\n';
+	client->tx_len = CHUNK_HEADER_LEN + len + CHUNK_TRAILER_LEN;
+
+	return 0;
+}
+
+/*
+ * Send as much of the response as the socket takes. Returns 1 once the
+ * response is sent, 0 if the socket is full.
+ */
+static int client_send(struct http_client_ctx *client)
+{
+	ssize_t sent;
+	int ret;
+
+	while (true) {
+		if (client->tx_off < client->tx_len) {
+			sent = zsock_send(client->fd, &client->tx[client->tx_off],
+					  client->tx_len - client->tx_off, ZSOCK_MSG_DONTWAIT);
+			if (sent > 0) {
+				client->tx_off += sent;
+			}
+		} else if (client->data_len > 0) {
+			/* Straight from the resource, which may be in flash */
+			sent = zsock_send(client->fd, client->data, client->data_len,
+					  ZSOCK_MSG_DONTWAIT);
+			if (sent > 0) {
+				client->data += sent;
+				client->data_len -= sent;
+			}
+		} else if (client->send_body && !client->body_done) {
+			ret = response_next_chunk(client);
+			if (ret < 0) {
+				return ret;
+			}
+
+			continue;
+		} else {
+			return 1;
+		}
+
+		if (sent < 0) {
+			return (errno == EAGAIN) ? 0 : -errno;
+		}
+
+		client->last_activity = k_uptime_get();
+	}
+}
+
+/* Parse the buffered data, until a request is complete */
+static int client_parse(struct http_client_ctx *client)
+{
+	size_t parsed;
+
+	while (client->rx_off < client->rx_len) {
+		parsed = http_parser_execute(&client->parser, &parser_settings,
+					     (const char *)&client->rx[client->rx_off],
+					     client->rx_len - client->rx_off);
+		client->rx_off += parsed;
+
+		if (HTTP_PARSER_ERRNO(&client->parser) == HPE_PAUSED) {
+			return response_start(client);
+		}
+
+		if (HTTP_PARSER_ERRNO(&client->parser) != HPE_OK) {
+			LOG_DBG("Invalid request: %s",
+				http_errno_description(HTTP_PARSER_ERRNO(&client->parser)));
+
+			client->status = HTTP_400_BAD_REQUEST;
+			client->resource = NULL;
+			client->keep_alive = false;
+			client->rx_off = client->rx_len;
+
+			return response_start(client);
+		}
+	}
+
+	client->rx_off = 0;
+	client->rx_len = 0;
+
+	return 0;
+}
+
+/* Serve requests until more data must be received or sent */
+static int client_process(struct http_client_ctx *client)
+{
+	int ret;
+
+	while (true) {
+		if (client->state == HTTP_CLIENT_SEND) {
+			ret = client_send(client);
+			if (ret <= 0) {
+				return ret;
+			}
+
+			if (!client->keep_alive) {
+				return -ECONNRESET;
+			}
+
+			request_reset(client);
+			http_parser_pause(&client->parser, 0);
+		}
+
+		ret = client_parse(client);
+		if (ret < 0 || client->state == HTTP_CLIENT_RECV) {
+			return ret;
+		}
+	}
+}
+
+static int client_recv(struct http_client_ctx *client)
+{
+	ssize_t len;
+
+	if (client->rx_off > 0) {
+		memmove(client->rx, &client->rx[client->rx_off],
+			client->rx_len - client->rx_off);
+		client->rx_len -= client->rx_off;
+		client->rx_off = 0;
+	}
+
+	len = zsock_recv(client->fd, &client->rx[client->rx_len],
+			 sizeof(client->rx) - client->rx_len, ZSOCK_MSG_DONTWAIT);
+	if (len < 0) {
+		return (errno == EAGAIN) ? 0 : -errno;
+	}
+
+	if (len == 0) {
+		return -ENOTCONN;
+	}
+
+	client->rx_len += len;
+	client->last_activity = k_uptime_get();
+
+	return client_process(client);
+}
+
+static void client_close(struct http_client_ctx *client)
+{
+	for (size_t i = 0; i < num_services; i++) {
+		if (services[i] == client->service) {
+			service_clients[i]--;
+			break;
+		}
+	}
+
+	(void)zsock_close(client->fd);
+	client->fd = -1;
+	client->state = HTTP_CLIENT_FREE;
+}
+
+static struct http_client_ctx *client_get(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(clients); i++) {
+		if (clients[i].state == HTTP_CLIENT_FREE) {
+			return &clients[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void client_accept(size_t svc_idx)
+{
+	struct http_client_ctx *client = client_get();
+	int fd;
+
+	fd = zsock_accept(listen_fds[svc_idx], NULL, NULL);
+	if (fd < 0) {
+		LOG_DBG("accept failed (%d)", -errno);
+		return;
+	}
+
+	client->fd = fd;
+	client->service = services[svc_idx];
+	client->rx_off = 0;
+	client->rx_len = 0;
+	client->last_activity = k_uptime_get();
+	http_parser_init(&client->parser, HTTP_REQUEST);
+	client->parser.data = client;
+	request_reset(client);
+
+	service_clients[svc_idx]++;
+}
+
+static void clients_check_inactivity(void)
+{
+	int64_t now = k_uptime_get();
+
+	for (size_t i = 0; i < ARRAY_SIZE(clients); i++) {
+		if (clients[i].state != HTTP_CLIENT_FREE &&
+		    now - clients[i].last_activity >
+			    CONFIG_HTTP_SERVER_CLIENT_INACTIVITY_TIMEOUT * MSEC_PER_SEC) {
+			LOG_DBG("Client %zu inactive, closing", i);
+			client_close(&clients[i]);
+		}
+	}
+}
+
+static void http_server_run(void *p1, void *p2, void *p3)
+{
+	struct zsock_pollfd *client_fds = &fds[num_services];
+	bool client_free;
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!atomic_get(&stop_requested)) {
+		client_free = client_get() != NULL;
+
+		/* New connections wait in the backlog while no client is free */
+		for (size_t i = 0; i < num_services; i++) {
+			fds[i].fd = listen_fds[i];
+			fds[i].events = (client_free && service_clients[i] < services[i]->concurrent) ?
+						ZSOCK_POLLIN : 0;
+			fds[i].revents = 0;
+		}
+
+		for (size_t i = 0; i < ARRAY_SIZE(clients); i++) {
+			client_fds[i].fd = clients[i].fd;
+			client_fds[i].events = (clients[i].state == HTTP_CLIENT_SEND) ?
+						ZSOCK_POLLOUT : ZSOCK_POLLIN;
+			client_fds[i].revents = 0;
+		}
+
+		ret = zsock_poll(fds, num_services + ARRAY_SIZE(clients),
+				 HTTP_SERVER_POLL_PERIOD_MS);
+		if (ret < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			LOG_ERR("poll failed (%d)", -errno);
+			break;
+		}
+
+		for (size_t i = 0; i < ARRAY_SIZE(clients); i++) {
+			short revents = client_fds[i].revents;
+
+			if (revents == 0) {
+				continue;
+			}
+
+			if ((revents & ZSOCK_POLLIN) != 0) {
+				ret = client_recv(&clients[i]);
+			} else if ((revents & ZSOCK_POLLOUT) != 0) {
+				ret = client_process(&clients[i]);
+			} else {
+				ret = -ENOTCONN;
+			}
+
+			if (ret < 0) {
+				LOG_DBG("Client %zu closed (%d)", i, ret);
+				client_close(&clients[i]);
+			}
+		}
+
+		for (size_t i = 0; i < num_services; i++) {
+			if ((fds[i].revents & ZSOCK_POLLIN) != 0 && client_get() != NULL) {
+				client_accept(i);
+			}
+		}
+
+		clients_check_inactivity();
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(clients); i++) {
+		if (clients[i].state != HTTP_CLIENT_FREE) {
+			client_close(&clients[i]);
+		}
+	}
+
+	for (size_t i = 0; i < num_services; i++) {
+		(void)zsock_close(listen_fds[i]);
+	}
+}
+
+static int service_listen(const struct http_service_desc *svc)
+{
+	struct sockaddr addr = { 0 };
+	socklen_t addrlen;
+	const int on = 1;
+	int fd;
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NET_IPV6) && svc->host != NULL &&
+	    zsock_inet_pton(AF_INET6, svc->host, &net_sin6(&addr)->sin6_addr) == 1) {
+		addr.sa_family = AF_INET6;
+	} else if (IS_ENABLED(CONFIG_NET_IPV4) && svc->host != NULL &&
+		   zsock_inet_pton(AF_INET, svc->host, &net_sin(&addr)->sin_addr) == 1) {
+		addr.sa_family = AF_INET;
+	} else {
+		/* Host names are not resolved, listen on any address */
+		addr.sa_family = IS_ENABLED(CONFIG_NET_IPV6) ? AF_INET6 : AF_INET;
+	}
+
+	if (addr.sa_family == AF_INET6) {
+		net_sin6(&addr)->sin6_port = htons(*svc->port);
+		addrlen = sizeof(struct sockaddr_in6);
+	} else {
+		net_sin(&addr)->sin_port = htons(*svc->port);
+		addrlen = sizeof(struct sockaddr_in);
+	}
+
+	fd = zsock_socket(addr.sa_family, SOCK_STREAM, IPPROTO_TCP);
+	if (fd < 0) {
+		return -errno;
+	}
+
+	(void)zsock_setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+	if (zsock_bind(fd, &addr, addrlen) < 0 ||
+	    zsock_listen(fd, svc->backlog) < 0) {
+		goto error;
+	}
+
+	if (*svc->port == 0) {
+		/* Let the application know the ephemeral port */
+		if (zsock_getsockname(fd, &addr, &addrlen) < 0) {
+			goto error;
+		}
+
+		*svc->port = ntohs((addr.sa_family == AF_INET6) ?
+				   net_sin6(&addr)->sin6_port : net_sin(&addr)->sin_port);
+	}
+
+	LOG_DBG("Service %s listening on port %u", svc->host, *svc->port);
+
+	return fd;
+
+error:
+	ret = -errno;
+	(void)zsock_close(fd);
+
+	return ret;
+}
+
+int http_server_start(void)
+{
+	int ret;
+
+	if (!atomic_cas(&server_running, 0, 1)) {
+		return -EALREADY;
+	}
+
+	num_services = 0;
+
+	HTTP_SERVICE_FOREACH(svc) {
+		if (num_services == ARRAY_SIZE(services)) {
+			LOG_ERR("Too many services, see CONFIG_HTTP_SERVER_MAX_SERVICES");
+			ret = -ENOMEM;
+			goto error;
+		}
+
+		ret = service_listen(svc);
+		if (ret < 0) {
+			LOG_ERR("Cannot listen for service %s (%d)", svc->host, ret);
+			goto error;
+		}
+
+		services[num_services] = svc;
+		listen_fds[num_services] = ret;
+		service_clients[num_services] = 0;
+		num_services++;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(clients); i++) {
+		clients[i].fd = -1;
+		clients[i].state = HTTP_CLIENT_FREE;
+	}
+
+	http_parser_settings_init(&parser_settings);
+	parser_settings.on_url = on_url;
+	parser_settings.on_headers_complete = on_headers_complete;
+	parser_settings.on_body = on_body;
+	parser_settings.on_message_complete = on_message_complete;
+
+	atomic_clear(&stop_requested);
+
+	k_thread_create(&http_server_thread, http_server_stack,
+			K_THREAD_STACK_SIZEOF(http_server_stack), http_server_run,
+			NULL, NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_NO_WAIT);
+	k_thread_name_set(&http_server_thread, "http_server");
+
+	return 0;
+
+error:
+	while (num_services > 0) {
+		(void)zsock_close(listen_fds[--num_services]);
+	}
+
+	atomic_clear(&server_running);
+
+	return ret;
+}
+
+int http_server_stop(void)
+{
+	if (!atomic_get(&server_running)) {
+		return -EALREADY;
+	}
+
+	atomic_set(&stop_requested, 1);
+	(void)k_thread_join(&http_server_thread, K_FOREVER);
+
+	atomic_clear(&server_running);
+
+	return 0;
+}
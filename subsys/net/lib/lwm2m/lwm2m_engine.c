@@ -581,36 +581,76 @@ void lwm2m_socket_del(struct lwm2m_ctx *ctx)
 	lwm2m_engine_wake_up();
 }
 
-static void check_notifications(struct lwm2m_ctx *ctx, const int64_t timestamp)
+/* A notification to the server of ctx is due or waits for its acknowledgment */
+static bool notification_burst(struct lwm2m_ctx *ctx, const int64_t timestamp)
 {
 	struct observe_node *obs;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->observer, obs, node) {
+		if (obs->active_notify != NULL ||
+		    (obs->event_timestamp && timestamp >= obs->event_timestamp)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Returns the time at which the next notification is due, INT64_MAX if none */
+static int64_t check_notifications(struct lwm2m_ctx *ctx, const int64_t timestamp)
+{
+	struct observe_node *obs;
+	int64_t next = INT64_MAX;
+	int64_t due = timestamp;
+	bool sent = false;
 	int rc;
 
 	lwm2m_registry_lock();
+
+	/* Notifications due soon go along with the ones sent now */
+	if (CONFIG_LWM2M_NOTIFY_COALESCE_WINDOW > 0 && notification_burst(ctx, timestamp)) {
+		due = timestamp + CONFIG_LWM2M_NOTIFY_COALESCE_WINDOW;
+	}
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&ctx->observer, obs, node) {
-		if (!obs->event_timestamp || timestamp < obs->event_timestamp) {
+		/* Check That There is not pending process*/
+		if (!obs->event_timestamp || obs->active_notify != NULL) {
 			continue;
 		}
-		/* Check That There is not pending process*/
-		if (obs->active_notify != NULL) {
+
+		if (due < obs->event_timestamp ||
+		    (timestamp < obs->event_timestamp &&
+		     !engine_observe_pmin_elapsed(obs, ctx->srv_obj_inst, timestamp))) {
+			next = MIN(next, obs->event_timestamp);
+			continue;
+		}
+
+		if (sent) {
+			/* create at most one notification, the next one right after */
+			next = timestamp;
 			continue;
 		}
 
 		rc = generate_notify_message(ctx, obs, NULL);
 		if (rc == -ENOMEM) {
 			/* no memory/messages available, retry later */
-			goto cleanup;
+			next = MIN(next, timestamp + ENGINE_SLEEP_MS);
+			break;
 		}
 		obs->event_timestamp =
 			engine_observe_shedule_next_event(obs, ctx->srv_obj_inst, timestamp);
 		obs->last_timestamp = timestamp;
 		if (!rc) {
-			/* create at most one notification */
-			goto cleanup;
+			sent = true;
+		}
+		if (obs->event_timestamp) {
+			next = MIN(next, obs->event_timestamp);
 		}
 	}
-cleanup:
+
 	lwm2m_registry_unlock();
+
+	return next;
 }
 
 static int socket_recv_message(struct lwm2m_ctx *client_ctx)
@@ -704,7 +744,7 @@ static void socket_loop(void *p1, void *p2, void *p3)
 
 	int i, rc;
 	int64_t now, next;
-	int64_t timeout, next_retransmit;
+	int64_t timeout, next_retransmit, next_notify;
 	bool rd_client_paused;
 
 	while (1) {
@@ -746,7 +786,10 @@ static void socket_loop(void *p1, void *p2, void *p3)
 				next = next_retransmit;
 			}
 			if (lwm2m_rd_client_is_registred(sock_ctx[i])) {
-				check_notifications(sock_ctx[i], now);
+				next_notify = check_notifications(sock_ctx[i], now);
+				if (next_notify < next) {
+					next = next_notify;
+				}
 			}
 		}
 
@@ -1471,6 +1471,20 @@ int64_t engine_observe_shedule_next_event(struct observe_node *obs, uint16_t srv
 	return t_s;
 }
 
+bool engine_observe_pmin_elapsed(struct observe_node *obs, uint16_t srv_obj_inst,
+				 const int64_t timestamp)
+{
+	struct notification_attrs attrs;
+	int ret;
+
+	ret = engine_observe_attribute_list_get(&obs->path_list, &attrs, srv_obj_inst);
+	if (ret < 0) {
+		return false;
+	}
+
+	return timestamp >= obs->last_timestamp + MSEC_PER_SEC * attrs.pmin;
+}
+
 struct lwm2m_obj_path_list *lwm2m_engine_get_from_list(sys_slist_t *path_list)
 {
 	sys_snode_t *path_node = sys_slist_get(path_list);
@@ -35,6 +35,9 @@ void clear_attrs(void *ref);
 int64_t engine_observe_shedule_next_event(struct observe_node *obs, uint16_t srv_obj_inst,
 					  const int64_t timestamp);
 
+bool engine_observe_pmin_elapsed(struct observe_node *obs, uint16_t srv_obj_inst,
+				 const int64_t timestamp);
+
 void remove_observer_from_list(struct lwm2m_ctx *ctx, sys_snode_t *prev_node,
 			       struct observe_node *obs);
 
@@ -73,6 +73,27 @@ static union cbor_io_fmt_data{
 static int path_to_string(char *buf, size_t buf_size, const struct lwm2m_obj_path *input,
 			 int level_max);
 
+/* Write value in decimal followed by a terminating NULL, returns the number of digits.
+ * Names are formed for every record so this avoids going through snprintk().
+ */
+static int u16_to_str(char *buf, uint16_t value)
+{
+	char digits[sizeof("65535") - 1];
+	int len = 0;
+
+	do {
+		digits[len++] = '0' + value % 10U;
+		value /= 10U;
+	} while (value != 0U);
+
+	for (int idx = 0; idx < len; idx++) {
+		buf[idx] = digits[len - 1 - idx];
+	}
+	buf[len] = '\0';
+
+	return len;
+}
+
 /*
  * SEND is called from a different context than the rest of the LwM2M functionality
  */
@@ -238,7 +259,7 @@ static int put_begin_r(struct lwm2m_output_context *out, struct lwm2m_obj_path *
 	char *name = GET_CBOR_FD_NAME(fd);
 
 	/* Write resource name */
-	len = snprintk(name, sizeof("65535"), "%" PRIu16 "", path->res_id);
+	len = u16_to_str(name, path->res_id);
 
 	if (len < sizeof("0") - 1) {
 		__ASSERT_NO_MSG(false);
@@ -312,9 +333,10 @@ static int put_begin_ri(struct lwm2m_output_context *out, struct lwm2m_obj_path
 	}
 
 	/* Forms name from resource id and resource instance id */
-	int len = snprintk(name, SENML_MAX_NAME_SIZE,
-			   "%" PRIu16 "/%" PRIu16 "",
-			   path->res_id, path->res_inst_id);
+	int len = u16_to_str(name, path->res_id);
+
+	name[len++] = '/';
+	len += u16_to_str(&name[len], path->res_inst_id);
 
 	if (len < sizeof("0/0") - 1) {
 		__ASSERT_NO_MSG(false);
@@ -507,11 +529,10 @@ static int put_objlnk(struct lwm2m_output_context *out, struct lwm2m_obj_path *p
 	/* Format object link */
 	int objlnk_idx = fd->objlnk_cnt;
 	char *objlink_buf = fd->objlnk[objlnk_idx];
-	int objlnk_len =
-		snprintk(objlink_buf, fd->objlnk_sz, "%u:%u", value->obj_id, value->obj_inst);
-	if (objlnk_len < 0) {
-		return -EINVAL;
-	}
+	int objlnk_len = u16_to_str(objlink_buf, value->obj_id);
+
+	objlink_buf[objlnk_len++] = ':';
+	objlnk_len += u16_to_str(&objlink_buf[objlnk_len], value->obj_inst);
 
 	ret = put_name_nth_ri(out, path);
 
@@ -729,7 +750,8 @@ static int do_write_op_item(struct lwm2m_message *msg, struct record *rec)
 	/* If there's no name then the basename forms the path */
 	if (rec->_record_n_present) {
 		len = MIN(sizeof(name) - 1, rec->_record_n._record_n.len);
-		snprintk(name, len + 1, "%s", rec->_record_n._record_n.value);
+		memcpy(name, rec->_record_n._record_n.value, len);
+		name[len] = '\0';
 	}
 
 	/* Form fully qualified path name */
@@ -861,7 +883,7 @@ static uint8_t parse_composite_read_paths(struct lwm2m_message *msg,
 		/* Set null terminated effective basename */
 		if (record->_record_bn_present) {
 			len = MIN(sizeof(basename)-1, record->_record_bn._record_bn.len);
-			snprintk(basename, len + 1, "%s", record->_record_bn._record_bn.value);
+			memcpy(basename, record->_record_bn._record_bn.value, len);
 			basename[len] = '\0';
 		}
 
@@ -875,7 +897,7 @@ static uint8_t parse_composite_read_paths(struct lwm2m_message *msg,
 		/* Set null terminated name */
 		if (record->_record_n_present) {
 			len = MIN(sizeof(name)-1, record->_record_n._record_n.len);
-			snprintk(name, len + 1, "%s", record->_record_n._record_n.value);
+			memcpy(name, record->_record_n._record_n.value, len);
 			name[len] = '\0';
 		}
 
@@ -988,7 +1010,8 @@ int do_write_op_senml_cbor(struct lwm2m_message *msg)
 			int len = MIN(sizeof(fd->basename) - 1,
 				rec->_record_bn._record_bn.len);
 
-			snprintk(fd->basename, len + 1, "%s", rec->_record_bn._record_bn.value);
+			memcpy(fd->basename, rec->_record_bn._record_bn.value, len);
+			fd->basename[len] = '\0';
 			goto write;
 		}
 
@@ -1001,8 +1024,8 @@ int do_write_op_senml_cbor(struct lwm2m_message *msg)
 				int len = MIN(sizeof(fd->basename) - 1,
 					kvp->_key_value_pair._value_tstr.len);
 
-				snprintk(fd->basename, len + 1, "%s",
-					kvp->_key_value_pair._value_tstr.value);
+				memcpy(fd->basename, kvp->_key_value_pair._value_tstr.value, len);
+				fd->basename[len] = '\0';
 				break;
 			}
 		}
@@ -1067,48 +1090,46 @@ static int path_to_string(char *buf, size_t buf_size, const struct lwm2m_obj_pat
 {
 	size_t fpl = 0; /* Length of the formed path */
 	int level;
-	int w;
 
 	if (!buf || buf_size < sizeof("/") || !input) {
 		return -EINVAL;
 	}
 
-	memset(buf, '\0', buf_size);
-
 	level = MIN(input->level, level_max);
 
 	/* Write path element at a time and leave space for the terminating NULL */
 	for (int idx = LWM2M_PATH_LEVEL_NONE; idx <= level; idx++) {
+		/* Longest element is a separator and five digits */
+		if (buf_size - fpl < sizeof("/65535")) {
+			return -ENOBUFS;
+		}
+
 		switch (idx) {
 		case LWM2M_PATH_LEVEL_NONE:
-			w = snprintk(&(buf[fpl]), buf_size - fpl, "/");
+			buf[fpl++] = '/';
 			break;
 		case LWM2M_PATH_LEVEL_OBJECT:
-			w = snprintk(&(buf[fpl]), buf_size - fpl, "%" PRIu16 "/", input->obj_id);
+			fpl += u16_to_str(&buf[fpl], input->obj_id);
+			buf[fpl++] = '/';
 			break;
 		case LWM2M_PATH_LEVEL_OBJECT_INST:
-			w = snprintk(&(buf[fpl]), buf_size - fpl, "%" PRIu16 "/",
-				     input->obj_inst_id);
+			fpl += u16_to_str(&buf[fpl], input->obj_inst_id);
+			buf[fpl++] = '/';
 			break;
 		case LWM2M_PATH_LEVEL_RESOURCE:
-			w = snprintk(&(buf[fpl]), buf_size - fpl, "%" PRIu16 "", input->res_id);
+			fpl += u16_to_str(&buf[fpl], input->res_id);
 			break;
 		case LWM2M_PATH_LEVEL_RESOURCE_INST:
-			w = snprintk(&(buf[fpl]), buf_size - fpl, "/%" PRIu16 "",
-				     input->res_inst_id);
+			buf[fpl++] = '/';
+			fpl += u16_to_str(&buf[fpl], input->res_inst_id);
 			break;
 		default:
 			__ASSERT_NO_MSG(false);
 			return -EINVAL;
 		}
-
-		if (w < 0 || w >= buf_size - fpl) {
-			return -ENOBUFS;
-		}
-
-		/* Next path element, overwrites terminating NULL */
-		fpl += w;
 	}
 
+	buf[fpl] = '\0';
+
 	return fpl;
 }
@@ -58,6 +58,7 @@ static void client_disconnect(struct mqtt_client *client, int result,
 
 	/* Reset internal state. */
 	client_reset(client);
+	mqtt_pub_queue_disconnected(client);
 
 	if (notify) {
 		struct mqtt_evt evt = {
@@ -109,6 +110,20 @@ error:
 	return err_code;
 }
 
+static int client_flush(struct mqtt_client *client)
+{
+	int err_code;
+
+	err_code = mqtt_pub_queue_flush(client);
+	if (err_code < 0) {
+		NET_ERR("Transport write failed, err_code = %d, "
+			 "closing connection", err_code);
+		client_disconnect(client, err_code, true);
+	}
+
+	return err_code;
+}
+
 static int client_read(struct mqtt_client *client)
 {
 	int err_code;
@@ -120,9 +135,11 @@ static int client_read(struct mqtt_client *client)
 	err_code = mqtt_handle_rx(client);
 	if (err_code < 0) {
 		client_disconnect(client, err_code, true);
+		return err_code;
 	}
 
-	return err_code;
+	/* Acknowledgments may have made room for queued messages. */
+	return client_flush(client);
 }
 
 static int client_write(struct mqtt_client *client, const uint8_t *data,
@@ -287,6 +304,32 @@ error:
 	return err_code;
 }
 
+#if defined(CONFIG_MQTT_PUBLISH_QUEUE)
+int mqtt_publish_queued(struct mqtt_client *client,
+			const struct mqtt_publish_param *param)
+{
+	int err_code;
+
+	NULL_PARAM_CHECK(client);
+	NULL_PARAM_CHECK(param);
+
+	mqtt_mutex_lock(client);
+
+	err_code = verify_tx_state(client);
+	if (err_code == 0) {
+		err_code = mqtt_pub_queue_add(client, param);
+	}
+
+	NET_DBG("[CID %p]:[State 0x%02x]: Queued message id 0x%04x, "
+		 "result %d", client, client->internal.state,
+		 param->message_id, err_code);
+
+	mqtt_mutex_unlock(client);
+
+	return err_code;
+}
+#endif /* CONFIG_MQTT_PUBLISH_QUEUE */
+
 int mqtt_publish_qos1_ack(struct mqtt_client *client,
 			  const struct mqtt_puback_param *param)
 {
@@ -601,6 +644,12 @@ int mqtt_live(struct mqtt_client *client)
 
 	mqtt_mutex_lock(client);
 
+	err_code = client_flush(client);
+	if (err_code < 0) {
+		mqtt_mutex_unlock(client);
+		return err_code;
+	}
+
 	elapsed_time = mqtt_elapsed_time_in_ms_get(
 				client->internal.last_activity);
 	if ((client->keepalive > 0) &&
@@ -618,7 +667,7 @@ int mqtt_live(struct mqtt_client *client)
 	}
 }
 
-int mqtt_keepalive_time_left(const struct mqtt_client *client)
+static int keepalive_time_left(const struct mqtt_client *client)
 {
 	uint32_t elapsed_time = mqtt_elapsed_time_in_ms_get(
 					client->internal.last_activity);
@@ -636,6 +685,19 @@ int mqtt_keepalive_time_left(const struct mqtt_client *client)
 	return keepalive_ms - elapsed_time;
 }
 
+int mqtt_keepalive_time_left(const struct mqtt_client *client)
+{
+	int time_left = keepalive_time_left(client);
+	int queue_time_left = mqtt_pub_queue_time_left(client);
+
+	if ((queue_time_left >= 0) &&
+	    ((time_left < 0) || (queue_time_left < time_left))) {
+		return queue_time_left;
+	}
+
+	return time_left;
+}
+
 int mqtt_input(struct mqtt_client *client)
 {
 	int err_code = 0;
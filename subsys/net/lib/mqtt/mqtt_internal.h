@@ -393,6 +393,71 @@ int subscribe_ack_decode(struct buf_ctx *buf,
 int unsubscribe_ack_decode(struct buf_ctx *buf,
 			   struct mqtt_unsuback_param *param);
 
+#if defined(CONFIG_MQTT_PUBLISH_QUEUE)
+/**@brief Copies a Publish packet to the publish queue.
+ *
+ * @param[in] client Client instance the message is queued on.
+ * @param[in] param Publish message parameters.
+ *
+ * @return 0 if the procedure is successful, an error code otherwise.
+ */
+int mqtt_pub_queue_add(struct mqtt_client *client,
+		       const struct mqtt_publish_param *param);
+
+/**@brief Sends the packets of the publish queue that are due.
+ *
+ * @param[in] client Client instance whose queue is sent.
+ *
+ * @return 0 if the procedure is successful, the transport error code
+ *         otherwise.
+ */
+int mqtt_pub_queue_flush(struct mqtt_client *client);
+
+/**@brief Updates the publish queue on reception of an acknowledgment.
+ *
+ * @param[in] client Client instance for which the packet was received.
+ * @param[in] type Packet type, MQTT_PKT_TYPE_PUBACK, MQTT_PKT_TYPE_PUBREC
+ *                 or MQTT_PKT_TYPE_PUBCOMP.
+ * @param[in] message_id Message id of the packet.
+ */
+void mqtt_pub_queue_ack(struct mqtt_client *client, uint8_t type,
+			uint16_t message_id);
+
+/**@brief Marks the unacknowledged packets of the publish queue to be sent
+ *        again on the next connection.
+ *
+ * @param[in] client Client instance that disconnected.
+ */
+void mqtt_pub_queue_disconnected(struct mqtt_client *client);
+
+/**@brief Time left until packets of the publish queue are due.
+ *
+ * @param[in] client Client instance whose queue is checked.
+ *
+ * @return Time in milliseconds, -1 if nothing is due.
+ */
+int mqtt_pub_queue_time_left(const struct mqtt_client *client);
+#else
+static inline int mqtt_pub_queue_flush(struct mqtt_client *client)
+{
+	return 0;
+}
+
+static inline void mqtt_pub_queue_ack(struct mqtt_client *client,
+				      uint8_t type, uint16_t message_id)
+{
+}
+
+static inline void mqtt_pub_queue_disconnected(struct mqtt_client *client)
+{
+}
+
+static inline int mqtt_pub_queue_time_left(const struct mqtt_client *client)
+{
+	return -1;
+}
+#endif /* CONFIG_MQTT_PUBLISH_QUEUE */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,411 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/** @file mqtt_pub_queue.c
+ *
+ * @brief Queue of outgoing PUBLISH messages.
+ *
+ * Queued packets are stored in order in the publish queue buffer of the
+ * client, each one behind an entry header, and sent straight from there.
+ * Entries are freed from the head once done, so a message acknowledged out
+ * of order keeps its space until the messages queued before it are done.
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_mqtt_pub_queue, CONFIG_MQTT_LOG_LEVEL);
+
+#include "mqtt_internal.h"
+#include "mqtt_transport.h"
+#include "mqtt_os.h"
+
+enum pub_queue_state {
+	/** PUBLISH packet to send. */
+	PUB_QUEUE_UNSENT,
+	/** PUBLISH packet sent, waiting for PUBACK or PUBREC. */
+	PUB_QUEUE_PUBLISHED,
+	/** PUBREL packet to send. */
+	PUB_QUEUE_RELEASE,
+	/** PUBREL packet sent, waiting for PUBCOMP. */
+	PUB_QUEUE_RELEASED,
+	/** Nothing left to do, the space is freed from the head. */
+	PUB_QUEUE_DONE,
+};
+
+struct pub_queue_entry {
+	/** Space taken in the buffer, this header included. */
+	uint32_t size;
+	/** Length of the packet. */
+	uint32_t len;
+	/** Wall clock value (in milliseconds) of the last transmission. */
+	uint32_t sent_time;
+	uint16_t message_id;
+	uint8_t qos;
+	uint8_t state;
+	/** Offset of the packet behind this header. */
+	uint8_t offset;
+};
+
+#define ENTRY_ALIGN sizeof(uint32_t)
+
+static inline uint8_t *entry_packet(struct pub_queue_entry *entry)
+{
+	return (uint8_t *)(entry + 1) + entry->offset;
+}
+
+static inline struct pub_queue_entry *entry_at(struct mqtt_client *client,
+					       uint32_t offset)
+{
+	return (struct pub_queue_entry *)(client->pub_queue_buf + offset);
+}
+
+#define FOR_EACH_ENTRY(client, offset, entry)                                  \
+	for (offset = 0;                                                       \
+	     (offset < client->internal.pub_queue_used) &&                     \
+	     ((entry = entry_at(client, offset)) != NULL);                     \
+	     offset += entry->size)
+
+static bool entry_waits_ack(const struct pub_queue_entry *entry)
+{
+	return (entry->state == PUB_QUEUE_PUBLISHED) ||
+	       (entry->state == PUB_QUEUE_RELEASED);
+}
+
+static void entry_done(struct mqtt_client *client,
+		       struct pub_queue_entry *entry)
+{
+	if (entry->qos > 0) {
+		client->internal.pub_queue_inflight--;
+	}
+
+	entry->state = PUB_QUEUE_DONE;
+}
+
+/* Free the entries done at the head of the queue. */
+static void pub_queue_compact(struct mqtt_client *client)
+{
+	struct pub_queue_entry *entry;
+	uint32_t offset;
+
+	FOR_EACH_ENTRY(client, offset, entry) {
+		if (entry->state != PUB_QUEUE_DONE) {
+			break;
+		}
+	}
+
+	if (offset == 0) {
+		return;
+	}
+
+	client->internal.pub_queue_used -= offset;
+	memmove(client->pub_queue_buf, client->pub_queue_buf + offset,
+		client->internal.pub_queue_used);
+}
+
+int mqtt_pub_queue_add(struct mqtt_client *client,
+		       const struct mqtt_publish_param *param)
+{
+	struct pub_queue_entry *entry;
+	struct buf_ctx packet;
+	uint8_t *start;
+	uint8_t *end;
+	uint32_t offset;
+	size_t size;
+	int err_code;
+
+	if (client->pub_queue_buf == NULL) {
+		return -ENOMEM;
+	}
+
+	if (param->message.topic.qos > MQTT_QOS_2_EXACTLY_ONCE) {
+		return -EINVAL;
+	}
+
+	if (param->message.topic.qos > 0) {
+		FOR_EACH_ENTRY(client, offset, entry) {
+			if ((entry->state != PUB_QUEUE_DONE) &&
+			    (entry->qos > 0) &&
+			    (entry->message_id == param->message_id)) {
+				return -EBUSY;
+			}
+		}
+	}
+
+	pub_queue_compact(client);
+
+	entry = entry_at(client, client->internal.pub_queue_used);
+	start = (uint8_t *)(entry + 1);
+	end = client->pub_queue_buf + client->pub_queue_buf_size;
+
+	if (start + MQTT_FIXED_HEADER_MAX_SIZE > end) {
+		return -ENOMEM;
+	}
+
+	packet.cur = start;
+	packet.end = end;
+
+	err_code = publish_encode(param, &packet);
+	if (err_code < 0) {
+		return err_code;
+	}
+
+	/* The payload is not copied by the encoder. */
+	size = ROUND_UP(packet.end + param->message.payload.len -
+			(uint8_t *)entry, ENTRY_ALIGN);
+	if (size > end - (uint8_t *)entry) {
+		return -ENOMEM;
+	}
+
+	memcpy(packet.end, param->message.payload.data,
+	       param->message.payload.len);
+
+	entry->size = size;
+	entry->len = packet.end - packet.cur + param->message.payload.len;
+	entry->sent_time = 0U;
+	entry->message_id = param->message_id;
+	entry->qos = param->message.topic.qos;
+	entry->state = PUB_QUEUE_UNSENT;
+	entry->offset = packet.cur - start;
+
+	client->internal.pub_queue_used += size;
+	client->internal.pub_queue_pending++;
+
+	return 0;
+}
+
+static int pub_queue_send(struct mqtt_client *client,
+			  struct pub_queue_entry **batch,
+			  struct iovec *io_vector, size_t count)
+{
+	uint32_t now = mqtt_sys_tick_in_ms_get();
+	struct msghdr msg;
+	int err_code;
+
+	memset(&msg, 0, sizeof(msg));
+
+	msg.msg_iov = io_vector;
+	msg.msg_iovlen = count;
+
+	err_code = mqtt_transport_write_msg(client, &msg);
+	if (err_code < 0) {
+		return err_code;
+	}
+
+	client->internal.last_activity = now;
+
+	for (size_t i = 0; i < count; i++) {
+		struct pub_queue_entry *entry = batch[i];
+
+		switch (entry->state) {
+		case PUB_QUEUE_UNSENT:
+			client->internal.pub_queue_pending--;
+
+			if (entry->qos == 0) {
+				entry->state = PUB_QUEUE_DONE;
+				continue;
+			}
+
+			client->internal.pub_queue_inflight++;
+			entry->state = PUB_QUEUE_PUBLISHED;
+			break;
+
+		case PUB_QUEUE_RELEASE:
+			client->internal.pub_queue_pending--;
+			entry->state = PUB_QUEUE_RELEASED;
+			break;
+
+		default:
+			break;
+		}
+
+		entry->sent_time = now;
+	}
+
+	return 0;
+}
+
+int mqtt_pub_queue_flush(struct mqtt_client *client)
+{
+	struct pub_queue_entry *batch[CONFIG_MQTT_PUBLISH_QUEUE_BATCH];
+	struct iovec io_vector[CONFIG_MQTT_PUBLISH_QUEUE_BATCH];
+	uint32_t inflight = client->internal.pub_queue_inflight;
+	bool resend = client->internal.pub_queue_resend;
+	struct pub_queue_entry *entry;
+	uint32_t retry_time = 0U;
+	bool retry = false;
+	size_t count = 0;
+	uint32_t offset;
+	int err_code;
+
+	if (!MQTT_HAS_STATE(client, MQTT_STATE_CONNECTED)) {
+		return 0;
+	}
+
+	client->internal.pub_queue_resend = false;
+
+	FOR_EACH_ENTRY(client, offset, entry) {
+		uint8_t *data = entry_packet(entry);
+
+		if (entry->state == PUB_QUEUE_UNSENT) {
+			if (entry->qos > 0) {
+				/* Keep the order, the window is full. */
+				if (inflight >= CONFIG_MQTT_PUBLISH_QUEUE_INFLIGHT) {
+					break;
+				}
+
+				inflight++;
+			}
+		} else if (entry_waits_ack(entry)) {
+			if (!resend &&
+			    mqtt_elapsed_time_in_ms_get(entry->sent_time) <
+			    CONFIG_MQTT_PUBLISH_QUEUE_RETRY_TIMEOUT) {
+				continue;
+			}
+
+			if (entry->state == PUB_QUEUE_PUBLISHED) {
+				data[0] |= MQTT_HEADER_DUP_MASK;
+			}
+
+			NET_DBG("[CID %p]: Resending message id 0x%04x",
+				client, entry->message_id);
+		} else if (entry->state != PUB_QUEUE_RELEASE) {
+			continue;
+		}
+
+		io_vector[count].iov_base = data;
+		io_vector[count].iov_len = entry->len;
+		batch[count++] = entry;
+
+		if (count == ARRAY_SIZE(batch)) {
+			err_code = pub_queue_send(client, batch, io_vector,
+						  count);
+			if (err_code < 0) {
+				return err_code;
+			}
+
+			count = 0;
+		}
+	}
+
+	if (count > 0) {
+		err_code = pub_queue_send(client, batch, io_vector, count);
+		if (err_code < 0) {
+			return err_code;
+		}
+	}
+
+	pub_queue_compact(client);
+
+	/* Earliest retransmission of the packets waiting for an ack. */
+	FOR_EACH_ENTRY(client, offset, entry) {
+		uint32_t entry_retry_time;
+
+		if (!entry_waits_ack(entry)) {
+			continue;
+		}
+
+		entry_retry_time = entry->sent_time +
+				   CONFIG_MQTT_PUBLISH_QUEUE_RETRY_TIMEOUT;
+		if (!retry || (int32_t)(entry_retry_time - retry_time) < 0) {
+			retry_time = entry_retry_time;
+			retry = true;
+		}
+	}
+
+	client->internal.pub_queue_retry_time = retry_time;
+
+	return 0;
+}
+
+void mqtt_pub_queue_ack(struct mqtt_client *client, uint8_t type,
+			uint16_t message_id)
+{
+	struct pub_queue_entry *entry;
+	uint32_t offset;
+	uint8_t *data;
+
+	FOR_EACH_ENTRY(client, offset, entry) {
+		if ((entry->qos > 0) && (entry->state != PUB_QUEUE_UNSENT) &&
+		    (entry->state != PUB_QUEUE_DONE) &&
+		    (entry->message_id == message_id)) {
+			break;
+		}
+	}
+
+	if (offset >= client->internal.pub_queue_used) {
+		/* Not a queued message. */
+		return;
+	}
+
+	switch (type) {
+	case MQTT_PKT_TYPE_PUBACK:
+		if (entry->qos == MQTT_QOS_1_AT_LEAST_ONCE) {
+			entry_done(client, entry);
+		}
+		break;
+
+	case MQTT_PKT_TYPE_PUBREC:
+		if ((entry->qos != MQTT_QOS_2_EXACTLY_ONCE) ||
+		    (entry->state == PUB_QUEUE_RELEASE)) {
+			break;
+		}
+
+		/* The PUBREL packet replaces the PUBLISH one, which is no
+		 * longer needed.
+		 */
+		data = (uint8_t *)(entry + 1);
+		data[0] = MQTT_MESSAGES_OPTIONS(MQTT_PKT_TYPE_PUBREL, 0, 1, 0);
+		data[1] = sizeof(uint16_t);
+		sys_put_be16(message_id, &data[2]);
+
+		entry->offset = 0U;
+		entry->len = MQTT_FIXED_HEADER_MIN_SIZE + sizeof(uint16_t);
+		entry->state = PUB_QUEUE_RELEASE;
+		client->internal.pub_queue_pending++;
+		break;
+
+	case MQTT_PKT_TYPE_PUBCOMP:
+		if (entry->qos == MQTT_QOS_2_EXACTLY_ONCE) {
+			if (entry->state == PUB_QUEUE_RELEASE) {
+				client->internal.pub_queue_pending--;
+			}
+
+			entry_done(client, entry);
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+void mqtt_pub_queue_disconnected(struct mqtt_client *client)
+{
+	client->internal.pub_queue_resend = true;
+}
+
+int mqtt_pub_queue_time_left(const struct mqtt_client *client)
+{
+	int32_t time_left;
+
+	if (!MQTT_HAS_STATE(client, MQTT_STATE_CONNECTED)) {
+		return -1;
+	}
+
+	if ((client->internal.pub_queue_pending > 0) &&
+	    (client->internal.pub_queue_inflight <
+	     CONFIG_MQTT_PUBLISH_QUEUE_INFLIGHT)) {
+		return 0;
+	}
+
+	if (client->internal.pub_queue_inflight == 0) {
+		return -1;
+	}
+
+	time_left = client->internal.pub_queue_retry_time -
+		    mqtt_sys_tick_in_ms_get();
+
+	return MAX(time_left, 0);
+}
@@ -77,6 +77,11 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		evt.type = MQTT_EVT_PUBACK;
 		err_code = publish_ack_decode(buf, &evt.param.puback);
 		evt.result = err_code;
+
+		if (err_code == 0) {
+			mqtt_pub_queue_ack(client, MQTT_PKT_TYPE_PUBACK,
+					   evt.param.puback.message_id);
+		}
 		break;
 
 	case MQTT_PKT_TYPE_PUBREC:
@@ -85,6 +90,11 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		evt.type = MQTT_EVT_PUBREC;
 		err_code = publish_receive_decode(buf, &evt.param.pubrec);
 		evt.result = err_code;
+
+		if (err_code == 0) {
+			mqtt_pub_queue_ack(client, MQTT_PKT_TYPE_PUBREC,
+					   evt.param.pubrec.message_id);
+		}
 		break;
 
 	case MQTT_PKT_TYPE_PUBREL:
@@ -101,6 +111,11 @@ static int mqtt_handle_packet(struct mqtt_client *client,
 		evt.type = MQTT_EVT_PUBCOMP;
 		err_code = publish_complete_decode(buf, &evt.param.pubcomp);
 		evt.result = err_code;
+
+		if (err_code == 0) {
+			mqtt_pub_queue_ack(client, MQTT_PKT_TYPE_PUBCOMP,
+					   evt.param.pubcomp.message_id);
+		}
 		break;
 
 	case MQTT_PKT_TYPE_SUBACK:
@@ -200,6 +200,71 @@ static int cmd_net_dns_query(const struct shell *sh, size_t argc, char *argv[])
 	return 0;
 }
 
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+static void dns_cache_cb(const struct dns_cache_info *entry, void *user_data)
+{
+	const struct shell *sh = user_data;
+	const char *type = entry->query_type == DNS_QUERY_TYPE_A ? "A" : "AAAA";
+	char addr[NET_IPV6_ADDR_LEN];
+
+	if (entry->info == NULL) {
+		PR("%s\t%s\t%u\t<error %d>\n", entry->query, type, entry->ttl,
+		   entry->status);
+		return;
+	}
+
+	if (entry->info->ai_family == AF_INET) {
+		net_addr_ntop(AF_INET, &net_sin(&entry->info->ai_addr)->sin_addr,
+			      addr, sizeof(addr));
+	} else if (IS_ENABLED(CONFIG_NET_IPV6) &&
+		   entry->info->ai_family == AF_INET6) {
+		net_addr_ntop(AF_INET6,
+			      &net_sin6(&entry->info->ai_addr)->sin6_addr,
+			      addr, sizeof(addr));
+	} else {
+		snprintk(addr, sizeof(addr), "<unknown>");
+	}
+
+	PR("%s\t%s\t%u\t%s\n", entry->query, type, entry->ttl, addr);
+}
+#endif
+
+static int cmd_net_dns_cache(const struct shell *sh, size_t argc, char *argv[])
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	PR("Name\tType\tTTL\tAddress\n");
+
+	if (dns_cache_foreach(dns_cache_cb, (void *)sh) == 0) {
+		PR("No cached DNS entries.\n");
+	}
+#else
+	PR_INFO("Set %s to enable %s support.\n", "CONFIG_DNS_RESOLVER_CACHE",
+		"DNS resolver cache");
+#endif
+
+	return 0;
+}
+
+static int cmd_net_dns_cache_flush(const struct shell *sh, size_t argc,
+				   char *argv[])
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+#if defined(CONFIG_DNS_RESOLVER_CACHE)
+	dns_cache_flush();
+	PR("DNS cache flushed.\n");
+#else
+	PR_INFO("Set %s to enable %s support.\n", "CONFIG_DNS_RESOLVER_CACHE",
+		"DNS resolver cache");
+#endif
+
+	return 0;
+}
+
 static int cmd_net_dns(const struct shell *sh, size_t argc, char *argv[])
 {
 #if defined(CONFIG_DNS_RESOLVER)
@@ -229,7 +294,17 @@ static int cmd_net_dns(const struct shell *sh, size_t argc, char *argv[])
 	return 0;
 }
 
+SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_dns_cache,
+	SHELL_CMD(flush, NULL, "Remove all the cached entries.",
+		  cmd_net_dns_cache_flush),
+	SHELL_SUBCMD_SET_END
+);
+
 SHELL_STATIC_SUBCMD_SET_CREATE(net_cmd_dns,
+	SHELL_CMD(cache, &net_cmd_dns_cache,
+		  "'net dns cache' shows the cached DNS entries.\n"
+		  "'net dns cache flush' removes them.",
+		  cmd_net_dns_cache),
 	SHELL_CMD(cancel, NULL, "Cancel all pending requests.",
 		  cmd_net_dns_cancel),
 	SHELL_CMD(query, NULL,
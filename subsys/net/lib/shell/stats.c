@@ -426,6 +426,19 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 	   GET_STAT(iface, ipv6_nd.sent),
 	   GET_STAT(iface, ipv6_nd.drop));
 #endif /* CONFIG_NET_STATISTICS_IPV6_ND */
+#if defined(CONFIG_NET_STATISTICS_IPV6_ROUTE)
+	PR("IPv6 route lookup %d\tcache hit\t%d\tnot found\t%d\n",
+	   GET_STAT(iface, ipv6_route.lookup),
+	   GET_STAT(iface, ipv6_route.cache_hit),
+	   GET_STAT(iface, ipv6_route.not_found));
+#endif /* CONFIG_NET_STATISTICS_IPV6_ROUTE */
+#if defined(CONFIG_NET_STATISTICS_IPV6_REASSEMBLY)
+	PR("IPv6 reass frags %d\treassembled\t%d\ttimeout\t%d\tdrop\t%d\n",
+	   GET_STAT(iface, ipv6_reassembly.fragments),
+	   GET_STAT(iface, ipv6_reassembly.reassembled),
+	   GET_STAT(iface, ipv6_reassembly.timeout),
+	   GET_STAT(iface, ipv6_reassembly.drop));
+#endif /* CONFIG_NET_STATISTICS_IPV6_REASSEMBLY */
 #if defined(CONFIG_NET_STATISTICS_MLD)
 	PR("IPv6 MLD recv  %d\tsent\t%d\tdrop\t%d\n",
 	   GET_STAT(iface, ipv6_mld.recv),
@@ -440,6 +453,13 @@ static void net_shell_print_statistics(struct net_if *iface, void *user_data)
 	   GET_STAT(iface, ipv4.sent),
 	   GET_STAT(iface, ipv4.drop),
 	   GET_STAT(iface, ipv4.forwarded));
+#if defined(CONFIG_NET_STATISTICS_IPV4_REASSEMBLY)
+	PR("IPv4 reass frags %d\treassembled\t%d\ttimeout\t%d\tdrop\t%d\n",
+	   GET_STAT(iface, ipv4_reassembly.fragments),
+	   GET_STAT(iface, ipv4_reassembly.reassembled),
+	   GET_STAT(iface, ipv4_reassembly.timeout),
+	   GET_STAT(iface, ipv4_reassembly.drop));
+#endif /* CONFIG_NET_STATISTICS_IPV4_REASSEMBLY */
 #endif /* CONFIG_NET_STATISTICS_IPV4 */
 
 	PR("IP vhlerr      %d\thblener\t%d\tlblener\t%d\n",
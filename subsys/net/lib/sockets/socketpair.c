@@ -120,6 +120,28 @@ static inline size_t spair_read_avail(struct spair *spair)
 	return k_pipe_read_avail(&spair->recv_q);
 }
 
+/**
+ * Signal that data can be read or written
+ *
+ * The signal is only raised if it is not raised yet. Pollers of a raised
+ * signal return right away, so there is nobody to wake up, and a pending
+ * @ref SPAIR_SIG_CANCEL must not be replaced.
+ */
+static void spair_signal_data(struct k_poll_signal *sig)
+{
+	unsigned int signaled;
+	int result;
+	int res;
+
+	k_poll_signal_check(sig, &signaled, &result);
+	if (signaled) {
+		return;
+	}
+
+	res = k_poll_signal_raise(sig, SPAIR_SIG_DATA);
+	__ASSERT(res == 0, "k_poll_signal_raise() failed: %d", res);
+}
+
 /** Swap two 32-bit integers */
 static inline void swap32(uint32_t *a, uint32_t *b)
 {
@@ -552,8 +574,7 @@ static ssize_t spair_write(void *obj, const void *buffer, size_t count)
 		k_poll_signal_reset(&remote->writeable);
 	}
 
-	res = k_poll_signal_raise(&remote->readable, SPAIR_SIG_DATA);
-	__ASSERT(res == 0, "k_poll_signal_raise() failed: %d", res);
+	spair_signal_data(&remote->readable);
 
 	res = bytes_written;
 
@@ -727,8 +748,7 @@ static ssize_t spair_read(void *obj, void *buffer, size_t count)
 	}
 
 	if (is_connected) {
-		res = k_poll_signal_raise(&spair->writeable, SPAIR_SIG_DATA);
-		__ASSERT(res == 0, "k_poll_signal_raise() failed: %d", res);
+		spair_signal_data(&spair->writeable);
 	}
 
 	res = bytes_read;
@@ -289,6 +289,10 @@ int z_impl_zsock_close(int sock)
 		return -1;
 	}
 
+	if (IS_ENABLED(CONFIG_NET_SOCKETS_EPOLL)) {
+		z_epoll_fd_close(sock);
+	}
+
 	(void)k_mutex_lock(lock, K_FOREVER);
 
 	NET_DBG("close: ctx=%p, fd=%d", ctx, sock);
@@ -844,6 +848,92 @@ ssize_t zsock_sendto_ctx(struct net_context *ctx, const void *buf, size_t len,
 	return status;
 }
 
+#if defined(CONFIG_NET_SOCKETS_SEND_BUF)
+static ssize_t zsock_send_buf_ctx(struct net_context *ctx, struct net_buf *buf,
+				  int flags, const struct sockaddr *dest_addr,
+				  socklen_t addrlen)
+{
+	k_timeout_t timeout = K_FOREVER;
+	uint32_t retry_timeout = WAIT_BUFS_INITIAL_MS;
+	k_timepoint_t buf_timeout, end;
+	int status;
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+		buf_timeout = sys_timepoint_calc(K_NO_WAIT);
+	} else {
+		net_context_get_option(ctx, NET_OPT_SNDTIMEO, &timeout, NULL);
+		buf_timeout = sys_timepoint_calc(MAX_WAIT_BUFS);
+	}
+	end = sys_timepoint_calc(timeout);
+
+	status = net_context_recv(ctx, zsock_received_cb,
+				  K_NO_WAIT, ctx->user_data);
+	if (status < 0) {
+		errno = -status;
+		return -1;
+	}
+
+	while (1) {
+		status = net_context_send_buf(ctx, buf, dest_addr, addrlen,
+					      NULL, timeout, ctx->user_data);
+		if (status < 0) {
+			status = send_check_and_wait(ctx, status, buf_timeout,
+						     timeout, &retry_timeout);
+			if (status < 0) {
+				return status;
+			}
+
+			timeout = sys_timepoint_timeout(end);
+
+			continue;
+		}
+
+		break;
+	}
+
+	return status;
+}
+
+ssize_t zsock_send_buf(int sock, struct net_buf *buf, int flags,
+		       const struct sockaddr *dest_addr, socklen_t addrlen)
+{
+	const struct socket_op_vtable *vtable;
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	ssize_t ret;
+
+	__ASSERT(!k_is_user_context(),
+		 "zsock_send_buf() is not available to user threads");
+
+	if (buf == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	ctx = get_sock_vtable(sock, &vtable, &lock);
+	if (ctx == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable != &sock_fd_op_vtable) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	ret = zsock_send_buf_ctx(ctx, buf, flags, dest_addr, addrlen);
+
+	k_mutex_unlock(lock);
+
+	sock_obj_core_update_send_stats(sock, ret);
+
+	return ret;
+}
+#endif /* CONFIG_NET_SOCKETS_SEND_BUF */
+
 ssize_t z_impl_zsock_sendto(int sock, const void *buf, size_t len, int flags,
 			   const struct sockaddr *dest_addr, socklen_t addrlen)
 {
@@ -1030,6 +1120,166 @@ fail:
 #include <syscalls/zsock_sendmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_zsock_sendmmsg(int sock, struct zsock_mmsghdr *msgvec,
+			  unsigned int vlen, int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int count;
+	void *obj;
+	int ret;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->sendmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	vlen = MIN(vlen, CONFIG_NET_SOCKETS_MMSG_MAX);
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (count = 0; count < vlen; count++) {
+		ret = vtable->sendmsg(obj, &msgvec[count].msg_hdr, flags);
+
+		sock_obj_core_update_send_stats(sock, ret);
+
+		if (ret < 0) {
+			break;
+		}
+
+		msgvec[count].msg_len = ret;
+	}
+
+	k_mutex_unlock(lock);
+
+	/* As on other systems, an error after the first message is not
+	 * reported, the caller learns about it on its next call.
+	 */
+	return (count > 0 || vlen == 0) ? count : -1;
+}
+
+#ifdef CONFIG_USERSPACE
+static void mmsg_vec_free(struct zsock_mmsghdr *vec, unsigned int vlen)
+{
+	for (unsigned int i = 0; i < vlen; i++) {
+		k_free(vec[i].msg_hdr.msg_iov);
+		k_free(vec[i].msg_hdr.msg_control);
+	}
+
+	k_free(vec);
+}
+
+/* Copy a message vector and its iovec arrays into kernel memory and check
+ * that the buffers they describe are accessible. Payloads and addresses are
+ * accessed in place, only ancillary data for sending is copied as it gets
+ * parsed by the stack.
+ */
+static struct zsock_mmsghdr *mmsg_vec_from_user(const struct zsock_mmsghdr *msgvec,
+						unsigned int vlen, bool write)
+{
+	struct zsock_mmsghdr *vec;
+	unsigned int i;
+
+	vec = k_usermode_alloc_from_copy(msgvec, vlen * sizeof(*vec));
+	if (vec == NULL) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	for (i = 0; i < vlen; i++) {
+		struct msghdr *msg = &vec[i].msg_hdr;
+		const struct iovec *user_iov = msg->msg_iov;
+		const void *user_control = msg->msg_control;
+		size_t iov_size;
+
+		msg->msg_iov = NULL;
+		msg->msg_control = NULL;
+
+		if (size_mul_overflow(msg->msg_iovlen, sizeof(struct iovec),
+				      &iov_size)) {
+			errno = EMSGSIZE;
+			goto fail;
+		}
+
+		if (iov_size > 0) {
+			msg->msg_iov = k_usermode_alloc_from_copy(user_iov,
+								  iov_size);
+			if (msg->msg_iov == NULL) {
+				errno = ENOMEM;
+				goto fail;
+			}
+		}
+
+		for (size_t j = 0; j < msg->msg_iovlen; j++) {
+			if (K_SYSCALL_MEMORY(msg->msg_iov[j].iov_base,
+					     msg->msg_iov[j].iov_len, write)) {
+				errno = EFAULT;
+				goto fail;
+			}
+		}
+
+		if (msg->msg_name != NULL &&
+		    K_SYSCALL_MEMORY(msg->msg_name, msg->msg_namelen, write)) {
+			errno = EFAULT;
+			goto fail;
+		}
+
+		if (write) {
+			msg->msg_controllen = 0;
+		} else if (msg->msg_controllen > 0) {
+			msg->msg_control = k_usermode_alloc_from_copy(user_control,
+								      msg->msg_controllen);
+			if (msg->msg_control == NULL) {
+				errno = ENOMEM;
+				goto fail;
+			}
+		}
+	}
+
+	return vec;
+
+fail:
+	mmsg_vec_free(vec, i + 1);
+
+	return NULL;
+}
+
+static inline int z_vrfy_zsock_sendmmsg(int sock, struct zsock_mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	struct zsock_mmsghdr *vec;
+	int ret;
+
+	vlen = MIN(vlen, CONFIG_NET_SOCKETS_MMSG_MAX);
+	if (vlen == 0) {
+		return 0;
+	}
+
+	vec = mmsg_vec_from_user(msgvec, vlen, false);
+	if (vec == NULL) {
+		return -1;
+	}
+
+	ret = z_impl_zsock_sendmmsg(sock, vec, vlen, flags);
+
+	for (int i = 0; i < ret; i++) {
+		K_OOPS(k_usermode_to_copy(&msgvec[i].msg_len, &vec[i].msg_len,
+					  sizeof(vec[i].msg_len)));
+	}
+
+	mmsg_vec_free(vec, vlen);
+
+	return ret;
+}
+#include <syscalls/zsock_sendmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 static int sock_get_pkt_src_addr(struct net_pkt *pkt,
 				 enum net_ip_protocol proto,
 				 struct sockaddr *addr,
@@ -1193,17 +1443,16 @@ int zsock_wait_data(struct net_context *ctx, k_timeout_t *timeout)
 	return 0;
 }
 
-static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
-				       void *buf,
-				       size_t max_len,
-				       int flags,
-				       struct sockaddr *src_addr,
-				       socklen_t *addrlen)
+/* Dequeue (or peek) the next datagram and fill in its source address.
+ * Returns NULL with errno set on failure; a dequeued packet is released
+ * before returning NULL.
+ */
+static struct net_pkt *zsock_recv_dgram_get_pkt(struct net_context *ctx,
+						int flags,
+						struct sockaddr *src_addr,
+						socklen_t *addrlen)
 {
 	k_timeout_t timeout = K_FOREVER;
-	size_t recv_len = 0;
-	size_t read_len;
-	struct net_pkt_cursor backup;
 	struct net_pkt *pkt;
 
 	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
@@ -1216,7 +1465,7 @@ static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 		ret = zsock_wait_data(ctx, &timeout);
 		if (ret < 0) {
 			errno = -ret;
-			return -1;
+			return NULL;
 		}
 	}
 
@@ -1227,7 +1476,7 @@ static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 		/* EAGAIN when timeout expired, EINTR when cancelled */
 		if (res && res != -EAGAIN && res != -EINTR) {
 			errno = -res;
-			return -1;
+			return NULL;
 		}
 
 		pkt = k_fifo_peek_head(&ctx->recv_q);
@@ -1237,11 +1486,9 @@ static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 
 	if (!pkt) {
 		errno = EAGAIN;
-		return -1;
+		return NULL;
 	}
 
-	net_pkt_cursor_backup(pkt, &backup);
-
 	if (src_addr && addrlen) {
 		if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
 		    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
@@ -1283,12 +1530,54 @@ static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
 		}
 	}
 
+	return pkt;
+
+fail:
+	if (!(flags & ZSOCK_MSG_PEEK)) {
+		net_pkt_unref(pkt);
+	}
+
+	return NULL;
+}
+
+/* Scatter the next datagram over an iovec array. If msg_flags is given, it
+ * reports whether the datagram was truncated.
+ */
+static ssize_t zsock_recv_dgram_iov(struct net_context *ctx,
+				    const struct iovec *iov,
+				    size_t iovlen,
+				    int flags,
+				    struct sockaddr *src_addr,
+				    socklen_t *addrlen,
+				    int *msg_flags)
+{
+	size_t recv_len = 0;
+	size_t read_len = 0;
+	struct net_pkt_cursor backup;
+	struct net_pkt *pkt;
+
+	pkt = zsock_recv_dgram_get_pkt(ctx, flags, src_addr, addrlen);
+	if (!pkt) {
+		return -1;
+	}
+
+	net_pkt_cursor_backup(pkt, &backup);
+
 	recv_len = net_pkt_remaining_data(pkt);
-	read_len = MIN(recv_len, max_len);
 
-	if (net_pkt_read(pkt, buf, read_len)) {
-		errno = ENOBUFS;
-		goto fail;
+	for (size_t i = 0; i < iovlen && read_len < recv_len; i++) {
+		size_t len = MIN(iov[i].iov_len, recv_len - read_len);
+
+		if (net_pkt_read(pkt, iov[i].iov_base, len)) {
+			errno = ENOBUFS;
+			goto fail;
+		}
+
+		read_len += len;
+	}
+
+	if (msg_flags != NULL) {
+		*msg_flags = (read_len < recv_len) ? ZSOCK_MSG_TRUNC : 0;
 	}
 
 	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) &&
@@ -1312,6 +1601,22 @@ fail:
 	return -1;
 }
 
+static inline ssize_t zsock_recv_dgram(struct net_context *ctx,
+				       void *buf,
+				       size_t max_len,
+				       int flags,
+				       struct sockaddr *src_addr,
+				       socklen_t *addrlen)
+{
+	struct iovec iov = {
+		.iov_base = buf,
+		.iov_len = max_len,
+	};
+
+	return zsock_recv_dgram_iov(ctx, &iov, 1, flags, src_addr, addrlen,
+				    NULL);
+}
+
 static size_t zsock_recv_stream_immediate(struct net_context *ctx, uint8_t **buf, size_t *max_len,
 					  int flags)
 {
@@ -1539,6 +1844,194 @@ ssize_t z_vrfy_zsock_recvfrom(int sock, void *buf, size_t max_len, int flags,
 #include <syscalls/zsock_recvfrom_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+static ssize_t sock_recvmsg_locked(void *obj,
+				   const struct socket_op_vtable *vtable,
+				   struct msghdr *msg, int flags)
+{
+	socklen_t *addrlen = msg->msg_name != NULL ? &msg->msg_namelen : NULL;
+	ssize_t ret;
+
+	msg->msg_controllen = 0;
+	msg->msg_flags = 0;
+
+	if (vtable == &sock_fd_op_vtable &&
+	    net_context_get_type(obj) == SOCK_DGRAM) {
+		return zsock_recv_dgram_iov(obj, msg->msg_iov,
+					    msg->msg_iovlen, flags,
+					    msg->msg_name, addrlen,
+					    &msg->msg_flags);
+	}
+
+	/* Other sockets only provide recvfrom(), which takes a single
+	 * buffer.
+	 */
+	if (msg->msg_iovlen > 1) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	ret = vtable->recvfrom(obj,
+			       msg->msg_iovlen ? msg->msg_iov[0].iov_base : NULL,
+			       msg->msg_iovlen ? msg->msg_iov[0].iov_len : 0,
+			       flags, msg->msg_name, addrlen);
+
+	return ret;
+}
+
+int z_impl_zsock_recvmmsg(int sock, struct zsock_mmsghdr *msgvec,
+			  unsigned int vlen, int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int count;
+	void *obj;
+	ssize_t ret;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->recvfrom == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	vlen = MIN(vlen, CONFIG_NET_SOCKETS_MMSG_MAX);
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	for (count = 0; count < vlen; count++) {
+		ret = sock_recvmsg_locked(obj, vtable, &msgvec[count].msg_hdr,
+					  flags);
+
+		sock_obj_core_update_recv_stats(sock, ret);
+
+		if (ret < 0) {
+			break;
+		}
+
+		msgvec[count].msg_len = ret;
+
+		if (flags & ZSOCK_MSG_WAITFORONE) {
+			flags |= ZSOCK_MSG_DONTWAIT;
+		}
+	}
+
+	k_mutex_unlock(lock);
+
+	/* Running out of data after the first message is not an error, and
+	 * as for sendmmsg() other errors are left for the next call.
+	 */
+	return (count > 0 || vlen == 0) ? count : -1;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_recvmmsg(int sock, struct zsock_mmsghdr *msgvec,
+					unsigned int vlen, int flags)
+{
+	struct zsock_mmsghdr *vec;
+	int ret;
+
+	vlen = MIN(vlen, CONFIG_NET_SOCKETS_MMSG_MAX);
+	if (vlen == 0) {
+		return 0;
+	}
+
+	vec = mmsg_vec_from_user(msgvec, vlen, true);
+	if (vec == NULL) {
+		return -1;
+	}
+
+	ret = z_impl_zsock_recvmmsg(sock, vec, vlen, flags);
+
+	for (int i = 0; i < ret; i++) {
+		struct zsock_mmsghdr *user = &msgvec[i];
+
+		K_OOPS(k_usermode_to_copy(&user->msg_len, &vec[i].msg_len,
+					  sizeof(user->msg_len)));
+		K_OOPS(k_usermode_to_copy(&user->msg_hdr.msg_namelen,
+					  &vec[i].msg_hdr.msg_namelen,
+					  sizeof(user->msg_hdr.msg_namelen)));
+		K_OOPS(k_usermode_to_copy(&user->msg_hdr.msg_controllen,
+					  &vec[i].msg_hdr.msg_controllen,
+					  sizeof(user->msg_hdr.msg_controllen)));
+		K_OOPS(k_usermode_to_copy(&user->msg_hdr.msg_flags,
+					  &vec[i].msg_hdr.msg_flags,
+					  sizeof(user->msg_hdr.msg_flags)));
+	}
+
+	mmsg_vec_free(vec, vlen);
+
+	return ret;
+}
+#include <syscalls/zsock_recvmmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+#if defined(CONFIG_NET_SOCKETS_RECV_PKT)
+ssize_t zsock_recv_pkt(int sock, struct net_pkt **pkt, int flags,
+		       struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	const struct socket_op_vtable *vtable;
+	struct net_context *ctx;
+	struct k_mutex *lock;
+	ssize_t ret;
+
+	__ASSERT(!k_is_user_context(),
+		 "zsock_recv_pkt() is not available to user threads");
+
+	if (pkt == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	*pkt = NULL;
+
+	ctx = get_sock_vtable(sock, &vtable, &lock);
+	if (ctx == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	/* Only native datagram sockets hand out their packets, the reference
+	 * returned to the caller is the one held by the receive queue.
+	 */
+	if (vtable != &sock_fd_op_vtable ||
+	    net_context_get_type(ctx) != SOCK_DGRAM ||
+	    (flags & ZSOCK_MSG_PEEK)) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	*pkt = zsock_recv_dgram_get_pkt(ctx, flags, src_addr, addrlen);
+	if (*pkt == NULL) {
+		ret = -1;
+	} else {
+		ret = net_pkt_remaining_data(*pkt);
+
+		if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS)) {
+			net_socket_update_tc_rx_time(*pkt, k_cycle_get_32());
+		}
+	}
+
+	k_mutex_unlock(lock);
+
+	sock_obj_core_update_recv_stats(sock, ret);
+
+	return ret;
+}
+
+void zsock_release_pkt(struct net_pkt *pkt)
+{
+	if (pkt != NULL) {
+		net_pkt_unref(pkt);
+	}
+}
+#endif /* CONFIG_NET_SOCKETS_RECV_PKT */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
@@ -2087,6 +2580,16 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 		case TCP_NODELAY:
 			ret = net_tcp_get_option(ctx, TCP_OPT_NODELAY, optval, optlen);
 			return ret;
+
+		case TCP_CONGESTION:
+			ret = net_tcp_get_option(ctx, TCP_OPT_CONGESTION,
+						 optval, optlen);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
+			return 0;
 		}
 
 		break;
@@ -2440,6 +2943,16 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 			ret = net_tcp_set_option(ctx,
 						 TCP_OPT_NODELAY, optval, optlen);
 			return ret;
+
+		case TCP_CONGESTION:
+			ret = net_tcp_set_option(ctx, TCP_OPT_CONGESTION,
+						 optval, optlen);
+			if (ret < 0) {
+				errno = -ret;
+				return -1;
+			}
+
+			return 0;
 		}
 		break;
 
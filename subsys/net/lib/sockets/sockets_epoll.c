@@ -0,0 +1,677 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/internal/syscall_handler.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/fdtable.h>
+#include "sockets_internal.h"
+
+/* Largest number of k_poll events a descriptor adds in POLL_PREPARE: a TLS
+ * socket may wait for its handshake on top of the underlying TCP socket.
+ */
+#define EPOLL_ENTRY_EVENTS 3
+
+#define EPOLL_POLL_EVENTS (ZSOCK_EPOLLIN | ZSOCK_EPOLLPRI | ZSOCK_EPOLLOUT)
+#define EPOLL_VALID_EVENTS (EPOLL_POLL_EVENTS | ZSOCK_EPOLLERR | \
+			    ZSOCK_EPOLLHUP | ZSOCK_EPOLLONESHOT)
+
+struct epoll_entry {
+	/* Fires once one of the events of the descriptor becomes ready */
+	struct k_work_poll work;
+	struct k_poll_event events[EPOLL_ENTRY_EVENTS];
+	int num_events;
+	/* Node in the ready list of the instance */
+	sys_dnode_t node;
+	struct epoll_ctx *ep;
+	zsock_epoll_data_t data;
+	uint32_t interest;
+	int fd;
+	bool in_use;
+};
+
+struct epoll_ctx {
+	/* Descriptor lock, protects everything but the ready list */
+	struct k_mutex *lock;
+	/* Entries whose descriptor may be ready, filled by the work handler */
+	sys_dlist_t ready;
+	struct k_spinlock ready_lock;
+	struct k_sem ready_sem;
+	struct epoll_entry entries[CONFIG_NET_SOCKETS_EPOLL_MAX_FDS];
+	/* Incremented on close, tells a waiter its instance was reused */
+	uint32_t generation;
+	bool in_use;
+};
+
+static struct epoll_ctx epoll_ctxs[CONFIG_NET_SOCKETS_EPOLL_MAX];
+static K_MUTEX_DEFINE(epoll_ctxs_lock);
+static const struct fd_op_vtable epoll_fd_op_vtable;
+
+static void epoll_queue_ready(struct epoll_entry *entry)
+{
+	struct epoll_ctx *ep = entry->ep;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&ep->ready_lock);
+
+	if (!sys_dnode_is_linked(&entry->node)) {
+		sys_dlist_append(&ep->ready, &entry->node);
+	}
+
+	k_spin_unlock(&ep->ready_lock, key);
+
+	k_sem_give(&ep->ready_sem);
+}
+
+static void epoll_work_handler(struct k_work *work)
+{
+	struct k_work_poll *pwork = CONTAINER_OF(work, struct k_work_poll, work);
+	struct epoll_entry *entry = CONTAINER_OF(pwork, struct epoll_entry, work);
+
+	epoll_queue_ready(entry);
+}
+
+/* Call the POLL_PREPARE or POLL_UPDATE ioctl() of a descriptor and return
+ * a negative error code on failure. Sockets return the error code directly,
+ * other descriptors (e.g. eventfd) return -1 and set errno, so errno is
+ * cleared for the call to tell a -EPERM from a socket apart from the latter.
+ */
+static int epoll_poll_ioctl(const struct fd_op_vtable *vtable, void *obj,
+			    struct k_mutex *lock, unsigned int request,
+			    struct zsock_pollfd *pfd, struct k_poll_event **pev,
+			    struct k_poll_event *pev_end)
+{
+	int saved_errno = errno;
+	int ret;
+
+	errno = 0;
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	if (request == ZFD_IOCTL_POLL_PREPARE) {
+		ret = z_fdtable_call_ioctl(vtable, obj, request, pfd, pev,
+					   pev_end);
+	} else {
+		ret = z_fdtable_call_ioctl(vtable, obj, request, pfd, pev);
+	}
+	k_mutex_unlock(lock);
+
+	if (ret == -1 && errno != 0) {
+		ret = -errno;
+	}
+
+	errno = saved_errno;
+
+	return ret;
+}
+
+/* Register interest in the descriptor again, must be called with the
+ * instance lock held and the entry neither armed nor queued.
+ */
+static int epoll_entry_arm(struct epoll_entry *entry)
+{
+	const struct fd_op_vtable *vtable;
+	struct zsock_pollfd pfd;
+	struct k_poll_event *pev = entry->events;
+	struct k_mutex *lock;
+	void *obj;
+	int ret;
+
+	obj = z_get_fd_obj_and_vtable(entry->fd, &vtable, &lock);
+	if (obj == NULL) {
+		return -EBADF;
+	}
+
+	if (vtable->ioctl == NULL) {
+		return -EPERM;
+	}
+
+	pfd.fd = entry->fd;
+	pfd.events = entry->interest & EPOLL_POLL_EVENTS;
+	pfd.revents = 0;
+
+	ret = epoll_poll_ioctl(vtable, obj, lock, ZFD_IOCTL_POLL_PREPARE,
+			       &pfd, &pev, entry->events + EPOLL_ENTRY_EVENTS);
+
+	entry->num_events = pev - entry->events;
+
+	if (ret == -EALREADY) {
+		/* Ready right away, no need to wait for it */
+		epoll_queue_ready(entry);
+		return 0;
+	} else if (ret == -EXDEV) {
+		/* Offloaded sockets have their own poll() implementation */
+		return -EPERM;
+	} else if (ret < 0) {
+		return ret;
+	}
+
+	if (entry->num_events == 0) {
+		return 0;
+	}
+
+	return k_work_poll_submit(&entry->work, entry->events,
+				  entry->num_events, K_FOREVER);
+}
+
+/* Stop watching the descriptor and take the entry off the ready list. The
+ * work item may already have been triggered, in which case it is waited
+ * for, as only its handler clears the remaining event registrations.
+ */
+static void epoll_entry_disarm(struct epoll_entry *entry)
+{
+	struct epoll_ctx *ep = entry->ep;
+	struct k_work_sync sync;
+	k_spinlock_key_t key;
+
+	if (k_work_poll_cancel(&entry->work) != 0) {
+		(void)k_work_flush(&entry->work.work, &sync);
+	}
+
+	key = k_spin_lock(&ep->ready_lock);
+
+	if (sys_dnode_is_linked(&entry->node)) {
+		sys_dlist_remove(&entry->node);
+	}
+
+	k_spin_unlock(&ep->ready_lock, key);
+}
+
+static void epoll_entry_free(struct epoll_entry *entry)
+{
+	epoll_entry_disarm(entry);
+	entry->in_use = false;
+}
+
+static struct epoll_entry *epoll_entry_find(struct epoll_ctx *ep, int fd)
+{
+	for (int i = 0; i < ARRAY_SIZE(ep->entries); i++) {
+		if (ep->entries[i].in_use && ep->entries[i].fd == fd) {
+			return &ep->entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+static struct epoll_entry *epoll_entry_alloc(struct epoll_ctx *ep, int fd)
+{
+	for (int i = 0; i < ARRAY_SIZE(ep->entries); i++) {
+		struct epoll_entry *entry = &ep->entries[i];
+
+		if (!entry->in_use) {
+			k_work_poll_init(&entry->work, epoll_work_handler);
+			sys_dnode_init(&entry->node);
+			entry->ep = ep;
+			entry->fd = fd;
+			entry->num_events = 0;
+			entry->in_use = true;
+
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+/* Check an entry found on the ready list. It may have been queued a while
+ * ago, so the current state of the descriptor is polled again without
+ * waiting, the same way zsock_poll() does it. Return the events to report,
+ * 0 if the descriptor turned out not to be ready, or a negative error code.
+ */
+static int epoll_entry_update(struct epoll_entry *entry)
+{
+	const struct fd_op_vtable *vtable;
+	struct k_poll_event events[EPOLL_ENTRY_EVENTS];
+	struct zsock_pollfd pfd;
+	struct k_poll_event *pev = events;
+	struct k_mutex *lock;
+	void *obj;
+	int ret;
+
+	obj = z_get_fd_obj_and_vtable(entry->fd, &vtable, &lock);
+	if (obj == NULL) {
+		return -EBADF;
+	}
+
+	pfd.fd = entry->fd;
+	pfd.events = entry->interest & EPOLL_POLL_EVENTS;
+	pfd.revents = 0;
+
+	ret = epoll_poll_ioctl(vtable, obj, lock, ZFD_IOCTL_POLL_PREPARE,
+			       &pfd, &pev, events + ARRAY_SIZE(events));
+	if (ret < 0 && ret != -EALREADY) {
+		return ret;
+	}
+
+	if (pev != events) {
+		(void)k_poll(events, pev - events, K_NO_WAIT);
+	}
+
+	pev = events;
+
+	ret = epoll_poll_ioctl(vtable, obj, lock, ZFD_IOCTL_POLL_UPDATE,
+			       &pfd, &pev, NULL);
+	if (ret == -EAGAIN) {
+		/* Woken up, but there is nothing to report yet */
+		return 0;
+	} else if (ret < 0) {
+		return ret;
+	}
+
+	return pfd.revents & (entry->interest | ZSOCK_EPOLLERR | ZSOCK_EPOLLHUP);
+}
+
+/* Report up to max_events ready entries, must be called with the instance
+ * lock held. Only the entries queued so far are looked at, entries that
+ * are re-armed and found ready again are left for the next call.
+ */
+static int epoll_collect(struct epoll_ctx *ep, struct zsock_epoll_event *events,
+			 int max_events)
+{
+	sys_dlist_t pending;
+	sys_dnode_t *node;
+	k_spinlock_key_t key;
+	int count = 0;
+
+	sys_dlist_init(&pending);
+
+	key = k_spin_lock(&ep->ready_lock);
+
+	while ((node = sys_dlist_get(&ep->ready)) != NULL) {
+		sys_dlist_append(&pending, node);
+	}
+
+	k_spin_unlock(&ep->ready_lock, key);
+
+	while (count < max_events &&
+	       (node = sys_dlist_get(&pending)) != NULL) {
+		struct epoll_entry *entry =
+			CONTAINER_OF(node, struct epoll_entry, node);
+		int revents;
+		int ret;
+
+		revents = epoll_entry_update(entry);
+		if (revents > 0) {
+			events[count].events = revents;
+			events[count].data = entry->data;
+			count++;
+
+			/* Stays disabled until ZSOCK_EPOLL_CTL_MOD */
+			if (entry->interest & ZSOCK_EPOLLONESHOT) {
+				continue;
+			}
+		}
+
+		/* Level-triggered: a descriptor that stays ready is queued
+		 * again as soon as it is re-armed.
+		 */
+		ret = revents < 0 ? revents : epoll_entry_arm(entry);
+		if (ret < 0) {
+			NET_WARN("Cannot monitor fd %d (%d)", entry->fd, ret);
+		}
+	}
+
+	/* Put back what did not fit, ahead of the newly queued entries */
+	key = k_spin_lock(&ep->ready_lock);
+
+	while ((node = sys_dlist_peek_tail(&pending)) != NULL) {
+		sys_dlist_remove(node);
+		sys_dlist_prepend(&ep->ready, node);
+	}
+
+	if (!sys_dlist_is_empty(&ep->ready)) {
+		k_sem_give(&ep->ready_sem);
+	}
+
+	k_spin_unlock(&ep->ready_lock, key);
+
+	return count;
+}
+
+static struct epoll_ctx *epoll_get(int epfd)
+{
+	return z_get_fd_obj(epfd, &epoll_fd_op_vtable, EINVAL);
+}
+
+int z_impl_zsock_epoll_create(int size)
+{
+	struct epoll_ctx *ep = NULL;
+	int fd;
+
+	if (size <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	fd = z_reserve_fd();
+	if (fd < 0) {
+		return -1;
+	}
+
+	/* Hold the lock until the descriptor lock has been handed over, so
+	 * that z_epoll_fd_close() never sees a half initialized instance.
+	 */
+	(void)k_mutex_lock(&epoll_ctxs_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(epoll_ctxs); i++) {
+		if (!epoll_ctxs[i].in_use) {
+			ep = &epoll_ctxs[i];
+			break;
+		}
+	}
+
+	if (ep == NULL) {
+		k_mutex_unlock(&epoll_ctxs_lock);
+		z_free_fd(fd);
+		errno = ENOMEM;
+		return -1;
+	}
+
+	sys_dlist_init(&ep->ready);
+	k_sem_init(&ep->ready_sem, 0, 1);
+
+	for (int i = 0; i < ARRAY_SIZE(ep->entries); i++) {
+		ep->entries[i].in_use = false;
+	}
+
+	ep->in_use = true;
+
+	z_finalize_fd(fd, ep, &epoll_fd_op_vtable);
+
+	k_mutex_unlock(&epoll_ctxs_lock);
+
+	return fd;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_create(int size)
+{
+	return z_impl_zsock_epoll_create(size);
+}
+#include <syscalls/zsock_epoll_create_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_zsock_epoll_ctl(int epfd, int op, int fd,
+			   struct zsock_epoll_event *event)
+{
+	const struct fd_op_vtable *vtable;
+	struct epoll_entry *entry;
+	struct epoll_ctx *ep;
+	int ret = 0;
+
+	ep = epoll_get(epfd);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (z_get_fd_obj_and_vtable(fd, &vtable, NULL) == NULL) {
+		return -1;
+	}
+
+	/* Nesting epoll instances is not supported */
+	if (vtable == &epoll_fd_op_vtable) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (op != ZSOCK_EPOLL_CTL_DEL &&
+	    (event == NULL || (event->events & ~EPOLL_VALID_EVENTS) != 0)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(ep->lock, K_FOREVER);
+
+	entry = epoll_entry_find(ep, fd);
+
+	switch (op) {
+	case ZSOCK_EPOLL_CTL_ADD:
+		if (entry != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		entry = epoll_entry_alloc(ep, fd);
+		if (entry == NULL) {
+			ret = -ENOSPC;
+			break;
+		}
+
+		entry->interest = event->events;
+		entry->data = event->data;
+
+		ret = epoll_entry_arm(entry);
+		if (ret < 0) {
+			epoll_entry_free(entry);
+		}
+
+		break;
+
+	case ZSOCK_EPOLL_CTL_MOD:
+		if (entry == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		epoll_entry_disarm(entry);
+
+		entry->interest = event->events;
+		entry->data = event->data;
+
+		ret = epoll_entry_arm(entry);
+		break;
+
+	case ZSOCK_EPOLL_CTL_DEL:
+		if (entry == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		epoll_entry_free(entry);
+		break;
+
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	k_mutex_unlock(ep->lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_ctl(int epfd, int op, int fd,
+					 struct zsock_epoll_event *event)
+{
+	struct zsock_epoll_event event_copy;
+
+	if (op == ZSOCK_EPOLL_CTL_DEL) {
+		return z_impl_zsock_epoll_ctl(epfd, op, fd, NULL);
+	}
+
+	if (event == NULL) {
+		errno = EFAULT;
+		return -1;
+	}
+
+	K_OOPS(k_usermode_from_copy(&event_copy, event, sizeof(event_copy)));
+
+	return z_impl_zsock_epoll_ctl(epfd, op, fd, &event_copy);
+}
+#include <syscalls/zsock_epoll_ctl_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+int z_impl_zsock_epoll_wait(int epfd, struct zsock_epoll_event *events,
+			    int maxevents, int timeout)
+{
+	struct epoll_ctx *ep;
+	struct k_mutex *lock;
+	uint32_t generation;
+	k_timepoint_t end;
+	int ret;
+
+	ep = epoll_get(epfd);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (maxevents <= 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc(timeout < 0 ? K_FOREVER : K_MSEC(timeout));
+
+	/* The instance may be closed and reused by another descriptor while
+	 * waiting, keep the lock of this one.
+	 */
+	lock = ep->lock;
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	generation = ep->generation;
+
+	while (true) {
+		ret = epoll_collect(ep, events, maxevents);
+		if (ret > 0) {
+			break;
+		}
+
+		k_mutex_unlock(lock);
+
+		ret = k_sem_take(&ep->ready_sem, sys_timepoint_timeout(end));
+
+		(void)k_mutex_lock(lock, K_FOREVER);
+
+		if (!ep->in_use || ep->generation != generation) {
+			/* Instance closed while waiting */
+			errno = EBADF;
+			ret = -1;
+			break;
+		}
+
+		if (ret != 0) {
+			ret = epoll_collect(ep, events, maxevents);
+			break;
+		}
+	}
+
+	k_mutex_unlock(lock);
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_zsock_epoll_wait(int epfd,
+					  struct zsock_epoll_event *events,
+					  int maxevents, int timeout)
+{
+	if (maxevents > 0) {
+		K_OOPS(K_SYSCALL_MEMORY_ARRAY_WRITE(events, maxevents,
+						    sizeof(*events)));
+	}
+
+	return z_impl_zsock_epoll_wait(epfd, events, maxevents, timeout);
+}
+#include <syscalls/zsock_epoll_wait_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+void z_epoll_fd_close(int fd)
+{
+	(void)k_mutex_lock(&epoll_ctxs_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(epoll_ctxs); i++) {
+		struct epoll_ctx *ep = &epoll_ctxs[i];
+		struct epoll_entry *entry;
+
+		if (!ep->in_use) {
+			continue;
+		}
+
+		(void)k_mutex_lock(ep->lock, K_FOREVER);
+
+		entry = ep->in_use ? epoll_entry_find(ep, fd) : NULL;
+		if (entry != NULL) {
+			epoll_entry_free(entry);
+		}
+
+		k_mutex_unlock(ep->lock);
+	}
+
+	k_mutex_unlock(&epoll_ctxs_lock);
+}
+
+static ssize_t epoll_read_vmeth(void *obj, void *buffer, size_t count)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buffer);
+	ARG_UNUSED(count);
+
+	errno = EINVAL;
+	return -1;
+}
+
+static ssize_t epoll_write_vmeth(void *obj, const void *buffer, size_t count)
+{
+	ARG_UNUSED(obj);
+	ARG_UNUSED(buffer);
+	ARG_UNUSED(count);
+
+	errno = EINVAL;
+	return -1;
+}
+
+static int epoll_close_vmeth(void *obj)
+{
+	struct epoll_ctx *ep = obj;
+
+	/* Called with the descriptor lock held */
+	for (int i = 0; i < ARRAY_SIZE(ep->entries); i++) {
+		if (ep->entries[i].in_use) {
+			epoll_entry_free(&ep->entries[i]);
+		}
+	}
+
+	ep->generation++;
+	ep->in_use = false;
+
+	/* Wake up a waiter, it will notice the instance is gone */
+	k_sem_give(&ep->ready_sem);
+
+	return 0;
+}
+
+static int epoll_ioctl_vmeth(void *obj, unsigned int request, va_list args)
+{
+	struct epoll_ctx *ep = obj;
+
+	switch (request) {
+	case ZFD_IOCTL_SET_LOCK:
+		ep->lock = va_arg(args, struct k_mutex *);
+		return 0;
+
+	default:
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+}
+
+static const struct fd_op_vtable epoll_fd_op_vtable = {
+	.read = epoll_read_vmeth,
+	.write = epoll_write_vmeth,
+	.close = epoll_close_vmeth,
+	.ioctl = epoll_ioctl_vmeth,
+};
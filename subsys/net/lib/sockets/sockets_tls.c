@@ -51,6 +51,9 @@ LOG_MODULE_REGISTER(net_sock_tls, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <mbedtls/error.h>
 #include <mbedtls/platform.h>
 #include <mbedtls/ssl_cache.h>
+#if defined(MBEDTLS_SSL_TICKET_C)
+#include <mbedtls/ssl_ticket.h>
+#endif
 #endif /* CONFIG_MBEDTLS */
 
 #include "sockets_internal.h"
@@ -105,6 +108,16 @@ struct tls_session_cache {
 	/** Peer address. */
 	struct sockaddr peer_addr;
 
+	/** Hash of the peer hostname, 0 if the session is mapped to the
+	 *  peer address only.
+	 */
+	uint32_t hostname_hash;
+
+	/** Peer hostname, stored after the session in the session buffer,
+	 *  NULL if the session is mapped to the peer address only.
+	 */
+	char *hostname;
+
 	/** Session buffer. */
 	uint8_t *session;
 
@@ -165,6 +178,9 @@ __net_socket struct tls_context {
 		/** Information if hostname was explicitly set on a socket. */
 		bool is_hostname_set;
 
+		/** Hash of the hostname, used to find cached sessions. */
+		uint32_t hostname_hash;
+
 		/** Peer verification level. */
 		int8_t verify_level;
 
@@ -244,6 +260,28 @@ static struct tls_session_cache client_cache[CONFIG_NET_SOCKETS_TLS_MAX_CLIENT_S
 static mbedtls_ssl_cache_context server_cache;
 #endif
 
+#if defined(MBEDTLS_SSL_TICKET_C)
+/* Ticket keys shared by all TLS/DTLS server sockets. */
+static mbedtls_ssl_ticket_context server_tickets;
+static bool server_tickets_ready;
+
+#if defined(MBEDTLS_GCM_C)
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_AES_128_GCM
+#elif defined(MBEDTLS_CCM_C)
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_AES_128_CCM
+#else
+#define TLS_TICKET_CIPHER MBEDTLS_CIPHER_CHACHA20_POLY1305
+#endif
+#endif /* MBEDTLS_SSL_TICKET_C */
+
+/* Client handshake statistics, see TLS_HANDSHAKE_STATS. */
+static struct {
+	atomic_t full;
+	atomic_t full_time;
+	atomic_t resumed;
+	atomic_t resumed_time;
+} handshake_stats;
+
 /* A mutex for protecting TLS context allocation. */
 static struct k_mutex context_lock;
 
@@ -363,6 +401,10 @@ static int tls_init(void)
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
 
+#if defined(MBEDTLS_SSL_TICKET_C)
+	mbedtls_ssl_ticket_init(&server_tickets);
+#endif
+
 	return 0;
 }
 
@@ -555,10 +597,40 @@ static bool peer_addr_cmp(const struct sockaddr *addr,
 	return false;
 }
 
+static uint16_t peer_port(const struct sockaddr *addr)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && addr->sa_family == AF_INET6) {
+		return net_sin6(addr)->sin6_port;
+	}
+
+	return net_sin(addr)->sin_port;
+}
+
+/* Sessions of a named peer are found by hostname and port, so that they
+ * can be resumed when the name resolves to another address.
+ */
+static bool tls_session_cmp(const struct tls_session_cache *entry,
+			    const struct sockaddr *peer_addr,
+			    uint32_t hostname_hash, const char *hostname)
+{
+	if (entry->hostname_hash != hostname_hash) {
+		return false;
+	}
+
+	if (hostname != NULL) {
+		return strcmp(entry->hostname, hostname) == 0 &&
+		       peer_port(&entry->peer_addr) == peer_port(peer_addr);
+	}
+
+	return peer_addr_cmp(&entry->peer_addr, peer_addr);
+}
+
 static int tls_session_save(const struct sockaddr *peer_addr,
+			    uint32_t hostname_hash, const char *hostname,
 			    mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
+	size_t hostname_len = 0;
 	size_t session_len;
 	int ret;
 
@@ -569,7 +641,8 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 				entry = &client_cache[i];
 			}
 		} else {
-			if (peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
+			if (tls_session_cmp(&client_cache[i], peer_addr,
+					    hostname_hash, hostname)) {
 				/* Reuse old entry for given address. */
 				entry = &client_cache[i];
 				break;
@@ -589,11 +662,16 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 	if (entry->session != NULL) {
 		mbedtls_free(entry->session);
 		entry->session = NULL;
+		entry->hostname = NULL;
 	}
 
 	(void)mbedtls_ssl_session_save(session, NULL, 0, &session_len);
 
-	entry->session = mbedtls_calloc(1, session_len);
+	if (hostname != NULL) {
+		hostname_len = strlen(hostname) + 1;
+	}
+
+	entry->session = mbedtls_calloc(1, session_len + hostname_len);
 	if (entry->session == NULL) {
 		NET_ERR("Failed to allocate session buffer.");
 		return -ENOMEM;
@@ -608,14 +686,21 @@ static int tls_session_save(const struct sockaddr *peer_addr,
 		return -ENOMEM;
 	}
 
+	if (hostname != NULL) {
+		entry->hostname = (char *)entry->session + session_len;
+		memcpy(entry->hostname, hostname, hostname_len);
+	}
+
 	entry->session_len = session_len;
 	entry->timestamp = k_uptime_get();
+	entry->hostname_hash = hostname_hash;
 	memcpy(&entry->peer_addr, peer_addr, sizeof(*peer_addr));
 
 	return 0;
 }
 
 static int tls_session_get(const struct sockaddr *peer_addr,
+			   uint32_t hostname_hash, const char *hostname,
 			   mbedtls_ssl_session *session)
 {
 	struct tls_session_cache *entry = NULL;
@@ -623,7 +708,8 @@ static int tls_session_get(const struct sockaddr *peer_addr,
 
 	for (int i = 0; i < ARRAY_SIZE(client_cache); i++) {
 		if (client_cache[i].session != NULL &&
-		    peer_addr_cmp(&client_cache[i].peer_addr, peer_addr)) {
+		    tls_session_cmp(&client_cache[i], peer_addr,
+				    hostname_hash, hostname)) {
 			entry = &client_cache[i];
 			break;
 		}
@@ -639,12 +725,25 @@ static int tls_session_get(const struct sockaddr *peer_addr,
 		/* Discard corrupted session data. */
 		mbedtls_free(entry->session);
 		entry->session = NULL;
+		entry->hostname = NULL;
 		return -EIO;
 	}
 
 	return 0;
 }
 
+/* Hostname the sessions of the context are cached under, if any */
+static const char *tls_session_hostname(struct tls_context *context)
+{
+#if defined(MBEDTLS_X509_CRT_PARSE_C)
+	if (context->options.hostname_hash != 0U) {
+		return context->ssl.hostname;
+	}
+#endif
+
+	return NULL;
+}
+
 static void tls_session_store(struct tls_context *context,
 			      const struct sockaddr *addr,
 			      socklen_t addrlen)
@@ -666,7 +765,8 @@ static void tls_session_store(struct tls_context *context,
 		goto exit;
 	}
 
-	ret = tls_session_save(&peer_addr, &session);
+	ret = tls_session_save(&peer_addr, context->options.hostname_hash,
+			       tls_session_hostname(context), &session);
 	if (ret < 0) {
 		NET_ERR("Failed to save session for %p", context);
 	}
@@ -675,22 +775,25 @@ exit:
 	mbedtls_ssl_session_free(&session);
 }
 
-static void tls_session_restore(struct tls_context *context,
+/* Returns true if a cached session was offered to the peer. */
+static bool tls_session_restore(struct tls_context *context,
 				const struct sockaddr *addr,
 				socklen_t addrlen)
 {
 	mbedtls_ssl_session session;
 	struct sockaddr peer_addr = { 0 };
+	bool restored = false;
 	int ret;
 
 	if (!context->options.cache_enabled) {
-		return;
+		return false;
 	}
 
 	memcpy(&peer_addr, addr, addrlen);
 	mbedtls_ssl_session_init(&session);
 
-	ret = tls_session_get(&peer_addr, &session);
+	ret = tls_session_get(&peer_addr, context->options.hostname_hash,
+			      tls_session_hostname(context), &session);
 	if (ret < 0) {
 		NET_DBG("Session not found for %p", context);
 		goto exit;
@@ -699,10 +802,90 @@ static void tls_session_restore(struct tls_context *context,
 	ret = mbedtls_ssl_set_session(&context->ssl, &session);
 	if (ret < 0) {
 		NET_ERR("Failed to set session for %p", context);
+		goto exit;
 	}
 
+	restored = true;
+
 exit:
 	mbedtls_ssl_session_free(&session);
+
+	return restored;
+}
+
+/* A resumed session keeps the master secret of the cached session, while a
+ * full handshake negotiates a new one. Must be called before the session
+ * of the completed handshake is stored.
+ */
+static bool tls_session_is_resumed(struct tls_context *context,
+				   const struct sockaddr *addr,
+				   socklen_t addrlen)
+{
+#if defined(MBEDTLS_SSL_PROTO_TLS1_2)
+	mbedtls_ssl_session session;
+	struct sockaddr peer_addr = { 0 };
+	bool resumed = false;
+
+	memcpy(&peer_addr, addr, addrlen);
+	mbedtls_ssl_session_init(&session);
+
+	if (context->ssl.session->tls_version == MBEDTLS_SSL_VERSION_TLS1_2 &&
+	    tls_session_get(&peer_addr, context->options.hostname_hash,
+			    tls_session_hostname(context), &session) == 0) {
+		resumed = memcmp(session.master, context->ssl.session->master,
+				 sizeof(session.master)) == 0;
+	}
+
+	mbedtls_ssl_session_free(&session);
+
+	return resumed;
+#else
+	ARG_UNUSED(context);
+	ARG_UNUSED(addr);
+	ARG_UNUSED(addrlen);
+
+	return false;
+#endif
+}
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+/* Must be called with context_lock held. */
+static int tls_session_tickets_setup(void)
+{
+	int ret;
+
+	if (server_tickets_ready) {
+		return 0;
+	}
+
+	ret = mbedtls_ssl_ticket_setup(&server_tickets, tls_ctr_drbg_random,
+				       NULL, TLS_TICKET_CIPHER,
+				       CONFIG_NET_SOCKETS_TLS_SESSION_TICKET_LIFETIME);
+	if (ret != 0) {
+		NET_ERR("Failed to set up session tickets, err: -0x%x", -ret);
+		mbedtls_ssl_ticket_free(&server_tickets);
+		mbedtls_ssl_ticket_init(&server_tickets);
+		return -ENOMEM;
+	}
+
+	server_tickets_ready = true;
+
+	return 0;
+}
+#endif /* MBEDTLS_SSL_TICKET_C */
+
+static void tls_handshake_stats_update(bool resumed, uint32_t duration)
+{
+	if (resumed) {
+		atomic_inc(&handshake_stats.resumed);
+		atomic_add(&handshake_stats.resumed_time, duration);
+	} else {
+		atomic_inc(&handshake_stats.full);
+		atomic_add(&handshake_stats.full_time, duration);
+	}
+
+	NET_DBG("%s handshake took %u ms", resumed ? "Resumed" : "Full",
+		duration);
 }
 
 static void tls_session_purge(void)
@@ -713,6 +896,20 @@ static void tls_session_purge(void)
 	mbedtls_ssl_cache_free(&server_cache);
 	mbedtls_ssl_cache_init(&server_cache);
 #endif
+
+#if defined(MBEDTLS_SSL_TICKET_C)
+	/* New ticket keys invalidate all the tickets issued so far. */
+	k_mutex_lock(&context_lock, K_FOREVER);
+
+	if (server_tickets_ready) {
+		mbedtls_ssl_ticket_free(&server_tickets);
+		mbedtls_ssl_ticket_init(&server_tickets);
+		server_tickets_ready = false;
+		(void)tls_session_tickets_setup();
+	}
+
+	k_mutex_unlock(&context_lock);
+#endif
 }
 
 static inline int time_left(uint32_t start, uint32_t timeout)
@@ -1254,6 +1451,34 @@ static int tls_mbedtls_handshake(struct tls_context *context,
 	return ret;
 }
 
+/* Handshake as a client, trying to resume a cached session first. */
+static int tls_mbedtls_client_handshake(struct tls_context *context,
+					const struct sockaddr *addr,
+					socklen_t addrlen)
+{
+	uint32_t start = k_uptime_get_32();
+	bool offered;
+	int ret;
+
+	offered = tls_session_restore(context, addr, addrlen);
+
+	/* TODO For simplicity, TLS handshake blocks the socket even for
+	 * non-blocking socket.
+	 */
+	ret = tls_mbedtls_handshake(context, K_FOREVER);
+	if (ret < 0) {
+		return ret;
+	}
+
+	tls_handshake_stats_update(offered &&
+				   tls_session_is_resumed(context, addr, addrlen),
+				   k_uptime_get_32() - start);
+
+	tls_session_store(context, addr, addrlen);
+
+	return 0;
+}
+
 static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 {
 	int role, type, ret;
@@ -1389,6 +1614,32 @@ static int tls_mbedtls_init(struct tls_context *context, bool is_server)
 	}
 #endif
 
+#if defined(MBEDTLS_SSL_TICKET_C) && defined(MBEDTLS_SSL_SRV_C)
+	if (is_server && context->options.cache_enabled) {
+		k_mutex_lock(&context_lock, K_FOREVER);
+		ret = tls_session_tickets_setup();
+		k_mutex_unlock(&context_lock);
+		if (ret != 0) {
+			return ret;
+		}
+
+		mbedtls_ssl_conf_session_tickets_cb(&context->config,
+						    mbedtls_ssl_ticket_write,
+						    mbedtls_ssl_ticket_parse,
+						    &server_tickets);
+	}
+#endif
+
+#if defined(MBEDTLS_SSL_SESSION_TICKETS) && defined(MBEDTLS_SSL_CLI_C)
+	/* Only ask for a ticket if it is going to be stored. */
+	if (!is_server) {
+		mbedtls_ssl_conf_session_tickets(&context->config,
+			context->options.cache_enabled ?
+				MBEDTLS_SSL_SESSION_TICKETS_ENABLED :
+				MBEDTLS_SSL_SESSION_TICKETS_DISABLED);
+	}
+#endif
+
 	ret = mbedtls_ssl_setup(&context->ssl,
 				&context->config);
 	if (ret != 0) {
@@ -1473,6 +1724,19 @@ static int tls_opt_sec_tag_list_get(struct tls_context *context,
 	return 0;
 }
 
+/* FNV-1a hash of the hostname, never 0 as 0 stands for no hostname. */
+static uint32_t tls_hostname_hash(const char *hostname)
+{
+	uint32_t hash = 2166136261U;
+
+	while (*hostname != '\0') {
+		hash ^= (uint8_t)*hostname++;
+		hash *= 16777619U;
+	}
+
+	return hash != 0U ? hash : 1U;
+}
+
 static int tls_opt_hostname_set(struct tls_context *context,
 				const void *optval, socklen_t optlen)
 {
@@ -1487,6 +1751,11 @@ static int tls_opt_hostname_set(struct tls_context *context,
 #endif
 
 	context->options.is_hostname_set = true;
+	context->options.hostname_hash = 0U;
+
+	if (optval != NULL) {
+		context->options.hostname_hash = tls_hostname_hash(optval);
+	}
 
 	return 0;
 }
@@ -1870,6 +2139,22 @@ static int tls_opt_session_cache_get(struct tls_context *context,
 	return 0;
 }
 
+static int tls_opt_handshake_stats_get(void *optval, socklen_t *optlen)
+{
+	struct tls_handshake_stats *stats = optval;
+
+	if (*optlen != sizeof(*stats)) {
+		return -EINVAL;
+	}
+
+	stats->full = atomic_get(&handshake_stats.full);
+	stats->full_time = atomic_get(&handshake_stats.full_time);
+	stats->resumed = atomic_get(&handshake_stats.resumed);
+	stats->resumed_time = atomic_get(&handshake_stats.resumed_time);
+
+	return 0;
+}
+
 static int tls_opt_session_cache_purge_set(struct tls_context *context,
 					   const void *optval, socklen_t optlen)
 {
@@ -2092,17 +2377,10 @@ int ztls_connect_ctx(struct tls_context *ctx, const struct sockaddr *addr,
 		/* Do not use any socket flags during the handshake. */
 		ctx->flags = 0;
 
-		tls_session_restore(ctx, addr, addrlen);
-
-		/* TODO For simplicity, TLS handshake blocks the socket
-		 * even for non-blocking socket.
-		 */
-		ret = tls_mbedtls_handshake(ctx, K_FOREVER);
+		ret = tls_mbedtls_client_handshake(ctx, addr, addrlen);
 		if (ret < 0) {
 			goto error;
 		}
-
-		tls_session_store(ctx, addr, addrlen);
 	} else {
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 		/* Just store the address. */
@@ -2277,19 +2555,11 @@ static ssize_t sendto_dtls_client(struct tls_context *ctx, const void *buf,
 	}
 
 	if (!is_handshake_complete(ctx)) {
-		tls_session_restore(ctx, &ctx->dtls_peer_addr,
-				    ctx->dtls_peer_addrlen);
-
-		/* TODO For simplicity, TLS handshake blocks the socket even for
-		 * non-blocking socket.
-		 */
-		ret = tls_mbedtls_handshake(ctx, K_FOREVER);
+		ret = tls_mbedtls_client_handshake(ctx, &ctx->dtls_peer_addr,
+						   ctx->dtls_peer_addrlen);
 		if (ret < 0) {
 			goto error;
 		}
-
-		tls_session_store(ctx, &ctx->dtls_peer_addr,
-				  ctx->dtls_peer_addrlen);
 	}
 
 	return send_tls(ctx, buf, len, flags);
@@ -3186,6 +3456,10 @@ int ztls_getsockopt_ctx(struct tls_context *ctx, int level, int optname,
 		err = tls_opt_session_cache_get(ctx, optval, optlen);
 		break;
 
+	case TLS_HANDSHAKE_STATS:
+		err = tls_opt_handshake_stats_get(optval, optlen);
+		break;
+
 #if defined(CONFIG_NET_SOCKETS_ENABLE_DTLS)
 	case TLS_DTLS_HANDSHAKE_TIMEOUT_MIN:
 		err = tls_opt_dtls_handshake_timeout_get(ctx, optval,
@@ -618,6 +618,39 @@ static int websocket_prepare_and_send(struct websocket_context *ctx,
 #endif /* CONFIG_NET_TEST */
 }
 
+/* XOR len bytes of src with the masking key into dst, which may be src.
+ * The offset is the position of the data in the payload, and tells which
+ * byte of the key applies to the first one.
+ */
+static void websocket_mask(uint8_t *dst, const uint8_t *src, size_t len,
+			   uint32_t masking_value, size_t offset)
+{
+	uint8_t key[sizeof(uint32_t)];
+	uint32_t key_word;
+	size_t i = 0;
+
+	sys_put_be32(masking_value, key);
+
+	/* Byte by byte until the destination is word aligned */
+	while ((i < len) && !IS_PTR_ALIGNED(&dst[i], uint32_t)) {
+		dst[i] = src[i] ^ key[(offset + i) % sizeof(key)];
+		i++;
+	}
+
+	/* Then a word at a time, with the key rotated to match */
+	for (size_t k = 0; k < sizeof(key); k++) {
+		((uint8_t *)&key_word)[k] = key[(offset + i + k) % sizeof(key)];
+	}
+
+	for (; len - i >= sizeof(uint32_t); i += sizeof(uint32_t)) {
+		*(uint32_t *)&dst[i] = UNALIGNED_GET((const uint32_t *)&src[i]) ^ key_word;
+	}
+
+	for (; i < len; i++) {
+		dst[i] = src[i] ^ key[(offset + i) % sizeof(key)];
+	}
+}
+
 int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 		       enum websocket_opcode opcode, bool mask, bool final,
 		       int32_t timeout)
@@ -687,8 +720,6 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 
 	/* Add masking value if needed */
 	if (mask) {
-		int i;
-
 		ctx->masking_value = sys_rand32_get();
 
 		header[hdr_len++] |= ctx->masking_value >> 24;
@@ -702,11 +733,8 @@ int websocket_send_msg(int ws_sock, const uint8_t *payload, size_t payload_len,
 				return -ENOMEM;
 			}
 
-			memcpy(data_to_send, payload, payload_len);
-
-			for (i = 0; i < payload_len; i++) {
-				data_to_send[i] ^= ctx->masking_value >> (8 * (3 - i % 4));
-			}
+			websocket_mask(data_to_send, payload, payload_len,
+				       ctx->masking_value, 0);
 		}
 	}
 
@@ -1019,15 +1047,10 @@ int websocket_recv_msg(int ws_sock, uint8_t *buf, size_t buf_len,
 
 	/* Unmask the data */
 	if (ctx->masked) {
-		uint8_t *mask_as_bytes = (uint8_t *)&ctx->masking_value;
 		size_t data_buf_offset = ctx->message_len - ctx->parser_remaining - payload.count;
 
-		for (size_t i = 0; i < payload.count; i++) {
-			size_t m = data_buf_offset % 4;
-
-			payload.buf[i] ^= mask_as_bytes[3 - m];
-			data_buf_offset++;
-		}
+		websocket_mask(payload.buf, payload.buf, payload.count, ctx->masking_value,
+			       data_buf_offset);
 	}
 
 	return payload.count;
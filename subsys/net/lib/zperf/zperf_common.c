@@ -6,6 +6,7 @@
 
 #include <zephyr/init.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/net/buf.h>
 #include <zephyr/net/socket.h>
 
 #include "zperf_internal.h"
@@ -206,6 +207,69 @@ uint32_t zperf_packet_duration(uint32_t packet_size, uint32_t rate_in_kbps)
 			  (rate_in_kbps * 1024U));
 }
 
+#if defined(CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD)
+#define ZEROCOPY_HDR_LEN (sizeof(struct zperf_udp_datagram) + \
+			  sizeof(struct zperf_client_hdr_v1))
+#define ZEROCOPY_ALLOC_TIMEOUT K_MSEC(100)
+
+/* Payload buffers only point into the uploaders' sample packets, which do
+ * not change during an upload. Per packet headers are copied into their own
+ * small buffers as the sample packet header is rewritten for each packet.
+ * Both come from the same pool, a packet needs at most one of each.
+ */
+NET_BUF_POOL_FIXED_DEFINE(zperf_zerocopy_pool, 2 * CONFIG_NET_BUF_TX_COUNT,
+			  ZEROCOPY_HDR_LEN, 0, NULL);
+
+int zperf_send_zerocopy(int sock, const uint8_t *data, size_t len,
+			size_t copy_len)
+{
+	struct net_buf *payload = NULL;
+	struct net_buf *buf = NULL;
+	int ret;
+
+	copy_len = MIN(copy_len, len);
+	__ASSERT_NO_MSG(copy_len <= ZEROCOPY_HDR_LEN);
+
+	if (copy_len > 0) {
+		buf = net_buf_alloc(&zperf_zerocopy_pool,
+				    ZEROCOPY_ALLOC_TIMEOUT);
+		if (buf == NULL) {
+			errno = ENOMEM;
+			return -1;
+		}
+
+		net_buf_add_mem(buf, data, copy_len);
+	}
+
+	if (len > copy_len) {
+		payload = net_buf_alloc_with_data(&zperf_zerocopy_pool,
+						  (void *)(data + copy_len),
+						  len - copy_len,
+						  ZEROCOPY_ALLOC_TIMEOUT);
+		if (payload == NULL) {
+			if (buf != NULL) {
+				net_buf_unref(buf);
+			}
+
+			errno = ENOMEM;
+			return -1;
+		}
+
+		if (buf != NULL) {
+			net_buf_frag_add(buf, payload);
+		} else {
+			buf = payload;
+		}
+	}
+
+	ret = zsock_send_buf(sock, buf, 0, NULL, 0);
+
+	net_buf_unref(buf);
+
+	return ret;
+}
+#endif /* CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD */
+
 void zperf_async_work_submit(struct k_work *work)
 {
 	k_work_submit_to_queue(&zperf_work_q, work);
@@ -764,6 +764,13 @@ static int shell_cmd_upload(const struct shell *sh, size_t argc,
 			opt_cnt += 1;
 			break;
 
+#ifdef CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD
+		case 'z':
+			param.options.zerocopy = true;
+			opt_cnt += 1;
+			break;
+#endif /* CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD */
+
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		case 'p':
 			param.options.priority = parse_arg(&i, argc, argv);
@@ -950,6 +957,13 @@ static int shell_cmd_upload2(const struct shell *sh, size_t argc,
 			opt_cnt += 1;
 			break;
 
+#ifdef CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD
+		case 'z':
+			param.options.zerocopy = true;
+			opt_cnt += 1;
+			break;
+#endif /* CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD */
+
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		case 'p':
 			param.options.priority = parse_arg(&i, argc, argv);
@@ -1263,6 +1277,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
+#ifdef CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD
+		  "-z: Send the sample packet without copying it\n"
+#endif /* CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD */
 		  "Example: tcp upload 192.0.2.2 1111 1 1K\n"
 		  "Example: tcp upload 2001:db8::2\n",
 		  cmd_tcp_upload),
@@ -1279,6 +1296,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_tcp,
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
+#ifdef CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD
+		  "-z: Send the sample packet without copying it\n"
+#endif /* CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD */
 		  "Example: tcp upload2 v6 1 1K\n"
 		  "Example: tcp upload2 v4\n"
 		  "-n: Disable Nagle's algorithm\n"
@@ -1322,6 +1342,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
+#ifdef CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD
+		  "-z: Send the sample packet without copying it\n"
+#endif /* CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD */
 		  "Example: udp upload 192.0.2.2 1111 1 1K 1M\n"
 		  "Example: udp upload 2001:db8::2\n",
 		  cmd_udp_upload),
@@ -1339,6 +1362,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(zperf_cmd_udp,
 #ifdef CONFIG_NET_CONTEXT_PRIORITY
 		  "-p: Specify custom packet priority\n"
 #endif /* CONFIG_NET_CONTEXT_PRIORITY */
+#ifdef CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD
+		  "-z: Send the sample packet without copying it\n"
+#endif /* CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD */
 		  "Example: udp upload2 v4 1 1K 1M\n"
 		  "Example: udp upload2 v6\n"
 #if defined(CONFIG_NET_IPV6) && defined(MY_IP6ADDR_SET)
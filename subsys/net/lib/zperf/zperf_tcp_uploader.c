@@ -23,6 +23,7 @@ static struct zperf_async_upload_context tcp_async_upload_ctx;
 static int tcp_upload(int sock,
 		      unsigned int duration_in_ms,
 		      unsigned int packet_size,
+		      bool zerocopy,
 		      struct zperf_results *results)
 {
 	k_timepoint_t end = sys_timepoint_calc(K_MSEC(duration_in_ms));
@@ -50,7 +51,12 @@ static int tcp_upload(int sock,
 
 	do {
 		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
+		if (IS_ENABLED(CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD) && zerocopy) {
+			ret = zperf_send_zerocopy(sock, (uint8_t *)sample_packet,
+						  packet_size, 0);
+		} else {
+			ret = zsock_send(sock, sample_packet, packet_size, 0);
+		}
 		if (ret < 0) {
 			if (nb_errors == 0 && ret != -ENOMEM) {
 				NET_ERR("Failed to send the packet (%d)", errno);
@@ -130,7 +136,8 @@ int zperf_tcp_upload(const struct zperf_upload_params *param,
 		return -EINVAL;
 	}
 
-	ret = tcp_upload(sock, param->duration_ms, param->packet_size, result);
+	ret = tcp_upload(sock, param->duration_ms, param->packet_size,
+			 param->options.zerocopy, result);
 
 	zsock_close(sock);
 
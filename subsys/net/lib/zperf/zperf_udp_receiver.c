@@ -12,6 +12,7 @@ LOG_MODULE_DECLARE(net_zperf, CONFIG_NET_ZPERF_LOG_LEVEL);
 
 #include <zephyr/kernel.h>
 
+#include <zephyr/net/net_pkt.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/net/zperf.h>
 
@@ -99,21 +100,14 @@ static int zperf_receiver_send_stat(int sock, const struct sockaddr *addr,
 	return ret;
 }
 
-static void udp_received(int sock, const struct sockaddr *addr, uint8_t *data,
-			 size_t datalen)
+static void udp_received(int sock, const struct sockaddr *addr,
+			 struct zperf_udp_datagram *hdr, size_t datalen)
 {
-	struct zperf_udp_datagram *hdr;
 	struct session *session;
 	int32_t transit_time;
 	int64_t time;
 	int32_t id;
 
-	if (datalen < sizeof(struct zperf_udp_datagram)) {
-		NET_WARN("Short iperf packet!");
-		return;
-	}
-
-	hdr = (struct zperf_udp_datagram *)data;
 	time = k_uptime_ticks();
 
 	session = get_session(addr, SESSION_UDP);
@@ -230,9 +224,115 @@ static void udp_received(int sock, const struct sockaddr *addr, uint8_t *data,
 	}
 }
 
-static void udp_server_session(void)
+#if CONFIG_NET_ZPERF_UDP_BATCH_SIZE > 1
+#define UDP_RECV_BATCH CONFIG_NET_ZPERF_UDP_BATCH_SIZE
+
+/* Drain up to a batch of queued datagrams with one call. Only the zperf
+ * header is copied out, MSG_TRUNC still reports the full datagram length
+ * needed for the statistics.
+ */
+static int udp_recv_ready(int sock)
+{
+	static struct zperf_udp_datagram hdrs[UDP_RECV_BATCH];
+	static struct sockaddr addrs[UDP_RECV_BATCH];
+	static struct iovec iov[UDP_RECV_BATCH];
+	static struct zsock_mmsghdr msgs[UDP_RECV_BATCH];
+	int ret;
+
+	for (int i = 0; i < UDP_RECV_BATCH; i++) {
+		iov[i].iov_base = &hdrs[i];
+		iov[i].iov_len = sizeof(hdrs[i]);
+
+		msgs[i].msg_hdr.msg_name = &addrs[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(addrs[i]);
+		msgs[i].msg_hdr.msg_iov = &iov[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_control = NULL;
+		msgs[i].msg_hdr.msg_controllen = 0;
+	}
+
+	ret = zsock_recvmmsg(sock, msgs, UDP_RECV_BATCH,
+			     ZSOCK_MSG_DONTWAIT | ZSOCK_MSG_TRUNC);
+	if (ret < 0) {
+		return (errno == EAGAIN) ? 0 : ret;
+	}
+
+	for (int i = 0; i < ret; i++) {
+		if (msgs[i].msg_len < sizeof(struct zperf_udp_datagram)) {
+			NET_WARN("Short iperf packet!");
+			continue;
+		}
+
+		udp_received(sock, &addrs[i], &hdrs[i], msgs[i].msg_len);
+	}
+
+	return 0;
+}
+#else
+#if defined(CONFIG_NET_ZPERF_UDP_RECV_ZEROCOPY)
+/* Only the zperf header is needed, so read it out of the loaned packet and
+ * leave the rest of the payload where it is.
+ */
+static ssize_t udp_recv(int sock, struct zperf_udp_datagram **hdr,
+			struct sockaddr *addr, socklen_t *addrlen)
+{
+	static struct zperf_udp_datagram hdr_buf;
+	struct net_pkt *pkt;
+	ssize_t ret;
+
+	ret = zsock_recv_pkt(sock, &pkt, 0, addr, addrlen);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (ret >= sizeof(hdr_buf) &&
+	    net_pkt_read(pkt, &hdr_buf, sizeof(hdr_buf)) < 0) {
+		ret = 0;
+	}
+
+	zsock_release_pkt(pkt);
+
+	*hdr = &hdr_buf;
+
+	return ret;
+}
+#else
+static ssize_t udp_recv(int sock, struct zperf_udp_datagram **hdr,
+			struct sockaddr *addr, socklen_t *addrlen)
 {
 	static uint8_t buf[UDP_RECEIVER_BUF_SIZE];
+
+	*hdr = (struct zperf_udp_datagram *)buf;
+
+	return zsock_recvfrom(sock, buf, sizeof(buf), 0, addr, addrlen);
+}
+#endif /* CONFIG_NET_ZPERF_UDP_RECV_ZEROCOPY */
+
+static int udp_recv_ready(int sock)
+{
+	struct zperf_udp_datagram *hdr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	ssize_t ret;
+
+	ret = udp_recv(sock, &hdr, &addr, &addrlen);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (ret < sizeof(struct zperf_udp_datagram)) {
+		NET_WARN("Short iperf packet!");
+		return 0;
+	}
+
+	udp_received(sock, &addr, hdr, ret);
+
+	return 0;
+}
+#endif /* CONFIG_NET_ZPERF_UDP_BATCH_SIZE > 1 */
+
+static void udp_server_session(void)
+{
 	struct zsock_pollfd fds[SOCK_ID_MAX] = { 0 };
 	int ret;
 
@@ -357,9 +457,6 @@ use_any_ipv6:
 		}
 
 		for (int i = 0; i < ARRAY_SIZE(fds); i++) {
-			struct sockaddr addr;
-			socklen_t addrlen = sizeof(addr);
-
 			if ((fds[i].revents & ZSOCK_POLLERR) ||
 			    (fds[i].revents & ZSOCK_POLLNVAL)) {
 				NET_ERR("UDP receiver IPv%d socket error",
@@ -371,15 +468,12 @@ use_any_ipv6:
 				continue;
 			}
 
-			ret = zsock_recvfrom(fds[i].fd, buf, sizeof(buf), 0,
-					     &addr, &addrlen);
+			ret = udp_recv_ready(fds[i].fd);
 			if (ret < 0) {
 				NET_ERR("recv failed on IPv%d socket (%d)",
 					(i == SOCK_ID_IPV4) ? 4 : 6, errno);
 				goto error;
 			}
-
-			udp_received(fds[i].fd, &addr, buf, ret);
 		}
 	}
 
@@ -419,8 +513,9 @@ void zperf_udp_receiver_init(void)
 			udp_receiver_thread,
 			NULL, NULL, NULL,
 			UDP_RECEIVER_THREAD_PRIORITY,
-			IS_ENABLED(CONFIG_USERSPACE) ? K_USER |
-						       K_INHERIT_PERMS : 0,
+			IS_ENABLED(CONFIG_USERSPACE) &&
+			!IS_ENABLED(CONFIG_NET_ZPERF_UDP_RECV_ZEROCOPY) ?
+				K_USER | K_INHERIT_PERMS : 0,
 			K_NO_WAIT);
 }
 
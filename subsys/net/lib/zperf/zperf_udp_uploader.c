@@ -20,6 +20,53 @@ static uint8_t sample_packet[sizeof(struct zperf_udp_datagram) +
 
 static struct zperf_async_upload_context udp_async_upload_ctx;
 
+#define UDP_SEND_BATCH CONFIG_NET_ZPERF_UDP_BATCH_SIZE
+#define UDP_HDR_LEN (sizeof(struct zperf_udp_datagram) + \
+		     sizeof(struct zperf_client_hdr_v1))
+
+/* Send a batch of packets that only differ in their sequence number. Each
+ * packet gets its own copy of the headers, the payload is shared.
+ *
+ * Return the number of packets sent, -1 with errno set if none was sent.
+ */
+static int udp_send_batch(int sock, unsigned int packet_size, uint32_t id)
+{
+	static uint8_t hdrs[UDP_SEND_BATCH][UDP_HDR_LEN];
+	static struct iovec iov[UDP_SEND_BATCH][2];
+	static struct zsock_mmsghdr msgs[UDP_SEND_BATCH];
+	size_t hdr_len = MIN(packet_size, UDP_HDR_LEN);
+	int sent = 0;
+	int ret;
+
+	for (int i = 0; i < UDP_SEND_BATCH; i++) {
+		struct zperf_udp_datagram *datagram =
+			(struct zperf_udp_datagram *)hdrs[i];
+
+		memcpy(hdrs[i], sample_packet, hdr_len);
+		datagram->id = htonl(id + i);
+
+		iov[i][0].iov_base = hdrs[i];
+		iov[i][0].iov_len = hdr_len;
+		iov[i][1].iov_base = &sample_packet[hdr_len];
+		iov[i][1].iov_len = packet_size - hdr_len;
+
+		memset(&msgs[i], 0, sizeof(msgs[i]));
+		msgs[i].msg_hdr.msg_iov = iov[i];
+		msgs[i].msg_hdr.msg_iovlen = ARRAY_SIZE(iov[i]);
+	}
+
+	while (sent < UDP_SEND_BATCH) {
+		ret = zsock_sendmmsg(sock, &msgs[sent], UDP_SEND_BATCH - sent, 0);
+		if (ret < 0) {
+			return sent > 0 ? sent : ret;
+		}
+
+		sent += ret;
+	}
+
+	return sent;
+}
+
 static inline void zperf_upload_decode_stat(const uint8_t *data,
 					    size_t datalen,
 					    struct zperf_results *results)
@@ -135,11 +182,13 @@ static int udp_upload(int sock, int port,
 		      unsigned int duration_in_ms,
 		      unsigned int packet_size,
 		      unsigned int rate_in_kbps,
+		      bool zerocopy,
 		      struct zperf_results *results)
 {
+	bool batch = UDP_SEND_BATCH > 1 && !zerocopy;
 	uint32_t packet_duration_us = zperf_packet_duration(packet_size, rate_in_kbps);
-	uint32_t packet_duration = k_us_to_ticks_ceil32(packet_duration_us);
-	uint32_t delay = packet_duration;
+	uint32_t packet_duration;
+	uint32_t delay;
 	uint32_t nb_packets = 0U;
 	int64_t start_time, end_time;
 	int64_t print_time, last_loop_time;
@@ -156,6 +205,14 @@ static int udp_upload(int sock, int port,
 		packet_size = sizeof(struct zperf_udp_datagram);
 	}
 
+	/* A whole batch goes out per loop iteration */
+	if (batch) {
+		packet_duration_us *= UDP_SEND_BATCH;
+	}
+
+	packet_duration = k_us_to_ticks_ceil32(packet_duration_us);
+	delay = packet_duration;
+
 	/* Start the loop */
 	start_time = k_uptime_ticks();
 	last_loop_time = start_time;
@@ -218,12 +275,22 @@ static int udp_upload(int sock, int port,
 		hdr->num_of_bytes = htonl(packet_size);
 
 		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
+		if (IS_ENABLED(CONFIG_NET_ZPERF_ZEROCOPY_UPLOAD) && zerocopy) {
+			ret = zperf_send_zerocopy(sock, sample_packet,
+						  packet_size,
+						  sizeof(*datagram) +
+						  sizeof(*hdr));
+		} else if (batch) {
+			ret = udp_send_batch(sock, packet_size, nb_packets);
+		} else {
+			ret = zsock_send(sock, sample_packet, packet_size, 0);
+		}
+
 		if (ret < 0) {
 			NET_ERR("Failed to send the packet (%d)", errno);
 			return -errno;
 		} else {
-			nb_packets++;
+			nb_packets += batch ? ret : 1;
 		}
 
 		if (IS_ENABLED(CONFIG_NET_ZPERF_LOG_LEVEL_DBG)) {
@@ -290,7 +357,7 @@ int zperf_udp_upload(const struct zperf_upload_params *param,
 	}
 
 	ret = udp_upload(sock, port, param->duration_ms, param->packet_size,
-			 param->rate_kbps, result);
+			 param->rate_kbps, param->options.zerocopy, result);
 
 	zsock_close(sock);
 
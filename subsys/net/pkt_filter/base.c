@@ -11,38 +11,65 @@ LOG_MODULE_REGISTER(npf_base, CONFIG_NET_PKT_FILTER_LOG_LEVEL);
 #include <zephyr/net/net_pkt_filter.h>
 #include <zephyr/spinlock.h>
 
+#include "npf_table.h"
+
+#ifdef CONFIG_NET_PKT_FILTER_DECISION_TABLE
+/*
+ * Every rule list has two decision tables, the one in use by the packet
+ * path and a spare one that the next rule list change is compiled into.
+ */
+#define NPF_RULE_TABLES(_name) \
+	static struct npf_rule_table _name##_tables[2]
+#define NPF_RULE_TABLES_INIT(_name) \
+	.table = &_name##_tables[0], \
+	.spare = &_name##_tables[1],
+#else
+#define NPF_RULE_TABLES(_name)
+#define NPF_RULE_TABLES_INIT(_name)
+#endif /* CONFIG_NET_PKT_FILTER_DECISION_TABLE */
+
 /*
  * Our actual rule lists for supported test points
  */
 
+NPF_RULE_TABLES(send_rules);
 struct npf_rule_list npf_send_rules = {
 	.rule_head = SYS_SLIST_STATIC_INIT(&send_rules.rule_head),
 	.lock = { },
+	NPF_RULE_TABLES_INIT(send_rules)
 };
 
+NPF_RULE_TABLES(recv_rules);
 struct npf_rule_list npf_recv_rules = {
 	.rule_head = SYS_SLIST_STATIC_INIT(&recv_rules.rule_head),
 	.lock = { },
+	NPF_RULE_TABLES_INIT(recv_rules)
 };
 
 #ifdef CONFIG_NET_PKT_FILTER_LOCAL_IN_HOOK
+NPF_RULE_TABLES(local_in_recv_rules);
 struct npf_rule_list npf_local_in_recv_rules = {
 	.rule_head = SYS_SLIST_STATIC_INIT(&local_in_recv_rules.rule_head),
 	.lock = { },
+	NPF_RULE_TABLES_INIT(local_in_recv_rules)
 };
 #endif /* CONFIG_NET_PKT_FILTER_LOCAL_IN_HOOK */
 
 #ifdef CONFIG_NET_PKT_FILTER_IPV4_HOOK
+NPF_RULE_TABLES(ipv4_recv_rules);
 struct npf_rule_list npf_ipv4_recv_rules = {
 	.rule_head = SYS_SLIST_STATIC_INIT(&ipv4_recv_rules.rule_head),
 	.lock = { },
+	NPF_RULE_TABLES_INIT(ipv4_recv_rules)
 };
 #endif /* CONFIG_NET_PKT_FILTER_IPV4_HOOK */
 
 #ifdef CONFIG_NET_PKT_FILTER_IPV6_HOOK
+NPF_RULE_TABLES(ipv6_recv_rules);
 struct npf_rule_list npf_ipv6_recv_rules = {
 	.rule_head = SYS_SLIST_STATIC_INIT(&ipv6_recv_rules.rule_head),
 	.lock = { },
+	NPF_RULE_TABLES_INIT(ipv6_recv_rules)
 };
 #endif /* CONFIG_NET_PKT_FILTER_IPV6_HOOK */
 
@@ -76,14 +103,20 @@ static struct npf_rule_list *get_ip_rules(uint8_t pf)
 /*
  * All tests must be true to return true.
  * If no tests then it is true.
+ * Tests flagged in the resolved bitmap are known to be true already.
  */
-static bool apply_tests(struct npf_rule *rule, struct net_pkt *pkt)
+static bool apply_tests(struct npf_rule *rule, uint32_t resolved,
+			struct net_pkt *pkt)
 {
 	struct npf_test *test;
 	unsigned int i;
 	bool result;
 
 	for (i = 0; i < rule->nb_tests; i++) {
+		if (i < 32 && (resolved & BIT(i))) {
+			continue;
+		}
+
 		test = rule->tests[i];
 		result = test->fn(test, pkt);
 		NET_DBG("test %p result %d", test, result);
@@ -110,7 +143,7 @@ static enum net_verdict evaluate(sys_slist_t *rule_head, struct net_pkt *pkt)
 	}
 
 	SYS_SLIST_FOR_EACH_CONTAINER(rule_head, rule, node) {
-		if (apply_tests(rule, pkt) == true) {
+		if (apply_tests(rule, 0, pkt) == true) {
 			return rule->result;
 		}
 	}
@@ -119,10 +152,287 @@ static enum net_verdict evaluate(sys_slist_t *rule_head, struct net_pkt *pkt)
 	return NET_DROP;
 }
 
+#ifdef CONFIG_NET_PKT_FILTER_DECISION_TABLE
+/*
+ * Decision tables
+ *
+ * Conditions comparing a packet field with exact values are grouped by
+ * key class. For each distinct value of a key, the table holds the set of
+ * rules whose conditions on that key are all true. A packet then only
+ * needs one lookup per key to narrow the rule list down to the candidate
+ * rules, and the remaining tests are run on those in rule list order.
+ */
+
+static int iface_values(struct npf_test *test, const uint8_t **values)
+{
+	struct npf_test_iface *test_iface =
+			CONTAINER_OF(test, struct npf_test_iface, test);
+
+	*values = (const uint8_t *)&test_iface->iface;
+	return 1;
+}
+
+static bool iface_get(struct net_pkt *pkt, uint8_t *key)
+{
+	struct net_if *iface = net_pkt_iface(pkt);
+
+	memcpy(key, &iface, sizeof(iface));
+	return true;
+}
+
+static const struct npf_key_class npf_iface_key = {
+	.match = npf_iface_match,
+	.unmatch = npf_iface_unmatch,
+	.values = iface_values,
+	.get = iface_get,
+	.len = sizeof(struct net_if *),
+};
+
+static const struct npf_key_class *const key_classes[NPF_KEY_CLASSES] = {
+	&npf_iface_key,
+#if defined(CONFIG_NET_L2_ETHERNET)
+	&npf_eth_type_key,
+	&npf_eth_dst_addr_key,
+	&npf_eth_src_addr_key,
+#endif
+};
+
+/* Writers are serialized so that the spare tables are theirs alone */
+static K_MUTEX_DEFINE(table_lock);
+
+static int test_values(struct npf_test *test,
+		       const struct npf_key_class *class,
+		       const uint8_t **values)
+{
+	if (test->fn != class->match && test->fn != class->unmatch) {
+		return -ENOENT;
+	}
+
+	return class->values(test, values);
+}
+
+static bool key_in(const uint8_t *values, int count, const uint8_t *key,
+		   uint8_t len)
+{
+	for (int i = 0; i < count; i++) {
+		if (memcmp(values + i * len, key, len) == 0) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* A NULL key stands for any value not tested by the rules */
+static bool rule_candidate(struct npf_rule *rule,
+			   const struct npf_key_class *class,
+			   const uint8_t *key)
+{
+	const uint8_t *values;
+	bool match;
+	int count;
+
+	for (int i = 0; i < MIN(rule->nb_tests, 32); i++) {
+		count = test_values(rule->tests[i], class, &values);
+		if (count < 0) {
+			continue;
+		}
+
+		match = key != NULL && key_in(values, count, key, class->len);
+		if (match != (rule->tests[i]->fn == class->match)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool table_add_key(struct npf_key_set *set, const uint8_t *key,
+			  uint8_t len)
+{
+	for (int i = 0; i < set->nb_keys; i++) {
+		if (memcmp(set->keys[i], key, len) == 0) {
+			return true;
+		}
+	}
+
+	if (set->nb_keys == NPF_TABLE_MAX_KEYS) {
+		return false;
+	}
+
+	memcpy(set->keys[set->nb_keys++], key, len);
+	return true;
+}
+
+static bool table_compile_set(struct npf_rule_table *table, int idx)
+{
+	const struct npf_key_class *class = key_classes[idx];
+	struct npf_key_set *set = &table->sets[idx];
+	const uint8_t *values;
+	int count;
+
+	/* Collect the distinct values tested by the rules */
+	for (int r = 0; r < table->nb_rules; r++) {
+		struct npf_rule *rule = table->rules[r];
+
+		for (int i = 0; i < MIN(rule->nb_tests, 32); i++) {
+			count = test_values(rule->tests[i], class, &values);
+			if (count < 0) {
+				continue;
+			}
+
+			for (int v = 0; v < count; v++) {
+				if (!table_add_key(set, values + v * class->len,
+						   class->len)) {
+					return false;
+				}
+			}
+
+			table->resolved[r] |= BIT(i);
+			set->used = true;
+		}
+	}
+
+	if (!set->used) {
+		return true;
+	}
+
+	for (int k = 0; k <= set->nb_keys; k++) {
+		const uint8_t *key = k < set->nb_keys ? set->keys[k] : NULL;
+
+		for (int r = 0; r < table->nb_rules; r++) {
+			if (rule_candidate(table->rules[r], class, key)) {
+				set->candidates[k] |= BIT(r);
+			}
+		}
+	}
+
+	return true;
+}
+
+static bool table_compile(struct npf_rule_table *table, sys_slist_t *rule_head)
+{
+	struct npf_rule *rule;
+
+	memset(table, 0, sizeof(*table));
+
+	SYS_SLIST_FOR_EACH_CONTAINER(rule_head, rule, node) {
+		if (table->nb_rules == NPF_TABLE_MAX_RULES) {
+			return false;
+		}
+
+		table->rules[table->nb_rules++] = rule;
+	}
+
+	for (int i = 0; i < NPF_KEY_CLASSES; i++) {
+		if (!table_compile_set(table, i)) {
+			return false;
+		}
+	}
+
+	table->valid = true;
+	return true;
+}
+
+/*
+ * Called with table_lock held after the rule list changed. The new table
+ * is built aside and swapped in, the packet path keeps using the old one
+ * meanwhile. If the rule list does not fit, an invalid table is swapped
+ * in and the rules are evaluated one by one.
+ */
+static void table_update(struct npf_rule_list *rules)
+{
+	struct npf_rule_table *table = rules->spare;
+	k_spinlock_key_t key;
+
+	if (!table_compile(table, &rules->rule_head)) {
+		NET_DBG("rule list %p does not fit in a decision table", rules);
+		table->valid = false;
+	}
+
+	key = k_spin_lock(&rules->lock);
+	rules->spare = rules->table;
+	rules->table = table;
+	k_spin_unlock(&rules->lock, key);
+}
+
+static enum net_verdict table_evaluate(struct npf_rule_table *table,
+				       struct net_pkt *pkt)
+{
+	uint8_t key[NPF_KEY_MAX_LEN];
+	uint32_t candidates;
+
+	if (table->nb_rules == 0) {
+		NET_DBG("no rules");
+		return NET_OK;
+	}
+
+	candidates = GENMASK(table->nb_rules - 1, 0);
+
+	for (int i = 0; i < NPF_KEY_CLASSES && candidates; i++) {
+		const struct npf_key_class *class = key_classes[i];
+		struct npf_key_set *set = &table->sets[i];
+		int k = set->nb_keys;
+
+		if (!set->used) {
+			continue;
+		}
+
+		if (class->get(pkt, key)) {
+			for (k = 0; k < set->nb_keys; k++) {
+				if (memcmp(set->keys[k], key, class->len) == 0) {
+					break;
+				}
+			}
+		}
+
+		candidates &= set->candidates[k];
+	}
+
+	while (candidates) {
+		int r = find_lsb_set(candidates) - 1;
+
+		candidates &= candidates - 1;
+
+		if (apply_tests(table->rules[r], table->resolved[r], pkt)) {
+			return table->rules[r]->result;
+		}
+	}
+
+	NET_DBG("no matching rules from table %p", table);
+	return NET_DROP;
+}
+
+static enum net_verdict list_evaluate(struct npf_rule_list *rules,
+				      struct net_pkt *pkt)
+{
+	if (rules->table->valid) {
+		return table_evaluate(rules->table, pkt);
+	}
+
+	return evaluate(&rules->rule_head, pkt);
+}
+
+static inline void table_write_lock(void)
+{
+	k_mutex_lock(&table_lock, K_FOREVER);
+}
+
+static inline void table_write_unlock(void)
+{
+	k_mutex_unlock(&table_lock);
+}
+#else
+#define list_evaluate(rules, pkt) evaluate(&(rules)->rule_head, pkt)
+#define table_update(rules)
+#define table_write_lock()
+#define table_write_unlock()
+#endif /* CONFIG_NET_PKT_FILTER_DECISION_TABLE */
+
 static enum net_verdict lock_evaluate(struct npf_rule_list *rules, struct net_pkt *pkt)
 {
 	k_spinlock_key_t key = k_spin_lock(&rules->lock);
-	enum net_verdict result = evaluate(&rules->rule_head, pkt);
+	enum net_verdict result = list_evaluate(rules, pkt);
 
 	k_spin_unlock(&rules->lock, key);
 	return result;
@@ -173,12 +483,17 @@ bool net_pkt_filter_ip_recv_ok(struct net_pkt *pkt)
 
 void npf_insert_rule(struct npf_rule_list *rules, struct npf_rule *rule)
 {
-	k_spinlock_key_t key = k_spin_lock(&rules->lock);
+	k_spinlock_key_t key;
+
+	table_write_lock();
+	key = k_spin_lock(&rules->lock);
 
 	NET_DBG("inserting rule %p into %p", rule, rules);
 	sys_slist_prepend(&rules->rule_head, &rule->node);
 
 	k_spin_unlock(&rules->lock, key);
+	table_update(rules);
+	table_write_unlock();
 }
 
 void npf_append_rule(struct npf_rule_list *rules, struct npf_rule *rule)
@@ -186,28 +501,47 @@ void npf_append_rule(struct npf_rule_list *rules, struct npf_rule *rule)
 	__ASSERT(sys_slist_peek_tail(&rules->rule_head) != &npf_default_ok.node, "");
 	__ASSERT(sys_slist_peek_tail(&rules->rule_head) != &npf_default_drop.node, "");
 
-	k_spinlock_key_t key = k_spin_lock(&rules->lock);
+	k_spinlock_key_t key;
+
+	table_write_lock();
+	key = k_spin_lock(&rules->lock);
 
 	NET_DBG("appending rule %p into %p", rule, rules);
 	sys_slist_append(&rules->rule_head, &rule->node);
 
 	k_spin_unlock(&rules->lock, key);
+	table_update(rules);
+	table_write_unlock();
 }
 
 bool npf_remove_rule(struct npf_rule_list *rules, struct npf_rule *rule)
 {
-	k_spinlock_key_t key = k_spin_lock(&rules->lock);
-	bool result = sys_slist_find_and_remove(&rules->rule_head, &rule->node);
+	k_spinlock_key_t key;
+	bool result;
+
+	table_write_lock();
+	key = k_spin_lock(&rules->lock);
+	result = sys_slist_find_and_remove(&rules->rule_head, &rule->node);
 
 	k_spin_unlock(&rules->lock, key);
 	NET_DBG("removing rule %p from %p: %d", rule, rules, result);
+
+	if (result) {
+		table_update(rules);
+	}
+
+	table_write_unlock();
 	return result;
 }
 
 bool npf_remove_all_rules(struct npf_rule_list *rules)
 {
-	k_spinlock_key_t key = k_spin_lock(&rules->lock);
-	bool result = !sys_slist_is_empty(&rules->rule_head);
+	k_spinlock_key_t key;
+	bool result;
+
+	table_write_lock();
+	key = k_spin_lock(&rules->lock);
+	result = !sys_slist_is_empty(&rules->rule_head);
 
 	if (result) {
 		sys_slist_init(&rules->rule_head);
@@ -215,9 +549,23 @@ bool npf_remove_all_rules(struct npf_rule_list *rules)
 	}
 
 	k_spin_unlock(&rules->lock, key);
+
+	if (result) {
+		table_update(rules);
+	}
+
+	table_write_unlock();
 	return result;
 }
 
+void npf_update_rules(struct npf_rule_list *rules)
+{
+	table_write_lock();
+	NET_DBG("updating rules of %p", rules);
+	table_update(rules);
+	table_write_unlock();
+}
+
 /*
  * Default rule list terminations.
  */
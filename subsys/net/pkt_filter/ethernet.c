@@ -10,6 +10,8 @@ LOG_MODULE_REGISTER(npf_ethernet, CONFIG_NET_PKT_FILTER_LOG_LEVEL);
 #include <zephyr/net/ethernet.h>
 #include <zephyr/net/net_pkt_filter.h>
 
+#include "npf_table.h"
+
 static bool addr_mask_compare(struct net_eth_addr *addr1,
 			      struct net_eth_addr *addr2,
 			      struct net_eth_addr *mask)
@@ -79,3 +81,90 @@ bool npf_eth_type_unmatch(struct npf_test *test, struct net_pkt *pkt)
 {
 	return !npf_eth_type_match(test, pkt);
 }
+
+#if defined(CONFIG_NET_PKT_FILTER_DECISION_TABLE)
+static int eth_type_values(struct npf_test *test, const uint8_t **values)
+{
+	struct npf_test_eth_type *test_eth_type =
+			CONTAINER_OF(test, struct npf_test_eth_type, test);
+
+	*values = (const uint8_t *)&test_eth_type->type;
+	return 1;
+}
+
+static bool eth_hdr_present(struct net_pkt *pkt)
+{
+	return pkt->buffer != NULL &&
+	       pkt->buffer->len >= sizeof(struct net_eth_hdr);
+}
+
+static bool eth_type_get(struct net_pkt *pkt, uint8_t *key)
+{
+	if (!eth_hdr_present(pkt)) {
+		return false;
+	}
+
+	memcpy(key, &NET_ETH_HDR(pkt)->type, sizeof(uint16_t));
+	return true;
+}
+
+const struct npf_key_class npf_eth_type_key = {
+	.match = npf_eth_type_match,
+	.unmatch = npf_eth_type_unmatch,
+	.values = eth_type_values,
+	.get = eth_type_get,
+	.len = sizeof(uint16_t),
+};
+
+static int eth_addr_values(struct npf_test *test, const uint8_t **values)
+{
+	struct npf_test_eth_addr *test_eth_addr =
+			CONTAINER_OF(test, struct npf_test_eth_addr, test);
+
+	/* Only addresses compared as a whole are exact values */
+	for (int i = 0; i < sizeof(struct net_eth_addr); i++) {
+		if (test_eth_addr->mask.addr[i] != 0xff) {
+			return -EINVAL;
+		}
+	}
+
+	*values = (const uint8_t *)test_eth_addr->addresses;
+	return test_eth_addr->nb_addresses;
+}
+
+static bool eth_src_addr_get(struct net_pkt *pkt, uint8_t *key)
+{
+	if (!eth_hdr_present(pkt)) {
+		return false;
+	}
+
+	memcpy(key, &NET_ETH_HDR(pkt)->src, sizeof(struct net_eth_addr));
+	return true;
+}
+
+static bool eth_dst_addr_get(struct net_pkt *pkt, uint8_t *key)
+{
+	if (!eth_hdr_present(pkt)) {
+		return false;
+	}
+
+	memcpy(key, &NET_ETH_HDR(pkt)->dst, sizeof(struct net_eth_addr));
+	return true;
+}
+
+const struct npf_key_class npf_eth_src_addr_key = {
+	.match = npf_eth_src_addr_match,
+	.unmatch = npf_eth_src_addr_unmatch,
+	.values = eth_addr_values,
+	.get = eth_src_addr_get,
+	.len = sizeof(struct net_eth_addr),
+};
+
+const struct npf_key_class npf_eth_dst_addr_key = {
+	.match = npf_eth_dst_addr_match,
+	.unmatch = npf_eth_dst_addr_unmatch,
+	.values = eth_addr_values,
+	.get = eth_dst_addr_get,
+	.len = sizeof(struct net_eth_addr),
+};
+#endif /* CONFIG_NET_PKT_FILTER_DECISION_TABLE */
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Packet filter decision tables, private to the packet filter code */
+
+#ifndef __NPF_TABLE_H
+#define __NPF_TABLE_H
+
+#include <zephyr/net/net_pkt_filter.h>
+
+/* Longest key, an interface pointer or an Ethernet address */
+#define NPF_KEY_MAX_LEN MAX(sizeof(struct net_if *), sizeof(struct net_eth_addr))
+
+/*
+ * A key class describes filter conditions that compare one packet field
+ * against a set of exact values. Such conditions are resolved by looking
+ * up the field once per packet instead of running every test.
+ */
+struct npf_key_class {
+	npf_test_fn_t *match;		/* test function matching a value */
+	npf_test_fn_t *unmatch;		/* test function excluding a value */
+	/* Return the number of values the test compares with and point
+	 * values to them, or a negative value if it cannot be keyed.
+	 */
+	int (*values)(struct npf_test *test, const uint8_t **values);
+	/* Extract the key from the packet, false if it has no such field */
+	bool (*get)(struct net_pkt *pkt, uint8_t *key);
+	uint8_t len;			/* key length in bytes */
+};
+
+#if defined(CONFIG_NET_L2_ETHERNET)
+extern const struct npf_key_class npf_eth_type_key;
+extern const struct npf_key_class npf_eth_src_addr_key;
+extern const struct npf_key_class npf_eth_dst_addr_key;
+#define NPF_ETH_KEY_CLASSES 3
+#else
+#define NPF_ETH_KEY_CLASSES 0
+#endif
+
+/* The interface key class is always there */
+#define NPF_KEY_CLASSES (1 + NPF_ETH_KEY_CLASSES)
+
+#if defined(CONFIG_NET_PKT_FILTER_DECISION_TABLE)
+#define NPF_TABLE_MAX_RULES CONFIG_NET_PKT_FILTER_DECISION_TABLE_MAX_RULES
+#define NPF_TABLE_MAX_KEYS CONFIG_NET_PKT_FILTER_DECISION_TABLE_MAX_KEYS
+
+struct npf_key_set {
+	bool used;
+	uint8_t nb_keys;
+	uint8_t keys[NPF_TABLE_MAX_KEYS][NPF_KEY_MAX_LEN];
+	/* Candidate rules for each key, the last entry is for any other
+	 * value of the key.
+	 */
+	uint32_t candidates[NPF_TABLE_MAX_KEYS + 1];
+};
+
+struct npf_rule_table {
+	bool valid;
+	uint8_t nb_rules;
+	struct npf_rule *rules[NPF_TABLE_MAX_RULES];
+	/* Tests of each rule already resolved by the key sets */
+	uint32_t resolved[NPF_TABLE_MAX_RULES];
+	struct npf_key_set sets[NPF_KEY_CLASSES];
+};
+#endif /* CONFIG_NET_PKT_FILTER_DECISION_TABLE */
+
+#endif /* __NPF_TABLE_H */
@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Sampling profiler
+ *
+ * A timer periodically samples the code it interrupted. Each sample holds
+ * the current thread and the addresses returned by
+ * arch_perf_current_stack_trace(), symbols are resolved on the host.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/shell/shell_string_conv.h>
+
+/* Program counter and link register */
+#define PERF_TRACE_DEPTH 2
+
+struct perf_sample {
+	struct k_thread *thread;
+	uintptr_t trace[PERF_TRACE_DEPTH];
+};
+
+struct perf_cpu_buf {
+	struct perf_sample samples[CONFIG_PROFILING_PERF_BUFFER_SIZE];
+	uint32_t count;
+	uint32_t lost;
+};
+
+static struct perf_cpu_buf perf_bufs[CONFIG_MP_MAX_NUM_CPUS];
+static atomic_t perf_running;
+
+static void perf_sample_fn(struct k_timer *timer)
+{
+	/* Runs in the timer ISR, every CPU only writes its own buffer */
+	struct perf_cpu_buf *buf = &perf_bufs[_current_cpu->id];
+	struct perf_sample *sample;
+	size_t depth;
+
+	ARG_UNUSED(timer);
+
+	if (buf->count >= ARRAY_SIZE(buf->samples)) {
+		buf->lost++;
+		return;
+	}
+
+	sample = &buf->samples[buf->count++];
+	sample->thread = _current;
+
+	depth = arch_perf_current_stack_trace(sample->trace,
+					      ARRAY_SIZE(sample->trace));
+	for (size_t i = depth; i < ARRAY_SIZE(sample->trace); i++) {
+		sample->trace[i] = 0;
+	}
+}
+
+static K_TIMER_DEFINE(perf_sample_timer, perf_sample_fn, NULL);
+
+static void perf_stop_fn(struct k_timer *timer)
+{
+	ARG_UNUSED(timer);
+
+	k_timer_stop(&perf_sample_timer);
+	atomic_clear(&perf_running);
+}
+
+static K_TIMER_DEFINE(perf_stop_timer, perf_stop_fn, NULL);
+
+static int cmd_perf_record(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t duration, frequency;
+	int err = 0;
+
+	ARG_UNUSED(argc);
+
+	duration = shell_strtoul(argv[1], 10, &err);
+	frequency = shell_strtoul(argv[2], 10, &err);
+
+	if (err) {
+		shell_error(sh, "Unable to parse input (err %d)", err);
+		return err;
+	}
+
+	if (frequency == 0U || frequency > CONFIG_SYS_CLOCK_TICKS_PER_SEC) {
+		shell_error(sh, "Frequency must be 1 to %d Hz",
+			    CONFIG_SYS_CLOCK_TICKS_PER_SEC);
+		return -EINVAL;
+	}
+
+	if (!atomic_cas(&perf_running, 0, 1)) {
+		shell_error(sh, "Recording already in progress");
+		return -EBUSY;
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(perf_bufs); i++) {
+		perf_bufs[i].count = 0;
+		perf_bufs[i].lost = 0;
+	}
+
+	k_timer_start(&perf_stop_timer, K_MSEC(duration), K_NO_WAIT);
+	k_timer_start(&perf_sample_timer, K_NO_WAIT,
+		      K_USEC(USEC_PER_SEC / frequency));
+
+	shell_print(sh, "Recording for %u ms at %u Hz", duration, frequency);
+
+	return 0;
+}
+
+static void thread_print_cb(const struct k_thread *thread, void *user_data)
+{
+	const struct shell *sh = user_data;
+	const char *name = k_thread_name_get((k_tid_t)thread);
+
+	shell_print(sh, "thread %p %s", thread,
+		    (name != NULL && name[0] != '\0') ? name : "-");
+}
+
+static int cmd_perf_printbuf(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	if (atomic_get(&perf_running)) {
+		shell_error(sh, "Recording in progress");
+		return -EBUSY;
+	}
+
+	/* Threads which exited since recording are not listed, the host
+	 * script then reports their samples by thread address.
+	 */
+	k_thread_foreach(thread_print_cb, (void *)sh);
+
+	for (int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		struct perf_cpu_buf *buf = &perf_bufs[cpu];
+
+		for (uint32_t i = 0; i < buf->count; i++) {
+			struct perf_sample *sample = &buf->samples[i];
+
+			shell_print(sh, "sample %d %p %lx %lx", cpu,
+				    sample->thread,
+				    (unsigned long)sample->trace[0],
+				    (unsigned long)sample->trace[1]);
+		}
+
+		shell_print(sh, "lost %d %u", cpu, buf->lost);
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_perf,
+	SHELL_CMD_ARG(record, NULL, "<duration ms> <frequency Hz>",
+		      cmd_perf_record, 3, 0),
+	SHELL_CMD_ARG(printbuf, NULL, "Print the samples of the last recording",
+		      cmd_perf_printbuf, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(perf, &sub_perf, "Sampling profiler", NULL);
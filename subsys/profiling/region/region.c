@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/profiling/region.h>
+
+#define HISTOGRAM_BUCKETS CONFIG_PROFILING_REGION_HISTOGRAM_BUCKETS
+
+void profiling_region_record(struct profiling_region *region, uint64_t cycles)
+{
+	uint32_t value = (uint32_t)MIN(cycles, UINT32_MAX);
+	unsigned int bucket = (value == 0U) ? 0U : 32U - __builtin_clz(value);
+	struct profiling_region_data *data;
+	unsigned int key;
+
+	bucket = MIN(bucket, HISTOGRAM_BUCKETS - 1);
+
+	/* Every CPU has its own data, so masking local interrupts is enough
+	 * to keep a nested region from updating it at the same time.
+	 */
+	key = arch_irq_lock();
+	data = &region->cpu[_current_cpu->id];
+
+	if (data->count == 0U || value < data->min) {
+		data->min = value;
+	}
+	if (value > data->max) {
+		data->max = value;
+	}
+	data->total += value;
+	data->count++;
+	data->histogram[bucket]++;
+
+	arch_irq_unlock(key);
+}
+
+static void data_add(struct profiling_region_data *sum,
+		     const struct profiling_region_data *data)
+{
+	if (data->count == 0U) {
+		return;
+	}
+
+	if (sum->count == 0U || data->min < sum->min) {
+		sum->min = data->min;
+	}
+	sum->max = MAX(sum->max, data->max);
+	sum->total += data->total;
+	sum->count += data->count;
+
+	for (int i = 0; i < HISTOGRAM_BUCKETS; i++) {
+		sum->histogram[i] += data->histogram[i];
+	}
+}
+
+void profiling_region_get(const struct profiling_region *region, int cpu,
+			  struct profiling_region_data *data)
+{
+	/* Data of other CPUs is read while they may be updating it, a sum
+	 * taken during measurements can be off by the latest ones.
+	 */
+	memset(data, 0, sizeof(*data));
+
+	if (cpu >= 0) {
+		data_add(data, &region->cpu[cpu]);
+		return;
+	}
+
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		data_add(data, &region->cpu[i]);
+	}
+}
+
+void profiling_region_reset(struct profiling_region *region)
+{
+	for (unsigned int i = 0; i < arch_num_cpus(); i++) {
+		memset(&region->cpu[i], 0, sizeof(region->cpu[i]));
+	}
+}
+
+#ifdef CONFIG_PROFILING_REGION_STATS
+STATS_NAME_START(profiling_region)
+STATS_NAME(profiling_region, count)
+STATS_NAME(profiling_region, min)
+STATS_NAME(profiling_region, max)
+STATS_NAME(profiling_region, avg)
+STATS_NAME_END(profiling_region);
+
+static void stats_refresh(struct k_work *work);
+
+static K_WORK_DELAYABLE_DEFINE(stats_work, stats_refresh);
+
+static void stats_refresh(struct k_work *work)
+{
+	struct profiling_region_data data;
+
+	STRUCT_SECTION_FOREACH(profiling_region, region) {
+		profiling_region_get(region, -1, &data);
+
+		STATS_SET(region->stats, count, data.count);
+		STATS_SET(region->stats, min, data.min);
+		STATS_SET(region->stats, max, data.max);
+		STATS_SET(region->stats, avg,
+			  data.count ? (uint32_t)(data.total / data.count) : 0);
+	}
+
+	k_work_reschedule(&stats_work, K_MSEC(CONFIG_PROFILING_REGION_STATS_INTERVAL));
+}
+
+static int profiling_region_stats_init(void)
+{
+	STRUCT_SECTION_FOREACH(profiling_region, region) {
+		(void)stats_init_and_reg(&region->stats.s_hdr, STATS_SIZE_32,
+					 (sizeof(region->stats) - sizeof(struct stats_hdr)) /
+					 STATS_SIZE_32,
+					 STATS_NAME_INIT_PARMS(profiling_region),
+					 region->name);
+	}
+
+	k_work_reschedule(&stats_work, K_MSEC(CONFIG_PROFILING_REGION_STATS_INTERVAL));
+
+	return 0;
+}
+
+SYS_INIT(profiling_region_stats_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif /* CONFIG_PROFILING_REGION_STATS */
@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Regions of probes placed in inline functions of headers, for APIs
+ * which have no common source file to define them in.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/profiling/region.h>
+
+#ifdef CONFIG_SPI
+PROFILING_PROBE_DEFINE(spi_transceive);
+#endif
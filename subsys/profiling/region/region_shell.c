@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/profiling/region.h>
+
+static struct profiling_region *region_find(const char *name)
+{
+	STRUCT_SECTION_FOREACH(profiling_region, region) {
+		if (strcmp(region->name, name) == 0) {
+			return region;
+		}
+	}
+
+	return NULL;
+}
+
+static uint32_t data_avg(const struct profiling_region_data *data)
+{
+	return data->count ? (uint32_t)(data->total / data->count) : 0U;
+}
+
+static int cmd_region_list(const struct shell *sh, size_t argc, char **argv)
+{
+	struct profiling_region_data data;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "%-24s %10s %10s %10s %10s %10s", "Region", "Count",
+		    "Min", "Max", "Avg", "Avg [ns]");
+
+	STRUCT_SECTION_FOREACH(profiling_region, region) {
+		profiling_region_get(region, -1, &data);
+
+		shell_print(sh, "%-24s %10u %10u %10u %10u %10u", region->name,
+			    data.count, data.min, data.max, data_avg(&data),
+			    (uint32_t)timing_cycles_to_ns(data_avg(&data)));
+	}
+
+	return 0;
+}
+
+static void data_print(const struct shell *sh,
+		       const struct profiling_region_data *data)
+{
+	shell_print(sh, "  count %u min %u max %u avg %u cycles", data->count,
+		    data->min, data->max, data_avg(data));
+
+	for (int i = 0; i < ARRAY_SIZE(data->histogram); i++) {
+		if (data->histogram[i] == 0U) {
+			continue;
+		}
+
+		if (i == 0) {
+			shell_print(sh, "  %10u: %u", 0, data->histogram[i]);
+		} else if (i == ARRAY_SIZE(data->histogram) - 1) {
+			shell_print(sh, "  %9u+: %u", 1U << (i - 1), data->histogram[i]);
+		} else {
+			shell_print(sh, "  %10u: %u", 1U << (i - 1), data->histogram[i]);
+		}
+	}
+}
+
+static int cmd_region_show(const struct shell *sh, size_t argc, char **argv)
+{
+	struct profiling_region *region = region_find(argv[1]);
+	struct profiling_region_data data;
+
+	ARG_UNUSED(argc);
+
+	if (region == NULL) {
+		shell_error(sh, "Region %s not found", argv[1]);
+		return -ENOENT;
+	}
+
+	for (int cpu = 0; cpu < arch_num_cpus(); cpu++) {
+		profiling_region_get(region, cpu, &data);
+		shell_print(sh, "CPU %d:", cpu);
+		data_print(sh, &data);
+	}
+
+	return 0;
+}
+
+static int cmd_region_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	struct profiling_region *region;
+
+	if (argc == 1) {
+		STRUCT_SECTION_FOREACH(profiling_region, r) {
+			profiling_region_reset(r);
+		}
+		return 0;
+	}
+
+	region = region_find(argv[1]);
+	if (region == NULL) {
+		shell_error(sh, "Region %s not found", argv[1]);
+		return -ENOENT;
+	}
+
+	profiling_region_reset(region);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_region,
+	SHELL_CMD_ARG(list, NULL, "List the statistics of all regions",
+		      cmd_region_list, 1, 0),
+	SHELL_CMD_ARG(show, NULL, "<name> Show the per-CPU histogram of a region",
+		      cmd_region_show, 2, 0),
+	SHELL_CMD_ARG(reset, NULL, "[name] Clear the statistics of a region or all",
+		      cmd_region_reset, 1, 1),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(region, &sub_region, "Region instrumentation", NULL);
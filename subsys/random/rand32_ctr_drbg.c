@@ -35,6 +35,15 @@ static const unsigned char drbg_seed[] = CONFIG_CS_CTR_DRBG_PERSONALIZATION;
 static bool ctr_initialised;
 static struct k_mutex ctr_lock;
 
+#if CONFIG_CS_CTR_DRBG_BATCH_SIZE > 0
+/*
+ * Output generated ahead of time for small requests. Bytes are erased as
+ * soon as they are handed out, so that they can't be recovered later on.
+ */
+static uint8_t ctr_batch[CONFIG_CS_CTR_DRBG_BATCH_SIZE];
+static size_t ctr_batch_pos = sizeof(ctr_batch);
+#endif
+
 #if defined(CONFIG_MBEDTLS)
 
 static mbedtls_ctr_drbg_context ctr_ctx;
@@ -102,21 +111,10 @@ static int ctr_drbg_initialize(void)
 	return 0;
 }
 
-
-int z_impl_sys_csrand_get(void *dst, uint32_t outlen)
+static int ctr_drbg_generate(void *dst, uint32_t outlen)
 {
 	int ret;
 
-	k_mutex_lock(&ctr_lock, K_FOREVER);
-
-	if (unlikely(!ctr_initialised)) {
-		ret = ctr_drbg_initialize();
-		if (ret != 0) {
-			ret = -EIO;
-			goto end;
-		}
-	}
-
 #if defined(CONFIG_MBEDTLS)
 
 	ret = mbedtls_ctr_drbg_random(&ctr_ctx, (unsigned char *)dst, outlen);
@@ -134,8 +132,7 @@ int z_impl_sys_csrand_get(void *dst, uint32_t outlen)
 		ret = entropy_get_entropy(entropy_dev,
 				    (void *)&entropy, sizeof(entropy));
 		if (ret != 0) {
-			ret = -EIO;
-			goto end;
+			return -EIO;
 		}
 
 		ret = tc_ctr_prng_reseed(&ctr_ctx,
@@ -152,6 +149,60 @@ int z_impl_sys_csrand_get(void *dst, uint32_t outlen)
 		ret = -EIO;
 	}
 #endif
+
+	return ret;
+}
+
+#if CONFIG_CS_CTR_DRBG_BATCH_SIZE > 0
+static int ctr_drbg_batch_get(uint8_t *dst, uint32_t outlen)
+{
+	size_t len;
+	int ret;
+
+	while (outlen > 0) {
+		if (ctr_batch_pos == sizeof(ctr_batch)) {
+			ret = ctr_drbg_generate(ctr_batch, sizeof(ctr_batch));
+			if (ret != 0) {
+				return ret;
+			}
+
+			ctr_batch_pos = 0;
+		}
+
+		len = MIN(outlen, sizeof(ctr_batch) - ctr_batch_pos);
+		memcpy(dst, &ctr_batch[ctr_batch_pos], len);
+		memset(&ctr_batch[ctr_batch_pos], 0, len);
+		ctr_batch_pos += len;
+		dst += len;
+		outlen -= len;
+	}
+
+	return 0;
+}
+#endif
+
+int z_impl_sys_csrand_get(void *dst, uint32_t outlen)
+{
+	int ret;
+
+	k_mutex_lock(&ctr_lock, K_FOREVER);
+
+	if (unlikely(!ctr_initialised)) {
+		ret = ctr_drbg_initialize();
+		if (ret != 0) {
+			ret = -EIO;
+			goto end;
+		}
+	}
+
+#if CONFIG_CS_CTR_DRBG_BATCH_SIZE > 0
+	if (outlen < sizeof(ctr_batch)) {
+		ret = ctr_drbg_batch_get(dst, outlen);
+		goto end;
+	}
+#endif
+
+	ret = ctr_drbg_generate(dst, outlen);
 end:
 	k_mutex_unlock(&ctr_lock);
 
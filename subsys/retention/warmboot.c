@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/devicetree.h>
+#include <zephyr/retention/retention.h>
+#include <zephyr/retention/warmboot.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(warmboot, CONFIG_RETENTION_LOG_LEVEL);
+
+/* The warm boot area holds the number of records, followed by the records,
+ * each being a header and the data of a state.
+ */
+struct warmboot_record {
+	uint16_t id;
+	uint16_t version;
+	uint16_t size;
+};
+
+static const struct device *warm_boot_dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_warm_boot));
+
+int warmboot_save(void)
+{
+	ssize_t area_size = retention_size(warm_boot_dev);
+	off_t offset = sizeof(uint16_t);
+	uint16_t count = 0;
+	int rc;
+
+	if (area_size < 0) {
+		return (int)area_size;
+	}
+
+	STRUCT_SECTION_FOREACH(warmboot_state, state) {
+		struct warmboot_record record = {
+			.id = state->id,
+			.version = state->version,
+			.size = state->size,
+		};
+
+		if (offset + sizeof(record) + state->size > area_size) {
+			LOG_ERR("State %u does not fit", state->id);
+			return -ENOSPC;
+		}
+
+		rc = retention_write(warm_boot_dev, offset, (const uint8_t *)&record,
+				     sizeof(record));
+		if (rc == 0) {
+			rc = retention_write(warm_boot_dev, offset + sizeof(record),
+					     state->data, state->size);
+		}
+
+		if (rc != 0) {
+			return rc;
+		}
+
+		offset += sizeof(record) + state->size;
+		count++;
+	}
+
+	/* Written last, so that a snapshot interrupted by a reset is not restored */
+	return retention_write(warm_boot_dev, 0, (const uint8_t *)&count, sizeof(count));
+}
+
+int warmboot_restore(const struct warmboot_state *state)
+{
+	struct warmboot_record record;
+	off_t offset = sizeof(uint16_t);
+	uint16_t count;
+	int rc;
+
+	rc = retention_is_valid(warm_boot_dev);
+	if (rc != 1) {
+		return rc;
+	}
+
+	rc = retention_read(warm_boot_dev, 0, (uint8_t *)&count, sizeof(count));
+	if (rc != 0) {
+		return rc;
+	}
+
+	for (uint16_t i = 0; i < count; i++) {
+		rc = retention_read(warm_boot_dev, offset, (uint8_t *)&record, sizeof(record));
+		if (rc != 0) {
+			return rc;
+		}
+
+		offset += sizeof(record);
+
+		if (record.id != state->id) {
+			offset += record.size;
+			continue;
+		}
+
+		if (record.version != state->version || record.size != state->size) {
+			LOG_INF("State %u changed, not restored", state->id);
+			return 0;
+		}
+
+		rc = retention_read(warm_boot_dev, offset, state->data, state->size);
+
+		return (rc == 0) ? 1 : rc;
+	}
+
+	return 0;
+}
+
+int warmboot_clear(void)
+{
+	return retention_clear(warm_boot_dev);
+}
@@ -10,23 +10,19 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(rtio_executor, CONFIG_RTIO_LOG_LEVEL);
 
+#ifdef CONFIG_RTIO_OP_DELAY
+#include <timeout_q.h>
+
 /**
- * @brief Submit to an iodev a submission to work on
- *
- * Should be called by the executor when it wishes to submit work
- * to an iodev.
- *
- * @param iodev_sqe Submission to work on
+ * @brief Complete a delay submission from the system clock interrupt
  */
-static inline void rtio_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+static void rtio_executor_delay_expired(struct _timeout *to)
 {
-	if (FIELD_GET(RTIO_SQE_CANCELED, iodev_sqe->sqe.flags)) {
-		/* Canceled */
-		rtio_iodev_sqe_err(iodev_sqe, -ECANCELED);
-		return;
-	}
-	iodev_sqe->sqe.iodev->api->submit(iodev_sqe);
+	struct rtio_iodev_sqe *iodev_sqe = CONTAINER_OF(to, struct rtio_iodev_sqe, delay_to);
+
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
 }
+#endif /* CONFIG_RTIO_OP_DELAY */
 
 /**
  * @brief Executor handled submissions
@@ -40,11 +36,45 @@ static void rtio_executor_op(struct rtio_iodev_sqe *iodev_sqe)
 		sqe->callback(iodev_sqe->r, sqe, sqe->arg0);
 		rtio_iodev_sqe_ok(iodev_sqe, 0);
 		break;
+#ifdef CONFIG_RTIO_OP_DELAY
+	case RTIO_OP_DELAY:
+		if (K_TIMEOUT_EQ(sqe->delay, K_NO_WAIT)) {
+			rtio_iodev_sqe_ok(iodev_sqe, 0);
+			break;
+		}
+		/* Completed by the kernel timeout queue, no thread involved */
+		z_add_timeout(&iodev_sqe->delay_to, rtio_executor_delay_expired, sqe->delay);
+		break;
+#endif /* CONFIG_RTIO_OP_DELAY */
 	default:
 		rtio_iodev_sqe_err(iodev_sqe, -EINVAL);
 	}
 }
 
+/**
+ * @brief Submit to an iodev a submission to work on
+ *
+ * Should be called by the executor when it wishes to submit work
+ * to an iodev. Submissions without an iodev are handled by the executor.
+ *
+ * @param iodev_sqe Submission to work on
+ */
+static inline void rtio_iodev_submit(struct rtio_iodev_sqe *iodev_sqe)
+{
+	if (FIELD_GET(RTIO_SQE_CANCELED, iodev_sqe->sqe.flags)) {
+		/* Canceled */
+		rtio_iodev_sqe_err(iodev_sqe, -ECANCELED);
+		return;
+	}
+
+	if (iodev_sqe->sqe.iodev == NULL) {
+		rtio_executor_op(iodev_sqe);
+		return;
+	}
+
+	iodev_sqe->sqe.iodev->api->submit(iodev_sqe);
+}
+
 /**
  * @brief Submit operations in the queue to iodevs
  *
@@ -60,40 +90,39 @@ void rtio_executor_submit(struct rtio *r)
 		struct rtio_iodev_sqe *iodev_sqe = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
 		uint16_t canceled_mask = iodev_sqe->sqe.flags & RTIO_SQE_CANCELED;
 
-		iodev_sqe->r = r;
+		struct rtio_iodev_sqe *curr = iodev_sqe, *next;
 
-		if (iodev_sqe->sqe.iodev == NULL) {
-			rtio_executor_op(iodev_sqe);
-		} else {
-			struct rtio_iodev_sqe *curr = iodev_sqe, *next;
+		iodev_sqe->r = r;
 
-			/* Link up transaction or queue list if needed */
-			while (curr->sqe.flags & (RTIO_SQE_TRANSACTION | RTIO_SQE_CHAINED)) {
+		/*
+		 * Link up transaction or queue list if needed, executor handled
+		 * submissions such as delays may be chained with iodev ones.
+		 */
+		while (curr->sqe.flags & (RTIO_SQE_TRANSACTION | RTIO_SQE_CHAINED)) {
 #ifdef CONFIG_ASSERT
-				bool transaction = iodev_sqe->sqe.flags & RTIO_SQE_TRANSACTION;
-				bool chained = iodev_sqe->sqe.flags & RTIO_SQE_CHAINED;
+			bool transaction = iodev_sqe->sqe.flags & RTIO_SQE_TRANSACTION;
+			bool chained = iodev_sqe->sqe.flags & RTIO_SQE_CHAINED;
 
-				__ASSERT(transaction != chained,
-					 "Expected chained or transaction flag, not both");
+			__ASSERT(transaction != chained,
+				 "Expected chained or transaction flag, not both");
 #endif
-				node = rtio_mpsc_pop(&iodev_sqe->r->sq);
-				next = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
-				next->sqe.flags |= canceled_mask;
-				curr->next = next;
-				curr = next;
-				curr->r = r;
-
-				__ASSERT(
-					curr != NULL,
-					"Expected a valid sqe following transaction or chain flag");
-			}
-
-			curr->next = NULL;
+			node = rtio_mpsc_pop(&iodev_sqe->r->sq);
+			next = CONTAINER_OF(node, struct rtio_iodev_sqe, q);
+			next->sqe.flags |= canceled_mask;
+			curr->next = next;
+			curr = next;
 			curr->r = r;
 
-			rtio_iodev_submit(iodev_sqe);
+			__ASSERT(
+				curr != NULL,
+				"Expected a valid sqe following transaction or chain flag");
 		}
 
+		curr->next = NULL;
+		curr->r = r;
+
+		rtio_iodev_submit(iodev_sqe);
+
 		node = rtio_mpsc_pop(&r->sq);
 	}
 }
@@ -38,6 +38,8 @@ static inline bool rtio_vrfy_sqe(struct rtio_sqe *sqe)
 		break;
 	case RTIO_OP_TINY_TX:
 		break;
+	case RTIO_OP_DELAY:
+		break;
 	case RTIO_OP_TXRX:
 		valid_sqe &= K_SYSCALL_MEMORY(sqe->tx_buf, sqe->txrx_buf_len, true);
 		valid_sqe &= K_SYSCALL_MEMORY(sqe->rx_buf, sqe->txrx_buf_len, true);
@@ -560,10 +560,12 @@ int card_read_blocks(struct sd_card *card, uint8_t *rbuf, uint32_t start_block,
 			k_mutex_unlock(&card->lock);
 			return -ENOBUFS;
 		}
-		rlen = sizeof(card->card_buffer) / card->block_size;
 		sector = 0;
 		buf_offset = rbuf;
 		while (sector < num_blocks) {
+			/* Transfer as many blocks as fit in the card buffer */
+			rlen = MIN(sizeof(card->card_buffer) / card->block_size,
+				   num_blocks - sector);
 			/* Read from disk to card buffer */
 			ret = card_read(card, card->card_buffer, sector + start_block, rlen);
 			if (ret) {
@@ -633,6 +635,35 @@ static int card_query_written(struct sd_card *card, uint32_t *num_written)
 	return 0;
 }
 
+/*
+ * Sends ACMD23 (set write block erase count) to let the card pre-erase the
+ * blocks of the following multiple block write
+ */
+static int card_set_pre_erase(struct sd_card *card, uint32_t num_blocks)
+{
+	int ret;
+	struct sdhc_command cmd = {0};
+
+	ret = card_app_command(card, card->relative_addr);
+	if (ret) {
+		LOG_DBG("App CMD for ACMD23 failed");
+		return ret;
+	}
+
+	cmd.opcode = SD_APP_SET_WRITE_BLK_ERASE_CNT;
+	cmd.arg = num_blocks & 0x7FFFFFU;
+	cmd.response_type = (SD_RSP_TYPE_R1 | SD_SPI_RSP_TYPE_R1);
+	cmd.timeout_ms = CONFIG_SD_CMD_TIMEOUT;
+
+	ret = sdhc_request(card->sdhc, &cmd, NULL);
+	if (ret) {
+		LOG_DBG("ACMD23 failed: %d", ret);
+		return ret;
+	}
+
+	return sd_check_response(&cmd);
+}
+
 static int card_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_block,
 		      uint32_t num_blocks)
 {
@@ -641,6 +672,18 @@ static int card_write(struct sd_card *card, const uint8_t *wbuf, uint32_t start_
 	struct sdhc_command cmd = {0};
 	struct sdhc_data data = {0};
 
+	/*
+	 * The pre-erase is only a hint, so the write goes on if the card
+	 * rejects it.
+	 */
+	if (IS_ENABLED(CONFIG_SD_WRITE_PRE_ERASE) && (card->type == CARD_SDMMC) &&
+	    (num_blocks > 1)) {
+		ret = card_set_pre_erase(card, num_blocks);
+		if (ret) {
+			LOG_DBG("Pre-erase of %u blocks failed: %d", num_blocks, ret);
+		}
+	}
+
 	/*
 	 * See the note in card_read() above. We will not issue CMD23
 	 * or CMD12, and expect the host to handle those details.
@@ -723,10 +766,12 @@ int card_write_blocks(struct sd_card *card, const uint8_t *wbuf, uint32_t start_
 			k_mutex_unlock(&card->lock);
 			return -ENOBUFS;
 		}
-		wlen = sizeof(card->card_buffer) / card->block_size;
 		sector = 0;
 		buf_offset = wbuf;
 		while (sector < num_blocks) {
+			/* Transfer as many blocks as fit in the card buffer */
+			wlen = MIN(sizeof(card->card_buffer) / card->block_size,
+				   num_blocks - sector);
 			/* Copy data into card buffer */
 			memcpy(card->card_buffer, buf_offset, wlen * card->block_size);
 			/* Write card buffer to disk */
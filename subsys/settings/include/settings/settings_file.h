@@ -9,6 +9,7 @@
 #define __SETTINGS_FILE_H_
 
 #include <zephyr/toolchain.h>
+#include <zephyr/fs/fs.h>
 #include <zephyr/settings/settings.h>
 
 #ifdef __cplusplus
@@ -22,6 +23,9 @@ struct settings_file {
 	const char *cf_name;	/* filename */
 	int cf_maxlines;	/* max # of lines before compressing */
 	int cf_lines;		/* private */
+	struct fs_file_t cf_batch_file;	/* private, kept open during a batch */
+	bool cf_batch_open;	/* private */
+	bool cf_batch;		/* private */
 };
 
 /* register file to be source of settings */
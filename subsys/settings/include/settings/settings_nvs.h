@@ -37,6 +37,11 @@ struct settings_nvs {
 	struct settings_store cf_store;
 	struct nvs_fs cf_nvs;
 	uint16_t last_name_id;
+	/* a batch of saves is in progress, the write of last_name_id is
+	 * deferred to its end.
+	 */
+	bool batch;
+	bool last_name_id_dirty;
 	const struct device *flash_dev;
 #if CONFIG_SETTINGS_NVS_NAME_CACHE
 	struct {
@@ -46,6 +51,10 @@ struct settings_nvs {
 
 	uint16_t cache_next;
 #endif
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	/* hash of the first name component of each name ID */
+	uint16_t name_index[CONFIG_SETTINGS_NVS_NAME_INDEX_SIZE];
+#endif
 };
 
 /* register nvs to be a source of settings */
@@ -31,13 +31,17 @@ int settings_backend_init(void);
 
 static int settings_file_load(struct settings_store *cs,
 			      const struct settings_load_arg *arg);
+static int settings_file_save_start(struct settings_store *cs);
 static int settings_file_save(struct settings_store *cs, const char *name,
 			      const char *value, size_t val_len);
+static int settings_file_save_end(struct settings_store *cs);
 static void *settings_file_storage_get(struct settings_store *cs);
 
 static const struct settings_store_itf settings_file_itf = {
 	.csi_load = settings_file_load,
+	.csi_save_start = settings_file_save_start,
 	.csi_save = settings_file_save,
+	.csi_save_end = settings_file_save_end,
 	.csi_storage_get = settings_file_storage_get
 };
 
@@ -116,33 +120,21 @@ static int read_entry_len(const struct line_entry_ctx *entry_ctx, off_t off)
 	return entry_ctx->len - off;
 }
 
-static int settings_file_load_priv(struct settings_store *cs, line_load_cb cb,
-				   void *cb_arg, bool filter_duplicates)
+static void settings_file_load_lines(struct settings_file *cf,
+				     struct fs_file_t *file, line_load_cb cb,
+				     void *cb_arg, bool filter_duplicates)
 {
-	struct settings_file *cf = CONTAINER_OF(cs, struct settings_file, cf_store);
-	struct fs_file_t file;
 	int lines;
 	int rc;
 
 	struct line_entry_ctx entry_ctx = {
-		.stor_ctx = (void *)&file,
+		.stor_ctx = (void *)file,
 		.seek = 0,
 		.len = 0 /* unknown length */
 	};
 
 	lines = 0;
 
-	fs_file_t_init(&file);
-
-	rc = fs_open(&file, cf->cf_name, FS_O_READ);
-	if (rc != 0) {
-		if (rc == -ENOENT) {
-			return -ENOENT;
-		}
-
-		return -EINVAL;
-	}
-
 	while (1) {
 		char name[SETTINGS_MAX_NAME_LEN + SETTINGS_EXTRA_LEN + 1];
 		size_t name_len;
@@ -174,10 +166,30 @@ static int settings_file_load_priv(struct settings_store *cs, line_load_cb cb,
 		lines++;
 	}
 
-	rc = fs_close(&file);
 	cf->cf_lines = lines;
+}
 
-	return rc;
+static int settings_file_load_priv(struct settings_store *cs, line_load_cb cb,
+				   void *cb_arg, bool filter_duplicates)
+{
+	struct settings_file *cf = CONTAINER_OF(cs, struct settings_file, cf_store);
+	struct fs_file_t file;
+	int rc;
+
+	fs_file_t_init(&file);
+
+	rc = fs_open(&file, cf->cf_name, FS_O_READ);
+	if (rc != 0) {
+		if (rc == -ENOENT) {
+			return -ENOENT;
+		}
+
+		return -EINVAL;
+	}
+
+	settings_file_load_lines(cf, &file, cb, cb_arg, filter_duplicates);
+
+	return fs_close(&file);
 }
 
 /*
@@ -373,11 +385,82 @@ end_rolback:
 
 }
 
+/*
+ * Open the file for the saves of a batch, it is kept open until the batch
+ * ends so that their lines get written to flash together.
+ */
+static int settings_file_batch_open(struct settings_file *cf)
+{
+	int rc;
+
+	if (cf->cf_batch_open) {
+		return 0;
+	}
+
+	fs_file_t_init(&cf->cf_batch_file);
+
+	rc = fs_open(&cf->cf_batch_file, cf->cf_name, FS_O_CREATE | FS_O_RDWR);
+	if (rc == 0) {
+		cf->cf_batch_open = true;
+	}
+
+	return rc;
+}
+
+static int settings_file_batch_close(struct settings_file *cf)
+{
+	if (!cf->cf_batch_open) {
+		return 0;
+	}
+
+	cf->cf_batch_open = false;
+
+	return fs_close(&cf->cf_batch_file);
+}
+
+static int settings_file_save_start(struct settings_store *cs)
+{
+	struct settings_file *cf = CONTAINER_OF(cs, struct settings_file, cf_store);
+
+	cf->cf_batch = true;
+
+	return 0;
+}
+
+static int settings_file_save_end(struct settings_store *cs)
+{
+	struct settings_file *cf = CONTAINER_OF(cs, struct settings_file, cf_store);
+
+	cf->cf_batch = false;
+
+	return settings_file_batch_close(cf);
+}
+
+/* Append a value to the open file */
+static int settings_file_append(struct settings_file *cf, struct fs_file_t *file,
+				const char *name, const char *value,
+				size_t val_len)
+{
+	struct line_entry_ctx entry_ctx;
+	int rc;
+
+	rc = fs_seek(file, 0, FS_SEEK_END);
+	if (rc == 0) {
+		entry_ctx.stor_ctx = file;
+		rc = settings_line_write(name, value, val_len, 0,
+					  (void *)&entry_ctx);
+		if (rc == 0) {
+			cf->cf_lines++;
+		}
+	}
+
+	return rc;
+}
+
 static int settings_file_save_priv(struct settings_store *cs, const char *name,
 				   const char *value, size_t val_len)
 {
 	struct settings_file *cf = CONTAINER_OF(cs, struct settings_file, cf_store);
-	struct line_entry_ctx entry_ctx;
 	struct fs_file_t file;
 	int rc2;
 	int rc;
@@ -393,24 +476,31 @@ static int settings_file_save_priv(struct settings_store *cs, const char *name,
 		 * Compress before config file size exceeds
 		 * the max number of lines.
 		 */
+		rc = settings_file_batch_close(cf);
+		if (rc) {
+			return rc;
+		}
+
 		return settings_file_save_and_compress(cf, name, value,
 						       val_len);
 	}
 
+	if (cf->cf_batch) {
+		rc = settings_file_batch_open(cf);
+		if (rc == 0) {
+			rc = settings_file_append(cf, &cf->cf_batch_file, name,
+						  value, val_len);
+		}
+
+		return rc;
+	}
+
 	/*
 	 * Open the file to add this one value.
 	 */
 	rc = fs_open(&file, cf->cf_name, FS_O_CREATE | FS_O_RDWR);
 	if (rc == 0) {
-		rc = fs_seek(&file, 0, FS_SEEK_END);
-		if (rc == 0) {
-			entry_ctx.stor_ctx = &file;
-			rc = settings_line_write(name, value, val_len, 0,
-						  (void *)&entry_ctx);
-			if (rc == 0) {
-				cf->cf_lines++;
-			}
-		}
+		rc = settings_file_append(cf, &file, name, value, val_len);
 
 		rc2 = fs_close(&file);
 		if (rc == 0) {
@@ -428,6 +518,7 @@ static int settings_file_save_priv(struct settings_store *cs, const char *name,
 static int settings_file_save(struct settings_store *cs, const char *name,
 			      const char *value, size_t val_len)
 {
+	struct settings_file *cf = CONTAINER_OF(cs, struct settings_file, cf_store);
 	struct settings_line_dup_check_arg cdca;
 
 	if (val_len > 0 && value == NULL) {
@@ -441,7 +532,14 @@ static int settings_file_save(struct settings_store *cs, const char *name,
 	cdca.val = (char *)value;
 	cdca.is_dup = 0;
 	cdca.val_len = val_len;
-	settings_file_load_priv(cs, settings_line_dup_check_cb, &cdca, false);
+	if (cf->cf_batch && (settings_file_batch_open(cf) == 0)) {
+		settings_file_load_lines(cf, &cf->cf_batch_file,
+					 settings_line_dup_check_cb, &cdca,
+					 false);
+	} else {
+		settings_file_load_priv(cs, settings_line_dup_check_cb, &cdca,
+					false);
+	}
 	if (cdca.is_dup == 1) {
 		return 0;
 	}
@@ -32,11 +32,15 @@ static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg);
 static int settings_nvs_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len);
+static int settings_nvs_save_start(struct settings_store *cs);
+static int settings_nvs_save_end(struct settings_store *cs);
 static void *settings_nvs_storage_get(struct settings_store *cs);
 
 static struct settings_store_itf settings_nvs_itf = {
 	.csi_load = settings_nvs_load,
+	.csi_save_start = settings_nvs_save_start,
 	.csi_save = settings_nvs_save,
+	.csi_save_end = settings_nvs_save_end,
 	.csi_storage_get = settings_nvs_storage_get
 };
 
@@ -118,6 +122,62 @@ static uint16_t settings_nvs_cache_match(struct settings_nvs *cf, const char *na
 }
 #endif /* CONFIG_SETTINGS_NVS_NAME_CACHE */
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+/* name index values that are not a hash */
+#define SETTINGS_NVS_INDEX_UNKNOWN 0xFFFF
+#define SETTINGS_NVS_INDEX_EMPTY 0xFFFE
+
+static uint16_t settings_nvs_index_hash(const char *name)
+{
+	const char *sep = strchr(name, SETTINGS_NAME_SEPARATOR);
+	size_t len = sep ? (size_t)(sep - name) : strlen(name);
+
+	return crc16_ccitt(0xffff, name, len) % SETTINGS_NVS_INDEX_EMPTY;
+}
+
+static uint16_t *settings_nvs_index_entry(struct settings_nvs *cf,
+					  uint16_t name_id)
+{
+	uint16_t pos = name_id - (NVS_NAMECNT_ID + 1);
+
+	if (pos >= CONFIG_SETTINGS_NVS_NAME_INDEX_SIZE) {
+		return NULL;
+	}
+
+	return &cf->name_index[pos];
+}
+
+static void settings_nvs_index_set(struct settings_nvs *cf, uint16_t name_id,
+				   uint16_t hash)
+{
+	uint16_t *entry = settings_nvs_index_entry(cf, name_id);
+
+	if (entry) {
+		*entry = hash;
+	}
+}
+
+/* Check if a load of the subtree with hash subtree_hash, or of everything if
+ * it is SETTINGS_NVS_INDEX_UNKNOWN, does not need to read name_id.
+ */
+static bool settings_nvs_index_skip(struct settings_nvs *cf, uint16_t name_id,
+				    uint16_t subtree_hash)
+{
+	uint16_t *entry = settings_nvs_index_entry(cf, name_id);
+
+	if (!entry || (*entry == SETTINGS_NVS_INDEX_UNKNOWN)) {
+		return false;
+	}
+
+	if (*entry == SETTINGS_NVS_INDEX_EMPTY) {
+		return true;
+	}
+
+	return (subtree_hash != SETTINGS_NVS_INDEX_UNKNOWN) &&
+	       (*entry != subtree_hash);
+}
+#endif /* CONFIG_SETTINGS_NVS_NAME_INDEX */
+
 static int settings_nvs_load(struct settings_store *cs,
 			     const struct settings_load_arg *arg)
 {
@@ -128,6 +188,13 @@ static int settings_nvs_load(struct settings_store *cs,
 	char buf;
 	ssize_t rc1, rc2;
 	uint16_t name_id = NVS_NAMECNT_ID;
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	uint16_t subtree_hash = SETTINGS_NVS_INDEX_UNKNOWN;
+
+	if (arg && arg->subtree && arg->subtree[0]) {
+		subtree_hash = settings_nvs_index_hash(arg->subtree);
+	}
+#endif
 
 	name_id = cf->last_name_id + 1;
 
@@ -138,6 +205,12 @@ static int settings_nvs_load(struct settings_store *cs,
 			break;
 		}
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+		if (settings_nvs_index_skip(cf, name_id, subtree_hash)) {
+			continue;
+		}
+#endif
+
 		/* In the NVS backend, each setting item is stored in two NVS
 		 * entries one for the setting's name and one with the
 		 * setting's value.
@@ -147,6 +220,10 @@ static int settings_nvs_load(struct settings_store *cs,
 			       &buf, sizeof(buf));
 
 		if ((rc1 <= 0) && (rc2 <= 0)) {
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+			settings_nvs_index_set(cf, name_id,
+					       SETTINGS_NVS_INDEX_EMPTY);
+#endif
 			continue;
 		}
 
@@ -163,11 +240,18 @@ static int settings_nvs_load(struct settings_store *cs,
 			}
 			nvs_delete(&cf->cf_nvs, name_id);
 			nvs_delete(&cf->cf_nvs, name_id + NVS_NAME_ID_OFFSET);
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+			settings_nvs_index_set(cf, name_id,
+					       SETTINGS_NVS_INDEX_UNKNOWN);
+#endif
 			continue;
 		}
 
 		/* Found a name, this might not include a trailing \0 */
 		name[rc1] = '\0';
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+		settings_nvs_index_set(cf, name_id, settings_nvs_index_hash(name));
+#endif
 		read_fn_arg.fs = &cf->cf_nvs;
 		read_fn_arg.id = name_id + NVS_NAME_ID_OFFSET;
 
@@ -186,6 +270,48 @@ static int settings_nvs_load(struct settings_store *cs,
 	return ret;
 }
 
+/* Store the largest name ID in use, or defer it to the end of a batch */
+static int settings_nvs_last_name_id_write(struct settings_nvs *cf)
+{
+	if (cf->batch) {
+		cf->last_name_id_dirty = true;
+		return 0;
+	}
+
+	return nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID, &cf->last_name_id,
+			 sizeof(uint16_t));
+}
+
+static int settings_nvs_save_start(struct settings_store *cs)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+
+	cf->batch = true;
+	cf->last_name_id_dirty = false;
+
+	return 0;
+}
+
+static int settings_nvs_save_end(struct settings_store *cs)
+{
+	struct settings_nvs *cf = CONTAINER_OF(cs, struct settings_nvs, cf_store);
+	int rc;
+
+	cf->batch = false;
+
+	if (!cf->last_name_id_dirty) {
+		return 0;
+	}
+
+	cf->last_name_id_dirty = false;
+	rc = settings_nvs_last_name_id_write(cf);
+	if (rc < 0) {
+		return rc;
+	}
+
+	return 0;
+}
+
 static int settings_nvs_save(struct settings_store *cs, const char *name,
 			     const char *value, size_t val_len)
 {
@@ -256,8 +382,7 @@ found:
 
 		if (name_id == cf->last_name_id) {
 			cf->last_name_id--;
-			rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID,
-				       &cf->last_name_id, sizeof(uint16_t));
+			rc = settings_nvs_last_name_id_write(cf);
 			if (rc < 0) {
 				/* Error: can't to store
 				 * the largest name ID in use.
@@ -273,6 +398,12 @@ found:
 					NVS_NAME_ID_OFFSET);
 		}
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+		settings_nvs_index_set(cf, name_id,
+				       (rc < 0) ? SETTINGS_NVS_INDEX_UNKNOWN :
+						  SETTINGS_NVS_INDEX_EMPTY);
+#endif
+
 		if (rc < 0) {
 			return rc;
 		}
@@ -285,6 +416,13 @@ found:
 		return -ENOMEM;
 	}
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	/* the entry is indexed before it is written so that a failed write
+	 * cannot leave it skipped.
+	 */
+	settings_nvs_index_set(cf, write_name_id, settings_nvs_index_hash(name));
+#endif
+
 	/* write the value */
 	rc = nvs_write(&cf->cf_nvs, write_name_id + NVS_NAME_ID_OFFSET,
 		       value, val_len);
@@ -303,8 +441,7 @@ found:
 	/* update the last_name_id and write to flash if required*/
 	if (write_name_id > cf->last_name_id) {
 		cf->last_name_id = write_name_id;
-		rc = nvs_write(&cf->cf_nvs, NVS_NAMECNT_ID, &cf->last_name_id,
-			       sizeof(uint16_t));
+		rc = settings_nvs_last_name_id_write(cf);
 	}
 
 	if (rc < 0) {
@@ -330,6 +467,10 @@ int settings_nvs_backend_init(struct settings_nvs *cf)
 		return rc;
 	}
 
+#if CONFIG_SETTINGS_NVS_NAME_INDEX
+	memset(cf->name_index, 0xff, sizeof(cf->name_index));
+#endif
+
 	rc = nvs_read(&cf->cf_nvs, NVS_NAMECNT_ID, &last_name_id,
 		      sizeof(last_name_id));
 	if (rc < 0) {
@@ -24,6 +24,22 @@ sys_slist_t settings_load_srcs;
 struct settings_store *settings_save_dst;
 extern struct k_mutex settings_lock;
 
+#if defined(CONFIG_SETTINGS_TRANSACTION)
+/* Header of a record buffered by a transaction, it is followed by the name,
+ * '\0' terminated, and the value.
+ */
+struct settings_txn_rec {
+	uint16_t name_len;
+	uint16_t val_len;
+};
+
+static struct {
+	bool open;
+	size_t used;
+	uint8_t buf[CONFIG_SETTINGS_TRANSACTION_BUF_SIZE];
+} settings_txn;
+#endif /* CONFIG_SETTINGS_TRANSACTION */
+
 void settings_src_register(struct settings_store *cs)
 {
 	sys_slist_append(&settings_load_srcs, &cs->cs_next);
@@ -88,6 +104,157 @@ int settings_load_subtree_direct(
 	return 0;
 }
 
+#if defined(CONFIG_SETTINGS_TRANSACTION)
+/*
+ * Buffer a value until the transaction is committed, replacing the value
+ * previously buffered with the same name.
+ */
+static int settings_txn_save(const char *name, const void *value,
+			     size_t val_len)
+{
+	struct settings_txn_rec rec;
+	size_t name_len, rec_size, off;
+	size_t free_size;
+
+	if (!name) {
+		return -EINVAL;
+	}
+
+	name_len = strlen(name) + 1;
+	if ((name_len > UINT16_MAX) || (val_len > UINT16_MAX)) {
+		return -EINVAL;
+	}
+
+	for (off = 0; off < settings_txn.used; off += rec_size) {
+		memcpy(&rec, &settings_txn.buf[off], sizeof(rec));
+		rec_size = sizeof(rec) + rec.name_len + rec.val_len;
+
+		if (!strcmp(name, (char *)&settings_txn.buf[off + sizeof(rec)])) {
+			break;
+		}
+	}
+
+	free_size = sizeof(settings_txn.buf) - settings_txn.used;
+	if (off < settings_txn.used) {
+		free_size += rec_size;
+	}
+
+	if (sizeof(rec) + name_len + val_len > free_size) {
+		return -ENOMEM;
+	}
+
+	if (off < settings_txn.used) {
+		memmove(&settings_txn.buf[off], &settings_txn.buf[off + rec_size],
+			settings_txn.used - off - rec_size);
+		settings_txn.used -= rec_size;
+	}
+
+	rec.name_len = name_len;
+	rec.val_len = val_len;
+	memcpy(&settings_txn.buf[settings_txn.used], &rec, sizeof(rec));
+	settings_txn.used += sizeof(rec);
+	memcpy(&settings_txn.buf[settings_txn.used], name, name_len);
+	settings_txn.used += name_len;
+	if (val_len) {
+		memcpy(&settings_txn.buf[settings_txn.used], value, val_len);
+		settings_txn.used += val_len;
+	}
+
+	return 0;
+}
+
+int settings_transaction_begin(void)
+{
+	if (!settings_save_dst) {
+		return -ENOENT;
+	}
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (settings_txn.open) {
+		k_mutex_unlock(&settings_lock);
+		return -EBUSY;
+	}
+
+	/* settings_lock is kept until the transaction ends */
+	settings_txn.open = true;
+	settings_txn.used = 0;
+
+	return 0;
+}
+
+int settings_transaction_commit(void)
+{
+	struct settings_store *cs = settings_save_dst;
+	struct settings_txn_rec rec;
+	const char *name;
+	const char *value;
+	size_t off;
+	int rc;
+	int rc2;
+
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (!settings_txn.open) {
+		k_mutex_unlock(&settings_lock);
+		return -EINVAL;
+	}
+
+	settings_txn.open = false;
+	rc = 0;
+
+	if (cs->cs_itf->csi_save_start) {
+		cs->cs_itf->csi_save_start(cs);
+	}
+
+	for (off = 0; off < settings_txn.used;) {
+		memcpy(&rec, &settings_txn.buf[off], sizeof(rec));
+		off += sizeof(rec);
+		name = (const char *)&settings_txn.buf[off];
+		off += rec.name_len;
+		value = rec.val_len ? (const char *)&settings_txn.buf[off] : NULL;
+		off += rec.val_len;
+
+		rc2 = cs->cs_itf->csi_save(cs, name, value, rec.val_len);
+		if (!rc) {
+			rc = rc2;
+		}
+	}
+
+	if (cs->cs_itf->csi_save_end) {
+		rc2 = cs->cs_itf->csi_save_end(cs);
+		if (!rc) {
+			rc = rc2;
+		}
+	}
+
+	settings_txn.used = 0;
+
+	k_mutex_unlock(&settings_lock);
+	k_mutex_unlock(&settings_lock);
+
+	return rc;
+}
+
+int settings_transaction_abort(void)
+{
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
+	if (!settings_txn.open) {
+		k_mutex_unlock(&settings_lock);
+		return -EINVAL;
+	}
+
+	settings_txn.open = false;
+	settings_txn.used = 0;
+
+	k_mutex_unlock(&settings_lock);
+	k_mutex_unlock(&settings_lock);
+
+	return 0;
+}
+#endif /* CONFIG_SETTINGS_TRANSACTION */
+
 /*
  * Append a single value to persisted config. Don't store duplicate value.
  */
@@ -103,6 +270,14 @@ int settings_save_one(const char *name, const void *value, size_t val_len)
 
 	k_mutex_lock(&settings_lock, K_FOREVER);
 
+#if defined(CONFIG_SETTINGS_TRANSACTION)
+	if (settings_txn.open) {
+		rc = settings_txn_save(name, value, val_len);
+		k_mutex_unlock(&settings_lock);
+		return rc;
+	}
+#endif
+
 	rc = cs->cs_itf->csi_save(cs, name, (char *)value, val_len);
 
 	k_mutex_unlock(&settings_lock);
@@ -126,6 +301,9 @@ int settings_save(void)
 		return -ENOENT;
 	}
 
+	/* Back-ends may keep state between save start and end */
+	k_mutex_lock(&settings_lock, K_FOREVER);
+
 	if (cs->cs_itf->csi_save_start) {
 		cs->cs_itf->csi_save_start(cs);
 	}
@@ -155,6 +333,9 @@ int settings_save(void)
 	if (cs->cs_itf->csi_save_end) {
 		cs->cs_itf->csi_save_end(cs);
 	}
+
+	k_mutex_unlock(&settings_lock);
+
 	return rc;
 }
 
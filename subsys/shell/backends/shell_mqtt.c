@@ -23,6 +23,7 @@ LOG_MODULE_REGISTER(shell_mqtt, CONFIG_SHELL_MQTT_LOG_LEVEL);
 #define CONNECT_TIMEOUT_MS 2000
 #define LISTEN_TIMEOUT_MS 500
 #define MQTT_SEND_DELAY_MS K_MSEC(100)
+#define MQTT_FULL_BUF_DELAY_MS K_MSEC(CONFIG_SHELL_MQTT_TX_FULL_BUF_DELAY)
 #define PROCESS_INTERVAL K_SECONDS(2)
 #define SHELL_MQTT_WORKQ_STACK_SIZE 2048
 
@@ -450,12 +451,11 @@ static int sh_mqtt_publish(uint8_t *data, uint32_t len)
 	return mqtt_publish(&sh_mqtt->mqtt_cli, &sh_mqtt->pub_data);
 }
 
-static int sh_mqtt_publish_tx_buf(bool is_work)
+static int sh_mqtt_publish_data(uint8_t *data, uint32_t len, bool is_work)
 {
 	int rc;
 
-	rc = sh_mqtt_publish(&sh_mqtt->tx_buf.buf[0], sh_mqtt->tx_buf.len);
-	memset(&sh_mqtt->tx_buf, 0, sizeof(sh_mqtt->tx_buf));
+	rc = sh_mqtt_publish(data, len);
 	if (rc != 0) {
 		LOG_ERR("MQTT publish error: %d", rc);
 		return rc;
@@ -463,12 +463,21 @@ static int sh_mqtt_publish_tx_buf(bool is_work)
 
 	/* Arbitrary delay to not kill the session */
 	if (!is_work) {
-		k_sleep(MQTT_SEND_DELAY_MS);
+		k_sleep(MQTT_FULL_BUF_DELAY_MS);
 	}
 
 	return rc;
 }
 
+static int sh_mqtt_publish_tx_buf(bool is_work)
+{
+	uint32_t len = sh_mqtt->tx_buf.len;
+
+	sh_mqtt->tx_buf.len = 0;
+
+	return sh_mqtt_publish_data(&sh_mqtt->tx_buf.buf[0], len, is_work);
+}
+
 static void sh_mqtt_publish_handler(struct k_work *work)
 {
 	ARG_UNUSED(work);
@@ -731,6 +740,8 @@ static int write(const struct shell_transport *transport, const void *data, size
 	int rc = 0;
 	struct k_work_sync ws;
 	size_t copy_len;
+	k_timeout_t delay;
+	bool was_pending;
 
 	*cnt = 0;
 
@@ -744,9 +755,28 @@ static int write(const struct shell_transport *transport, const void *data, size
 		goto out;
 	}
 
-	(void)k_work_cancel_delayable_sync(&sh_mqtt->publish_dwork, &ws);
+	/* Keep the deadline of the pending publication, so that output
+	 * coming continuously is still published in time.
+	 */
+	delay = K_TICKS(k_work_delayable_remaining_get(&sh_mqtt->publish_dwork));
+	was_pending = k_work_cancel_delayable_sync(&sh_mqtt->publish_dwork, &ws);
 
 	do {
+		/* Data filling a whole buffer is published without being copied */
+		if ((sh_mqtt->tx_buf.len == 0) && ((length - *cnt) >= TX_BUF_SIZE)) {
+			rc = sh_mqtt_publish_data((uint8_t *)data + *cnt, TX_BUF_SIZE, false);
+			if (rc != 0) {
+				sh_mqtt_close_and_cleanup();
+				(void)sh_mqtt_work_reschedule(&sh_mqtt->connect_dwork,
+							      K_SECONDS(2));
+				*cnt = length;
+				return rc;
+			}
+
+			*cnt += TX_BUF_SIZE;
+			continue;
+		}
+
 		if ((sh_mqtt->tx_buf.len + length - *cnt) > TX_BUF_SIZE) {
 			copy_len = TX_BUF_SIZE - sh_mqtt->tx_buf.len;
 		} else {
@@ -772,7 +802,8 @@ static int write(const struct shell_transport *transport, const void *data, size
 	} while (*cnt < length);
 
 	if (sh_mqtt->tx_buf.len > 0) {
-		(void)sh_mqtt_work_reschedule(&sh_mqtt->publish_dwork, MQTT_SEND_DELAY_MS);
+		(void)sh_mqtt_work_reschedule(&sh_mqtt->publish_dwork,
+					      was_pending ? delay : MQTT_SEND_DELAY_MS);
 	}
 
 	/* Inform shell that it is ready for next TX */
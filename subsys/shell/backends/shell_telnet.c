@@ -169,27 +169,39 @@ static void telnet_reply_command(struct telnet_simple_command *cmd)
 	}
 }
 
-static int telnet_send(void)
+static int telnet_send_data(const uint8_t *data, size_t len)
 {
 	int err;
 
-	if (sh_telnet->line_out.len == 0) {
-		return 0;
-	}
-
 	if (sh_telnet->client_ctx == NULL) {
 		return -ENOTCONN;
 	}
 
-	err = net_context_send(sh_telnet->client_ctx, sh_telnet->line_out.buf,
-			       sh_telnet->line_out.len, telnet_sent_cb,
-			       K_FOREVER, NULL);
+	err = net_context_send(sh_telnet->client_ctx, data, len,
+			       telnet_sent_cb, K_FOREVER, NULL);
 	if (err < 0) {
 		LOG_ERR("Failed to send %d, shutting down", err);
 		telnet_end_client_connection();
 		return err;
 	}
 
+	return 0;
+}
+
+static int telnet_send(void)
+{
+	int err;
+
+	if (sh_telnet->line_out.len == 0) {
+		return 0;
+	}
+
+	err = telnet_send_data(sh_telnet->line_out.buf,
+			       sh_telnet->line_out.len);
+	if (err < 0) {
+		return err;
+	}
+
 	/* We reinitialize the line buffer */
 	sh_telnet->line_out.len = 0;
 
@@ -472,6 +484,19 @@ static int write(const struct shell_transport *transport,
 						   &sh_telnet->work_sync);
 
 	do {
+		/* Data filling a whole buffer is sent without being copied. */
+		if (lb->len == 0 && length - *cnt >= TELNET_LINE_SIZE) {
+			err = telnet_send_data((const uint8_t *)data + *cnt,
+					       TELNET_LINE_SIZE);
+			if (err != 0) {
+				*cnt = length;
+				return err;
+			}
+
+			*cnt += TELNET_LINE_SIZE;
+			continue;
+		}
+
 		if (lb->len + length - *cnt > TELNET_LINE_SIZE) {
 			copy_len = TELNET_LINE_SIZE - lb->len;
 		} else {
@@ -482,9 +507,10 @@ static int write(const struct shell_transport *transport,
 		lb->len += copy_len;
 
 		/* Send the data immediately if the buffer is full or line feed
-		 * is recognized.
+		 * is recognized, unless lines are coalesced.
 		 */
-		if (lb->buf[lb->len - 1] == '\n' ||
+		if ((IS_ENABLED(CONFIG_SHELL_TELNET_SEND_ON_LINE_FEED) &&
+		     lb->buf[lb->len - 1] == '\n') ||
 		    lb->len == TELNET_LINE_SIZE) {
 			err = telnet_send();
 			if (err != 0) {
@@ -96,6 +96,34 @@ static int cmd_kernel_cycles(const struct shell *sh,
 	return 0;
 }
 
+#if defined(CONFIG_INIT_TIME_REPORT)
+static void shell_boot_time_print(const struct sys_init_report_item *item,
+				  void *user_data)
+{
+	const struct shell *sh = (const struct shell *)user_data;
+
+	if (item->milestone != NULL) {
+		shell_print(sh, "%-16s at %10u us", item->milestone, item->usec);
+	} else if (item->entry->dev != NULL) {
+		shell_print(sh, "%-16s    %10u us", item->entry->dev->name,
+			    item->usec);
+	} else {
+		shell_print(sh, "%-16p    %10u us",
+			    (void *)item->entry->init_fn.sys, item->usec);
+	}
+}
+
+static int cmd_kernel_boot_time(const struct shell *sh,
+				size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	sys_init_report_foreach(shell_boot_time_print, (void *)sh);
+	return 0;
+}
+#endif
+
 #if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_STACK_INFO) && \
 	defined(CONFIG_THREAD_MONITOR)
 static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
@@ -277,7 +305,7 @@ static int cmd_kernel_stacks(const struct shell *sh,
 #endif
 
 #if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) && (CONFIG_HEAP_MEM_POOL_SIZE > 0)
-extern struct sys_heap _system_heap;
+extern struct k_heap _system_heap;
 
 static int cmd_kernel_heap(const struct shell *sh,
 			   size_t argc, char **argv)
@@ -288,7 +316,7 @@ static int cmd_kernel_heap(const struct shell *sh,
 	int err;
 	struct sys_memory_stats stats;
 
-	err = sys_heap_runtime_stats_get(&_system_heap, &stats);
+	err = k_heap_runtime_stats_get(&_system_heap, &stats);
 	if (err) {
 		shell_error(sh, "Failed to read kernel system heap statistics (err %d)", err);
 		return -ENOEXEC;
@@ -302,6 +330,130 @@ static int cmd_kernel_heap(const struct shell *sh,
 }
 #endif
 
+#if defined(CONFIG_OBJ_CORE_STATS_WAIT)
+static const struct {
+	uint32_t id;
+	const char *name;
+} wait_obj_types[] = {
+	{ K_OBJ_TYPE_SEM_ID, "sem" },
+	{ K_OBJ_TYPE_MUTEX_ID, "mutex" },
+	{ K_OBJ_TYPE_MSGQ_ID, "msgq" },
+	{ K_OBJ_TYPE_CONDVAR_ID, "condvar" },
+};
+
+struct wait_walk_data {
+	const struct shell *sh;
+	const char *name;
+	bool reset;
+};
+
+static int wait_stats_cb(struct k_obj_core *obj_core, void *user_data)
+{
+	struct wait_walk_data *data = user_data;
+	struct k_wait_stats_query stats;
+	void *obj = (uint8_t *)obj_core - obj_core->type->obj_core_offset;
+
+	if (data->reset) {
+		(void)k_obj_core_stats_reset(obj_core);
+		return 0;
+	}
+
+	if (k_obj_core_stats_query(obj_core, &stats, sizeof(stats)) != 0 ||
+	    stats.count == 0U) {
+		return 0;
+	}
+
+	shell_print(data->sh, "%-8s %-12p %10u %10u %10u %10u %10u",
+		    data->name, obj, stats.count, stats.average, stats.p50,
+		    stats.p99, stats.max);
+
+	return 0;
+}
+
+static int cmd_kernel_waits(const struct shell *sh,
+			    size_t argc, char **argv)
+{
+	struct wait_walk_data data = {
+		.sh = sh,
+		.reset = false,
+	};
+
+	if (argc > 1) {
+		if (strcmp(argv[1], "reset") != 0) {
+			shell_help(sh);
+			return SHELL_CMD_HELP_PRINTED;
+		}
+		data.reset = true;
+	} else {
+		shell_print(sh, "%-8s %-12s %10s %10s %10s %10s %10s", "Type",
+			    "Object", "Waits", "Avg [us]", "p50 [us]",
+			    "p99 [us]", "Max [us]");
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(wait_obj_types); i++) {
+		struct k_obj_type *type = k_obj_type_find(wait_obj_types[i].id);
+
+		if (type == NULL || type->stats_desc == NULL) {
+			continue;
+		}
+
+		/* The stats operations take the object core lock themselves */
+		data.name = wait_obj_types[i].name;
+		(void)k_obj_type_walk_unlocked(type, wait_stats_cb, &data);
+	}
+
+	return 0;
+}
+#endif
+
+#if defined(CONFIG_SPIN_LOCK_STATS)
+static int cmd_kernel_spinlocks(const struct shell *sh,
+				size_t argc, char **argv)
+{
+	bool reset = false;
+
+	if (argc > 1) {
+		if (strcmp(argv[1], "reset") != 0) {
+			shell_help(sh);
+			return SHELL_CMD_HELP_PRINTED;
+		}
+		reset = true;
+	} else {
+		shell_print(sh, "%-24s %10s %10s %12s %12s %10s", "Lock",
+			    "Acquired", "Contended", "Avg spin", "Max hold",
+			    "Max [us]");
+	}
+
+	STRUCT_SECTION_FOREACH(k_spinlock_stats, stats) {
+		struct k_spinlock_stats snap;
+
+		/* Holding the lock keeps its statistics consistent */
+		K_SPINLOCK(stats->lock) {
+			snap = *stats;
+			if (reset) {
+				stats->acquired = 0;
+				stats->contended = 0;
+				stats->spin_cycles = 0;
+				stats->max_hold_cycles = 0;
+			}
+		}
+
+		if (reset) {
+			continue;
+		}
+
+		shell_print(sh, "%-24s %10u %10u %12u %12u %10u", snap.name,
+			    snap.acquired, snap.contended,
+			    snap.contended ?
+			    (uint32_t)(snap.spin_cycles / snap.contended) : 0,
+			    snap.max_hold_cycles,
+			    k_cyc_to_us_ceil32(snap.max_hold_cycles));
+	}
+
+	return 0;
+}
+#endif
+
 static int cmd_kernel_sleep(const struct shell *sh,
 			    size_t argc, char **argv)
 {
@@ -391,6 +543,9 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_reboot,
 #endif
 
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
+#if defined(CONFIG_INIT_TIME_REPORT)
+	SHELL_CMD(boot-time, NULL, "Boot time report.", cmd_kernel_boot_time),
+#endif
 	SHELL_CMD(cycles, NULL, "Kernel cycles.", cmd_kernel_cycles),
 #if defined(CONFIG_REBOOT)
 	SHELL_CMD(reboot, &sub_kernel_reboot, "Reboot.", NULL),
@@ -402,10 +557,20 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
 #endif
 #if defined(CONFIG_SYS_HEAP_RUNTIME_STATS) && (CONFIG_HEAP_MEM_POOL_SIZE > 0)
 	SHELL_CMD(heap, NULL, "System heap usage statistics.", cmd_kernel_heap),
+#endif
+#if defined(CONFIG_SPIN_LOCK_STATS)
+	SHELL_CMD_ARG(spinlocks, NULL,
+		      "Spinlock statistics, cycles. Use \"reset\" to clear them.",
+		      cmd_kernel_spinlocks, 1, 1),
 #endif
 	SHELL_CMD_ARG(uptime, NULL, "Kernel uptime. Can be called with the -p or --pretty options",
 		      cmd_kernel_uptime, 1, 1),
 	SHELL_CMD(version, NULL, "Kernel version.", cmd_kernel_version),
+#if defined(CONFIG_OBJ_CORE_STATS_WAIT)
+	SHELL_CMD_ARG(waits, NULL,
+		      "Kernel object wait times. Use \"reset\" to clear them.",
+		      cmd_kernel_waits, 1, 1),
+#endif
 	SHELL_CMD_ARG(sleep, NULL, "ms", cmd_kernel_sleep, 2, 0),
 #if defined(CONFIG_LOG_RUNTIME_FILTERING)
 	SHELL_CMD_ARG(log-level, NULL, "<module name> <severity (0-4)>",
@@ -335,10 +335,19 @@ static void find_completion_candidates(const struct shell *sh,
 	*longest = 0U;
 	*cnt = 0;
 
+	/* Root commands are sorted, so the candidates follow each other. */
+	if ((cmd == NULL) && (incompl_cmd_len > 0)) {
+		idx = z_shell_root_cmd_lower_bound(incompl_cmd, incompl_cmd_len);
+	}
+
 	while ((candidate = z_shell_cmd_get(cmd, idx, &dloc)) != NULL) {
 		bool is_candidate;
 		is_candidate = is_completion_candidate(candidate->syntax,
 						incompl_cmd, incompl_cmd_len);
+		if (!is_candidate && (cmd == NULL)) {
+			break;
+		}
+
 		if (is_candidate) {
 			*longest = Z_MAX(strlen(candidate->syntax), *longest);
 			if (*cnt == 0) {
@@ -266,13 +266,34 @@ static inline uint32_t shell_root_cmd_count(void)
 	return len;
 }
 
+/* Root commands are sorted by syntax: the linker sorts their section by
+ * name and the name of each entry ends with the syntax of the command.
+ */
+size_t z_shell_root_cmd_lower_bound(const char *str, size_t len)
+{
+	size_t lo = 0;
+	size_t hi = shell_root_cmd_count();
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (strncmp(shell_root_cmd_get(mid)->entry->syntax, str, len) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
 /* Function returning pointer to parent command matching requested syntax. */
 const struct shell_static_entry *root_cmd_find(const char *syntax)
 {
-	const size_t cmd_count = shell_root_cmd_count();
+	size_t cmd_idx = z_shell_root_cmd_lower_bound(syntax, strlen(syntax));
 	const union shell_cmd_entry *cmd;
 
-	for (size_t cmd_idx = 0; cmd_idx < cmd_count; ++cmd_idx) {
+	if (cmd_idx < shell_root_cmd_count()) {
 		cmd = shell_root_cmd_get(cmd_idx);
 		if (strcmp(syntax, cmd->entry->syntax) == 0) {
 			return cmd->entry;
@@ -343,16 +364,18 @@ const struct shell_static_entry *z_shell_find_cmd(
 	struct shell_static_entry parent_cpy;
 	size_t idx = 0;
 
+	if (parent == NULL) {
+		return root_cmd_find(cmd_str);
+	}
+
 	/* Dynamic command operates on shared memory. If we are processing two
 	 * dynamic commands at the same time (current and subcommand) they
 	 * will operate on the same memory region what can cause undefined
 	 * behaviour.
 	 * Hence we need a separate memory for each of them.
 	 */
-	if (parent) {
-		memcpy(&parent_cpy, parent, sizeof(struct shell_static_entry));
-		parent = &parent_cpy;
-	}
+	memcpy(&parent_cpy, parent, sizeof(struct shell_static_entry));
+	parent = &parent_cpy;
 
 	while ((entry = z_shell_cmd_get(parent, idx++, dloc)) != NULL) {
 		if (strcmp(cmd_str, entry->syntax) == 0) {
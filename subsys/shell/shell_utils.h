@@ -83,6 +83,19 @@ void z_shell_cmd_trim(const struct shell *sh);
 
 const struct shell_static_entry *root_cmd_find(const char *syntax);
 
+/** @brief Get the index of the first root command whose syntax does not sort
+ * before the first characters of a string.
+ *
+ * Root commands are sorted by syntax, so the ones starting with these
+ * characters follow it.
+ *
+ * @param str	String.
+ * @param len	Number of characters of @p str to compare.
+ *
+ * @return Index of the command, or the number of root commands.
+ */
+size_t z_shell_root_cmd_lower_bound(const char *str, size_t len);
+
 static inline void z_transport_buffer_flush(const struct shell *sh)
 {
 	z_shell_fprintf_buffer_flush(sh->fprintf_ctx);
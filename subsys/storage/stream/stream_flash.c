@@ -72,6 +72,216 @@ static int settings_direct_loader(const char *key, size_t len,
 
 #endif /* CONFIG_STREAM_FLASH_PROGRESS */
 
+static int flash_verify(struct stream_flash_ctx *ctx, uint8_t *buf,
+			size_t len, size_t addr)
+{
+	int rc;
+
+	/* Invert to ensure that caller is able to discover a faulty
+	 * flash_read() even if no error code is returned.
+	 */
+	for (int i = 0; i < len; i++) {
+		buf[i] = ~buf[i];
+	}
+
+	rc = flash_read(ctx->fdev, addr, buf, len);
+	if (rc != 0) {
+		LOG_ERR("flash read failed: %d", rc);
+		return rc;
+	}
+
+	rc = ctx->callback(buf, len, addr);
+	if (rc != 0) {
+		LOG_ERR("callback failed: %d", rc);
+		return rc;
+	}
+
+	return 0;
+}
+
+/* Pad the write buffer to the write block size, returns the padded length */
+static size_t flash_pad(struct stream_flash_ctx *ctx)
+{
+	size_t fill_length = flash_get_write_block_size(ctx->fdev);
+	uint8_t filler;
+
+	if (ctx->buf_bytes % fill_length) {
+		fill_length -= ctx->buf_bytes % fill_length;
+		filler = flash_get_parameters(ctx->fdev)->erase_value;
+
+		memset(ctx->buf + ctx->buf_bytes, filler, fill_length);
+	} else {
+		fill_length = 0;
+	}
+
+	return ctx->buf_bytes + fill_length;
+}
+
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+
+static void pipeline_erase_done(const struct device *dev,
+				struct flash_async_op *op, int result)
+{
+	struct stream_flash_ctx *ctx =
+		CONTAINER_OF(op, struct stream_flash_ctx, erase_op);
+
+	if (result != 0) {
+		ctx->op_result = result;
+	}
+}
+
+static void pipeline_write_done(const struct device *dev,
+				struct flash_async_op *op, int result)
+{
+	struct stream_flash_ctx *ctx =
+		CONTAINER_OF(op, struct stream_flash_ctx, write_op);
+
+	if ((result != 0) && (ctx->op_result == 0)) {
+		ctx->op_result = result;
+	}
+
+	k_sem_give(&ctx->op_done);
+}
+
+/* Wait for the write in progress, if any, and account for it */
+static int pipeline_wait(struct stream_flash_ctx *ctx)
+{
+	size_t write_addr = ctx->offset + ctx->bytes_written;
+	int rc;
+
+	if (ctx->op_bytes == 0) {
+		return 0;
+	}
+
+	k_sem_take(&ctx->op_done, K_FOREVER);
+
+	rc = ctx->op_result;
+	if (rc != 0) {
+		LOG_ERR("flash write error %d offset=0x%08zx", rc, write_addr);
+		ctx->op_bytes = 0;
+		ctx->op_result = 0;
+#ifdef CONFIG_STREAM_FLASH_ERASE
+		ctx->last_erased_page_start_offset = -1;
+#endif
+		return rc;
+	}
+
+	if (ctx->callback) {
+		rc = flash_verify(ctx, ctx->write_op.data, ctx->op_bytes,
+				  write_addr);
+	}
+
+	if (rc == 0) {
+		ctx->bytes_written += ctx->op_bytes;
+	}
+
+	ctx->op_bytes = 0;
+
+	return rc;
+}
+
+static int flash_sync_pipelined(struct stream_flash_ctx *ctx)
+{
+	size_t write_addr;
+	uint8_t *buf;
+	int rc;
+
+	rc = pipeline_wait(ctx);
+	if (rc != 0) {
+		return rc;
+	}
+
+	write_addr = ctx->offset + ctx->bytes_written;
+
+#ifdef CONFIG_STREAM_FLASH_ERASE
+	struct flash_pages_info page;
+
+	rc = flash_get_page_info_by_offs(ctx->fdev,
+					 write_addr + ctx->buf_bytes - 1,
+					 &page);
+	if (rc != 0) {
+		LOG_ERR("Error %d while getting page info", rc);
+		return rc;
+	}
+
+	if (ctx->last_erased_page_start_offset != page.start_offset) {
+		ctx->erase_op.type = FLASH_ASYNC_ERASE;
+		ctx->erase_op.offset = page.start_offset;
+		ctx->erase_op.len = page.size;
+		ctx->erase_op.cb = pipeline_erase_done;
+		ctx->erase_op.signal = NULL;
+
+		rc = flash_async_submit(ctx->fdev, &ctx->erase_op);
+		if (rc != 0) {
+			return rc;
+		}
+
+		ctx->last_erased_page_start_offset = page.start_offset;
+	}
+#endif
+
+	/* Queued after the erase, if any */
+	ctx->write_op.type = FLASH_ASYNC_WRITE;
+	ctx->write_op.offset = write_addr;
+	ctx->write_op.data = ctx->buf;
+	ctx->write_op.len = flash_pad(ctx);
+	ctx->write_op.cb = pipeline_write_done;
+	ctx->write_op.signal = NULL;
+
+	rc = flash_async_submit(ctx->fdev, &ctx->write_op);
+	if (rc != 0) {
+		return rc;
+	}
+
+	ctx->op_bytes = ctx->buf_bytes;
+
+	/* Collect the next data in the other buffer */
+	buf = ctx->buf;
+	ctx->buf = ctx->buf2;
+	ctx->buf2 = buf;
+	ctx->buf_bytes = 0U;
+
+	return 0;
+}
+
+int stream_flash_pipeline_init(struct stream_flash_ctx *ctx, uint8_t *buf2)
+{
+	if (!ctx || !buf2) {
+		return -EFAULT;
+	}
+
+	if ((ctx->buf_bytes != 0) || (ctx->bytes_written != 0)) {
+		return -EBUSY;
+	}
+
+	ctx->buf2 = buf2;
+	ctx->op_bytes = 0;
+	ctx->op_result = 0;
+	k_sem_init(&ctx->op_done, 0, 1);
+
+	return 0;
+}
+
+#endif /* CONFIG_STREAM_FLASH_PIPELINE */
+
+static inline int flash_pending_wait(struct stream_flash_ctx *ctx)
+{
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	return pipeline_wait(ctx);
+#else
+	return 0;
+#endif
+}
+
+static inline size_t flash_pending_bytes(struct stream_flash_ctx *ctx)
+{
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	return ctx->op_bytes;
+#else
+	return 0;
+#endif
+}
+
 #ifdef CONFIG_STREAM_FLASH_ERASE
 
 int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
@@ -79,6 +289,11 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 	int rc;
 	struct flash_pages_info page;
 
+	rc = flash_pending_wait(ctx);
+	if (rc != 0) {
+		return rc;
+	}
+
 	rc = flash_get_page_info_by_offs(ctx->fdev, off, &page);
 	if (rc != 0) {
 		LOG_ERR("Error %d while getting page info", rc);
@@ -109,14 +324,18 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	int rc = 0;
 	size_t write_addr = ctx->offset + ctx->bytes_written;
 	size_t buf_bytes_aligned;
-	size_t fill_length;
-	uint8_t filler;
 
 
 	if (ctx->buf_bytes == 0) {
 		return 0;
 	}
 
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	if (ctx->buf2 != NULL) {
+		return flash_sync_pipelined(ctx);
+	}
+#endif
+
 	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
 
 		rc = stream_flash_erase_page(ctx,
@@ -128,17 +347,7 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		}
 	}
 
-	fill_length = flash_get_write_block_size(ctx->fdev);
-	if (ctx->buf_bytes % fill_length) {
-		fill_length -= ctx->buf_bytes % fill_length;
-		filler = flash_get_parameters(ctx->fdev)->erase_value;
-
-		memset(ctx->buf + ctx->buf_bytes, filler, fill_length);
-	} else {
-		fill_length = 0;
-	}
-
-	buf_bytes_aligned = ctx->buf_bytes + fill_length;
+	buf_bytes_aligned = flash_pad(ctx);
 	rc = flash_write(ctx->fdev, write_addr, ctx->buf, buf_bytes_aligned);
 
 	if (rc != 0) {
@@ -148,23 +357,8 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	}
 
 	if (ctx->callback) {
-		/* Invert to ensure that caller is able to discover a faulty
-		 * flash_read() even if no error code is returned.
-		 */
-		for (int i = 0; i < ctx->buf_bytes; i++) {
-			ctx->buf[i] = ~ctx->buf[i];
-		}
-
-		rc = flash_read(ctx->fdev, write_addr, ctx->buf,
-				ctx->buf_bytes);
+		rc = flash_verify(ctx, ctx->buf, ctx->buf_bytes, write_addr);
 		if (rc != 0) {
-			LOG_ERR("flash read failed: %d", rc);
-			return rc;
-		}
-
-		rc = ctx->callback(ctx->buf, ctx->buf_bytes, write_addr);
-		if (rc != 0) {
-			LOG_ERR("callback failed: %d", rc);
 			return rc;
 		}
 	}
@@ -186,7 +380,8 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		return -EFAULT;
 	}
 
-	if (ctx->bytes_written + ctx->buf_bytes + len > ctx->available) {
+	if (ctx->bytes_written + flash_pending_bytes(ctx) + ctx->buf_bytes +
+	    len > ctx->available) {
 		return -ENOMEM;
 	}
 
@@ -216,6 +411,11 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		rc = flash_sync(ctx);
 	}
 
+	if (flush && rc == 0) {
+		/* Flushed data is written when returning */
+		rc = flash_pending_wait(ctx);
+	}
+
 	return rc;
 }
 
@@ -299,6 +499,10 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	ctx->last_erased_page_start_offset = -1;
 #endif
+#ifdef CONFIG_STREAM_FLASH_PIPELINE
+	ctx->buf2 = NULL;
+	ctx->op_bytes = 0;
+#endif
 
 	return 0;
 }
@@ -42,19 +42,37 @@
 	}
 
 #ifdef CONFIG_TRACING_CTF_TIMESTAMP
-#define CTF_EVENT(...)                                                         \
+#define CTF_INTERNAL_EVENT(...)                                                \
 	{                                                                      \
 		const uint32_t tstamp = k_cyc_to_ns_floor64(k_cycle_get_32()); \
 									       \
 		CTF_GATHER_FIELDS(tstamp, __VA_ARGS__)                         \
 	}
 #else
-#define CTF_EVENT(...)                                                         \
+#define CTF_INTERNAL_EVENT(...)                                                \
 	{                                                                      \
 		CTF_GATHER_FIELDS(__VA_ARGS__)                                 \
 	}
 #endif
 
+#ifdef CONFIG_TRACING_PER_CPU_BUFFERS
+/*
+ * The CPU ID follows the event header as the stream event context. Local
+ * interrupts stay masked until the event is in the buffer of that CPU, so
+ * the events of each CPU are stored in timestamp order.
+ */
+#define CTF_EVENT(event_id, ...)                                               \
+	{                                                                      \
+		unsigned int key = arch_irq_lock();                            \
+		const uint8_t cpu_id = _current_cpu->id;                    \
+									       \
+		CTF_INTERNAL_EVENT(event_id, cpu_id, ##__VA_ARGS__)            \
+		arch_irq_unlock(key);                                          \
+	}
+#else
+#define CTF_EVENT(...) CTF_INTERNAL_EVENT(__VA_ARGS__)
+#endif
+
 /* Anonymous compound literal with 1 member. Legal since C99.
  * This permits us to take the address of literals, like so:
  *  &CTF_LITERAL(int, 1234)
@@ -104,6 +104,53 @@ int tracing_buffer_get_finish(uint32_t size);
  */
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size);
 
+/**
+ * @brief Get number of tracing buffers.
+ *
+ * With CONFIG_TRACING_PER_CPU_BUFFERS every CPU has its own tracing buffer
+ * and the put functions, tracing_buffer_is_empty() and
+ * tracing_buffer_space_get() operate on the buffer of the calling CPU. They
+ * must then be called with TRACING_LOCK() held. Otherwise there is a single
+ * buffer.
+ *
+ * @return Number of tracing buffers.
+ */
+unsigned int tracing_buffer_num_get(void);
+
+/**
+ * @brief Get number of bytes stored in a tracing buffer.
+ *
+ * @param cpu Index of the tracing buffer.
+ *
+ * @return Number of bytes stored in the tracing buffer.
+ */
+uint32_t tracing_buffer_cpu_size_get(unsigned int cpu);
+
+/**
+ * @brief Get address of the first valid data in a tracing buffer.
+ *
+ * @param cpu Index of the tracing buffer.
+ * @param data Pointer to the address. It's set to a location pointing to
+ *             the first valid data within the tracing buffer.
+ * @param size Requested buffer size (in bytes).
+ *
+ * @return Size of valid buffer which can be smaller than requested
+ *         if there isn't enough valid data or buffer wraps.
+ */
+uint32_t tracing_buffer_cpu_get_claim(unsigned int cpu, uint8_t **data,
+				      uint32_t size);
+
+/**
+ * @brief Indicate number of bytes read from claimed buffer.
+ *
+ * @param cpu Index of the tracing buffer.
+ * @param size Number of bytes read from claimed buffer.
+ *
+ * @retval 0 Successful operation.
+ * @retval -EINVAL Given @a size exceeds available data of tracing buffer.
+ */
+int tracing_buffer_cpu_get_finish(unsigned int cpu, uint32_t size);
+
 /**
  * @brief Get buffer from tracing command buffer.
  *
@@ -4,12 +4,37 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/kernel_structs.h>
+#include <zephyr/sys/barrier.h>
 #include <zephyr/sys/ring_buffer.h>
+#include <tracing_buffer.h>
 
-static struct ring_buf tracing_ring_buf;
-static uint8_t tracing_buffer[CONFIG_TRACING_BUFFER_SIZE + 1];
+#ifdef CONFIG_TRACING_PER_CPU_BUFFERS
+#define TRACING_BUFFER_NUM CONFIG_MP_MAX_NUM_CPUS
+#else
+#define TRACING_BUFFER_NUM 1
+#endif
+
+static struct ring_buf tracing_ring_buf[TRACING_BUFFER_NUM];
+static uint8_t tracing_buffer[TRACING_BUFFER_NUM][CONFIG_TRACING_BUFFER_SIZE + 1];
 static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
 
+/* With per-CPU buffers the caller holds TRACING_LOCK(), which keeps it on
+ * its CPU. The CPU is then the only writer of its buffer and the tracing
+ * thread the only reader, so the put and get sides of the ring buffer need
+ * no lock between them, only ordering of the data against the indexes.
+ */
+static inline struct ring_buf *put_ring_buf(void)
+{
+#ifdef CONFIG_TRACING_PER_CPU_BUFFERS
+	return &tracing_ring_buf[_current_cpu->id];
+#else
+	return &tracing_ring_buf[0];
+#endif
+}
+
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 {
 	*data = &tracing_cmd_buffer[0];
@@ -19,51 +44,109 @@ uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
 
 uint32_t tracing_buffer_put_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_put_claim(&tracing_ring_buf, data, size);
+	return ring_buf_put_claim(put_ring_buf(), data, size);
 }
 
 int tracing_buffer_put_finish(uint32_t size)
 {
-	return ring_buf_put_finish(&tracing_ring_buf, size);
+	if (IS_ENABLED(CONFIG_TRACING_PER_CPU_BUFFERS)) {
+		/* Data must be visible before the reader sees it committed */
+		barrier_dmem_fence_full();
+	}
+
+	return ring_buf_put_finish(put_ring_buf(), size);
 }
 
 uint32_t tracing_buffer_put(uint8_t *data, uint32_t size)
 {
-	return ring_buf_put(&tracing_ring_buf, data, size);
+	uint8_t *dst;
+	uint32_t partial_size;
+	uint32_t total_size = 0U;
+
+	if (!IS_ENABLED(CONFIG_TRACING_PER_CPU_BUFFERS)) {
+		return ring_buf_put(put_ring_buf(), data, size);
+	}
+
+	do {
+		partial_size = tracing_buffer_put_claim(&dst, size);
+		memcpy(dst, data, partial_size);
+		total_size += partial_size;
+		size -= partial_size;
+		data += partial_size;
+	} while (size && partial_size);
+
+	(void)tracing_buffer_put_finish(total_size);
+
+	return total_size;
 }
 
 uint32_t tracing_buffer_get_claim(uint8_t **data, uint32_t size)
 {
-	return ring_buf_get_claim(&tracing_ring_buf, data, size);
+	return tracing_buffer_cpu_get_claim(0, data, size);
 }
 
 int tracing_buffer_get_finish(uint32_t size)
 {
-	return ring_buf_get_finish(&tracing_ring_buf, size);
+	return tracing_buffer_cpu_get_finish(0, size);
 }
 
 uint32_t tracing_buffer_get(uint8_t *data, uint32_t size)
 {
-	return ring_buf_get(&tracing_ring_buf, data, size);
+	return ring_buf_get(&tracing_ring_buf[0], data, size);
+}
+
+uint32_t tracing_buffer_cpu_get_claim(unsigned int cpu, uint8_t **data,
+				      uint32_t size)
+{
+	uint32_t claimed = ring_buf_get_claim(&tracing_ring_buf[cpu], data, size);
+
+	if (IS_ENABLED(CONFIG_TRACING_PER_CPU_BUFFERS)) {
+		/* Do not read data older than the index which committed it */
+		barrier_dmem_fence_full();
+	}
+
+	return claimed;
+}
+
+int tracing_buffer_cpu_get_finish(unsigned int cpu, uint32_t size)
+{
+	if (IS_ENABLED(CONFIG_TRACING_PER_CPU_BUFFERS)) {
+		/* Reads must be done before the writer can reuse the space */
+		barrier_dmem_fence_full();
+	}
+
+	return ring_buf_get_finish(&tracing_ring_buf[cpu], size);
+}
+
+uint32_t tracing_buffer_cpu_size_get(unsigned int cpu)
+{
+	return ring_buf_size_get(&tracing_ring_buf[cpu]);
+}
+
+unsigned int tracing_buffer_num_get(void)
+{
+	return IS_ENABLED(CONFIG_TRACING_PER_CPU_BUFFERS) ? arch_num_cpus() : 1;
 }
 
 void tracing_buffer_init(void)
 {
-	ring_buf_init(&tracing_ring_buf,
-		      sizeof(tracing_buffer), tracing_buffer);
+	for (int i = 0; i < TRACING_BUFFER_NUM; i++) {
+		ring_buf_init(&tracing_ring_buf[i],
+			      sizeof(tracing_buffer[i]), tracing_buffer[i]);
+	}
 }
 
 bool tracing_buffer_is_empty(void)
 {
-	return ring_buf_is_empty(&tracing_ring_buf);
+	return ring_buf_is_empty(put_ring_buf());
 }
 
 uint32_t tracing_buffer_capacity_get(void)
 {
-	return ring_buf_capacity_get(&tracing_ring_buf);
+	return ring_buf_capacity_get(&tracing_ring_buf[0]);
 }
 
 uint32_t tracing_buffer_space_get(void)
 {
-	return ring_buf_space_get(&tracing_ring_buf);
+	return ring_buf_space_get(put_ring_buf());
 }
@@ -52,6 +52,46 @@ static K_SEM_DEFINE(tracing_thread_sem, 0, 1);
 static K_THREAD_STACK_DEFINE(tracing_thread_stack,
 			CONFIG_TRACING_THREAD_STACK_SIZE);
 
+#ifdef CONFIG_TRACING_PER_CPU_BUFFERS
+static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
+{
+	uint8_t *transferring_buf;
+	uint32_t transferring_length, pending_length;
+	bool drained;
+
+	tracing_thread_tid = k_current_get();
+
+	while (true) {
+		drained = false;
+
+		for (unsigned int cpu = 0; cpu < tracing_buffer_num_get(); cpu++) {
+			/* Packets are committed whole, so draining what is
+			 * pending now ends on a packet boundary and packets
+			 * of different CPUs never interleave in the output.
+			 */
+			pending_length = tracing_buffer_cpu_size_get(cpu);
+
+			while (pending_length) {
+				transferring_length =
+					tracing_buffer_cpu_get_claim(
+							cpu,
+							&transferring_buf,
+							pending_length);
+				tracing_buffer_handle(transferring_buf,
+						      transferring_length);
+				tracing_buffer_cpu_get_finish(
+						cpu, transferring_length);
+				pending_length -= transferring_length;
+				drained = true;
+			}
+		}
+
+		if (!drained) {
+			k_sem_take(&tracing_thread_sem, K_FOREVER);
+		}
+	}
+}
+#else
 static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 {
 	uint8_t *transferring_buf;
@@ -75,6 +115,7 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 		}
 	}
 }
+#endif
 
 static void tracing_thread_timer_expiry_fn(struct k_timer *timer)
 {
@@ -20,10 +20,13 @@
 LOG_MODULE_REGISTER(usbd_cdc_acm, CONFIG_USBD_CDC_ACM_LOG_LEVEL);
 
 /*
- * FIXME: buffer count per device.
+ * Each instance may have CONFIG_USBD_CDC_ACM_BULK_TRANSFERS transfers
+ * queued on both bulk endpoints.
  */
 NET_BUF_POOL_FIXED_DEFINE(cdc_acm_ep_pool,
-			  2, 512,
+			  DT_NUM_INST_STATUS_OKAY(zephyr_cdc_acm_uart) * 2 *
+			  CONFIG_USBD_CDC_ACM_BULK_TRANSFERS,
+			  512,
 			  sizeof(struct udc_buf_info), NULL);
 
 #define CDC_ACM_DEFAULT_LINECODING	{sys_cpu_to_le32(115200), 0, 0, 8}
@@ -35,7 +38,6 @@ NET_BUF_POOL_FIXED_DEFINE(cdc_acm_ep_pool,
 #define CDC_ACM_CLASS_SUSPENDED		1
 #define CDC_ACM_IRQ_RX_ENABLED		2
 #define CDC_ACM_IRQ_TX_ENABLED		3
-#define CDC_ACM_RX_FIFO_BUSY		4
 #define CDC_ACM_LOCK			5
 
 static struct k_work_q cdc_acm_work_q;
@@ -75,6 +77,10 @@ struct cdc_acm_uart_data {
 	struct k_work tx_fifo_work;
 	/* USBD CDC ACM RX fifo work */
 	struct k_work rx_fifo_work;
+	/* Number of transfers queued on the bulk OUT endpoint */
+	atomic_t rx_transfers;
+	/* Number of transfers queued on the bulk IN endpoint */
+	atomic_t tx_transfers;
 	atomic_t state;
 	struct k_sem notif_sem;
 };
@@ -171,7 +177,11 @@ static int usbd_cdc_acm_request(struct usbd_class_node *const c_nd,
 		}
 
 		if (bi->ep == cdc_acm_get_bulk_out(c_nd)) {
-			atomic_clear_bit(&data->state, CDC_ACM_RX_FIFO_BUSY);
+			atomic_dec(&data->rx_transfers);
+		}
+
+		if (bi->ep == cdc_acm_get_bulk_in(c_nd)) {
+			atomic_dec(&data->tx_transfers);
 		}
 
 		goto ep_request_error;
@@ -181,18 +191,23 @@ static int usbd_cdc_acm_request(struct usbd_class_node *const c_nd,
 		/* RX transfer completion */
 		size_t done;
 
-		LOG_HEXDUMP_INF(buf->data, buf->len, "");
+		LOG_HEXDUMP_DBG(buf->data, buf->len, "");
 		done = ring_buf_put(data->rx_fifo.rb, buf->data, buf->len);
 		if (done && data->cb) {
 			cdc_acm_work_submit(&data->irq_cb_work);
 		}
 
-		atomic_clear_bit(&data->state, CDC_ACM_RX_FIFO_BUSY);
+		atomic_dec(&data->rx_transfers);
 		cdc_acm_work_submit(&data->rx_fifo_work);
 	}
 
 	if (bi->ep == cdc_acm_get_bulk_in(c_nd)) {
 		/* TX transfer completion */
+		atomic_dec(&data->tx_transfers);
+		if (!ring_buf_is_empty(data->tx_fifo.rb)) {
+			cdc_acm_work_submit(&data->tx_fifo_work);
+		}
+
 		if (data->cb) {
 			cdc_acm_work_submit(&data->irq_cb_work);
 		}
@@ -445,13 +460,17 @@ static int cdc_acm_send_notification(const struct device *dev,
 }
 
 /*
- * TX handler is triggered when the state of TX fifo has been altered.
+ * TX handler is triggered when the state of TX fifo has been altered
+ * and at TX transfer completion. It queues up to
+ * CONFIG_USBD_CDC_ACM_BULK_TRANSFERS transfers, so that the controller
+ * can start the next one as soon as the previous one is completed.
  */
 static void cdc_acm_tx_fifo_handler(struct k_work *work)
 {
 	struct cdc_acm_uart_data *data;
 	struct usbd_class_node *c_nd;
 	struct net_buf *buf;
+	size_t mps;
 	size_t len;
 	int ret;
 
@@ -473,22 +492,43 @@ static void cdc_acm_tx_fifo_handler(struct k_work *work)
 		return;
 	}
 
-	buf = cdc_acm_buf_alloc(cdc_acm_get_bulk_in(c_nd));
-	if (buf == NULL) {
-		cdc_acm_work_submit(&data->tx_fifo_work);
-		goto tx_fifo_handler_exit;
-	}
+	mps = cdc_acm_get_bulk_mps(c_nd);
+
+	while (!ring_buf_is_empty(data->tx_fifo.rb) &&
+	       atomic_get(&data->tx_transfers) <
+	       CONFIG_USBD_CDC_ACM_BULK_TRANSFERS) {
+		buf = cdc_acm_buf_alloc(cdc_acm_get_bulk_in(c_nd));
+		if (buf == NULL) {
+			/* Retry unless a completion will trigger the handler */
+			if (atomic_get(&data->tx_transfers) == 0) {
+				cdc_acm_work_submit(&data->tx_fifo_work);
+			}
+
+			break;
+		}
 
-	len = ring_buf_get(data->tx_fifo.rb, buf->data, buf->size);
-	net_buf_add(buf, len);
+		len = ring_buf_get(data->tx_fifo.rb, buf->data, buf->size);
+		net_buf_add(buf, len);
 
-	ret = usbd_ep_enqueue(c_nd, buf);
-	if (ret) {
-		LOG_ERR("Failed to enqueue");
-		net_buf_unref(buf);
+		/*
+		 * Terminate the transfer with a ZLP if it ends with a full
+		 * packet and no more data follows it, so the host does not
+		 * wait for the rest of it.
+		 */
+		if (len % mps == 0 && ring_buf_is_empty(data->tx_fifo.rb)) {
+			udc_ep_buf_set_zlp(buf);
+		}
+
+		atomic_inc(&data->tx_transfers);
+		ret = usbd_ep_enqueue(c_nd, buf);
+		if (ret) {
+			LOG_ERR("Failed to enqueue");
+			atomic_dec(&data->tx_transfers);
+			net_buf_unref(buf);
+			break;
+		}
 	}
 
-tx_fifo_handler_exit:
 	atomic_clear_bit(&data->state, CDC_ACM_LOCK);
 }
 
@@ -499,12 +539,17 @@ tx_fifo_handler_exit:
  *  - (x) the end of cdc_acm_irq_cb_handler
  *  - (x) USBD class API enable call
  *  - ( ) USBD class API resumed call (TODO)
+ *
+ * Up to CONFIG_USBD_CDC_ACM_BULK_TRANSFERS transfers are queued, as long
+ * as the RX fifo has room for the data of all of them.
  */
 static void cdc_acm_rx_fifo_handler(struct k_work *work)
 {
 	struct cdc_acm_uart_data *data;
 	struct usbd_class_node *c_nd;
 	struct net_buf *buf;
+	atomic_val_t queued;
+	size_t mps;
 	uint8_t ep;
 	int ret;
 
@@ -517,26 +562,33 @@ static void cdc_acm_rx_fifo_handler(struct k_work *work)
 		return;
 	}
 
-	if (ring_buf_space_get(data->rx_fifo.rb) < cdc_acm_get_bulk_mps(c_nd)) {
-		LOG_INF("RX buffer to small, throttle");
-		return;
-	}
+	mps = cdc_acm_get_bulk_mps(c_nd);
+	ep = cdc_acm_get_bulk_out(c_nd);
 
-	if (atomic_test_and_set_bit(&data->state, CDC_ACM_RX_FIFO_BUSY)) {
-		LOG_WRN("RX transfer already in progress");
-		return;
-	}
+	while (true) {
+		queued = atomic_get(&data->rx_transfers);
+		if (queued >= CONFIG_USBD_CDC_ACM_BULK_TRANSFERS) {
+			break;
+		}
 
-	ep = cdc_acm_get_bulk_out(c_nd);
-	buf = cdc_acm_buf_alloc(ep);
-	if (buf == NULL) {
-		return;
-	}
+		if (ring_buf_space_get(data->rx_fifo.rb) < (queued + 1) * mps) {
+			LOG_DBG("RX buffer to small, throttle");
+			break;
+		}
 
-	ret = usbd_ep_enqueue(c_nd, buf);
-	if (ret) {
-		LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
-		net_buf_unref(buf);
+		buf = cdc_acm_buf_alloc(ep);
+		if (buf == NULL) {
+			break;
+		}
+
+		atomic_inc(&data->rx_transfers);
+		ret = usbd_ep_enqueue(c_nd, buf);
+		if (ret) {
+			LOG_ERR("Failed to enqueue net_buf for 0x%02x", ep);
+			atomic_dec(&data->rx_transfers);
+			net_buf_unref(buf);
+			break;
+		}
 	}
 }
 
@@ -571,7 +623,7 @@ static void cdc_acm_irq_rx_enable(const struct device *dev)
 		cdc_acm_work_submit(&data->irq_cb_work);
 	}
 
-	if (!atomic_test_bit(&data->state, CDC_ACM_RX_FIFO_BUSY)) {
+	if (atomic_get(&data->rx_transfers) < CONFIG_USBD_CDC_ACM_BULK_TRANSFERS) {
 		LOG_INF("rx_en: trigger rx_fifo_work");
 		cdc_acm_work_submit(&data->rx_fifo_work);
 	}
@@ -602,7 +654,7 @@ static int cdc_acm_fifo_fill(const struct device *dev,
 		data->tx_fifo.altered = true;
 	}
 
-	LOG_INF("UART dev %p, len %d, remaining space %u",
+	LOG_DBG("UART dev %p, len %d, remaining space %u",
 		dev, len, ring_buf_space_get(data->tx_fifo.rb));
 
 	return done;
@@ -615,7 +667,7 @@ static int cdc_acm_fifo_read(const struct device *dev,
 	struct cdc_acm_uart_data *const data = dev->data;
 	uint32_t len;
 
-	LOG_INF("UART dev %p size %d length %u",
+	LOG_DBG("UART dev %p size %d length %u",
 		dev, size, ring_buf_size_get(data->rx_fifo.rb));
 
 	if (!check_wq_ctx(dev)) {
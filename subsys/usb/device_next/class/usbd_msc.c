@@ -282,7 +282,8 @@ static void msc_process_read(struct msc_bot_ctx *ctx)
 		bytes_queued += len;
 		ctx->scsi_offset += len;
 
-		if (ctx->scsi_bytes == ctx->scsi_offset) {
+		if (ctx->scsi_bytes == ctx->scsi_offset &&
+		    bytes_queued < MSC_BUF_SIZE) {
 			/* SCSI buffer can be reused now */
 			ctx->scsi_bytes = scsi_read_data(lun, ctx->scsi_buf);
 			ctx->scsi_offset = 0;
@@ -297,6 +298,14 @@ static void msc_process_read(struct msc_bot_ctx *ctx)
 		net_buf_unref(buf);
 		atomic_clear_bit(&ctx->bits, MSC_BULK_IN_QUEUED);
 	}
+
+	/* Read the next chunk from the disk while the controller transfers
+	 * the current one, the data has already been copied to the net buf.
+	 */
+	if (ctx->scsi_bytes != 0 && ctx->scsi_bytes == ctx->scsi_offset) {
+		ctx->scsi_bytes = scsi_read_data(lun, ctx->scsi_buf);
+		ctx->scsi_offset = 0;
+	}
 }
 
 static void msc_process_cbw(struct msc_bot_ctx *ctx)
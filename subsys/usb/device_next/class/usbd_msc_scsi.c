@@ -72,6 +72,7 @@ enum scsi_opcode {
 	READ_CAPACITY_10 = 0x25,
 	READ_10 = 0x28,
 	WRITE_10 = 0x2A,
+	SYNCHRONIZE_CACHE_10 = 0x35,
 	MODE_SENSE_10 = 0x5A,
 };
 
@@ -171,6 +172,7 @@ struct scsi_inquiry_response {
 	 */
 } __packed;
 
+#define MODE_SENSE_PAGE_CODE_CACHING		0x08
 #define MODE_SENSE_PAGE_CODE_ALL_PAGES		0x3F
 
 SCSI_CMD_STRUCT(MODE_SENSE_6) {
@@ -192,6 +194,25 @@ struct scsi_mode_sense_6_response {
 	uint8_t block_descriptor_length;
 } __packed;
 
+/* SBC-4 Caching mode page */
+#define CACHING_PAGE_WCE			BIT(2)
+
+struct scsi_caching_mode_page {
+	uint8_t page_code;
+	uint8_t page_length;
+	uint8_t flags;
+	uint8_t retention_priority;
+	uint16_t disable_prefetch_transfer_length;
+	uint16_t minimum_prefetch;
+	uint16_t maximum_prefetch;
+	uint16_t maximum_prefetch_ceiling;
+	uint8_t flags2;
+	uint8_t number_of_cache_segments;
+	uint16_t cache_segment_size;
+	uint8_t reserved;
+	uint8_t obsolete[3];
+} __packed;
+
 #define GET_IMMED(cmd)				(cmd->immed & BIT(0))
 #define GET_POWER_CONDITION_MODIFIER(cmd)	(cmd->condition & BIT_MASK(4))
 #define GET_POWER_CONDITION(cmd)		((cmd->start & 0xF0) >> 4)
@@ -301,6 +322,15 @@ SCSI_CMD_STRUCT(WRITE_10) {
 	uint8_t control;
 } __packed;
 
+SCSI_CMD_STRUCT(SYNCHRONIZE_CACHE_10) {
+	uint8_t opcode;
+	uint8_t immed;
+	uint32_t lba;
+	uint8_t group_number;
+	uint16_t number_of_blocks;
+	uint8_t control;
+} __packed;
+
 SCSI_CMD_STRUCT(MODE_SENSE_10) {
 	uint8_t opcode;
 	uint8_t llbaa_dbd;
@@ -346,6 +376,55 @@ static int update_disk_info(struct scsi_ctx *const ctx)
 	return status;
 }
 
+/* Write back the data cached by the disk since the last synchronization */
+static int sync_cache(struct scsi_ctx *const ctx)
+{
+	if (!ctx->cache_dirty) {
+		return 0;
+	}
+
+	if (disk_access_ioctl(ctx->disk, DISK_IOCTL_CTRL_SYNC, NULL)) {
+		LOG_ERR("Disk cache sync failed");
+		return -EIO;
+	}
+
+	ctx->cache_dirty = false;
+
+	return 0;
+}
+
+/* Append the mode pages requested by MODE SENSE to the mode parameter header
+ * and return their length. Only the caching mode page is reported, when the
+ * disk write cache is not synchronized after every WRITE command.
+ */
+static int fill_mode_pages(struct scsi_ctx *ctx, uint8_t page, uint8_t subpage,
+			   uint8_t *buf)
+{
+	struct scsi_caching_mode_page caching;
+
+	if (subpage != 0) {
+		return -EINVAL;
+	}
+
+	if (page != MODE_SENSE_PAGE_CODE_ALL_PAGES &&
+	    (page != MODE_SENSE_PAGE_CODE_CACHING ||
+	     !IS_ENABLED(CONFIG_USBD_MSC_WRITE_BACK))) {
+		return -EINVAL;
+	}
+
+	if (!IS_ENABLED(CONFIG_USBD_MSC_WRITE_BACK)) {
+		return 0;
+	}
+
+	memset(&caching, 0, sizeof(caching));
+	caching.page_code = MODE_SENSE_PAGE_CODE_CACHING;
+	caching.page_length = sizeof(caching) - 2;
+	caching.flags = CACHING_PAGE_WCE;
+	memcpy(buf, &caching, sizeof(caching));
+
+	return sizeof(caching);
+}
+
 static size_t good(struct scsi_ctx *ctx, size_t data_in_bytes)
 {
 	ctx->status = GOOD;
@@ -568,22 +647,26 @@ SCSI_CMD_HANDLER(INQUIRY)
 SCSI_CMD_HANDLER(MODE_SENSE_6)
 {
 	struct scsi_mode_sense_6_response r;
+	int pages_length;
 	int length;
 
 	ctx->cmd_is_data_read = true;
 
-	if (cmd->page != MODE_SENSE_PAGE_CODE_ALL_PAGES || cmd->subpage != 0) {
+	BUILD_ASSERT(sizeof(r) + sizeof(struct scsi_caching_mode_page) <=
+		     CONFIG_USBD_MSC_SCSI_BUFFER_SIZE);
+	pages_length = fill_mode_pages(ctx, cmd->page, cmd->subpage,
+				       &data_in_buf[sizeof(r)]);
+	if (pages_length < 0) {
 		return illegal_request(ctx, INVALID_FIELD_IN_CDB);
 	}
 
-	r.mode_data_length = 3;
+	r.mode_data_length = 3 + pages_length;
 	r.medium_type = 0x00;
 	r.device_specific_parameter = 0x00;
 	r.block_descriptor_length = 0x00;
 
-	BUILD_ASSERT(sizeof(r) <= CONFIG_USBD_MSC_SCSI_BUFFER_SIZE);
-	length = MIN(cmd->allocation_length, sizeof(r));
-	memcpy(data_in_buf, &r, length);
+	memcpy(data_in_buf, &r, sizeof(r));
+	length = MIN(cmd->allocation_length, sizeof(r) + pages_length);
 	return good(ctx, length);
 }
 
@@ -611,6 +694,11 @@ SCSI_CMD_HANDLER(START_STOP_UNIT)
 		return illegal_request(ctx, MEDIUM_REMOVAL_PREVENTED);
 	}
 
+	/* Cached data must reach the disk before it is removed */
+	if (!medium_loaded && ctx->medium_loaded && sync_cache(ctx)) {
+		return medium_error(ctx, WRITE_ERROR);
+	}
+
 	ctx->medium_loaded = medium_loaded;
 	return good(ctx, 0);
 }
@@ -758,10 +846,15 @@ static size_t store_write_10(struct scsi_ctx *ctx, const uint8_t *buf, size_t le
 		error = true;
 	}
 
-	/* Flush cache if this is the last sector in transfer */
-	if (remaining_sectors - sectors == 0) {
-		if (disk_access_ioctl(ctx->disk, DISK_IOCTL_CTRL_SYNC, NULL)) {
-			LOG_ERR("Disk cache sync failed");
+	ctx->cache_dirty = true;
+
+	/* Flush cache if this is the last sector in transfer, unless the host
+	 * is told that the write cache is enabled and has to issue
+	 * SYNCHRONIZE CACHE itself.
+	 */
+	if (remaining_sectors - sectors == 0 &&
+	    (error || !IS_ENABLED(CONFIG_USBD_MSC_WRITE_BACK))) {
+		if (sync_cache(ctx)) {
 			error = true;
 		}
 	}
@@ -797,28 +890,48 @@ SCSI_CMD_HANDLER(WRITE_10)
 	return good(ctx, 0);
 }
 
+/* SBC-4 5.24 SYNCHRONIZE CACHE (10) command */
+SCSI_CMD_HANDLER(SYNCHRONIZE_CACHE_10)
+{
+	if (!ctx->medium_loaded || update_disk_info(ctx) != DISK_STATUS_OK) {
+		return not_ready(ctx, MEDIUM_NOT_PRESENT);
+	}
+
+	/* The whole cache is synchronized regardless of the requested range */
+	if (sync_cache(ctx)) {
+		return medium_error(ctx, WRITE_ERROR);
+	}
+
+	return good(ctx, 0);
+}
+
 /* SPC-5 6.15 MODE SENSE(10) command */
 SCSI_CMD_HANDLER(MODE_SENSE_10)
 {
 	struct scsi_mode_sense_10_response r;
+	int pages_length;
 	int length;
 
 	ctx->cmd_is_data_read = true;
 
-	if (cmd->page != MODE_SENSE_PAGE_CODE_ALL_PAGES || cmd->subpage != 0) {
+	BUILD_ASSERT(sizeof(r) + sizeof(struct scsi_caching_mode_page) <=
+		     CONFIG_USBD_MSC_SCSI_BUFFER_SIZE);
+	pages_length = fill_mode_pages(ctx, cmd->page, cmd->subpage,
+				       &data_in_buf[sizeof(r)]);
+	if (pages_length < 0) {
 		return illegal_request(ctx, INVALID_FIELD_IN_CDB);
 	}
 
-	r.mode_data_length = sys_cpu_to_be16(6);
+	r.mode_data_length = sys_cpu_to_be16(6 + pages_length);
 	r.medium_type = 0x00;
 	r.device_specific_parameter = 0x00;
 	r.longlba = 0x00;
 	r.reserved5 = 0x00;
 	r.block_descriptor_length = sys_cpu_to_be16(0);
 
-	BUILD_ASSERT(sizeof(r) <= CONFIG_USBD_MSC_SCSI_BUFFER_SIZE);
-	length = MIN(sys_be16_to_cpu(cmd->allocation_length), sizeof(r));
-	memcpy(data_in_buf, &r, length);
+	memcpy(data_in_buf, &r, sizeof(r));
+	length = MIN(sys_be16_to_cpu(cmd->allocation_length),
+		     sizeof(r) + pages_length);
 
 	return good(ctx, length);
 }
@@ -876,6 +989,7 @@ size_t scsi_cmd(struct scsi_ctx *ctx, const uint8_t *cb, int len,
 	SCSI_CMD(READ_CAPACITY_10);
 	SCSI_CMD(READ_10);
 	SCSI_CMD(WRITE_10);
+	SCSI_CMD(SYNCHRONIZE_CACHE_10);
 	SCSI_CMD(MODE_SENSE_10);
 
 	LOG_ERR("Unknown SCSI opcode 0x%02x", cb[0]);
@@ -80,6 +80,7 @@ struct scsi_ctx {
 	bool medium_loaded : 1;
 	bool cmd_is_data_read : 1;
 	bool cmd_is_data_write : 1;
+	bool cache_dirty : 1;
 };
 
 void scsi_init(struct scsi_ctx *ctx, const char *disk, const char *vendor,
@@ -46,6 +46,21 @@ static inline struct net_buf *_zbus_create_net_buf(struct net_buf_pool *pool, si
 
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
 
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER)
+static K_KERNEL_STACK_DEFINE(_zbus_work_q_stack, CONFIG_ZBUS_ASYNC_LISTENER_WORK_QUEUE_STACK_SIZE);
+static struct k_work_q _zbus_work_q;
+
+void _zbus_async_listener_work_handler(struct k_work *work)
+{
+	struct zbus_async_listener *listener = CONTAINER_OF(work, struct zbus_async_listener, work);
+	const struct zbus_channel *chan;
+
+	while (k_msgq_get(listener->queue, &chan, K_NO_WAIT) == 0) {
+		listener->callback(chan);
+	}
+}
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
+
 int _zbus_init(void)
 {
 
@@ -75,6 +90,15 @@ int _zbus_init(void)
 		sys_slist_init(&chan->data->observers);
 #endif /* CONFIG_ZBUS_RUNTIME_OBSERVERS */
 	}
+
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER)
+	const struct k_work_queue_config cfg = {.name = "zbus_workq"};
+
+	k_work_queue_start(&_zbus_work_q, _zbus_work_q_stack,
+			   K_KERNEL_STACK_SIZEOF(_zbus_work_q_stack),
+			   CONFIG_ZBUS_ASYNC_LISTENER_WORK_QUEUE_PRIORITY, &cfg);
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
+
 	return 0;
 }
 SYS_INIT(_zbus_init, APPLICATION, CONFIG_ZBUS_CHANNELS_SYS_INIT_PRIORITY);
@@ -105,6 +129,22 @@ static inline int _zbus_notify_observer(const struct zbus_channel *chan,
 		break;
 	}
 #endif /* CONFIG_ZBUS_MSG_SUBSCRIBER */
+#if defined(CONFIG_ZBUS_ASYNC_LISTENER)
+	case ZBUS_OBSERVER_ASYNC_LISTENER_TYPE: {
+		struct zbus_async_listener *listener = obs->async_listener;
+		int err = k_msgq_put(listener->queue, &chan, sys_timepoint_timeout(end_time));
+
+		if (err) {
+			return err;
+		}
+
+		k_work_submit_to_queue(listener->work_queue != NULL ? listener->work_queue
+								    : &_zbus_work_q,
+				       &listener->work);
+
+		break;
+	}
+#endif /* CONFIG_ZBUS_ASYNC_LISTENER */
 
 	default:
 		_ZBUS_ASSERT(false, "Unreachable");
@@ -191,6 +231,19 @@ static inline int _zbus_vded_exec(const struct zbus_channel *chan, k_timepoint_t
 	return last_error;
 }
 
+#if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS)
+static void _zbus_pub_stats_update(const struct zbus_channel *chan, k_ticks_t start)
+{
+	struct zbus_chan_pub_stats *stats = &chan->data->pub_stats;
+	k_ticks_t latency = k_uptime_ticks() - start;
+
+	stats->count++;
+	stats->last_latency = latency;
+	stats->max_latency = MAX(stats->max_latency, latency);
+	stats->total_latency += latency;
+}
+#endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
 int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t timeout)
 {
 	int err;
@@ -201,6 +254,8 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 
 	k_timepoint_t end_time = sys_timepoint_calc(timeout);
 
+	IF_ENABLED(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS, (k_ticks_t start = k_uptime_ticks();))
+
 	if (chan->validator != NULL && !chan->validator(msg, chan->message_size)) {
 		return -ENOMSG;
 	}
@@ -214,6 +269,8 @@ int zbus_chan_pub(const struct zbus_channel *chan, const void *msg, k_timeout_t
 
 	err = _zbus_vded_exec(chan, end_time);
 
+	IF_ENABLED(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS, (_zbus_pub_stats_update(chan, start);))
+
 	k_mutex_unlock(&chan->data->mutex);
 
 	return err;
@@ -246,6 +303,8 @@ int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
 
 	k_timepoint_t end_time = sys_timepoint_calc(timeout);
 
+	IF_ENABLED(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS, (k_ticks_t start = k_uptime_ticks();))
+
 	err = k_mutex_lock(&chan->data->mutex, timeout);
 	if (err) {
 		return err;
@@ -253,11 +312,51 @@ int zbus_chan_notify(const struct zbus_channel *chan, k_timeout_t timeout)
 
 	err = _zbus_vded_exec(chan, end_time);
 
+	IF_ENABLED(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS, (_zbus_pub_stats_update(chan, start);))
+
 	k_mutex_unlock(&chan->data->mutex);
 
 	return err;
 }
 
+#if defined(CONFIG_ZBUS_CHANNEL_PUBLISH_STATS)
+int zbus_chan_pub_stats_get(const struct zbus_channel *chan, struct zbus_chan_pub_stats *stats,
+			    k_timeout_t timeout)
+{
+	int err;
+
+	_ZBUS_ASSERT(!k_is_in_isr(), "zbus cannot be used inside ISRs");
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+	_ZBUS_ASSERT(stats != NULL, "stats is required");
+
+	err = k_mutex_lock(&chan->data->mutex, timeout);
+	if (err) {
+		return err;
+	}
+
+	*stats = chan->data->pub_stats;
+
+	return k_mutex_unlock(&chan->data->mutex);
+}
+
+int zbus_chan_pub_stats_reset(const struct zbus_channel *chan, k_timeout_t timeout)
+{
+	int err;
+
+	_ZBUS_ASSERT(!k_is_in_isr(), "zbus cannot be used inside ISRs");
+	_ZBUS_ASSERT(chan != NULL, "chan is required");
+
+	err = k_mutex_lock(&chan->data->mutex, timeout);
+	if (err) {
+		return err;
+	}
+
+	memset(&chan->data->pub_stats, 0, sizeof(chan->data->pub_stats));
+
+	return k_mutex_unlock(&chan->data->mutex);
+}
+#endif /* CONFIG_ZBUS_CHANNEL_PUBLISH_STATS */
+
 int zbus_chan_claim(const struct zbus_channel *chan, k_timeout_t timeout)
 {
 	_ZBUS_ASSERT(!k_is_in_isr(), "zbus cannot be used inside ISRs");
@@ -298,6 +397,25 @@ int zbus_sub_wait(const struct zbus_observer *sub, const struct zbus_channel **c
 
 int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel **chan, void *msg,
 		      k_timeout_t timeout)
+{
+	_ZBUS_ASSERT(msg != NULL, "msg is required");
+
+	struct net_buf *buf;
+	int err = zbus_sub_wait_msg_ref(sub, chan, &buf, timeout);
+
+	if (err) {
+		return err;
+	}
+
+	memcpy(msg, net_buf_remove_mem(buf, zbus_chan_msg_size(*chan)), zbus_chan_msg_size(*chan));
+
+	net_buf_unref(buf);
+
+	return 0;
+}
+
+int zbus_sub_wait_msg_ref(const struct zbus_observer *sub, const struct zbus_channel **chan,
+			  struct net_buf **buf, k_timeout_t timeout)
 {
 	_ZBUS_ASSERT(!k_is_in_isr(), "zbus subscribers cannot be used inside ISRs");
 	_ZBUS_ASSERT(sub != NULL, "sub is required");
@@ -305,19 +423,15 @@ int zbus_sub_wait_msg(const struct zbus_observer *sub, const struct zbus_channel
 		     "sub must be a MSG_SUBSCRIBER");
 	_ZBUS_ASSERT(sub->message_fifo != NULL, "sub message_fifo is required");
 	_ZBUS_ASSERT(chan != NULL, "chan is required");
-	_ZBUS_ASSERT(msg != NULL, "msg is required");
+	_ZBUS_ASSERT(buf != NULL, "buf is required");
 
-	struct net_buf *buf = net_buf_get(sub->message_fifo, timeout);
+	*buf = net_buf_get(sub->message_fifo, timeout);
 
-	if (buf == NULL) {
+	if (*buf == NULL) {
 		return -ENOMSG;
 	}
 
-	*chan = *((struct zbus_channel **)net_buf_user_data(buf));
-
-	memcpy(msg, net_buf_remove_mem(buf, zbus_chan_msg_size(*chan)), zbus_chan_msg_size(*chan));
-
-	net_buf_unref(buf);
+	*chan = *((struct zbus_channel **)net_buf_user_data(*buf));
 
 	return 0;
 }
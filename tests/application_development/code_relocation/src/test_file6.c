@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/ztest.h>
+
+/* Only the first function is selected by the relocation filter */
+__noinline int function_filtered_in(int value)
+{
+	return value + 1;
+}
+
+__noinline int function_filtered_out(int value)
+{
+	return value - 1;
+}
+
+ZTEST(code_relocation, test_function_filter)
+{
+	extern uintptr_t __sram2_text_reloc_start;
+	extern uintptr_t __sram2_text_reloc_end;
+
+	printk("Address of function_filtered_in %p\n", &function_filtered_in);
+	printk("Address of function_filtered_out %p\n\n", &function_filtered_out);
+
+	zassert_between_inclusive((uintptr_t)&function_filtered_in,
+		(uintptr_t)&__sram2_text_reloc_start,
+		(uintptr_t)&__sram2_text_reloc_end,
+		"function_filtered_in not in sram2_text region");
+	zassert_false(((uintptr_t)&function_filtered_out >=
+		       (uintptr_t)&__sram2_text_reloc_start) &&
+		      ((uintptr_t)&function_filtered_out <=
+		       (uintptr_t)&__sram2_text_reloc_end),
+		      "function_filtered_out in sram2_text region");
+	zassert_equal(function_filtered_in(1) + function_filtered_out(1), 2);
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/sensor_convert.h>
+#include "../../common/benchmark_common.h"
+
+/* 128 readings of a 6-axis IMU, e.g. 32 ms of FIFO at 4 kHz */
+#define READING_COUNT	(128)
+#define SAMPLE_COUNT	(READING_COUNT * 3)
+
+/* Accelerometer at 16g with a q31 shift of 8 */
+#define FULL_SCALE_UMS2	(16LL * 9806650LL)
+#define SHIFT		(8)
+
+static int16_t input[SAMPLE_COUNT];
+static q31_t output[SAMPLE_COUNT];
+static q31_t reference[SAMPLE_COUNT];
+
+/* Per sample conversion as done by decoders without the helpers */
+static void convert_per_sample(const int16_t *src, q31_t *dst, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		int64_t value_ums2 = (int64_t)src[i] * FULL_SCALE_UMS2 / 32768;
+
+		dst[i] = (q31_t)(value_ums2 * (INT64_C(1) << (31 - SHIFT)) / INT64_C(1000000));
+	}
+}
+
+static void check_output(void)
+{
+	for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+		zassert_within(reference[i], output[i], 1 << 8, "Mismatch at %zu: %d != %d", i,
+			       reference[i], output[i]);
+	}
+}
+
+ZTEST(sensor_convert_benchmark, test_benchmark_per_sample)
+{
+	uint32_t irq_key, timestamp, timespan;
+
+	/* Begin benchmark */
+	benchmark_begin(&irq_key, &timestamp);
+
+	/* Execute function */
+	convert_per_sample(input, output, SAMPLE_COUNT);
+
+	/* End benchmark */
+	timespan = benchmark_end(irq_key, timestamp);
+
+	/* Print result */
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+ZTEST(sensor_convert_benchmark, test_benchmark_int16_to_q31)
+{
+	uint32_t irq_key, timestamp, timespan;
+	struct sensor_convert_cfg cfg;
+
+	zassert_ok(sensor_convert_cfg_init(&cfg, FULL_SCALE_UMS2, 0, SHIFT));
+
+	/* Begin benchmark */
+	benchmark_begin(&irq_key, &timestamp);
+
+	/* Execute function */
+	sensor_convert_int16_to_q31(input, output, SAMPLE_COUNT, &cfg);
+
+	/* End benchmark */
+	timespan = benchmark_end(irq_key, timestamp);
+
+	/* Print result */
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+
+	check_output();
+}
+
+ZTEST(sensor_convert_benchmark, test_benchmark_three_axis_calibrated)
+{
+	uint32_t irq_key, timestamp, timespan;
+	struct sensor_convert_cfg cfg[3];
+
+	/* Slightly different gain and offset on each axis */
+	zassert_ok(sensor_convert_cfg_init(&cfg[0], FULL_SCALE_UMS2 * 1001 / 1000, 10000, SHIFT));
+	zassert_ok(sensor_convert_cfg_init(&cfg[1], FULL_SCALE_UMS2 * 999 / 1000, -20000, SHIFT));
+	zassert_ok(sensor_convert_cfg_init(&cfg[2], FULL_SCALE_UMS2, 5000, SHIFT));
+
+	/* Begin benchmark */
+	benchmark_begin(&irq_key, &timestamp);
+
+	/* Execute function */
+	sensor_convert_three_axis_int16_to_q31(input, output, READING_COUNT, cfg);
+
+	/* End benchmark */
+	timespan = benchmark_end(irq_key, timestamp);
+
+	/* Print result */
+	TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);
+}
+
+static void *sensor_convert_setup(void)
+{
+	/* Deterministic pattern covering the whole int16 range */
+	for (size_t i = 0; i < SAMPLE_COUNT; i++) {
+		input[i] = (int16_t)(i * 2654435761U >> 16);
+	}
+
+	convert_per_sample(input, reference, SAMPLE_COUNT);
+
+	return NULL;
+}
+
+ZTEST_SUITE(sensor_convert_benchmark, NULL, sensor_convert_setup, NULL, NULL, NULL);
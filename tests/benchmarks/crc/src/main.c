@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/sys/printk.h>
+
+/* This is a CRC throughput benchmark.  Each CRC is computed over a
+ * buffer a number of times and the throughput is printed in kilobytes
+ * per second, so the implementations selected by Kconfig can be
+ * compared by running the benchmark once per configuration.
+ */
+
+#define BUF_SIZE 4096
+#define N_LOOPS 64
+
+static uint8_t buf[BUF_SIZE];
+
+static volatile uint32_t sink;
+
+static uint32_t kbps(uint32_t cycles)
+{
+	uint64_t bytes = (uint64_t)BUF_SIZE * N_LOOPS;
+
+	return (uint32_t)((bytes * sys_clock_hw_cycles_per_sec()) /
+			  ((uint64_t)MAX(cycles, 1U) * 1024U));
+}
+
+static void bench_crc32_ieee(void)
+{
+	uint32_t t0, t1;
+	uint32_t crc = 0;
+
+	t0 = k_cycle_get_32();
+	for (int i = 0; i < N_LOOPS; i++) {
+		crc = crc32_ieee_update(crc, buf, sizeof(buf));
+	}
+	t1 = k_cycle_get_32();
+
+	sink = crc;
+	printk("crc32_ieee %8u KB/s\n", kbps(t1 - t0));
+}
+
+static void bench_crc32_c(void)
+{
+	uint32_t t0, t1;
+	uint32_t crc = 0;
+
+	t0 = k_cycle_get_32();
+	for (int i = 0; i < N_LOOPS; i++) {
+		crc = crc32_c(crc, buf, sizeof(buf), i == 0, i == N_LOOPS - 1);
+	}
+	t1 = k_cycle_get_32();
+
+	sink = crc;
+	printk("crc32_c    %8u KB/s\n", kbps(t1 - t0));
+}
+
+static void bench_crc16_ccitt(void)
+{
+	uint32_t t0, t1;
+	uint16_t crc = 0;
+
+	t0 = k_cycle_get_32();
+	for (int i = 0; i < N_LOOPS; i++) {
+		crc = crc16_ccitt(crc, buf, sizeof(buf));
+	}
+	t1 = k_cycle_get_32();
+
+	sink = crc;
+	printk("crc16_ccitt %7u KB/s\n", kbps(t1 - t0));
+}
+
+int main(void)
+{
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)(i * 7U + 3U);
+	}
+
+	bench_crc32_ieee();
+	bench_crc32_c();
+	bench_crc16_ccitt();
+
+	printk("fin\n");
+	return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/bitarray.h>
+
+/*
+ * Time allocating and freeing regions of a few sizes in a 4096-bit array
+ * fragmented so that only its last bits can hold the larger regions.
+ */
+
+#define NUM_BITS   4096
+#define ITERATIONS 100
+#define MULTI_CNT  8
+
+SYS_BITARRAY_DEFINE_STATIC(ba, NUM_BITS);
+
+static void fragment(void)
+{
+	size_t offset;
+
+	zassert_ok(sys_bitarray_clear_region(&ba, NUM_BITS, 0));
+
+	/* Allocate everything, then free one bit out of three */
+	for (size_t i = 0; i < NUM_BITS; i++) {
+		zassert_ok(sys_bitarray_alloc(&ba, 1, &offset));
+	}
+
+	for (size_t i = 0; i < NUM_BITS - 128; i += 3) {
+		zassert_ok(sys_bitarray_free(&ba, 1, i));
+	}
+
+	zassert_ok(sys_bitarray_free(&ba, 128, NUM_BITS - 128));
+}
+
+static uint32_t cycles_per_op(uint32_t start, size_t n)
+{
+	return (k_cycle_get_32() - start) / n;
+}
+
+ZTEST(bitarray_perf, test_alloc_free)
+{
+	static const size_t sizes[] = {1, 2, 4, 16, 33, 64};
+	uint32_t alloc_cycles, free_cycles;
+	uint32_t start;
+	size_t offset;
+
+	fragment();
+
+	for (size_t s = 0; s < ARRAY_SIZE(sizes); s++) {
+		alloc_cycles = 0;
+		free_cycles = 0;
+
+		for (size_t i = 0; i < ITERATIONS; i++) {
+			start = k_cycle_get_32();
+			zassert_ok(sys_bitarray_alloc(&ba, sizes[s], &offset));
+			alloc_cycles += k_cycle_get_32() - start;
+
+			start = k_cycle_get_32();
+			zassert_ok(sys_bitarray_free(&ba, sizes[s], offset));
+			free_cycles += k_cycle_get_32() - start;
+		}
+
+		TC_PRINT("%2zu bits, cycles per op: alloc %u, free %u\n", sizes[s],
+			 alloc_cycles / ITERATIONS, free_cycles / ITERATIONS);
+	}
+}
+
+ZTEST(bitarray_perf, test_alloc_free_multi)
+{
+	size_t offsets[MULTI_CNT];
+	uint32_t single, multi;
+	uint32_t start;
+
+	fragment();
+
+	/* Fill up the one bit holes, then free them */
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < ITERATIONS; i++) {
+		for (size_t j = 0; j < MULTI_CNT; j++) {
+			zassert_ok(sys_bitarray_alloc(&ba, 1, &offsets[j]));
+		}
+
+		for (size_t j = 0; j < MULTI_CNT; j++) {
+			zassert_ok(sys_bitarray_free(&ba, 1, offsets[j]));
+		}
+	}
+	single = cycles_per_op(start, ITERATIONS);
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < ITERATIONS; i++) {
+		zassert_ok(sys_bitarray_alloc_multi(&ba, 1, MULTI_CNT, offsets));
+		zassert_ok(sys_bitarray_free_multi(&ba, 1, MULTI_CNT, offsets));
+	}
+	multi = cycles_per_op(start, ITERATIONS);
+
+	TC_PRINT("%d single bits, cycles per alloc and free: one by one %u, at once %u\n",
+		 MULTI_CNT, single, multi);
+}
+
+ZTEST_SUITE(bitarray_perf, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/hash_map.h>
+
+/*
+ * Time insertion, lookup of present and missing keys, and removal of the same set of keys in each
+ * hashmap implementation. Each map is filled up to its default load factor before the lookups.
+ */
+
+#define N_KEYS 512
+
+SYS_HASHMAP_SC_DEFINE_STATIC(sc_map);
+SYS_HASHMAP_OA_LP_DEFINE_STATIC(oa_lp_map);
+SYS_HASHMAP_OA_RH_DEFINE_STATIC(oa_rh_map);
+
+static uint64_t keys[N_KEYS];
+
+static void *hashmap_perf_setup(void)
+{
+	uint64_t x = 0x9e3779b97f4a7c15ULL;
+
+	/* xorshift64, the low bit is cleared so that odd keys are never present */
+	for (size_t i = 0; i < N_KEYS; ++i) {
+		x ^= x << 13;
+		x ^= x >> 7;
+		x ^= x << 17;
+		keys[i] = x & ~1ULL;
+	}
+
+	return NULL;
+}
+
+static uint32_t cycles_per_op(uint32_t start)
+{
+	return (k_cycle_get_32() - start) / N_KEYS;
+}
+
+static void hashmap_perf_run(struct sys_hashmap *map, const char *name)
+{
+	uint32_t insert;
+	uint32_t hit;
+	uint32_t miss;
+	uint32_t remove;
+	uint32_t start;
+	uint64_t value;
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < N_KEYS; ++i) {
+		zassert_equal(1, sys_hashmap_insert(map, keys[i], i, NULL));
+	}
+	insert = cycles_per_op(start);
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < N_KEYS; ++i) {
+		zassert_true(sys_hashmap_get(map, keys[i], &value));
+	}
+	hit = cycles_per_op(start);
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < N_KEYS; ++i) {
+		zassert_false(sys_hashmap_get(map, keys[i] | 1, &value));
+	}
+	miss = cycles_per_op(start);
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < N_KEYS; ++i) {
+		zassert_true(sys_hashmap_remove(map, keys[i], NULL));
+	}
+	remove = cycles_per_op(start);
+
+	zassert_true(sys_hashmap_is_empty(map));
+
+	TC_PRINT("%-6s cycles per op: insert %u, get hit %u, get miss %u, remove %u\n", name,
+		 insert, hit, miss, remove);
+}
+
+ZTEST(hashmap_perf, test_separate_chaining)
+{
+	hashmap_perf_run(&sc_map, "sc");
+}
+
+ZTEST(hashmap_perf, test_open_addressing_linear_probe)
+{
+	hashmap_perf_run(&oa_lp_map, "oa_lp");
+}
+
+ZTEST(hashmap_perf, test_open_addressing_robin_hood)
+{
+	hashmap_perf_run(&oa_rh_map, "oa_rh");
+}
+
+ZTEST_SUITE(hashmap_perf, NULL, hashmap_perf_setup, NULL, NULL, NULL);
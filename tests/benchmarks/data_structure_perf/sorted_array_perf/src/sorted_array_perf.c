@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/rb.h>
+#include <zephyr/sys/sorted_array.h>
+
+/*
+ * Time insertion, lookup and removal of the minimum of the same set of elements in a red/black
+ * tree and in a sorted array, for a few set sizes.
+ */
+
+#define MAX_NODES 1024
+
+struct node {
+	struct rbnode rbnode;
+	uint32_t key;
+};
+
+static struct node nodes[MAX_NODES];
+
+static bool rb_node_lessthan(struct rbnode *a, struct rbnode *b)
+{
+	return CONTAINER_OF(a, struct node, rbnode)->key < CONTAINER_OF(b, struct node, rbnode)->key;
+}
+
+static bool node_lessthan(const void *a, const void *b)
+{
+	return ((const struct node *)a)->key < ((const struct node *)b)->key;
+}
+
+static struct rbtree tree = {
+	.lessthan_fn = rb_node_lessthan,
+};
+
+SYS_SORTED_ARRAY_DEFINE(array, MAX_NODES, node_lessthan);
+
+static void *sorted_array_perf_setup(void)
+{
+	uint32_t x = 0x12345678;
+
+	/* xorshift32 */
+	for (size_t i = 0; i < MAX_NODES; i++) {
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		nodes[i].key = x;
+	}
+
+	return NULL;
+}
+
+static uint32_t cycles_per_op(uint32_t start, size_t n)
+{
+	return (k_cycle_get_32() - start) / n;
+}
+
+static void rbtree_run(size_t n)
+{
+	uint32_t insert;
+	uint32_t find;
+	uint32_t remove_min;
+	uint32_t start;
+	struct rbnode *min;
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < n; i++) {
+		rb_insert(&tree, &nodes[i].rbnode);
+	}
+	insert = cycles_per_op(start, n);
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < n; i++) {
+		zassert_true(rb_contains(&tree, &nodes[i].rbnode));
+	}
+	find = cycles_per_op(start, n);
+
+	start = k_cycle_get_32();
+	while ((min = rb_get_min(&tree)) != NULL) {
+		rb_remove(&tree, min);
+	}
+	remove_min = cycles_per_op(start, n);
+
+	TC_PRINT("rbtree       %4zu nodes, cycles per op: insert %u, find %u, remove min %u\n",
+		 n, insert, find, remove_min);
+}
+
+static void sorted_array_run(size_t n)
+{
+	uint32_t insert;
+	uint32_t find;
+	uint32_t remove_min;
+	uint32_t start;
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < n; i++) {
+		zassert_ok(sys_sorted_array_insert(&array, &nodes[i]));
+	}
+	insert = cycles_per_op(start, n);
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < n; i++) {
+		zassert_true(sys_sorted_array_contains(&array, &nodes[i]));
+	}
+	find = cycles_per_op(start, n);
+
+	start = k_cycle_get_32();
+	while (sys_sorted_array_remove_min(&array) != NULL) {
+	}
+	remove_min = cycles_per_op(start, n);
+
+	TC_PRINT("sorted array %4zu nodes, cycles per op: insert %u, find %u, remove min %u\n",
+		 n, insert, find, remove_min);
+}
+
+ZTEST(sorted_array_perf, test_rbtree)
+{
+	for (size_t n = 16; n <= MAX_NODES; n *= 4) {
+		rbtree_run(n);
+	}
+}
+
+ZTEST(sorted_array_perf, test_sorted_array)
+{
+	for (size_t n = 16; n <= MAX_NODES; n *= 4) {
+		sorted_array_run(n);
+	}
+}
+
+ZTEST_SUITE(sorted_array_perf, NULL, sorted_array_perf_setup, NULL, NULL, NULL);
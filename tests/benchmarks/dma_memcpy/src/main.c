@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/dma/dma_memcpy.h>
+#include <zephyr/ztest.h>
+
+#define MAX_SIZE   (16 * 1024)
+#define ITERATIONS 16
+
+static uint8_t src[MAX_SIZE] __aligned(32);
+static uint8_t dst[MAX_SIZE] __aligned(32);
+
+static const size_t sizes[] = {64, 256, 1024, 4096, MAX_SIZE};
+
+static uint32_t bench_cpu(size_t size)
+{
+	uint32_t start = k_cycle_get_32();
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		memcpy(dst, src, size);
+	}
+
+	return (k_cycle_get_32() - start) / ITERATIONS;
+}
+
+static uint32_t bench_dma(size_t size)
+{
+	uint32_t start = k_cycle_get_32();
+
+	for (int i = 0; i < ITERATIONS; i++) {
+		zassert_ok(dma_memcpy(dst, src, size));
+	}
+
+	return (k_cycle_get_32() - start) / ITERATIONS;
+}
+
+/* Throughput in kB/s from a number of bytes and cycles */
+static uint64_t throughput(size_t size, uint32_t cycles)
+{
+	return (uint64_t)size * sys_clock_hw_cycles_per_sec() / MAX(cycles, 1) / 1000;
+}
+
+ZTEST(dma_memcpy_benchmark, test_benchmark_copy)
+{
+	uint32_t cpu, dma;
+
+	TC_PRINT("%8s %12s %12s %12s %12s\n", "size", "cpu cycles", "dma cycles", "cpu kB/s",
+		 "dma kB/s");
+
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		cpu = bench_cpu(sizes[i]);
+
+		memset(dst, 0, sizeof(dst));
+		dma = bench_dma(sizes[i]);
+		zassert_mem_equal(dst, src, sizes[i], "Copy of %zu bytes mismatch", sizes[i]);
+
+		TC_PRINT("%8zu %12u %12u %12llu %12llu\n", sizes[i], cpu, dma,
+			 throughput(sizes[i], cpu), throughput(sizes[i], dma));
+	}
+}
+
+ZTEST(dma_memcpy_benchmark, test_unaligned_copy)
+{
+	memset(dst, 0, sizeof(dst));
+
+	/* Byte transfers and a length that isn't a multiple of the block size */
+	zassert_ok(dma_memcpy(&dst[1], &src[3], MAX_SIZE - 5));
+	zassert_mem_equal(&dst[1], &src[3], MAX_SIZE - 5);
+	zassert_equal(dst[0], 0);
+}
+
+static void *dma_memcpy_setup(void)
+{
+	for (size_t i = 0; i < sizeof(src); i++) {
+		src[i] = (uint8_t)(i * 31 + 7);
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(dma_memcpy_benchmark, NULL, dma_memcpy_setup, NULL, NULL, NULL);
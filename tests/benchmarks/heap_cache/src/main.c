@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* This is a k_heap throughput benchmark.  A number of equal priority
+ * worker threads share one heap and each repeatedly allocates a batch
+ * of small blocks and frees them again.  The wall clock time from the
+ * start of all workers until the last one finishes is divided by the
+ * total number of alloc/free pairs.  On SMP the workers are spread
+ * over the CPUs by the scheduler.
+ */
+
+#define MAX_THREADS 4
+#define N_LOOPS 2000
+#define BATCH 8
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+K_HEAP_DEFINE(bench_heap, 16384);
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, MAX_THREADS, STACK_SIZE);
+static struct k_thread threads[MAX_THREADS];
+static K_SEM_DEFINE(start_sem, 0, MAX_THREADS);
+
+static const int counts[] = { 1, 2, MAX_THREADS };
+
+static void worker(void *p1, void *p2, void *p3)
+{
+	uint32_t rand_state = POINTER_TO_UINT(p1) + 1U;
+	void *blocks[BATCH];
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sem_take(&start_sem, K_FOREVER);
+
+	for (int i = 0; i < N_LOOPS; i++) {
+		for (int j = 0; j < BATCH; j++) {
+			/* Deterministic LCG, sizes from 8 to 128 bytes */
+			rand_state = rand_state * 1103515245U + 12345U;
+			size_t bytes = 8 + ((rand_state >> 16) % 121);
+
+			blocks[j] = k_heap_alloc(&bench_heap, bytes, K_NO_WAIT);
+			__ASSERT_NO_MSG(blocks[j] != NULL);
+		}
+
+		for (int j = 0; j < BATCH; j++) {
+			k_heap_free(&bench_heap, blocks[j]);
+		}
+	}
+}
+
+static void run_threads(int n)
+{
+	uint32_t t0, t1;
+
+	for (int i = 0; i < n; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, worker,
+				UINT_TO_POINTER(i), NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	/* Let the workers block on the semaphore first */
+	k_sleep(K_MSEC(10));
+
+	t0 = k_cycle_get_32();
+	for (int i = 0; i < n; i++) {
+		k_sem_give(&start_sem);
+	}
+
+	for (int i = 0; i < n; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+	t1 = k_cycle_get_32();
+
+	printk("threads %d alloc+free %4u\n", n,
+	       (t1 - t0) / (n * N_LOOPS * BATCH));
+}
+
+int main(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(counts); i++) {
+		run_threads(counts[i]);
+	}
+
+	printk("fin\n");
+	return 0;
+}
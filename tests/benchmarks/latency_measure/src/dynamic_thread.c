@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time for dynamic thread stack operations
+ *
+ * This file contains the test that measures the times to allocate a thread
+ * stack, to create a thread on it and wait for it to terminate, and to free
+ * the thread stack.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+
+#define TEST_COUNT 100
+
+static struct k_thread dynamic_thread;
+
+static void dynamic_thread_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+}
+
+void dynamic_thread_stack(void)
+{
+	timing_t start;
+	timing_t finish;
+	k_thread_stack_t *stack;
+
+	uint32_t count = 0U;
+	uint32_t sum_alloc = 0U;
+	uint32_t sum_create = 0U;
+	uint32_t sum_free = 0U;
+
+	bool  failed = false;
+	char  error_string[80];
+	const char *notes = "";
+
+	timing_start();
+
+	while (count != TEST_COUNT) {
+		start = timing_counter_get();
+		stack = k_thread_stack_alloc(CONFIG_DYNAMIC_THREAD_STACK_SIZE, 0);
+		finish = timing_counter_get();
+		if (stack == NULL) {
+			error_count++;
+			snprintk(error_string, 78,
+				 "alloc stack @ iteration %d", count);
+			notes = error_string;
+			break;
+		}
+
+		sum_alloc += timing_cycles_get(&start, &finish);
+
+		/* The thread preempts this one and terminates right away */
+
+		start = timing_counter_get();
+		k_thread_create(&dynamic_thread, stack,
+				CONFIG_DYNAMIC_THREAD_STACK_SIZE,
+				dynamic_thread_entry, NULL, NULL, NULL,
+				K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+		k_thread_join(&dynamic_thread, K_FOREVER);
+		finish = timing_counter_get();
+
+		sum_create += timing_cycles_get(&start, &finish);
+
+		start = timing_counter_get();
+		(void)k_thread_stack_free(stack);
+		finish = timing_counter_get();
+
+		sum_free += timing_cycles_get(&start, &finish);
+		count++;
+	}
+
+	if (count == 0) {
+		failed = true;
+		notes = "No dynamic thread stack--increase the pool size.";
+	}
+
+	PRINT_STATS_AVG("Average time for dynamic thread stack alloc",
+			sum_alloc, count, failed, notes);
+	PRINT_STATS_AVG("Average time for dynamic thread create and join",
+			sum_create, count, failed, notes);
+	PRINT_STATS_AVG("Average time for dynamic thread stack free",
+			sum_free, count, failed, notes);
+
+	timing_stop();
+}
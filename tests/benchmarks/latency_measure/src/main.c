@@ -41,6 +41,7 @@ int error_count; /* track number of errors */
 
 extern void thread_switch_yield(uint32_t num_iterations, bool is_cooperative);
 extern void int_to_thread(uint32_t num_iterations);
+extern int msgq_isr_to_thread(uint32_t num_iterations);
 extern void sema_test_signal(uint32_t num_iterations, uint32_t options);
 extern void mutex_lock_unlock(uint32_t num_iterations, uint32_t options);
 extern void sema_context_switch(uint32_t num_iterations,
@@ -48,6 +49,7 @@ extern void sema_context_switch(uint32_t num_iterations,
 extern int thread_ops(uint32_t num_iterations, uint32_t start_options,
 		      uint32_t alt_options);
 extern void heap_malloc_free(void);
+extern void dynamic_thread_stack(void);
 
 static void test_thread(void *arg1, void *arg2, void *arg3)
 {
@@ -81,6 +83,8 @@ static void test_thread(void *arg1, void *arg2, void *arg3)
 
 	int_to_thread(NUM_ITERATIONS);
 
+	msgq_isr_to_thread(NUM_ITERATIONS);
+
 	/* Thread creation, starting, suspending, resuming and aborting. */
 
 	thread_ops(NUM_ITERATIONS, 0, 0);
@@ -109,6 +113,10 @@ static void test_thread(void *arg1, void *arg2, void *arg3)
 
 	heap_malloc_free();
 
+#ifdef CONFIG_DYNAMIC_THREAD
+	dynamic_thread_stack();
+#endif
+
 	TC_END_REPORT(error_count);
 }
 
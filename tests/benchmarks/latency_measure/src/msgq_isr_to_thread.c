@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ *
+ * @brief Measure time from an ISR sending a message to a thread receiving it
+ *
+ * The message is sent through a k_msgq and through a k_spsc_msgq. In both
+ * cases the receiving thread waits on an empty queue and has a higher
+ * priority than the interrupted thread, so the time includes waking up the
+ * receiver and switching to it.
+ */
+
+#include <zephyr/kernel.h>
+#include "utils.h"
+#include "timing_sc.h"
+
+#include <zephyr/irq_offload.h>
+
+K_MSGQ_DEFINE(isr_msgq, sizeof(uint32_t), 2, 4);
+K_SPSC_MSGQ_DEFINE(isr_spsc_msgq, sizeof(uint32_t), 2, 4);
+
+static void msgq_isr(const void *arg)
+{
+	uint32_t msg = 0;
+
+	timestamp.sample = timing_timestamp_get();
+	(void)k_msgq_put((struct k_msgq *)arg, &msg, K_NO_WAIT);
+}
+
+static void spsc_msgq_isr(const void *arg)
+{
+	uint32_t msg = 0;
+
+	timestamp.sample = timing_timestamp_get();
+	(void)k_spsc_msgq_put((struct k_spsc_msgq *)arg, &msg);
+}
+
+static void receive_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+	bool spsc = (bool)(uintptr_t)p2;
+	uint64_t sum = 0ull;
+	timing_t start;
+	timing_t finish;
+	uint32_t msg;
+
+	ARG_UNUSED(p3);
+
+	k_thread_start(&alt_thread);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+
+		/* 1. Wait on an empty message queue */
+
+		if (spsc) {
+			(void)k_spsc_msgq_get(&isr_spsc_msgq, &msg, K_FOREVER);
+		} else {
+			(void)k_msgq_get(&isr_msgq, &msg, K_FOREVER);
+		}
+
+		/* 3. Obtain the start and finish timestamps */
+
+		finish = timing_timestamp_get();
+		start = timestamp.sample;
+
+		sum += timing_cycles_get(&start, &finish);
+	}
+
+	timestamp.cycles = sum;
+}
+
+static void send_thread_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t num_iterations = (uint32_t)(uintptr_t)p1;
+	bool spsc = (bool)(uintptr_t)p2;
+
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+
+		/* 2. Send a message from an ISR */
+
+		if (spsc) {
+			irq_offload(spsc_msgq_isr, &isr_spsc_msgq);
+		} else {
+			irq_offload(msgq_isr, &isr_msgq);
+		}
+
+		/*
+		 * ISR expected to have awakened higher priority receiving
+		 * thread thereby preempting this thread.
+		 */
+	}
+
+	k_thread_join(&start_thread, K_FOREVER);
+}
+
+static uint64_t msgq_isr_to_thread_run(uint32_t num_iterations, bool spsc)
+{
+	int priority = k_thread_priority_get(k_current_get());
+
+	k_thread_create(&start_thread, start_stack,
+			K_THREAD_STACK_SIZEOF(start_stack),
+			receive_thread_entry,
+			(void *)(uintptr_t)num_iterations, (void *)(uintptr_t)spsc,
+			NULL, priority - 2, 0, K_FOREVER);
+
+	k_thread_create(&alt_thread, alt_stack,
+			K_THREAD_STACK_SIZEOF(alt_stack),
+			send_thread_entry,
+			(void *)(uintptr_t)num_iterations, (void *)(uintptr_t)spsc,
+			NULL, priority - 1, 0, K_FOREVER);
+
+	k_thread_start(&start_thread);
+
+	k_thread_join(&alt_thread, K_FOREVER);
+
+	return timestamp.cycles;
+}
+
+/**
+ *
+ * @brief The test main function
+ *
+ * @return 0 on success
+ */
+int msgq_isr_to_thread(uint32_t num_iterations)
+{
+	uint64_t sum;
+
+	timing_start();
+	TICK_SYNCH();
+
+	sum = msgq_isr_to_thread_run(num_iterations, false);
+	sum -= timestamp_overhead_adjustment(0, 0);
+
+	PRINT_STATS_AVG("Message from ISR to another thread (k_msgq)",
+			(uint32_t)sum, num_iterations, false, "");
+
+	sum = msgq_isr_to_thread_run(num_iterations, true);
+	sum -= timestamp_overhead_adjustment(0, 0);
+
+	PRINT_STATS_AVG("Message from ISR to another thread (k_spsc_msgq)",
+			(uint32_t)sum, num_iterations, false, "");
+
+	timing_stop();
+	return 0;
+}
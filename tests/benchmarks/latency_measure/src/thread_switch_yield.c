@@ -15,6 +15,10 @@
  *   2. User thread   -> User thread
  *   3. Kernel thread -> User thread
  *   4. User thread   -> Kernel thread
+ *
+ * When FPU sharing is enabled, context switches between kernel threads
+ * created with K_FP_REGS are also measured, with both threads using the FPU
+ * between switches and with neither of them using it.
  */
 
 #include <zephyr/kernel.h>
@@ -25,17 +29,35 @@
 #include "utils.h"
 #include "timing_sc.h"
 
+#if defined(CONFIG_FPU_SHARING)
+static volatile float fp_value;
+
+static inline void fp_use(bool use_fp)
+{
+	if (use_fp) {
+		fp_value = fp_value * 0.5f + 1.0f;
+	}
+}
+#else
+static inline void fp_use(bool use_fp)
+{
+	ARG_UNUSED(use_fp);
+}
+#endif
+
 static void alt_thread_entry(void *p1, void *p2, void *p3)
 {
 	uint32_t  num_iterations;
+	bool use_fp = (bool)(uintptr_t)p2;
 
-	ARG_UNUSED(p2);
-	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
 
 	num_iterations = (uint32_t)(uintptr_t)p1;
 
 	for (uint32_t i = 0; i < num_iterations; i++) {
 
+		fp_use(use_fp);
+
 		/* 3. Obtain the 'finish' timestamp */
 
 		timestamp.sample = timing_timestamp_get();
@@ -53,9 +75,9 @@ static void start_thread_entry(void *p1, void *p2, void *p3)
 	uint32_t  num_iterations;
 	timing_t  start;
 	timing_t  finish;
+	bool use_fp = (bool)(uintptr_t)p2;
 
-	ARG_UNUSED(p2);
-	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
 
 	num_iterations = (uint32_t)(uintptr_t)p1;
 
@@ -63,6 +85,8 @@ static void start_thread_entry(void *p1, void *p2, void *p3)
 
 	for (uint32_t i = 0; i < num_iterations; i++) {
 
+		fp_use(use_fp);
+
 		/* 1. Get 'start' timestamp */
 
 		start = timing_timestamp_get();
@@ -93,7 +117,7 @@ static void thread_switch_yield_common(const char *description,
 				       uint32_t num_iterations,
 				       uint32_t start_options,
 				       uint32_t alt_options,
-				       int priority)
+				       int priority, bool use_fp)
 {
 	uint64_t  sum;
 	char summary[80];
@@ -103,13 +127,15 @@ static void thread_switch_yield_common(const char *description,
 	k_thread_create(&start_thread, start_stack,
 			K_THREAD_STACK_SIZEOF(start_stack),
 			start_thread_entry,
-			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			(void *)(uintptr_t)num_iterations,
+			(void *)(uintptr_t)use_fp, NULL,
 			priority - 1, start_options, K_FOREVER);
 
 	k_thread_create(&alt_thread, alt_stack,
 			K_THREAD_STACK_SIZEOF(alt_stack),
 			alt_thread_entry,
-			(void *)(uintptr_t)num_iterations, NULL, NULL,
+			(void *)(uintptr_t)num_iterations,
+			(void *)(uintptr_t)use_fp, NULL,
 			priority - 1, alt_options, K_FOREVER);
 
 	/* Grant access rights if necessary */
@@ -153,19 +179,33 @@ void thread_switch_yield(uint32_t num_iterations, bool is_cooperative)
 
 	/* Kernel -> Kernel */
 	thread_switch_yield_common(description, num_iterations, 0, 0,
-				   priority);
+				   priority, false);
 
 #if CONFIG_USERSPACE
 	/* User   -> User   */
 	thread_switch_yield_common(description, num_iterations, K_USER, K_USER,
-				   priority);
+				   priority, false);
 
 	/* Kernel -> User   */
 	thread_switch_yield_common(description, num_iterations, 0, K_USER,
-				   priority);
+				   priority, false);
 
 	/* User   -> Kernel */
 	thread_switch_yield_common(description, num_iterations, K_USER, 0,
-				   priority);
+				   priority, false);
+#endif
+
+#if defined(CONFIG_FPU_SHARING)
+	snprintf(description, sizeof(description),
+		 "%s FP threads ctx switch via k_yield, FPU used",
+		 is_cooperative ? "Coop" : "Preempt");
+	thread_switch_yield_common(description, num_iterations, K_FP_REGS,
+				   K_FP_REGS, priority, true);
+
+	snprintf(description, sizeof(description),
+		 "%s FP threads ctx switch via k_yield, FPU unused",
+		 is_cooperative ? "Coop" : "Preempt");
+	thread_switch_yield_common(description, num_iterations, K_FP_REGS,
+				   K_FP_REGS, priority, false);
 #endif
 }
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+/* This is a memcpy(), memset() and memcmp() throughput benchmark.  Each
+ * function is run over a range of sizes, with the buffers aligned and
+ * with the source and destination misaligned from each other.  The
+ * throughput is printed in kilobytes per second so that C libraries and
+ * their configurations can be compared by running the benchmark once
+ * per configuration.
+ */
+
+#define MAX_SIZE 4096
+#define N_BYTES (256 * 1024)
+
+static uint8_t src_buf[MAX_SIZE + 8] __aligned(8);
+static uint8_t dst_buf[MAX_SIZE + 8] __aligned(8);
+
+static const size_t sizes[] = { 8, 64, 512, MAX_SIZE };
+static const size_t offsets[] = { 0, 1, 3 };
+
+static volatile int sink;
+
+static uint32_t kbps(uint32_t cycles)
+{
+	return (uint32_t)(((uint64_t)N_BYTES * sys_clock_hw_cycles_per_sec()) /
+			  ((uint64_t)MAX(cycles, 1U) * 1024U));
+}
+
+/* Runs op over the buffers until N_BYTES are processed */
+#define BENCH(name, size, offset, op)						\
+	do {									\
+		uint8_t *dst = dst_buf;						\
+		const uint8_t *src = &src_buf[offset];				\
+		uint32_t t0 = k_cycle_get_32();					\
+										\
+		for (size_t done = 0; done < N_BYTES; done += (size)) {	\
+			op;							\
+		}								\
+		printk("%-6s size %4zu offset %zu %8u KB/s\n", name, size,	\
+		       (size_t)(offset), kbps(k_cycle_get_32() - t0));		\
+	} while (false)
+
+int main(void)
+{
+	for (size_t i = 0; i < sizeof(src_buf); i++) {
+		src_buf[i] = (uint8_t)(i * 7U + 3U);
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+		for (size_t j = 0; j < ARRAY_SIZE(offsets); j++) {
+			size_t size = sizes[i];
+			size_t offset = offsets[j];
+
+			BENCH("memcpy", size, offset, memcpy(dst, src, size));
+			BENCH("memset", size, offset, memset(dst + offset, 0x5a, size));
+			memcpy(dst_buf, &src_buf[offset], size);
+			BENCH("memcmp", size, offset, sink = memcmp(dst, src, size));
+		}
+	}
+
+	printk("fin\n");
+	return 0;
+}
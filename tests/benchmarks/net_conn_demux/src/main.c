@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_pkt.h>
+
+#include "connection.h"
+
+/* This is a connection demultiplexing microbenchmark.  It registers a
+ * wildcard UDP connection and a number of fully specified ones on the
+ * same local port, then repeatedly hands a received packet header to
+ * net_conn_input(), reporting the average latency of finding the
+ * matching connection.  The packet either belongs to the oldest fully
+ * specified connection, the last one a linear search would find, or
+ * comes from an unknown peer and is delivered to the wildcard one.
+ */
+
+#define MAX_CONNS 200
+#define N_RUNS 1000
+
+#define LOCAL_PORT 4242
+#define REMOTE_PORT_BASE 10000
+#define UNKNOWN_PORT 9999
+
+/* Value passed to the callback of the wildcard connection */
+#define WILDCARD_ID 0
+
+static const int counts[] = { 10, 50, MAX_CONNS };
+
+static struct net_conn_handle *handles[MAX_CONNS];
+
+static struct sockaddr_in6 local = {
+	.sin6_family = AF_INET6,
+	.sin6_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+			   0, 0, 0, 0, 0, 0, 0, 0x1 } } },
+};
+
+static struct sockaddr_in6 remote = {
+	.sin6_family = AF_INET6,
+	.sin6_addr = { { { 0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0,
+			   0, 0, 0, 0, 0, 0, 0, 0x2 } } },
+};
+
+static struct net_ipv6_hdr ipv6_hdr;
+static struct net_udp_hdr udp_hdr;
+
+static uintptr_t delivered_id;
+
+static enum net_verdict conn_cb(struct net_conn *conn,
+				struct net_pkt *pkt,
+				union net_ip_header *ip_hdr,
+				union net_proto_header *proto_hdr,
+				void *user_data)
+{
+	ARG_UNUSED(conn);
+	ARG_UNUSED(pkt);
+	ARG_UNUSED(ip_hdr);
+	ARG_UNUSED(proto_hdr);
+
+	delivered_id = POINTER_TO_UINT(user_data);
+
+	/* Keep the packet, it is reused for the next run */
+	return NET_OK;
+}
+
+static int register_conns(int count)
+{
+	int ret;
+
+	ret = net_conn_register(IPPROTO_UDP, AF_INET6, NULL,
+				(struct sockaddr *)&local, 0, LOCAL_PORT,
+				NULL, conn_cb, UINT_TO_POINTER(WILDCARD_ID),
+				&handles[0]);
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (int i = 1; i < count; i++) {
+		ret = net_conn_register(IPPROTO_UDP, AF_INET6,
+					(struct sockaddr *)&remote,
+					(struct sockaddr *)&local,
+					REMOTE_PORT_BASE + i, LOCAL_PORT,
+					NULL, conn_cb, UINT_TO_POINTER(i),
+					&handles[i]);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static void unregister_conns(int count)
+{
+	for (int i = 0; i < count; i++) {
+		(void)net_conn_unregister(handles[i]);
+	}
+}
+
+static uint32_t run_input(struct net_pkt *pkt, uint16_t src_port,
+			  uintptr_t expected_id)
+{
+	union net_ip_header ip_hdr = { .ipv6 = &ipv6_hdr };
+	union net_proto_header proto_hdr = { .udp = &udp_hdr };
+	uint32_t t0, t1;
+
+	udp_hdr.src_port = htons(src_port);
+	delivered_id = UINTPTR_MAX;
+
+	t0 = k_cycle_get_32();
+
+	for (int i = 0; i < N_RUNS; i++) {
+		(void)net_conn_input(pkt, &ip_hdr, IPPROTO_UDP, &proto_hdr);
+	}
+
+	t1 = k_cycle_get_32();
+
+	if (delivered_id != expected_id) {
+		printk("packet delivered to connection %lu instead of %lu\n",
+		       (unsigned long)delivered_id, (unsigned long)expected_id);
+	}
+
+	return (t1 - t0) / N_RUNS;
+}
+
+int main(void)
+{
+	struct net_pkt *pkt;
+
+	pkt = net_pkt_alloc_on_iface(net_if_get_default(), K_FOREVER);
+	net_pkt_set_family(pkt, AF_INET6);
+
+	memcpy(ipv6_hdr.src, &remote.sin6_addr, sizeof(ipv6_hdr.src));
+	memcpy(ipv6_hdr.dst, &local.sin6_addr, sizeof(ipv6_hdr.dst));
+	ipv6_hdr.nexthdr = IPPROTO_UDP;
+	udp_hdr.dst_port = htons(LOCAL_PORT);
+
+	for (int i = 0; i < ARRAY_SIZE(counts); i++) {
+		uint32_t exact, wildcard;
+
+		if (register_conns(counts[i]) < 0) {
+			printk("cannot register %d connections\n", counts[i]);
+			break;
+		}
+
+		exact = run_input(pkt, REMOTE_PORT_BASE + 1, 1);
+		wildcard = run_input(pkt, UNKNOWN_PORT, WILDCARD_ID);
+
+		unregister_conns(counts[i]);
+
+		printk("conns %4d exact %4u wildcard %4u\n", counts[i],
+		       exact, wildcard);
+	}
+
+	net_pkt_unref(pkt);
+
+	printk("fin\n");
+	return 0;
+}
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2024 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/net/socket.h>
+
+/* This is an end-to-end benchmark of the network stack.  Packets are
+ * sent through a socket to another socket over the loopback interface,
+ * so every packet goes down the whole transmit path, through the
+ * loopback driver and up the whole receive path, and its payload is
+ * copied in and out of the sockets.  No link is involved, so the
+ * result only depends on the stack.  The average number of cycles from
+ * sending a packet to receiving it is reported for UDP and TCP over
+ * IPv4 and IPv6, along with the resulting packet rate.
+ */
+
+#define N_WARMUP 10
+#define N_RUNS 1000
+#define PAYLOAD_SIZE 64
+
+/* Every run uses new ports, so that no connection of a previous run can
+ * get in the way.
+ */
+#define PORT_BASE 4242
+
+static uint16_t next_port = PORT_BASE;
+
+static uint8_t tx_payload[PAYLOAD_SIZE];
+static uint8_t rx_payload[PAYLOAD_SIZE];
+
+static void fill_addr(struct sockaddr *addr, socklen_t *addrlen,
+		      sa_family_t family, uint16_t port)
+{
+	memset(addr, 0, sizeof(struct sockaddr));
+
+	if (family == AF_INET) {
+		struct sockaddr_in *addr4 = net_sin(addr);
+
+		addr4->sin_family = AF_INET;
+		addr4->sin_port = htons(port);
+		addr4->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+		*addrlen = sizeof(struct sockaddr_in);
+	} else {
+		struct sockaddr_in6 *addr6 = net_sin6(addr);
+
+		addr6->sin6_family = AF_INET6;
+		addr6->sin6_port = htons(port);
+		net_ipaddr_copy(&addr6->sin6_addr, &in6addr_loopback);
+		*addrlen = sizeof(struct sockaddr_in6);
+	}
+}
+
+static int recv_all(int sock)
+{
+	size_t received = 0;
+	ssize_t ret;
+
+	while (received < PAYLOAD_SIZE) {
+		ret = zsock_recv(sock, &rx_payload[received],
+				 PAYLOAD_SIZE - received, 0);
+		if (ret <= 0) {
+			return ret < 0 ? -errno : -ECONNRESET;
+		}
+
+		received += ret;
+	}
+
+	return 0;
+}
+
+static int transfer(int tx_sock, int rx_sock, int count)
+{
+	ssize_t ret;
+
+	for (int i = 0; i < count; i++) {
+		ret = zsock_send(tx_sock, tx_payload, PAYLOAD_SIZE, 0);
+		if (ret != PAYLOAD_SIZE) {
+			return ret < 0 ? -errno : -EIO;
+		}
+
+		ret = recv_all(rx_sock);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
+static int open_udp(sa_family_t family, int *tx_sock, int *rx_sock)
+{
+	struct sockaddr server_addr, client_addr;
+	socklen_t server_len, client_len;
+
+	fill_addr(&server_addr, &server_len, family, next_port++);
+	fill_addr(&client_addr, &client_len, family, next_port++);
+
+	*rx_sock = zsock_socket(family, SOCK_DGRAM, IPPROTO_UDP);
+	*tx_sock = zsock_socket(family, SOCK_DGRAM, IPPROTO_UDP);
+	if (*rx_sock < 0 || *tx_sock < 0) {
+		return -errno;
+	}
+
+	if (zsock_bind(*rx_sock, &server_addr, server_len) < 0 ||
+	    zsock_bind(*tx_sock, &client_addr, client_len) < 0 ||
+	    zsock_connect(*tx_sock, &server_addr, server_len) < 0) {
+		return -errno;
+	}
+
+	return 0;
+}
+
+static int open_tcp(sa_family_t family, int *tx_sock, int *rx_sock)
+{
+	struct sockaddr server_addr;
+	socklen_t server_len;
+	int listen_sock;
+	int opt = 1;
+
+	fill_addr(&server_addr, &server_len, family, next_port++);
+
+	listen_sock = zsock_socket(family, SOCK_STREAM, IPPROTO_TCP);
+	*tx_sock = zsock_socket(family, SOCK_STREAM, IPPROTO_TCP);
+	if (listen_sock < 0 || *tx_sock < 0) {
+		return -errno;
+	}
+
+	if (zsock_bind(listen_sock, &server_addr, server_len) < 0 ||
+	    zsock_listen(listen_sock, 1) < 0 ||
+	    zsock_connect(*tx_sock, &server_addr, server_len) < 0) {
+		(void)zsock_close(listen_sock);
+		return -errno;
+	}
+
+	*rx_sock = zsock_accept(listen_sock, NULL, NULL);
+	(void)zsock_close(listen_sock);
+	if (*rx_sock < 0) {
+		return -errno;
+	}
+
+	/* Send every packet right away */
+	(void)zsock_setsockopt(*tx_sock, IPPROTO_TCP, TCP_NODELAY, &opt,
+			       sizeof(opt));
+
+	return 0;
+}
+
+static void run(const char *name, sa_family_t family, int type)
+{
+	int tx_sock = -1, rx_sock = -1;
+	uint32_t t0, t1, cycles;
+	int ret;
+
+	if (type == SOCK_DGRAM) {
+		ret = open_udp(family, &tx_sock, &rx_sock);
+	} else {
+		ret = open_tcp(family, &tx_sock, &rx_sock);
+	}
+
+	if (ret == 0) {
+		ret = transfer(tx_sock, rx_sock, N_WARMUP);
+	}
+
+	if (ret == 0) {
+		t0 = k_cycle_get_32();
+		ret = transfer(tx_sock, rx_sock, N_RUNS);
+		t1 = k_cycle_get_32();
+	}
+
+	if (tx_sock >= 0) {
+		(void)zsock_close(tx_sock);
+	}
+
+	if (rx_sock >= 0) {
+		(void)zsock_close(rx_sock);
+	}
+
+	if (ret < 0) {
+		printk("%s failed (%d)\n", name, ret);
+		return;
+	}
+
+	cycles = (t1 - t0) / N_RUNS;
+
+	printk("%s %6u cycles/pkt %7u pkt/s\n", name, cycles,
+	       (uint32_t)(sys_clock_hw_cycles_per_sec() / MAX(cycles, 1)));
+}
+
+int main(void)
+{
+	for (int i = 0; i < PAYLOAD_SIZE; i++) {
+		tx_payload[i] = i;
+	}
+
+	run("udp ipv4", AF_INET, SOCK_DGRAM);
+	run("udp ipv6", AF_INET6, SOCK_DGRAM);
+	run("tcp ipv4", AF_INET, SOCK_STREAM);
+	run("tcp ipv6", AF_INET6, SOCK_STREAM);
+
+	printk("fin\n");
+	return 0;
+}
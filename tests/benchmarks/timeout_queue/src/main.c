@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <timeout_q.h>
+
+/* This is a timeout queue microbenchmark.  It fills the kernel
+ * timeout queue with a given number of pending timeouts, then
+ * repeatedly adds one more timeout with z_add_timeout() and removes
+ * it again with z_abort_timeout(), reporting the average latency of
+ * each operation.  The pending timeouts expire far in the future so
+ * that no expiry processing interferes with the measurement.
+ */
+
+#define MAX_PENDING 1000
+#define N_RUNS 100
+#define N_SETTLE 10
+
+/* All timeouts expire at least this many ticks from now */
+#define BASE_TICKS 1000000
+
+static struct _timeout pending[MAX_PENDING];
+static struct _timeout probe;
+
+static const int depths[] = { 10, 100, MAX_PENDING };
+
+static uint32_t rand_state = 1U;
+
+/* Deterministic LCG, so that each backend sees the same sequence */
+static uint32_t next_rand(void)
+{
+	rand_state = rand_state * 1103515245U + 12345U;
+	return (rand_state >> 16) & 0x7fffU;
+}
+
+static void dummy_fn(struct _timeout *t)
+{
+	ARG_UNUSED(t);
+}
+
+static k_timeout_t random_timeout(void)
+{
+	return K_TICKS(BASE_TICKS + next_rand());
+}
+
+static void run_depth(int depth)
+{
+	uint64_t tot_add = 0U, tot_abort = 0U;
+
+	for (int i = 0; i < depth; i++) {
+		z_init_timeout(&pending[i]);
+		z_add_timeout(&pending[i], dummy_fn, random_timeout());
+	}
+
+	for (int i = 0; i < N_RUNS + N_SETTLE; i++) {
+		k_timeout_t timeout = random_timeout();
+		unsigned int key = irq_lock();
+		uint32_t t0, t1, t2;
+
+		t0 = k_cycle_get_32();
+		z_add_timeout(&probe, dummy_fn, timeout);
+		t1 = k_cycle_get_32();
+		z_abort_timeout(&probe);
+		t2 = k_cycle_get_32();
+
+		irq_unlock(key);
+
+		/* Let cache effects in the host settle before
+		 * accumulating results
+		 */
+		if (i >= N_SETTLE) {
+			tot_add += t1 - t0;
+			tot_abort += t2 - t1;
+		}
+	}
+
+	for (int i = 0; i < depth; i++) {
+		z_abort_timeout(&pending[i]);
+	}
+
+	printk("pending %4d insert %4u abort %4u\n", depth,
+	       (uint32_t)(tot_add / N_RUNS), (uint32_t)(tot_abort / N_RUNS));
+}
+
+int main(void)
+{
+	z_init_timeout(&probe);
+
+	for (int i = 0; i < ARRAY_SIZE(depths); i++) {
+		run_depth(depths[i]);
+	}
+
+	printk("fin\n");
+	return 0;
+}
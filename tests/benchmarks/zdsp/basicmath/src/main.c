@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Benchmark of the zDSP basic math functions, to compare the backends
+ * available for a target. The inputs are pseudo-random as only the time
+ * spent matters.
+ */
+
+#include <zephyr/dsp/dsp.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include "benchmark_common.h"
+
+#define PATTERN_LENGTH	(256)
+
+static DSP_DATA q7_t in_q7[2][PATTERN_LENGTH];
+static DSP_DATA q15_t in_q15[2][PATTERN_LENGTH];
+static DSP_DATA q31_t in_q31[2][PATTERN_LENGTH];
+static DSP_DATA float32_t in_f32[2][PATTERN_LENGTH];
+
+static DSP_DATA q7_t out_q7[PATTERN_LENGTH];
+static DSP_DATA q15_t out_q15[PATTERN_LENGTH];
+static DSP_DATA q31_t out_q31[PATTERN_LENGTH];
+static DSP_DATA float32_t out_f32[PATTERN_LENGTH];
+
+static DSP_DATA q31_t result_q31;
+static DSP_DATA q63_t result_q63;
+static DSP_DATA float32_t result_f32;
+
+/* Time a single call and print it */
+#define BENCHMARK(call)                                                                            \
+	do {                                                                                       \
+		uint32_t irq_key, timestamp, timespan;                                             \
+                                                                                                   \
+		benchmark_begin(&irq_key, &timestamp);                                             \
+		call;                                                                              \
+		timespan = benchmark_end(irq_key, timestamp);                                      \
+                                                                                                   \
+		TC_PRINT(BENCHMARK_TYPE " = %u\n", timespan);                                      \
+	} while (false)
+
+ZTEST(zdsp_basicmath_benchmark, test_benchmark_vec_add)
+{
+	BENCHMARK(zdsp_add_q7(in_q7[0], in_q7[1], out_q7, PATTERN_LENGTH));
+	BENCHMARK(zdsp_add_q15(in_q15[0], in_q15[1], out_q15, PATTERN_LENGTH));
+	BENCHMARK(zdsp_add_q31(in_q31[0], in_q31[1], out_q31, PATTERN_LENGTH));
+	BENCHMARK(zdsp_add_f32(in_f32[0], in_f32[1], out_f32, PATTERN_LENGTH));
+}
+
+ZTEST(zdsp_basicmath_benchmark, test_benchmark_vec_mult)
+{
+	BENCHMARK(zdsp_mult_q7(in_q7[0], in_q7[1], out_q7, PATTERN_LENGTH));
+	BENCHMARK(zdsp_mult_q15(in_q15[0], in_q15[1], out_q15, PATTERN_LENGTH));
+	BENCHMARK(zdsp_mult_q31(in_q31[0], in_q31[1], out_q31, PATTERN_LENGTH));
+	BENCHMARK(zdsp_mult_f32(in_f32[0], in_f32[1], out_f32, PATTERN_LENGTH));
+}
+
+ZTEST(zdsp_basicmath_benchmark, test_benchmark_vec_scale)
+{
+	BENCHMARK(zdsp_scale_q7(in_q7[0], 0x40, 0, out_q7, PATTERN_LENGTH));
+	BENCHMARK(zdsp_scale_q15(in_q15[0], 0x4000, 0, out_q15, PATTERN_LENGTH));
+	BENCHMARK(zdsp_scale_q31(in_q31[0], 0x40000000, 0, out_q31, PATTERN_LENGTH));
+	BENCHMARK(zdsp_scale_f32(in_f32[0], 0.5f, out_f32, PATTERN_LENGTH));
+}
+
+ZTEST(zdsp_basicmath_benchmark, test_benchmark_vec_dot_prod)
+{
+	BENCHMARK(zdsp_dot_prod_q7(in_q7[0], in_q7[1], PATTERN_LENGTH, &result_q31));
+	BENCHMARK(zdsp_dot_prod_q15(in_q15[0], in_q15[1], PATTERN_LENGTH, &result_q63));
+	BENCHMARK(zdsp_dot_prod_q31(in_q31[0], in_q31[1], PATTERN_LENGTH, &result_q63));
+	BENCHMARK(zdsp_dot_prod_f32(in_f32[0], in_f32[1], PATTERN_LENGTH, &result_f32));
+}
+
+static void *zdsp_basicmath_benchmark_setup(void)
+{
+	uint32_t seed = 1;
+
+	for (size_t i = 0; i < 2; i++) {
+		for (size_t j = 0; j < PATTERN_LENGTH; j++) {
+			seed = seed * 1664525U + 1013904223U;
+
+			in_q31[i][j] = (q31_t)seed;
+			in_q15[i][j] = (q15_t)(seed >> 16);
+			in_q7[i][j] = (q7_t)(seed >> 24);
+			in_f32[i][j] = (float32_t)in_q15[i][j] / 32768.0f;
+		}
+	}
+
+	return NULL;
+}
+
+ZTEST_SUITE(zdsp_basicmath_benchmark, NULL, zdsp_basicmath_benchmark_setup, NULL, NULL, NULL);
@@ -8444,3 +8444,80 @@ ZTEST(test_tx_framed_ebq, test_tx_framed_cis_fra_per_bv07c)
 			      pdu_write_size,
 			      isoal_global.source_state[source_hdl].session.handle);
 }
+
+#if defined(CONFIG_BT_CTLR_ISOAL_PROFILE)
+/**
+ * Test Suite  :   TX basic test
+ *
+ * Tests that the TX path profile counts the SDU fragments processed and the
+ * PDUs emitted, and that it cannot be read for an invalid source.
+ */
+ZTEST(test_tx_basics, test_source_isoal_test_profile)
+{
+	uint8_t testdata[TEST_TX_PDU_PAYLOAD_MAX - 5];
+	struct tx_pdu_meta_buffer tx_pdu_meta_buf;
+	struct tx_sdu_frag_buffer tx_sdu_frag_buf;
+	struct isoal_tx_profile profile;
+	struct isoal_pdu_buffer pdu_buffer;
+	isoal_source_handle_t source_hdl;
+	uint32_t sdu_timestamp;
+	isoal_status_t err;
+
+	isoal_test_init_tx_pdu_buffer(&tx_pdu_meta_buf);
+	isoal_test_init_tx_sdu_buffer(&tx_sdu_frag_buf);
+	init_test_data_buffer(testdata, sizeof(testdata));
+	pdu_buffer.handle = (void *)&tx_pdu_meta_buf.node_tx;
+	pdu_buffer.pdu = (struct pdu_iso *)tx_pdu_meta_buf.node_tx.pdu;
+	pdu_buffer.size = TEST_TX_PDU_PAYLOAD_MAX;
+	sdu_timestamp = 9249;
+
+	source_hdl = basic_tx_test_setup(0xADAD,                        /* Handle */
+					 ISOAL_ROLE_PERIPHERAL,         /* Role */
+					 false,                         /* Framed */
+					 1,                             /* BN */
+					 1,                             /* FT */
+					 sizeof(testdata),              /* max_octets */
+					 ISO_INT_UNIT_US,               /* SDU Interval */
+					 1,                             /* ISO Interval */
+					 ISO_INT_UNIT_US - 200,         /* Stream Sync Delay */
+					 ISO_INT_UNIT_US - 50);         /* Group Sync Delay */
+
+	err = isoal_tx_get_profile(source_hdl, &profile);
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+	zassert_equal(profile.sdu_frags, 0U);
+	zassert_equal(profile.pdus, 0U);
+
+	isoal_test_create_sdu_fagment(BT_ISO_SINGLE,
+				      testdata,
+				      sizeof(testdata),
+				      sizeof(testdata),
+				      2000,
+				      sdu_timestamp,
+				      sdu_timestamp,
+				      sdu_timestamp + ISO_INT_UNIT_US - 50,
+				      2000,
+				      &tx_sdu_frag_buf.sdu_tx);
+
+	SET_NEXT_PDU_ALLOC_BUFFER(&pdu_buffer);
+	PDU_ALLOC_TEST_RETURNS(ISOAL_STATUS_OK);
+	PDU_WRITE_TEST_RETURNS(ISOAL_STATUS_OK);
+	PDU_EMIT_TEST_RETURNS(ISOAL_STATUS_OK);
+	PDU_RELEASE_TEST_RETURNS(ISOAL_STATUS_OK);
+
+	err = isoal_tx_sdu_fragment(source_hdl, &tx_sdu_frag_buf.sdu_tx);
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+
+	err = isoal_tx_get_profile(source_hdl, &profile);
+	zassert_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+	zassert_equal(profile.sdu_frags, 1U);
+	zassert_equal(profile.pdus, 1U);
+	zassert_equal(profile.cycles_min, profile.cycles_last);
+	zassert_equal(profile.cycles_max, profile.cycles_last);
+	zassert_equal(profile.cycles_total, profile.cycles_last);
+
+	isoal_source_destroy(source_hdl);
+
+	err = isoal_tx_get_profile(source_hdl, &profile);
+	zassert_not_equal(err, ISOAL_STATUS_OK, "err = 0x%02x", err);
+}
+#endif /* CONFIG_BT_CTLR_ISOAL_PROFILE */
@@ -230,6 +230,61 @@ ZTEST(test_gatt, test_gatt_foreach)
 	}
 }
 
+static uint8_t check_order(const struct bt_gatt_attr *attr, uint16_t handle,
+			   void *user_data)
+{
+	uint16_t *last = user_data;
+
+	zassert_true(handle > *last, "Attribute handles out of order");
+	*last = handle;
+
+	return BT_GATT_ITER_CONTINUE;
+}
+
+ZTEST(test_gatt, test_gatt_foreach_order)
+{
+	/* Characteristic declaration UUID in its Bluetooth Base UUID form */
+	struct bt_uuid_128 chrc_uuid = BT_UUID_INIT_128(
+		BT_UUID_128_ENCODE(BT_UUID_GATT_CHRC_VAL, 0x0000, 0x1000,
+				   0x8000, 0x00805f9b34fb));
+	uint16_t last = 0;
+	uint16_t num = 0;
+
+	/* Re-register so the database is changed under the lookups */
+	zassert_false(bt_gatt_service_unregister(&test_svc),
+		     "Test service unregister failed");
+	zassert_false(bt_gatt_service_register(&test_svc),
+		     "Test service registration failed");
+
+	/* Attributes are reported in handle order */
+	bt_gatt_foreach_attr(0x0001, 0xffff, check_order, &last);
+	zassert_equal(last, test1_attrs[ARRAY_SIZE(test1_attrs) - 1].handle,
+		      "Last attribute handle don't match");
+
+	last = 0;
+	bt_gatt_foreach_attr_type(0x0001, 0xffff, BT_UUID_GATT_CHRC, NULL, 0,
+				  check_order, &last);
+	zassert_equal(last, test1_attrs[1].handle,
+		      "Last characteristic handle don't match");
+
+	/* Both UUID forms find the same characteristics */
+	bt_gatt_foreach_attr_type(test_attrs[0].handle, 0xffff,
+				  &chrc_uuid.uuid, NULL, 0, count_attr, &num);
+	zassert_equal(num, 2, "Number of attributes don't match");
+
+	/* Lookups no longer see an unregistered service */
+	zassert_false(bt_gatt_service_unregister(&test1_svc),
+		     "Test service1 unregister failed");
+
+	num = 0;
+	bt_gatt_foreach_attr_type(test_attrs[0].handle, 0xffff,
+				  BT_UUID_GATT_CHRC, NULL, 0, count_attr, &num);
+	zassert_equal(num, 1, "Number of attributes don't match");
+
+	zassert_false(bt_gatt_service_register(&test1_svc),
+		     "Test service1 registration failed");
+}
+
 ZTEST(test_gatt, test_gatt_read)
 {
 	const struct bt_gatt_attr *attr;
@@ -312,6 +312,75 @@ ZTEST(flash_sim_api, test_get_mock)
 #endif
 }
 
+#ifdef CONFIG_FLASH_ASYNC
+static int async_cb_result;
+static int async_cb_count;
+
+static void async_cb(const struct device *dev, struct flash_async_op *op,
+		     int result)
+{
+	zassert_equal(dev, flash_dev, "Unexpected device");
+	async_cb_result = result;
+	async_cb_count++;
+}
+#endif
+
+ZTEST(flash_sim_api, test_async)
+{
+#ifndef CONFIG_FLASH_ASYNC
+	ztest_test_skip();
+#else
+	static uint32_t wbuf[FLASH_SIMULATOR_PROG_UNIT];
+	struct k_poll_signal signal;
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &signal);
+	struct flash_async_op erase = {
+		.type = FLASH_ASYNC_ERASE,
+		.offset = FLASH_SIMULATOR_BASE_OFFSET,
+		.len = FLASH_SIMULATOR_ERASE_UNIT,
+		.cb = async_cb,
+	};
+	struct flash_async_op write = {
+		.type = FLASH_ASYNC_WRITE,
+		.offset = FLASH_SIMULATOR_BASE_OFFSET,
+		.data = wbuf,
+		.len = sizeof(wbuf),
+		.signal = &signal,
+	};
+	unsigned int signaled;
+	int result;
+	int rc;
+
+	for (size_t i = 0; i < ARRAY_SIZE(wbuf); i++) {
+		wbuf[i] = 0xA5A50000 + i;
+	}
+
+	k_poll_signal_init(&signal);
+	async_cb_count = 0;
+
+	/* Operations are executed in submission order */
+	rc = flash_async_submit(flash_dev, &erase);
+	zassert_equal(0, rc, "flash_async_submit should succeed");
+	rc = flash_async_submit(flash_dev, &write);
+	zassert_equal(0, rc, "flash_async_submit should succeed");
+
+	rc = k_poll(&event, 1, K_SECONDS(5));
+	zassert_equal(0, rc, "Write completion not signaled");
+	k_poll_signal_check(&signal, &signaled, &result);
+	zassert_equal(0, result, "Async write failed (%d)", result);
+	zassert_equal(1, async_cb_count, "Erase completion not reported");
+	zassert_equal(0, async_cb_result, "Async erase failed");
+
+	pattern32_ini(0xA5A50000);
+	test_check_pattern32(FLASH_SIMULATOR_BASE_OFFSET, pattern32_inc,
+			     sizeof(wbuf));
+
+	erase.type = (enum flash_async_op_type)-1;
+	rc = flash_async_submit(flash_dev, &erase);
+	zassert_equal(-EINVAL, rc, "Invalid operation should be rejected");
+#endif
+}
+
 void *flash_sim_setup(void)
 {
 	test_init();
@@ -12,6 +12,8 @@
 #include <zephyr/fff.h>
 #include <zephyr/ztest.h>
 
+#include "icm42688.h"
+#include "icm42688_decoder.h"
 #include "icm42688_emul.h"
 #include "icm42688_reg.h"
 
@@ -240,3 +242,61 @@ ZTEST_F(icm42688, test_interrupt)
 	/* Verify the handler was called */
 	zassert_equal(test_interrupt_trigger_handler_fake.call_count, 1);
 }
+
+ZTEST_F(icm42688, test_decode_fifo)
+{
+	struct {
+		struct icm42688_fifo_data hdr;
+		uint8_t packets[3][ICM42688_FIFO_PACKET_SIZE];
+	} __packed buffer = {
+		.hdr = {
+			.header = {
+				.timestamp = 1000000000,
+				.is_fifo = true,
+				.accel_fs = ICM42688_ACCEL_FS_16G,
+				.gyro_fs = ICM42688_GYRO_FS_2000,
+			},
+			.int_status = BIT_INT_STATUS_FIFO_THS,
+			.accel_odr = ICM42688_ACCEL_ODR_4000,
+			.gyro_odr = ICM42688_GYRO_ODR_4000,
+			.fifo_count = 3 * ICM42688_FIFO_PACKET_SIZE,
+		},
+	};
+	const struct sensor_decoder_api *decoder;
+	struct sensor_three_axis_data *accel;
+	uint8_t accel_buf[sizeof(*accel) + 2 * sizeof(accel->readings[0])];
+	uint16_t frame_count;
+	uint32_t fit = 0;
+
+	/* Accel X = 0.5 * 16g, the second packet is empty */
+	for (int i = 0; i < ARRAY_SIZE(buffer.packets); i++) {
+		buffer.packets[i][0] = FIFO_HEADER_ACCEL | FIFO_HEADER_GYRO;
+		sys_put_be16(INT16_MAX / 2, &buffer.packets[i][1]);
+	}
+	buffer.packets[1][0] = FIFO_HEADER_EMPTY;
+
+	zassert_ok(sensor_get_decoder(fixture->dev, &decoder));
+	zassert_true(decoder->has_trigger((uint8_t *)&buffer, SENSOR_TRIG_FIFO_WATERMARK));
+	zassert_false(decoder->has_trigger((uint8_t *)&buffer, SENSOR_TRIG_FIFO_FULL));
+	zassert_ok(decoder->get_frame_count((uint8_t *)&buffer, SENSOR_CHAN_ACCEL_XYZ, 0,
+					    &frame_count));
+	zassert_equal(3, frame_count);
+
+	/* All valid packets are decoded in a single call */
+	accel = (struct sensor_three_axis_data *)accel_buf;
+	zassert_equal(2, decoder->decode((uint8_t *)&buffer, SENSOR_CHAN_ACCEL_XYZ, 0, &fit, 3,
+					 accel));
+	zassert_equal(2, accel->header.reading_count);
+	zassert_equal(1000000000 - 2 * 250000, accel->header.base_timestamp_ns);
+	zassert_equal(0, accel->readings[0].timestamp_delta);
+	zassert_equal(2 * 250000, accel->readings[1].timestamp_delta);
+
+	/* 8g in m/s2 with the accel shift for 16g */
+	zassert_within(8 * SENSOR_G * (INT64_C(1) << (31 - accel->shift)) / 1000000,
+		       accel->readings[0].x, 1 << 16);
+	zassert_equal(accel->readings[0].x, accel->readings[1].x);
+	zassert_equal(0, accel->readings[0].y);
+
+	zassert_equal(0, decoder->decode((uint8_t *)&buffer, SENSOR_CHAN_ACCEL_XYZ, 0, &fit, 3,
+					 accel));
+}
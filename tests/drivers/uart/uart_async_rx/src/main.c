@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/uart.h>
+#include <zephyr/drivers/serial/uart_async_rx.h>
+#include <zephyr/drivers/uart/serial_test.h>
+#include <zephyr/ztest.h>
+
+#define BUF_CNT 3
+#define BUF_LEN 8
+
+static const struct device *const uart_dev = DEVICE_DT_GET(DT_NODELABEL(test_uart));
+
+UART_ASYNC_RX_DEFINE(async_rx, BUF_CNT, BUF_LEN);
+
+static uint8_t pattern;
+
+static void uart_callback(const struct device *dev, struct uart_event *evt, void *user_data)
+{
+	uart_async_rx_on_event(user_data, evt);
+}
+
+static void send_data(size_t len)
+{
+	uint8_t tx[BUF_CNT * BUF_LEN * 2];
+
+	zassert_true(len <= sizeof(tx));
+
+	for (size_t i = 0; i < len; i++) {
+		tx[i] = pattern++;
+	}
+
+	zassert_equal(serial_vnd_queue_in_data(uart_dev, tx, len), len);
+}
+
+/* Read and check up to len bytes, returns the number of bytes read */
+static size_t read_data(uint8_t *expected, size_t len)
+{
+	size_t total = 0;
+	uint8_t *data;
+	size_t chunk;
+
+	while (total < len) {
+		chunk = MIN(uart_async_rx_data_peek(&async_rx, &data), len - total);
+		if (chunk == 0) {
+			break;
+		}
+
+		for (size_t i = 0; i < chunk; i++) {
+			zassert_equal(data[i], (*expected)++, "Unexpected byte at %zu", total + i);
+		}
+
+		zassert_ok(uart_async_rx_data_release(&async_rx, chunk));
+		total += chunk;
+	}
+
+	return total;
+}
+
+ZTEST(uart_async_rx, test_peek_release)
+{
+	uint8_t expected = pattern;
+	uint8_t *data;
+
+	send_data(BUF_LEN / 2);
+	zassert_equal(read_data(&expected, 1), 1);
+	zassert_equal(read_data(&expected, BUF_LEN), BUF_LEN / 2 - 1);
+	zassert_equal(uart_async_rx_data_peek(&async_rx, &data), 0);
+
+	/* Data spanning two buffers */
+	send_data(BUF_LEN + 1);
+	zassert_equal(read_data(&expected, BUF_LEN + 1), BUF_LEN + 1);
+	zassert_equal(uart_async_rx_data_peek(&async_rx, &data), 0);
+}
+
+ZTEST(uart_async_rx, test_wrap)
+{
+	uint8_t expected = pattern;
+
+	/* Go around the ring of buffers a few times */
+	for (int i = 0; i < 4 * BUF_CNT; i++) {
+		send_data(BUF_LEN - 1);
+		zassert_equal(read_data(&expected, BUF_LEN), BUF_LEN - 1);
+	}
+}
+
+ZTEST(uart_async_rx, test_restart_after_overflow)
+{
+	uint8_t expected = pattern;
+	const size_t len = BUF_CNT * BUF_LEN + BUF_LEN / 2;
+
+	/* More than the ring can hold, reception stops until buffers are released */
+	send_data(len);
+	zassert_equal(read_data(&expected, len), len);
+}
+
+static void *uart_async_rx_setup(void)
+{
+	zassert_true(device_is_ready(uart_dev));
+	zassert_ok(uart_callback_set(uart_dev, uart_callback, &async_rx));
+	zassert_ok(uart_async_rx_enable(&async_rx, uart_dev, SYS_FOREVER_MS));
+	zassert_equal(uart_async_rx_enable(&async_rx, uart_dev, SYS_FOREVER_MS), -EBUSY);
+
+	return NULL;
+}
+
+ZTEST_SUITE(uart_async_rx, NULL, uart_async_rx_setup, NULL, NULL, NULL);
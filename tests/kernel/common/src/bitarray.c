@@ -492,6 +492,63 @@ void alloc_and_free_interval(void)
 	}
 }
 
+void alloc_and_free_multi(void)
+{
+	int ret;
+	size_t offsets[4];
+	size_t bad_offsets[2];
+
+	uint32_t ba_128_expected[4];
+
+	SYS_BITARRAY_DEFINE(ba_128, 128);
+
+	printk("Testing bit array multiple alloc and free\n");
+
+	/* Free runs of 3, 2, 4 and 4 bits */
+	ba_128.bundles[0] = 0xFFFFFF1F;
+	ba_128.bundles[1] = 0xFFF87FF9;
+	ba_128.bundles[2] = 0xFFFFFFFF;
+	ba_128.bundles[3] = 0x0FFFFFFF;
+
+	ba_128_expected[0] = 0xFFFFFF1F;
+	ba_128_expected[1] = 0xFFF87FF9;
+	ba_128_expected[2] = 0xFFFFFFFF;
+	ba_128_expected[3] = 0x0FFFFFFF;
+
+	/* Only three regions of 3 bits fit, nothing must be allocated */
+	ret = sys_bitarray_alloc_multi(&ba_128, 3, 4, offsets);
+	zassert_equal(ret, -ENOSPC, "sys_bitarray_alloc_multi() should fail but not");
+	zassert_true(cmp_u32_arrays(ba_128.bundles, ba_128_expected, ba_128.num_bundles),
+		     "sys_bitarray_alloc_multi() failed bits comparison");
+
+	ret = sys_bitarray_alloc_multi(&ba_128, 3, 3, offsets);
+	ba_128_expected[0] = 0xFFFFFFFF;
+	ba_128_expected[1] = 0xFFFBFFF9;
+	ba_128_expected[3] = 0x7FFFFFFF;
+	zassert_equal(ret, 0, "sys_bitarray_alloc_multi() failed: %d", ret);
+	zassert_equal(offsets[0], 5, "offset expected %d, got %d", 5, offsets[0]);
+	zassert_equal(offsets[1], 47, "offset expected %d, got %d", 47, offsets[1]);
+	zassert_equal(offsets[2], 124, "offset expected %d, got %d", 124, offsets[2]);
+	zassert_true(cmp_u32_arrays(ba_128.bundles, ba_128_expected, ba_128.num_bundles),
+		     "sys_bitarray_alloc_multi() failed bits comparison");
+
+	/* The second region is given twice, nothing must be freed */
+	bad_offsets[0] = offsets[1];
+	bad_offsets[1] = offsets[1];
+	ret = sys_bitarray_free_multi(&ba_128, 3, 2, bad_offsets);
+	zassert_equal(ret, -EFAULT, "sys_bitarray_free_multi() should fail but not");
+	zassert_true(cmp_u32_arrays(ba_128.bundles, ba_128_expected, ba_128.num_bundles),
+		     "sys_bitarray_free_multi() failed bits comparison");
+
+	ret = sys_bitarray_free_multi(&ba_128, 3, 3, offsets);
+	ba_128_expected[0] = 0xFFFFFF1F;
+	ba_128_expected[1] = 0xFFF87FF9;
+	ba_128_expected[3] = 0x0FFFFFFF;
+	zassert_equal(ret, 0, "sys_bitarray_free_multi() failed: %d", ret);
+	zassert_true(cmp_u32_arrays(ba_128.bundles, ba_128_expected, ba_128.num_bundles),
+		     "sys_bitarray_free_multi() failed bits comparison");
+}
+
 /**
  * @brief Test bitarrays allocation and free
  *
@@ -517,6 +574,8 @@ ZTEST(bitarray, test_bitarray_alloc_free)
 	}
 
 	alloc_and_free_interval();
+
+	alloc_and_free_multi();
 }
 
 ZTEST(bitarray, test_bitarray_region_set_clear)
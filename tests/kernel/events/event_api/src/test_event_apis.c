@@ -72,6 +72,7 @@ ZTEST(events_api, test_k_event_init)
 
 	zassert_is_null(thread, NULL);
 	zassert_true(event.events == 0);
+	zassert_true(event.waiter_events == 0);
 }
 
 static void receive_existing_events(void)
@@ -431,3 +432,45 @@ ZTEST(events_api, test_event_receive)
 
 	test_wake_multiple_threads();
 }
+
+static K_SEM_DEFINE(waiter_sem, 0, 1);
+static volatile uint32_t waiter_events;
+
+static void entry_waiter(void *p1, void *p2, void *p3)
+{
+	struct k_event *event = p1;
+
+	waiter_events = k_event_wait_all(event, 0x5, false, LONG_TIMEOUT);
+	k_sem_give(&waiter_sem);
+}
+
+/**
+ * Test that posting events which are already set, or which no thread
+ * waits for, does not wake a waiting thread, and that the thread is
+ * still woken by the events it waits for afterwards.
+ */
+
+ZTEST(events_api, test_event_post_unwaited)
+{
+	static struct k_event  event;
+
+	k_event_init(&event);
+	k_event_post(&event, 0x1);
+
+	(void) k_thread_create(&textra1, sextra1, STACK_SIZE,
+			       entry_waiter, &event, NULL, NULL,
+			       K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	k_sleep(DELAY);
+
+	k_event_post(&event, 0x1);
+	k_event_post(&event, 0x10);
+	k_event_clear(&event, 0x10);
+	zassert_equal(k_sem_take(&waiter_sem, DELAY), -EAGAIN);
+
+	k_event_post(&event, 0x4);
+	zassert_ok(k_sem_take(&waiter_sem, LONG_TIMEOUT));
+	zassert_equal(waiter_events, 0x5);
+
+	k_thread_join(&textra1, K_FOREVER);
+}
@@ -338,3 +338,98 @@ ZTEST(mslab_api, test_mslab_pending)
 	/* Free memory block */
 	k_mem_slab_free(&kmslab, b);
 }
+
+/**
+ * @brief Verify batch allocation and free of blocks
+ *
+ * @details Allocate all blocks of the slab with one call of
+ * @see k_mem_slab_alloc_n(), check that they are distinct and
+ * accounted as used, that another batch allocation fails without
+ * side effects and that one oversized batch is rejected.  Then free
+ * them with @see k_mem_slab_free_n().
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_api, test_mslab_alloc_free_n)
+{
+	void *block[BLK_NUM], *extra[2];
+
+	zassert_equal(k_mem_slab_alloc_n(&mslab, block, BLK_NUM + 1, K_NO_WAIT),
+		      -EINVAL);
+
+	zassert_equal(k_mem_slab_alloc_n(&mslab, block, BLK_NUM, K_NO_WAIT), 0);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), BLK_NUM);
+	zassert_equal(k_mem_slab_num_free_get(&mslab), 0);
+	for (int i = 0; i < BLK_NUM; i++) {
+		zassert_true((char *)block[i] >= tslab &&
+			     (char *)block[i] < tslab + sizeof(tslab));
+		for (int j = 0; j < i; j++) {
+			zassert_not_equal(block[i], block[j]);
+		}
+	}
+
+	zassert_equal(k_mem_slab_alloc_n(&mslab, extra, 1, K_NO_WAIT), -ENOMEM);
+
+	/* All or nothing: a batch larger than what is free takes nothing */
+	k_mem_slab_free_n(&mslab, block, 2);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), BLK_NUM - 2);
+	zassert_equal(k_mem_slab_alloc_n(&mslab, block, BLK_NUM, K_NO_WAIT),
+		      -ENOMEM);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), BLK_NUM - 2);
+
+	zassert_equal(k_mem_slab_alloc_n(&mslab, extra, 2, K_NO_WAIT), 0);
+	k_mem_slab_free_n(&mslab, extra, 2);
+	k_mem_slab_free(&mslab, block[2]);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), 0);
+	zassert_equal(k_mem_slab_num_free_get(&mslab), BLK_NUM);
+}
+
+static void helper_thread_n(void *p0, void *p1, void *p2)
+{
+	void **block = p0;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+
+	/* Hand back two of the blocks, one at a time */
+	k_sleep(K_MSEC(10));
+	k_mem_slab_free(&mslab, block[0]);
+	k_sleep(K_MSEC(10));
+	k_mem_slab_free(&mslab, block[1]);
+}
+
+/**
+ * @brief Verify pending of batch allocations
+ *
+ * @details With one block free, a batch allocation of three blocks
+ * times out and returns the block it took.  Then a batch allocation
+ * with K_FOREVER waits for a helper thread to free two more blocks.
+ *
+ * @ingroup kernel_memory_slab_tests
+ */
+ZTEST(mslab_api, test_mslab_alloc_n_pending)
+{
+	if (!IS_ENABLED(CONFIG_MULTITHREADING)) {
+		ztest_test_skip();
+		return;
+	}
+
+	void *held[BLK_NUM - 1], *block[BLK_NUM];
+
+	zassert_equal(k_mem_slab_alloc_n(&mslab, held, BLK_NUM - 1, K_NO_WAIT), 0);
+
+	zassert_equal(k_mem_slab_alloc_n(&mslab, block, BLK_NUM, K_MSEC(20)),
+		      -EAGAIN);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), BLK_NUM - 1);
+
+	(void)k_thread_create(&HELPER, stack, STACKSIZE,
+			helper_thread_n, held, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	zassert_equal(k_mem_slab_alloc_n(&mslab, block, BLK_NUM, K_FOREVER), 0);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), BLK_NUM);
+
+	k_thread_join(&HELPER, K_FOREVER);
+	k_mem_slab_free_n(&mslab, block, BLK_NUM);
+	zassert_equal(k_mem_slab_num_used_get(&mslab), 0);
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/irq_offload.h>
+
+#define MSG_COUNT 4
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+K_SPSC_MSGQ_DEFINE(spsc_msgq, sizeof(uint32_t), MSG_COUNT, 4);
+
+static K_THREAD_STACK_DEFINE(producer_stack, STACK_SIZE);
+static struct k_thread producer_thread;
+
+static void put_isr(const void *arg)
+{
+	zassert_ok(k_spsc_msgq_put(&spsc_msgq, arg));
+}
+
+static void producer_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t count = (uint32_t)(uintptr_t)p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (uint32_t i = 0; i < count; i++) {
+		/* Let the queue run empty so that the consumer waits */
+		k_msleep(1);
+		irq_offload(put_isr, &i);
+	}
+}
+
+static void spsc_msgq_before(void *fixture)
+{
+	uint32_t msg;
+
+	ARG_UNUSED(fixture);
+
+	while (k_spsc_msgq_get(&spsc_msgq, &msg, K_NO_WAIT) == 0) {
+	}
+}
+
+ZTEST(spsc_msgq, test_put_get)
+{
+	uint32_t msg;
+
+	zassert_equal(k_spsc_msgq_get(&spsc_msgq, &msg, K_NO_WAIT), -ENOMSG);
+
+	/* Fill the queue more than once to wrap the indices */
+	for (uint32_t round = 0; round < 3; round++) {
+		for (uint32_t i = 0; i < MSG_COUNT; i++) {
+			msg = round * MSG_COUNT + i;
+			zassert_ok(k_spsc_msgq_put(&spsc_msgq, &msg));
+		}
+
+		zassert_equal(k_spsc_msgq_put(&spsc_msgq, &msg), -ENOMSG);
+		zassert_equal(k_spsc_msgq_num_used_get(&spsc_msgq), MSG_COUNT);
+
+		for (uint32_t i = 0; i < MSG_COUNT; i++) {
+			zassert_ok(k_spsc_msgq_get(&spsc_msgq, &msg, K_NO_WAIT));
+			zassert_equal(msg, round * MSG_COUNT + i);
+		}
+
+		zassert_equal(k_spsc_msgq_num_used_get(&spsc_msgq), 0);
+	}
+}
+
+ZTEST(spsc_msgq, test_get_timeout)
+{
+	uint32_t msg;
+
+	zassert_equal(k_spsc_msgq_get(&spsc_msgq, &msg, K_MSEC(10)), -EAGAIN);
+}
+
+/* Check that messages put from an ISR wake the waiting consumer */
+ZTEST(spsc_msgq, test_isr_to_thread)
+{
+	const uint32_t count = 3 * MSG_COUNT;
+	uint32_t msg;
+
+	k_thread_create(&producer_thread, producer_stack, STACK_SIZE,
+			producer_entry, (void *)(uintptr_t)count, NULL, NULL,
+			K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+
+	for (uint32_t i = 0; i < count; i++) {
+		zassert_ok(k_spsc_msgq_get(&spsc_msgq, &msg, K_MSEC(1000)));
+		zassert_equal(msg, i);
+	}
+
+	k_thread_join(&producer_thread, K_FOREVER);
+}
+
+ZTEST_SUITE(spsc_msgq, NULL, NULL, spsc_msgq_before, NULL, NULL);
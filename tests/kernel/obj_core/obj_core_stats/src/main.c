@@ -693,6 +693,175 @@ ZTEST(obj_core_stats_mem_slab, test_obj_core_stats_mem_slab)
 	k_mem_slab_free(&mem_slab, mem2);
 }
 
+/***************** WAIT TIMES *********************/
+
+K_SEM_DEFINE(wait_sem, 0, 1);
+K_MUTEX_DEFINE(wait_mutex);
+K_MSGQ_DEFINE(wait_msgq, sizeof(uint32_t), 1, 4);
+K_CONDVAR_DEFINE(wait_condvar);
+K_SEM_DEFINE(wait_owner_sem, 0, 1);
+
+static K_THREAD_STACK_DEFINE(wait_owner_stack, 1024 + CONFIG_TEST_EXTRA_STACK_SIZE);
+static struct k_thread wait_owner_thread;
+
+static void test_wait_query(const char *str, struct k_obj_core *obj_core,
+			    struct k_wait_stats_query *query)
+{
+	int  status;
+
+	status = k_obj_core_stats_query(obj_core, query, sizeof(*query));
+	zassert_equal(status, 0,
+		      "%s: Failed to get query stats (%d)\n", str, status);
+	zassert_true(query->p50 <= query->p99,
+		     "%s: p50 %u above p99 %u\n", str, query->p50, query->p99);
+	zassert_true(query->p99 <= query->max,
+		     "%s: p99 %u above max %u\n", str, query->p99, query->max);
+}
+
+static void test_wait_reset(const char *str, struct k_obj_core *obj_core)
+{
+	struct k_wait_stats_query query;
+	int  status;
+
+	status = k_obj_core_stats_reset(obj_core);
+	zassert_equal(status, 0, "%s: Expected 0, got %d\n", str, status);
+
+	test_wait_query(str, obj_core, &query);
+	zassert_equal(query.count, 0, "%s: Expected 0 waits, got %u\n",
+		      str, query.count);
+	zassert_equal(query.max, 0, "%s: Expected max 0, got %u\n",
+		      str, query.max);
+}
+
+ZTEST(obj_core_stats_wait, test_obj_core_stats_sem_wait)
+{
+	struct k_wait_stats_query query;
+	uint32_t tick_us = k_ticks_to_us_floor32(1);
+	int  status;
+
+	test_wait_reset("Reset", K_OBJ_CORE(&wait_sem));
+
+	/* Taking an available semaphore does not wait */
+
+	k_sem_give(&wait_sem);
+	status = k_sem_take(&wait_sem, K_FOREVER);
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+
+	test_wait_query("No wait", K_OBJ_CORE(&wait_sem), &query);
+	zassert_equal(query.count, 0, "Expected 0 waits, got %u\n",
+		      query.count);
+
+	/* Nine short waits and a long one, all timing out */
+
+	for (int i = 0; i < 9; i++) {
+		status = k_sem_take(&wait_sem, K_TICKS(1));
+		zassert_equal(status, -EAGAIN, "Expected %d, got %d\n",
+			      -EAGAIN, status);
+	}
+	status = k_sem_take(&wait_sem, K_TICKS(10));
+	zassert_equal(status, -EAGAIN, "Expected %d, got %d\n",
+		      -EAGAIN, status);
+
+	test_wait_query("Timeouts", K_OBJ_CORE(&wait_sem), &query);
+	zassert_equal(query.count, 10, "Expected 10 waits, got %u\n",
+		      query.count);
+	zassert_true(query.max >= 9 * tick_us,
+		     "Expected max of at least %u, got %u\n",
+		     9 * tick_us, query.max);
+	zassert_true(query.p50 < 5 * tick_us,
+		     "Expected p50 below %u, got %u\n", 5 * tick_us, query.p50);
+	zassert_equal(query.p99, query.max,
+		      "Expected p99 %u, got %u\n", query.max, query.p99);
+
+	test_wait_reset("Reset again", K_OBJ_CORE(&wait_sem));
+}
+
+static void wait_owner_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_mutex_lock(&wait_mutex, K_FOREVER);
+	k_sem_give(&wait_owner_sem);
+	k_sleep(K_TICKS(POINTER_TO_INT(p1)));
+	k_mutex_unlock(&wait_mutex);
+}
+
+ZTEST(obj_core_stats_wait, test_obj_core_stats_mutex_wait)
+{
+	struct k_wait_stats_query query;
+	uint32_t tick_us = k_ticks_to_us_floor32(1);
+	int  status;
+
+	test_wait_reset("Reset", K_OBJ_CORE(&wait_mutex));
+
+	k_thread_create(&wait_owner_thread, wait_owner_stack,
+			K_THREAD_STACK_SIZEOF(wait_owner_stack),
+			wait_owner_entry, INT_TO_POINTER(5), NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	k_sem_take(&wait_owner_sem, K_FOREVER);
+
+	/* Contended lock waits until the owner unlocks */
+
+	status = k_mutex_lock(&wait_mutex, K_FOREVER);
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	k_mutex_unlock(&wait_mutex);
+	k_thread_join(&wait_owner_thread, K_FOREVER);
+
+	test_wait_query("Contended", K_OBJ_CORE(&wait_mutex), &query);
+	zassert_equal(query.count, 1, "Expected 1 wait, got %u\n",
+		      query.count);
+	zassert_true(query.max >= 4 * tick_us,
+		     "Expected max of at least %u, got %u\n",
+		     4 * tick_us, query.max);
+	zassert_equal(query.average, query.max,
+		      "Expected average %u, got %u\n", query.max,
+		      query.average);
+}
+
+ZTEST(obj_core_stats_wait, test_obj_core_stats_msgq_wait)
+{
+	struct k_wait_stats_query query;
+	uint32_t data = 0;
+	int  status;
+
+	test_wait_reset("Reset", K_OBJ_CORE(&wait_msgq));
+
+	/* Get from the empty queue, then put into the full one */
+
+	status = k_msgq_get(&wait_msgq, &data, K_TICKS(1));
+	zassert_equal(status, -EAGAIN, "Expected %d, got %d\n",
+		      -EAGAIN, status);
+	status = k_msgq_put(&wait_msgq, &data, K_NO_WAIT);
+	zassert_equal(status, 0, "Expected 0, got %d\n", status);
+	status = k_msgq_put(&wait_msgq, &data, K_TICKS(1));
+	zassert_equal(status, -EAGAIN, "Expected %d, got %d\n",
+		      -EAGAIN, status);
+	k_msgq_purge(&wait_msgq);
+
+	test_wait_query("Timeouts", K_OBJ_CORE(&wait_msgq), &query);
+	zassert_equal(query.count, 2, "Expected 2 waits, got %u\n",
+		      query.count);
+}
+
+ZTEST(obj_core_stats_wait, test_obj_core_stats_condvar_wait)
+{
+	struct k_wait_stats_query query;
+	int  status;
+
+	test_wait_reset("Reset", K_OBJ_CORE(&wait_condvar));
+
+	k_mutex_lock(&wait_mutex, K_FOREVER);
+	status = k_condvar_wait(&wait_condvar, &wait_mutex, K_TICKS(1));
+	k_mutex_unlock(&wait_mutex);
+	zassert_equal(status, -EAGAIN, "Expected %d, got %d\n",
+		      -EAGAIN, status);
+
+	test_wait_query("Timeout", K_OBJ_CORE(&wait_condvar), &query);
+	zassert_equal(query.count, 1, "Expected 1 wait, got %u\n",
+		      query.count);
+}
+
 ZTEST_SUITE(obj_core_stats_system, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
 
@@ -704,3 +873,6 @@ ZTEST_SUITE(obj_core_stats_mem_block, NULL, NULL,
 
 ZTEST_SUITE(obj_core_stats_mem_slab, NULL, NULL,
 	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
+
+ZTEST_SUITE(obj_core_stats_wait, NULL, NULL,
+	    ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+
+#define STACK_SIZE	(1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define PIPE_LEN	16
+
+K_PIPE_DEFINE(claim_pipe, PIPE_LEN, 4);
+
+static K_THREAD_STACK_DEFINE(claim_stack, STACK_SIZE);
+static struct k_thread claim_thread;
+
+static const unsigned char pattern[] = "0123456789abcdefghij";
+
+/**
+ * @brief Test writing data in place in the pipe's buffer
+ * @see k_pipe_put_claim(), k_pipe_put_finish()
+ */
+ZTEST(pipe_api, test_pipe_put_claim)
+{
+	unsigned char rx_data[PIPE_LEN];
+	size_t bytes_read;
+	size_t claimed;
+	void *data;
+
+	k_pipe_flush(&claim_pipe);
+
+	claimed = k_pipe_put_claim(&claim_pipe, &data, 10);
+	zassert_equal(claimed, 10);
+
+	/* Only one claim at a time */
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, 1), 0);
+
+	/* Nothing readable until finished */
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 0);
+
+	memcpy(data, pattern, 10);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, 11), -EINVAL);
+	zassert_ok(k_pipe_put_finish(&claim_pipe, 8));
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 8);
+
+	/* The rest of the buffer is contiguous */
+	claimed = k_pipe_put_claim(&claim_pipe, &data, PIPE_LEN);
+	zassert_equal(claimed, PIPE_LEN - 8);
+	memcpy(data, &pattern[8], claimed);
+	zassert_ok(k_pipe_put_finish(&claim_pipe, claimed));
+
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, 1), 0);
+
+	zassert_ok(k_pipe_get(&claim_pipe, rx_data, PIPE_LEN, &bytes_read,
+			      PIPE_LEN, K_NO_WAIT));
+	zassert_equal(bytes_read, PIPE_LEN);
+	zassert_mem_equal(rx_data, pattern, PIPE_LEN);
+}
+
+static void claim_reader(void *p1, void *p2, void *p3)
+{
+	unsigned char *rx_data = p1;
+	size_t bytes_read;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_ok(k_pipe_get(&claim_pipe, rx_data, 8, &bytes_read, 8,
+			      K_FOREVER));
+	zassert_equal(bytes_read, 8);
+}
+
+/**
+ * @brief Test that data written in place is handed to a pended reader
+ * @see k_pipe_put_claim(), k_pipe_put_finish()
+ */
+ZTEST(pipe_api, test_pipe_put_claim_reader_wait)
+{
+	static unsigned char rx_data[8];
+	void *data;
+
+	k_pipe_flush(&claim_pipe);
+
+	k_thread_create(&claim_thread, claim_stack, STACK_SIZE,
+			claim_reader, rx_data, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	/* Let the reader pend on the empty pipe */
+	k_msleep(10);
+
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &data, 12), 12);
+	memcpy(data, pattern, 12);
+	zassert_ok(k_pipe_put_finish(&claim_pipe, 12));
+
+	k_thread_join(&claim_thread, K_FOREVER);
+
+	zassert_mem_equal(rx_data, pattern, 8);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 4);
+}
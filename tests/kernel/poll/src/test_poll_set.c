@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define SET_NUM_SEMS 32
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static struct k_poll_set set;
+static struct k_sem set_sems[SET_NUM_SEMS];
+static struct k_poll_event set_events[SET_NUM_SEMS];
+static struct k_poll_signal set_signal;
+static struct k_poll_event set_signal_event;
+static struct k_thread set_thread;
+K_THREAD_STACK_DEFINE(set_stack, STACK_SIZE);
+
+static void set_setup(void)
+{
+	k_poll_set_init(&set);
+
+	for (int i = 0; i < SET_NUM_SEMS; i++) {
+		k_sem_init(&set_sems[i], 0, 1);
+		k_poll_event_init(&set_events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &set_sems[i]);
+		set_events[i].tag = i;
+		zassert_ok(k_poll_set_add(&set, &set_events[i]));
+	}
+}
+
+static void set_teardown(void)
+{
+	for (int i = 0; i < SET_NUM_SEMS; i++) {
+		zassert_ok(k_poll_set_remove(&set, &set_events[i]));
+	}
+}
+
+static void set_give_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sleep(K_MSEC(10));
+	k_sem_give(p1);
+}
+
+/**
+ * @brief Test that only ready events are returned by a poll set
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_init(), k_poll_set_add(), k_poll_set_wait()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_ready)
+{
+	struct k_poll_event *ready[SET_NUM_SEMS];
+	int num;
+
+	set_setup();
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT),
+		      -EAGAIN);
+
+	k_sem_give(&set_sems[3]);
+	k_sem_give(&set_sems[17]);
+	k_sem_give(&set_sems[3]);
+
+	num = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(num, 2, "got %d events", num);
+	zassert_equal(ready[0]->tag, 3);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SEM_AVAILABLE);
+	zassert_equal(ready[1]->tag, 17);
+	zassert_ok(k_sem_take(&set_sems[3], K_NO_WAIT));
+	zassert_ok(k_sem_take(&set_sems[17], K_NO_WAIT));
+
+	/* Events stay registered once returned */
+	k_sem_give(&set_sems[17]);
+	num = k_poll_set_wait(&set, ready, 1, K_NO_WAIT);
+	zassert_equal(num, 1);
+	zassert_equal(ready[0]->tag, 17);
+	zassert_ok(k_sem_take(&set_sems[17], K_NO_WAIT));
+
+	/* Wait for another thread to make an event ready */
+	k_thread_create(&set_thread, set_stack, K_THREAD_STACK_SIZEOF(set_stack),
+			set_give_entry, &set_sems[30], NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	num = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_FOREVER);
+	zassert_equal(num, 1);
+	zassert_equal(ready[0]->tag, 30);
+	zassert_ok(k_sem_take(&set_sems[30], K_NO_WAIT));
+	k_thread_join(&set_thread, K_FOREVER);
+
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_MSEC(10)),
+		      -EAGAIN);
+
+	set_teardown();
+}
+
+/**
+ * @brief Test adding and removing poll set events
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_add(), k_poll_set_remove()
+ */
+ZTEST(poll_api_1cpu, test_poll_set_add_remove)
+{
+	struct k_poll_event *ready[SET_NUM_SEMS];
+	int num;
+
+	set_setup();
+
+	/* A signal raised before it is added is ready right away */
+	k_poll_signal_init(&set_signal);
+	k_poll_signal_raise(&set_signal, 0x1234);
+	k_poll_event_init(&set_signal_event, K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &set_signal);
+	zassert_ok(k_poll_set_add(&set, &set_signal_event));
+	zassert_equal(k_poll_set_add(&set, &set_signal_event), -EBUSY);
+
+	num = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(num, 1);
+	zassert_equal_ptr(ready[0], &set_signal_event);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SIGNALED);
+
+	/* Removed events are neither queued nor returned */
+	k_sem_give(&set_sems[5]);
+	zassert_ok(k_poll_set_remove(&set, &set_signal_event));
+	zassert_equal(k_poll_set_remove(&set, &set_signal_event), -EINVAL);
+	zassert_ok(k_poll_set_remove(&set, &set_events[5]));
+	k_poll_signal_raise(&set_signal, 0x1234);
+	zassert_equal(k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT),
+		      -EAGAIN);
+
+	zassert_ok(k_sem_take(&set_sems[5], K_NO_WAIT));
+	zassert_ok(k_poll_set_add(&set, &set_events[5]));
+
+	/* An event added again is queued again */
+	k_sem_give(&set_sems[5]);
+	num = k_poll_set_wait(&set, ready, ARRAY_SIZE(ready), K_NO_WAIT);
+	zassert_equal(num, 1);
+	zassert_equal(ready[0]->tag, 5);
+	zassert_ok(k_sem_take(&set_sems[5], K_NO_WAIT));
+
+	set_teardown();
+}
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/kernel/rcu.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_UPDATES 100
+
+struct test_data {
+	struct k_rcu_head rcu;
+	uint32_t value;
+	bool freed;
+};
+
+static struct test_data data[2];
+static struct test_data *test_ptr;
+static K_SEM_DEFINE(freed_sem, 0, 1);
+static volatile bool readers_stop;
+static volatile uint32_t bad_reads;
+
+static struct k_thread reader_thread;
+static K_THREAD_STACK_DEFINE(reader_stack, STACK_SIZE);
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	struct test_data *d;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (!readers_stop) {
+		k_rcu_read_lock();
+
+		d = K_RCU_DEREFERENCE(test_ptr);
+		if (d->freed) {
+			bad_reads++;
+		}
+
+		k_rcu_read_unlock();
+		k_yield();
+	}
+}
+
+static void free_cb(struct k_rcu_head *head)
+{
+	struct test_data *d = CONTAINER_OF(head, struct test_data, rcu);
+
+	d->freed = true;
+	k_sem_give(&freed_sem);
+}
+
+/**
+ * @brief Test that old copies are only freed once readers are done
+ */
+ZTEST(rcu, test_rcu_synchronize)
+{
+	struct test_data *old;
+
+	data[0].freed = false;
+	K_RCU_ASSIGN_POINTER(test_ptr, &data[0]);
+	readers_stop = false;
+	bad_reads = 0;
+
+	k_thread_create(&reader_thread, reader_stack, STACK_SIZE, reader_entry,
+			NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+
+	for (int i = 1; i <= NUM_UPDATES; i++) {
+		old = test_ptr;
+		data[i % 2].freed = false;
+		data[i % 2].value = i;
+		K_RCU_ASSIGN_POINTER(test_ptr, &data[i % 2]);
+
+		k_rcu_synchronize();
+		old->freed = true;
+		k_yield();
+	}
+
+	readers_stop = true;
+	k_thread_join(&reader_thread, K_FOREVER);
+
+	zassert_equal(bad_reads, 0, "%u reads of freed data", bad_reads);
+}
+
+/**
+ * @brief Test deferred callbacks
+ */
+ZTEST(rcu, test_rcu_call)
+{
+	data[0].freed = false;
+
+	k_rcu_read_lock();
+	k_rcu_call(&data[0].rcu, free_cb);
+	zassert_false(data[0].freed);
+	k_rcu_read_unlock();
+
+	zassert_ok(k_sem_take(&freed_sem, K_SECONDS(1)));
+	zassert_true(data[0].freed);
+}
+
+ZTEST_SUITE(rcu, NULL, NULL, NULL, NULL, NULL);
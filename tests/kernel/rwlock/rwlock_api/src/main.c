@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define NUM_THREADS 2
+
+K_RWLOCK_DEFINE(test_rwlock);
+K_RWLOCK_DEFINE(simple_rwlock);
+
+static struct k_thread threads[NUM_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, NUM_THREADS, STACK_SIZE);
+static volatile int locked_cnt;
+
+static void reader_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_ok(k_rwlock_read_lock(&test_rwlock, K_FOREVER));
+	locked_cnt++;
+	zassert_ok(k_rwlock_unlock(&test_rwlock));
+}
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	zassert_ok(k_rwlock_write_lock(&test_rwlock, K_FOREVER));
+	locked_cnt++;
+	zassert_ok(k_rwlock_unlock(&test_rwlock));
+}
+
+static void start_thread(int i, k_thread_entry_t entry, int prio)
+{
+	k_thread_create(&threads[i], stacks[i], STACK_SIZE, entry,
+			NULL, NULL, NULL, prio, 0, K_NO_WAIT);
+}
+
+static int higher_prio(void)
+{
+	return k_thread_priority_get(k_current_get()) - 1;
+}
+
+/**
+ * @brief Test locking for reading and writing without contention
+ */
+ZTEST_USER(rwlock_tests, test_rwlock_uncontended)
+{
+	struct k_rwlock *rwlock = &simple_rwlock;
+
+	k_rwlock_init(rwlock);
+
+	zassert_ok(k_rwlock_read_lock(rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_read_lock(rwlock, K_NO_WAIT));
+	zassert_equal(k_rwlock_write_lock(rwlock, K_NO_WAIT), -EBUSY);
+	zassert_equal(k_rwlock_write_lock(rwlock, K_MSEC(10)), -EAGAIN);
+	zassert_ok(k_rwlock_unlock(rwlock));
+	zassert_ok(k_rwlock_unlock(rwlock));
+	zassert_equal(k_rwlock_unlock(rwlock), -EPERM);
+
+	zassert_ok(k_rwlock_write_lock(rwlock, K_NO_WAIT));
+	zassert_equal(k_rwlock_write_lock(rwlock, K_NO_WAIT), -EDEADLK);
+	zassert_equal(k_rwlock_read_lock(rwlock, K_NO_WAIT), -EBUSY);
+	zassert_ok(k_rwlock_unlock(rwlock));
+
+	/* Readers get in again once the writer is gone */
+	zassert_ok(k_rwlock_read_lock(rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_unlock(rwlock));
+}
+
+/**
+ * @brief Test that readers waiting on a writer all get the lock
+ */
+ZTEST(rwlock_tests, test_rwlock_readers_wake)
+{
+	locked_cnt = 0;
+
+	zassert_ok(k_rwlock_write_lock(&test_rwlock, K_NO_WAIT));
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		start_thread(i, reader_entry, higher_prio());
+	}
+	zassert_equal(locked_cnt, 0);
+
+	zassert_ok(k_rwlock_unlock(&test_rwlock));
+	zassert_equal(locked_cnt, NUM_THREADS);
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+}
+
+/**
+ * @brief Test that a waiting writer keeps new readers out
+ */
+ZTEST(rwlock_tests, test_rwlock_writer_preference)
+{
+	locked_cnt = 0;
+
+	zassert_ok(k_rwlock_read_lock(&test_rwlock, K_NO_WAIT));
+
+	start_thread(0, writer_entry, higher_prio());
+	zassert_equal(locked_cnt, 0);
+
+	zassert_equal(k_rwlock_read_lock(&test_rwlock, K_NO_WAIT), -EBUSY);
+
+	/* The last reader out hands the lock over to the writer */
+	zassert_ok(k_rwlock_unlock(&test_rwlock));
+	zassert_equal(locked_cnt, 1);
+
+	k_thread_join(&threads[0], K_FOREVER);
+
+	zassert_ok(k_rwlock_read_lock(&test_rwlock, K_NO_WAIT));
+	zassert_ok(k_rwlock_unlock(&test_rwlock));
+}
+
+/**
+ * @brief Test that the writer inherits the priority of waiting writers
+ */
+ZTEST(rwlock_tests, test_rwlock_priority_inheritance)
+{
+	int prio = k_thread_priority_get(k_current_get());
+
+	locked_cnt = 0;
+
+	zassert_ok(k_rwlock_write_lock(&test_rwlock, K_NO_WAIT));
+
+	start_thread(0, writer_entry, prio - 2);
+	zassert_equal(k_thread_priority_get(k_current_get()), prio - 2);
+
+	zassert_ok(k_rwlock_unlock(&test_rwlock));
+	zassert_equal(k_thread_priority_get(k_current_get()), prio);
+	zassert_equal(locked_cnt, 1);
+
+	k_thread_join(&threads[0], K_FOREVER);
+}
+
+static void *rwlock_tests_setup(void)
+{
+#ifdef CONFIG_USERSPACE
+	k_thread_access_grant(k_current_get(), &test_rwlock, &simple_rwlock);
+#endif
+	return NULL;
+}
+
+ZTEST_SUITE(rwlock_tests, NULL, rwlock_tests_setup, NULL, NULL, NULL);
@@ -809,6 +809,36 @@ ZTEST_USER(timer_api, test_sleep_abs)
 		     start + sleep_ticks, end, late);
 }
 
+ZTEST_USER(timer_api, test_timer_slack)
+{
+#ifdef CONFIG_TIMEOUT_SLACK
+	const k_ticks_t slack = 20;
+	uint64_t exp0, exp1;
+
+	/* Two timers a tick apart expire together, on a multiple of
+	 * the slack.
+	 */
+	k_timer_slack_set(&sync_timer, K_TICKS(slack));
+	k_timer_slack_set(&status_anytime_timer, K_TICKS(slack));
+
+	k_timer_start(&sync_timer, K_TICKS(3), K_NO_WAIT);
+	k_timer_start(&status_anytime_timer, K_TICKS(4), K_NO_WAIT);
+	exp0 = k_timer_expires_ticks(&sync_timer);
+	exp1 = k_timer_expires_ticks(&status_anytime_timer);
+	k_timer_stop(&sync_timer);
+	k_timer_stop(&status_anytime_timer);
+
+	k_timer_slack_set(&sync_timer, K_NO_WAIT);
+	k_timer_slack_set(&status_anytime_timer, K_NO_WAIT);
+
+	zassert_equal(exp0 % slack, 0, "expiry %lld not aligned", exp0);
+	zassert_true(exp0 == exp1 || exp1 - exp0 == slack,
+		     "expiries %lld and %lld not coalesced", exp0, exp1);
+#else
+	ztest_test_skip();
+#endif
+}
+
 static void timer_init(struct k_timer *timer, k_timer_expiry_t expiry_fn,
 		       k_timer_stop_t stop_fn)
 {
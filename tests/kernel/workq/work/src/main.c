@@ -1442,6 +1442,209 @@ ZTEST(work_1cpu, test_1cpu_system_reschedule)
 		     "long %u > %u\n", elapsed_ms, max_ms);
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+#define POOL_WORKERS 2
+
+static K_THREAD_STACK_DEFINE(pool_stack, STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(pool_worker_stacks, POOL_WORKERS, STACK_SIZE);
+static struct k_work_q_worker pool_workers[POOL_WORKERS];
+static struct k_work_q pool_queue;
+
+/* Given by the pool handler once it runs. */
+static struct k_sem pool_started_sem;
+
+struct pool_item {
+	struct k_work work;
+	/* Given by the test to let the handler return. */
+	struct k_sem release;
+	atomic_t running;
+	atomic_t max_running;
+	atomic_t runs;
+};
+
+static struct pool_item pool_items[2];
+
+static void pool_handler(struct k_work *work)
+{
+	struct pool_item *item = CONTAINER_OF(work, struct pool_item, work);
+	atomic_val_t running = atomic_inc(&item->running) + 1;
+
+	if (running > atomic_get(&item->max_running)) {
+		atomic_set(&item->max_running, running);
+	}
+
+	k_sem_give(&pool_started_sem);
+	k_sem_take(&item->release, K_FOREVER);
+
+	atomic_inc(&item->runs);
+	atomic_dec(&item->running);
+}
+
+static void pool_release_cb(struct k_timer *timer)
+{
+	k_sem_give(&pool_items[0].release);
+}
+
+static K_TIMER_DEFINE(pool_release_timer, pool_release_cb, NULL);
+
+static void *pool_setup(void)
+{
+	k_sem_init(&pool_started_sem, 0, K_SEM_MAX_LIMIT);
+
+	k_work_queue_start(&pool_queue, pool_stack, STACK_SIZE,
+			   COOPHI_PRIORITY, NULL);
+
+	for (int i = 0; i < POOL_WORKERS; i++) {
+		zassert_ok(k_work_queue_add_worker(&pool_queue, &pool_workers[i],
+						   pool_worker_stacks[i], STACK_SIZE,
+						   COOPHI_PRIORITY, -1));
+	}
+
+	return NULL;
+}
+
+static void pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	k_sem_reset(&pool_started_sem);
+
+	for (int i = 0; i < ARRAY_SIZE(pool_items); i++) {
+		k_work_init(&pool_items[i].work, pool_handler);
+		k_sem_init(&pool_items[i].release, 0, K_SEM_MAX_LIMIT);
+		atomic_set(&pool_items[i].running, 0);
+		atomic_set(&pool_items[i].max_running, 0);
+		atomic_set(&pool_items[i].runs, 0);
+	}
+}
+
+/* Check that a blocked handler doesn't hold back other items. */
+ZTEST(work_pool, test_pool_parallel)
+{
+	zassert_equal(k_work_submit_to_queue(&pool_queue, &pool_items[0].work), 1);
+	zassert_equal(k_work_submit_to_queue(&pool_queue, &pool_items[1].work), 1);
+
+	/* Both handlers run while the other one is blocked */
+	zassert_ok(k_sem_take(&pool_started_sem, K_MSEC(DELAY_MS)));
+	zassert_ok(k_sem_take(&pool_started_sem, K_MSEC(DELAY_MS)));
+	zassert_equal(k_work_busy_get(&pool_items[0].work), K_WORK_RUNNING);
+	zassert_equal(k_work_busy_get(&pool_items[1].work), K_WORK_RUNNING);
+
+	k_sem_give(&pool_items[0].release);
+	k_sem_give(&pool_items[1].release);
+
+	(void)k_work_flush(&pool_items[0].work, &work_sync);
+	(void)k_work_flush(&pool_items[1].work, &work_sync);
+	zassert_equal(atomic_get(&pool_items[0].runs), 1);
+	zassert_equal(atomic_get(&pool_items[1].runs), 1);
+}
+
+/* Check that an item resubmitted while running waits for the handler to
+ * return although other workers are idle.
+ */
+ZTEST(work_pool, test_pool_running_resubmit)
+{
+	struct pool_item *item = &pool_items[0];
+
+	zassert_equal(k_work_submit_to_queue(&pool_queue, &item->work), 1);
+	zassert_ok(k_sem_take(&pool_started_sem, K_MSEC(DELAY_MS)));
+
+	zassert_equal(k_work_submit_to_queue(&pool_queue, &item->work), 2);
+	zassert_equal(k_work_busy_get(&item->work),
+		      K_WORK_RUNNING | K_WORK_QUEUED);
+
+	/* Give the idle workers a chance to pick the item */
+	zassert_equal(k_sem_take(&pool_started_sem, K_MSEC(DELAY_MS)), -EAGAIN);
+
+	/* The second run starts when the first one returns */
+	k_sem_give(&item->release);
+	zassert_ok(k_sem_take(&pool_started_sem, K_MSEC(DELAY_MS)));
+	zassert_equal(atomic_get(&item->runs), 1);
+
+	k_sem_give(&item->release);
+	(void)k_work_flush(&item->work, &work_sync);
+
+	zassert_equal(atomic_get(&item->runs), 2);
+	zassert_equal(atomic_get(&item->max_running), 1);
+}
+
+/* Check that flushing a running item waits for the handler to return
+ * although other workers are idle.
+ */
+ZTEST(work_pool, test_pool_running_flush)
+{
+	struct pool_item *item = &pool_items[0];
+
+	zassert_equal(k_work_submit_to_queue(&pool_queue, &item->work), 1);
+	zassert_ok(k_sem_take(&pool_started_sem, K_MSEC(DELAY_MS)));
+
+	k_timer_start(&pool_release_timer, DELAY_TIMEOUT, K_NO_WAIT);
+
+	zassert_true(k_work_flush(&item->work, &work_sync));
+	zassert_equal(k_work_busy_get(&item->work), 0);
+	zassert_equal(atomic_get(&item->runs), 1);
+}
+
+ZTEST_SUITE(work_pool, NULL, pool_setup, pool_before, NULL, NULL);
+#endif /* CONFIG_WORKQUEUE_POOL */
+
+#ifdef CONFIG_WORK_DELAYABLE_SLACK
+static struct k_work_delayable slack_dwork[2];
+static int64_t slack_handled_ticks[2];
+static K_SEM_DEFINE(slack_sem, 0, ARRAY_SIZE(slack_dwork));
+
+static void slack_handler(struct k_work *work)
+{
+	struct k_work_delayable *dw = k_work_delayable_from_work(work);
+
+	slack_handled_ticks[dw - slack_dwork] = k_uptime_ticks();
+	k_sem_give(&slack_sem);
+}
+
+/* Check that work with overlapping slack windows is submitted together. */
+ZTEST(work, test_delayable_slack)
+{
+	int64_t start_ticks;
+
+	k_work_init_delayable(&slack_dwork[0], slack_handler);
+	k_work_init_delayable(&slack_dwork[1], slack_handler);
+
+	/* Windows are [1, 3] and [2, 4] delays, both expire at 3 delays */
+	k_sleep(K_TICKS(1));
+	start_ticks = k_uptime_ticks();
+	zassert_equal(k_work_schedule_slack(&slack_dwork[0], DELAY_TIMEOUT,
+					    K_MSEC(2 * DELAY_MS)), 1);
+	zassert_equal(k_work_schedule_slack(&slack_dwork[1], K_MSEC(2 * DELAY_MS),
+					    K_MSEC(2 * DELAY_MS)), 1);
+	zassert_equal(k_work_delayable_busy_get(&slack_dwork[0]), K_WORK_DELAYED);
+	zassert_true(k_work_delayable_remaining_get(&slack_dwork[0]) > 0);
+
+	/* Already scheduled */
+	zassert_equal(k_work_schedule_slack(&slack_dwork[0], K_NO_WAIT, K_NO_WAIT), 0);
+
+	zassert_ok(k_sem_take(&slack_sem, K_MSEC(5 * DELAY_MS)));
+	zassert_ok(k_sem_take(&slack_sem, K_MSEC(5 * DELAY_MS)));
+
+	zassert_true(slack_handled_ticks[0] - start_ticks >=
+		     k_ms_to_ticks_floor64(2 * DELAY_MS));
+	zassert_within(slack_handled_ticks[0], slack_handled_ticks[1], 1);
+	zassert_equal(k_work_delayable_busy_get(&slack_dwork[0]), 0);
+	zassert_equal(k_work_delayable_busy_get(&slack_dwork[1]), 0);
+}
+
+/* Check that canceling work scheduled with slack unschedules it. */
+ZTEST(work, test_delayable_slack_cancel)
+{
+	k_work_init_delayable(&slack_dwork[0], slack_handler);
+
+	zassert_equal(k_work_schedule_slack(&slack_dwork[0], DELAY_TIMEOUT,
+					    DELAY_TIMEOUT), 1);
+	zassert_equal(k_work_cancel_delayable(&slack_dwork[0]), 0);
+
+	zassert_equal(k_sem_take(&slack_sem, K_MSEC(3 * DELAY_MS)), -EAGAIN);
+}
+#endif /* CONFIG_WORK_DELAYABLE_SLACK */
+
 ZTEST(work, test_nop)
 {
 	ztest_test_skip();
@@ -44,7 +44,39 @@
 /* With enabling SYS_HEAP_RUNTIME_STATS, the size of struct z_heap
  * will increase 16 bytes on 64 bit CPU.
  */
-#ifdef CONFIG_SYS_HEAP_RUNTIME_STATS
+#if defined(CONFIG_SYS_HEAP_TLSF)
+/* TLSF buckets are 4 + 4 * 2^SL_LOG2 bytes, and the number of them
+ * in chunk0 depends on the heap size.  The layout of
+ * test_solo_free_header() needs chunk0 plus four chunk units, and a
+ * heap of that size has this many buckets for SYS_HEAP_TLSF_SL_LOG2 =
+ * 2..5, with and without runtime stats (checked below).
+ */
+#define SOLO_TLSF_BUCKETS(sl, stats) ((sl) == 2 ? 3 :			\
+				      (sl) == 3 ? ((stats) ? 3 : 2) :	\
+				      (sl) == 4 ? ((stats) ? 2 : 1) : 1)
+#define SOLO_TLSF_HDR_SZ(stats) (16 + ((stats) ? 3 * sizeof(size_t) : 0))
+#define SOLO_TLSF_SZ(sl, stats)						\
+	(ROUND_UP(SOLO_TLSF_HDR_SZ(stats) +				\
+		  SOLO_TLSF_BUCKETS(sl, stats) * (4 + 4 * BIT(sl)), 8) + 4 * 8)
+
+/* Buckets of a heap with this many usable chunk units: all but the
+ * footer, less the 2 units of a 1-byte allocation plus one
+ */
+#define SOLO_TLSF_USABLE(sl, stats) (SOLO_TLSF_SZ(sl, stats) / 8 - 1 - 2 + 1)
+#define TLSF_BUCKETS(usable, sl) \
+	((usable) < BIT(sl) ? 1 : LOG2(usable) - (sl) + 2)
+
+BUILD_ASSERT(sizeof(void *) <= 4U ||
+	     SOLO_TLSF_BUCKETS(CONFIG_SYS_HEAP_TLSF_SL_LOG2,
+			       IS_ENABLED(CONFIG_SYS_HEAP_RUNTIME_STATS)) ==
+	     TLSF_BUCKETS(SOLO_TLSF_USABLE(CONFIG_SYS_HEAP_TLSF_SL_LOG2,
+					   IS_ENABLED(CONFIG_SYS_HEAP_RUNTIME_STATS)),
+			  CONFIG_SYS_HEAP_TLSF_SL_LOG2));
+
+#define SOLO_FREE_HEADER_HEAP_SZ \
+	SOLO_TLSF_SZ(CONFIG_SYS_HEAP_TLSF_SL_LOG2, \
+		     IS_ENABLED(CONFIG_SYS_HEAP_RUNTIME_STATS))
+#elif defined(CONFIG_SYS_HEAP_RUNTIME_STATS)
 #define SOLO_FREE_HEADER_HEAP_SZ (80)
 #else
 #define SOLO_FREE_HEADER_HEAP_SZ (64)
@@ -387,6 +419,59 @@ ZTEST(lib_heap, test_realloc)
 		     "Realloc should have moved %p", p2);
 }
 
+static uint32_t histogram_total(struct sys_heap_fragmentation_stats *frag)
+{
+	uint32_t total = 0;
+
+	for (int i = 0; i < SYS_HEAP_FRAG_HISTOGRAM_BINS; i++) {
+		total += frag->histogram[i];
+	}
+	return total;
+}
+
+ZTEST(lib_heap, test_fragmentation_stats)
+{
+	struct sys_heap heap;
+	struct sys_memory_stats stats;
+	struct sys_heap_fragmentation_stats frag;
+	void *p1, *p2, *p3;
+
+	sys_heap_init(&heap, heapmem, SMALL_HEAP_SZ);
+
+	zassert_equal(sys_heap_fragmentation_stats_get(NULL, &frag), -EINVAL);
+	zassert_equal(sys_heap_fragmentation_stats_get(&heap, NULL), -EINVAL);
+
+	/* A fresh heap is one free chunk */
+	zassert_ok(sys_heap_runtime_stats_get(&heap, &stats));
+	zassert_ok(sys_heap_fragmentation_stats_get(&heap, &frag));
+	zassert_equal(frag.free_chunks, 1);
+	zassert_equal(histogram_total(&frag), 1);
+	zassert_equal(frag.largest_free_bytes, stats.free_bytes);
+
+	/* Punching a hole in the middle makes a second, smaller one */
+	p1 = sys_heap_alloc(&heap, 64);
+	p2 = sys_heap_alloc(&heap, 64);
+	p3 = sys_heap_alloc(&heap, 64);
+	sys_heap_free(&heap, p2);
+
+	zassert_ok(sys_heap_runtime_stats_get(&heap, &stats));
+	zassert_ok(sys_heap_fragmentation_stats_get(&heap, &frag));
+	zassert_equal(frag.free_chunks, 2);
+	zassert_equal(histogram_total(&frag), 2);
+	zassert_true(frag.largest_free_bytes < stats.free_bytes);
+	zassert_true(frag.largest_free_bytes > stats.free_bytes / 2);
+
+	/* Everything merges back */
+	sys_heap_free(&heap, p1);
+	sys_heap_free(&heap, p3);
+
+	zassert_ok(sys_heap_runtime_stats_get(&heap, &stats));
+	zassert_ok(sys_heap_fragmentation_stats_get(&heap, &frag));
+	zassert_equal(frag.free_chunks, 1);
+	zassert_equal(frag.largest_free_bytes, stats.free_bytes);
+	zassert_true(sys_heap_validate(&heap), "invalid heap");
+}
+
 #ifdef CONFIG_SYS_HEAP_LISTENER
 static struct sys_heap listener_heap;
 static uintptr_t listener_heap_id;
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/drivers/counter.h>
+#include <zephyr/sys/hrtimer.h>
+
+#define PERIOD_US 2000
+#define EXPIRIES 10
+
+static const struct device *const counter = DEVICE_DT_GET(DT_NODELABEL(counter0));
+static struct hrtimer_queue queue;
+static struct hrtimer timer;
+static struct hrtimer timer2;
+
+static volatile int expiries;
+static uint32_t expiry_cycles[EXPIRIES];
+
+static void expiry(struct hrtimer *t)
+{
+	if (expiries < EXPIRIES) {
+		expiry_cycles[expiries] = k_cycle_get_32();
+	}
+
+	expiries++;
+}
+
+static void expiry_stop(struct hrtimer *t)
+{
+	expiry(t);
+
+	if (expiries == 3) {
+		hrtimer_stop(t);
+	}
+}
+
+ZTEST(hrtimer, test_one_shot)
+{
+	hrtimer_init(&timer, &queue, expiry);
+	hrtimer_start(&timer, PERIOD_US, 0);
+	zassert_true(hrtimer_is_running(&timer));
+
+	k_usleep(10 * PERIOD_US);
+
+	zassert_equal(expiries, 1);
+	zassert_false(hrtimer_is_running(&timer));
+}
+
+ZTEST(hrtimer, test_periodic)
+{
+	uint32_t start;
+	uint32_t max_error = 0;
+
+	hrtimer_init(&timer, &queue, expiry);
+
+	start = k_cycle_get_32();
+	hrtimer_start(&timer, PERIOD_US, PERIOD_US);
+
+	k_usleep((EXPIRIES + 1) * PERIOD_US);
+	hrtimer_stop(&timer);
+
+	zassert_true(expiries >= EXPIRIES, "%d expiries", expiries);
+
+	for (int i = 0; i < EXPIRIES; i++) {
+		uint32_t expected = (i + 1) * k_us_to_cyc_ceil32(PERIOD_US);
+		uint32_t elapsed = expiry_cycles[i] - start;
+		uint32_t error = (elapsed > expected) ? elapsed - expected : expected - elapsed;
+
+		max_error = MAX(max_error, error);
+	}
+
+	/* Periodic expiries must not drift */
+	TC_PRINT("max expiry error %u us\n", k_cyc_to_us_ceil32(max_error));
+	zassert_true(k_cyc_to_us_ceil32(max_error) < PERIOD_US);
+}
+
+ZTEST(hrtimer, test_stop)
+{
+	int count;
+
+	hrtimer_init(&timer, &queue, expiry);
+	hrtimer_start(&timer, PERIOD_US, 0);
+	hrtimer_stop(&timer);
+	zassert_false(hrtimer_is_running(&timer));
+
+	/* Stopped from the expiry function */
+	hrtimer_init(&timer2, &queue, expiry_stop);
+	hrtimer_start(&timer2, PERIOD_US, PERIOD_US);
+
+	k_usleep(10 * PERIOD_US);
+	count = expiries;
+	k_usleep(10 * PERIOD_US);
+
+	zassert_equal(count, 3);
+	zassert_equal(expiries, 3);
+	zassert_false(hrtimer_is_running(&timer2));
+}
+
+ZTEST(hrtimer, test_order)
+{
+	hrtimer_init(&timer, &queue, expiry);
+	hrtimer_init(&timer2, &queue, expiry);
+
+	/* The later timer is started first */
+	hrtimer_start(&timer, 4 * PERIOD_US, 0);
+	hrtimer_start(&timer2, PERIOD_US, 0);
+
+	k_usleep(2 * PERIOD_US);
+	zassert_equal(expiries, 1);
+	zassert_true(hrtimer_is_running(&timer));
+	zassert_false(hrtimer_is_running(&timer2));
+
+	k_usleep(4 * PERIOD_US);
+	zassert_equal(expiries, 2);
+	zassert_false(hrtimer_is_running(&timer));
+}
+
+static void *hrtimer_setup(void)
+{
+	zassert_ok(hrtimer_queue_init(&queue, counter, 0));
+
+	return NULL;
+}
+
+static void hrtimer_before(void *fixture)
+{
+	expiries = 0;
+}
+
+ZTEST_SUITE(hrtimer, NULL, hrtimer_setup, hrtimer_before, NULL, NULL);
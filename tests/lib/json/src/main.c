@@ -947,6 +947,9 @@ ZTEST(lib_json_test, test_json_invalid_number)
 {
 	struct encoding_test encoded[] = {
 		{ "{\"some_int\":xxx }", -EINVAL},
+		{ "{\"some_int\":1.5 }", -EINVAL},
+		{ "{\"some_int\":2147483648 }", -ERANGE},
+		{ "{\"some_int\":-2147483649 }", -ERANGE},
 	};
 
 	parse_harness(encoded, ARRAY_SIZE(encoded));
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/ztress.h>
+#include <zephyr/sys/ring_buffer.h>
+
+#define MPMC_ITEMS 8
+#define PRODUCERS 3
+
+RING_BUF_MPMC_DECLARE(mpmc, sizeof(uint32_t), MPMC_ITEMS);
+
+ZTEST(ringbuffer_api, test_ringbuffer_mpmc_api)
+{
+	uint32_t items[MPMC_ITEMS + 4];
+	uint32_t out[MPMC_ITEMS + 4];
+	uint32_t pos;
+	void *item;
+	uint32_t n;
+
+	for (uint32_t i = 0; i < ARRAY_SIZE(items); i++) {
+		items[i] = i;
+	}
+
+	for (uint32_t i = 0; i < MPMC_ITEMS; i++) {
+		zassert_ok(ring_buf_mpmc_put_claim(&mpmc, &item, &pos));
+		*(uint32_t *)item = i;
+		ring_buf_mpmc_put_finish(&mpmc, pos);
+	}
+	zassert_equal(ring_buf_mpmc_put_claim(&mpmc, &item, &pos), -EMSGSIZE);
+	zassert_equal(ring_buf_mpmc_put(&mpmc, items, 1), 0);
+
+	/* Read 3 items, then write 3 items across the end of the buffer */
+	for (uint32_t i = 0; i < 3; i++) {
+		zassert_ok(ring_buf_mpmc_get_claim(&mpmc, &item, &pos));
+		zassert_equal(*(uint32_t *)item, i);
+		ring_buf_mpmc_get_finish(&mpmc, pos);
+	}
+	zassert_equal(ring_buf_mpmc_put(&mpmc, &items[MPMC_ITEMS], 4), 3);
+
+	n = ring_buf_mpmc_get(&mpmc, out, ARRAY_SIZE(out));
+	zassert_equal(n, MPMC_ITEMS);
+	zassert_mem_equal(out, &items[3], n * sizeof(uint32_t));
+	zassert_equal(ring_buf_mpmc_get_claim(&mpmc, &item, &pos), -EAGAIN);
+	zassert_equal(ring_buf_mpmc_get(&mpmc, out, 1), 0);
+
+	/* A reserved slot holds back the items written after it */
+	zassert_ok(ring_buf_mpmc_put_claim(&mpmc, &item, &pos));
+	zassert_equal(ring_buf_mpmc_put(&mpmc, items, 2), 2);
+	zassert_equal(ring_buf_mpmc_get(&mpmc, out, ARRAY_SIZE(out)), 0);
+	*(uint32_t *)item = 100;
+	ring_buf_mpmc_put_finish(&mpmc, pos);
+	zassert_equal(ring_buf_mpmc_get(&mpmc, out, ARRAY_SIZE(out)), 3);
+	zassert_equal(out[0], 100);
+	zassert_equal(out[1], 0);
+	zassert_equal(out[2], 1);
+}
+
+static uint32_t produced[PRODUCERS];
+static uint32_t consumed[PRODUCERS];
+
+/* Items are tagged with the producer id in the upper byte */
+static bool mpmc_produce(void *user_data, uint32_t cnt, bool last, int prio)
+{
+	uintptr_t id = (uintptr_t)user_data;
+	uint32_t items[2];
+	uint32_t pos;
+	void *item;
+
+	if (cnt & 1) {
+		items[0] = (id << 24) | produced[id];
+		items[1] = (id << 24) | (produced[id] + 1);
+		produced[id] += ring_buf_mpmc_put(&mpmc, items, ARRAY_SIZE(items));
+	} else if (ring_buf_mpmc_put_claim(&mpmc, &item, &pos) == 0) {
+		*(uint32_t *)item = (id << 24) | produced[id]++;
+		ring_buf_mpmc_put_finish(&mpmc, pos);
+	}
+
+	return true;
+}
+
+static bool mpmc_consume(void *user_data, uint32_t cnt, bool last, int prio)
+{
+	uint32_t items[3];
+	uint32_t n;
+
+	n = ring_buf_mpmc_get(&mpmc, items, ARRAY_SIZE(items));
+	for (uint32_t i = 0; i < n; i++) {
+		uint32_t id = items[i] >> 24;
+
+		zassert_true(id < PRODUCERS);
+		zassert_equal(items[i] & BIT_MASK(24), consumed[id]++,
+			      "Item from producer %u out of order", id);
+	}
+
+	return true;
+}
+
+/* Items from one producer are received in order and none is lost, while
+ * producers interrupt each other and the consumer.
+ */
+ZTEST(ringbuffer_api, test_ringbuffer_mpmc_stress)
+{
+	uint32_t items[MPMC_ITEMS];
+	uint32_t total;
+
+	(void)ring_buf_mpmc_get(&mpmc, items, ARRAY_SIZE(items));
+
+	ztress_set_timeout(K_MSEC(1000));
+	ZTRESS_EXECUTE(ZTRESS_TIMER(mpmc_produce, (void *)0, 0, Z_TIMEOUT_TICKS(20)),
+		       ZTRESS_THREAD(mpmc_produce, (void *)1, 0, 0, Z_TIMEOUT_TICKS(20)),
+		       ZTRESS_THREAD(mpmc_produce, (void *)2, 0, 2000, Z_TIMEOUT_TICKS(20)),
+		       ZTRESS_THREAD(mpmc_consume, NULL, 0, 2000, Z_TIMEOUT_TICKS(20)));
+
+	/* Drain what is left */
+	do {
+		total = consumed[0] + consumed[1] + consumed[2];
+		(void)mpmc_consume(NULL, 0, false, 0);
+	} while (consumed[0] + consumed[1] + consumed[2] != total);
+
+	for (int i = 0; i < PRODUCERS; i++) {
+		zassert_equal(produced[i], consumed[i]);
+	}
+}
@@ -1071,9 +1071,29 @@ static struct net_6lo_data test_data_25 = {
 
 #endif
 
-static void test_6lo(struct net_6lo_data *data)
+/* Move the compressed packet data so that the header can be uncompressed
+ * in the headroom of the first buffer.
+ */
+static bool move_to_headroom(struct net_pkt *pkt, int diff)
+{
+	struct net_buf *buf = pkt->buffer;
+	size_t len = buf->len;
+
+	if (diff <= 0 || net_buf_tailroom(buf) < (size_t)diff) {
+		return false;
+	}
+
+	net_buf_add(buf, diff);
+	memmove(buf->data + diff, buf->data, len);
+	net_buf_pull(buf, diff);
+
+	return true;
+}
+
+static bool test_6lo(struct net_6lo_data *data, bool headroom)
 {
 	struct net_pkt *pkt;
+	bool moved = false;
 	int diff;
 
 	pkt = create_pkt(data);
@@ -1098,6 +1118,10 @@ static void test_6lo(struct net_6lo_data *data)
 	diff = net_6lo_uncompress_hdr_diff(pkt);
 	zassert_true(diff == data->hdr_diff, "unexpected HDR diff");
 
+	if (headroom) {
+		moved = move_to_headroom(pkt, diff);
+	}
+
 	zassert_true(net_6lo_uncompress(pkt),
 		     "uncompression failed");
 #if DEBUG > 0
@@ -1109,6 +1133,8 @@ static void test_6lo(struct net_6lo_data *data)
 	zassert_true(compare_pkt(pkt, data));
 
 	net_pkt_unref(pkt);
+
+	return moved;
 }
 
 /* tests names are based on traffic class, flow label, source address mode
@@ -1148,16 +1174,21 @@ static const struct {
 #endif
 };
 
-ZTEST(t_6lo, test_loop)
+static void set_test_priority(void)
 {
-	int count;
-
 	if (IS_ENABLED(CONFIG_NET_TC_THREAD_COOPERATIVE)) {
 		k_thread_priority_set(k_current_get(),
 				K_PRIO_COOP(CONFIG_NUM_COOP_PRIORITIES - 1));
 	} else {
 		k_thread_priority_set(k_current_get(), K_PRIO_PREEMPT(9));
 	}
+}
+
+ZTEST(t_6lo, test_loop)
+{
+	int count;
+
+	set_test_priority();
 
 #if defined(CONFIG_NET_6LO_CONTEXT)
 	net_6lo_set_context(net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY)),
@@ -1169,10 +1200,35 @@ ZTEST(t_6lo, test_loop)
 	for (count = 0; count < ARRAY_SIZE(tests); count++) {
 		TC_PRINT("Starting %s\n", tests[count].name);
 
-		test_6lo(tests[count].data);
+		(void)test_6lo(tests[count].data, false);
 	}
 	net_pkt_print();
 }
 
+ZTEST(t_6lo, test_loop_headroom)
+{
+	int in_headroom = 0;
+	int count;
+
+	set_test_priority();
+
+#if defined(CONFIG_NET_6LO_CONTEXT)
+	net_6lo_set_context(net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY)),
+			    &ctx1);
+	net_6lo_set_context(net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY)),
+			    &ctx2);
+#endif
+
+	for (count = 0; count < ARRAY_SIZE(tests); count++) {
+		TC_PRINT("Starting %s in headroom\n", tests[count].name);
+
+		if (test_6lo(tests[count].data, true)) {
+			in_headroom++;
+		}
+	}
+
+	zassert_true(in_headroom > 0, "no header uncompressed in headroom");
+}
+
 /*test case main entry*/
 ZTEST_SUITE(t_6lo, NULL, NULL, NULL, NULL, NULL);
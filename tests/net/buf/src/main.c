@@ -70,6 +70,7 @@ static void var_destroy(struct net_buf *buf);
 NET_BUF_POOL_HEAP_DEFINE(bufs_pool, 10, USER_DATA_HEAP, buf_destroy);
 NET_BUF_POOL_FIXED_DEFINE(fixed_pool, 10, 128, USER_DATA_FIXED, fixed_destroy);
 NET_BUF_POOL_VAR_DEFINE(var_pool, 10, 1024, USER_DATA_VAR, var_destroy);
+NET_BUF_POOL_FIXED_DEFINE_IN_SECTION(section_pool, 4, 64, 0, NULL, __aligned(64));
 
 static void buf_destroy(struct net_buf *buf)
 {
@@ -440,6 +441,67 @@ ZTEST(net_buf_tests, test_net_buf_fixed_pool)
 	zassert_equal(destroy_called, 1, "Incorrect destroy callback count");
 }
 
+ZTEST(net_buf_tests, test_net_buf_fixed_pool_in_section)
+{
+	struct net_buf *buf;
+
+	buf = net_buf_alloc(&section_pool, K_NO_WAIT);
+	zassert_not_null(buf, "Failed to get buffer");
+
+	zassert_true(buf->data >= &net_buf_data_section_pool[0][0] &&
+		     buf->data < &net_buf_data_section_pool[4][0],
+		     "Data not in the pool storage");
+	zassert_equal((uintptr_t)net_buf_data_section_pool % 64, 0,
+		      "Storage attribute not applied");
+
+	net_buf_unref(buf);
+}
+
+ZTEST(net_buf_tests, test_net_buf_alloc_bulk)
+{
+	struct net_buf *head, *frag;
+	int count;
+
+	head = net_buf_alloc_bulk(&section_pool, section_pool.buf_count, K_NO_WAIT);
+	zassert_not_null(head, "Failed to get buffers");
+
+	for (count = 0, frag = head; frag; frag = frag->frags, count++) {
+		zassert_equal(frag->ref, 1, "Invalid ref count");
+		zassert_equal(frag->size, 64, "Invalid buffer size");
+		zassert_equal(net_buf_pool_get(frag->pool_id), &section_pool,
+			      "Invalid pool");
+	}
+
+	zassert_equal(count, section_pool.buf_count, "Invalid number of fragments");
+
+	zassert_is_null(net_buf_alloc_bulk(&section_pool, 1, K_NO_WAIT),
+			"Got a buffer from an empty pool");
+
+	/* All fragments go back to the pool at once */
+	net_buf_unref(head);
+
+	head = net_buf_alloc_bulk(&section_pool, section_pool.buf_count, K_NO_WAIT);
+	zassert_not_null(head, "Failed to get freed buffers");
+
+	frag = net_buf_alloc_bulk(&section_pool, 1, K_NO_WAIT);
+	zassert_is_null(frag, "Got a buffer from an empty pool");
+
+	net_buf_unref(head);
+
+	/* A failed allocation does not keep any buffer */
+	frag = net_buf_alloc(&section_pool, K_NO_WAIT);
+	zassert_not_null(frag, "Failed to get buffer");
+
+	zassert_is_null(net_buf_alloc_bulk(&section_pool, section_pool.buf_count, K_NO_WAIT),
+			"Got more buffers than available");
+
+	head = net_buf_alloc_bulk(&section_pool, section_pool.buf_count - 1, K_NO_WAIT);
+	zassert_not_null(head, "Failed to get buffers back");
+
+	net_buf_unref(head);
+	net_buf_unref(frag);
+}
+
 ZTEST(net_buf_tests, test_net_buf_var_pool)
 {
 	struct net_buf *buf1, *buf2, *buf3;
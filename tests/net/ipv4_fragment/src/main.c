@@ -802,6 +802,60 @@ ZTEST(net_ipv4_fragment, test_fragment_timeout)
 		      "Packet size mismatch");
 }
 
+static struct net_pkt *build_udp_frag(void)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = net_pkt_alloc_with_buffer(iface1, sizeof(ipv4_udp_frag), AF_INET,
+					IPPROTO_UDP, ALLOC_TIMEOUT);
+	zassert_not_null(pkt, "Packet creation failure");
+
+	net_pkt_set_family(pkt, AF_INET);
+	net_pkt_set_ip_hdr_len(pkt, sizeof(struct net_ipv4_hdr));
+
+	net_pkt_cursor_init(pkt);
+	ret = net_pkt_write(pkt, ipv4_udp_frag, sizeof(ipv4_udp_frag));
+	zassert_equal(ret, 0, "IPv4 fragmented frame append failed");
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+	NET_IPV4_HDR(pkt)->chksum = net_calc_chksum_ipv4(pkt);
+	net_pkt_set_overwrite(pkt, false);
+
+	net_pkt_set_iface(pkt, iface1);
+
+	return pkt;
+}
+
+/* Test that a duplicated fragment cancels the whole reassembly */
+ZTEST(net_ipv4_fragment, test_duplicate_fragment)
+{
+	uint8_t packets;
+	int ret;
+
+	ret = net_recv_data(iface1, build_udp_frag());
+	zassert_equal(ret, 0, "Cannot receive data (%d)", ret);
+
+	k_sleep(K_MSEC(10));
+	packets = 0;
+	net_ipv4_frag_foreach(reassembly_foreach_cb, &packets);
+	zassert_equal(packets, 1, "Expected fragment to be present in buffer");
+
+	ret = net_recv_data(iface1, build_udp_frag());
+	zassert_equal(ret, 0, "Cannot receive data (%d)", ret);
+
+	k_sleep(K_MSEC(10));
+	packets = 0;
+	net_ipv4_frag_foreach(reassembly_foreach_cb, &packets);
+	zassert_equal(packets, 0, "Expected reassembly to be dropped");
+
+	/* Nothing must be sent nor received for the dropped reassembly */
+	zassert_equal(k_sem_count_get(&wait_data), 0, "Unexpected lower-layer frame");
+	zassert_equal(k_sem_count_get(&wait_received_data), 0,
+		      "Unexpected upper-layer packet");
+}
+
 /* Test inserting large packet with do not fragment bit set */
 ZTEST(net_ipv4_fragment, test_do_not_fragment)
 {
@@ -995,6 +995,198 @@ ZTEST(coap, test_observer_client)
 	zassert_not_null(reply, "Couldn't find a matching waiting reply");
 }
 
+static struct coap_resource *index_hit;
+
+static int index_resource_get(struct coap_resource *resource,
+			      struct coap_packet *request,
+			      struct sockaddr *addr, socklen_t addr_len)
+{
+	index_hit = resource;
+
+	return 0;
+}
+
+#define INDEX_RESOURCE(...)						\
+	{ .path = (const char * const []){ __VA_ARGS__, NULL },		\
+	  .get = index_resource_get }
+
+static struct coap_resource index_resources[] = {
+	INDEX_RESOURCE("b", "a"),
+	INDEX_RESOURCE("a"),
+	INDEX_RESOURCE("a", "b"),
+	INDEX_RESOURCE("c", "+"),
+	INDEX_RESOURCE("c", "d"),
+	INDEX_RESOURCE("a"),
+	INDEX_RESOURCE("ab"),
+	INDEX_RESOURCE("e"),
+	{ },
+};
+
+/* Handle a GET request with and without index, both must agree */
+static int handle_indexed_request(const struct coap_resource_index *index,
+				  const char *path)
+{
+	struct coap_packet req;
+	struct coap_option options[5] = {};
+	uint8_t *data = data_buf[0];
+	uint8_t opt_num = ARRAY_SIZE(options) - 1;
+	struct coap_resource *expected_hit;
+	int expected;
+	int r;
+
+	r = coap_packet_init(&req, data, COAP_BUF_SIZE, COAP_VERSION_1,
+			     COAP_TYPE_CON, 0, NULL, COAP_METHOD_GET,
+			     coap_next_id());
+	zassert_equal(r, 0, "Unable to initialize request");
+
+	r = coap_packet_set_path(&req, path);
+	zassert_equal(r, 0, "Unable to set path");
+
+	r = coap_packet_parse(&req, data, req.offset, options, opt_num);
+	zassert_equal(r, 0, "Could not parse req packet");
+
+	index_hit = NULL;
+	expected = coap_handle_request(&req, index_resources, options, opt_num,
+				       (struct sockaddr *)&dummy_addr,
+				       sizeof(dummy_addr));
+	expected_hit = index_hit;
+
+	index_hit = NULL;
+	r = coap_handle_request_index(&req, index, options, opt_num,
+				      (struct sockaddr *)&dummy_addr,
+				      sizeof(dummy_addr));
+	zassert_equal(r, expected, "Unexpected result for %s", path);
+	zassert_equal_ptr(index_hit, expected_hit,
+			  "Unexpected resource for %s", path);
+
+	return r < 0 ? r : index_hit - index_resources;
+}
+
+ZTEST(coap, test_resource_index)
+{
+	struct coap_resource_index index;
+	uint16_t order[ARRAY_SIZE(index_resources) - 1];
+	int r;
+
+	r = coap_resource_index_init(&index, index_resources, order,
+				     ARRAY_SIZE(order) - 1);
+	zassert_equal(r, -ENOMEM, "Order array should be too short");
+
+	r = coap_resource_index_init(&index, index_resources, order,
+				     ARRAY_SIZE(order));
+	zassert_equal(r, 0, "Could not build index");
+
+	zassert_equal(handle_indexed_request(&index, "a"), 1);
+	zassert_equal(handle_indexed_request(&index, "a/b"), 2);
+	zassert_equal(handle_indexed_request(&index, "ab"), 6);
+	zassert_equal(handle_indexed_request(&index, "b/a"), 0);
+	zassert_equal(handle_indexed_request(&index, "e"), 7);
+	zassert_equal(handle_indexed_request(&index, "x"), -ENOENT);
+	zassert_equal(handle_indexed_request(&index, "b"), -ENOENT);
+	zassert_equal(handle_indexed_request(&index, "a/b/c"), -ENOENT);
+	zassert_equal(handle_indexed_request(&index, ""), -ENOENT);
+
+	/* The wildcard resource comes first in the array */
+	if (IS_ENABLED(CONFIG_COAP_URI_WILDCARD)) {
+		zassert_equal(handle_indexed_request(&index, "c/d"), 3);
+		zassert_equal(handle_indexed_request(&index, "c/z"), 3);
+	} else {
+		zassert_equal(handle_indexed_request(&index, "c/d"), 4);
+		zassert_equal(handle_indexed_request(&index, "c/z"), -ENOENT);
+	}
+}
+
+static int notify_count;
+
+static int notify_send(struct coap_resource *resource,
+		       struct coap_observer *observer,
+		       const struct msghdr *msg, void *user_data)
+{
+	struct coap_packet rsp;
+	struct coap_option options[4] = {};
+	uint8_t *data = data_buf[1];
+	uint8_t token[8];
+	const uint8_t *payload;
+	uint16_t payload_len;
+	uint16_t len = 0U;
+	int r;
+
+	zassert_equal_ptr(user_data, &notify_count);
+	zassert_equal_ptr(msg->msg_name, &observer->addr);
+	zassert_equal(msg->msg_namelen, sizeof(struct sockaddr_in6));
+
+	for (size_t i = 0; i < msg->msg_iovlen; i++) {
+		zassert_true(len + msg->msg_iov[i].iov_len <= COAP_BUF_SIZE);
+		memcpy(data + len, msg->msg_iov[i].iov_base,
+		       msg->msg_iov[i].iov_len);
+		len += msg->msg_iov[i].iov_len;
+	}
+
+	r = coap_packet_parse(&rsp, data, len, options, ARRAY_SIZE(options));
+	zassert_equal(r, 0, "Could not parse notification");
+
+	zassert_equal(coap_header_get_token(&rsp, token), observer->tkl);
+	zassert_mem_equal(token, observer->token, observer->tkl);
+	zassert_equal(coap_get_option_int(&rsp, COAP_OPTION_OBSERVE),
+		      resource->age);
+
+	payload = coap_packet_get_payload(&rsp, &payload_len);
+	zassert_equal(payload_len, 5);
+	zassert_mem_equal(payload, "hello", 5);
+
+	notify_count++;
+
+	return 0;
+}
+
+ZTEST(coap, test_resource_notify_packet)
+{
+	struct coap_resource resource = { };
+	struct coap_observer observer[2] = { };
+	struct coap_packet pkt;
+	uint8_t *data = data_buf[0];
+	int r;
+
+	/* Tokens of different lengths */
+	for (int i = 0; i < ARRAY_SIZE(observer); i++) {
+		memcpy(&observer[i].addr, &dummy_addr, sizeof(dummy_addr));
+		observer[i].tkl = 2 + 2 * i;
+		memset(observer[i].token, 'a' + i, observer[i].tkl);
+		coap_register_observer(&resource, &observer[i]);
+	}
+
+	resource.age++;
+
+	r = coap_packet_init(&pkt, data, COAP_BUF_SIZE, COAP_VERSION_1,
+			     COAP_TYPE_NON_CON, 0, NULL,
+			     COAP_RESPONSE_CODE_CONTENT, 0);
+	zassert_equal(r, 0, "Unable to initialize packet");
+
+	r = coap_append_option_int(&pkt, COAP_OPTION_OBSERVE, resource.age);
+	zassert_equal(r, 0, "Failed to append observe option");
+
+	r = coap_packet_append_payload_marker(&pkt);
+	zassert_equal(r, 0, "Failed to set the payload marker");
+
+	r = coap_packet_append_payload(&pkt, (uint8_t *)"hello", 5);
+	zassert_equal(r, 0, "Unable to append payload");
+
+	notify_count = 0;
+	r = coap_resource_notify_packet(&resource, &pkt, notify_send,
+					&notify_count);
+	zassert_equal(r, 0, "Could not notify resource");
+	zassert_equal(notify_count, 2);
+
+	r = coap_packet_init(&pkt, data, COAP_BUF_SIZE, COAP_VERSION_1,
+			     COAP_TYPE_NON_CON, 1, (uint8_t *)"t",
+			     COAP_RESPONSE_CODE_CONTENT, 0);
+	zassert_equal(r, 0, "Unable to initialize packet");
+
+	r = coap_resource_notify_packet(&resource, &pkt, notify_send,
+					&notify_count);
+	zassert_equal(r, -EINVAL, "The token should be rejected");
+}
+
 ZTEST(coap, test_handle_invalid_coap_req)
 {
 	struct coap_packet pkt;
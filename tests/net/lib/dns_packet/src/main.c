@@ -1242,6 +1242,90 @@ ZTEST(dns_packet, test_dns_flags_len)
 		      "DNS message length check failed (%d)", ret);
 }
 
+static void cache_cb(enum dns_resolve_status status,
+		     struct dns_addrinfo *info,
+		     void *user_data)
+{
+	int *count = user_data;
+
+	if (status == DNS_EAI_INPROGRESS) {
+		zassert_not_null(info, "No address info");
+		zassert_mem_equal(&net_sin(&info->ai_addr)->sin_addr,
+				  resp_ipv4_addr, sizeof(resp_ipv4_addr),
+				  "Wrong cached address");
+		(*count)++;
+		return;
+	}
+
+	zassert_equal(status, DNS_EAI_ALLDONE, "Unexpected status %d", status);
+	*count = -*count;
+}
+
+static void cache_entry_cb(const struct dns_cache_info *entry,
+			   void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	zassert_equal(strcmp(entry->query, DNAME1), 0, "Wrong name cached");
+	zassert_equal(entry->query_type, DNS_QUERY_TYPE_A, "Wrong type cached");
+	zassert_equal(entry->status, 0, "Unexpected negative entry");
+	zassert_true(entry->ttl <= 3028, "TTL %u too long", entry->ttl);
+}
+
+ZTEST(dns_packet, test_dns_cache)
+{
+	static const uint8_t query[] = {
+		/* Labels */
+		0x03, 0x77, 0x77, 0x77, 0x0d, 0x7a, 0x65, 0x70,
+		0x68, 0x79, 0x72, 0x70, 0x72, 0x6f, 0x6a, 0x65,
+		0x63, 0x74, 0x03, 0x6f, 0x72, 0x67, 0x00,
+		/* Query type */
+		0x00, 0x01
+	};
+	struct dns_msg_t dns_msg = { 0 };
+	uint16_t dns_id = 0;
+	int query_idx = -1;
+	uint16_t query_hash = 0;
+	int count = 0;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_DNS_RESOLVER_CACHE)) {
+		ztest_test_skip();
+	}
+
+	/* Other tests may have cached their answers */
+	dns_cache_flush();
+
+	dns_msg.msg = resp_ipv4;
+	dns_msg.msg_size = sizeof(resp_ipv4);
+
+	dns_id = dns_unpack_header_id(dns_msg.msg);
+
+	/* The hash is calculated from the packed name but the cache uses
+	 * the name given by the user.
+	 */
+	setup_dns_context(&dns_ctx, 0, dns_id, query, sizeof(query),
+			  DNS_QUERY_TYPE_A);
+	dns_ctx.queries[0].query = DNAME1;
+
+	ret = dns_validate_msg(&dns_ctx, &dns_msg, &dns_id, &query_idx,
+			       NULL, &query_hash);
+	zassert_equal(ret, DNS_EAI_ALLDONE, "DNS message failed (%d)", ret);
+
+	/* Answered before returning, without a query being sent */
+	ret = dns_resolve_name(&dns_ctx, DNAME1, DNS_QUERY_TYPE_A, NULL,
+			       cache_cb, &count, 1000);
+	zassert_equal(ret, 0, "Cannot resolve from cache (%d)", ret);
+	zassert_equal(count, -1, "Expected one cached address (%d)", count);
+
+	ret = dns_cache_foreach(cache_entry_cb, NULL);
+	zassert_equal(ret, 1, "Expected one cache entry (%d)", ret);
+
+	dns_cache_flush();
+	ret = dns_cache_foreach(cache_entry_cb, NULL);
+	zassert_equal(ret, 0, "Cache not flushed (%d)", ret);
+}
+
 ZTEST_SUITE(dns_packet, NULL, NULL, NULL, NULL, NULL);
 /* TODO:
  *	1) add malformed DNS data (mostly done)
@@ -0,0 +1,224 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/http/server.h>
+#include <zephyr/net/http/service.h>
+
+#define SERVER_ADDR "127.0.0.1"
+
+static const char index_html[] = "<html>Hello</html>";
+
+static struct http_resource_detail_static index_detail = {
+	.common = {
+		.bitmask_of_supported_http_methods = BIT(HTTP_GET),
+		.type = HTTP_RESOURCE_TYPE_STATIC,
+		.content_type = "text/html",
+	},
+	.static_data = index_html,
+	.static_data_len = sizeof(index_html) - 1,
+};
+
+static size_t body_len;
+static int chunks_left;
+
+static int dynamic_request(struct http_client_ctx *client, const uint8_t *data, size_t len,
+			   bool final, void *user_data)
+{
+	body_len += len;
+	chunks_left = 2;
+
+	return 0;
+}
+
+static int dynamic_response(struct http_client_ctx *client, uint8_t *buf, size_t len,
+			    void *user_data)
+{
+	if (chunks_left == 0) {
+		return 0;
+	}
+
+	chunks_left--;
+	memcpy(buf, "data", 4);
+
+	return 4;
+}
+
+static struct http_resource_detail_dynamic dynamic_detail = {
+	.common = {
+		.bitmask_of_supported_http_methods = BIT(HTTP_GET) | BIT(HTTP_POST),
+		.type = HTTP_RESOURCE_TYPE_DYNAMIC,
+	},
+	.request_cb = dynamic_request,
+	.response_cb = dynamic_response,
+};
+
+static uint16_t test_http_service_port;
+HTTP_SERVICE_DEFINE(test_http_service, SERVER_ADDR, &test_http_service_port, 2, 2, NULL);
+HTTP_RESOURCE_DEFINE(index_resource, test_http_service, "/", &index_detail);
+HTTP_RESOURCE_DEFINE(dynamic_resource, test_http_service, "/dynamic", &dynamic_detail);
+
+#define RESPONSE_INDEX                                                                             \
+	"HTTP/1.1 200 OK\r\n"                                                                      \
+	"Content-Type: text/html\r\n"                                                              \
+	"Content-Length: 18\r\n"                                                                   \
+	"\r\n"                                                                                     \
+	"<html>Hello</html>"
+
+#define RESPONSE_DYNAMIC                                                                           \
+	"HTTP/1.1 200 OK\r\n"                                                                      \
+	"Transfer-Encoding: chunked\r\n"                                                           \
+	"\r\n"                                                                                     \
+	"0004\r\ndata\r\n"                                                                         \
+	"0004\r\ndata\r\n"                                                                         \
+	"0\r\n\r\n"
+
+static char buf[512];
+
+static int connect_server(void)
+{
+	struct timeval timeo = { .tv_sec = 2 };
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(test_http_service_port),
+	};
+	int fd;
+
+	zassert_equal(zsock_inet_pton(AF_INET, SERVER_ADDR, &addr.sin_addr), 1);
+
+	fd = zsock_socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	zassert_true(fd >= 0, "socket failed (%d)", errno);
+	zassert_ok(zsock_setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeo, sizeof(timeo)));
+	zassert_ok(zsock_connect(fd, (struct sockaddr *)&addr, sizeof(addr)),
+		   "connect failed (%d)", errno);
+
+	return fd;
+}
+
+static void send_str(int fd, const char *str)
+{
+	zassert_equal(zsock_send(fd, str, strlen(str), 0), strlen(str));
+}
+
+/* Receive exactly the expected response */
+static void expect_response(int fd, const char *expected)
+{
+	size_t len = strlen(expected);
+	size_t received = 0;
+	ssize_t ret;
+
+	zassert_true(len < sizeof(buf));
+
+	while (received < len) {
+		ret = zsock_recv(fd, &buf[received], len - received, 0);
+		zassert_true(ret > 0, "recv failed (%d)", errno);
+		received += ret;
+	}
+
+	buf[received] = '\0';
+	zassert_ok(strcmp(buf, expected), "unexpected response: %s", buf);
+}
+
+static void expect_closed(int fd)
+{
+	zassert_equal(zsock_recv(fd, buf, sizeof(buf), 0), 0);
+}
+
+ZTEST(http_server_core, test_static)
+{
+	int fd = connect_server();
+
+	send_str(fd, "GET / HTTP/1.1\r\nHost: " SERVER_ADDR "\r\n\r\n");
+	expect_response(fd, RESPONSE_INDEX);
+
+	/* Kept alive, the query is not part of the path */
+	send_str(fd, "GET /?lang=en HTTP/1.1\r\n\r\n");
+	expect_response(fd, RESPONSE_INDEX);
+
+	send_str(fd, "HEAD / HTTP/1.1\r\n\r\n");
+	expect_response(fd, "HTTP/1.1 200 OK\r\n"
+			    "Content-Type: text/html\r\n"
+			    "Content-Length: 18\r\n"
+			    "\r\n");
+
+	zsock_close(fd);
+}
+
+ZTEST(http_server_core, test_dynamic)
+{
+	int fd = connect_server();
+
+	body_len = 0;
+
+	/* Body longer than the receive buffer of the client */
+	send_str(fd, "POST /dynamic HTTP/1.1\r\nContent-Length: 100\r\n\r\n"
+		     "0123456789012345678901234567890123456789012345678901234567890123456789"
+		     "012345678901234567890123456789");
+	expect_response(fd, RESPONSE_DYNAMIC);
+	zassert_equal(body_len, 100);
+
+	zsock_close(fd);
+}
+
+ZTEST(http_server_core, test_pipelined)
+{
+	int fd = connect_server();
+
+	send_str(fd, "GET / HTTP/1.1\r\n\r\n"
+		     "GET /dynamic HTTP/1.1\r\n\r\n"
+		     "GET / HTTP/1.1\r\nConnection: close\r\n\r\n");
+	expect_response(fd, RESPONSE_INDEX);
+	expect_response(fd, RESPONSE_DYNAMIC);
+	expect_response(fd, "HTTP/1.1 200 OK\r\n"
+			    "Content-Type: text/html\r\n"
+			    "Content-Length: 18\r\n"
+			    "Connection: close\r\n"
+			    "\r\n"
+			    "<html>Hello</html>");
+	expect_closed(fd);
+
+	zsock_close(fd);
+}
+
+ZTEST(http_server_core, test_errors)
+{
+	int fd = connect_server();
+
+	send_str(fd, "GET /missing HTTP/1.1\r\n\r\n");
+	expect_response(fd, "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n");
+
+	send_str(fd, "DELETE / HTTP/1.1\r\n\r\n");
+	expect_response(fd, "HTTP/1.1 405 Method Not Allowed\r\nContent-Length: 0\r\n\r\n");
+
+	send_str(fd, "NOT HTTP\r\n\r\n");
+	expect_response(fd, "HTTP/1.1 400 Bad Request\r\n"
+			    "Content-Length: 0\r\n"
+			    "Connection: close\r\n"
+			    "\r\n");
+	expect_closed(fd);
+
+	zsock_close(fd);
+}
+
+static void *http_server_core_setup(void)
+{
+	zassert_ok(http_server_start());
+	zassert_not_equal(test_http_service_port, 0);
+	zassert_equal(http_server_start(), -EALREADY);
+
+	return NULL;
+}
+
+static void http_server_core_teardown(void *fixture)
+{
+	zassert_ok(http_server_stop());
+}
+
+ZTEST_SUITE(http_server_core, NULL, http_server_core_setup, NULL, NULL,
+	    http_server_core_teardown);
@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/net/mqtt.h>
+
+#include "mqtt_internal.h"
+
+#define BUFFER_SIZE 128
+
+static uint8_t rx_buffer[BUFFER_SIZE];
+static uint8_t tx_buffer[BUFFER_SIZE];
+static uint8_t queue_buffer[BUFFER_SIZE] __aligned(4);
+static struct mqtt_client client;
+
+/* Data written by the library, and number of write calls */
+static uint8_t written[512];
+static size_t written_len;
+static int write_count;
+
+/* Data to be read by the library */
+static uint8_t to_read[64];
+static size_t to_read_len;
+static size_t to_read_off;
+
+int mqtt_client_custom_transport_connect(struct mqtt_client *c)
+{
+	return 0;
+}
+
+static void record(const void *data, size_t len)
+{
+	zassert_true(written_len + len <= sizeof(written));
+	memcpy(&written[written_len], data, len);
+	written_len += len;
+}
+
+int mqtt_client_custom_transport_write(struct mqtt_client *c, const uint8_t *data,
+				       uint32_t datalen)
+{
+	record(data, datalen);
+	write_count++;
+
+	return 0;
+}
+
+int mqtt_client_custom_transport_write_msg(struct mqtt_client *c,
+					   const struct msghdr *message)
+{
+	for (size_t i = 0; i < message->msg_iovlen; i++) {
+		record(message->msg_iov[i].iov_base, message->msg_iov[i].iov_len);
+	}
+
+	write_count++;
+
+	return 0;
+}
+
+int mqtt_client_custom_transport_read(struct mqtt_client *c, uint8_t *data,
+				      uint32_t buflen, bool shall_block)
+{
+	size_t len = MIN(buflen, to_read_len - to_read_off);
+
+	if (len == 0) {
+		return -EAGAIN;
+	}
+
+	memcpy(data, &to_read[to_read_off], len);
+	to_read_off += len;
+
+	return len;
+}
+
+int mqtt_client_custom_transport_disconnect(struct mqtt_client *c)
+{
+	return 0;
+}
+
+static void receive(const uint8_t *data, size_t len)
+{
+	memcpy(to_read, data, len);
+	to_read_len = len;
+	to_read_off = 0;
+
+	zassert_ok(mqtt_input(&client));
+	zassert_equal(to_read_off, to_read_len);
+}
+
+static void receive_ack(uint8_t type, uint16_t message_id)
+{
+	const uint8_t ack[] = { type, 0x02, message_id >> 8, message_id & 0xff };
+
+	receive(ack, sizeof(ack));
+}
+
+static void expect_written(const uint8_t *data, size_t len, int count)
+{
+	zassert_equal(write_count, count, "%d writes", write_count);
+	zassert_equal(written_len, len, "%zu bytes written", written_len);
+	zassert_mem_equal(written, data, len);
+
+	written_len = 0;
+	write_count = 0;
+}
+
+static void expect_nothing_written(void)
+{
+	expect_written(NULL, 0, 0);
+}
+
+static void connect_client(void)
+{
+	static const uint8_t connack[] = { 0x20, 0x02, 0x00, 0x00 };
+
+	zassert_ok(mqtt_connect(&client));
+	receive(connack, sizeof(connack));
+	zassert_true(MQTT_HAS_STATE(&client, MQTT_STATE_CONNECTED));
+
+	written_len = 0;
+	write_count = 0;
+}
+
+static int publish(uint8_t qos, uint16_t message_id)
+{
+	struct mqtt_publish_param param = {
+		.message.topic.qos = qos,
+		.message.topic.topic = MQTT_UTF8_LITERAL("t"),
+		.message.payload.data = (uint8_t *)"x",
+		.message.payload.len = 1,
+		.message_id = message_id,
+	};
+
+	return mqtt_publish_queued(&client, &param);
+}
+
+#define PUBLISH_QOS0 0x30, 0x04, 0x00, 0x01, 't', 'x'
+#define PUBLISH_QOS1(id) 0x32, 0x06, 0x00, 0x01, 't', 0x00, id, 'x'
+#define PUBLISH_QOS1_DUP(id) 0x3a, 0x06, 0x00, 0x01, 't', 0x00, id, 'x'
+#define PUBLISH_QOS2(id) 0x34, 0x06, 0x00, 0x01, 't', 0x00, id, 'x'
+#define PUBREL(id) 0x62, 0x02, 0x00, id
+
+ZTEST(mqtt_pub_queue, test_batch)
+{
+	static const uint8_t expected[] = { PUBLISH_QOS0, PUBLISH_QOS0, PUBLISH_QOS0 };
+
+	zassert_ok(publish(0, 0));
+	zassert_ok(publish(0, 0));
+	zassert_ok(publish(0, 0));
+	expect_nothing_written();
+	zassert_equal(mqtt_keepalive_time_left(&client), 0);
+
+	/* One write for all of them */
+	zassert_equal(mqtt_live(&client), -EAGAIN);
+	expect_written(expected, sizeof(expected), 1);
+
+	zassert_equal(mqtt_keepalive_time_left(&client), -1);
+	zassert_equal(client.internal.pub_queue_used, 0);
+}
+
+ZTEST(mqtt_pub_queue, test_inflight_window)
+{
+	static const uint8_t expected[] = { PUBLISH_QOS1(1), PUBLISH_QOS1(2) };
+	static const uint8_t expected_next[] = { PUBLISH_QOS1(3) };
+
+	zassert_ok(publish(1, 1));
+	zassert_ok(publish(1, 2));
+	zassert_ok(publish(1, 3));
+	zassert_equal(publish(1, 3), -EBUSY);
+
+	/* The window is full after two messages */
+	(void)mqtt_live(&client);
+	expect_written(expected, sizeof(expected), 1);
+	zassert_true(mqtt_keepalive_time_left(&client) > 0);
+
+	receive_ack(0x40, 1);
+	expect_written(expected_next, sizeof(expected_next), 1);
+
+	receive_ack(0x40, 3);
+	receive_ack(0x40, 2);
+	expect_nothing_written();
+	zassert_equal(client.internal.pub_queue_used, 0);
+	zassert_equal(client.internal.pub_queue_inflight, 0);
+}
+
+ZTEST(mqtt_pub_queue, test_retry)
+{
+	static const uint8_t expected[] = { PUBLISH_QOS1(4) };
+	static const uint8_t expected_dup[] = { PUBLISH_QOS1_DUP(4) };
+
+	zassert_ok(publish(1, 4));
+	(void)mqtt_live(&client);
+	expect_written(expected, sizeof(expected), 1);
+
+	(void)mqtt_live(&client);
+	expect_nothing_written();
+
+	k_msleep(CONFIG_MQTT_PUBLISH_QUEUE_RETRY_TIMEOUT + 10);
+	zassert_equal(mqtt_keepalive_time_left(&client), 0);
+	(void)mqtt_live(&client);
+	expect_written(expected_dup, sizeof(expected_dup), 1);
+
+	receive_ack(0x40, 4);
+	zassert_equal(client.internal.pub_queue_used, 0);
+}
+
+ZTEST(mqtt_pub_queue, test_qos2)
+{
+	static const uint8_t expected[] = { PUBLISH_QOS2(5) };
+	static const uint8_t expected_pubrel[] = { PUBREL(5) };
+
+	zassert_ok(publish(2, 5));
+	(void)mqtt_live(&client);
+	expect_written(expected, sizeof(expected), 1);
+
+	/* PUBREL is sent by the library */
+	receive_ack(0x50, 5);
+	expect_written(expected_pubrel, sizeof(expected_pubrel), 1);
+
+	k_msleep(CONFIG_MQTT_PUBLISH_QUEUE_RETRY_TIMEOUT + 10);
+	(void)mqtt_live(&client);
+	expect_written(expected_pubrel, sizeof(expected_pubrel), 1);
+
+	receive_ack(0x70, 5);
+	expect_nothing_written();
+	zassert_equal(client.internal.pub_queue_used, 0);
+	zassert_equal(client.internal.pub_queue_inflight, 0);
+}
+
+ZTEST(mqtt_pub_queue, test_reconnect)
+{
+	static const uint8_t expected[] = { PUBLISH_QOS1(6), PUBLISH_QOS0 };
+	static const uint8_t expected_dup[] = { PUBLISH_QOS1_DUP(6) };
+
+	zassert_ok(publish(1, 6));
+	zassert_ok(publish(0, 0));
+	(void)mqtt_live(&client);
+	expect_written(expected, sizeof(expected), 1);
+
+	zassert_ok(mqtt_abort(&client));
+	zassert_equal(publish(1, 7), -ENOTCONN);
+
+	/* Sent again as soon as connected */
+	zassert_ok(mqtt_connect(&client));
+	written_len = 0;
+	write_count = 0;
+	receive((const uint8_t []){ 0x20, 0x02, 0x00, 0x00 }, 4);
+	expect_written(expected_dup, sizeof(expected_dup), 1);
+
+	receive_ack(0x40, 6);
+	zassert_equal(client.internal.pub_queue_used, 0);
+}
+
+ZTEST(mqtt_pub_queue, test_full)
+{
+	int ret;
+	int queued = 0;
+
+	do {
+		ret = publish(1, queued + 1);
+		if (ret == 0) {
+			queued++;
+		}
+	} while (ret == 0);
+
+	zassert_equal(ret, -ENOMEM);
+	zassert_true(queued > 2);
+
+	/* Acknowledged messages make room */
+	(void)mqtt_live(&client);
+	receive_ack(0x40, 1);
+	zassert_ok(publish(1, queued + 1));
+}
+
+static void mqtt_pub_queue_before(void *fixture)
+{
+	mqtt_client_init(&client);
+
+	client.transport.type = MQTT_TRANSPORT_CUSTOM;
+	client.client_id.utf8 = (const uint8_t *)"zephyr";
+	client.client_id.size = strlen("zephyr");
+	client.keepalive = 0;
+	client.rx_buf = rx_buffer;
+	client.rx_buf_size = sizeof(rx_buffer);
+	client.tx_buf = tx_buffer;
+	client.tx_buf_size = sizeof(tx_buffer);
+	client.pub_queue_buf = queue_buffer;
+	client.pub_queue_buf_size = sizeof(queue_buffer);
+
+	connect_client();
+}
+
+static void mqtt_pub_queue_after(void *fixture)
+{
+	(void)mqtt_abort(&client);
+}
+
+ZTEST_SUITE(mqtt_pub_queue, NULL, NULL, mqtt_pub_queue_before,
+	    mqtt_pub_queue_after, NULL);
@@ -280,6 +280,7 @@ static void test_npf_eth_mac_address(void)
 
 	/* insert known src address in the lot */
 	mac_address_list[1] = ETH_SRC_ADDR;
+	npf_update_rules(&npf_recv_rules);
 	zassert_true(net_pkt_filter_recv_ok(pkt), "");
 	npf_insert_recv_rule(&accept_unmatched_src_addr);
 	zassert_true(net_pkt_filter_recv_ok(pkt), "");
@@ -296,6 +297,7 @@ static void test_npf_eth_mac_address(void)
 
 	/* insert known dst address in the lot */
 	mac_address_list[2] = ETH_DST_ADDR;
+	npf_update_rules(&npf_recv_rules);
 	zassert_true(net_pkt_filter_recv_ok(pkt), "");
 	npf_insert_recv_rule(&accept_unmatched_dst_addr);
 	zassert_true(net_pkt_filter_recv_ok(pkt), "");
@@ -321,6 +323,7 @@ static void test_npf_eth_mac_addr_mask(void)
 
 	/* clobber one nibble of matching address from previous test */
 	mac_address_list[1].addr[5] = 0x00;
+	npf_update_rules(&npf_recv_rules);
 	zassert_false(net_pkt_filter_recv_ok(pkt), "");
 
 	/* insert masked address match rule */
@@ -339,6 +342,63 @@ ZTEST(net_pkt_filter_test_suite, test_npf_address_mask)
 	test_npf_eth_mac_addr_mask();
 }
 
+/*
+ * Rule list mixing keyed and other conditions, as compiled into a
+ * decision table when enabled.
+ */
+
+static struct net_eth_addr known_src_addr[] = { ETH_SRC_ADDR };
+
+static NPF_IFACE_MATCH(match_iface_b, &dummy_iface_b);
+static NPF_ETH_TYPE_MATCH(arp_packet, NET_ETH_PTYPE_ARP);
+static NPF_ETH_TYPE_UNMATCH(not_arp_packet, NET_ETH_PTYPE_ARP);
+static NPF_ETH_TYPE_MATCH(ipv6_packet, NET_ETH_PTYPE_IPV6);
+static NPF_ETH_SRC_ADDR_MATCH(known_src, known_src_addr);
+
+static NPF_RULE(reject_arp_iface_b, NET_DROP, match_iface_b, arp_packet);
+static NPF_RULE(reject_ip, NET_DROP, ip_packet);
+static NPF_RULE(accept_ipv6_not_iface_b, NET_OK, ipv6_packet, unmatch_iface_b);
+static NPF_RULE(accept_known_src, NET_OK, known_src, not_arp_packet);
+
+static void check_pkt(int type, int size, struct net_if *iface, bool ok)
+{
+	struct net_pkt *pkt = build_test_pkt(type, size, iface);
+
+	zassert_equal(net_pkt_filter_recv_ok(pkt), ok,
+		      "type 0x%04x size %d iface %p", type, size, iface);
+	net_pkt_unref(pkt);
+}
+
+ZTEST(net_pkt_filter_test_suite, test_npf_mixed_rules)
+{
+	npf_append_recv_rule(&reject_arp_iface_b);
+	npf_append_recv_rule(&small_ip_pkt);
+	npf_append_recv_rule(&reject_ip);
+	npf_append_recv_rule(&accept_ipv6_not_iface_b);
+	npf_append_recv_rule(&accept_known_src);
+	npf_append_recv_rule(&npf_default_drop);
+
+	check_pkt(NET_ETH_PTYPE_ARP, 100, &dummy_iface_a, false);
+	check_pkt(NET_ETH_PTYPE_ARP, 100, &dummy_iface_b, false);
+	check_pkt(NET_ETH_PTYPE_IP, 100, &dummy_iface_b, true);
+	check_pkt(NET_ETH_PTYPE_IP, 300, &dummy_iface_a, false);
+	check_pkt(NET_ETH_PTYPE_IPV6, 300, &dummy_iface_a, true);
+	check_pkt(NET_ETH_PTYPE_IPV6, 300, &dummy_iface_b, true);
+	check_pkt(NET_ETH_PTYPE_PTP, 100, &dummy_iface_b, true);
+
+	/* only the known source rule accepted these */
+	zassert_true(npf_remove_recv_rule(&accept_known_src), "");
+	check_pkt(NET_ETH_PTYPE_IPV6, 300, &dummy_iface_b, false);
+	check_pkt(NET_ETH_PTYPE_PTP, 100, &dummy_iface_b, false);
+	check_pkt(NET_ETH_PTYPE_IPV6, 300, &dummy_iface_a, true);
+
+	zassert_true(npf_remove_recv_rule(&small_ip_pkt), "");
+	check_pkt(NET_ETH_PTYPE_IP, 100, &dummy_iface_b, false);
+
+	zassert_true(npf_remove_all_recv_rules(), "");
+	check_pkt(NET_ETH_PTYPE_ARP, 100, &dummy_iface_b, true);
+}
+
 /*
  * IP address filtering
  */
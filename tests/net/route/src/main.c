@@ -544,6 +544,59 @@ static void test_route_preference(void)
 	net_route_del(route_entry);
 }
 
+static void test_route_longest_prefix(void)
+{
+	struct net_route_entry *wide, *narrow, *host;
+	struct in6_addr addr;
+
+	wide = net_route_add(my_iface, &dest_addr, 64, &peer_addr,
+			     NET_IPV6_ND_INFINITE_LIFETIME,
+			     NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(wide, "Route add failed");
+
+	narrow = net_route_add(my_iface, &dest_addr, 112, &peer_addr_alt,
+			       NET_IPV6_ND_INFINITE_LIFETIME,
+			       NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(narrow, "Route add failed");
+
+	host = net_route_add(my_iface, &dest_addr, 128, &peer_addr,
+			     NET_IPV6_ND_INFINITE_LIFETIME,
+			     NET_ROUTE_PREFERENCE_LOW);
+	zassert_not_null(host, "Route add failed");
+
+	zassert_equal_ptr(net_route_lookup(my_iface, &dest_addr), host,
+			  "Host route not found");
+
+	/* Lookup twice to go through the destination cache */
+	zassert_equal_ptr(net_route_lookup(my_iface, &dest_addr), host,
+			  "Host route not found");
+
+	addr = dest_addr;
+	addr.s6_addr[15] ^= 0x01;
+	zassert_equal_ptr(net_route_lookup(my_iface, &addr), narrow,
+			  "/112 route not found");
+
+	addr.s6_addr[12] ^= 0x80;
+	zassert_equal_ptr(net_route_lookup(my_iface, &addr), wide,
+			  "/64 route not found");
+
+	addr.s6_addr[7] ^= 0x01;
+	zassert_is_null(net_route_lookup(my_iface, &addr),
+			"Route found outside of the prefixes");
+
+	/* Removing routes must not leave stale results behind */
+	zassert_ok(net_route_del(host), "Route del failed");
+	zassert_equal_ptr(net_route_lookup(my_iface, &dest_addr), narrow,
+			  "/112 route not found after del");
+
+	zassert_ok(net_route_del(narrow), "Route del failed");
+	zassert_equal_ptr(net_route_lookup(my_iface, &dest_addr), wide,
+			  "/64 route not found after del");
+
+	zassert_ok(net_route_del(wide), "Route del failed");
+	zassert_is_null(net_route_lookup(my_iface, &dest_addr),
+			"Route found after del");
+}
 
 /*test case main entry*/
 ZTEST(route_test_suite, test_route)
@@ -566,6 +619,7 @@ ZTEST(route_test_suite, test_route)
 	test_route_del_many();
 	test_route_lifetime();
 	test_route_preference();
+	test_route_longest_prefix();
 }
 
 ZTEST_SUITE(route_test_suite, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,383 @@
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
+
+#include <zephyr/ztest_assert.h>
+
+#include <zephyr/net/socket.h>
+#include <zephyr/posix/sys/eventfd.h>
+
+#include "../../socket_helpers.h"
+
+#define BUF_AND_SIZE(buf) buf, sizeof(buf) - 1
+#define STRLEN(buf) (sizeof(buf) - 1)
+
+#define TEST_STR_SMALL "test"
+
+#define MY_IPV6_ADDR "::1"
+
+#define SERVER_PORT 4242
+#define CLIENT_PORT 9898
+
+/* Time for a datagram or segment to go through the loopback interface */
+#define WAIT_MS 100
+
+static void epoll_add(int epfd, int fd, uint32_t events)
+{
+	struct epoll_event ev = {
+		.events = events,
+		.data.fd = fd,
+	};
+	int res;
+
+	res = epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev);
+	zassert_equal(res, 0, "epoll_ctl ADD failed (%d)", errno);
+}
+
+static void epoll_mod(int epfd, int fd, uint32_t events)
+{
+	struct epoll_event ev = {
+		.events = events,
+		.data.fd = fd,
+	};
+	int res;
+
+	res = epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &ev);
+	zassert_equal(res, 0, "epoll_ctl MOD failed (%d)", errno);
+}
+
+static void check_ready(int epfd, int fd, uint32_t events)
+{
+	struct epoll_event ev[2];
+	int res;
+
+	res = epoll_wait(epfd, ev, ARRAY_SIZE(ev), WAIT_MS);
+	zassert_equal(res, 1, "expected one ready descriptor, got %d", res);
+	zassert_equal(ev[0].data.fd, fd, "wrong descriptor %d reported", ev[0].data.fd);
+	zassert_equal(ev[0].events, events, "wrong events 0x%x", ev[0].events);
+}
+
+static void check_not_ready(int epfd)
+{
+	struct epoll_event ev[2];
+	int res;
+
+	res = epoll_wait(epfd, ev, ARRAY_SIZE(ev), 0);
+	zassert_equal(res, 0, "unexpected ready descriptor");
+}
+
+ZTEST(net_socket_epoll, test_udp)
+{
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	char buf[10];
+	int c_sock;
+	int s_sock;
+	int epfd;
+	int res;
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	res = bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "bind failed");
+
+	res = connect(c_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "connect failed");
+
+	epfd = epoll_create(1);
+	zassert_true(epfd >= 0, "epoll_create failed (%d)", errno);
+
+	epoll_add(epfd, s_sock, EPOLLIN);
+	check_not_ready(epfd);
+
+	res = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(res, STRLEN(TEST_STR_SMALL), "send failed");
+	res = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(res, STRLEN(TEST_STR_SMALL), "send failed");
+
+	/* Reported once however many datagrams are queued, and again as
+	 * long as any of them is left.
+	 */
+	check_ready(epfd, s_sock, EPOLLIN);
+
+	res = recv(s_sock, buf, sizeof(buf), 0);
+	zassert_equal(res, STRLEN(TEST_STR_SMALL), "recv failed");
+
+	check_ready(epfd, s_sock, EPOLLIN);
+
+	res = recv(s_sock, buf, sizeof(buf), 0);
+	zassert_equal(res, STRLEN(TEST_STR_SMALL), "recv failed");
+
+	check_not_ready(epfd);
+
+	/* UDP sockets are always writable */
+	epoll_add(epfd, c_sock, EPOLLOUT);
+	check_ready(epfd, c_sock, EPOLLOUT);
+
+	res = epoll_ctl(epfd, EPOLL_CTL_DEL, c_sock, NULL);
+	zassert_equal(res, 0, "epoll_ctl DEL failed");
+	res = epoll_ctl(epfd, EPOLL_CTL_DEL, s_sock, NULL);
+	zassert_equal(res, 0, "epoll_ctl DEL failed");
+
+	res = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(res, STRLEN(TEST_STR_SMALL), "send failed");
+	k_msleep(WAIT_MS);
+
+	check_not_ready(epfd);
+
+	zassert_ok(close(epfd), "close failed");
+	zassert_ok(close(c_sock), "close failed");
+	zassert_ok(close(s_sock), "close failed");
+}
+
+ZTEST(net_socket_epoll, test_tcp)
+{
+	struct sockaddr_in6 c_addr;
+	struct sockaddr_in6 s_addr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	char buf[10];
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	int epfd;
+	int res;
+
+	prepare_sock_tcp_v6(MY_IPV6_ADDR, CLIENT_PORT, &c_sock, &c_addr);
+	prepare_sock_tcp_v6(MY_IPV6_ADDR, SERVER_PORT, &s_sock, &s_addr);
+
+	res = bind(s_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "bind failed");
+	res = listen(s_sock, 0);
+	zassert_equal(res, 0, "listen failed");
+
+	epfd = epoll_create(1);
+	zassert_true(epfd >= 0, "epoll_create failed (%d)", errno);
+
+	epoll_add(epfd, s_sock, EPOLLIN);
+	check_not_ready(epfd);
+
+	res = connect(c_sock, (struct sockaddr *)&s_addr, sizeof(s_addr));
+	zassert_equal(res, 0, "connect failed");
+
+	check_ready(epfd, s_sock, EPOLLIN);
+
+	new_sock = accept(s_sock, &addr, &addrlen);
+	zassert_true(new_sock >= 0, "accept failed");
+
+	check_not_ready(epfd);
+
+	epoll_add(epfd, new_sock, EPOLLIN | EPOLLOUT);
+	check_ready(epfd, new_sock, EPOLLOUT);
+
+	epoll_mod(epfd, new_sock, EPOLLIN);
+	check_not_ready(epfd);
+
+	res = send(c_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(res, STRLEN(TEST_STR_SMALL), "send failed");
+
+	check_ready(epfd, new_sock, EPOLLIN);
+
+	res = recv(new_sock, buf, sizeof(buf), 0);
+	zassert_equal(res, STRLEN(TEST_STR_SMALL), "recv failed");
+
+	check_not_ready(epfd);
+
+	/* Peer closing the connection is always reported */
+	zassert_ok(close(c_sock), "close failed");
+
+	check_ready(epfd, new_sock, EPOLLIN | EPOLLHUP);
+
+	/* Closing a descriptor removes it from the instance */
+	zassert_ok(close(new_sock), "close failed");
+
+	check_not_ready(epfd);
+
+	res = epoll_ctl(epfd, EPOLL_CTL_DEL, new_sock, NULL);
+	zassert_equal(res, -1, "epoll_ctl DEL on closed socket succeeded");
+
+	zassert_ok(close(s_sock), "close failed");
+	zassert_ok(close(epfd), "close failed");
+
+	/* Let the connection get closed */
+	k_sleep(K_SECONDS(1));
+}
+
+ZTEST(net_socket_epoll, test_socketpair_oneshot)
+{
+	struct epoll_event ev[2];
+	char buf[10];
+	int sv[2];
+	int epfd;
+	int res;
+
+	res = socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+	zassert_equal(res, 0, "socketpair failed");
+
+	epfd = epoll_create(1);
+	zassert_true(epfd >= 0, "epoll_create failed (%d)", errno);
+
+	epoll_add(epfd, sv[0], EPOLLIN | EPOLLONESHOT);
+	check_not_ready(epfd);
+
+	res = send(sv[1], BUF_AND_SIZE(TEST_STR_SMALL), 0);
+	zassert_equal(res, STRLEN(TEST_STR_SMALL), "send failed");
+
+	check_ready(epfd, sv[0], EPOLLIN);
+
+	/* Still readable, but disabled until modified */
+	check_not_ready(epfd);
+
+	epoll_mod(epfd, sv[0], EPOLLIN);
+	check_ready(epfd, sv[0], EPOLLIN);
+
+	res = recv(sv[0], buf, sizeof(buf), 0);
+	zassert_equal(res, STRLEN(TEST_STR_SMALL), "recv failed");
+
+	res = epoll_wait(epfd, ev, ARRAY_SIZE(ev), 0);
+	zassert_equal(res, 0, "unexpected ready descriptor");
+
+	zassert_ok(close(epfd), "close failed");
+	zassert_ok(close(sv[0]), "close failed");
+	zassert_ok(close(sv[1]), "close failed");
+}
+
+ZTEST(net_socket_epoll, test_eventfd)
+{
+	eventfd_t val;
+	int efd;
+	int epfd;
+	int res;
+
+	efd = eventfd(0, 0);
+	zassert_true(efd >= 0, "eventfd failed");
+
+	epfd = epoll_create(1);
+	zassert_true(epfd >= 0, "epoll_create failed (%d)", errno);
+
+	epoll_add(epfd, efd, EPOLLIN);
+	check_not_ready(epfd);
+
+	res = eventfd_write(efd, 3);
+	zassert_equal(res, 0, "eventfd_write failed");
+
+	check_ready(epfd, efd, EPOLLIN);
+
+	res = eventfd_read(efd, &val);
+	zassert_equal(res, 0, "eventfd_read failed");
+	zassert_equal(val, 3, "wrong value");
+
+	check_not_ready(epfd);
+
+	zassert_ok(zsock_close(epfd), "close failed");
+	zassert_ok(zsock_close(efd), "close failed");
+}
+
+static int wakeup_sock;
+
+static void wakeup_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	(void)send(wakeup_sock, BUF_AND_SIZE(TEST_STR_SMALL), 0);
+}
+
+static K_WORK_DELAYABLE_DEFINE(wakeup_work, wakeup_handler);
+
+ZTEST(net_socket_epoll, test_wait_blocks)
+{
+	struct epoll_event ev[2];
+	int sv[2];
+	uint32_t tstamp;
+	int epfd;
+	int res;
+
+	res = socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+	zassert_equal(res, 0, "socketpair failed");
+
+	epfd = epoll_create(1);
+	zassert_true(epfd >= 0, "epoll_create failed (%d)", errno);
+
+	epoll_add(epfd, sv[0], EPOLLIN);
+
+	tstamp = k_uptime_get_32();
+	res = epoll_wait(epfd, ev, ARRAY_SIZE(ev), WAIT_MS);
+	zassert_equal(res, 0, "unexpected ready descriptor");
+	zassert_true(k_uptime_get_32() - tstamp >= WAIT_MS, "returned early");
+
+	wakeup_sock = sv[1];
+	k_work_schedule(&wakeup_work, K_MSEC(WAIT_MS));
+
+	res = epoll_wait(epfd, ev, ARRAY_SIZE(ev), -1);
+	zassert_equal(res, 1, "epoll_wait failed");
+	zassert_equal(ev[0].data.fd, sv[0], "wrong descriptor reported");
+	zassert_equal(ev[0].events, EPOLLIN, "wrong events");
+
+	zassert_ok(close(epfd), "close failed");
+	zassert_ok(close(sv[0]), "close failed");
+	zassert_ok(close(sv[1]), "close failed");
+}
+
+ZTEST(net_socket_epoll, test_ctl_errors)
+{
+	struct epoll_event ev = { .events = EPOLLIN };
+	struct epoll_event out;
+	int sv[2];
+	int epfd;
+	int epfd2;
+	int res;
+
+	res = epoll_create(0);
+	zassert_equal(res, -1, "epoll_create with size 0 succeeded");
+	zassert_equal(errno, EINVAL, "wrong errno");
+
+	res = socketpair(AF_UNIX, SOCK_STREAM, 0, sv);
+	zassert_equal(res, 0, "socketpair failed");
+
+	epfd = epoll_create(1);
+	zassert_true(epfd >= 0, "epoll_create failed (%d)", errno);
+
+	res = epoll_ctl(sv[0], EPOLL_CTL_ADD, sv[1], &ev);
+	zassert_equal(res, -1, "epoll_ctl on non-epoll descriptor succeeded");
+	zassert_equal(errno, EINVAL, "wrong errno");
+
+	res = epoll_ctl(epfd, EPOLL_CTL_ADD, epfd, &ev);
+	zassert_equal(res, -1, "adding the instance to itself succeeded");
+	zassert_equal(errno, EINVAL, "wrong errno");
+
+	epfd2 = epoll_create(1);
+	zassert_true(epfd2 >= 0, "epoll_create failed (%d)", errno);
+
+	res = epoll_ctl(epfd, EPOLL_CTL_ADD, epfd2, &ev);
+	zassert_equal(res, -1, "adding another instance succeeded");
+	zassert_equal(errno, EINVAL, "wrong errno");
+
+	zassert_ok(close(epfd2), "close failed");
+
+	res = epoll_ctl(epfd, EPOLL_CTL_MOD, sv[0], &ev);
+	zassert_equal(res, -1, "modifying a missing descriptor succeeded");
+	zassert_equal(errno, ENOENT, "wrong errno");
+
+	res = epoll_ctl(epfd, EPOLL_CTL_ADD, sv[0], &ev);
+	zassert_equal(res, 0, "epoll_ctl ADD failed");
+
+	res = epoll_ctl(epfd, EPOLL_CTL_ADD, sv[0], &ev);
+	zassert_equal(res, -1, "adding a descriptor twice succeeded");
+	zassert_equal(errno, EEXIST, "wrong errno");
+
+	res = epoll_wait(epfd, &out, 0, 0);
+	zassert_equal(res, -1, "epoll_wait without room for events succeeded");
+	zassert_equal(errno, EINVAL, "wrong errno");
+
+	zassert_ok(close(epfd), "close failed");
+	zassert_ok(close(sv[0]), "close failed");
+	zassert_ok(close(sv[1]), "close failed");
+}
+
+ZTEST_SUITE(net_socket_epoll, NULL, NULL, NULL, NULL, NULL);
@@ -1197,6 +1197,67 @@ ZTEST(net_socket_tcp, test_so_protocol)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_tcp_congestion)
+{
+	struct sockaddr_in bind_addr4;
+	int sock, rv;
+	char name[16];
+	socklen_t optlen;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &sock, &bind_addr4);
+
+	optlen = sizeof(name);
+	rv = getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(rv, 0, "getsockopt failed (%d)", errno);
+	zassert_true(optlen > 0 && name[optlen - 1] == '\0',
+		     "getsockopt got invalid name");
+
+	rv = setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "reno", strlen("reno"));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+	optlen = sizeof(name);
+	rv = getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(rv, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(strcmp(name, "reno"), 0, "getsockopt got invalid name");
+
+	optlen = 2;
+	rv = getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(rv, 0, "getsockopt failed (%d)", errno);
+	zassert_equal(optlen, 2, "getsockopt did not truncate the name");
+	zassert_mem_equal(name, "re", 2, "getsockopt got invalid name");
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_CUBIC)) {
+		rv = setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "cubic",
+				strlen("cubic"));
+		zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+		optlen = sizeof(name);
+		rv = getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+		zassert_equal(rv, 0, "getsockopt failed (%d)", errno);
+		zassert_equal(strcmp(name, "cubic"), 0, "getsockopt got invalid name");
+	}
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_BBR)) {
+		rv = setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "bbr",
+				strlen("bbr"));
+		zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+		optlen = sizeof(name);
+		rv = getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+		zassert_equal(rv, 0, "getsockopt failed (%d)", errno);
+		zassert_equal(strcmp(name, "bbr"), 0, "getsockopt got invalid name");
+	}
+
+	rv = setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "unknown",
+			strlen("unknown"));
+	zassert_equal(rv, -1, "setsockopt accepted an unknown algorithm");
+	zassert_equal(errno, ENOENT, "setsockopt failed with %d", errno);
+
+	test_close(sock);
+
+	test_context_cleanup();
+}
+
 ZTEST(net_socket_tcp, test_so_rcvbuf)
 {
 	struct sockaddr_in bind_addr4;
@@ -2207,6 +2268,74 @@ ZTEST(net_socket_tcp, test_connect_and_wait_for_v4_poll)
 	zassert_equal(ret, 0, "close failed, %d", errno);
 }
 
+#if defined(CONFIG_NET_SOCKETS_SEND_BUF)
+static atomic_t send_buf_released;
+
+static void send_buf_destroy(struct net_buf *buf)
+{
+	atomic_inc(&send_buf_released);
+	net_buf_destroy(buf);
+}
+
+NET_BUF_POOL_FIXED_DEFINE(send_buf_pool, 2, 0, 0, send_buf_destroy);
+
+ZTEST(net_socket_tcp, test_v4_send_buf)
+{
+	/* Test that zsock_send_buf() sends external data without copying it
+	 * and that TCP releases the buffers once they are acknowledged.
+	 */
+	static char data[] = TEST_STR_SMALL;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	struct net_buf *head, *tail;
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	ssize_t ret;
+
+	atomic_clear(&send_buf_released);
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+
+	head = net_buf_alloc_with_data(&send_buf_pool, data, 2, K_NO_WAIT);
+	zassert_not_null(head, "buffer allocation failed");
+	tail = net_buf_alloc_with_data(&send_buf_pool, data + 2,
+				       strlen(TEST_STR_SMALL) - 2, K_NO_WAIT);
+	zassert_not_null(tail, "buffer allocation failed");
+	net_buf_frag_add(head, tail);
+
+	ret = zsock_send_buf(c_sock, head, 0, NULL, 0);
+	zassert_equal(ret, strlen(TEST_STR_SMALL), "send_buf failed");
+
+	net_buf_unref(head);
+
+	test_recv(new_sock, 0);
+
+	/* Wait for the ACK to release the data */
+	for (int i = 0; i < 10 && atomic_get(&send_buf_released) < 2; i++) {
+		k_msleep(THREAD_SLEEP);
+	}
+
+	zassert_equal(atomic_get(&send_buf_released), 2,
+		      "buffers not released after ACK");
+
+	test_close(c_sock);
+	test_close(new_sock);
+	test_close(s_sock);
+
+	test_context_cleanup();
+}
+#endif /* CONFIG_NET_SOCKETS_SEND_BUF */
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
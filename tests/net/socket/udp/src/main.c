@@ -12,6 +12,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/sys/mutex.h>
 #include <zephyr/ztest_assert.h>
 
+#include <zephyr/net/net_pkt.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/net/ethernet.h>
 
@@ -1383,6 +1384,292 @@ ZTEST(net_socket_udp, test_25_v6_dgram_connected)
 			     (struct sockaddr *)&server_addr_2, sizeof(server_addr_2));
 }
 
+#if defined(CONFIG_NET_SOCKETS_RECV_PKT)
+static void test_recv_pkt(int sock_c, int sock_s,
+			  struct sockaddr *addr_c, socklen_t addrlen_c,
+			  struct sockaddr *addr_s, socklen_t addrlen_s)
+{
+	struct sockaddr_storage src_addr;
+	socklen_t src_addrlen = sizeof(src_addr);
+	struct net_pkt *pkt;
+	int rv;
+
+	rv = bind(sock_s, addr_s, addrlen_s);
+	zassert_equal(rv, 0, "server bind failed");
+
+	rv = bind(sock_c, addr_c, addrlen_c);
+	zassert_equal(rv, 0, "client bind failed");
+
+	rv = zsock_recv_pkt(sock_s, &pkt, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(rv, -1, "recv_pkt on empty socket succeeded");
+	zassert_equal(errno, EAGAIN, "incorrect errno value");
+	zassert_is_null(pkt, "packet returned on failure");
+
+	rv = zsock_recv_pkt(sock_s, &pkt, ZSOCK_MSG_PEEK, NULL, NULL);
+	zassert_equal(rv, -1, "recv_pkt with MSG_PEEK succeeded");
+	zassert_equal(errno, EOPNOTSUPP, "incorrect errno value");
+
+	rv = sendto(sock_c, BUF_AND_SIZE(TEST_STR_SMALL), 0, addr_s, addrlen_s);
+	zassert_equal(rv, STRLEN(TEST_STR_SMALL), "sendto failed");
+
+	rv = zsock_recv_pkt(sock_s, &pkt, 0, (struct sockaddr *)&src_addr,
+			    &src_addrlen);
+	zassert_equal(rv, STRLEN(TEST_STR_SMALL), "recv_pkt failed");
+	zassert_not_null(pkt, "no packet returned");
+	zassert_equal(src_addrlen, addrlen_c, "invalid address length");
+	zassert_mem_equal(&src_addr, addr_c, addrlen_c, "invalid source address");
+
+	memset(rx_buf, 0, sizeof(rx_buf));
+	rv = net_pkt_read(pkt, rx_buf, STRLEN(TEST_STR_SMALL));
+	zassert_equal(rv, 0, "payload read failed");
+	zassert_mem_equal(rx_buf, BUF_AND_SIZE(TEST_STR_SMALL), "wrong data");
+
+	zsock_release_pkt(pkt);
+
+	rv = close(sock_c);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(sock_s);
+	zassert_equal(rv, 0, "close failed");
+}
+
+ZTEST(net_socket_udp, test_26_v4_recv_pkt)
+{
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	test_recv_pkt(client_sock, server_sock,
+		      (struct sockaddr *)&client_addr, sizeof(client_addr),
+		      (struct sockaddr *)&server_addr, sizeof(server_addr));
+}
+
+ZTEST(net_socket_udp, test_27_v6_recv_pkt)
+{
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in6 client_addr;
+	struct sockaddr_in6 server_addr;
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	test_recv_pkt(client_sock, server_sock,
+		      (struct sockaddr *)&client_addr, sizeof(client_addr),
+		      (struct sockaddr *)&server_addr, sizeof(server_addr));
+}
+#endif /* CONFIG_NET_SOCKETS_RECV_PKT */
+
+#if defined(CONFIG_NET_SOCKETS_SEND_BUF)
+static atomic_t send_buf_released;
+
+static void send_buf_destroy(struct net_buf *buf)
+{
+	atomic_inc(&send_buf_released);
+	net_buf_destroy(buf);
+}
+
+NET_BUF_POOL_FIXED_DEFINE(send_buf_pool, 1, 0, 0, send_buf_destroy);
+
+static void test_send_buf(int sock_c, int sock_s,
+			  struct sockaddr *addr_c, socklen_t addrlen_c,
+			  struct sockaddr *addr_s, socklen_t addrlen_s)
+{
+	static char data[] = TEST_STR_SMALL;
+	struct net_buf *buf;
+	int rv;
+
+	atomic_clear(&send_buf_released);
+
+	rv = bind(sock_s, addr_s, addrlen_s);
+	zassert_equal(rv, 0, "server bind failed");
+
+	rv = bind(sock_c, addr_c, addrlen_c);
+	zassert_equal(rv, 0, "client bind failed");
+
+	buf = net_buf_alloc_with_data(&send_buf_pool, data, STRLEN(TEST_STR_SMALL),
+				      K_NO_WAIT);
+	zassert_not_null(buf, "buffer allocation failed");
+
+	rv = zsock_send_buf(sock_c, buf, 0, addr_s, addrlen_s);
+	zassert_equal(rv, STRLEN(TEST_STR_SMALL), "send_buf failed");
+
+	/* Unconnected socket without a destination */
+	rv = zsock_send_buf(sock_c, buf, 0, NULL, 0);
+	zassert_equal(rv, -1, "send_buf without destination succeeded");
+	zassert_equal(errno, EDESTADDRREQ, "incorrect errno value");
+
+	net_buf_unref(buf);
+
+	memset(rx_buf, 0, sizeof(rx_buf));
+	rv = recv(sock_s, rx_buf, sizeof(rx_buf), 0);
+	zassert_equal(rv, STRLEN(TEST_STR_SMALL), "recv failed");
+	zassert_mem_equal(rx_buf, BUF_AND_SIZE(TEST_STR_SMALL), "wrong data");
+
+	zassert_equal(atomic_get(&send_buf_released), 1,
+		      "buffer not released after transmission");
+
+	rv = close(sock_c);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(sock_s);
+	zassert_equal(rv, 0, "close failed");
+}
+
+ZTEST(net_socket_udp, test_28_v4_send_buf)
+{
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	test_send_buf(client_sock, server_sock,
+		      (struct sockaddr *)&client_addr, sizeof(client_addr),
+		      (struct sockaddr *)&server_addr, sizeof(server_addr));
+}
+
+ZTEST(net_socket_udp, test_29_v6_send_buf)
+{
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in6 client_addr;
+	struct sockaddr_in6 server_addr;
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	test_send_buf(client_sock, server_sock,
+		      (struct sockaddr *)&client_addr, sizeof(client_addr),
+		      (struct sockaddr *)&server_addr, sizeof(server_addr));
+}
+#endif /* CONFIG_NET_SOCKETS_SEND_BUF */
+
+static void test_mmsg(int sock_c, int sock_s,
+		      struct sockaddr *addr_c, socklen_t addrlen_c,
+		      struct sockaddr *addr_s, socklen_t addrlen_s)
+{
+	static const char hdr[3] = { 'a', 'b', 'c' };
+	struct sockaddr_storage src_addr[3];
+	struct zsock_mmsghdr msgs[3];
+	struct iovec iov[3][2];
+	char bufs[3][sizeof(TEST_STR_SMALL)];
+	int rv;
+
+	rv = bind(sock_s, addr_s, addrlen_s);
+	zassert_equal(rv, 0, "server bind failed");
+
+	rv = bind(sock_c, addr_c, addrlen_c);
+	zassert_equal(rv, 0, "client bind failed");
+
+	memset(msgs, 0, sizeof(msgs));
+
+	for (int i = 0; i < ARRAY_SIZE(msgs); i++) {
+		iov[i][0].iov_base = (void *)&hdr[i];
+		iov[i][0].iov_len = 1;
+		iov[i][1].iov_base = TEST_STR_SMALL;
+		iov[i][1].iov_len = STRLEN(TEST_STR_SMALL);
+
+		msgs[i].msg_hdr.msg_name = addr_s;
+		msgs[i].msg_hdr.msg_namelen = addrlen_s;
+		msgs[i].msg_hdr.msg_iov = iov[i];
+		msgs[i].msg_hdr.msg_iovlen = 2;
+	}
+
+	rv = sendmmsg(sock_c, msgs, ARRAY_SIZE(msgs), 0);
+	zassert_equal(rv, ARRAY_SIZE(msgs), "sendmmsg failed (%d)", errno);
+
+	for (int i = 0; i < ARRAY_SIZE(msgs); i++) {
+		zassert_equal(msgs[i].msg_len, STRLEN(TEST_STR_SMALL) + 1,
+			      "invalid sent length");
+	}
+
+	/* Give the packets a chance to go through the net stack */
+	k_msleep(10);
+
+	memset(msgs, 0, sizeof(msgs));
+	memset(bufs, 0, sizeof(bufs));
+	memset(src_addr, 0, sizeof(src_addr));
+
+	for (int i = 0; i < ARRAY_SIZE(msgs); i++) {
+		iov[i][0].iov_base = bufs[i];
+		iov[i][0].iov_len = 1;
+		iov[i][1].iov_base = &bufs[i][1];
+		iov[i][1].iov_len = STRLEN(TEST_STR_SMALL);
+
+		msgs[i].msg_hdr.msg_name = &src_addr[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(src_addr[i]);
+		msgs[i].msg_hdr.msg_iov = iov[i];
+		msgs[i].msg_hdr.msg_iovlen = 2;
+	}
+
+	/* Last buffer is too short to hold the datagram */
+	iov[2][1].iov_len = 1;
+
+	rv = recvmmsg(sock_s, msgs, ARRAY_SIZE(msgs), MSG_WAITFORONE);
+	zassert_equal(rv, ARRAY_SIZE(msgs), "recvmmsg failed (%d)", errno);
+
+	for (int i = 0; i < ARRAY_SIZE(msgs); i++) {
+		zassert_equal(bufs[i][0], hdr[i], "wrong message order");
+		zassert_equal(msgs[i].msg_hdr.msg_namelen, addrlen_c,
+			      "invalid address length");
+		zassert_mem_equal(&src_addr[i], addr_c, addrlen_c,
+				  "invalid source address");
+	}
+
+	zassert_equal(msgs[0].msg_len, STRLEN(TEST_STR_SMALL) + 1,
+		      "invalid received length");
+	zassert_mem_equal(&bufs[1][1], BUF_AND_SIZE(TEST_STR_SMALL),
+			  "wrong data");
+	zassert_equal(msgs[1].msg_hdr.msg_flags, 0, "unexpected flags");
+	zassert_equal(msgs[2].msg_len, 2, "invalid truncated length");
+	zassert_equal(msgs[2].msg_hdr.msg_flags, MSG_TRUNC,
+		      "truncation not reported");
+
+	rv = recvmmsg(sock_s, msgs, ARRAY_SIZE(msgs), MSG_DONTWAIT);
+	zassert_equal(rv, -1, "recvmmsg on empty socket succeeded");
+	zassert_equal(errno, EAGAIN, "incorrect errno value");
+
+	rv = close(sock_c);
+	zassert_equal(rv, 0, "close failed");
+	rv = close(sock_s);
+	zassert_equal(rv, 0, "close failed");
+}
+
+ZTEST(net_socket_udp, test_30_v4_mmsg)
+{
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	test_mmsg(client_sock, server_sock,
+		  (struct sockaddr *)&client_addr, sizeof(client_addr),
+		  (struct sockaddr *)&server_addr, sizeof(server_addr));
+}
+
+ZTEST(net_socket_udp, test_31_v6_mmsg)
+{
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in6 client_addr;
+	struct sockaddr_in6 server_addr;
+
+	prepare_sock_udp_v6(MY_IPV6_ADDR, CLIENT_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v6(MY_IPV6_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	test_mmsg(client_sock, server_sock,
+		  (struct sockaddr *)&client_addr, sizeof(client_addr),
+		  (struct sockaddr *)&server_addr, sizeof(server_addr));
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
@@ -134,6 +134,7 @@ static void handle_server_recv_out_of_order(struct net_pkt *pkt);
 static void handle_server_rst_on_closed_port(sa_family_t af, struct tcphdr *th);
 static void handle_server_rst_on_listening_port(sa_family_t af, struct tcphdr *th);
 static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
+static void handle_server_sack(struct net_pkt *pkt);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -235,7 +236,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	uint8_t opts_len = 0;
 	int ret = -EINVAL;
 
-	if ((test_case_no == 4U) && (flags & SYN)) {
+	if ((test_case_no == 4U || test_case_no == 16U) && (flags & SYN)) {
 		opts_len = sizeof(tcp_options);
 	}
 
@@ -271,7 +272,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == 4U) && (flags & SYN)) {
+	if ((test_case_no == 4U || test_case_no == 16U) && (flags & SYN)) {
 		th->th_off = 10U;
 	} else {
 		th->th_off = 5U;
@@ -290,7 +291,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == 4U) && (flags & SYN)) {
+	if ((test_case_no == 4U || test_case_no == 16U) && (flags & SYN)) {
 		/* Add TCP Options */
 		ret = net_pkt_write(pkt, tcp_options, opts_len);
 		if (ret < 0) {
@@ -468,6 +469,9 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case 15:
 		handle_syn_invalid_ack(net_pkt_family(pkt), &th);
 		break;
+	case 16:
+		handle_server_sack(pkt);
+		break;
 
 	default:
 		zassert_true(false, "Undefined test case");
@@ -873,6 +877,7 @@ ZTEST(net_tcp, test_server_ipv4)
 ZTEST(net_tcp, test_server_with_options_ipv4)
 {
 	struct net_context *ctx;
+	struct tcp *conn;
 	int ret;
 
 	t_state = T_SYN;
@@ -910,6 +915,15 @@ ZTEST(net_tcp, test_server_with_options_ipv4)
 	 */
 	test_sem_take(K_MSEC(100), __LINE__);
 
+	/* The peer offered both window scaling and SACK */
+	conn = accepted_ctx->tcp;
+	zassert_equal(conn->wscale_ok, IS_ENABLED(CONFIG_NET_TCP_WINDOW_SCALE),
+		      "Window scaling not negotiated");
+	zassert_equal(conn->snd_wscale, conn->wscale_ok ? 7 : 0,
+		      "Invalid peer window scale %u", conn->snd_wscale);
+	zassert_equal(conn->sack_ok, IS_ENABLED(CONFIG_NET_TCP_SACK),
+		      "SACK not negotiated");
+
 	/* Trigger the peer to send DATA  */
 	k_work_reschedule(&test_server, K_NO_WAIT);
 
@@ -2127,4 +2141,209 @@ ZTEST(net_tcp, test_client_rst_on_unexpected_ack_on_syn)
 	test_sem_take(K_MSEC(100), __LINE__);
 }
 
+static int read_tcp_options(struct net_pkt *pkt, struct tcphdr *th,
+			    uint8_t *options)
+{
+	int len = (th->th_off - 5) * 4;
+	int ret;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	ret = net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) +
+			   net_pkt_ip_opts_len(pkt) + sizeof(struct tcphdr));
+	if (ret == 0) {
+		ret = net_pkt_read(pkt, options, len);
+	}
+
+	net_pkt_cursor_init(pkt);
+
+	return ret < 0 ? ret : len;
+}
+
+static const uint8_t *find_tcp_option(const uint8_t *options, int len,
+				      uint8_t kind)
+{
+	int i = 0;
+
+	while (i < len && options[i] != NET_TCP_END_OPT) {
+		if (options[i] == NET_TCP_NOP_OPT) {
+			i++;
+			continue;
+		}
+
+		if (options[i] == kind) {
+			return &options[i];
+		}
+
+		i += options[i + 1];
+	}
+
+	return NULL;
+}
+
+static uint32_t sack_start;
+static uint32_t sack_end;
+
+/* Test case scenario IPv4
+ *   send SYN with options,
+ *   expect SYN ACK with SACK permitted,
+ *   send out-of-order DATA,
+ *   expect duplicate ACK with a SACK block,
+ *   send the missing DATA,
+ *   expect ACK covering all the data without SACK blocks.
+ */
+static void handle_server_sack(struct net_pkt *pkt)
+{
+	uint8_t options[40];
+	const uint8_t *opt;
+	struct net_pkt *reply;
+	struct tcphdr th;
+	int len;
+	int ret;
+
+	ret = read_tcp_header(pkt, &th);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	len = read_tcp_options(pkt, &th, options);
+	if (len < 0) {
+		goto fail;
+	}
+
+	switch (t_state) {
+	case T_SYN_ACK:
+		test_verify_flags(&th, SYN | ACK);
+		zassert_not_null(find_tcp_option(options, len,
+						 NET_TCP_SACK_PERM_OPT),
+				 "SACK permitted option missing");
+		seq++;
+		ack = ntohl(th.th_seq) + 1U;
+		reply = prepare_ack_packet(AF_INET, htons(MY_PORT),
+					   htons(PEER_PORT));
+		t_state = T_DATA_ACK;
+		break;
+	case T_DATA_ACK:
+		test_verify_flags(&th, ACK);
+		zassert_equal(ntohl(th.th_ack), expected_ack,
+			      "Expected ACK %u but got %u", expected_ack,
+			      ntohl(th.th_ack));
+
+		opt = find_tcp_option(options, len, NET_TCP_SACK_OPT);
+		if (sack_start == sack_end) {
+			zassert_is_null(opt, "Unexpected SACK option");
+		} else {
+			zassert_not_null(opt, "SACK option missing");
+			zassert_equal(opt[1], 2 + NET_TCP_SACK_BLOCK_SIZE,
+				      "Invalid SACK option length %u", opt[1]);
+			zassert_equal(ntohl(UNALIGNED_GET((uint32_t *)&opt[2])),
+				      sack_start, "Invalid SACK block start");
+			zassert_equal(ntohl(UNALIGNED_GET((uint32_t *)&opt[6])),
+				      sack_end, "Invalid SACK block end");
+		}
+
+		test_sem_give();
+		return;
+	default:
+		return;
+	}
+
+	ret = net_recv_data(net_iface, reply);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	return;
+fail:
+	zassert_true(false, "%s failed", __func__);
+}
+
+static void send_sack_test_data(uint32_t offset, size_t len)
+{
+	struct net_pkt *pkt;
+	uint32_t base = seq;
+	int ret;
+
+	seq = base + offset;
+	pkt = prepare_data_packet(AF_INET, htons(MY_PORT), htons(PEER_PORT),
+				  lorem_ipsum + offset, len);
+	zassert_not_null(pkt, "Cannot create pkt");
+	seq = base;
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Peer releases the semaphore after it has checked the ACK */
+	test_sem_take(K_MSEC(1000), __LINE__);
+}
+
+ZTEST(net_tcp, test_server_sack_ipv4)
+{
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	int ret;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_SACK) ||
+	    CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT == 0) {
+		ztest_test_skip();
+	}
+
+	k_sem_reset(&test_sem);
+
+	t_state = T_SYN_ACK;
+	test_case_no = 16;
+	seq = ack = 0;
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	zassert_equal(ret, 0, "Failed to get net_context");
+
+	net_context_ref(ctx);
+
+	ret = net_context_bind(ctx, (struct sockaddr *)&my_addr_s,
+			       sizeof(struct sockaddr_in));
+	zassert_equal(ret, 0, "Failed to bind net_context");
+
+	ret = net_context_listen(ctx, 1);
+	zassert_equal(ret, 0, "Failed to listen on net_context");
+
+	ret = net_context_accept(ctx, test_tcp_accept_cb, K_FOREVER, NULL);
+	zassert_equal(ret, 0, "Failed to set accept on net_context");
+
+	pkt = prepare_syn_packet(AF_INET, htons(MY_PORT), htons(PEER_PORT));
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* test_tcp_accept_cb will release the semaphore after successful
+	 * connection.
+	 */
+	test_sem_take(K_MSEC(100), __LINE__);
+
+	/* Bytes 10-19 arrive before bytes 0-9 */
+	expected_ack = seq;
+	sack_start = seq + 10U;
+	sack_end = seq + 20U;
+	send_sack_test_data(10U, 10U);
+
+	expected_ack = seq + 20U;
+	sack_start = sack_end = 0U;
+	send_sack_test_data(0U, 10U);
+
+	/* Abort the connection, no need to go through the closing handshake */
+	seq += 20U;
+	pkt = prepare_rst_packet(AF_INET, htons(MY_PORT), htons(PEER_PORT));
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
@@ -0,0 +1,454 @@
+/* main.c - TCP segmentation offload and receive coalescing tests */
+
+/*
+ * Copyright (c) 2023 The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(net_test, CONFIG_NET_L2_ETHERNET_LOG_LEVEL);
+
+#include <zephyr/types.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include <zephyr/random/random.h>
+#include <zephyr/sys/byteorder.h>
+
+#include <zephyr/ztest.h>
+
+#include <zephyr/net/ethernet.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/net/net_ip.h>
+#include <zephyr/net/net_l2.h>
+
+#include "ipv4.h"
+#include "connection.h"
+#include "net_private.h"
+
+#define SRC_PORT 4243
+#define DST_PORT 4242
+#define SEG_SIZE 500
+#define SEG_COUNT 4
+#define PAYLOAD_LEN (SEG_SIZE * SEG_COUNT - SEG_SIZE / 2)
+#define START_SEQ 0x12345678
+
+#define TCP_FLAG_PSH 0x08
+#define TCP_FLAG_ACK 0x10
+
+#define WAIT_TIME K_MSEC(100)
+
+static struct in_addr in4addr_my = { { { 192, 0, 2, 1 } } };
+static struct in_addr in4addr_peer = { { { 192, 0, 2, 2 } } };
+static struct in_addr in4addr_src = { { { 192, 0, 2, 3 } } };
+
+struct eth_context {
+	struct net_if *iface;
+	uint8_t mac_addr[6];
+
+	struct k_sem tx_sem;
+	struct net_pkt *frames[SEG_COUNT + 1];
+	int frame_count;
+
+	size_t last_len;
+	uint16_t last_gso_size;
+};
+
+static struct eth_context eth_context_sw_gso;
+static struct eth_context eth_context_hw_tso;
+
+static K_SEM_DEFINE(wait_recv, 0, UINT_MAX);
+static size_t recv_len[SEG_COUNT];
+static int recv_count;
+static bool recv_data_ok;
+
+static void eth_iface_init(struct net_if *iface)
+{
+	const struct device *dev = net_if_get_device(iface);
+	struct eth_context *context = dev->data;
+
+	context->iface = iface;
+
+	net_if_set_link_addr(iface, context->mac_addr,
+			     sizeof(context->mac_addr),
+			     NET_LINK_ETHERNET);
+
+	ethernet_init(iface);
+}
+
+static int eth_tx(const struct device *dev, struct net_pkt *pkt)
+{
+	struct eth_context *context = dev->data;
+
+	/* Cloning is limited to the MTU, so record what the driver sees */
+	context->last_len = net_pkt_get_len(pkt);
+	context->last_gso_size = net_pkt_gso_size(pkt);
+
+	if (context->frame_count < ARRAY_SIZE(context->frames)) {
+		context->frames[context->frame_count++] =
+			net_pkt_rx_clone(pkt, K_NO_WAIT);
+	}
+
+	k_sem_give(&context->tx_sem);
+
+	return 0;
+}
+
+static enum ethernet_hw_caps eth_sw_gso_caps(const struct device *dev)
+{
+	return 0;
+}
+
+static enum ethernet_hw_caps eth_hw_tso_caps(const struct device *dev)
+{
+	return ETHERNET_HW_TSO | ETHERNET_HW_TX_CHKSUM_OFFLOAD |
+		ETHERNET_HW_RX_CHKSUM_OFFLOAD;
+}
+
+static struct ethernet_api api_funcs_sw_gso = {
+	.iface_api.init = eth_iface_init,
+
+	.get_capabilities = eth_sw_gso_caps,
+	.send = eth_tx,
+};
+
+static struct ethernet_api api_funcs_hw_tso = {
+	.iface_api.init = eth_iface_init,
+
+	.get_capabilities = eth_hw_tso_caps,
+	.send = eth_tx,
+};
+
+static int eth_init(const struct device *dev)
+{
+	struct eth_context *context = dev->data;
+
+	/* 00-00-5E-00-53-xx Documentation RFC 7042 */
+	context->mac_addr[0] = 0x00;
+	context->mac_addr[1] = 0x00;
+	context->mac_addr[2] = 0x5E;
+	context->mac_addr[3] = 0x00;
+	context->mac_addr[4] = 0x53;
+	context->mac_addr[5] = sys_rand32_get();
+
+	k_sem_init(&context->tx_sem, 0, UINT_MAX);
+
+	return 0;
+}
+
+ETH_NET_DEVICE_INIT(eth_sw_gso_test, "eth_sw_gso_test",
+		    eth_init, NULL, &eth_context_sw_gso, NULL,
+		    CONFIG_ETH_INIT_PRIORITY, &api_funcs_sw_gso,
+		    NET_ETH_MTU);
+
+ETH_NET_DEVICE_INIT(eth_hw_tso_test, "eth_hw_tso_test",
+		    eth_init, NULL, &eth_context_hw_tso, NULL,
+		    CONFIG_ETH_INIT_PRIORITY, &api_funcs_hw_tso,
+		    NET_ETH_MTU);
+
+static void reset_frames(struct eth_context *context)
+{
+	for (int i = 0; i < context->frame_count; i++) {
+		if (context->frames[i]) {
+			net_pkt_unref(context->frames[i]);
+			context->frames[i] = NULL;
+		}
+	}
+
+	context->frame_count = 0;
+	k_sem_reset(&context->tx_sem);
+}
+
+static void send_tcp_super_pkt(struct eth_context *context)
+{
+	struct net_tcp_hdr hdr = { 0 };
+	size_t len = NET_IPV4TCPH_LEN + PAYLOAD_LEN;
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = net_pkt_alloc_on_iface(context->iface, K_NO_WAIT);
+	zassert_not_null(pkt, "Cannot allocate pkt");
+
+	net_pkt_set_family(pkt, AF_INET);
+
+	/* Build the packet by hand so that it is not limited to the MTU */
+	while (net_pkt_available_buffer(pkt) < len) {
+		struct net_buf *buf;
+
+		size_t frag_len = len - net_pkt_available_buffer(pkt);
+
+#if defined(CONFIG_NET_BUF_FIXED_DATA_SIZE)
+		frag_len = MIN(frag_len, CONFIG_NET_BUF_DATA_SIZE);
+#endif
+		buf = net_pkt_get_frag(pkt, frag_len, K_NO_WAIT);
+		zassert_not_null(buf, "Cannot allocate buffer");
+		net_pkt_append_buffer(pkt, buf);
+	}
+
+	zassert_ok(net_ipv4_create(pkt, &in4addr_src, &in4addr_peer),
+		   "Cannot create IPv4 header");
+
+	hdr.src_port = htons(SRC_PORT);
+	hdr.dst_port = htons(DST_PORT);
+	sys_put_be32(START_SEQ, hdr.seq);
+	sys_put_be32(1, hdr.ack);
+	hdr.offset = (sizeof(hdr) / 4) << 4;
+	hdr.flags = TCP_FLAG_PSH | TCP_FLAG_ACK;
+	sys_put_be16(8192, hdr.wnd);
+
+	zassert_ok(net_pkt_write(pkt, &hdr, sizeof(hdr)), "Cannot write TCP header");
+
+	for (int i = 0; i < PAYLOAD_LEN; i++) {
+		zassert_ok(net_pkt_write_u8(pkt, i), "Cannot write data");
+	}
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_gso_size(pkt, SEG_SIZE);
+
+	zassert_ok(net_ipv4_finalize(pkt, IPPROTO_TCP), "Cannot finalize");
+
+	ret = net_send_data(pkt);
+	if (ret < 0) {
+		net_pkt_unref(pkt);
+		zassert_ok(ret, "Cannot send packet (%d)", ret);
+	}
+}
+
+static void check_data(struct net_pkt *pkt, size_t offset, size_t len)
+{
+	uint8_t byte;
+
+	for (size_t i = 0; i < len; i++) {
+		zassert_ok(net_pkt_read_u8(pkt, &byte), "Cannot read data");
+		zassert_equal(byte, (uint8_t)(offset + i),
+			      "Invalid data at %zu", offset + i);
+	}
+}
+
+static void check_frame(struct net_pkt *frame, size_t offset, size_t len,
+			bool last)
+{
+	struct net_ipv4_hdr ip_hdr;
+	struct net_tcp_hdr tcp_hdr;
+
+	zassert_not_null(frame, "Frame not captured");
+	zassert_equal(net_pkt_get_len(frame),
+		      sizeof(struct net_eth_hdr) + NET_IPV4TCPH_LEN + len,
+		      "Invalid frame length %zu", net_pkt_get_len(frame));
+
+	net_pkt_cursor_init(frame);
+	net_pkt_set_overwrite(frame, true);
+
+	zassert_ok(net_pkt_skip(frame, sizeof(struct net_eth_hdr)), "skip");
+	zassert_ok(net_pkt_read(frame, &ip_hdr, sizeof(ip_hdr)), "IPv4 header");
+	zassert_ok(net_pkt_read(frame, &tcp_hdr, sizeof(tcp_hdr)), "TCP header");
+
+	zassert_equal(ntohs(ip_hdr.len), NET_IPV4TCPH_LEN + len,
+		      "Invalid IPv4 length");
+	zassert_equal(sys_get_be32(tcp_hdr.seq), START_SEQ + offset,
+		      "Invalid sequence number");
+	zassert_equal(tcp_hdr.flags, TCP_FLAG_ACK | (last ? TCP_FLAG_PSH : 0),
+		      "Invalid flags 0x%02x", tcp_hdr.flags);
+
+	check_data(frame, offset, len);
+}
+
+static enum net_verdict tcp_recv_cb(struct net_conn *conn,
+				    struct net_pkt *pkt,
+				    union net_ip_header *ip_hdr,
+				    union net_proto_header *proto_hdr,
+				    void *user_data)
+{
+	size_t hdr_len = net_pkt_ip_hdr_len(pkt) + sizeof(struct net_tcp_hdr);
+	size_t len = net_pkt_get_len(pkt) - hdr_len;
+	size_t offset = sys_get_be32(proto_hdr->tcp->seq) - START_SEQ;
+	uint8_t byte;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, hdr_len) < 0) {
+		recv_data_ok = false;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		if (net_pkt_read_u8(pkt, &byte) < 0 ||
+		    byte != (uint8_t)(offset + i)) {
+			recv_data_ok = false;
+			break;
+		}
+	}
+
+	if (recv_count < ARRAY_SIZE(recv_len)) {
+		recv_len[recv_count] = len;
+	}
+
+	recv_count++;
+
+	net_pkt_unref(pkt);
+	k_sem_give(&wait_recv);
+
+	return NET_OK;
+}
+
+static void inject_frames(struct eth_context *context, uint32_t skip_mask)
+{
+	/* The captured frames are addressed to the peer, so receive them
+	 * as if we were the peer.
+	 */
+	zassert_not_null(net_if_ipv4_addr_add(context->iface, &in4addr_peer,
+					      NET_ADDR_MANUAL, 0),
+			 "Cannot add peer address");
+
+	/* Queue all frames before the RX thread runs so that they can
+	 * be coalesced, like a driver handing over a burst.
+	 */
+	k_sched_lock();
+
+	for (int i = 0; i < context->frame_count; i++) {
+		struct net_eth_hdr *eth_hdr;
+		struct net_pkt *pkt;
+
+		if (skip_mask & BIT(i)) {
+			continue;
+		}
+
+		pkt = net_pkt_rx_clone(context->frames[i], K_NO_WAIT);
+		zassert_not_null(pkt, "Cannot clone frame");
+
+		net_pkt_set_iface(pkt, context->iface);
+
+		eth_hdr = NET_ETH_HDR(pkt);
+		memcpy(eth_hdr->src.addr, eth_hdr->dst.addr, sizeof(eth_hdr->src));
+		memcpy(eth_hdr->dst.addr, context->mac_addr, sizeof(eth_hdr->dst));
+
+		zassert_ok(net_recv_data(context->iface, pkt), "Cannot receive");
+	}
+
+	k_sched_unlock();
+}
+
+static void wait_recv_count(int expected)
+{
+	for (int i = 0; i < expected; i++) {
+		zassert_ok(k_sem_take(&wait_recv, WAIT_TIME),
+			   "Only %d packets received", recv_count);
+	}
+
+	zassert_equal(k_sem_take(&wait_recv, WAIT_TIME), -EAGAIN,
+		      "Too many packets received");
+	zassert_true(recv_data_ok, "Invalid data received");
+}
+
+static void send_and_capture(struct eth_context *context, int expected)
+{
+	reset_frames(context);
+	send_tcp_super_pkt(context);
+
+	for (int i = 0; i < expected; i++) {
+		zassert_ok(k_sem_take(&context->tx_sem, WAIT_TIME),
+			   "Only %d frames sent", context->frame_count);
+	}
+
+	zassert_equal(k_sem_take(&context->tx_sem, WAIT_TIME), -EAGAIN,
+		      "Too many frames sent");
+	zassert_equal(context->frame_count, expected, "Invalid frame count");
+}
+
+ZTEST(net_tcp_gso_gro, test_sw_gso)
+{
+	struct eth_context *context = &eth_context_sw_gso;
+
+	send_and_capture(context, SEG_COUNT);
+
+	for (int i = 0; i < SEG_COUNT; i++) {
+		size_t offset = i * SEG_SIZE;
+
+		check_frame(context->frames[i], offset,
+			    MIN(SEG_SIZE, PAYLOAD_LEN - offset),
+			    i == SEG_COUNT - 1);
+	}
+}
+
+ZTEST(net_tcp_gso_gro, test_hw_tso)
+{
+	struct eth_context *context = &eth_context_hw_tso;
+
+	send_and_capture(context, 1);
+
+	zassert_equal(context->last_len,
+		      sizeof(struct net_eth_hdr) + NET_IPV4TCPH_LEN + PAYLOAD_LEN,
+		      "Invalid frame length %zu", context->last_len);
+	zassert_equal(context->last_gso_size, SEG_SIZE,
+		      "Segment size not passed to the driver");
+}
+
+ZTEST(net_tcp_gso_gro, test_gro_merge)
+{
+	struct eth_context *context = &eth_context_sw_gso;
+
+	send_and_capture(context, SEG_COUNT);
+	inject_frames(context, 0);
+
+	/* Bad checksums would prevent merging and make TCP drop the data */
+	wait_recv_count(1);
+	zassert_equal(recv_len[0], PAYLOAD_LEN, "Segments not merged (%zu)",
+		      recv_len[0]);
+}
+
+ZTEST(net_tcp_gso_gro, test_gro_gap)
+{
+	struct eth_context *context = &eth_context_sw_gso;
+
+	send_and_capture(context, SEG_COUNT);
+	inject_frames(context, BIT(1));
+
+	wait_recv_count(2);
+	zassert_equal(recv_len[0], SEG_SIZE, "Invalid first length (%zu)",
+		      recv_len[0]);
+	zassert_equal(recv_len[1], PAYLOAD_LEN - 2 * SEG_SIZE,
+		      "Invalid second length (%zu)", recv_len[1]);
+}
+
+static void *setup(void)
+{
+	struct net_conn_handle *handle;
+	int ret;
+
+	zassert_not_null(eth_context_sw_gso.iface, "SW GSO interface");
+	zassert_not_null(eth_context_hw_tso.iface, "HW TSO interface");
+
+	zassert_not_null(net_if_ipv4_addr_add(eth_context_sw_gso.iface,
+					      &in4addr_my, NET_ADDR_MANUAL, 0),
+			 "Cannot add IPv4 address");
+	zassert_not_null(net_if_ipv4_addr_add(eth_context_hw_tso.iface,
+					      &in4addr_my, NET_ADDR_MANUAL, 0),
+			 "Cannot add IPv4 address");
+
+	ret = net_conn_register(IPPROTO_TCP, AF_INET, NULL, NULL, 0, DST_PORT,
+				NULL, tcp_recv_cb, NULL, &handle);
+	zassert_ok(ret, "Cannot register TCP handler (%d)", ret);
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	recv_count = 0;
+	recv_data_ok = true;
+	memset(recv_len, 0, sizeof(recv_len));
+	k_sem_reset(&wait_recv);
+}
+
+static void after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	(void)net_if_ipv4_addr_rm(eth_context_sw_gso.iface, &in4addr_peer);
+}
+
+ZTEST_SUITE(net_tcp_gso_gro, NULL, setup, before, after, NULL);
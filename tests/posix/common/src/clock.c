@@ -123,3 +123,23 @@ ZTEST(posix_apis, test_realtime)
 	zassert_true(rts.tv_nsec >= tv.tv_usec * NSEC_PER_USEC,
 			"gettimeofday didn't provide correct result");
 }
+
+ZTEST(posix_apis, test_adjtime)
+{
+	struct timeval delta = {.tv_sec = 0, .tv_usec = 200};
+	struct timeval olddelta;
+
+	zassert_ok(adjtime(&delta, NULL));
+
+	/* TESTPOINT: The correction is applied gradually */
+	zassert_ok(adjtime(NULL, &olddelta));
+	zassert_equal(olddelta.tv_sec, 0);
+	zassert_true(olddelta.tv_usec > 0 && olddelta.tv_usec <= 200,
+		     "%d us left", (int)olddelta.tv_usec);
+
+	k_msleep(200 * MSEC_PER_SEC / CONFIG_POSIX_CLOCK_ADJTIME_MAX_PPM + 100);
+
+	zassert_ok(adjtime(NULL, &olddelta));
+	zassert_equal(olddelta.tv_sec, 0);
+	zassert_equal(olddelta.tv_usec, 0, "%d us left", (int)olddelta.tv_usec);
+}
@@ -838,6 +838,28 @@ ZTEST(posix_apis, test_pthread_dynamic_stacks)
 	zassert_equal(BIOS_FOOD, x);
 }
 
+ZTEST(posix_apis, test_pthread_stale_handle)
+{
+	pthread_t first;
+	pthread_t th;
+	uint32_t x = 0;
+
+	if (!IS_ENABLED(CONFIG_DYNAMIC_THREAD)) {
+		ztest_test_skip();
+	}
+
+	zassert_ok(pthread_create(&first, NULL, fun, &x));
+	zassert_ok(pthread_join(first, NULL));
+
+	/* go through the whole pool, so that the slot of the first thread is reused */
+	for (int i = 0; i < CONFIG_MAX_PTHREAD_COUNT; i++) {
+		zassert_ok(pthread_create(&th, NULL, fun, &x));
+		zassert_false(pthread_equal(th, first));
+		zassert_equal(pthread_detach(first), ESRCH);
+		zassert_ok(pthread_join(th, NULL));
+	}
+}
+
 static void *non_null_retval(void *arg)
 {
 	ARG_UNUSED(arg);
@@ -165,4 +165,100 @@ ZTEST(img_util, test_check_flash)
 	flash_area_close(ctx.flash_area);
 }
 
+#ifdef CONFIG_IMG_DELTA
+ZTEST(img_util, test_delta)
+{
+	static const uint8_t patch[] = {
+		/* magic, size 327 */
+		0x44, 0x4c, 0x54, 0x31, 0x47, 0x01, 0x00, 0x00,
+		/* copy 300 */
+		FLASH_IMG_DELTA_OP_COPY, 0xac, 0x02,
+		/* add 4 */
+		FLASH_IMG_DELTA_OP_ADD, 0x04, 0x01, 0x02, 0x03, 0xff,
+		/* insert 3 */
+		FLASH_IMG_DELTA_OP_INSERT, 0x03, 0xaa, 0xbb, 0xcc,
+		/* seek -254 */
+		FLASH_IMG_DELTA_OP_SEEK, 0xfb, 0x03,
+		/* copy 20 */
+		FLASH_IMG_DELTA_OP_COPY, 0x14,
+	};
+	static struct flash_img_delta_context ctx;
+	static uint8_t source[512];
+	static uint8_t expected[327];
+	const struct flash_area *fa;
+	uint8_t temp;
+	size_t i;
+	int ret;
+
+	for (i = 0U; i < sizeof(source); i++) {
+		source[i] = i * 7;
+	}
+
+	memcpy(expected, source, 300);
+	expected[300] = source[300] + 0x01;
+	expected[301] = source[301] + 0x02;
+	expected[302] = source[302] + 0x03;
+	expected[303] = source[303] + 0xff;
+	expected[304] = 0xaa;
+	expected[305] = 0xbb;
+	expected[306] = 0xcc;
+	memcpy(&expected[307], &source[50], 20);
+
+	ret = flash_area_open(SLOT0_PARTITION_ID, &fa);
+	zassert_true(ret == 0, "Flash area open failure (%d)", ret);
+	ret = flash_area_erase(fa, 0, fa->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)", ret);
+	ret = flash_area_write(fa, 0, source, sizeof(source));
+	zassert_true(ret == 0, "Flash write failure (%d)", ret);
+
+	ret = flash_img_delta_init_id(&ctx, SLOT0_PARTITION_ID,
+				      SLOT0_PARTITION_ID);
+	zassert_true(ret == -EINVAL, "Same source and target areas");
+
+	ret = flash_img_delta_init_id(&ctx, SLOT0_PARTITION_ID,
+				      SLOT1_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img delta init");
+	ret = flash_area_erase(ctx.img.flash_area, 0,
+			       ctx.img.flash_area->fa_size);
+	zassert_true(ret == 0, "Flash erase failure (%d)", ret);
+
+	/* Byte by byte, to stop in every parser state */
+	for (i = 0U; i < sizeof(patch); i++) {
+		ret = flash_img_delta_write(&ctx, &patch[i], 1, false);
+		zassert_true(ret == 0, "Delta write failure (%d)", ret);
+	}
+
+	ret = flash_img_delta_write(&ctx, NULL, 0, true);
+	zassert_true(ret == 0, "Delta flush failure (%d)", ret);
+	zassert_equal(flash_img_bytes_written(&ctx.img), sizeof(expected));
+
+	for (i = 0U; i < sizeof(expected); i++) {
+		ret = flash_area_read(ctx.img.flash_area, i, &temp, 1);
+		zassert_true(ret == 0, "Flash read failure (%d)", ret);
+		zassert_equal(temp, expected[i], "Mismatch at %zu", i);
+	}
+
+	/* Truncated patch */
+	ret = flash_img_delta_init_id(&ctx, SLOT0_PARTITION_ID,
+				      SLOT1_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img delta init");
+	ret = flash_img_delta_write(&ctx, patch, sizeof(patch) - 1, true);
+	zassert_true(ret == -EINVAL, "Truncated patch accepted");
+
+	/* Copy past the end of the source */
+	ret = flash_img_delta_init_id(&ctx, SLOT0_PARTITION_ID,
+				      SLOT1_PARTITION_ID);
+	zassert_true(ret == 0, "Flash img delta init");
+	ret = flash_img_delta_write(&ctx, patch, 8, false);
+	zassert_true(ret == 0, "Delta write failure (%d)", ret);
+	ret = flash_img_delta_write(&ctx,
+				    (const uint8_t []){ FLASH_IMG_DELTA_OP_SEEK,
+							0xfe, 0xff, 0xff, 0xff, 0x0f },
+				    6, false);
+	zassert_true(ret == -EINVAL, "Seek out of the source accepted");
+
+	flash_area_close(fa);
+}
+#endif
+
 ZTEST_SUITE(img_util, NULL, NULL, NULL, NULL, NULL);
@@ -69,6 +69,11 @@ ZTEST(fcb_test_with_2sectors_set, test_fcb_rotate)
 		     "fcb_walk: entry count got different than expected");
 	zassert_true(aa_arg.elem_cnts[0] == 0 || aa_arg.elem_cnts[1] == 0,
 		     "fcb_walk: entry count got different than expected");
+#ifdef CONFIG_FCB_ENTRY_INDEX
+	zassert_true(fcb->f_entry_cnt[0] == aa_arg.elem_cnts[0] &&
+		     fcb->f_entry_cnt[1] == aa_arg.elem_cnts[1],
+		     "entry index differs from the walked entries");
+#endif
 
 	/*
 	 * One sector is full. The other one should have one entry in it.
@@ -47,6 +47,10 @@ struct flash_sector test_fcb_sector[] = {
 	}
 };
 
+#ifdef CONFIG_FCB_ENTRY_INDEX
+static uint16_t test_fcb_entry_cnt[ARRAY_SIZE(test_fcb_sector)];
+#endif
+
 
 void test_fcb_wipe(void)
 {
@@ -118,6 +122,9 @@ void fcb_tc_pretest(int sectors, struct fcb *_fcb)
 	_fcb->f_erase_value = fcb_test_erase_value;
 	_fcb->f_sector_cnt = sectors;
 	_fcb->f_sectors = test_fcb_sector; /* XXX */
+#ifdef CONFIG_FCB_ENTRY_INDEX
+	_fcb->f_entry_cnt = test_fcb_entry_cnt;
+#endif
 
 	rc = 0;
 	rc = fcb_init(TEST_FCB_FLASH_AREA_ID, _fcb);
@@ -933,3 +933,134 @@ ZTEST_F(nvs, test_nvs_cache_hash_quality)
 
 #endif
 }
+
+/*
+ * Test that the NVS lookup cache index points to the most recent ATE of
+ * every ID, and that IDs beyond its capacity can still be read.
+ */
+ZTEST_F(nvs, test_nvs_cache_index)
+{
+#ifdef CONFIG_NVS_LOOKUP_CACHE_INDEX
+	int err;
+	size_t num;
+	uint16_t id;
+	uint16_t data;
+	uint32_t ate_addr[CONFIG_NVS_LOOKUP_CACHE_SIZE];
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	for (id = 0; id < CONFIG_NVS_LOOKUP_CACHE_SIZE; id++) {
+		data = id;
+		ate_addr[id] = fixture->fs.ate_wra;
+		err = nvs_write(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+	}
+
+	for (id = 0; id < CONFIG_NVS_LOOKUP_CACHE_SIZE; id++) {
+		num = num_matching_cache_entries(ate_addr[id], false, &fixture->fs);
+		zassert_equal(num, 1, "no cache entry for id %u", id);
+	}
+	zassert_false(fixture->fs.lookup_cache_full, "cache full too early");
+
+	/* The last ID does not fit anymore */
+
+	data = CONFIG_NVS_LOOKUP_CACHE_SIZE;
+	err = nvs_write(&fixture->fs, data, &data, sizeof(data));
+	zassert_equal(err, sizeof(data), "nvs_write call failure: %d", err);
+	zassert_true(fixture->fs.lookup_cache_full, "cache not full");
+
+	for (id = 0; id <= CONFIG_NVS_LOOKUP_CACHE_SIZE; id++) {
+		err = nvs_read(&fixture->fs, id, &data, sizeof(data));
+		zassert_equal(err, sizeof(data), "nvs_read call failure: %d", err);
+		zassert_equal(data, id, "incorrect data read");
+	}
+
+	/* A deleted ID keeps its entry */
+
+	err = nvs_delete(&fixture->fs, 0);
+	zassert_equal(err, 0, "nvs_delete call failure: %d", err);
+
+	err = nvs_read(&fixture->fs, 0, &data, sizeof(data));
+	zassert_equal(err, -ENOENT, "nvs_read unexpected failure: %d", err);
+
+	err = nvs_read(&fixture->fs, 1, &data, sizeof(data));
+	zassert_equal(err, sizeof(data), "nvs_read call failure: %d", err);
+#endif
+}
+
+/*
+ * Test that nvs_gc_step() moves the entries of the oldest sector and
+ * switches sectors without losing data.
+ */
+ZTEST_F(nvs, test_nvs_gc_step)
+{
+#ifdef CONFIG_NVS_GC_INCREMENTAL
+	int err;
+	ssize_t len;
+	uint16_t id;
+	uint16_t max_id;
+	uint8_t buf[32];
+	uint8_t rd_buf[32];
+	size_t free_space;
+	size_t steps = 0;
+
+	fixture->fs.sector_count = 3;
+	err = nvs_mount(&fixture->fs);
+	zassert_true(err == 0, "nvs_mount call failure: %d", err);
+
+	err = nvs_gc_step(&fixture->fs, 1);
+	zassert_equal(err, 0, "unexpected gc step on empty fs: %d", err);
+
+	/* Fill the first sector and the second one up to the threshold */
+	for (id = 0; ; id++) {
+		free_space = fixture->fs.ate_wra - fixture->fs.data_wra;
+		if (((fixture->fs.ate_wra >> ADDR_SECT_SHIFT) == 1) &&
+		    ((free_space * 100U) <=
+		     (fixture->fs.sector_size * CONFIG_NVS_GC_INCREMENTAL_THRESHOLD))) {
+			break;
+		}
+
+		memset(buf, (uint8_t)id, sizeof(buf));
+		len = nvs_write(&fixture->fs, id, buf, sizeof(buf));
+		zassert_true(len == sizeof(buf), "nvs_write failed: %d", len);
+	}
+	max_id = id;
+
+	do {
+		err = nvs_gc_step(&fixture->fs, 1);
+		zassert_true(err >= 0, "nvs_gc_step call failure: %d", err);
+		steps++;
+	} while (err > 0);
+
+	zassert_true(steps > 2, "gc done in %zu steps", steps);
+	zassert_equal(fixture->fs.ate_wra >> ADDR_SECT_SHIFT, 2,
+		      "unexpected write sector");
+
+#ifdef CONFIG_NVS_GC_STATS
+	struct nvs_gc_stats stats;
+
+	err = nvs_gc_stats_get(&fixture->fs, &stats);
+	zassert_true(err == 0, "nvs_gc_stats_get call failure: %d", err);
+	zassert_true(stats.moved_entries > 0, "no entries moved");
+	zassert_true(stats.moved_bytes >= stats.moved_entries * sizeof(buf),
+		     "unexpected moved bytes");
+#endif
+
+	for (int i = 0; i < 2; i++) {
+		for (id = 0; id < max_id; id++) {
+			len = nvs_read(&fixture->fs, id, rd_buf, sizeof(rd_buf));
+			zassert_true(len == sizeof(rd_buf),
+				     "nvs_read unexpected failure: %d", len);
+
+			memset(buf, (uint8_t)id, sizeof(buf));
+			zassert_mem_equal(buf, rd_buf, sizeof(rd_buf),
+					  "RD buff should be equal to the WR buff");
+		}
+
+		err = nvs_mount(&fixture->fs);
+		zassert_true(err == 0, "nvs_mount call failure: %d", err);
+	}
+#endif
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/fs/fs.h>
+#include <zephyr/fs/rofs.h>
+
+#define MNTP "/rofs"
+
+static const uint8_t assets[] __aligned(8) = {
+#include "assets.rofs.inc"
+};
+
+static struct fs_mount_t mp = {
+	.type = FS_ROFS,
+	.mnt_point = MNTP,
+	.fs_data = (void *)assets,
+};
+
+static const char hello[] = "Hello, rofs!\n";
+
+ZTEST(rofs, test_read)
+{
+	struct fs_file_t file;
+	char buf[32];
+	ssize_t len;
+
+	fs_file_t_init(&file);
+	zassert_ok(fs_open(&file, MNTP "/hello.txt", FS_O_READ));
+
+	len = fs_read(&file, buf, 5);
+	zassert_equal(len, 5);
+	zassert_mem_equal(buf, hello, 5);
+
+	len = fs_read(&file, buf, sizeof(buf));
+	zassert_equal(len, strlen(hello) - 5);
+	zassert_mem_equal(buf, hello + 5, len);
+
+	zassert_equal(fs_read(&file, buf, sizeof(buf)), 0, "Expected EOF");
+
+	zassert_ok(fs_seek(&file, -1, FS_SEEK_END));
+	zassert_equal(fs_tell(&file), strlen(hello) - 1);
+	zassert_equal(fs_read(&file, buf, sizeof(buf)), 1);
+	zassert_equal(buf[0], '\n');
+
+	zassert_ok(fs_close(&file));
+}
+
+ZTEST(rofs, test_mmap)
+{
+	struct fs_file_t file;
+	const void *addr;
+	size_t size;
+
+	fs_file_t_init(&file);
+	zassert_ok(fs_open(&file, MNTP "/hello.txt", FS_O_READ));
+	zassert_ok(fs_mmap(&file, &addr, &size));
+	zassert_equal(size, strlen(hello));
+	zassert_mem_equal(addr, hello, size);
+
+	/* Content is read in place from the image, with the image alignment */
+	zassert_true(((const uint8_t *)addr >= assets) &&
+		     ((const uint8_t *)addr + size <= assets + sizeof(assets)));
+	zassert_equal((uintptr_t)addr % 8, 0, "Content not aligned");
+
+	zassert_ok(fs_close(&file));
+}
+
+ZTEST(rofs, test_stat_and_dirs)
+{
+	static const char *const web[] = { "img", "index.html" };
+	struct fs_dirent entry;
+	struct fs_dir_t dir;
+	size_t count = 0;
+
+	zassert_ok(fs_stat(MNTP "/web/img/logo.png", &entry));
+	zassert_equal(entry.type, FS_DIR_ENTRY_FILE);
+	zassert_equal(strcmp(entry.name, "logo.png"), 0);
+
+	zassert_ok(fs_stat(MNTP "/web", &entry));
+	zassert_equal(entry.type, FS_DIR_ENTRY_DIR);
+
+	zassert_equal(fs_stat(MNTP "/missing", &entry), -ENOENT);
+
+	fs_dir_t_init(&dir);
+	zassert_ok(fs_opendir(&dir, MNTP "/web"));
+	while (true) {
+		zassert_ok(fs_readdir(&dir, &entry));
+		if (entry.name[0] == '\0') {
+			break;
+		}
+		zassert_true(count < ARRAY_SIZE(web), "Too many entries");
+		zassert_equal(strcmp(entry.name, web[count]), 0);
+		count++;
+	}
+	zassert_equal(count, ARRAY_SIZE(web));
+	zassert_ok(fs_closedir(&dir));
+}
+
+ZTEST(rofs, test_read_only)
+{
+	struct fs_file_t file;
+
+	fs_file_t_init(&file);
+	zassert_equal(fs_open(&file, MNTP "/hello.txt", FS_O_RDWR), -EROFS);
+	zassert_equal(fs_open(&file, MNTP "/new.txt", FS_O_CREATE | FS_O_WRITE),
+		      -EROFS);
+	zassert_equal(fs_unlink(MNTP "/hello.txt"), -EROFS);
+	zassert_equal(fs_mkdir(MNTP "/dir"), -EROFS);
+}
+
+static void *rofs_setup(void)
+{
+	zassert_ok(fs_mount(&mp));
+
+	return NULL;
+}
+
+ZTEST_SUITE(rofs, NULL, rofs_setup, NULL, NULL, NULL);
@@ -46,12 +46,15 @@ INPUT_CALLBACK_DEFINE(NULL, input_cb_unfiltered);
 
 ZTEST(input_api, test_sequence_thread)
 {
+	struct input_queue_stats stats;
 	int i;
 	int ret;
 
 	message_count_filtered = 0;
 	message_count_unfiltered = 0;
 
+	zassert_ok(input_queue_stats_get(&stats, true));
+
 	k_sem_take(&cb_start, K_FOREVER);
 	k_sem_take(&cb_done, K_FOREVER);
 
@@ -74,6 +77,10 @@ ZTEST(input_api, test_sequence_thread)
 	ret = input_report_key(&fake_dev, 0, 1, false, K_NO_WAIT);
 	zassert_equal(ret, -ENOMSG, "ret: %d", ret);
 
+	zassert_ok(input_queue_stats_get(&stats, false));
+	zassert_equal(stats.max_used, CONFIG_INPUT_QUEUE_MAX_MSGS);
+	zassert_equal(stats.dropped, 1);
+
 	k_sem_give(&cb_start);
 
 	/* wait for cb to get all the messages */
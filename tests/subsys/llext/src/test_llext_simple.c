@@ -9,8 +9,14 @@
 #include <zephyr/llext/llext.h>
 #include <zephyr/llext/buf_loader.h>
 
+#ifdef CONFIG_LLEXT_STORAGE_WRITABLE
+#define LLEXT_CONST
+#else
+#define LLEXT_CONST const
+#endif
+
 #ifdef CONFIG_ARM /* ARMV7 */
-const static uint8_t hello_world_elf[] __aligned(4) = {
+LLEXT_CONST static uint8_t hello_world_elf[] __aligned(4) = {
 #include "hello_world.inc"
 };
 #endif
@@ -37,6 +43,16 @@ ZTEST(llext, test_llext_simple)
 
 	zassert_ok(res, "load should succeed");
 
+	/* Sections left unmodified are used from the buffer */
+	zassert_false(ext->mem_on_heap[LLEXT_MEM_STRTAB], "strtab should not be copied");
+	zassert_between_inclusive((uintptr_t)ext->mem[LLEXT_MEM_STRTAB],
+				  (uintptr_t)hello_world_elf,
+				  (uintptr_t)hello_world_elf + sizeof(hello_world_elf) - 1,
+				  "strtab should be in the buffer");
+	zassert_equal(ext->mem_on_heap[LLEXT_MEM_TEXT],
+		      !IS_ENABLED(CONFIG_LLEXT_STORAGE_WRITABLE),
+		      "relocated text should only be copied from read-only storage");
+
 	const void * const hello_world_fn = llext_find_sym(&ext->sym_tab, "hello_world");
 
 	zassert_not_null(hello_world_fn, "hello_world should be an exported symbol");
@@ -230,13 +230,119 @@ ZTEST(test_log_benchmark, test_log_message_with_string)
 		cyc / repeat, us / repeat);
 }
 
+static void run_log_message_filtered_out(void)
+{
+	uint32_t cyc;
+	int repeat = 100;
+
+	test_helpers_log_setup();
+	log_filter_set(NULL, Z_LOG_LOCAL_DOMAIN_ID, LOG_CURRENT_MODULE_ID(), LOG_LEVEL_WRN);
+
+	cyc = test_helpers_cycle_get();
+	for (int i = 0; i < repeat; i++) {
+		LOG_INF("test %d %d", i, repeat);
+	}
+	cyc = test_helpers_cycle_get() - cyc;
+
+	zassert_false(log_data_pending(), "Filtered out messages were stored");
+
+	PRINT("%sFiltered out message: %u cycles (%u us)\n",
+	      k_is_user_context() ? "USERSPACE: " : "",
+	      cyc / repeat, k_cyc_to_us_ceil32(cyc) / repeat);
+}
+
+/** Measure the cost of a log call which is filtered out at runtime. */
+ZTEST(test_log_benchmark, test_log_message_filtered_out)
+{
+	if (!IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING)) {
+		ztest_test_skip();
+	}
+
+	run_log_message_filtered_out();
+}
+
+ZTEST_USER(test_log_benchmark, test_log_message_filtered_out_from_user)
+{
+	if (!IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) || !IS_ENABLED(CONFIG_USERSPACE)) {
+		ztest_test_skip();
+	}
+
+	run_log_message_filtered_out();
+}
+
+#define SMP_PRODUCERS_MAX MIN(CONFIG_MP_MAX_NUM_CPUS, 4)
+#define SMP_PRODUCER_MSGS 16
+#define SMP_PRODUCER_STACK_SIZE (2048 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+static K_THREAD_STACK_ARRAY_DEFINE(producer_stacks, SMP_PRODUCERS_MAX,
+				   SMP_PRODUCER_STACK_SIZE);
+static struct k_thread producer_threads[SMP_PRODUCERS_MAX];
+static uint32_t producer_cycles[SMP_PRODUCERS_MAX];
+static atomic_t producers_ready;
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	int idx = POINTER_TO_INT(p1);
+	int producers = POINTER_TO_INT(p2);
+	uint32_t cyc;
+
+	/* Start logging once all producers are running on their own CPU. */
+	atomic_inc(&producers_ready);
+	while (atomic_get(&producers_ready) < producers) {
+		k_busy_wait(1);
+	}
+
+	cyc = test_helpers_cycle_get();
+	for (int i = 0; i < SMP_PRODUCER_MSGS; i++) {
+		LOG_INF("test %d %d", idx, i);
+	}
+	producer_cycles[idx] = test_helpers_cycle_get() - cyc;
+}
+
+/** Measure the cost of logging a message while 1 to 4 CPUs are logging at
+ * the same time.
+ */
+ZTEST(test_log_benchmark, test_log_message_store_time_smp)
+{
+	for (int producers = 1; producers <= SMP_PRODUCERS_MAX; producers++) {
+		uint32_t total_cyc = 0;
+		uint32_t total_msg = producers * SMP_PRODUCER_MSGS;
+
+		test_helpers_log_setup();
+		atomic_set(&producers_ready, 0);
+
+		/* Producers have a lower priority than the test thread so
+		 * they only all run once it waits for them.
+		 */
+		for (int i = 0; i < producers; i++) {
+			k_thread_create(&producer_threads[i], producer_stacks[i],
+					K_THREAD_STACK_SIZEOF(producer_stacks[i]),
+					producer, INT_TO_POINTER(i),
+					INT_TO_POINTER(producers), NULL,
+					K_PRIO_PREEMPT(CONFIG_MAIN_THREAD_PRIORITY + 1),
+					0, K_NO_WAIT);
+		}
+
+		for (int i = 0; i < producers; i++) {
+			k_thread_join(&producer_threads[i], K_FOREVER);
+			total_cyc += producer_cycles[i];
+		}
+
+		PRINT("%d producing CPU(s): average logging a message: %u cycles (%u us)%s\n",
+		      producers, total_cyc / total_msg,
+		      k_cyc_to_us_ceil32(total_cyc) / total_msg,
+		      test_helpers_log_dropped_pending() ? ", messages dropped" : "");
+	}
+}
+
 /*test case main entry*/
 static void *log_benchmark_setup(void)
 {
 	PRINT("LOGGING MODE:%s\n", IS_ENABLED(CONFIG_LOG_MODE_DEFERRED) ? "DEFERRED" : "IMMEDIATE");
 	PRINT("\tOVERWRITE: %d\n", IS_ENABLED(CONFIG_LOG_MODE_OVERFLOW));
 	PRINT("\tBUFFER_SIZE: %d\n", CONFIG_LOG_BUFFER_SIZE);
-	PRINT("\tSPEED: %d", IS_ENABLED(CONFIG_LOG_SPEED));
+	PRINT("\tSPEED: %d\n", IS_ENABLED(CONFIG_LOG_SPEED));
+	PRINT("\tPER_CPU_BUFFERS: %d", IS_ENABLED(CONFIG_LOG_PER_CPU_BUFFERS));
 
 	return NULL;
 }
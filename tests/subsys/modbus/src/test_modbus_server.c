@@ -72,15 +72,15 @@ static int discrete_input_rd(uint16_t addr, bool *state)
 	return 0;
 }
 
-static int input_reg_rd(uint16_t addr, uint16_t *reg)
+static int input_regs_rd(uint16_t addr, uint16_t *regs, uint16_t num_regs)
 {
-	if (addr >= ARRAY_SIZE(holding_reg)) {
+	if ((addr + num_regs) > ARRAY_SIZE(holding_reg)) {
 		return -ENOTSUP;
 	}
 
-	*reg = holding_reg[addr];
+	memcpy(regs, &holding_reg[addr], num_regs * sizeof(uint16_t));
 
-	LOG_DBG("Input register read, addr %u, 0x%04x", addr, *reg);
+	LOG_DBG("Input registers read, addr %u, count %u", addr, num_regs);
 
 	return 0;
 }
@@ -159,8 +159,8 @@ static struct modbus_user_callbacks mbs_cbs = {
 	.coil_wr = coil_wr,
 	/* Discrete Input read callback */
 	.discrete_input_rd = discrete_input_rd,
-	/* Input Register read callback */
-	.input_reg_rd = input_reg_rd,
+	/* Input Register block read callback */
+	.input_regs_rd = input_regs_rd,
 	/* Floating Point Input Register read callback */
 	.input_reg_rd_fp = input_reg_rd_fp,
 	/* Holding Register read/write callback */
@@ -113,7 +113,14 @@ void modem_backend_mock_reset(struct modem_backend_mock *mock)
 
 int modem_backend_mock_get(struct modem_backend_mock *mock, uint8_t *buf, size_t size)
 {
-	return ring_buf_get(&mock->tx_rb, buf, size);
+	int ret;
+
+	ret = ring_buf_get(&mock->tx_rb, buf, size);
+	if (ret > 0) {
+		modem_pipe_notify_transmit_idle(&mock->pipe);
+	}
+
+	return ret;
 }
 
 void modem_backend_mock_put(struct modem_backend_mock *mock, const uint8_t *buf, size_t size)
@@ -595,6 +595,125 @@ ZTEST(rtio_api, test_rtio_transaction)
 	}
 }
 
+#ifdef CONFIG_RTIO_OP_DELAY
+RTIO_DEFINE(r_delay, SQE_POOL_SIZE, CQE_POOL_SIZE);
+
+RTIO_IODEV_TEST_DEFINE(iodev_test_delay);
+
+/**
+ * @brief Test delay requests
+ *
+ * Ensures that a delay chained to a request holds it back until the
+ * timeout expires, with both relative and absolute timeouts.
+ */
+void test_rtio_delay_(struct rtio *r, bool absolute)
+{
+	int res;
+	uintptr_t userdata[2] = {0, 1};
+	struct rtio_sqe *sqe;
+	struct rtio_cqe *cqe;
+	k_timeout_t timeout = K_MSEC(20);
+	int64_t start = k_uptime_get();
+
+#ifdef CONFIG_TIMEOUT_64BIT
+	if (absolute) {
+		timeout = K_TIMEOUT_ABS_MS(start + 20);
+	}
+#endif
+
+	sqe = rtio_sqe_acquire(r);
+	zassert_not_null(sqe, "Expected a valid sqe");
+	rtio_sqe_prep_delay(sqe, timeout, &userdata[0]);
+	sqe->flags |= RTIO_SQE_CHAINED;
+
+	sqe = rtio_sqe_acquire(r);
+	zassert_not_null(sqe, "Expected a valid sqe");
+	rtio_sqe_prep_nop(sqe, (struct rtio_iodev *)&iodev_test_delay, &userdata[1]);
+
+	res = rtio_submit(r, 2);
+	zassert_ok(res, "Should return ok from rtio_execute");
+	zassert_true(k_uptime_get() - start >= 20, "Expected the delay to expire first");
+
+	for (int i = 0; i < 2; i++) {
+		cqe = rtio_cqe_consume(r);
+		zassert_not_null(cqe, "Expected a valid cqe");
+		zassert_ok(cqe->result, "Result should be ok");
+		zassert_equal_ptr(cqe->userdata, &userdata[i], "Expected in order completions");
+		rtio_cqe_release(r, cqe);
+	}
+}
+
+ZTEST(rtio_api, test_rtio_delay)
+{
+	rtio_iodev_test_init(&iodev_test_delay);
+
+	for (int i = 0; i < TEST_REPEATS; i++) {
+		test_rtio_delay_(&r_delay, false);
+	}
+
+	if (IS_ENABLED(CONFIG_TIMEOUT_64BIT)) {
+		test_rtio_delay_(&r_delay, true);
+	}
+}
+#endif /* CONFIG_RTIO_OP_DELAY */
+
+RTIO_DEFINE(r_batch, SQE_POOL_SIZE, CQE_POOL_SIZE);
+
+RTIO_IODEV_TEST_DEFINE(iodev_test_batch);
+
+/**
+ * @brief Test batch consumption of completions
+ *
+ * Ensures that the completions of several requests are consumed at once,
+ * and that a batch which cannot be met returns what is available on timeout.
+ */
+void test_rtio_batch_(struct rtio *r)
+{
+	int res;
+	uintptr_t userdata[SQE_POOL_SIZE];
+	struct rtio_cqe *cqes[CQE_POOL_SIZE];
+	struct rtio_sqe *sqe;
+	size_t count;
+
+	for (int i = 0; i < SQE_POOL_SIZE; i++) {
+		userdata[i] = i;
+		sqe = rtio_sqe_acquire(r);
+		zassert_not_null(sqe, "Expected a valid sqe");
+		rtio_sqe_prep_nop(sqe, (struct rtio_iodev *)&iodev_test_batch, &userdata[i]);
+	}
+
+	res = rtio_submit(r, 0);
+	zassert_ok(res, "Should return ok from rtio_execute");
+
+	count = rtio_cqe_consume_batch(r, cqes, SQE_POOL_SIZE, ARRAY_SIZE(cqes), K_SECONDS(1));
+	zassert_equal(count, SQE_POOL_SIZE, "Expected all completions in one batch");
+	for (int i = 0; i < count; i++) {
+		zassert_ok(cqes[i]->result, "Result should be ok");
+		zassert_equal_ptr(cqes[i]->userdata, &userdata[i], "Expected in order completions");
+		rtio_cqe_release(r, cqes[i]);
+	}
+
+	sqe = rtio_sqe_acquire(r);
+	zassert_not_null(sqe, "Expected a valid sqe");
+	rtio_sqe_prep_nop(sqe, (struct rtio_iodev *)&iodev_test_batch, &userdata[0]);
+
+	res = rtio_submit(r, 1);
+	zassert_ok(res, "Should return ok from rtio_execute");
+
+	count = rtio_cqe_poll_batch(r, cqes, 2, ARRAY_SIZE(cqes), K_MSEC(10));
+	zassert_equal(count, 1, "Expected the available completion on timeout");
+	rtio_cqe_release(r, cqes[0]);
+}
+
+ZTEST(rtio_api, test_rtio_batch)
+{
+	rtio_iodev_test_init(&iodev_test_batch);
+
+	for (int i = 0; i < TEST_REPEATS; i++) {
+		test_rtio_batch_(&r_batch);
+	}
+}
+
 #define THROUGHPUT_ITERS 100000
 RTIO_DEFINE(r_throughput, SQE_POOL_SIZE, CQE_POOL_SIZE);
 
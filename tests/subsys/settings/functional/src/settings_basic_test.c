@@ -619,3 +619,76 @@ ZTEST(settings_functional, test_direct_loading_filter)
 	}
 	settings_deregister(&filtered_loader_settings);
 }
+
+ZTEST(settings_functional, test_transaction)
+{
+#if defined(CONFIG_SETTINGS_TRANSACTION)
+	int rc;
+	uint8_t val;
+
+	settings_subsys_init();
+
+	rc = settings_transaction_begin();
+	zassert_true(rc == 0, "settings_transaction_begin failed");
+
+	rc = settings_transaction_begin();
+	zassert_equal(-EBUSY, rc, "nested transaction allowed");
+
+	val = 1;
+	rc = settings_save_one("txn/a", &val, sizeof(val));
+	zassert_true(rc == 0);
+	val = 2;
+	rc = settings_save_one("txn/b", &val, sizeof(val));
+	zassert_true(rc == 0);
+	/* the value saved last replaces the buffered one */
+	val = 3;
+	rc = settings_save_one("txn/a", &val, sizeof(val));
+	zassert_true(rc == 0);
+
+	/* nothing is stored before commit */
+	direct_load_cnt = 0;
+	rc = settings_load_subtree_direct("txn/a", direct_loader,
+					  (void *)0x1234);
+	zassert_true(rc == 0);
+	zassert_equal(0, direct_load_cnt);
+
+	rc = settings_transaction_commit();
+	zassert_true(rc == 0, "settings_transaction_commit failed");
+
+	direct_load_cnt = 0;
+	rc = settings_load_subtree_direct("txn/a", direct_loader,
+					  (void *)0x1234);
+	zassert_true(rc == 0);
+	zassert_equal(1, direct_load_cnt);
+	zassert_equal(3, val_directly_loaded);
+
+	direct_load_cnt = 0;
+	rc = settings_load_subtree_direct("txn/b", direct_loader,
+					  (void *)0x1234);
+	zassert_true(rc == 0);
+	zassert_equal(1, direct_load_cnt);
+	zassert_equal(2, val_directly_loaded);
+
+	/* an aborted transaction stores nothing */
+	rc = settings_transaction_begin();
+	zassert_true(rc == 0, "settings_transaction_begin failed");
+	rc = settings_delete("txn/a");
+	zassert_true(rc == 0);
+	rc = settings_transaction_abort();
+	zassert_true(rc == 0, "settings_transaction_abort failed");
+
+	direct_load_cnt = 0;
+	rc = settings_load_subtree_direct("txn/a", direct_loader,
+					  (void *)0x1234);
+	zassert_true(rc == 0);
+	zassert_equal(1, direct_load_cnt);
+
+	rc = settings_transaction_commit();
+	zassert_equal(-EINVAL, rc, "commit without transaction allowed");
+
+	settings_delete("txn/a");
+	settings_delete("txn/b");
+#else
+	ztest_test_skip();
+#endif
+}
@@ -643,6 +643,42 @@ ZTEST(lib_stream_flash, test_stream_flash_progress_clear)
 #endif
 }
 
+ZTEST(lib_stream_flash, test_stream_flash_pipeline)
+{
+#ifndef CONFIG_STREAM_FLASH_PIPELINE
+	ztest_test_skip();
+#else
+	static uint8_t generic_buf2[BUF_LEN];
+	int num_pages = MAX_NUM_PAGES - 1;
+	size_t len = (page_size * num_pages) + 128;
+	int rc;
+
+	init_target();
+
+	rc = stream_flash_pipeline_init(&ctx, generic_buf2);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, len, false);
+	zassert_equal(rc, 0, "expected success");
+
+	/* The last full buffer may still be in progress */
+	zassert_true(stream_flash_bytes_written(&ctx) >=
+		     (page_size * num_pages) - BUF_LEN,
+		     "expected previous buffers to be written");
+
+	rc = stream_flash_pipeline_init(&ctx, generic_buf2);
+	zassert_equal(rc, -EBUSY, "should fail once writing started");
+
+	rc = stream_flash_buffered_write(&ctx, NULL, 0, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(stream_flash_bytes_written(&ctx), len,
+		      "all data should be written after flush");
+
+	VERIFY_WRITTEN(0, len);
+	VERIFY_ERASED(len, page_size - 128);
+#endif
+}
+
 void lib_stream_flash_before(void *data)
 {
 	zassume_true(device_is_ready(fdev), "Device is not ready");
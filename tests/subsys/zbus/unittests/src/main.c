@@ -8,6 +8,7 @@
 #include <zephyr/irq_offload.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/net/buf.h>
 #include <zephyr/zbus/zbus.h>
 #include <zephyr/ztest.h>
 LOG_MODULE_DECLARE(zbus, CONFIG_ZBUS_LOG_LEVEL);
@@ -100,6 +101,13 @@ ZBUS_CHAN_DEFINE(msg_sub_no_pool_chan,                      /* Name */
 		 ZBUS_OBSERVERS(foo_msg_sub, foo2_msg_sub), /* observers */
 		 ZBUS_MSG_INIT(0) /* Initial value major 0, minor 1, build 1023 */
 );
+ZBUS_CHAN_DEFINE(async_chan,                  /* Name */
+		 int,                         /* Message type */
+		 NULL,                        /* Validator */
+		 NULL,                        /* User data */
+		 ZBUS_OBSERVERS(async_lis),   /* observers */
+		 ZBUS_MSG_INIT(0)             /* Initial value */
+);
 static int count_fast;
 
 static void callback(const struct zbus_channel *chan)
@@ -760,4 +768,65 @@ ZTEST(basic, test_specification_based__zbus_sub_wait_msg)
 	irq_offload(isr_sub_wait_msg, NULL);
 }
 
+ZTEST(basic, test_specification_based__zbus_sub_wait_msg_ref)
+{
+	const struct zbus_channel *chan;
+	struct net_buf *buf;
+	int msg = 42;
+
+	zassert_equal(-EFAULT, zbus_sub_wait_msg_ref(NULL, &chan, &buf, K_NO_WAIT), NULL);
+	zassert_equal(-EFAULT, zbus_sub_wait_msg_ref(&foo_sub, &chan, &buf, K_NO_WAIT), NULL);
+	zassert_equal(-EFAULT, zbus_sub_wait_msg_ref(&foo_msg_sub, NULL, &buf, K_NO_WAIT), NULL);
+	zassert_equal(-EFAULT, zbus_sub_wait_msg_ref(&foo_msg_sub, &chan, NULL, K_NO_WAIT), NULL);
+	zassert_equal(-ENOMSG, zbus_sub_wait_msg_ref(&foo_msg_sub, &chan, &buf, K_NO_WAIT), NULL);
+
+	zbus_obs_set_enable(&foo_msg_sub, true);
+	zassert_equal(0, zbus_chan_pub(&msg_sub_fail_chan, &msg, K_MSEC(200)), NULL);
+
+	zassert_equal(0, zbus_sub_wait_msg_ref(&foo_msg_sub, &chan, &buf, K_MSEC(500)), NULL);
+	zassert_equal_ptr(&msg_sub_fail_chan, chan, NULL);
+	zassert_equal(sizeof(msg), buf->len, NULL);
+	zassert_mem_equal(&msg, buf->data, sizeof(msg), NULL);
+	net_buf_unref(buf);
+
+	zbus_obs_set_enable(&foo_msg_sub, false);
+}
+
+static K_SEM_DEFINE(async_gate, 0, 1);
+static K_SEM_DEFINE(async_done, 0, 1);
+static int async_count;
+
+static void async_callback(const struct zbus_channel *chan)
+{
+	k_sem_take(&async_gate, K_FOREVER);
+	async_count++;
+	k_sem_give(&async_done);
+}
+
+ZBUS_ASYNC_LISTENER_DEFINE(async_lis, async_callback, 1);
+
+ZTEST(basic, test_async_listener)
+{
+	struct zbus_chan_pub_stats stats;
+	int msg = 1;
+
+	zassert_equal(0, zbus_chan_pub_stats_reset(&async_chan, K_NO_WAIT), NULL);
+
+	/* The publisher does not wait for the listener */
+	zassert_equal(0, zbus_chan_pub(&async_chan, &msg, K_NO_WAIT), NULL);
+	zassert_equal(0, async_count, NULL);
+
+	/* The queue is full, the notification is dropped */
+	zassert_equal(-ENOMSG, zbus_chan_pub(&async_chan, &msg, K_NO_WAIT), NULL);
+
+	k_sem_give(&async_gate);
+	zassert_equal(0, k_sem_take(&async_done, K_MSEC(500)), NULL);
+	zassert_equal(1, async_count, NULL);
+
+	zassert_equal(0, zbus_chan_pub_stats_get(&async_chan, &stats, K_NO_WAIT), NULL);
+	zassert_equal(2, stats.count, NULL);
+	zassert_true(stats.max_latency >= stats.last_latency, NULL);
+	zassert_true(stats.total_latency >= stats.max_latency, NULL);
+}
+
 ZTEST_SUITE(basic, NULL, NULL, NULL, NULL, NULL);
@@ -50,6 +50,24 @@ ZTEST(crc, test_crc32_ieee)
 	zassert_equal(crc32_ieee(test3, sizeof(test3)), 0x20089AA4);
 }
 
+ZTEST(crc, test_crc32_long)
+{
+	uint8_t test[100];
+
+	for (size_t i = 0; i < sizeof(test); i++) {
+		test[i] = i * 7 + 3;
+	}
+
+	/* Long enough for the multi-byte steps, split at odd offsets */
+	zassert_equal(crc32_ieee(test, sizeof(test)), 0xAA316B09);
+	zassert_equal(crc32_ieee_update(crc32_ieee(test, 37), test + 37,
+					sizeof(test) - 37), 0xAA316B09);
+
+	zassert_equal(crc32_c(0, test, sizeof(test), true, true), 0x594B1B65);
+	zassert_equal(crc32_c(crc32_c(0, test, 13, true, false), test + 13,
+			      sizeof(test) - 13, false, true), 0x594B1B65);
+}
+
 ZTEST(crc, test_crc16)
 {
 	uint8_t test[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
@@ -170,6 +188,19 @@ ZTEST(crc, test_crc8_ccitt)
 			   sizeof(test2)) == 0xFB, "pass", "fail");
 }
 
+ZTEST(crc, test_crc8_rohc)
+{
+	uint8_t test0[] = { 0 };
+	uint8_t test1[] = { 'A' };
+	uint8_t test2[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+	zassert_equal(crc8_rohc(0xFF, test0, sizeof(test0)), 0xCF);
+	zassert_equal(crc8_rohc(0xFF, test1, sizeof(test1)), 0x2E);
+	zassert_equal(crc8_rohc(0xFF, test2, sizeof(test2)), 0xD0);
+	zassert_equal(crc8_rohc(0xFF, test2, sizeof(test2)),
+		      crc8(test2, sizeof(test2), 0xE0, 0xFF, true));
+}
+
 ZTEST(crc, test_crc7_be)
 {
 	uint8_t test0[] = { 0 };
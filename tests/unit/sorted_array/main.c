@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/ztest.h>
+#include <zephyr/sys/sorted_array.h>
+
+#include "../../../lib/os/sorted_array.c"
+
+#define MAX_NODES 256
+
+struct node {
+	uint32_t key;
+};
+
+static struct node nodes[MAX_NODES];
+
+static bool node_lessthan(const void *a, const void *b)
+{
+	return ((const struct node *)a)->key < ((const struct node *)b)->key;
+}
+
+SYS_SORTED_ARRAY_DEFINE(test_array, MAX_NODES, node_lessthan);
+
+/* Checks the array is sorted, with equal keys in insertion (index) order */
+static void check_array(size_t expected_size)
+{
+	struct node *prev = NULL;
+	struct node *n;
+	size_t count = 0;
+
+	SYS_SORTED_ARRAY_FOR_EACH(&test_array, n) {
+		if (prev != NULL) {
+			zassert_true(prev->key < n->key ||
+				     (prev->key == n->key && prev < n),
+				     "array not sorted at %zu", count);
+		}
+		prev = n;
+		count++;
+	}
+
+	zassert_equal(count, expected_size);
+	zassert_equal(sys_sorted_array_size(&test_array), expected_size);
+}
+
+static void *sorted_array_setup(void)
+{
+	/* Few distinct keys so that many elements compare equal */
+	for (int i = 0; i < MAX_NODES; i++) {
+		nodes[i].key = (i * 37) % 61;
+	}
+
+	return NULL;
+}
+
+static void sorted_array_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	test_array.size = 0;
+}
+
+ZTEST(sorted_array, test_insert_remove)
+{
+	size_t size = 0;
+
+	for (int i = 0; i < MAX_NODES; i++) {
+		zassert_ok(sys_sorted_array_insert(&test_array, &nodes[i]));
+		check_array(++size);
+	}
+
+	zassert_equal(sys_sorted_array_insert(&test_array, &nodes[0]), -ENOMEM);
+
+	for (int i = 0; i < MAX_NODES; i++) {
+		zassert_true(sys_sorted_array_contains(&test_array, &nodes[i]));
+	}
+
+	for (int i = 0; i < MAX_NODES; i += 2) {
+		zassert_true(sys_sorted_array_remove(&test_array, &nodes[i]));
+		zassert_false(sys_sorted_array_contains(&test_array, &nodes[i]));
+		zassert_false(sys_sorted_array_remove(&test_array, &nodes[i]));
+		check_array(--size);
+	}
+
+	for (int i = 1; i < MAX_NODES; i += 2) {
+		zassert_true(sys_sorted_array_contains(&test_array, &nodes[i]));
+	}
+}
+
+ZTEST(sorted_array, test_min_max)
+{
+	struct node *n;
+	struct node *prev = NULL;
+
+	zassert_is_null(sys_sorted_array_get_min(&test_array));
+	zassert_is_null(sys_sorted_array_get_max(&test_array));
+	zassert_is_null(sys_sorted_array_remove_min(&test_array));
+
+	for (int i = 0; i < MAX_NODES; i++) {
+		zassert_ok(sys_sorted_array_insert(&test_array, &nodes[i]));
+	}
+
+	zassert_equal(((struct node *)sys_sorted_array_get_min(&test_array))->key, 0);
+	zassert_equal(((struct node *)sys_sorted_array_get_max(&test_array))->key, 60);
+
+	while ((n = sys_sorted_array_remove_min(&test_array)) != NULL) {
+		if (prev != NULL) {
+			zassert_true(prev->key < n->key || (prev->key == n->key && prev < n));
+		}
+		prev = n;
+	}
+
+	zassert_equal(sys_sorted_array_size(&test_array), 0);
+}
+
+ZTEST(sorted_array, test_remove_while_iterating)
+{
+	struct node *n;
+	size_t count = 0;
+
+	for (int i = 0; i < MAX_NODES; i++) {
+		zassert_ok(sys_sorted_array_insert(&test_array, &nodes[i]));
+	}
+
+	SYS_SORTED_ARRAY_FOR_EACH(&test_array, n) {
+		if ((n - nodes) % 3 == 0) {
+			zassert_true(sys_sorted_array_remove(&test_array, n));
+		}
+		count++;
+	}
+
+	zassert_equal(count, MAX_NODES);
+	check_array(MAX_NODES - (MAX_NODES + 2) / 3);
+}
+
+ZTEST_SUITE(sorted_array, NULL, sorted_array_setup, sorted_array_before, NULL, NULL);